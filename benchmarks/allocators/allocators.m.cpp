@@ -0,0 +1,569 @@
+// allocators.m.cpp                                                   -*-C++-*-
+
+//@PURPOSE: Benchmark the BDE allocators on standard container workloads.
+//
+//@DESCRIPTION: This program times a set of container workloads, each run with
+// each of a set of allocation strategies, and prints one machine-readable
+// record per (workload, strategy) pair, so that the results of two builds
+// (e.g., before and after upgrading BDE) can be compared mechanically.
+//
+// Following "On Quantifying Memory-Allocation Strategies" (P0089R1), each
+// workload is run as a number of *episodes*: an episode creates the
+// containers of the workload, exercises them, and destroys them.  A *local*
+// strategy creates a new allocator for each episode, supplied with memory by
+// 'bslma::NewDeleteAllocator', and destroys it (releasing all of its memory)
+// at the end of the episode; a *global* strategy uses a single allocator for
+// all episodes, and, if several threads are requested, for all threads.
+//
+// The strategies are:
+//..
+//  newdelete                 'bslma::NewDeleteAllocator' (global)
+//  multipool                 'bdlma::MultipoolAllocator' (i.e., a
+//                            'bdlma::Multipool') (local)
+//  sequential                'bdlma::SequentialAllocator' (local)
+//  bufferedsequential        'bdlma::BufferedSequentialAllocator' over a
+//                            64KB buffer reused by every episode (local)
+//  localsequential           'bdlma::LocalSequentialAllocator<65536>' (local)
+//  concurrentmultipool       'bdlma::ConcurrentMultipoolAllocator' (global)
+//  threadcachingmultipool    'bdlma::ThreadCachingMultipoolAllocator' (global)
+//..
+// The workloads are:
+//..
+//  vector_int                push_back of ints into a 'bsl::vector'
+//  vector_string             push_back of strings into a 'bsl::vector'
+//  unordered_map_int         insertion, erasure, and lookup of ints in a
+//                            'bsl::unordered_map'
+//  unordered_map_string      insertion and lookup of strings in a
+//                            'bsl::unordered_map'
+//  string_append             appending to, and copying, 'bsl::string's
+//..
+// The output is a CSV table (the default) or a JSON array, having one record
+// per (workload, strategy) pair with the fields:
+//..
+//  workload                  name of the workload
+//  allocator                 name of the strategy
+//  threads                   number of threads running episodes
+//  elements                  number of elements per episode
+//  episodes                  number of episodes, over all threads
+//  total_ns                  wall-clock time of all episodes
+//  ns_per_episode            'total_ns * threads / episodes'
+//  checksum                  value computed by the episodes, identical for
+//                            every strategy of a workload
+//..
+// Run 'allocators -h' for the command-line options.
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+enum { k_BUFFER_SIZE = 64 * 1024 };
+
+// ============================================================================
+//                               WORKLOADS
+// ----------------------------------------------------------------------------
+
+Uint64 vectorInt(bslma::Allocator *allocator, int numElements)
+    // Append the specified 'numElements' integers, one at a time, to a vector
+    // using the specified 'allocator', and return a checksum of its content.
+{
+    bsl::vector<int> v(allocator);
+
+    for (int i = 0; i < numElements; ++i) {
+        v.push_back(i);
+    }
+    return v.size() + v[v.size() / 2];
+}
+
+Uint64 vectorString(bslma::Allocator *allocator, int numElements)
+    // Append the specified 'numElements' strings, each too long for the
+    // short-string optimization, one at a time, to a vector using the
+    // specified 'allocator', and return a checksum of its content.
+{
+    bsl::vector<bsl::string> v(allocator);
+
+    for (int i = 0; i < numElements; ++i) {
+        v.push_back(bsl::string(32 + i % 32, static_cast<char>('a' + i % 26)));
+    }
+
+    Uint64 checksum = 0;
+    for (bsl::size_t i = 0; i < v.size(); ++i) {
+        checksum += v[i].size();
+    }
+    return checksum;
+}
+
+Uint64 unorderedMapInt(bslma::Allocator *allocator, int numElements)
+    // Insert the specified 'numElements' integer keys into an unordered map
+    // using the specified 'allocator', erase every other one, insert them
+    // again, and return a checksum of the lookups of all keys.
+{
+    bsl::unordered_map<int, int> m(allocator);
+
+    for (int i = 0; i < numElements; ++i) {
+        m[i * 7] = i;
+    }
+    for (int i = 0; i < numElements; i += 2) {
+        m.erase(i * 7);
+    }
+    for (int i = 0; i < numElements; i += 2) {
+        m.emplace(i * 7, i + 1);
+    }
+
+    Uint64 checksum = 0;
+    for (int i = 0; i < numElements; ++i) {
+        checksum += m.find(i * 7)->second;
+    }
+    return checksum;
+}
+
+Uint64 unorderedMapString(bslma::Allocator *allocator, int numElements)
+    // Insert the specified 'numElements' string keys, each too long for the
+    // short-string optimization, into an unordered map using the specified
+    // 'allocator', and return a checksum of the lookups of all keys.
+{
+    bsl::unordered_map<bsl::string, int> m(allocator);
+    bsl::string                          key(allocator);
+
+    for (int i = 0; i < numElements; ++i) {
+        key.assign("a key that is long enough to allocate: ");
+        key.append(1, static_cast<char>('a' + i % 26));
+        key.append(1, static_cast<char>('a' + i / 26 % 26));
+        key.append(1, static_cast<char>('a' + i / 676 % 26));
+        m[key] = i;
+    }
+
+    Uint64 checksum = m.size();
+    for (int i = 0; i < numElements; i += 3) {
+        key.assign("a key that is long enough to allocate: ");
+        key.append(1, static_cast<char>('a' + i % 26));
+        key.append(1, static_cast<char>('a' + i / 26 % 26));
+        key.append(1, static_cast<char>('a' + i / 676 % 26));
+        checksum += m.find(key)->second;
+    }
+    return checksum;
+}
+
+Uint64 stringAppend(bslma::Allocator *allocator, int numElements)
+    // Build a string of the specified 'numElements' characters by repeated
+    // appends, copying it every 64 characters, using the specified
+    // 'allocator', and return a checksum of the strings.
+{
+    bsl::string s(allocator);
+    Uint64      checksum = 0;
+
+    for (int i = 0; i < numElements; ++i) {
+        s.push_back(static_cast<char>('a' + i % 26));
+
+        if (63 == i % 64) {
+            bsl::string copy(s, allocator);
+            checksum += copy.size();
+        }
+    }
+    return checksum + s.size();
+}
+
+struct Workload {
+    // This 'struct' describes a workload.
+
+    const char *d_name;                                   // name
+    Uint64    (*d_function)(bslma::Allocator *, int);     // episode
+    int         d_numElements;                            // elements per
+                                                          // episode
+    int         d_numEpisodes;                            // episodes at scale
+                                                          // 1
+};
+
+const Workload WORKLOADS[] = {
+    { "vector_int",           &vectorInt,            1000, 20000 },
+    { "vector_string",        &vectorString,         1000,  2000 },
+    { "unordered_map_int",    &unorderedMapInt,      1000,  2000 },
+    { "unordered_map_string", &unorderedMapString,   1000,  1000 },
+    { "string_append",        &stringAppend,         4096,  5000 },
+};
+
+const int NUM_WORKLOADS = sizeof WORKLOADS / sizeof *WORKLOADS;
+
+// ============================================================================
+//                                STRATEGIES
+// ----------------------------------------------------------------------------
+
+enum Strategy {
+    e_NEWDELETE,
+    e_MULTIPOOL,
+    e_SEQUENTIAL,
+    e_BUFFERED_SEQUENTIAL,
+    e_LOCAL_SEQUENTIAL,
+    e_CONCURRENT_MULTIPOOL,
+    e_THREAD_CACHING_MULTIPOOL
+};
+
+const char *const STRATEGY_NAMES[] = {
+    "newdelete",
+    "multipool",
+    "sequential",
+    "bufferedsequential",
+    "localsequential",
+    "concurrentmultipool",
+    "threadcachingmultipool"
+};
+
+const int NUM_STRATEGIES = sizeof STRATEGY_NAMES / sizeof *STRATEGY_NAMES;
+
+Uint64 runEpisodes(Strategy          strategy,
+                   const Workload&   workload,
+                   int               numEpisodes,
+                   bslma::Allocator *globalAllocator)
+    // Run the specified 'numEpisodes' episodes of the specified 'workload'
+    // with the specified 'strategy', using the specified 'globalAllocator' if
+    // 'strategy' is global, and return the sum of their checksums.
+{
+    bslma::Allocator *upstream = &bslma::NewDeleteAllocator::singleton();
+
+    const int n = workload.d_numElements;
+    Uint64    checksum = 0;
+
+    switch (strategy) {
+      case e_MULTIPOOL: {
+        for (int i = 0; i < numEpisodes; ++i) {
+            bdlma::MultipoolAllocator allocator(upstream);
+            checksum += workload.d_function(&allocator, n);
+        }
+      } break;
+      case e_SEQUENTIAL: {
+        for (int i = 0; i < numEpisodes; ++i) {
+            bdlma::SequentialAllocator allocator(upstream);
+            checksum += workload.d_function(&allocator, n);
+        }
+      } break;
+      case e_BUFFERED_SEQUENTIAL: {
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+
+        for (int i = 0; i < numEpisodes; ++i) {
+            bdlma::BufferedSequentialAllocator allocator(buffer.buffer(),
+                                                         k_BUFFER_SIZE,
+                                                         upstream);
+            checksum += workload.d_function(&allocator, n);
+        }
+      } break;
+      case e_LOCAL_SEQUENTIAL: {
+        for (int i = 0; i < numEpisodes; ++i) {
+            bdlma::LocalSequentialAllocator<k_BUFFER_SIZE> allocator(upstream);
+            checksum += workload.d_function(&allocator, n);
+        }
+      } break;
+      case e_NEWDELETE:
+      case e_CONCURRENT_MULTIPOOL:
+      case e_THREAD_CACHING_MULTIPOOL: {
+        for (int i = 0; i < numEpisodes; ++i) {
+            checksum += workload.d_function(globalAllocator, n);
+        }
+      } break;
+    }
+    return checksum;
+}
+
+struct EpisodeRunner {
+    // This 'struct' provides a functor running episodes in a thread.
+
+    Strategy          d_strategy;
+    const Workload   *d_workload_p;
+    int               d_numEpisodes;
+    bslma::Allocator *d_globalAllocator_p;
+    bslmt::Barrier   *d_barrier_p;
+    Uint64           *d_checksum_p;
+
+    void operator()()
+        // Wait on 'd_barrier_p', then run the episodes, loading the sum of
+        // their checksums into '*d_checksum_p'.
+    {
+        d_barrier_p->wait();
+        *d_checksum_p = runEpisodes(d_strategy,
+                                    *d_workload_p,
+                                    d_numEpisodes,
+                                    d_globalAllocator_p);
+    }
+};
+
+// ============================================================================
+//                                 DRIVER
+// ----------------------------------------------------------------------------
+
+struct Result {
+    // This 'struct' holds the measurements of a (workload, strategy) pair.
+
+    Int64  d_totalNs;   // wall-clock time of all episodes
+    int    d_episodes;  // number of episodes, over all threads
+    Uint64 d_checksum;  // sum of the checksums of a single thread
+};
+
+Result measure(Strategy strategy, const Workload& workload, int numEpisodes,
+               int numThreads)
+    // Return the measurements of the specified 'numEpisodes' episodes of the
+    // specified 'workload' per thread, in each of the specified 'numThreads'
+    // threads, with the specified 'strategy'.
+{
+    bslma::Allocator *upstream = &bslma::NewDeleteAllocator::singleton();
+
+    bdlma::ConcurrentMultipoolAllocator    concurrentMultipool(upstream);
+    bdlma::ThreadCachingMultipoolAllocator threadCachingMultipool(upstream);
+
+    bslma::Allocator *globalAllocator = upstream;
+    if (e_CONCURRENT_MULTIPOOL == strategy) {
+        globalAllocator = &concurrentMultipool;
+    }
+    else if (e_THREAD_CACHING_MULTIPOOL == strategy) {
+        globalAllocator = &threadCachingMultipool;
+    }
+
+    // Warm up the global allocator and the code of the workload.
+
+    runEpisodes(strategy, workload, 1, globalAllocator);
+
+    Result result;
+    result.d_episodes = numEpisodes * numThreads;
+
+    if (1 == numThreads) {
+        const Int64 start = bsls::TimeUtil::getTimer();
+        result.d_checksum = runEpisodes(strategy,
+                                        workload,
+                                        numEpisodes,
+                                        globalAllocator);
+        result.d_totalNs  = bsls::TimeUtil::getTimer() - start;
+        return result;                                                // RETURN
+    }
+
+    bslmt::Barrier                         barrier(numThreads + 1);
+    bsl::vector<Uint64>                    checksums(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        EpisodeRunner runner = { strategy,
+                                 &workload,
+                                 numEpisodes,
+                                 globalAllocator,
+                                 &barrier,
+                                 &checksums[i] };
+
+        if (0 != bslmt::ThreadUtil::create(&handles[i], runner)) {
+            bsl::cerr << "Failed to create thread " << i << bsl::endl;
+            bsl::exit(1);
+        }
+    }
+
+    barrier.wait();
+    const Int64 start = bsls::TimeUtil::getTimer();
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    result.d_totalNs  = bsls::TimeUtil::getTimer() - start;
+    result.d_checksum = checksums[0];
+
+    return result;
+}
+
+void printUsage(const char *program)
+    // Print the usage of this program, named by the specified 'program', to
+    // the standard error.
+{
+    bsl::cerr <<
+        "usage: " << program << " [-a strategy]... [-w workload]... "
+                                "[-t threads] [-s scale] [-f csv|json]\n"
+        "  -a strategy  run only the given strategy (repeatable)\n"
+        "  -w workload  run only the given workload (repeatable)\n"
+        "  -t threads   number of threads running episodes (default 1)\n"
+        "  -s scale     multiply the number of episodes (default 1)\n"
+        "  -f format    output format, 'csv' (default) or 'json'\n"
+        "strategies:";
+    for (int i = 0; i < NUM_STRATEGIES; ++i) {
+        bsl::cerr << ' ' << STRATEGY_NAMES[i];
+    }
+    bsl::cerr << "\nworkloads:";
+    for (int i = 0; i < NUM_WORKLOADS; ++i) {
+        bsl::cerr << ' ' << WORKLOADS[i].d_name;
+    }
+    bsl::cerr << bsl::endl;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    bsl::vector<bool> strategies(NUM_STRATEGIES, false);
+    bsl::vector<bool> workloads(NUM_WORKLOADS, false);
+    bool              anyStrategy = false;
+    bool              anyWorkload = false;
+    int               numThreads  = 1;
+    double            scale       = 1.0;
+    bool              json        = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *option = argv[i];
+        const char *value  = i + 1 < argc ? argv[i + 1] : 0;
+
+        if (0 == bsl::strcmp(option, "-h") || !value) {
+            printUsage(argv[0]);
+            return 0 == bsl::strcmp(option, "-h") ? 0 : 1;            // RETURN
+        }
+        ++i;
+
+        if (0 == bsl::strcmp(option, "-a")) {
+            int s = 0;
+            while (s < NUM_STRATEGIES
+                && 0 != bsl::strcmp(value, STRATEGY_NAMES[s])) {
+                ++s;
+            }
+            if (NUM_STRATEGIES == s) {
+                bsl::cerr << "Unknown strategy: " << value << bsl::endl;
+                return 1;                                             // RETURN
+            }
+            strategies[s] = anyStrategy = true;
+        }
+        else if (0 == bsl::strcmp(option, "-w")) {
+            int w = 0;
+            while (w < NUM_WORKLOADS
+                && 0 != bsl::strcmp(value, WORKLOADS[w].d_name)) {
+                ++w;
+            }
+            if (NUM_WORKLOADS == w) {
+                bsl::cerr << "Unknown workload: " << value << bsl::endl;
+                return 1;                                             // RETURN
+            }
+            workloads[w] = anyWorkload = true;
+        }
+        else if (0 == bsl::strcmp(option, "-t")) {
+            numThreads = bsl::atoi(value);
+        }
+        else if (0 == bsl::strcmp(option, "-s")) {
+            scale = bsl::atof(value);
+        }
+        else if (0 == bsl::strcmp(option, "-f")
+              && (0 == bsl::strcmp(value, "csv")
+               || 0 == bsl::strcmp(value, "json"))) {
+            json = 0 == bsl::strcmp(value, "json");
+        }
+        else {
+            printUsage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    if (numThreads < 1 || scale <= 0) {
+        printUsage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    bsls::TimeUtil::initialize();
+
+    if (json) {
+        bsl::cout << "[";
+    }
+    else {
+        bsl::cout << "workload,allocator,threads,elements,episodes,total_ns,"
+                     "ns_per_episode,checksum\n";
+    }
+
+    bool first = true;
+    for (int w = 0; w < NUM_WORKLOADS; ++w) {
+        if (anyWorkload && !workloads[w]) {
+            continue;                                               // CONTINUE
+        }
+
+        const Workload& workload    = WORKLOADS[w];
+        int             numEpisodes = static_cast<int>(
+                                               workload.d_numEpisodes * scale);
+        if (numEpisodes < 1) {
+            numEpisodes = 1;
+        }
+
+        for (int s = 0; s < NUM_STRATEGIES; ++s) {
+            if (anyStrategy && !strategies[s]) {
+                continue;                                           // CONTINUE
+            }
+
+            const Result result = measure(static_cast<Strategy>(s),
+                                          workload,
+                                          numEpisodes,
+                                          numThreads);
+
+            const Int64 nsPerEpisode = result.d_totalNs * numThreads
+                                                          / result.d_episodes;
+
+            if (json) {
+                bsl::cout << (first ? "\n" : ",\n")
+                          << "  {\"workload\": \"" << workload.d_name
+                          << "\", \"allocator\": \"" << STRATEGY_NAMES[s]
+                          << "\", \"threads\": " << numThreads
+                          << ", \"elements\": " << workload.d_numElements
+                          << ", \"episodes\": " << result.d_episodes
+                          << ", \"total_ns\": " << result.d_totalNs
+                          << ", \"ns_per_episode\": " << nsPerEpisode
+                          << ", \"checksum\": " << result.d_checksum << "}";
+            }
+            else {
+                bsl::cout << workload.d_name << ','
+                          << STRATEGY_NAMES[s] << ','
+                          << numThreads << ','
+                          << workload.d_numElements << ','
+                          << result.d_episodes << ','
+                          << result.d_totalNs << ','
+                          << nsPerEpisode << ','
+                          << result.d_checksum << '\n';
+            }
+            bsl::cout.flush();
+            first = false;
+        }
+    }
+
+    if (json) {
+        bsl::cout << "\n]\n";
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -15,11 +15,13 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
-// function:
+// from a specified stream or buffer.  There are four overloaded versions of
+// this function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous buffer, supplied as a 'bsl::string_view'
+//: o one that reads from a 'bdlbb::Blob'
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -55,6 +57,21 @@ BSLS_IDENT("$Id: $")
 // non-UTF-8 with no adverse effects to their clients.  Consequently, this
 // option is 'false' by default to maintain backward compatibility.
 //
+///Decoding Contiguous Input
+///-------------------------
+// When the JSON data is already in memory, the 'decode' overloads taking a
+// 'bsl::string_view' or a 'bdlbb::Blob' are faster than wrapping the data in a
+// 'streambuf'.  The data is not copied (unless a 'bdlbb::Blob' has more than
+// one data buffer, in which case it is first copied into a contiguous buffer):
+// the tokenizer locates every token using a 'bdljsn::StructuralIndex', built
+// with vector instructions in a single pass over the data, and string values
+// are read directly from the data.
+//
+// Decoding contiguous input is otherwise identical to decoding a 'streambuf'
+// supplying the same data: the same 'DecoderOptions' are honored, the same
+// values are produced, and the same errors are detected and logged, at the
+// same positions.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -159,6 +176,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_printmethods.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
 #include <bdlma_localsequentialallocator.h>
 
 #include <bslmf_assert.h>
@@ -233,6 +253,14 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int decodeDocument(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON document read by the tokenizer owned by this object, using
+        // the specified 'options'.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless the tokenizer has been
+        // reset to the input to decode.
+
     bsl::ostream& logTokenizerError(const char *alternateString);
         // Log the latest tokenizer error to 'd_logStream'.  If the tokenizer
         // did not have an error, log the specified 'alternateString'.  Return
@@ -294,6 +322,31 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const bsl::string_view&  input,
+               TYPE                    *value,
+               const DecoderOptions&    options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified contiguous 'input' using the
+        // specified 'options'.  'TYPE' shall be a 'bdeat'-compatible
+        // sequence, choice, or array type, or a 'bdeat'-compatible dynamic
+        // type referring to one of those types.  Return 0 on success, and a
+        // non-zero value otherwise.  Note that the result, including the
+        // logged messages, is the same as that of decoding a 'streambuf'
+        // supplying 'input', but that 'input' is tokenized in place.
+
+    template <class TYPE>
+    int decode(const bdlbb::Blob&     input,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'input' blob using the specified
+        // 'options'.  'TYPE' shall be a 'bdeat'-compatible sequence, choice,
+        // or array type, or a 'bdeat'-compatible dynamic type referring to one
+        // of those types.  Return 0 on success, and a non-zero value
+        // otherwise.  Note that, unless 'input' has at most one data buffer,
+        // its data is first copied into a contiguous buffer.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -890,27 +943,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeDocument(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -925,7 +960,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
     d_tokenizer.setAllowNonUtf8StringLiterals(!options.validateInputIsUtf8());
@@ -944,7 +978,33 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     d_maxDepth            = options.maxDepth();
     d_skipUnknownElements = options.skipUnknownElements();
 
-    rc = decodeImp(value, 0, TypeCategory());
+    return decodeImp(value, 0, TypeCategory());
+}
+
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    const int rc = decodeDocument(value, options);
 
     d_tokenizer.resetStreamBufGetPointer();
 
@@ -992,6 +1052,41 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bsl::string_view&  input,
+                    TYPE                    *value,
+                    const DecoderOptions&    options)
+{
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(input);
+
+    return decodeDocument(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bdlbb::Blob&     input,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(value);
+
+    if (1 >= input.numDataBuffers()) {
+        const bsl::string_view data =
+                        0 == input.numDataBuffers()
+                        ? bsl::string_view()
+                        : bsl::string_view(input.buffer(0).data(),
+                                           input.length());
+        return decode(data, value, options);                          // RETURN
+    }
+
+    bsl::string data(d_elementName.get_allocator());
+    data.resize(input.length());
+    bdlbb::BlobUtil::copy(&data[0], input, 0, input.length());
+
+    return decode(bsl::string_view(data), value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
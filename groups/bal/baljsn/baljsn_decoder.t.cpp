@@ -33,6 +33,10 @@
 #include <bdlb_print.h>
 #include <bdlb_printmethods.h>  // for printing vector
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlde_utf8util.h>
 
 #include <bdlsb_fixedmeminstreambuf.h>
@@ -70,6 +74,7 @@
 #include <bsla_maybeunused.h>
 
 #include <bsls_libraryfeatures.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -111,6 +116,8 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [14] int decode(const bsl::string_view& input, TYPE *v, options);
+// [14] int decode(const bdlbb::Blob& input, TYPE *v, options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
@@ -127,7 +134,9 @@ namespace test = BloombergLP::s_baltst;
 // [11] FLOATING-POINT VALUES ROUND-TRIP
 // [12] REPRODUCE SCENARIO FROM DRQS 169438741
 // [13] FALLBACK ENUMERATORS
-// [14] USAGE EXAMPLE
+// [14] DECODING CONTIGUOUS INPUT
+// [15] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONTIGUOUS INPUT VS. 'streambuf'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -36881,7 +36890,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -36987,6 +36996,187 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // DECODING CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Decoding a 'bsl::string_view' or a 'bdlbb::Blob' produces the
+        //:   same value as decoding a 'streambuf' supplying the same data.
+        //:
+        //: 2 Decoding malformed contiguous input fails with the same return
+        //:   code, the same logged messages, and the same partially decoded
+        //:   value, as decoding a 'streambuf' supplying the same data.
+        //:
+        //: 3 The 'validateInputIsUtf8' option is honored.
+        //:
+        //: 4 A 'bdlbb::Blob' having zero, one, or several data buffers can
+        //:   be decoded.
+        //
+        // Plan:
+        //: 1 For each JSON text in 'JSON_PRETTY_MESSAGES' and
+        //:   'JSON_COMPACT_MESSAGES', and for both values of
+        //:   'validateInputIsUtf8', decode the text from a
+        //:   'bdlsb::FixedMemInStreamBuf', from a 'bsl::string_view', and
+        //:   from blobs having one data buffer and data buffers of 7 bytes,
+        //:   and verify that all results equal the expected value.  (C-1, 4)
+        //:
+        //: 2 For each text in 'JSON_COMPACT_MESSAGES', create malformed texts
+        //:   by truncating the text and by overwriting one of its characters
+        //:   with a structural character, a vertical tab, or an invalid
+        //:   UTF-8 octet.  Decode each malformed text from a 'streambuf' and
+        //:   from a 'bsl::string_view', and verify that the return codes,
+        //:   logged messages, and values are the same.  (C-2..3)
+        //:
+        //: 3 Decode an empty blob.  (C-4)
+        //
+        // Testing:
+        //   int decode(const bsl::string_view& input, TYPE *v, options);
+        //   int decode(const bdlbb::Blob& input, TYPE *v, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODING CONTIGUOUS INPUT"
+                          << "\n=========================" << endl;
+
+#ifndef U_SKIP_DUE_TO_COMPILER_RESOURCE_LIMITATIONS
+        bsl::vector<balb::FeatureTestMessage> testObjects;
+        constructFeatureTestMessage(&testObjects);
+
+        bdlbb::SimpleBlobBufferFactory smallBufferFactory(7);
+        bdlbb::SimpleBlobBufferFactory largeBufferFactory(1 << 20);
+
+        if (verbose) cout << "\tDecoding well-formed input." << endl;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const bool CHECK_UTF8 = mode;
+            const int  NUM_TEXTS  = NUM_JSON_PRETTY_MESSAGES +
+                                    NUM_JSON_COMPACT_MESSAGES;
+
+            baljsn::DecoderOptions options;
+            options.setValidateInputIsUtf8(CHECK_UTF8);
+
+            for (int ti = 0; ti < NUM_TEXTS; ++ti) {
+                const bool IS_PRETTY = ti < NUM_JSON_PRETTY_MESSAGES;
+                const int  INDEX     = IS_PRETTY
+                                     ? ti
+                                     : ti - NUM_JSON_PRETTY_MESSAGES;
+                const int  LINE      = IS_PRETTY
+                                     ? JSON_PRETTY_MESSAGES[INDEX].d_line
+                                     : JSON_COMPACT_MESSAGES[INDEX].d_line;
+
+                const bsl::string_view TEXT =
+                                  IS_PRETTY
+                                  ? JSON_PRETTY_MESSAGES[INDEX].d_input_p
+                                  : JSON_COMPACT_MESSAGES[INDEX].d_input_p;
+
+                const balb::FeatureTestMessage& EXP = testObjects[INDEX];
+
+                if (veryVerbose) { P_(CHECK_UTF8); P_(LINE); P(TEXT); }
+
+                Obj decoder;
+
+                balb::FeatureTestMessage value;
+                int rc = decoder.decode(TEXT, &value, options);
+                ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                ASSERTV(LINE, EXP, value, EXP == value);
+
+                bdlbb::Blob singleBufferBlob(&largeBufferFactory);
+                bdlbb::BlobUtil::append(&singleBufferBlob,
+                                        TEXT.data(),
+                                        static_cast<int>(TEXT.length()));
+                ASSERTV(LINE, 1 == singleBufferBlob.numDataBuffers());
+
+                value.reset();
+                rc = decoder.decode(singleBufferBlob, &value, options);
+                ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                ASSERTV(LINE, EXP, value, EXP == value);
+
+                bdlbb::Blob smallBufferBlob(&smallBufferFactory);
+                bdlbb::BlobUtil::append(&smallBufferBlob,
+                                        TEXT.data(),
+                                        static_cast<int>(TEXT.length()));
+                ASSERTV(LINE, 1 < smallBufferBlob.numDataBuffers());
+
+                value.reset();
+                rc = decoder.decode(smallBufferBlob, &value, options);
+                ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                ASSERTV(LINE, EXP, value, EXP == value);
+            }
+        }
+
+        if (verbose) cout << "\tDecoding malformed input." << endl;
+
+        static const char OVERWRITES[] = { '}', ']', '"', ',', '\v', '\xff' };
+        const int NUM_OVERWRITES = static_cast<int>(sizeof OVERWRITES);
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const bool CHECK_UTF8 = mode;
+
+            baljsn::DecoderOptions options;
+            options.setValidateInputIsUtf8(CHECK_UTF8);
+
+            for (int ti = 0; ti < NUM_JSON_COMPACT_MESSAGES; ++ti) {
+                const int         LINE = JSON_COMPACT_MESSAGES[ti].d_line;
+                const bsl::string TEXT = JSON_COMPACT_MESSAGES[ti].d_input_p;
+                const bsl::size_t LEN  = TEXT.length();
+
+                for (int vi = 0; vi < 16; ++vi) {
+                    bsl::string text(TEXT);
+                    if (vi < 8) {
+                        text.resize(LEN * vi / 8);
+                    }
+                    else {
+                        text[(LEN - 1) * (vi - 8) / 8] =
+                                   OVERWRITES[(ti + vi) % NUM_OVERWRITES];
+                    }
+
+                    Obj                        streamDecoder;
+                    balb::FeatureTestMessage   streamValue;
+                    bdlsb::FixedMemInStreamBuf isb(text.data(),
+                                                   text.length());
+
+                    const int streamRc = streamDecoder.decode(&isb,
+                                                              &streamValue,
+                                                              options);
+
+                    Obj                      inputDecoder;
+                    balb::FeatureTestMessage inputValue;
+
+                    const int inputRc = inputDecoder.decode(
+                                                      bsl::string_view(text),
+                                                      &inputValue,
+                                                      options);
+
+                    ASSERTV(LINE, vi, text, streamRc, inputRc,
+                            streamRc == inputRc);
+                    ASSERTV(LINE, vi, text,
+                            streamDecoder.loggedMessages(),
+                            inputDecoder.loggedMessages(),
+                            streamDecoder.loggedMessages() ==
+                                                inputDecoder.loggedMessages());
+                    ASSERTV(LINE, vi, text, streamValue == inputValue);
+                }
+            }
+        }
+#endif
+
+        if (verbose) cout << "\tDecoding an empty blob." << endl;
+        {
+            bdlbb::Blob            blob;
+            baljsn::DecoderOptions options;
+            test::Employee         employee;
+
+            Obj decoder;
+            ASSERT(0 != decoder.decode(blob, &employee, options));
+
+            const bsl::string EXPECTED =
+                     "Error: unexpected end of file at offset 0 advancing to "
+                     "the first token. Expecting a '{' or '[' as the first "
+                     "character\n";
+            ASSERTV(decoder.loggedMessages(),
+                    EXPECTED == decoder.loggedMessages());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // FALLBACK ENUMERATORS
@@ -40988,6 +41178,121 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONTIGUOUS INPUT VS. 'streambuf'
+        //
+        // Concerns:
+        //: 1 Decoding a 'bsl::string_view' is faster than decoding a
+        //:   'bdlsb::FixedMemInStreamBuf' supplying the same data.
+        //
+        // Plan:
+        //: 1 Decode every text in 'JSON_COMPACT_MESSAGES' and
+        //:   'JSON_PRETTY_MESSAGES' into a 'balb::FeatureTestMessage', a
+        //:   schema exercising every 'bdlat' category, a number of times
+        //:   (optionally specified on the command line) from a 'streambuf',
+        //:   from a 'bsl::string_view', and from a 'bdlbb::Blob' having
+        //:   4KB data buffers, with and without UTF-8 validation, and report
+        //:   the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: CONTIGUOUS INPUT VS. 'streambuf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: CONTIGUOUS INPUT VS. 'streambuf'"
+                          << "\n============================================="
+                          << endl;
+
+#ifndef U_SKIP_DUE_TO_COMPILER_RESOURCE_LIMITATIONS
+        // The number of iterations may be specified in place of the
+        // 'verbose' flag.
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < atoi(argv[2])
+                                 ? atoi(argv[2])
+                                 : 200;
+
+        bdlbb::SimpleBlobBufferFactory factory(4096);
+
+        for (int style = 0; style < 2; ++style) {
+            const bool IS_PRETTY = style;
+
+            bsl::vector<bsl::string_view> texts;
+            bsl::vector<bdlbb::Blob>      blobs;
+            bsl::size_t                   numBytes = 0;
+
+            const int NUM_TEXTS = IS_PRETTY ? NUM_JSON_PRETTY_MESSAGES
+                                            : NUM_JSON_COMPACT_MESSAGES;
+
+            for (int ti = 0; ti < NUM_TEXTS; ++ti) {
+                const bsl::string_view TEXT =
+                                     IS_PRETTY
+                                     ? JSON_PRETTY_MESSAGES[ti].d_input_p
+                                     : JSON_COMPACT_MESSAGES[ti].d_input_p;
+                texts.push_back(TEXT);
+                numBytes += TEXT.length();
+
+                bdlbb::Blob blob(&factory);
+                bdlbb::BlobUtil::append(&blob,
+                                        TEXT.data(),
+                                        static_cast<int>(TEXT.length()));
+                blobs.push_back(blob);
+            }
+
+            for (int mode = 0; mode < 2; ++mode) {
+                const bool CHECK_UTF8 = mode;
+
+                baljsn::DecoderOptions options;
+                options.setValidateInputIsUtf8(CHECK_UTF8);
+
+                Obj                      decoder;
+                balb::FeatureTestMessage value;
+
+                double times[3];
+
+                for (int input = 0; input < 3; ++input) {
+                    bsls::Stopwatch timer;
+                    timer.start();
+
+                    for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                        for (int ti = 0; ti < NUM_TEXTS; ++ti) {
+                            int rc;
+                            if (0 == input) {
+                                bdlsb::FixedMemInStreamBuf isb(
+                                                       texts[ti].data(),
+                                                       texts[ti].length());
+                                rc = decoder.decode(&isb, &value, options);
+                            }
+                            else if (1 == input) {
+                                rc = decoder.decode(texts[ti],
+                                                    &value,
+                                                    options);
+                            }
+                            else {
+                                rc = decoder.decode(blobs[ti],
+                                                    &value,
+                                                    options);
+                            }
+                            ASSERTV(ti, rc, 0 == rc);
+                        }
+                    }
+
+                    timer.stop();
+                    times[input] = timer.elapsedTime();
+                }
+
+                const double megabytes = static_cast<double>(numBytes) *
+                                         NUM_ITERATIONS / (1024.0 * 1024.0);
+
+                cout << (IS_PRETTY  ? "pretty,  " : "compact, ")
+                     << (CHECK_UTF8 ? "UTF-8:    " : "no UTF-8: ")
+                     << "streambuf " << megabytes / times[0] << " MB/s, "
+                     << "string_view " << megabytes / times[1] << " MB/s, "
+                     << "blob " << megabytes / times[2] << " MB/s"
+                     << endl;
+            }
+        }
+#endif
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
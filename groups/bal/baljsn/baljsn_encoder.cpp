@@ -19,30 +19,18 @@ int Encoder_EncodeImplUtil::encodeCharArray(
                                       const bsl::vector<char>& value,
                                       const EncoderOptions&    encoderOptions)
 {
+    const bdlde::Base64EncoderOptions options =
+                                       bdlde::Base64EncoderOptions::standard();
+
     bsl::string base64String;
-    bdlde::Base64Encoder encoder(0);
     base64String.resize(
-       bdlde::Base64Encoder::encodedLength(static_cast<int>(value.size()), 0));
-
-    // Ensure length is a multiple of 4.
-
-    BSLS_ASSERT(0 == (base64String.length() & 0x03));
-
-    int numOut;
-    int numIn;
-    int rc = encoder.convert(base64String.begin(),
-                             &numOut,
-                             &numIn,
-                             value.begin(),
-                             value.end());
+                bdlde::Base64Encoder::encodedLength(options, value.size()));
 
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
-
-    rc = encoder.endConvert(base64String.begin() + numOut);
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    if (!value.empty()) {
+        bdlde::Base64Encoder::encode(&base64String[0],
+                                     value.data(),
+                                     value.size(),
+                                     options);
     }
 
     return encodeSimpleValue(formatter,
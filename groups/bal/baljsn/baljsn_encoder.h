@@ -15,11 +15,13 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Encoder', for
 // encoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'encode' function that encodes an object
-// into a specified stream.  There are two overloaded versions of this
+// into a specified stream.  There are four overloaded versions of this
 // function:
 //
 //: o one that writes to a 'bsl::streambuf'
 //: o one that writes to an 'bsl::ostream'
+//: o one that appends to a 'bsl::string'
+//: o one that appends to a 'bdlbb::Blob'
 //
 // This component can be used with types that support the 'bdlat' framework
 // (see the 'bdlat' package for details), which is a compile-time interface for
@@ -38,6 +40,19 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this encoder
 // in the package documentation file (doc/baljsn.txt).
 //
+///Encoding Performance
+///--------------------
+// The encoder writes every token directly to the stream buffer of the output,
+// writes the name of each attribute from a cache of quoted names that is
+// filled the first time each attribute name is encoded, and converts integers
+// with 'bslalg::NumericFormatterUtil' (see {'baljsn_formatter'}), so that the
+// cost of each token is dominated by the cost of copying its text to the
+// stream buffer.  The 'encode' overloads taking a 'bsl::string' or a
+// 'bdlbb::Blob' supply a stream buffer that writes to contiguous memory
+// (growing it geometrically, or acquiring blob buffers, as needed), which is
+// the fastest output available.  The text produced is the same regardless of
+// the type of the output.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -149,6 +164,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_print.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsla_maybeunused.h>
@@ -235,6 +253,29 @@ class Encoder {
         // 'bdlat'-compatible dynamic type referring to one of those types.
         // Return 0 on success, and a non-zero value otherwise.
 
+    template <class TYPE>
+    int encode(bsl::string           *output,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+        // Encode the specified 'value', of (template parameter) 'TYPE', in the
+        // JSON format using the specified 'options' and append it to the
+        // specified 'output'.  'TYPE' shall be a 'bdlat'-compatible sequence,
+        // choice, or array type, or a 'bdlat'-compatible dynamic type
+        // referring to one of those types.  Return 0 on success, and a
+        // non-zero value, with no effect on 'output', otherwise.
+
+    template <class TYPE>
+    int encode(bdlbb::Blob           *blob,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+        // Encode the specified 'value', of (template parameter) 'TYPE', in the
+        // JSON format using the specified 'options' and append it to the
+        // specified 'blob'.  'TYPE' shall be a 'bdlat'-compatible sequence,
+        // choice, or array type, or a 'bdlat'-compatible dynamic type
+        // referring to one of those types.  Return 0 on success, and a
+        // non-zero value, with no effect on the length of 'blob', otherwise.
+        // The behavior is undefined unless 'blob' has a blob buffer factory.
+
     template <class TYPE>
     int encode(bsl::streambuf *streamBuf, const TYPE& value);
         // Encode the specified 'value' of (template parameter) 'TYPE' into the
@@ -1330,6 +1371,47 @@ int Encoder::encode(bsl::ostream&         stream,
     return encode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Encoder::encode(bsl::string           *output,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(output);
+
+    bdlsb::MemOutStreamBuf streamBuf(output->get_allocator().mechanism());
+
+    const int rc = encode(&streamBuf, value, options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    output->append(streamBuf.data(), streamBuf.length());
+    return 0;
+}
+
+template <class TYPE>
+int Encoder::encode(bdlbb::Blob           *blob,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(blob->factory());
+
+    const int length = blob->length();
+
+    int rc;
+    {
+        bdlbb::OutBlobStreamBuf streamBuf(blob);
+
+        rc = encode(&streamBuf, value, options);
+    }
+
+    if (0 != rc) {
+        blob->setLength(length);
+    }
+    return rc;
+}
+
 // ACCESSORS
 inline
 bsl::string Encoder::loggedMessages() const
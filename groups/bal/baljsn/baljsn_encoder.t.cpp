@@ -19,6 +19,10 @@
 
 #include <bdlde_utf8util.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
@@ -53,6 +57,10 @@
 
 #include <bslmf_assert.h>
 
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -120,6 +128,8 @@ using bsl::endl;
 // [13] int encode(bsl::ostream& stream, const TYPE& v, options);
 // [13] int encode(bsl::streambuf *streamBuf, const TYPE& v, &options);
 // [13] int encode(bsl::ostream& stream, const TYPE& v, &options);
+// [23] int encode(bsl::string *output, const TYPE& v, options);
+// [23] int encode(bdlbb::Blob *blob, const TYPE& v, options);
 //
 // ACCESSORS
 // [13] bsl::string loggedMessages() const;
@@ -128,7 +138,8 @@ using bsl::endl;
 // [20] ENCODING UNSET CHOICE
 // [21] ENCODING NULL CHOICE
 // [22] ENCODING VECTORS OF VECTORS
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -182,6 +193,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1162,7 +1180,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1279,6 +1297,169 @@ int main(int argc, char *argv[])
     ASSERT(EXP_OUTPUT == os.str());
 //..
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING ENCODING TO CONTIGUOUS OUTPUT
+        //
+        // Concerns:
+        //: 1 The 'encode' overloads taking a 'bsl::string' or a 'bdlbb::Blob'
+        //:   append to the output exactly the text written by the 'encode'
+        //:   overload taking a 'bsl::streambuf', in both styles.
+        //:
+        //: 2 The text may span several blob buffers.
+        //:
+        //: 3 The string overload uses the allocator of the string, and not
+        //:   the default allocator, to supply memory for the output.
+        //:
+        //: 4 If encoding fails, the string and the length of the blob are
+        //:   unchanged, and the error is logged.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each 's_baltst::FeatureTestMessage' test object, in both
+        //:   styles, encode the object to a 'bdlsb::MemOutStreamBuf', to a
+        //:   non-empty string, and to non-empty blobs whose buffer factories
+        //:   supply buffers of several sizes, and verify that the text
+        //:   appended is that written to the stream buffer.  Use a test
+        //:   allocator for the string and verify that it supplies memory.
+        //:   (C-1..3)
+        //:
+        //: 2 Encode an object that cannot be encoded to a non-empty string
+        //:   and a non-empty blob, and verify that both are unchanged.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null output and a blob having no buffer factory
+        //:   (using the 'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   int encode(bsl::string *output, const TYPE& v, options);
+        //   int encode(bdlbb::Blob *blob, const TYPE& v, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ENCODING TO CONTIGUOUS OUTPUT" << endl
+                          << "=====================================" << endl;
+
+        typedef s_baltst::FeatureTestMessageUtil MessageUtil;
+
+        bsl::vector<s_baltst::FeatureTestMessage> testObjects;
+        u::constructFeatureTestMessage(&testObjects);
+
+        const int BUFFER_SIZES[] = { 1, 7, 64, 4096 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                   / sizeof *BUFFER_SIZES;
+
+        const bsl::string PREFIX("prefix");
+
+        for (int i = 0; i < MessageUtil::k_NUM_MESSAGES; ++i) {
+            for (int style = 0; style < 2; ++style) {
+                baljsn::Encoder        encoder;
+                baljsn::EncoderOptions options;
+
+                if (style) {
+                    options.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+                    options.setInitialIndentLevel(1);
+                    options.setSpacesPerLevel(2);
+                }
+
+                bdlsb::MemOutStreamBuf osb;
+                ASSERTV(i, style,
+                        0 == encoder.encode(&osb, testObjects[i], options));
+
+                const bsl::string EXP = PREFIX
+                                      + bsl::string(osb.data(), osb.length());
+
+                {
+                    bslma::TestAllocator sa("string", veryVeryVerbose);
+
+                    bsl::string output(PREFIX, &sa);
+
+                    ASSERTV(i, style,
+                            0 == encoder.encode(&output,
+                                                testObjects[i],
+                                                options));
+                    ASSERTV(i, style, output, EXP, EXP == output);
+                    ASSERTV(i, style, encoder.loggedMessages().empty());
+                    ASSERTV(i, style, 0 < sa.numBlocksTotal());
+                }
+
+                for (int j = 0; j < NUM_BUFFER_SIZES; ++j) {
+                    const int BUFFER_SIZE = BUFFER_SIZES[j];
+
+                    bdlbb::PooledBlobBufferFactory factory(BUFFER_SIZE);
+                    bdlbb::Blob                    blob(&factory);
+
+                    bdlbb::BlobUtil::append(&blob,
+                                            PREFIX.data(),
+                                            static_cast<int>(PREFIX.size()));
+
+                    ASSERTV(i, style, BUFFER_SIZE,
+                            0 == encoder.encode(&blob,
+                                                testObjects[i],
+                                                options));
+
+                    bsl::string output(blob.length(), '\0');
+                    bdlbb::BlobUtil::copy(&output[0], blob, 0, blob.length());
+
+                    ASSERTV(i, style, BUFFER_SIZE, output, EXP,
+                            EXP == output);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting encoding failures." << endl;
+        {
+            s_baltst::MySequenceWithChoice obj;
+
+            baljsn::Encoder        encoder;
+            baljsn::EncoderOptions options;
+
+            bsl::string output(PREFIX);
+
+            ASSERT(0 != encoder.encode(&output, obj, options));
+            ASSERTV(output, PREFIX == output);
+            ASSERT(!encoder.loggedMessages().empty());
+
+            bdlbb::PooledBlobBufferFactory factory(4);
+            bdlbb::Blob                    blob(&factory);
+
+            bdlbb::BlobUtil::append(&blob,
+                                    PREFIX.data(),
+                                    static_cast<int>(PREFIX.size()));
+
+            ASSERT(0 != encoder.encode(&blob, obj, options));
+            ASSERTV(blob.length(),
+                    static_cast<int>(PREFIX.size()) == blob.length());
+            ASSERT(!encoder.loggedMessages().empty());
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            baljsn::Encoder        encoder;
+            baljsn::EncoderOptions options;
+
+            bsl::string                    output;
+            bdlbb::PooledBlobBufferFactory factory(4);
+            bdlbb::Blob                    blob(&factory);
+            bdlbb::Blob                    blobWithoutFactory;
+
+            ASSERT_PASS(encoder.encode(&output, testObjects[0], options));
+            ASSERT_FAIL(encoder.encode(static_cast<bsl::string *>(0),
+                                       testObjects[0],
+                                       options));
+
+            ASSERT_PASS(encoder.encode(&blob, testObjects[0], options));
+            ASSERT_FAIL(encoder.encode(static_cast<bdlbb::Blob *>(0),
+                                       testObjects[0],
+                                       options));
+            ASSERT_FAIL(encoder.encode(&blobWithoutFactory,
+                                       testObjects[0],
+                                       options));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING ENCODING VECTORS OF VECTORS
@@ -4830,6 +5011,102 @@ int main(int argc, char *argv[])
 
         ASSERTV(ss.str(), "{\"simpleValue\":1}" == ss.str());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of the encoder for each kind of output.
+        //
+        // Plan:
+        //: 1 Encode the 's_baltst::FeatureTestMessage' test objects, in both
+        //:   styles, a number of times (200 by default, or as specified by
+        //:   the second command line argument) to a 'bsl::ostringstream', a
+        //:   'bdlsb::MemOutStreamBuf', a 'bsl::string', and a 'bdlbb::Blob',
+        //:   and report the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl << "PERFORMANCE TEST" << endl
+                     << "================" << endl;
+
+        const int numIterations = argc > 2 && 0 < atoi(argv[2])
+                                ? atoi(argv[2])
+                                : 200;
+
+        bsl::vector<s_baltst::FeatureTestMessage> testObjects;
+        u::constructFeatureTestMessage(&testObjects);
+
+        for (int style = 0; style < 2; ++style) {
+            baljsn::Encoder        encoder;
+            baljsn::EncoderOptions options;
+
+            if (style) {
+                options.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+                options.setSpacesPerLevel(2);
+            }
+
+            const char *OUTPUTS[] = {
+                "bsl::ostringstream",
+                "bdlsb::MemOutStreamBuf",
+                "bsl::string",
+                "bdlbb::Blob"
+            };
+            const int NUM_OUTPUTS = sizeof OUTPUTS / sizeof *OUTPUTS;
+
+            for (int k = 0; k < NUM_OUTPUTS; ++k) {
+                bdlbb::PooledBlobBufferFactory factory(4096);
+                bsls::Types::Int64             numBytes = 0;
+                bsls::Stopwatch                timer;
+
+                timer.start();
+                for (int n = 0; n < numIterations; ++n) {
+                    for (bsl::size_t i = 0; i < testObjects.size(); ++i) {
+                        int rc = 0;
+
+                        switch (k) {
+                          case 0: {
+                            bsl::ostringstream oss;
+                            rc = encoder.encode(oss, testObjects[i], options);
+                            numBytes += oss.str().size();
+                          } break;
+                          case 1: {
+                            bdlsb::MemOutStreamBuf osb;
+                            rc = encoder.encode(&osb,
+                                                testObjects[i],
+                                                options);
+                            numBytes += osb.length();
+                          } break;
+                          case 2: {
+                            bsl::string output;
+                            rc = encoder.encode(&output,
+                                                testObjects[i],
+                                                options);
+                            numBytes += output.size();
+                          } break;
+                          default: {
+                            bdlbb::Blob blob(&factory);
+                            rc = encoder.encode(&blob,
+                                                testObjects[i],
+                                                options);
+                            numBytes += blob.length();
+                          } break;
+                        }
+                        ASSERTV(i, rc, 0 == rc);
+                    }
+                }
+                timer.stop();
+
+                const double seconds = timer.elapsedTime();
+
+                cout << (style ? "pretty  " : "compact ") << OUTPUTS[k]
+                     << ": " << static_cast<double>(numBytes) / seconds / 1e6
+                     << " MB/s" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -7,6 +7,9 @@ BSLS_IDENT_RCSID(baljsn_formatter_cpp,"$Id$ $CSID$")
 #include <baljsn_encoderoptions.h>
 #include <baljsn_printutil.h>
 
+#include <bsl_cstring.h>
+#include <bsl_locale.h>
+
 namespace BloombergLP {
 namespace baljsn {
 
@@ -14,6 +17,35 @@ namespace baljsn {
                           // class Formatter
                           // ---------------
 
+// PRIVATE MANIPULATORS
+void Formatter::indent()
+{
+    static const char k_SPACES[]   = "                                ";
+    const int         k_NUM_SPACES = sizeof k_SPACES - 1;
+
+    const int spacesPerLevel = d_spacesPerLevel < 0 ? -d_spacesPerLevel
+                                                    : d_spacesPerLevel;
+
+    int numSpaces = d_indentLevel * spacesPerLevel;
+
+    while (k_NUM_SPACES < numSpaces) {
+        write(k_SPACES, k_NUM_SPACES);
+        numSpaces -= k_NUM_SPACES;
+    }
+
+    if (0 < numSpaces) {
+        write(k_SPACES, numSpaces);
+    }
+}
+
+bool Formatter::writeMemberName(const CachedMemberName& entry)
+{
+    const bsl::size_t separatorLength = d_usePrettyStyle ? 3 : 1;
+    const bsl::size_t textLength      = entry.d_textLength;
+
+    return write(entry.d_text, textLength) >= textLength - separatorLength;
+}
+
 // CREATORS
 Formatter::Formatter(bsl::ostream&     stream,
                      bool              usePrettyStyle,
@@ -22,6 +54,7 @@ Formatter::Formatter(bsl::ostream&     stream,
                      bslma::Allocator *basicAllocator)
 : d_outputStream(stream)
 , d_usePrettyStyle(usePrettyStyle)
+, d_useNumericFormatter(false)
 , d_indentLevel(initialIndentLevel)
 , d_spacesPerLevel(spacesPerLevel)
 , d_callSequence(basicAllocator)
@@ -30,6 +63,23 @@ Formatter::Formatter(bsl::ostream&     stream,
     // empty in 'openObject' when we access its last element.
 
     d_callSequence.append(false);
+
+    // Integers (and 'bool' values) may be converted without the help of the
+    // locale of 'stream' only if doing so produces the same text as the
+    // formatted-output operators of 'stream'.
+
+    const bsl::ios_base::fmtflags flags     = stream.flags();
+    const bsl::ios_base::fmtflags basefield = flags
+                                            & bsl::ios_base::basefield;
+
+    d_useNumericFormatter = (bsl::ios_base::dec == basefield || 0 == basefield)
+                         && 0 == (flags & bsl::ios_base::showpos)
+                         && 0 == stream.width()
+                         && stream.getloc() == bsl::locale::classic();
+
+    for (int i = 0; i < k_NUM_CACHED_MEMBER_NAMES; ++i) {
+        d_memberNames[i].d_name_p = 0;
+    }
 }
 
 // MANIPULATORS
@@ -39,10 +89,10 @@ void Formatter::openObject()
         indent();
     }
 
-    d_outputStream << '{';
+    write('{');
 
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        write('\n');
         ++d_indentLevel;
         d_callSequence.append(false);
     }
@@ -52,14 +102,14 @@ void Formatter::closeObject()
 {
     if (d_usePrettyStyle) {
         --d_indentLevel;
-        d_outputStream << '\n';
+        write('\n');
         indent();
 
         BSLS_ASSERT(false == isArrayElement());
         d_callSequence.remove(d_callSequence.length() - 1);
     }
 
-    d_outputStream << '}';
+    write('}');
 }
 
 void Formatter::openArray(bool formatAsEmptyArrayFlag)
@@ -69,10 +119,10 @@ void Formatter::openArray(bool formatAsEmptyArrayFlag)
         indent();
     }
 
-    d_outputStream << '[';
+    write('[');
 
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
-        d_outputStream << '\n';
+        write('\n');
         ++d_indentLevel;
         d_callSequence.append(true);
     }
@@ -82,14 +132,14 @@ void Formatter::closeArray(bool formatAsEmptyArrayFlag)
 {
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
         --d_indentLevel;
-        d_outputStream << '\n';
+        write('\n');
         indent();
 
         BSLS_ASSERT(true == isArrayElement());
         d_callSequence.remove(d_callSequence.length() - 1);
     }
 
-    d_outputStream << ']';
+    write(']');
 }
 
 int Formatter::openMember(const bsl::string_view& name)
@@ -98,29 +148,65 @@ int Formatter::openMember(const bsl::string_view& name)
         indent();
     }
 
-    const int rc = PrintUtil::printValue(d_outputStream, name);
-    if (rc) {
-        return rc;                                                    // RETURN
+    // The cache is indexed by the address of 'name', which, for the attribute
+    // names supplied by 'bdlat' types, is typically the address of a string
+    // literal.  A cached entry is used only if its name has the same contents
+    // as 'name', so that names that are not string literals are supported.
+
+    const bsls::Types::UintPtr address =
+                        reinterpret_cast<bsls::Types::UintPtr>(name.data());
+    CachedMemberName&          entry   =
+       d_memberNames[(address ^ (address >> 5)) % k_NUM_CACHED_MEMBER_NAMES];
+
+    if (entry.d_name_p == name.data()
+     && static_cast<bsl::size_t>(entry.d_nameLength) == name.length()
+     && 0 == bsl::memcmp(entry.d_text + 1, name.data(), name.length())) {
+        return writeMemberName(entry) ? 0 : -1;                       // RETURN
     }
 
-    d_outputStream << (d_usePrettyStyle ? " : " : ":");
+    const char        *separator       = d_usePrettyStyle ? " : " : ":";
+    const bsl::size_t  separatorLength = d_usePrettyStyle ? 3 : 1;
+
+    if (name.length() + separatorLength + 2 > k_MAX_CACHED_MEMBER_TEXT
+     || !isVerbatimString(name)) {
+        const int rc = PrintUtil::printValue(d_outputStream, name);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+
+        write(separator, separatorLength);
+        return 0;                                                     // RETURN
+    }
+
+    char *text = entry.d_text;
+
+    *text++ = '"';
+    bsl::memcpy(text, name.data(), name.length());
+    text += name.length();
+    *text++ = '"';
+    bsl::memcpy(text, separator, separatorLength);
+    text += separatorLength;
+
+    entry.d_name_p     = name.data();
+    entry.d_nameLength = static_cast<int>(name.length());
+    entry.d_textLength = static_cast<int>(text - entry.d_text);
 
-    return 0;
+    return writeMemberName(entry) ? 0 : -1;
 }
 
 void Formatter::closeMember()
 {
-    d_outputStream << ',';
+    write(',');
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        write('\n');
     }
 }
 
 void Formatter::addArrayElementSeparator()
 {
-    d_outputStream << ',';
+    write(',');
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        write('\n');
     }
 }
 
@@ -44,6 +44,33 @@ BSLS_IDENT("$Id: $")
 // document.  It is the user's responsibility to ensure that the methods
 // provided by this component are called in the right order.
 //
+///Performance
+///-----------
+// A 'Formatter' writes directly to the stream buffer of the stream supplied at
+// construction, rather than through the formatted-output operators of the
+// stream, so that each token costs at most one call to the stream buffer.  In
+// addition:
+//
+//: o The quoted and escaped text of each member name, followed by the name
+//:   separator, is computed on the first call to 'openMember' for that name,
+//:   and recorded in a small cache held by the formatter.  Subsequent calls to
+//:   'openMember' for the same name (e.g., the attribute names of the
+//:   elements of an array of sequences) write the recorded text directly.
+//:
+//: o Strings that do not need escaping are written without escape
+//:   processing.
+//:
+//: o If, at construction, the stream has the "C" locale and formatting flags
+//:   that do not affect the output of integers (as is the case for a newly
+//:   constructed stream), integers and boolean values are converted to text
+//:   using 'bslalg::NumericFormatterUtil' rather than the locale of the
+//:   stream.
+//
+// The text written is identical to that written by the corresponding
+// 'baljsn::PrintUtil' functions, whichever path is taken.  Note that the
+// locale and formatting flags of the stream are examined only at construction,
+// and should not be changed while a 'Formatter' is writing to the stream.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -191,9 +218,15 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_ostream.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_string_view.h>
 
@@ -212,12 +245,41 @@ class Formatter {
     // according to a set of formatting options (also supplied at
     // construction).
 
+    // PRIVATE TYPES
+    enum {
+        k_NUM_CACHED_MEMBER_NAMES = 32,  // number of entries in the member
+                                         // name cache
+
+        k_MAX_CACHED_MEMBER_TEXT  = 52   // maximum length of the text of a
+                                         // cached member name
+    };
+
+    struct CachedMemberName {
+        // This 'struct' records the text written by 'openMember' for a member
+        // name, i.e., the quoted name followed by the name separator.
+
+        const char *d_name_p;                          // address of the name
+                                                       // (not owned), or 0 if
+                                                       // the entry is unused
+
+        int         d_nameLength;                      // length of the name
+
+        int         d_textLength;                      // length of 'd_text'
+
+        char        d_text[k_MAX_CACHED_MEMBER_TEXT];  // quoted name followed
+                                                       // by the name separator
+    };
+
     // DATA
     bsl::ostream&     d_outputStream;        // stream for output (held, not
                                              // owned)
 
     bool              d_usePrettyStyle;      // encoding style
 
+    bool              d_useNumericFormatter; // 'true' if integers can be
+                                             // written without using the
+                                             // locale of 'd_outputStream'
+
     int               d_indentLevel;         // current indentation level
 
     int               d_spacesPerLevel;      // spaces per indentation level
@@ -229,6 +291,18 @@ class Formatter {
                                              // is represented by 'false' and
                                              // an 'openArray' call by 'true'.
 
+    CachedMemberName  d_memberNames[k_NUM_CACHED_MEMBER_NAMES];
+                                             // text of recently opened
+                                             // members, indexed by a hash of
+                                             // the address of their name
+
+    // PRIVATE CLASS METHODS
+    static bool isVerbatimString(const bsl::string_view& value);
+        // Return 'true' if the JSON representation of the specified 'value'
+        // consists of the characters of 'value' between double quotes, i.e.,
+        // if 'value' contains only printable ASCII characters none of which
+        // needs to be escaped, and 'false' otherwise.
+
     // PRIVATE MANIPULATORS
     void indent();
         // Unconditionally print onto the stream supplied at construction the
@@ -236,6 +310,52 @@ class Formatter {
         // element at the current indentation level.  Note that this method
         // does not check that 'd_usePrettyStyle' is 'true' before indenting.
 
+    template <class TYPE>
+    int printIntegralValue(TYPE value);
+        // Print onto the stream supplied at construction the decimal
+        // representation of the specified integral 'value'.  Return 0 on
+        // success and a non-zero value otherwise.
+
+    int printValue(bool value, const EncoderOptions *options);
+    int printValue(char value, const EncoderOptions *options);
+    int printValue(signed char value, const EncoderOptions *options);
+    int printValue(unsigned char value, const EncoderOptions *options);
+    int printValue(short value, const EncoderOptions *options);
+    int printValue(unsigned short value, const EncoderOptions *options);
+    int printValue(int value, const EncoderOptions *options);
+    int printValue(unsigned int value, const EncoderOptions *options);
+    int printValue(bsls::Types::Int64 value, const EncoderOptions *options);
+    int printValue(bsls::Types::Uint64 value, const EncoderOptions *options);
+    int printValue(const bsl::string& value, const EncoderOptions *options);
+    int printValue(const bsl::string_view&  value,
+                   const EncoderOptions    *options);
+    template <class TYPE>
+    int printValue(const TYPE& value, const EncoderOptions *options);
+        // Print onto the stream supplied at construction the JSON
+        // representation of the specified 'value' according to the specified
+        // 'options'.  Return 0 on success and a non-zero value otherwise.  The
+        // text written is identical to that written by the 'printValue'
+        // function of 'baljsn::PrintUtil' for 'value' and 'options'.
+
+    bool writeMemberName(const CachedMemberName& entry);
+        // Write the text of the specified 'entry' to the stream buffer of the
+        // stream supplied at construction, and set the 'badbit' of that stream
+        // if the write fails.  Return 'true' if at least the quoted member
+        // name of 'entry' is written, and 'false' otherwise.
+
+    void write(char character);
+        // Write the specified 'character' to the stream buffer of the stream
+        // supplied at construction, and set the 'badbit' of that stream if the
+        // write fails.  This method has no effect unless the stream is in a
+        // good state.
+
+    bsl::size_t write(const char *data, bsl::size_t length);
+        // Write the specified 'length' characters starting at the specified
+        // 'data' to the stream buffer of the stream supplied at construction,
+        // and set the 'badbit' of that stream if fewer characters are written.
+        // Return the number of characters written.  This method has no effect,
+        // and returns 0, unless the stream is in a good state.
+
     // PRIVATE ACCESSORS
     bool isArrayElement() const;
         // Return 'true' if the value being encoded is an element of an array,
@@ -345,11 +465,175 @@ class Formatter {
                         // class Formatter
                         // ---------------
 
+// PRIVATE CLASS METHODS
+inline
+bool Formatter::isVerbatimString(const bsl::string_view& value)
+{
+    const char       *current = value.data();
+    const char *const end     = current + value.length();
+
+    for (; current != end; ++current) {
+        const unsigned char character = static_cast<unsigned char>(*current);
+
+        if (character < 0x20 || character > 0x7f || '"' == character
+         || '\\' == character || '/' == character) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
 // PRIVATE MANIPULATORS
+template <class TYPE>
+int Formatter::printIntegralValue(TYPE value)
+{
+    if (!d_useNumericFormatter) {
+        return baljsn::PrintUtil::printValue(d_outputStream, value);  // RETURN
+    }
+
+    typedef bslalg::NumericFormatterUtil NumFmt;
+
+    char              buffer[NumFmt::ToCharsMaxLength<TYPE>::k_VALUE];
+    const char *const end = NumFmt::toChars(buffer,
+                                            buffer + sizeof buffer,
+                                            value);
+    BSLS_ASSERT(0 != end);
+
+    write(buffer, end - buffer);
+    return 0;
+}
+
 inline
-void Formatter::indent()
+int Formatter::printValue(bool value, const EncoderOptions *options)
 {
-    bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
+    if (!d_useNumericFormatter) {
+        return baljsn::PrintUtil::printValue(d_outputStream,
+                                             value,
+                                             options);                // RETURN
+    }
+
+    if (value) {
+        write("true", 4);
+    }
+    else {
+        write("false", 5);
+    }
+    return 0;
+}
+
+inline
+int Formatter::printValue(char value, const EncoderOptions *)
+{
+    signed char tmp(value);  // Note that 'char' is unsigned on IBM.
+
+    return printIntegralValue(static_cast<int>(tmp));
+}
+
+inline
+int Formatter::printValue(signed char value, const EncoderOptions *)
+{
+    return printIntegralValue(static_cast<int>(value));
+}
+
+inline
+int Formatter::printValue(unsigned char value, const EncoderOptions *)
+{
+    return printIntegralValue(static_cast<int>(value));
+}
+
+inline
+int Formatter::printValue(short value, const EncoderOptions *)
+{
+    return printIntegralValue(value);
+}
+
+inline
+int Formatter::printValue(unsigned short value, const EncoderOptions *)
+{
+    return printIntegralValue(value);
+}
+
+inline
+int Formatter::printValue(int value, const EncoderOptions *)
+{
+    return printIntegralValue(value);
+}
+
+inline
+int Formatter::printValue(unsigned int value, const EncoderOptions *)
+{
+    return printIntegralValue(value);
+}
+
+inline
+int Formatter::printValue(bsls::Types::Int64 value, const EncoderOptions *)
+{
+    return printIntegralValue(value);
+}
+
+inline
+int Formatter::printValue(bsls::Types::Uint64 value, const EncoderOptions *)
+{
+    return printIntegralValue(value);
+}
+
+inline
+int Formatter::printValue(const bsl::string&    value,
+                          const EncoderOptions *options)
+{
+    return printValue(bsl::string_view(value), options);
+}
+
+inline
+int Formatter::printValue(const bsl::string_view&  value,
+                          const EncoderOptions    *options)
+{
+    if (!isVerbatimString(value)) {
+        return baljsn::PrintUtil::printValue(d_outputStream,
+                                             value,
+                                             options);                // RETURN
+    }
+
+    write('"');
+    write(value.data(), value.length());
+    write('"');
+
+    return d_outputStream.good() ? 0 : -1;
+}
+
+template <class TYPE>
+inline
+int Formatter::printValue(const TYPE& value, const EncoderOptions *options)
+{
+    return baljsn::PrintUtil::printValue(d_outputStream, value, options);
+}
+
+inline
+void Formatter::write(char character)
+{
+    typedef bsl::streambuf::traits_type Traits;
+
+    if (d_outputStream.good()
+     && Traits::eof() == d_outputStream.rdbuf()->sputc(character)) {
+        d_outputStream.setstate(bsl::ios_base::badbit);
+    }
+}
+
+inline
+bsl::size_t Formatter::write(const char *data, bsl::size_t length)
+{
+    if (!d_outputStream.good()) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::streamsize numWritten = d_outputStream.rdbuf()->sputn(
+                                        data,
+                                        static_cast<bsl::streamsize>(length));
+
+    if (static_cast<bsl::size_t>(numWritten) != length) {
+        d_outputStream.setstate(bsl::ios_base::badbit);
+    }
+    return numWritten;
 }
 
 // PRIVATE ACCESSORS
@@ -368,7 +652,7 @@ void Formatter::putNullValue()
     if (d_usePrettyStyle && isArrayElement()) {
         indent();
     }
-    d_outputStream << "null";
+    write("null", 4);
 }
 
 template <class TYPE>
@@ -377,7 +661,7 @@ int Formatter::putValue(const TYPE& value, const EncoderOptions *options)
     if (d_usePrettyStyle && isArrayElement()) {
         indent();
     }
-    return baljsn::PrintUtil::printValue(d_outputStream, value, options);
+    return printValue(value, options);
 }
 
 // ACCESSORS
@@ -21,6 +21,7 @@
 #include <bdlde_utf8util.h>
 
 #include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bdlat_typetraits.h>
@@ -41,15 +42,19 @@
 #include <bslmf_assert.h>
 
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 
@@ -88,7 +93,9 @@ namespace test = BloombergLP::s_baltst;
 // [11] void addArrayElementSeparator();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [12] CONCERN: MEMBER NAMES ARE CACHED WITHOUT AFFECTING THE OUTPUT
+// [12] CONCERN: VALUES ARE WRITTEN AS BY 'baljsn::PrintUtil'
+// [13] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -243,7 +250,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -399,6 +406,241 @@ int main(int argc, char *argv[])
     ASSERT(EXPECTED == os.str());
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING DIRECT OUTPUT AND THE MEMBER NAME CACHE
+        //
+        // Concerns:
+        //: 1 'openMember' writes the same text for a name whether or not the
+        //:   text of the name is cached, including when the cache is full,
+        //:   when two names share an entry of the cache, and when a name at
+        //:   the same address as a cached name has different contents.
+        //:
+        //: 2 Names that must be escaped, names containing non-ASCII
+        //:   characters, and names too long to be cached are written as by
+        //:   'baljsn::PrintUtil'.
+        //:
+        //: 3 Integers, 'bool' values, and strings are written as by
+        //:   'baljsn::PrintUtil', including when the stream has formatting
+        //:   flags that affect the output of integers.
+        //:
+        //: 4 If a write to the stream fails, 'openMember' and 'putValue'
+        //:   return the same status as 'baljsn::PrintUtil' would.
+        //
+        // Plan:
+        //: 1 Open members having each of a set of names, some of which must
+        //:   be escaped, contain non-ASCII characters, or are long, many
+        //:   times in an interleaved order, in both styles, and compare the
+        //:   output with that of 'baljsn::PrintUtil'.  (C-1..2)
+        //:
+        //: 2 Open a member whose name is a modifiable buffer, change the
+        //:   contents of the buffer, and open a member with that name again.
+        //:   (C-1)
+        //:
+        //: 3 For a set of values of each type and a set of stream formatting
+        //:   flags, compare the output of 'putValue' with that of
+        //:   'baljsn::PrintUtil' for a stream having the same flags.  (C-3)
+        //:
+        //: 4 Write member names and values to a stream buffer of limited
+        //:   capacity, and verify that the status returned is that returned
+        //:   by 'baljsn::PrintUtil' for a stream buffer having the same
+        //:   capacity.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: MEMBER NAMES ARE CACHED WITHOUT AFFECTING THE OUTPUT
+        //   CONCERN: VALUES ARE WRITTEN AS BY 'baljsn::PrintUtil'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DIRECT OUTPUT AND THE MEMBER NAME CACHE"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        if (verbose) cout << "\nTesting member names." << endl;
+        {
+            static const char LONG_NAME[] =
+                     "aVeryLongMemberNameThatDoesNotFitInAnEntryOfTheCache";
+
+            bsl::vector<bsl::string> names;
+            names.push_back("");
+            names.push_back("name");
+            names.push_back("a\"b");
+            names.push_back("a\\b");
+            names.push_back("a/b");
+            names.push_back("tab\there");
+            names.push_back("\xc3\xa9t\xc3\xa9");
+            names.push_back(LONG_NAME);
+            names.push_back(bsl::string(LONG_NAME) + LONG_NAME);
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::ostringstream name;
+                name << "attribute" << i;
+                names.push_back(name.str());
+            }
+
+            for (int style = 0; style < 2; ++style) {
+                bsl::ostringstream os;
+                bsl::ostringstream exp;
+
+                Obj mX(os, style, 1, 2);
+
+                for (int pass = 0; pass < 3; ++pass) {
+                    for (bsl::size_t i = 0; i < names.size(); ++i) {
+                        const bsl::string& NAME =
+                                        names[(i * (pass + 1)) % names.size()];
+
+                        ASSERTV(style, NAME, 0 == mX.openMember(NAME));
+
+                        if (style) {
+                            bdlb::Print::indent(exp, 1, 2);
+                        }
+                        baljsn::PrintUtil::printValue(exp, NAME);
+                        exp << (style ? " : " : ":");
+                    }
+                }
+
+                ASSERTV(style, os.str() == exp.str());
+            }
+
+            char buffer[] = "first";
+
+            bsl::ostringstream os;
+            Obj                mX(os);
+
+            ASSERT(0 == mX.openMember(buffer));
+            ASSERT(0 == mX.openMember(buffer));
+
+            bsl::strcpy(buffer, "other");
+            ASSERT(0 == mX.openMember(buffer));
+
+            bsl::strcpy(buffer, "a\"b");
+            ASSERT(0 == mX.openMember(buffer));
+
+            ASSERTV(os.str(),
+                    "\"first\":\"first\":\"other\":\"a\\\"b\":" == os.str());
+
+            ASSERT(0 != mX.openMember("\xff"));
+        }
+
+        if (verbose) cout << "\nTesting values." << endl;
+        {
+            const bsl::ios_base::fmtflags FLAGS[] = {
+                bsl::ios_base::dec | bsl::ios_base::skipws,
+                bsl::ios_base::fmtflags(),
+                bsl::ios_base::hex,
+                bsl::ios_base::oct | bsl::ios_base::showbase,
+                bsl::ios_base::dec | bsl::ios_base::showpos,
+                bsl::ios_base::boolalpha,
+            };
+            const int NUM_FLAGS = sizeof FLAGS / sizeof *FLAGS;
+
+            for (int i = 0; i < NUM_FLAGS; ++i) {
+                bsl::ostringstream os;
+                bsl::ostringstream exp;
+
+                os.flags(FLAGS[i]);
+                exp.flags(FLAGS[i]);
+
+                Obj mX(os);
+
+#define TEST_VALUE(TYPE, VALUE)                                               \
+                {                                                             \
+                    const TYPE X = VALUE;                                     \
+                                                                              \
+                    ASSERTV(i, #VALUE, 0 == mX.putValue(X));                  \
+                    ASSERTV(i, #VALUE,                                        \
+                            0 == baljsn::PrintUtil::printValue(exp, X));      \
+                }
+
+                TEST_VALUE(bool,           true);
+                TEST_VALUE(bool,           false);
+                TEST_VALUE(char,           'A');
+                TEST_VALUE(char,           -1);
+                TEST_VALUE(signed char,    -128);
+                TEST_VALUE(unsigned char,  255);
+                TEST_VALUE(short,          SHRT_MIN);
+                TEST_VALUE(unsigned short, USHRT_MAX);
+                TEST_VALUE(int,            0);
+                TEST_VALUE(int,            -7);
+                TEST_VALUE(int,            INT_MIN);
+                TEST_VALUE(unsigned int,   UINT_MAX);
+                TEST_VALUE(bsls::Types::Int64,
+                           bsl::numeric_limits<bsls::Types::Int64>::min());
+                TEST_VALUE(bsls::Types::Uint64,
+                           bsl::numeric_limits<bsls::Types::Uint64>::max());
+                TEST_VALUE(double,         1.5);
+                TEST_VALUE(bsl::string,    "");
+                TEST_VALUE(bsl::string,    "plain text");
+                TEST_VALUE(bsl::string,    "needs \"escaping\"\n");
+                TEST_VALUE(bsl::string,    "\xc3\xa9t\xc3\xa9");
+                TEST_VALUE(bsl::string,    "\x7f");
+                TEST_VALUE(bsl::string_view, "view");
+
+#undef TEST_VALUE
+
+                ASSERTV(i, os.str(), exp.str(), os.str() == exp.str());
+            }
+
+            bsl::ostringstream os;
+            Obj                mX(os);
+
+            ASSERT(0 != mX.putValue(bsl::string("\xff")));
+        }
+
+        if (verbose) cout << "\nTesting output failures." << endl;
+        {
+            const char *NAMES[] = { "name", "a\"b", "x" };
+            const int   NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            for (int style = 0; style < 2; ++style) {
+                for (int ni = 0; ni < NUM_NAMES; ++ni) {
+                    const bsl::string_view NAME(NAMES[ni]);
+
+                    for (int capacity = 0; capacity < 12; ++capacity) {
+                        char buffer[16];
+
+                        bdlsb::FixedMemOutStreamBuf osb(buffer, capacity);
+                        bsl::ostream                os(&osb);
+
+                        Obj mX(os, style);
+
+                        // The first call to 'openMember' fills the cache, and
+                        // the second uses it.
+
+                        const int RC1 = mX.openMember(NAME);
+                        const int RC2 = mX.openMember(NAME);
+                        const int RC3 = mX.putValue(bsl::string(NAME));
+
+                        char expBuffer[16];
+
+                        bdlsb::FixedMemOutStreamBuf expOsb(expBuffer,
+                                                           capacity);
+                        bsl::ostream                exp(&expOsb);
+
+                        int EXP_RC[3];
+                        for (int j = 0; j < 2; ++j) {
+                            EXP_RC[j] = baljsn::PrintUtil::printValue(exp,
+                                                                      NAME);
+                            exp << (style ? " : " : ":");
+                        }
+                        EXP_RC[2] = baljsn::PrintUtil::printValue(exp, NAME);
+
+                        ASSERTV(style, NAME, capacity, RC1, EXP_RC[0] == RC1);
+                        ASSERTV(style, NAME, capacity, RC2, EXP_RC[1] == RC2);
+                        ASSERTV(style, NAME, capacity, RC3, EXP_RC[2] == RC3);
+                        ASSERTV(style, NAME, capacity,
+                                osb.length() == expOsb.length());
+                        ASSERTV(style, NAME, capacity,
+                                0 == bsl::memcmp(buffer,
+                                                 expBuffer,
+                                                 osb.length()));
+                        ASSERTV(style, NAME, capacity, !os == !exp);
+                    }
+                }
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'addArrayElementSeparator' METHOD
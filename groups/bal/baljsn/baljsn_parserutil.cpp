@@ -500,28 +500,24 @@ int ParserUtil::getValue(bsl::vector<char>       *value,
 
     value->clear();
 
-    bdlde::Base64Decoder base64Decoder(true);
-    int                  length = static_cast<int>(base64String.length());
-
-    value->resize(static_cast<bsl::size_t>(
-                              bdlde::Base64Decoder::maxDecodedLength(length)));
-
-    rc = base64Decoder.convert(value->begin(),
-                               base64String.begin(),
-                               base64String.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    const bsl::size_t length = base64String.length();
+    if (0 == length) {
+        return 0;                                                     // RETURN
     }
 
-    rc = base64Decoder.endConvert(value->begin() +
-                                  base64Decoder.outputLength());
+    value->resize((length + 3) / 4 * 3);
 
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    bsl::size_t numOut;
+    rc = bdlde::Base64Decoder::decode(value->data(),
+                                      &numOut,
+                                      base64String.data(),
+                                      length,
+                                      bdlde::Base64DecoderOptions::mime());
+    if (rc) {
+        return -1;                                                    // RETURN
     }
 
-    value->resize(static_cast<bsl::size_t>(base64Decoder.outputLength()));
+    value->resize(numOut);
 
     return 0;
 }
@@ -180,7 +180,65 @@ void AsyncFileObserver::publishThreadEntryPoint()
                  || Status::e_FAILED   == rc);
 
         if (Status::e_SUCCESS == rc && !isStopRecord(record)) {
-            d_fileObserver.publish(record.d_record, record.d_context);
+            const Context context = record.d_context;
+
+            d_batch.push_back(record.d_record);
+
+            // Complete the batch with the records that are already on the
+            // queue, waiting (at most once) for the flush latency if the queue
+            // runs empty before the batch is full.
+
+            const int          maxBatchSize = d_maxBatchSize.loadRelaxed();
+            bsls::Types::Int64 latency      = d_flushLatency.loadRelaxed();
+
+            while (static_cast<int>(d_batch.size()) < maxBatchSize) {
+                rc = d_recordQueue.tryPopFront(&record);
+
+                if (Status::e_SUCCESS == rc) {
+                    if (isStopRecord(record)) {
+                        done = true;
+                        break;
+                    }
+                    d_batch.push_back(record.d_record);
+                }
+                else if (Status::e_EMPTY == rc) {
+                    rc = Status::e_SUCCESS;
+                    if (0 == latency) {
+                        break;
+                    }
+                    bslmt::ThreadUtil::microSleep(
+                                      static_cast<int>(latency % 1000000),
+                                      static_cast<int>(latency / 1000000));
+                    latency = 0;
+                }
+                else {
+                    done = true;
+                    break;
+                }
+            }
+
+            const bool syncFlag = d_batchSyncFlag.loadRelaxed();
+
+            if (1 == d_batch.size() && !syncFlag) {
+                // A single record gains nothing from 'publishBatch', which
+                // writes directly to the file descriptor, whereas 'publish'
+                // goes through the buffered stream of the log file.
+
+                d_fileObserver.publish(d_batch.front(), context);
+            }
+            else {
+                d_fileObserver.publishBatch(d_batch.data(),
+                                            static_cast<int>(d_batch.size()),
+                                            syncFlag);
+            }
+
+            d_numPublishedBatches.addRelaxed(1);
+            d_numPublishedRecords.addRelaxed(
+                              static_cast<bsls::Types::Int64>(d_batch.size()));
+
+            // Release the references to the published records.
+
+            d_batch.clear();
         }
         else {
             done = true;
@@ -193,14 +251,17 @@ void AsyncFileObserver::publishThreadEntryPoint()
         // Finally, we publish the dropped record count if the observer is
         // shutting down, so the information is not lost.
 
-        if (0 < d_dropCount.loadRelaxed()) {
+        const bsls::Types::Int64 numDropped =
+                                             d_numDroppedRecords.loadRelaxed()
+                                           - d_numReportedDroppedRecords;
+
+        if (0 < numDropped) {
             if (d_recordQueue.numElements() <= d_recordQueue.numElements() / 2
-            ||  d_dropCount.loadRelaxed()   >= k_FORCE_WARN_THRESHOLD
+            ||  numDropped                  >= k_FORCE_WARN_THRESHOLD
             ||  done) {
-                int numDropped = d_dropCount.swap(0);
-                BSLS_ASSERT(0 < numDropped); // No other thread should have
-                                             // cleared the count.
-                logDroppedMessageWarning(&d_fileObserver, numDropped);
+                d_numReportedDroppedRecords += numDropped;
+                logDroppedMessageWarning(&d_fileObserver,
+                                         static_cast<int>(numDropped));
             }
         }
 
@@ -222,7 +283,14 @@ void AsyncFileObserver::construct()
 {
     d_threadHandle = bslmt::ThreadUtil::invalidHandle();
     d_threadState  = e_NOT_RUNNING;
-    d_dropCount    = 0;
+
+    d_numDroppedRecords         = 0;
+    d_numReportedDroppedRecords = 0;
+    d_maxBatchSize              = 1;
+    d_flushLatency              = 0;
+    d_batchSyncFlag             = false;
+    d_numPublishedBatches       = 0;
+    d_numPublishedRecords       = 0;
 
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
@@ -237,6 +305,7 @@ AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -248,6 +317,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -260,6 +330,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -273,6 +344,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -288,6 +360,7 @@ AsyncFileObserver::AsyncFileObserver(
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -314,7 +387,7 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
       : d_recordQueue.pushBack(asyncRecord);
 
     if (0 != rc) {
-      d_dropCount.addRelaxed(1);
+      d_numDroppedRecords.addRelaxed(1);
     }
 
 }
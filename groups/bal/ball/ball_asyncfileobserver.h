@@ -138,6 +138,17 @@ BSLS_IDENT("$Id: $")
 // | Management  | shutdownPublicationThread          |
 // |             | isPublicationThreadRunning         |
 // +-------------+------------------------------------+
+// | Batched     | setMaxBatchSize                    |
+// | Publication | setFlushLatency                    |
+// |             | enableBatchSync                    |
+// |             | disableBatchSync                   |
+// |             | maxBatchSize                       |
+// |             | flushLatency                       |
+// |             | isBatchSyncEnabled                 |
+// |             | numPublishedBatches                |
+// |             | numPublishedRecords                |
+// |             | numDroppedRecords                  |
+// +-------------+------------------------------------+
 //..
 // In general, a 'ball::AsyncFileObserver' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -175,7 +186,42 @@ BSLS_IDENT("$Id: $")
 // periodically publishing a warning (i.e., an internally generated log record
 // with severity 'e_WARN') that reports the number of dropped records.  The
 // record count is reset to 0 after each such warning is published, so each
-// dropped record is counted only once.
+// dropped record is counted only once.  The total number of records dropped
+// over the lifetime of the observer is reported by 'numDroppedRecords'.
+//
+///Batched Publication
+///-------------------
+// The publication thread removes records from the queue in batches: having
+// waited for a record to become available, it also takes the records that
+// are already on the queue, up to the maximum batch size set by
+// 'setMaxBatchSize'.  The records of a batch are formatted into a buffer that
+// is reused from one batch to the next, and written to the log file using a
+// single output operation; the records of the batch to be logged to 'stdout'
+// are likewise written together.  The default maximum batch size is 1, in
+// which case each record is written on its own, as it is dequeued, through
+// the buffered log file stream of the underlying 'FileObserver' (see
+// 'FileObserver::publish').  More generally, a batch that holds a single
+// record is published this way, unless batch synchronization is enabled.
+//
+// When records arrive at a slow pace, batches are small.  'setFlushLatency'
+// configures the publication thread to wait (once per batch, for at most the
+// specified interval) for more records to arrive when the queue runs empty
+// before the batch is full.  A non-zero flush latency trades the delay with
+// which a record reaches the log file for fewer, larger writes.  The default
+// flush latency is 0 (do not wait).
+//
+// By default, records are handed to the operating system without waiting for
+// them to reach the storage device.  'enableBatchSync' configures the
+// publication thread to commit each batch to the storage device (e.g., using
+// 'fdatasync') once it is written, so that the cost of a synchronization is
+// shared among the records of the batch.
+//
+// The numbers of batches and records written by the publication thread are
+// reported by 'numPublishedBatches' and 'numPublishedRecords', respectively,
+// from which the average batch size can be derived.  Note that a log file
+// rotation that falls due part way through a batch is performed before the
+// remaining records of the batch are written (see
+// 'FileObserver2::publishBatch').
 //
 ///Log Record Formatting
 ///---------------------
@@ -226,6 +272,18 @@ BSLS_IDENT("$Id: $")
 // is desired instead, consider using either the '%D' or '%O' format
 // specification supported by 'ball_recordstringformatter'.
 //
+///Deferred Formatting
+///- - - - - - - - - -
+// The message of a log record produced by one of the deferred-formatting
+// 'printf'-style macros (e.g., 'BALL_LOGVA_DEFERRED_INFO', see 'ball_log')
+// holds the arguments of the message, rather than the message itself, until
+// the message is first accessed (see
+// {'ball_recordattributes'|Deferred Formatting}).  Since an async file
+// observer only queues the records published to it, such messages are
+// formatted by the publication thread when the records are written, provided
+// that no other observer accesses them first, which moves the cost of
+// formatting them off the logging threads.
+//
 ///Log Record Timestamps
 ///---------------------
 // By default, the timestamp attributes of published records are written in UTC
@@ -531,12 +589,16 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_threadutil.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
 #include <memory_resource>  // 'std::pmr::polymorphic_allocator'
@@ -605,11 +667,45 @@ class AsyncFileObserver : public Observer {
                                                      // queue is full; default
                                                      // is 'Severity::e_OFF'
 
-    bsls::AtomicInt                d_dropCount;      // number of dropped
-                                                     // records; reset to 0
-                                                     // each time drop count is
+    bsls::AtomicInt64              d_numDroppedRecords;
+                                                     // total number of
+                                                     // dropped records
+
+    bsls::Types::Int64             d_numReportedDroppedRecords;
+                                                     // number of dropped
+                                                     // records reported by a
+                                                     // published warning;
+                                                     // accessed only by the
+                                                     // publication thread
+
+    bsls::AtomicInt                d_maxBatchSize;   // maximum number of
+                                                     // records published as a
+                                                     // single batch
+
+    bsls::AtomicInt64              d_flushLatency;   // time (in microseconds)
+                                                     // for which to wait for
+                                                     // more records before
+                                                     // publishing an
+                                                     // incomplete batch
+
+    bsls::AtomicBool               d_batchSyncFlag;  // 'true' if each batch
+                                                     // is committed to the
+                                                     // storage device
+
+    bsls::AtomicInt64              d_numPublishedBatches;
+                                                     // number of batches
                                                      // published
 
+    bsls::AtomicInt64              d_numPublishedRecords;
+                                                     // number of records
+                                                     // published in batches
+
+    bsl::vector<bsl::shared_ptr<const Record> >
+                                   d_batch;          // records of the batch
+                                                     // being published; used
+                                                     // only by the publication
+                                                     // thread
+
     bsl::function<void()>          d_publishThreadEntryPoint;
                                                      // publication thread
                                                      // entry point functor
@@ -631,8 +727,9 @@ class AsyncFileObserver : public Observer {
         // C++11 constructor chaining is available on all supported platforms.
 
     void publishThreadEntryPoint();
-        // Publish records from the record queue, to the log file and 'stdout',
-        // until signaled to stop.  The behavior is undefined if this method is
+        // Publish records from the record queue, in batches of at most
+        // 'maxBatchSize()' records, to the log file and 'stdout', until
+        // signaled to stop.  The behavior is undefined if this method is
         // invoked concurrently from multiple threads, i.e., it is *not*
         // thread-safe.  Note that this function is the entry point for the
         // publication thread.
@@ -733,6 +830,11 @@ class AsyncFileObserver : public Observer {
         // async file observer.
 
     // MANIPULATORS
+    void disableBatchSync();
+        // Disable committing each batch of records written to the log file to
+        // the storage device.  This method has no effect if batch
+        // synchronization is not enabled.  See {Batched Publication}.
+
     void disableFileLogging();
         // Disable file logging for this async file observer.  This method has
         // no effect if file logging is not enabled.  Calling this method will
@@ -810,6 +912,12 @@ class AsyncFileObserver : public Observer {
         // affects records subsequently received through the 'publish' method
         // as well as those that are currently on the queue.
 
+    void enableBatchSync();
+        // Enable committing each batch of records written to the log file to
+        // the storage device, blocking the publication thread until the batch
+        // is committed.  This method has no effect if batch synchronization
+        // is already enabled.  See {Batched Publication}.
+
     void enablePublishInLocalTime();
         // Enable publishing of the timestamp attribute of records in local
         // time by this async file observer.  This method has no effect if
@@ -873,6 +981,14 @@ class AsyncFileObserver : public Observer {
         // reference time of 'bdlt::Datetime(1, 1, 1)' and an interval of 24
         // hours would configure a periodic rotation at midnight each day.
 
+    void setFlushLatency(const bsls::TimeInterval& latency);
+        // Set the maximum time for which the publication thread waits for
+        // more records to arrive, when the record queue runs empty before a
+        // batch is full, to the specified 'latency'.  A 'latency' of 0 causes
+        // incomplete batches to be published immediately.  The behavior is
+        // undefined unless 'bsls::TimeInterval() <= latency'.  See {Batched
+        // Publication}.
+
     void setLogFormat(const char *logFileFormat, const char *stdoutFormat);
         // Set the format specifications for log records written to the log
         // file and to 'stdout' to the specified 'logFileFormat' and
@@ -890,6 +1006,12 @@ class AsyncFileObserver : public Observer {
         // received through the 'publish' method as well as those that are
         // currently on the queue.
 
+    void setMaxBatchSize(int maxBatchSize);
+        // Set the maximum number of records that the publication thread
+        // publishes as a single batch to the specified 'maxBatchSize'.  The
+        // behavior is undefined unless '0 < maxBatchSize'.  See {Batched
+        // Publication}.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -938,6 +1060,10 @@ class AsyncFileObserver : public Observer {
         // otherwise.  See {Rotated File Naming} for details.
 
     // ACCESSORS
+    bsls::TimeInterval flushLatency() const;
+        // Return the maximum time for which the publication thread waits for
+        // more records to arrive before publishing an incomplete batch.
+
     void getLogFormat(const char **logFileFormat,
                       const char **stdoutFormat) const;
         // Load the format specification for log records written by this async
@@ -947,6 +1073,10 @@ class AsyncFileObserver : public Observer {
         // Record Formatting} for details on the syntax of format
         // specifications.
 
+    bool isBatchSyncEnabled() const;
+        // Return 'true' if each batch of records written to the log file is
+        // committed to the storage device, and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
     bool isFileLoggingEnabled(std::string *result) const;
@@ -1008,6 +1138,24 @@ class AsyncFileObserver : public Observer {
         // !DEPRECATED!: Use 'bdlt::LocalTimeOffset' instead.
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+    int maxBatchSize() const;
+        // Return the maximum number of records that the publication thread
+        // publishes as a single batch.
+
+    bsls::Types::Int64 numDroppedRecords() const;
+        // Return the total number of records that were dropped by 'publish'
+        // because the record queue was full.  Note that, unlike the count
+        // reported by the periodic warning, this number is never reset.
+
+    bsls::Types::Int64 numPublishedBatches() const;
+        // Return the number of batches of records published by the
+        // publication thread.
+
+    bsls::Types::Int64 numPublishedRecords() const;
+        // Return the number of records published by the publication thread.
+        // Note that 'numPublishedRecords() / numPublishedBatches()' is the
+        // average batch size.
+
     bsl::size_t recordQueueLength() const;
         // Return the number of log records currently on the record queue of
         // this async file observer.
@@ -1038,6 +1186,12 @@ class AsyncFileObserver : public Observer {
                           // -----------------------
 
 // MANIPULATORS
+inline
+void AsyncFileObserver::disableBatchSync()
+{
+    d_batchSyncFlag.storeRelaxed(false);
+}
+
 inline
 void AsyncFileObserver::disableFileLogging()
 {
@@ -1074,6 +1228,12 @@ int AsyncFileObserver::enableFileLogging(const char *logFilenamePattern)
     return d_fileObserver.enableFileLogging(logFilenamePattern);
 }
 
+inline
+void AsyncFileObserver::enableBatchSync()
+{
+    d_batchSyncFlag.storeRelaxed(true);
+}
+
 inline
 void AsyncFileObserver::enablePublishInLocalTime()
 {
@@ -1113,6 +1273,14 @@ void AsyncFileObserver::rotateOnTimeInterval(
     d_fileObserver.rotateOnTimeInterval(interval, startTime);
 }
 
+inline
+void AsyncFileObserver::setFlushLatency(const bsls::TimeInterval& latency)
+{
+    BSLS_ASSERT(bsls::TimeInterval() <= latency);
+
+    d_flushLatency.storeRelaxed(latency.totalMicroseconds());
+}
+
 inline
 void AsyncFileObserver::setLogFormat(const char *logFileFormat,
                                      const char *stdoutFormat)
@@ -1120,6 +1288,14 @@ void AsyncFileObserver::setLogFormat(const char *logFileFormat,
     d_fileObserver.setLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+void AsyncFileObserver::setMaxBatchSize(int maxBatchSize)
+{
+    BSLS_ASSERT(0 < maxBatchSize);
+
+    d_maxBatchSize.storeRelaxed(maxBatchSize);
+}
+
 inline
 void AsyncFileObserver::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
@@ -1140,6 +1316,14 @@ void AsyncFileObserver::suppressUniqueFileNameOnRotation(bool suppress)
 }
 
 // ACCESSORS
+inline
+bsls::TimeInterval AsyncFileObserver::flushLatency() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_flushLatency.loadRelaxed());
+    return result;
+}
+
 inline
 void AsyncFileObserver::getLogFormat(const char **logFileFormat,
                                      const char **stdoutFormat) const
@@ -1147,6 +1331,12 @@ void AsyncFileObserver::getLogFormat(const char **logFileFormat,
     d_fileObserver.getLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+bool AsyncFileObserver::isBatchSyncEnabled() const
+{
+    return d_batchSyncFlag.loadRelaxed();
+}
+
 inline
 bool AsyncFileObserver::isFileLoggingEnabled() const
 {
@@ -1211,6 +1401,30 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 }
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+inline
+int AsyncFileObserver::maxBatchSize() const
+{
+    return d_maxBatchSize.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numDroppedRecords() const
+{
+    return d_numDroppedRecords.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numPublishedBatches() const
+{
+    return d_numPublishedBatches.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numPublishedRecords() const
+{
+    return d_numPublishedRecords.loadRelaxed();
+}
+
 inline
 bsl::size_t AsyncFileObserver::recordQueueLength() const
 {
@@ -27,6 +27,7 @@
 #include <bslmt_barrier.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
@@ -90,6 +91,7 @@ using bsl::flush;
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
+// [15] void disableBatchSync();
 // [ 1] void disableFileLogging();
 // [ X] void disablePublishInLocalTime();
 // [ 6] void disableSizeRotation();
@@ -98,6 +100,7 @@ using bsl::flush;
 // [ 1] int enableFileLogging(const char *logFilenamePattern);
 // [ 1] void enableStdoutLoggingPrefix();
 // [ 1] void enablePublishInLocalTime();
+// [15] void enableBatchSync();
 // [ 6] void forceRotation();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
@@ -106,7 +109,9 @@ using bsl::flush;
 // [ 6] void rotateOnSize(int size);
 // [ 6] void rotateOnTimeInterval(const DatetimeInterval timeInterval);
 // [ 6] void rotateOnTimeInterval(const DatetimeI&, const Datetime&);
+// [15] void setFlushLatency(const bsls::TimeInterval& latency);
 // [ 1] void setLogFormat(const char* logF, const char* stdoutF);
+// [15] void setMaxBatchSize(int maxBatchSize);
 // [ 8] void setOnFileRotationCallback(const OnFileRotationCallback&);
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold);
 // [ 3] void shutdownPublicationThread();
@@ -114,13 +119,19 @@ using bsl::flush;
 // [ 3] void stopPublicationThread();
 //
 // ACCESSORS
+// [15] bsls::TimeInterval flushLatency() const;
 // [ 1] void getLogFormat(const char** logF, const char** stdoutF) const;
+// [15] bool isBatchSyncEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 3] bool isPublicationThreadRunning() const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
+// [15] int maxBatchSize() const;
+// [15] bsls::Types::Int64 numDroppedRecords() const;
+// [15] bsls::Types::Int64 numPublishedBatches() const;
+// [15] bsls::Types::Int64 numPublishedRecords() const;
 // [11] int recordQueueLength() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
@@ -133,7 +144,9 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [14] USAGE EXAMPLE
+// [15] CONCERN: BATCHED PUBLICATION
+// [16] CONCERN: DEFERRED FORMATTING
+// [17] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -635,7 +648,85 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 15: {
+      case 16: {
+        // --------------------------------------------------------------------
+        // CONCERN: DEFERRED FORMATTING
+        //
+        // Concerns:
+        //: 1 A record whose message is deferred remains deferred while it is
+        //:   on the record queue.
+        //:
+        //: 2 The message of such a record is formatted by the publication
+        //:   thread, and written to the log file.
+        //
+        // Plan:
+        //: 1 Without a running publication thread, publish records whose
+        //:   messages are deferred, and verify that they are still deferred.
+        //:   (C-1)
+        //:
+        //: 2 Start and stop the publication thread, and verify that the
+        //:   messages were formatted and written to the log file.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: DEFERRED FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: DEFERRED FORMATTING"
+                          << "\n============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+        const int NUM_RECORDS = 10;
+
+        Obj mX(ball::Severity::e_OFF, false, NUM_RECORDS, &ta);
+        const Obj& X = mX;
+
+        ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records(&ta);
+
+        ball::Context context;
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::shared_ptr<ball::Record> record =
+                                 createRecord("", ball::Severity::e_INFO, &ta);
+            record->fixedFields().setDeferredMessage("deferred-%d:%s:%.3f.",
+                                                     i,
+                                                     "text",
+                                                     i / 8.0);
+            records.push_back(record);
+
+            mX.publish(record, context);
+        }
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            ASSERTV(i, records[i]->fixedFields().isMessageDeferred());
+        }
+
+        ASSERT(0 == mX.startPublicationThread());
+        ASSERT(0 == mX.stopPublicationThread());
+
+        ASSERTV(X.numPublishedRecords(),
+                NUM_RECORDS == X.numPublishedRecords());
+
+        mX.disableFileLogging();
+
+        const bsl::string content = readPartialFile(fileName, 0);
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            ASSERTV(i, !records[i]->fixedFields().isMessageDeferred());
+
+            char expected[64];
+            snprintf(expected, sizeof expected, "deferred-%d:%s:%.3f.",
+                     i, "text", i / 8.0);
+
+            ASSERTV(i, expected, bsl::string::npos != content.find(expected));
+        }
+      } break;
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -786,6 +877,310 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // CONCERN: BATCHED PUBLICATION
+        //
+        // Concerns:
+        //: 1 Following construction, the maximum batch size is 1, the flush
+        //:   latency is 0, batch synchronization is disabled, and all the
+        //:   counters are 0.
+        //:
+        //: 2 The batch configuration manipulators set the values returned by
+        //:   the corresponding accessors.
+        //:
+        //: 3 Records published in batches are all written to the log file,
+        //:   in the order in which they were published, whether or not the
+        //:   batches are synchronized with the storage device and whether or
+        //:   not there is a flush latency.
+        //:
+        //: 4 The publication thread publishes the records that are on the
+        //:   queue in batches of at most the maximum batch size, and counts
+        //:   the batches and records that it publishes.
+        //:
+        //: 5 A log file rotation that falls due part way through a batch is
+        //:   performed, and no record is lost.
+        //:
+        //: 6 Records dropped because the queue is full are counted, and that
+        //:   count is never reset.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an observer and verify the values returned by the batch
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Set each batch configuration attribute and verify the value
+        //:   returned by the corresponding accessor.  (C-2)
+        //:
+        //: 3 For a set of maximum batch sizes, with and without batch
+        //:   synchronization, publish a number of records before starting the
+        //:   publication thread, then stop the thread, and verify the log
+        //:   file content, the number of published records and the number of
+        //:   published batches.  Repeat with a flush latency, publishing the
+        //:   records while the publication thread runs.  (C-3..4)
+        //:
+        //: 4 Enable rotation on size with a small size, publish a batch of
+        //:   records larger than that size, and verify that the file was
+        //:   rotated, and that the records are split between the rotated and
+        //:   the current log files.  (C-5)
+        //:
+        //: 5 Publish more records than the queue can hold without a running
+        //:   publication thread, and verify 'numDroppedRecords'.  (C-6)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid attribute values.  (C-7)
+        //
+        // Testing:
+        //   void disableBatchSync();
+        //   void enableBatchSync();
+        //   void setFlushLatency(const bsls::TimeInterval& latency);
+        //   void setMaxBatchSize(int maxBatchSize);
+        //   bsls::TimeInterval flushLatency() const;
+        //   bool isBatchSyncEnabled() const;
+        //   int maxBatchSize() const;
+        //   bsls::Types::Int64 numDroppedRecords() const;
+        //   bsls::Types::Int64 numPublishedBatches() const;
+        //   bsls::Types::Int64 numPublishedRecords() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: BATCHED PUBLICATION"
+                          << "\n============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tTesting default and set values." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(1                    == X.maxBatchSize());
+            ASSERT(bsls::TimeInterval() == X.flushLatency());
+            ASSERT(false                == X.isBatchSyncEnabled());
+            ASSERT(0                    == X.numPublishedBatches());
+            ASSERT(0                    == X.numPublishedRecords());
+            ASSERT(0                    == X.numDroppedRecords());
+
+            mX.setMaxBatchSize(256);
+            ASSERT(256 == X.maxBatchSize());
+
+            mX.setFlushLatency(bsls::TimeInterval(0.25));
+            ASSERT(bsls::TimeInterval(0.25) == X.flushLatency());
+
+            mX.setFlushLatency(bsls::TimeInterval());
+            ASSERT(bsls::TimeInterval() == X.flushLatency());
+
+            mX.enableBatchSync();
+            ASSERT(true  == X.isBatchSyncEnabled());
+
+            mX.disableBatchSync();
+            ASSERT(false == X.isBatchSyncEnabled());
+        }
+
+        if (verbose) cout << "\tTesting batched publication." << endl;
+        {
+            const int MAX_BATCH_SIZES[] = { 1, 2, 7, 64, 1000 };
+            const int NUM_MAX_BATCH_SIZES = static_cast<int>(
+                       sizeof MAX_BATCH_SIZES / sizeof *MAX_BATCH_SIZES);
+
+            const int NUM_RECORDS = 500;
+
+            for (int ti = 0; ti < NUM_MAX_BATCH_SIZES * 2; ++ti) {
+                const int  MAX_BATCH_SIZE = MAX_BATCH_SIZES[ti / 2];
+                const bool SYNC           = ti % 2;
+
+                if (veryVerbose) { T_ P_(MAX_BATCH_SIZE) P(SYNC) }
+
+                bdls::TempDirectoryGuard tempDirGuard("ball_");
+                bsl::string              fileName(
+                                                tempDirGuard.getTempDirName());
+                bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+                Obj mX(ball::Severity::e_OFF,
+                       false,
+                       NUM_RECORDS,
+                       &ta);
+                const Obj& X = mX;
+
+                mX.setMaxBatchSize(MAX_BATCH_SIZE);
+                if (SYNC) {
+                    mX.enableBatchSync();
+                }
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                ball::Context context;
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    bsl::ostringstream message;
+                    message << "batched-" << i << '.';
+                    mX.publish(createRecord(message.str(),
+                                            ball::Severity::e_INFO,
+                                            &ta),
+                               context);
+                }
+
+                // All the records are on the queue when the publication
+                // thread starts, so all batches but the last are full.
+
+                ASSERT(0 == mX.startPublicationThread());
+                ASSERT(0 == mX.stopPublicationThread());
+
+                const int EXP_NUM_BATCHES =
+                           (NUM_RECORDS + MAX_BATCH_SIZE - 1) / MAX_BATCH_SIZE;
+
+                ASSERTV(MAX_BATCH_SIZE, X.numPublishedRecords(),
+                        NUM_RECORDS == X.numPublishedRecords());
+                ASSERTV(MAX_BATCH_SIZE, X.numPublishedBatches(),
+                        EXP_NUM_BATCHES == X.numPublishedBatches());
+                ASSERTV(MAX_BATCH_SIZE, X.numDroppedRecords(),
+                        0 == X.numDroppedRecords());
+
+                mX.disableFileLogging();
+
+                ASSERTV(MAX_BATCH_SIZE, countLoggedRecords(fileName),
+                        NUM_RECORDS == countLoggedRecords(fileName));
+
+                const bsl::string content = readPartialFile(fileName, 0);
+
+                bsl::string::size_type position = 0;
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    bsl::ostringstream message;
+                    message << "batched-" << i << '.';
+
+                    position = content.find(message.str(), position);
+                    ASSERTV(MAX_BATCH_SIZE, i, bsl::string::npos != position);
+                    if (bsl::string::npos == position) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting flush latency." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            const int NUM_RECORDS = 100;
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            mX.setMaxBatchSize(NUM_RECORDS);
+            mX.setFlushLatency(bsls::TimeInterval(0, 1000000));  // 1ms
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            ball::Context context;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(createRecord("latency",
+                                        ball::Severity::e_INFO,
+                                        &ta),
+                           context);
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(X.numPublishedRecords(),
+                    NUM_RECORDS == X.numPublishedRecords());
+            ASSERTV(X.numPublishedBatches(),
+                    1                <= X.numPublishedBatches());
+            ASSERTV(X.numPublishedBatches(),
+                    X.numPublishedRecords() >= X.numPublishedBatches());
+
+            mX.disableFileLogging();
+
+            ASSERTV(countLoggedRecords(fileName),
+                    NUM_RECORDS == countLoggedRecords(fileName));
+        }
+
+        if (verbose) cout << "\tTesting rotation within a batch." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            const int NUM_RECORDS = 50;
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            RotCb cb(&ta);
+            mX.setOnFileRotationCallback(cb);
+
+            mX.setMaxBatchSize(NUM_RECORDS);
+            mX.rotateOnSize(1);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // Each record takes about 130 bytes, so the rotation size of 1
+            // kilobyte is reached part way through the batch.
+
+            const bsl::string MESSAGE(64, 'x');
+
+            ball::Context context;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(createRecord(MESSAGE, ball::Severity::e_INFO, &ta),
+                           context);
+            }
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(X.numPublishedBatches(), 1 == X.numPublishedBatches());
+            ASSERTV(cb.numInvocations(),     1 == cb.numInvocations());
+            ASSERTV(cb.status(),             0 == cb.status());
+
+            mX.disableFileLogging();
+
+            const int numRotated = countLoggedRecords(cb.rotatedFileName());
+            const int numCurrent = countLoggedRecords(fileName);
+
+            ASSERTV(numRotated, 0 < numRotated);
+            ASSERTV(numCurrent, 0 < numCurrent);
+            ASSERTV(numRotated, numCurrent,
+                    NUM_RECORDS == numRotated + numCurrent);
+        }
+
+        if (verbose) cout << "\tTesting dropped record count." << endl;
+        {
+            const int QUEUE_SIZE  = 10;
+            const int NUM_RECORDS = 25;
+
+            Obj mX(ball::Severity::e_OFF, false, QUEUE_SIZE, &ta);
+            const Obj& X = mX;
+
+            ball::Context context;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(createRecord("drop", ball::Severity::e_INFO, &ta),
+                           context);
+            }
+
+            ASSERTV(X.numDroppedRecords(),
+                    NUM_RECORDS - QUEUE_SIZE == X.numDroppedRecords());
+
+            // Publishing the dropped record warning does not reset the total.
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(X.numDroppedRecords(),
+                    NUM_RECORDS - QUEUE_SIZE == X.numDroppedRecords());
+            ASSERTV(X.numPublishedRecords(),
+                    QUEUE_SIZE == X.numPublishedRecords());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(ball::Severity::e_OFF, &ta);
+
+            ASSERT_FAIL(mX.setMaxBatchSize(0));
+            ASSERT_FAIL(mX.setMaxBatchSize(-1));
+            ASSERT_PASS(mX.setMaxBatchSize(1));
+
+            ASSERT_FAIL(mX.setFlushLatency(bsls::TimeInterval(0, -1)));
+            ASSERT_PASS(mX.setFlushLatency(bsls::TimeInterval()));
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING SUPPRESS UNIQUE FILE NAME ON ROTATION
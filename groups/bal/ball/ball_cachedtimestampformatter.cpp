@@ -0,0 +1,154 @@
+// ball_cachedtimestampformatter.cpp                                  -*-C++-*-
+#include <ball_cachedtimestampformatter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_cachedtimestampformatter_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The cache holds the complete text of the most recently formatted second,
+// rendered with the configured precision from a datetime whose fractional
+// second is 0, along with the index of the first fractional second digit in
+// that text.  A cache hit therefore copies the cached text and overwrites the
+// (zero) fractional second digits in place.  The cache is keyed on the local
+// datetime (i.e., the datetime *after* the offset was applied) and the
+// offset, as the text depends on both.
+
+#include <bdlt_iso8601utilconfiguration.h>
+
+#include <bsl_cstdio.h>    // for 'bsl::sprintf'
+#include <bsl_cstring.h>   // for 'bsl::memcpy', 'bsl::memchr'
+
+namespace BloombergLP {
+namespace ball {
+
+                       // ------------------------------
+                       // class CachedTimestampFormatter
+                       // ------------------------------
+
+// PRIVATE MANIPULATORS
+void CachedTimestampFormatter::loadCache(const bdlt::Datetime& second,
+                                         int                   offset)
+{
+    const bdlt::DatetimeTz timestamp(second, offset);
+
+    char buffer[64];
+    int  length = 0;
+
+    switch (d_format) {
+      case e_ISO_8601: {
+        bdlt::Iso8601UtilConfiguration config;
+
+        config.setFractionalSecondPrecision(d_precision);
+        config.setUseZAbbreviationForUtc(true);
+
+        length = bdlt::Iso8601Util::generateRaw(buffer, timestamp, config);
+      } break;
+      case e_BDE_PRINT: {
+        length = second.printToBuffer(buffer, sizeof buffer, d_precision);
+      } break;
+      case e_BDE_PRINT_WITH_OFFSET: {
+        length = second.printToBuffer(buffer, sizeof buffer, d_precision);
+
+        const char sign          = offset < 0 ? '-' : '+';
+        const int  absoluteValue = offset < 0 ? -offset : offset;
+        const int  hours         = absoluteValue / 60;
+        const int  minutes       = absoluteValue % 60;
+
+        // Although an offset greater than 24 hours is undefined behavior,
+        // such invalid 'DatetimeTz' objects still can be created under
+        // certain circumstances.  We want to enable clients to detect these
+        // errors as quickly as possible (DRQS 12693813).
+
+        if (hours < 100) {
+            length += bsl::sprintf(buffer + length,
+                                   "%c%02d%02d",
+                                   sign,
+                                   hours,
+                                   minutes);
+        }
+        else {
+            length += bsl::sprintf(buffer + length,
+                                   "%cXX%02d",
+                                   sign,
+                                   minutes);
+        }
+      } break;
+    }
+
+    BSLS_ASSERT(length <= k_MAX_LENGTH);
+
+    bsl::memcpy(d_text, buffer, length);
+
+    d_fractionIndex = 0;
+    if (d_precision) {
+        const char *dot = static_cast<const char *>(
+                                             bsl::memchr(buffer, '.', length));
+        BSLS_ASSERT(dot);
+
+        d_fractionIndex = static_cast<int>(dot - buffer) + 1;
+    }
+
+    d_second = second;
+    d_offset = offset;
+    d_length = length;
+}
+
+// MANIPULATORS
+int CachedTimestampFormatter::format(char                    *result,
+                                     const bdlt::DatetimeTz&  timestamp)
+{
+    BSLS_ASSERT(result);
+
+    const bdlt::Datetime& local = timestamp.localDatetime();
+
+    int hour;
+    int minute;
+    int second;
+    int millisecond;
+    int microsecond;
+
+    local.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    bdlt::Datetime key(local);
+    key.setTime(hour, minute, second);
+
+    if (0 == d_length || key != d_second || timestamp.offset() != d_offset) {
+        loadCache(key, timestamp.offset());
+    }
+
+    bsl::memcpy(result, d_text, d_length);
+
+    if (d_precision) {
+        int value = 3 == d_precision ? millisecond
+                                     : millisecond * 1000 + microsecond;
+
+        for (char *digit = result + d_fractionIndex + d_precision - 1;
+             digit >= result + d_fractionIndex;
+             --digit) {
+            *digit = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+
+    return d_length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
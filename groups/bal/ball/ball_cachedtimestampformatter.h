@@ -0,0 +1,250 @@
+// ball_cachedtimestampformatter.h                                    -*-C++-*-
+#ifndef INCLUDED_BALL_CACHEDTIMESTAMPFORMATTER
+#define INCLUDED_BALL_CACHEDTIMESTAMPFORMATTER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a timestamp formatter that caches the per-second text.
+//
+//@CLASSES:
+//  ball::CachedTimestampFormatter: formats timestamps, caching per second
+//
+//@SEE_ALSO: ball_recordstringformatter, ball_recordjsonformatter
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'ball::CachedTimestampFormatter', that renders a 'bdlt::DatetimeTz' value
+// as text in one of the timestamp formats used by the 'ball' record
+// formatters (see {Supported Formats}).  The text that depends only on the
+// date, the hour, the minute, the second, and the time zone offset of a
+// timestamp is computed once and cached, so that formatting a timestamp that
+// falls in the same second (and has the same offset) as the previously
+// formatted one requires only a copy of the cached text and the
+// interpolation of the fractional second digits.  Log records are typically
+// published in timestamp order, many of them within any given second, so the
+// cache is hit for the vast majority of records.
+//
+// The text produced by 'format' is identical to the text produced by the
+// corresponding 'bdlt' facilities ('bdlt::Datetime::printToBuffer' and
+// 'bdlt::Iso8601Util::generateRaw').  Note that, like those facilities, the
+// fractional second is truncated (not rounded) to the configured precision.
+//
+///Supported Formats
+///-----------------
+// The following table describes the supported formats and the text rendered
+// for a sample timestamp having a fractional second precision of 3 and an
+// offset of 0:
+//..
+//  Format                     Example
+//  -------------------------  ----------------------------
+//  e_BDE_PRINT                27AUG2007_16:09:46.161
+//  e_BDE_PRINT_WITH_OFFSET    27AUG2007_16:09:46.161+0000
+//  e_ISO_8601                 2007-08-27T16:09:46.161Z
+//..
+// Note that 'e_ISO_8601' uses the 'Z' abbreviation for a zero offset.
+//
+///Thread Safety
+///-------------
+// 'ball::CachedTimestampFormatter' is *not* thread-safe: 'format' modifies
+// the cache, so concurrent calls to 'format' on the same object must be
+// synchronized by the caller.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Timestamps
+/// - - - - - - - - - - - - - - - -
+// Suppose we want to render the timestamps of a stream of log records.
+//
+// First, we create a formatter that renders timestamps in the ISO 8601
+// format with millisecond precision:
+//..
+//  ball::CachedTimestampFormatter formatter(
+//                                  ball::CachedTimestampFormatter::e_ISO_8601,
+//                                  3);
+//..
+// Then, we format a timestamp into a buffer of sufficient size:
+//..
+//  char buffer[ball::CachedTimestampFormatter::k_MAX_LENGTH];
+//
+//  bdlt::DatetimeTz timestamp(bdlt::Datetime(2007, 8, 27, 16, 9, 46, 161),
+//                             0);
+//
+//  int length = formatter.format(buffer, timestamp);
+//  assert("2007-08-27T16:09:46.161Z" == bsl::string(buffer, length));
+//..
+// Finally, we format a timestamp that falls within the same second, which
+// merely updates the fractional second digits of the cached text:
+//..
+//  timestamp.setDatetimeTz(bdlt::Datetime(2007, 8, 27, 16, 9, 46, 987), 0);
+//
+//  length = formatter.format(buffer, timestamp);
+//  assert("2007-08-27T16:09:46.987Z" == bsl::string(buffer, length));
+//..
+
+#include <balscm_version.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_iso8601util.h>
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                       // ==============================
+                       // class CachedTimestampFormatter
+                       // ==============================
+
+class CachedTimestampFormatter {
+    // This mechanism class renders timestamps as text in one of a set of
+    // supported formats, caching the text of the most recently formatted
+    // second.
+
+  public:
+    // TYPES
+    enum Format {
+        // Enumeration used to distinguish among the supported timestamp
+        // formats.
+
+        e_BDE_PRINT             = 0,  // 'DDMonYYYY_HH:MM:SS.mmm'
+        e_BDE_PRINT_WITH_OFFSET = 1,  // 'DDMonYYYY_HH:MM:SS.mmm(+|-)HHMM'
+        e_ISO_8601              = 2   // 'YYYY-MM-DDTHH:MM:SS.mmm(+|-)HH:MM'
+    };
+
+    enum {
+        k_MAX_LENGTH = bdlt::Iso8601Util::k_DATETIMETZ_STRLEN
+                                    // maximum number of characters rendered
+                                    // by 'format' in any supported format
+    };
+
+  private:
+    // DATA
+    Format         d_format;          // format of the rendered text
+
+    int            d_precision;       // number of fractional second digits
+
+    bdlt::Datetime d_second;          // local datetime, truncated to the
+                                      // second, of the cached text
+
+    int            d_offset;          // time zone offset (in minutes) of the
+                                      // cached text
+
+    int            d_length;          // length of the cached text, or 0 if
+                                      // nothing is cached
+
+    int            d_fractionIndex;   // index of the first fractional second
+                                      // digit in the cached text
+
+    char           d_text[k_MAX_LENGTH];
+                                      // cached text
+
+    // PRIVATE MANIPULATORS
+    void loadCache(const bdlt::Datetime& second, int offset);
+        // Render to the cache the text of the specified 'second' having the
+        // specified time zone 'offset' (in minutes), and make them the key of
+        // the cache.  The behavior is undefined unless the fractional second
+        // of 'second' is 0.
+
+  public:
+    // CREATORS
+    CachedTimestampFormatter(Format format, int fractionalSecondPrecision);
+        // Create a timestamp formatter that renders timestamps in the
+        // specified 'format' having the specified
+        // 'fractionalSecondPrecision' digits of fractional second.  The
+        // behavior is undefined unless 'fractionalSecondPrecision' is 0, 3,
+        // or 6.
+
+    //! CachedTimestampFormatter(
+    //!                   const CachedTimestampFormatter& original) = default;
+        // Create a timestamp formatter having the format, the precision, and
+        // the cached text of the specified 'original' formatter.
+
+    //! ~CachedTimestampFormatter() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! CachedTimestampFormatter& operator=(
+    //!                        const CachedTimestampFormatter& rhs) = default;
+        // Assign to this object the format, the precision, and the cached
+        // text of the specified 'rhs' formatter, and return a reference
+        // providing modifiable access to this object.
+
+    int format(char *result, const bdlt::DatetimeTz& timestamp);
+        // Load into the specified 'result' buffer the text of the specified
+        // 'timestamp' in the format and with the fractional second precision
+        // supplied at construction, and return the number of characters
+        // written.  No null terminator is written.  The behavior is undefined
+        // unless 'result' refers to a buffer of at least 'k_MAX_LENGTH'
+        // characters.
+
+    // ACCESSORS
+    int fractionalSecondPrecision() const;
+        // Return the number of fractional second digits rendered by this
+        // formatter.
+
+    Format timestampFormat() const;
+        // Return the format in which this formatter renders timestamps.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class CachedTimestampFormatter
+                       // ------------------------------
+
+// CREATORS
+inline
+CachedTimestampFormatter::CachedTimestampFormatter(
+                                         Format format,
+                                         int    fractionalSecondPrecision)
+: d_format(format)
+, d_precision(fractionalSecondPrecision)
+, d_second()
+, d_offset(0)
+, d_length(0)
+, d_fractionIndex(0)
+{
+    BSLS_ASSERT(0 == fractionalSecondPrecision ||
+                3 == fractionalSecondPrecision ||
+                6 == fractionalSecondPrecision);
+}
+
+// ACCESSORS
+inline
+int CachedTimestampFormatter::fractionalSecondPrecision() const
+{
+    return d_precision;
+}
+
+inline
+CachedTimestampFormatter::Format
+CachedTimestampFormatter::timestampFormat() const
+{
+    return d_format;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
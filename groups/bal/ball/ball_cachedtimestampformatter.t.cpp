@@ -0,0 +1,526 @@
+// ball_cachedtimestampformatter.t.cpp                                -*-C++-*-
+#include <ball_cachedtimestampformatter.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that renders timestamps, caching
+// the text of the most recently formatted second.  The text it produces is
+// compared with the text produced, for the same timestamp, by the 'bdlt'
+// facilities that define each supported format, for sequences of timestamps
+// that hit and miss the cache.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] CachedTimestampFormatter(Format format, int precision);
+//
+// MANIPULATORS
+// [ 3] int format(char *result, const bdlt::DatetimeTz& timestamp);
+//
+// ACCESSORS
+// [ 2] int fractionalSecondPrecision() const;
+// [ 2] Format timestampFormat() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::CachedTimestampFormatter Obj;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string expectedText(Obj::Format             format,
+                         int                     precision,
+                         const bdlt::DatetimeTz& timestamp)
+    // Return the text of the specified 'timestamp' in the specified 'format'
+    // having the specified 'precision' fractional second digits, as rendered
+    // by the 'bdlt' facilities defining 'format'.
+{
+    char buffer[64];
+    int  length = 0;
+
+    switch (format) {
+      case Obj::e_ISO_8601: {
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(precision);
+        config.setUseZAbbreviationForUtc(true);
+
+        length = bdlt::Iso8601Util::generateRaw(buffer, timestamp, config);
+      } break;
+      case Obj::e_BDE_PRINT: {
+        length = timestamp.localDatetime().printToBuffer(buffer,
+                                                         sizeof buffer,
+                                                         precision);
+      } break;
+      case Obj::e_BDE_PRINT_WITH_OFFSET: {
+        length = timestamp.localDatetime().printToBuffer(buffer,
+                                                         sizeof buffer,
+                                                         precision);
+        const int offset = timestamp.offset();
+        length += bsl::sprintf(buffer + length,
+                               "%c%02d%02d",
+                               offset < 0 ? '-' : '+',
+                               bsl::abs(offset) / 60,
+                               bsl::abs(offset) % 60);
+      } break;
+    }
+    return bsl::string(buffer, length);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Timestamps
+/// - - - - - - - - - - - - - - - -
+// Suppose we want to render the timestamps of a stream of log records.
+//
+// First, we create a formatter that renders timestamps in the ISO 8601
+// format with millisecond precision:
+//..
+    ball::CachedTimestampFormatter formatter(
+                                    ball::CachedTimestampFormatter::e_ISO_8601,
+                                    3);
+//..
+// Then, we format a timestamp into a buffer of sufficient size:
+//..
+    char buffer[ball::CachedTimestampFormatter::k_MAX_LENGTH];
+
+    bdlt::DatetimeTz timestamp(bdlt::Datetime(2007, 8, 27, 16, 9, 46, 161),
+                               0);
+
+    int length = formatter.format(buffer, timestamp);
+    ASSERT("2007-08-27T16:09:46.161Z" == bsl::string(buffer, length));
+//..
+// Finally, we format a timestamp that falls within the same second, which
+// merely updates the fractional second digits of the cached text:
+//..
+    timestamp.setDatetimeTz(bdlt::Datetime(2007, 8, 27, 16, 9, 46, 987), 0);
+
+    length = formatter.format(buffer, timestamp);
+    ASSERT("2007-08-27T16:09:46.987Z" == bsl::string(buffer, length));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'format'
+        //
+        // Concerns:
+        //: 1 'format' renders the same text as the 'bdlt' facility defining
+        //:   each supported format, for each supported precision.
+        //:
+        //: 2 The fractional second is truncated, not rounded.
+        //:
+        //: 3 A timestamp in a different second, or having a different offset,
+        //:   than the previously formatted one is rendered correctly,
+        //:   whether the second is later or earlier, and whether the date
+        //:   changes.
+        //:
+        //: 4 Timestamps within the same second as the previously formatted
+        //:   one are rendered correctly.
+        //:
+        //: 5 The default 'bdlt::Datetime' value ('24:00:00') is rendered
+        //:   correctly.
+        //:
+        //: 6 The number of characters written does not exceed
+        //:   'k_MAX_LENGTH', and no character beyond the returned length is
+        //:   written.
+        //
+        // Plan:
+        //: 1 For each supported format and precision, format, using a single
+        //:   object, a sequence of timestamps and offsets designed to hit and
+        //:   miss the cache in the ways described in the concerns, and
+        //:   compare the result with the text produced by the corresponding
+        //:   'bdlt' facility.  (C-1..5)
+        //:
+        //: 2 Fill the buffer with a sentinel before each call and verify that
+        //:   the characters after the returned length are untouched.  (C-6)
+        //
+        // Testing:
+        //   int format(char *result, const bdlt::DatetimeTz& timestamp);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'format'" << endl
+                                  << "========" << endl;
+
+        static const struct {
+            int d_line;
+            int d_year;
+            int d_month;
+            int d_day;
+            int d_hour;
+            int d_minute;
+            int d_second;
+            int d_msec;
+            int d_usec;
+            int d_offset;
+        } DATA[] = {
+            //LINE  YEAR  MO  DAY  HR  MI  SE  MSEC  USEC  OFFSET
+            //----  ----  --  ---  --  --  --  ----  ----  ------
+            { L_,   2007,  8,  27, 16,  9, 46,  161,  324,      0 },
+            { L_,   2007,  8,  27, 16,  9, 46,  161,  999,      0 },
+            { L_,   2007,  8,  27, 16,  9, 46,  999,  999,      0 },
+            { L_,   2007,  8,  27, 16,  9, 46,    0,    0,      0 },
+            { L_,   2007,  8,  27, 16,  9, 46,    0,    1,      0 },
+            { L_,   2007,  8,  27, 16,  9, 47,    5,    7,      0 },
+            { L_,   2007,  8,  27, 16,  9, 47,   50,   70,      0 },
+            { L_,   2007,  8,  27, 16,  9, 45,  500,    0,      0 },
+            { L_,   2007,  8,  27, 16,  9, 45,  500,    0,    -60 },
+            { L_,   2007,  8,  27, 16,  9, 45,  501,    0,    -60 },
+            { L_,   2007,  8,  27, 16,  9, 45,  502,    0,    330 },
+            { L_,   2007,  8,  27, 16,  9, 45,  503,    0,      0 },
+            { L_,   2007,  8,  27, 23, 59, 59,  999,  999,      0 },
+            { L_,   2007,  8,  28,  0,  0,  0,    0,    0,      0 },
+            { L_,   2007,  8,  28,  0,  0,  0,    1,    0,      0 },
+            { L_,   2023, 12,  31, 23, 59, 59,  123,  456,   1439 },
+            { L_,   2023, 12,  31, 23, 59, 59,  124,  456,  -1439 },
+            { L_,      1,  1,   1,  0,  0,  0,    0,    0,      0 },
+            { L_,   9999, 12,  31, 23, 59, 59,  999,  999,      0 },
+            { L_,   9999, 12,  31, 23, 59, 59,  999,  998,      0 },
+            { L_,     -1,  0,   0,  0,  0,  0,    0,    0,      0 },
+            { L_,   2007,  8,  27, 16,  9, 46,  161,  324,     90 },
+            { L_,   2007,  8,  27, 16,  9, 46,  161,  324,      0 },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        static const Obj::Format FORMATS[] = {
+            Obj::e_BDE_PRINT,
+            Obj::e_BDE_PRINT_WITH_OFFSET,
+            Obj::e_ISO_8601
+        };
+        enum { NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS };
+
+        static const int PRECISIONS[] = { 0, 3, 6 };
+        enum { NUM_PRECISIONS = sizeof PRECISIONS / sizeof *PRECISIONS };
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj::Format FORMAT = FORMATS[fi];
+
+            for (int pi = 0; pi < NUM_PRECISIONS; ++pi) {
+                const int PRECISION = PRECISIONS[pi];
+
+                Obj mX(FORMAT, PRECISION);
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int LINE = DATA[ti].d_line;
+
+                    const bdlt::Datetime DATETIME = -1 == DATA[ti].d_year
+                        ? bdlt::Datetime()
+                        : bdlt::Datetime(DATA[ti].d_year,
+                                         DATA[ti].d_month,
+                                         DATA[ti].d_day,
+                                         DATA[ti].d_hour,
+                                         DATA[ti].d_minute,
+                                         DATA[ti].d_second,
+                                         DATA[ti].d_msec,
+                                         DATA[ti].d_usec);
+
+                    const bdlt::DatetimeTz TIMESTAMP(DATETIME,
+                                                     DATA[ti].d_offset);
+
+                    const bsl::string EXPECTED = expectedText(FORMAT,
+                                                              PRECISION,
+                                                              TIMESTAMP);
+
+                    char buffer[Obj::k_MAX_LENGTH + 8];
+                    bsl::memset(buffer, '#', sizeof buffer);
+
+                    const int length = mX.format(buffer, TIMESTAMP);
+
+                    const bsl::string ACTUAL(buffer, length);
+
+                    if (veryVerbose) {
+                        T_ P_(LINE) P_(FORMAT) P_(PRECISION) P(ACTUAL)
+                    }
+
+                    ASSERTV(LINE, FORMAT, PRECISION, EXPECTED, ACTUAL,
+                            EXPECTED == ACTUAL);
+                    ASSERTV(LINE, length, length <= Obj::k_MAX_LENGTH);
+
+                    for (int i = length; i < (int)sizeof buffer; ++i) {
+                        ASSERTV(LINE, i, '#' == buffer[i]);
+                    }
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor creates an object having the specified format
+        //:   and precision, which are returned by the accessors.
+        //:
+        //: 2 The accessors are declared 'const'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an object for each supported format and precision, and
+        //:   verify the accessors through a 'const' reference.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an unsupported precision.  (C-3)
+        //
+        // Testing:
+        //   CachedTimestampFormatter(Format format, int precision);
+        //   int fractionalSecondPrecision() const;
+        //   Format timestampFormat() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CTOR AND ACCESSORS" << endl
+                                  << "==================" << endl;
+
+        static const Obj::Format FORMATS[] = {
+            Obj::e_BDE_PRINT,
+            Obj::e_BDE_PRINT_WITH_OFFSET,
+            Obj::e_ISO_8601
+        };
+        enum { NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS };
+
+        static const int PRECISIONS[] = { 0, 3, 6 };
+        enum { NUM_PRECISIONS = sizeof PRECISIONS / sizeof *PRECISIONS };
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            for (int pi = 0; pi < NUM_PRECISIONS; ++pi) {
+                Obj mX(FORMATS[fi], PRECISIONS[pi]); const Obj& X = mX;
+
+                ASSERTV(fi, pi, FORMATS[fi]    == X.timestampFormat());
+                ASSERTV(fi, pi, PRECISIONS[pi] ==
+                                                X.fractionalSecondPrecision());
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::e_ISO_8601,  0));
+            ASSERT_PASS(Obj(Obj::e_ISO_8601,  3));
+            ASSERT_PASS(Obj(Obj::e_ISO_8601,  6));
+            ASSERT_FAIL(Obj(Obj::e_ISO_8601, -1));
+            ASSERT_FAIL(Obj(Obj::e_ISO_8601,  1));
+            ASSERT_FAIL(Obj(Obj::e_ISO_8601,  7));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few timestamps in each format.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        char buffer[Obj::k_MAX_LENGTH];
+
+        const bdlt::DatetimeTz T1(bdlt::Datetime(2007, 8, 27, 16, 9, 46, 161),
+                                  0);
+        const bdlt::DatetimeTz T2(bdlt::Datetime(2007, 8, 27, 16, 9, 46, 162),
+                                  0);
+        const bdlt::DatetimeTz T3(bdlt::Datetime(2007, 8, 27, 16, 9, 47, 3),
+                                  -300);
+
+        {
+            Obj mX(Obj::e_BDE_PRINT, 3);
+
+            int length = mX.format(buffer, T1);
+            ASSERTV(bsl::string(buffer, length),
+                    "27AUG2007_16:09:46.161" == bsl::string(buffer, length));
+
+            length = mX.format(buffer, T2);
+            ASSERTV(bsl::string(buffer, length),
+                    "27AUG2007_16:09:46.162" == bsl::string(buffer, length));
+
+            length = mX.format(buffer, T3);
+            ASSERTV(bsl::string(buffer, length),
+                    "27AUG2007_16:09:47.003" == bsl::string(buffer, length));
+        }
+        {
+            Obj mX(Obj::e_BDE_PRINT_WITH_OFFSET, 3);
+
+            int length = mX.format(buffer, T1);
+            ASSERTV(bsl::string(buffer, length),
+                    "27AUG2007_16:09:46.161+0000" ==
+                                                 bsl::string(buffer, length));
+
+            length = mX.format(buffer, T3);
+            ASSERTV(bsl::string(buffer, length),
+                    "27AUG2007_16:09:47.003-0500" ==
+                                                 bsl::string(buffer, length));
+        }
+        {
+            Obj mX(Obj::e_ISO_8601, 0);
+
+            int length = mX.format(buffer, T1);
+            ASSERTV(bsl::string(buffer, length),
+                    "2007-08-27T16:09:46Z" == bsl::string(buffer, length));
+
+            length = mX.format(buffer, T3);
+            ASSERTV(bsl::string(buffer, length),
+                    "2007-08-27T16:09:47-05:00" ==
+                                                 bsl::string(buffer, length));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,23 +4,48 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ball_categorymanager_cpp,"$Id$ $CSID$")
 
+///Implementation Notes
+///--------------------
+// The registry of categories is held by a 'CategoryManager_Registry' object
+// that is published through an atomic pointer.  Readers load the pointer and
+// access the registry without locking.  Writers, serialized by
+// 'd_registryMutex', append a category to the current registry, first
+// storing the category in its slots and then publishing it by incrementing
+// the length of the registry (with release semantics).  When the current
+// registry is full, a copy having twice the capacity is created, published,
+// and given ownership of the registry it replaces.
+//
+// As categories are never removed, a registry is only ever replaced (never
+// modified in a way a reader could observe partially), and a replaced
+// registry must remain valid for readers that may still refer to it.  Rather
+// than reclaiming replaced registries as soon as no reader refers to them
+// (which would require readers to announce themselves, e.g., by an epoch
+// scheme), replaced registries are reclaimed when the category manager is
+// destroyed.  Since the capacity doubles, the memory held by replaced
+// registries is less than the memory held by the current one.
+//
+// The name index is an open-addressed hash table with linear probing whose
+// number of slots is twice the capacity of the registry, so that probing
+// always terminates at an empty slot.  The index refers to the name held by
+// each category, so that lookup by 'bsl::string_view' requires neither a copy
+// of the name nor a null-terminated string.
+
 #include <ball_severity.h>
 #include <ball_thresholdaggregate.h>
 
 #include <bdlb_bitutil.h>
 
+#include <bslh_spookyhashalgorithm.h>
+
 #include <bslmt_lockguard.h>
-#include <bslmt_readlockguard.h>
-#include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomicoperations.h>
 #include <bsls_platform.h>
 
 #include <bsl_algorithm.h>
-#include <bsl_map.h>
+#include <bsl_cstring.h>
 #include <bsl_utility.h>
-#include <bsl_vector.h>
 
 // Note: on Windows -> WinDef.h:#define max(a,b) ...
 #if defined(BSLS_PLATFORM_CMP_MSVC) && defined(max)
@@ -47,15 +72,9 @@ class CategoryProctor {
     // This class facilitates exception neutrality by proctoring memory
     // management for 'Category' objects.
 
-    // PRIVATE TYPES
-    typedef bsl::vector<ball::Category *> CategoryVector;
-
     // DATA
     Category         *d_category_p;    // category object to delete on failure
 
-    CategoryVector   *d_categories_p;  // category collection to rollback on
-                                       // failure
-
     bslma::Allocator *d_allocator_p;   // allocator for the category object
 
   private:
@@ -75,10 +94,6 @@ class CategoryProctor {
         // Rollback the owned objects to their initial state on failure.
 
     // MANIPULATORS
-    void setCategories(CategoryVector *categories);
-        // Take ownership of the 'categories' object to roll it back on
-        // failure.
-
     void release();
         // Release the ownership of all objects currently managed by this
         // proctor.
@@ -93,7 +108,6 @@ inline
 CategoryProctor::CategoryProctor(Category         *category,
                                  bslma::Allocator *allocator)
 : d_category_p(category)
-, d_categories_p(0)
 , d_allocator_p(allocator)
 {
 }
@@ -105,27 +119,125 @@ CategoryProctor::~CategoryProctor()
         d_category_p->~Category();
         d_allocator_p->deallocate(d_category_p);
     }
-
-    if (d_categories_p) {
-        d_categories_p->pop_back();
-    }
 }
 
 // MANIPULATORS
 inline
-void CategoryProctor::setCategories(CategoryVector *categories)
+void CategoryProctor::release()
 {
-    d_categories_p = categories;
+    d_category_p = 0;
 }
 
-inline
-void CategoryProctor::release()
+}  // close unnamed namespace
+
+                      // ------------------------------
+                      // class CategoryManager_Registry
+                      // ------------------------------
+
+// PRIVATE CLASS METHODS
+bsl::size_t CategoryManager_Registry::hash(const bsl::string_view& name)
 {
-    d_category_p   = 0;
-    d_categories_p = 0;
+    bslh::SpookyHashAlgorithm hashAlgorithm;
+    hashAlgorithm(name.data(), name.length());
+    return static_cast<bsl::size_t>(hashAlgorithm.computeHash());
 }
 
-}  // close unnamed namespace
+// CREATORS
+CategoryManager_Registry::CategoryManager_Registry(
+                                    int                       capacity,
+                                    CategoryManager_Registry *previous,
+                                    bslma::Allocator         *basicAllocator)
+: d_length(0)
+, d_capacity(capacity)
+, d_slots_p(static_cast<Slot *>(basicAllocator->allocate(
+                                            2 * capacity * sizeof(Slot)
+                                          + capacity * sizeof(Category *))))
+, d_categories_p(reinterpret_cast<Category **>(d_slots_p + 2 * capacity))
+, d_previous_p(0)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+    BSLS_ASSERT(!previous || previous->length() < capacity);
+
+    for (int i = 0; i < 2 * capacity; ++i) {
+        new (d_slots_p + i) Slot();
+    }
+
+    if (previous) {
+        const int length = previous->length();
+        for (int i = 0; i < length; ++i) {
+            append(previous->category(i));
+        }
+    }
+
+    d_previous_p = previous;
+}
+
+CategoryManager_Registry::~CategoryManager_Registry()
+{
+    // 'Slot' is trivially destructible.
+
+    d_allocator_p->deallocate(d_slots_p);
+
+    if (d_previous_p) {
+        d_previous_p->~CategoryManager_Registry();
+        d_allocator_p->deallocate(d_previous_p);
+    }
+}
+
+// MANIPULATORS
+void CategoryManager_Registry::append(Category *category)
+{
+    BSLS_ASSERT(category);
+
+    const int length = d_length.loadRelaxed();
+
+    BSLS_ASSERT(length < d_capacity);
+
+    const bsl::string_view name(category->categoryName());
+    const bsl::size_t      hashValue = hash(name);
+    const bsl::size_t      mask      = 2 * d_capacity - 1;
+
+    bsl::size_t index = hashValue & mask;
+    while (d_slots_p[index].d_category.loadRelaxed()) {
+        index = (index + 1) & mask;
+    }
+
+    d_categories_p[length]          = category;
+    d_slots_p[index].d_hash         = hashValue;
+    d_slots_p[index].d_nameLength   = name.length();
+    d_slots_p[index].d_category.storeRelease(category);
+
+    d_length.storeRelease(length + 1);
+}
+
+// ACCESSORS
+Category *CategoryManager_Registry::find(const bsl::string_view& name) const
+{
+    const bsl::size_t hashValue = hash(name);
+    const bsl::size_t mask      = 2 * d_capacity - 1;
+
+    bsl::size_t index    = hashValue & mask;
+    Category   *category = d_slots_p[index].d_category.loadAcquire();
+
+    while (category) {
+        const Slot& slot = d_slots_p[index];
+
+        if (slot.d_hash       == hashValue
+         && slot.d_nameLength == name.length()
+         && 0 == bsl::memcmp(category->categoryName(),
+                             name.data(),
+                             name.length())) {
+            return category;                                          // RETURN
+        }
+
+        index    = (index + 1) & mask;
+        category = d_slots_p[index].d_category.loadAcquire();
+    }
+
+    return 0;
+}
 
                     // ---------------------
                     // class CategoryManager
@@ -140,6 +252,8 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
 {
     // Create a new category and add it to the category registry.
 
+    enum { k_INITIAL_CAPACITY = 16 };
+
     Category *category = new (*d_allocator_p) Category(categoryName,
                                                        recordLevel,
                                                        passLevel,
@@ -148,11 +262,20 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
                                                        d_allocator_p);
     CategoryProctor proctor(category, d_allocator_p);  // rollback on exception
 
-    d_categories.push_back(category);
-    proctor.setCategories(&d_categories);
+    CategoryManager_Registry *registry = d_registry.loadRelaxed();
+
+    if (!registry || registry->length() == registry->capacity()) {
+        const int capacity = registry ? 2 * registry->capacity()
+                                      : k_INITIAL_CAPACITY;
 
-    d_registry[category->categoryName()] =
-                                     static_cast<int>(d_categories.size() - 1);
+        registry = new (*d_allocator_p) CategoryManager_Registry(
+                                                               capacity,
+                                                               registry,
+                                                               d_allocator_p);
+        d_registry.storeRelease(registry);
+    }
+
+    registry->append(category);
     proctor.release();
 
     return category;
@@ -160,11 +283,10 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
 
 // CREATORS
 CategoryManager::CategoryManager(bslma::Allocator *basicAllocator)
-: d_registry(1, bdlb::CStringHash(), bdlb::CStringEqualTo(), basicAllocator)
+: d_registry(0)
 , d_ruleSetSequenceNumber(
       AtomicOps::incrementInt64Nv(&categoryManagerSequenceNumber) << 48)
 , d_ruleSet(bslma::Default::allocator(basicAllocator))
-, d_categories(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -173,9 +295,18 @@ CategoryManager::~CategoryManager()
 {
     BSLS_ASSERT(d_allocator_p);
 
-    for (int i = 0; i < length(); ++i) {
-        d_categories[i]->~Category();
-        d_allocator_p->deallocate(d_categories[i]);
+    CategoryManager_Registry *registry = d_registry.loadRelaxed();
+
+    if (registry) {
+        for (int i = 0; i < registry->length(); ++i) {
+            Category *category = registry->category(i);
+
+            category->~Category();
+            d_allocator_p->deallocate(category);
+        }
+
+        registry->~CategoryManager_Registry();
+        d_allocator_p->deallocate(registry);
     }
 }
 
@@ -210,12 +341,9 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
         return 0;                                                     // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
+    bslmt::LockGuard<bslmt::Mutex> registryGuard(&d_registryMutex);
 
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-
-    if (iter != d_registry.end()) {
+    if (lookupCategory(categoryName)) {
         return 0;                                                     // RETURN
     }
     else {
@@ -250,8 +378,9 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
             }
         }
 
-        // We have a write lock on 'd_registryLock', so the supplied category
-        // holder is the only holder for the created category.
+        // The supplied category holder was linked to the created category
+        // while 'd_registryMutex' was locked, so it is the only holder for the
+        // created category.
 
         if (categoryHolder) {
             categoryHolder->setThreshold(bsl::max(category->threshold(),
@@ -264,30 +393,31 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
 
 Category *CategoryManager::lookupCategory(const char *categoryName)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
+    BSLS_ASSERT(categoryName);
 
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    return iter != d_registry.end() ? d_categories[iter->second] : 0;
+    return lookupCategory(bsl::string_view(categoryName));
+}
+
+Category *CategoryManager::lookupCategory(
+                                        const bsl::string_view& categoryName)
+{
+    const CategoryManager_Registry *registry = d_registry.loadAcquire();
+
+    return registry ? registry->find(categoryName) : 0;
 }
 
 Category *CategoryManager::lookupCategory(CategoryHolder *categoryHolder,
                                           const char     *categoryName)
 {
-    d_registryLock.lockReadReserveWrite();
+    Category *category = lookupCategory(categoryName);
 
-    bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                           &d_registryLock, 1);
+    if (category && categoryHolder && !categoryHolder->category()) {
+        // 'linkCategoryHolder' has no effect if 'categoryHolder' was linked
+        // concurrently.
 
-    Category *category = 0;
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    if (iter != d_registry.end()) {
-        category = d_categories[iter->second];
-        if (categoryHolder && !categoryHolder->category()) {
-            d_registryLock.upgradeToWriteLock();
-            CategoryManagerImpUtil::linkCategoryHolder(category,
-                                                       categoryHolder);
-        }
+        bslmt::LockGuard<bslmt::Mutex> registryGuard(&d_registryMutex);
+
+        CategoryManagerImpUtil::linkCategoryHolder(category, categoryHolder);
     }
 
     return category;
@@ -300,7 +430,7 @@ void CategoryManager::resetCategoryHolders()
 
     const int numCategories = length();
     for (int i = 0; i < numCategories; ++i) {
-        CategoryManagerImpUtil::resetCategoryHolders(d_categories[i]);
+        CategoryManagerImpUtil::resetCategoryHolders(&(*this)[i]);
     }
 }
 
@@ -319,12 +449,10 @@ Category *CategoryManager::setThresholdLevels(const char *categoryName,
         return 0;                                                     // RETURN
     }
 
-    d_registryLock.lockReadReserveWrite();
-    bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                           &d_registryLock, 1);
-    CategoryMap::iterator iter = d_registry.find(categoryName);
-    if (iter != d_registry.end()) {
-        Category *category = d_categories[iter->second];
+    bslmt::LockGuard<bslmt::Mutex> registryGuard(&d_registryMutex);
+
+    Category *category = lookupCategory(categoryName);
+    if (category) {
         category->setLevels(recordLevel,
                             passLevel,
                             triggerLevel,
@@ -333,15 +461,13 @@ Category *CategoryManager::setThresholdLevels(const char *categoryName,
         return category;                                              // RETURN
     }
     else {
-        d_registryLock.upgradeToWriteLock();
+        category = addNewCategory(categoryName,
+                                  recordLevel,
+                                  passLevel,
+                                  triggerLevel,
+                                  triggerAllLevel);
+        registryGuard.release()->unlock();
 
-        Category *category = addNewCategory(categoryName,
-                                            recordLevel,
-                                            passLevel,
-                                            triggerLevel,
-                                            triggerAllLevel);
-        registryGuard.release();
-        d_registryLock.unlock();
         bslmt::LockGuard<bslmt::Mutex> ruleSetGuard(&d_ruleSetMutex);
 
         for (int i = 0; i < RuleSet::maxNumRules(); ++i) {
@@ -380,8 +506,12 @@ int CategoryManager::addRule(const Rule& value)
 
     const Rule *rule = d_ruleSet.getRuleById(ruleId);
 
-    for (int i = 0; i < length(); ++i) {
-        Category *category = d_categories[i];
+    // Categories added after 'numCategories' is loaded apply the rule set
+    // themselves, once they acquire 'd_ruleSetMutex'.
+
+    const int numCategories = length();
+    for (int i = 0; i < numCategories; ++i) {
+        Category *category = &(*this)[i];
         if (rule->isMatch(category->categoryName())) {
             CategoryManagerImpUtil::enableRule(category, ruleId);
             int threshold = ThresholdAggregate::maxLevel(
@@ -423,8 +553,9 @@ int CategoryManager::removeRule(const Rule& value)
 
     const Rule *rule = d_ruleSet.getRuleById(ruleId);
 
-    for (int i = 0; i < length(); ++i) {
-        Category *category = d_categories[i];
+    const int numCategories = length();
+    for (int i = 0; i < numCategories; ++i) {
+        Category *category = &(*this)[i];
         if (rule->isMatch(category->categoryName())) {
             CategoryManagerImpUtil::disableRule(category, ruleId);
             CategoryManagerImpUtil::setRuleThreshold(category, 0);
@@ -475,11 +606,13 @@ void CategoryManager::removeAllRules()
 
     ++d_ruleSetSequenceNumber;
 
-    for (int i = 0; i < length(); ++i) {
-        if (d_categories[i]->relevantRuleMask()) {
-            CategoryManagerImpUtil::setRelevantRuleMask(d_categories[i], 0);
-            CategoryManagerImpUtil::setRuleThreshold(d_categories[i], 0);
-            CategoryManagerImpUtil::updateThresholdForHolders(d_categories[i]);
+    const int numCategories = length();
+    for (int i = 0; i < numCategories; ++i) {
+        Category *category = &(*this)[i];
+        if (category->relevantRuleMask()) {
+            CategoryManagerImpUtil::setRelevantRuleMask(category, 0);
+            CategoryManagerImpUtil::setRuleThreshold(category, 0);
+            CategoryManagerImpUtil::updateThresholdForHolders(category);
         }
     }
     d_ruleSet.removeAllRules();
@@ -488,11 +621,17 @@ void CategoryManager::removeAllRules()
 // ACCESSORS
 const Category *CategoryManager::lookupCategory(const char *categoryName) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
+    BSLS_ASSERT(categoryName);
+
+    return lookupCategory(bsl::string_view(categoryName));
+}
+
+const Category *CategoryManager::lookupCategory(
+                                   const bsl::string_view& categoryName) const
+{
+    const CategoryManager_Registry *registry = d_registry.loadAcquire();
 
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    return iter != d_registry.end() ? d_categories[iter->second] : 0;
+    return registry ? registry->find(categoryName) : 0;
 }
 
 }  // close package namespace
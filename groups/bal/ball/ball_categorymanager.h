@@ -48,6 +48,17 @@ BSLS_IDENT("$Id: $")
 // same instance can be safely invoked from any thread concurrently with any
 // other operation.
 //
+///Performance
+///-----------
+// Looking up a category by name, accessing a category by index, and
+// iterating over the categories in the registry do not acquire any lock, so
+// that they scale with the number of threads concurrently logging (in
+// particular, threads resolving dynamic categories on every log statement).
+// Adding a category is serialized with the addition of other categories, but
+// not with lookups.  A lookup supplied a 'bsl::string_view' does not allocate
+// memory: the name index refers to the name held by each category rather
+// than to a copy of it.
+//
 ///Usage
 ///-----
 // The code fragments in the following example illustrate some basic operations
@@ -160,27 +171,119 @@ BSLS_IDENT("$Id: $")
 #include <ball_ruleset.h>
 #include <ball_thresholdaggregate.h>
 
-#include <bdlb_cstringequalto.h>
-#include <bdlb_cstringhash.h>
-
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 
 #include <bslmt_mutex.h>
-#include <bslmt_readlockguard.h>
-#include <bslmt_readerwriterlock.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_new.h>
 #include <bsl_string.h>
-#include <bsl_unordered_map.h>
-#include <bsl_vector.h>
+#include <bsl_string_view.h>
 
 namespace BloombergLP {
 namespace ball {
 
+                      // ==============================
+                      // class CategoryManager_Registry
+                      // ==============================
+
+class CategoryManager_Registry {
+    // This component-private class provides a fixed-capacity snapshot of the
+    // category registry of a 'CategoryManager': the sequence of categories in
+    // the order in which they were added, and an open-addressed index mapping
+    // category names to categories.  A single writer (serialized by the
+    // category manager) may append categories, while any number of readers
+    // concurrently access the categories and look up names without locking.
+    // Once full, a registry is not modified; the category manager instead
+    // replaces it with a larger copy, which takes ownership of the registry
+    // it replaces (so that the replaced registry remains valid for readers
+    // that loaded it concurrently).
+
+    // PRIVATE TYPES
+    struct Slot {
+        // An entry of the name index.
+
+        bsls::AtomicPointer<Category> d_category;    // category, or 0 if the
+                                                     // slot is empty
+
+        bsl::size_t                   d_hash;        // hash of the name of
+                                                     // 'd_category'
+
+        bsl::size_t                   d_nameLength;  // length of the name of
+                                                     // 'd_category'
+    };
+
+    // DATA
+    bsls::AtomicInt           d_length;        // number of categories
+
+    int                       d_capacity;      // maximum number of categories
+
+    Slot                     *d_slots_p;       // name index, having
+                                               // '2 * d_capacity' slots
+
+    Category                **d_categories_p;  // categories, in the order in
+                                               // which they were added
+
+    CategoryManager_Registry *d_previous_p;    // registry replaced by this
+                                               // one, or 0 (owned)
+
+    bslma::Allocator         *d_allocator_p;   // memory allocator (held, not
+                                               // owned)
+
+    // NOT IMPLEMENTED
+    CategoryManager_Registry(const CategoryManager_Registry&);
+    CategoryManager_Registry& operator=(const CategoryManager_Registry&);
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t hash(const bsl::string_view& name);
+        // Return the hash value of the specified 'name'.
+
+  public:
+    // CREATORS
+    CategoryManager_Registry(int                       capacity,
+                             CategoryManager_Registry *previous,
+                             bslma::Allocator         *basicAllocator);
+        // Create a registry able to hold the specified 'capacity' categories,
+        // holding the categories of the specified 'previous' registry (if
+        // any), and take ownership of 'previous'.  Use the specified
+        // 'basicAllocator' to supply memory.  The behavior is undefined
+        // unless 'capacity' is a power of 2 greater than the length of
+        // 'previous', and 'previous' (if not 0) was allocated by
+        // 'basicAllocator'.
+
+    ~CategoryManager_Registry();
+        // Destroy this registry and the registry it replaced (if any).  Note
+        // that the categories held by this registry are not destroyed.
+
+    // MANIPULATORS
+    void append(Category *category);
+        // Append the specified 'category' to this registry.  The behavior is
+        // undefined unless 'length() < capacity()', no category in this
+        // registry has the same name as 'category', and calls to this method
+        // are serialized.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of categories this registry can hold.
+
+    Category *category(int index) const;
+        // Return the address of the category at the specified 'index' in this
+        // registry.  The behavior is undefined unless
+        // '0 <= index < length()'.
+
+    Category *find(const bsl::string_view& name) const;
+        // Return the address of the category having the specified 'name' in
+        // this registry, or 0 if no such category exists.
+
+    int length() const;
+        // Return the number of categories in this registry.
+};
+
                         // =====================
                         // class CategoryManager
                         // =====================
@@ -191,17 +294,12 @@ class CategoryManager {
     // threshold levels of existing categories may be accessed and modified
     // directly.
 
-    // TYPES
-    typedef bsl::unordered_map<const char *,
-                               int,
-                               bdlb::CStringHash,
-                               bdlb::CStringEqualTo>
-        CategoryMap;
-
     // DATA
-    CategoryMap                      d_registry;      // mapping names to
-                                                      // indices in
-                                                      // 'd_categories'
+    bsls::AtomicPointer<CategoryManager_Registry>
+                                     d_registry;      // current registry of
+                                                      // categories, or 0 if
+                                                      // none were added
+                                                      // (owned)
 
     bsls::AtomicInt64                d_ruleSetSequenceNumber;
                                                       // sequence number that
@@ -215,11 +313,9 @@ class CategoryManager {
     bslmt::Mutex                     d_ruleSetMutex;  // serialize access to
                                                       // 'd_ruleset'
 
-    bsl::vector<Category *>          d_categories;    // providing random
-                                                      // access to categories
-
-    mutable bslmt::ReaderWriterLock  d_registryLock;  // ensuring MT-safety of
-                                                      // category map
+    bslmt::Mutex                     d_registryMutex; // serialize
+                                                      // modifications of the
+                                                      // registry
 
     bslma::Allocator                *d_allocator_p;   // memory allocator
                                                       // (held, not owned)
@@ -240,10 +336,9 @@ class CategoryManager {
         // 'passLevel', 'triggerLevel', and 'triggerAllLevel' threshold values,
         // respectively.  Return the address of the newly-created, modifiable
         // category.  The behavior is undefined unless a category having
-        // 'categoryName' does not already exist in the registry and each of
-        // the specified threshold values is in the range '[0 .. 255]'.  Note
-        // that the category registry should be properly synchronized before
-        // calling this method.
+        // 'categoryName' does not already exist in the registry, each of the
+        // specified threshold values is in the range '[0 .. 255]', and a lock
+        // is held by this thread on 'd_registryMutex'.
 
   public:
     // CREATORS
@@ -298,9 +393,11 @@ class CategoryManager {
         // already exists in the registry, 0 is returned.
 
     Category *lookupCategory(const char *categoryName);
+    Category *lookupCategory(const bsl::string_view& categoryName);
         // Return the address of the modifiable category having the specified
         // 'categoryName' in the registry of this category manager, or 0 if no
-        // such category exists.
+        // such category exists.  Note that this method does not acquire a
+        // lock, and does not allocate memory.
 
     Category *lookupCategory(CategoryHolder *categoryHolder,
                              const char     *categoryName);
@@ -397,9 +494,11 @@ class CategoryManager {
         // manager.
 
     const Category *lookupCategory(const char *categoryName) const;
+    const Category *lookupCategory(const bsl::string_view& categoryName) const;
         // Return the address of the non-modifiable category having the
         // specified 'categoryName' in the registry of this category manager,
-        // or 0 if no such category exists.
+        // or 0 if no such category exists.  Note that this method does not
+        // acquire a lock, and does not allocate memory.
 
     const RuleSet& ruleSet() const;
         // Return a 'const' reference to the rule set maintained by this
@@ -536,6 +635,32 @@ class CategoryManagerManip {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                      // ------------------------------
+                      // class CategoryManager_Registry
+                      // ------------------------------
+
+// ACCESSORS
+inline
+int CategoryManager_Registry::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+Category *CategoryManager_Registry::category(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < length());
+
+    return d_categories_p[index];
+}
+
+inline
+int CategoryManager_Registry::length() const
+{
+    return d_length.loadAcquire();
+}
+
                         // ---------------------
                         // class CategoryManager
                         // ---------------------
@@ -544,8 +669,7 @@ class CategoryManagerManip {
 inline
 Category& CategoryManager::operator[](int index)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return *d_categories[index];
+    return *d_registry.loadAcquire()->category(index);
 }
 
 inline
@@ -557,11 +681,12 @@ bslmt::Mutex& CategoryManager::rulesetMutex()
 template <class t_CATEGORY_VISITOR>
 void CategoryManager::visitCategories(const t_CATEGORY_VISITOR& visitor)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    for (bsl::vector<Category *>::iterator it = d_categories.begin();
-         it != d_categories.end();
-         ++it) {
-        visitor(*it);
+    const CategoryManager_Registry *registry = d_registry.loadAcquire();
+    if (registry) {
+        const int length = registry->length();
+        for (int i = 0; i < length; ++i) {
+            visitor(registry->category(i));
+        }
     }
 }
 
@@ -569,15 +694,14 @@ void CategoryManager::visitCategories(const t_CATEGORY_VISITOR& visitor)
 inline
 int CategoryManager::length() const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return static_cast<int>(d_categories.size());
+    const CategoryManager_Registry *registry = d_registry.loadAcquire();
+    return registry ? registry->length() : 0;
 }
 
 inline
 const Category& CategoryManager::operator[](int index) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return *d_categories[index];
+    return *d_registry.loadAcquire()->category(index);
 }
 
 inline
@@ -595,11 +719,13 @@ bsls::Types::Int64 CategoryManager::ruleSetSequenceNumber() const
 template <class t_CATEGORY_VISITOR>
 void CategoryManager::visitCategories(const t_CATEGORY_VISITOR& visitor) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    for (bsl::vector<Category *>::const_iterator it = d_categories.begin();
-         it != d_categories.end();
-         ++it) {
-        visitor(*it);
+    const CategoryManager_Registry *registry = d_registry.loadAcquire();
+    if (registry) {
+        const int length = registry->length();
+        for (int i = 0; i < length; ++i) {
+            const Category *category = registry->category(i);
+            visitor(category);
+        }
     }
 }
 
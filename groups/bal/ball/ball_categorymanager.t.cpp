@@ -18,12 +18,15 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
 
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_threadutil.h>
 
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_bitset.h>
@@ -39,6 +42,7 @@
 #include <bsl_sstream.h>
 #include <bsl_streambuf.h>  // i2bs
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>
@@ -95,6 +99,8 @@ using namespace bsl;
 // [13] bslmt::Mutex& rulesetMutex();
 // [ 6] const ball::Category& operator[](int index) const;
 // [ 3] const ball::Category *lookupCategory(const char *name) const;
+// [18] ball::Category *lookupCategory(const bsl::string_view& name);
+// [18] const ball::Category *lookupCategory(const string_view& n) const;
 // [ 3] int length() const;
 // [13] ball::RuleSet& ruleSet() const;
 // [ 8] bsls::Types::Int64 ruleSetSequenceNumber() const;
@@ -132,6 +138,7 @@ using namespace bsl;
 // [13] CONCURRENCY TEST: RULES
 // [14] UNIQUENESS OF INITIAL RULE SET SEQUENCE NUMBER
 // [15] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: CONCURRENT LOOKUP
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -596,6 +603,169 @@ extern "C" void *seqNumUniquenessThread(void *args)
 
 }  // close namespace BALL_CATEGORYMANAGER_UNIQUENESS_OF_SEQUENCE_NUMBERS
 
+// ============================================================================
+//                         CASE 18 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_CATEGORYMANAGER_CONCURRENT_ADD_AND_LOOKUP {
+
+enum {
+    k_NUM_CATEGORIES = 2000,
+    k_NUM_READERS    = 8,
+    k_NUM_THREADS    = k_NUM_READERS + 1
+};
+
+struct ThreadArgs {
+    Obj                *d_manager_p;   // category manager under test (held)
+    const bsl::string  *d_names_p;     // 'k_NUM_CATEGORIES' category names
+                                       // (held)
+    bsls::AtomicInt    *d_numAdded_p;  // number of categories added (held)
+    bslmt::Barrier     *d_barrier_p;   // synchronize threads (held)
+};
+
+extern "C" void *concurrentAddThread(void *args)
+    // Add to the category manager supplied in the specified 'args' a category
+    // for each name supplied in 'args', in order, publishing the number of
+    // categories added after each addition.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    Obj&               mX    = *threadArgs->d_manager_p;
+    const bsl::string *NAMES = threadArgs->d_names_p;
+
+    threadArgs->d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+        MTLOOP_ASSERT(i, mX.addCategory(NAMES[i].c_str(), i % 256, 0, 0, 0));
+
+        threadArgs->d_numAdded_p->storeRelease(i + 1);
+    }
+
+    return 0;
+}
+
+extern "C" void *concurrentLookupThread(void *args)
+    // Look up, in the category manager supplied in the specified 'args', the
+    // categories having names supplied in 'args' until all of them were
+    // added, and verify that every category known to have been added is
+    // found, by name and by index.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    const Obj&         X     = *threadArgs->d_manager_p;
+    const bsl::string *NAMES = threadArgs->d_names_p;
+
+    threadArgs->d_barrier_p->wait();
+
+    int numAdded  = 0;
+    int iteration = 0;
+
+    do {
+        numAdded = threadArgs->d_numAdded_p->loadAcquire();
+
+        if (0 == numAdded) {
+            continue;
+        }
+
+        const int INDICES[] = { numAdded - 1, iteration % numAdded };
+
+        for (int j = 0; j < 2; ++j) {
+            const int i = INDICES[j];
+
+            const Entry *category = X.lookupCategory(
+                                                  bsl::string_view(NAMES[i]));
+
+            MTLOOP_ASSERT(i, category);
+            if (category) {
+                MTLOOP_ASSERT(i, NAMES[i] == category->categoryName());
+                MTLOOP_ASSERT(i, i % 256 == category->recordLevel());
+            }
+
+            MTLOOP_ASSERT(i, numAdded <= X.length());
+            MTLOOP_ASSERT(i, NAMES[i] == X[i].categoryName());
+        }
+
+        ++iteration;
+    } while (numAdded < k_NUM_CATEGORIES);
+
+    return 0;
+}
+
+}  // close namespace BALL_CATEGORYMANAGER_CONCURRENT_ADD_AND_LOOKUP
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_CATEGORYMANAGER_LOOKUP_PERFORMANCE {
+
+struct ThreadArgs {
+    Obj                *d_manager_p;    // category manager (held)
+    const bsl::string  *d_names_p;      // category names (held)
+    int                 d_numNames;     // number of category names
+    int                 d_numLookups;   // number of lookups per thread
+    bsls::AtomicInt    *d_numDone_p;    // number of threads done with their
+                                        // lookups (held)
+    int                 d_numThreads;   // number of lookup threads
+    bslmt::Barrier     *d_barrier_p;    // synchronize threads (held)
+};
+
+extern "C" void *lookupPerformanceThread(void *args)
+    // Perform the number of lookups supplied in the specified 'args' of
+    // category names supplied in 'args' in the category manager supplied in
+    // 'args'.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    const Obj&         X         = *threadArgs->d_manager_p;
+    const bsl::string *NAMES     = threadArgs->d_names_p;
+    const int          NUM_NAMES = threadArgs->d_numNames;
+
+    threadArgs->d_barrier_p->wait();
+
+    int numFound = 0;
+    for (int i = 0; i < threadArgs->d_numLookups; ++i) {
+        if (X.lookupCategory(NAMES[(i * 7919) % NUM_NAMES].c_str())) {
+            ++numFound;
+        }
+    }
+
+    MTASSERT(threadArgs->d_numLookups == numFound);
+
+    ++*threadArgs->d_numDone_p;
+
+    threadArgs->d_barrier_p->wait();
+
+    return 0;
+}
+
+extern "C" void *addPerformanceThread(void *args)
+    // Add to the category manager supplied in the specified 'args' a new
+    // category derived from each of the category names supplied in 'args',
+    // pausing between additions, until the lookup threads are done.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    Obj&               mX        = *threadArgs->d_manager_p;
+    const bsl::string *NAMES     = threadArgs->d_names_p;
+    const int          NUM_NAMES = threadArgs->d_numNames;
+
+    threadArgs->d_barrier_p->wait();
+
+    for (int i = 0; i < NUM_NAMES
+                 && threadArgs->d_numDone_p->load() < threadArgs->d_numThreads;
+                                                                         ++i) {
+        mX.addCategory((NAMES[i] + ".DYNAMIC").c_str(), 0, 0, 0, 0);
+        bslmt::ThreadUtil::microSleep(100);
+    }
+
+    threadArgs->d_barrier_p->wait();
+
+    return 0;
+}
+
+}  // close namespace BALL_CATEGORYMANAGER_LOOKUP_PERFORMANCE
+
 //=============================================================================
 //                                 MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -613,6 +783,179 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING LOOKUP BY 'bsl::string_view' AND REGISTRY GROWTH
+        //
+        // Concerns:
+        //: 1 'lookupCategory' supplied a 'bsl::string_view' finds the category
+        //:   having exactly the name in the view, whether or not the view is
+        //:   null-terminated, and returns 0 if no such category exists.
+        //:
+        //: 2 Looking up a category allocates no memory.
+        //:
+        //: 3 The categories added to the registry remain accessible, by name
+        //:   and by index (in the order in which they were added), as the
+        //:   registry grows.
+        //:
+        //: 4 Categories concurrently added to the registry are found by
+        //:   readers as soon as their addition is complete.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Add a set of categories and look each of them up through views
+        //:   of a buffer holding the category name followed by an extra
+        //:   character, having the length of the name (found) and the length
+        //:   of the name plus one (not found).  (C-1)
+        //:
+        //: 2 Look up categories while monitoring the object and default
+        //:   allocators.  (C-2)
+        //:
+        //: 3 Add a large number of categories, verifying after each addition
+        //:   that each of the categories added so far is found by name and by
+        //:   index.  (C-3)
+        //:
+        //: 4 In one thread, add a large number of categories, publishing the
+        //:   number of categories added after each addition.  In several other
+        //:   threads, look up categories known to have been added (by name
+        //:   and by index) until all categories were added.  (C-4)
+        //:
+        //: 5 Use a test allocator and verify that no memory is outstanding
+        //:   after the category managers are destroyed.  (C-5)
+        //
+        // Testing:
+        //   ball::Category *lookupCategory(const bsl::string_view& name);
+        //   const ball::Category *lookupCategory(const string_view& n) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING LOOKUP BY 'bsl::string_view' AND REGISTRY GROWTH"
+                 << endl
+                 << "========================================================"
+                 << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVerbose);
+
+        DefaultAllocGuard guard(&da);
+
+        if (verbose) cout << "\tTesting lookup by 'bsl::string_view'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.lookupCategory(bsl::string_view("A")));
+            ASSERT(0 ==  X.lookupCategory(bsl::string_view("A")));
+            ASSERT(0 ==  X.lookupCategory(bsl::string_view()));
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                ASSERTV(i, mX.addCategory(NAMES[i], 0, 0, 0, 0));
+            }
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const bsl::string buffer(bsl::string(NAMES[i]) + "#", &ta);
+                const bsl::size_t length = bsl::strlen(NAMES[i]);
+
+                const bsl::string_view NAME(buffer.data(), length);
+                const bsl::string_view LONGER(buffer.data(), length + 1);
+
+                Entry *category = mX.lookupCategory(NAMES[i]);
+                ASSERTV(i, category);
+
+                bslma::TestAllocatorMonitor dam(&da);
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                ASSERTV(i, category == mX.lookupCategory(NAME));
+                ASSERTV(i, category ==  X.lookupCategory(NAME));
+                ASSERTV(i, 0        == mX.lookupCategory(LONGER));
+                ASSERTV(i, 0        ==  X.lookupCategory(LONGER));
+                ASSERTV(i, category == mX.lookupCategory(NAMES[i]));
+
+                ASSERTV(i, dam.isTotalSame());
+                ASSERTV(i, tam.isTotalSame());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting registry growth." << endl;
+        {
+            enum { k_NUM_CATEGORIES = 1000 };
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::vector<bsl::string> names(&ta);
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                bsl::ostringstream oss(&ta);
+                oss << "GROWTH." << i;
+                names.push_back(oss.str());
+            }
+
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                const Entry *category = mX.addCategory(names[i].c_str(),
+                                                       i % 256, 0, 0, 0);
+                ASSERTV(i, category);
+                ASSERTV(i, i + 1 == X.length());
+                ASSERTV(i, 0 == mX.addCategory(names[i].c_str(), 0, 0, 0, 0));
+
+                // Verify all categories only when the registry may just have
+                // grown, to keep the running time linear.
+
+                const bool verifyAll = 0 == ((i + 1) & i) || 0 == i % 100;
+
+                for (int j = verifyAll ? 0 : i; j <= i; ++j) {
+                    ASSERTV(i, j, &X[j] == X.lookupCategory(names[j]));
+                    ASSERTV(i, j, names[j] == X[j].categoryName());
+                    ASSERTV(i, j, j % 256 == X[j].recordLevel());
+                }
+            }
+
+            int count = 0;
+            for (ball::CategoryManagerIter it(X); it; ++it) {
+                ASSERTV(count, names[count] == it().categoryName());
+                ++count;
+            }
+            ASSERTV(count, k_NUM_CATEGORIES == count);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting concurrent addition and lookup."
+                          << endl;
+        {
+            using namespace BALL_CATEGORYMANAGER_CONCURRENT_ADD_AND_LOOKUP;
+
+            Obj mX(&ta);
+
+            bsl::vector<bsl::string> names(&ta);
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                bsl::ostringstream oss(&ta);
+                oss << "CONCURRENT." << i;
+                names.push_back(oss.str());
+            }
+
+            bsls::AtomicInt numAdded(0);
+            bslmt::Barrier  barrier(k_NUM_THREADS);
+
+            ThreadArgs args = { &mX, names.data(), &numAdded, &barrier };
+
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&threads[0],
+                                                  concurrentAddThread,
+                                                  &args));
+            for (int i = 1; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                      concurrentLookupThread,
+                                                      &args));
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+            }
+
+            ASSERTV(mX.length(), k_NUM_CATEGORIES == mX.length());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 17: {
         // --------------------------------------------------------------------
@@ -2779,6 +3122,93 @@ int main(int argc, char *argv[])
         ASSERT(LB[2] == e2->triggerLevel());
         ASSERT(LB[3] == e2->triggerAllLevel());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: CONCURRENT LOOKUP
+        //
+        // Concerns:
+        //: 1 The throughput of 'lookupCategory' scales with the number of
+        //:   threads concurrently looking up categories, including while
+        //:   categories are being added.
+        //
+        // Plan:
+        //: 1 Add a large number of categories.  In a number of threads
+        //:   (optionally specified as the second command-line argument,
+        //:   32 by default), look up the categories, first with no concurrent
+        //:   modification, then while another thread adds categories.  Report
+        //:   the number of lookups per second in each scenario.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: CONCURRENT LOOKUP
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: CONCURRENT LOOKUP" << endl
+             << "===================================" << endl;
+
+        using namespace BALL_CATEGORYMANAGER_LOOKUP_PERFORMANCE;
+
+        enum {
+            k_NUM_CATEGORIES = 4096,
+            k_NUM_LOOKUPS    = 200000
+        };
+
+        const int NUM_THREADS = argc > 2 ? atoi(argv[2]) : 32;
+
+        Obj mX;
+
+        bsl::vector<bsl::string> names;
+        for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+            bsl::ostringstream oss;
+            oss << "SERVICE.COMPONENT" << i % 16 << ".CATEGORY" << i;
+            names.push_back(oss.str());
+            mX.addCategory(names.back().c_str(), 0, 0, 0, 0);
+        }
+
+        for (int withWriter = 0; withWriter < 2; ++withWriter) {
+            const int NUM_ALL_THREADS = NUM_THREADS + withWriter;
+
+            bslmt::Barrier  barrier(NUM_ALL_THREADS + 1);
+            bsls::AtomicInt numDone(0);
+
+            ThreadArgs args = { &mX,
+                                names.data(),
+                                k_NUM_CATEGORIES,
+                                k_NUM_LOOKUPS,
+                                &numDone,
+                                NUM_THREADS,
+                                &barrier };
+
+            bsl::vector<bslmt::ThreadUtil::Handle> threads(NUM_ALL_THREADS);
+
+            for (int i = 0; i < NUM_ALL_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &threads[i],
+                                      i < NUM_THREADS ? lookupPerformanceThread
+                                                      : addPerformanceThread,
+                                      &args));
+            }
+
+            bsls::Stopwatch timer;
+
+            barrier.wait();
+            timer.start();
+            barrier.wait();
+            timer.stop();
+
+            for (int i = 0; i < NUM_ALL_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+            }
+
+            const double elapsed = timer.elapsedTime();
+
+            cout << NUM_THREADS << " threads, "
+                 << (withWriter ? "concurrent additions:    "
+                                : "no concurrent additions: ")
+                 << static_cast<Int64>(NUM_THREADS * k_NUM_LOOKUPS / elapsed)
+                 << " lookups/sec" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,724 @@
+// ball_deferredformatutil.cpp                                        -*-C++-*-
+#include <ball_deferredformatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredformatutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+#include <stdarg.h> // 'va_copy'
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'vsnprintf'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The encoding produced by 'captureArguments' is the concatenation, in the
+// order in which the arguments are consumed, of:
+//
+//: o an 'int' for each '*' field width or precision,
+//:
+//: o the value of each integral argument, as a 64-bit integer,
+//:
+//: o the value of each floating-point argument, as a 'double' or a
+//:   'long double',
+//:
+//: o the value of each 'p' argument, as a 'const void *', and
+//:
+//: o for each 's' argument, a 32-bit length (or 'k_NULL_STRING') followed by
+//:   that many characters and a null terminator,
+//
+// each copied byte-wise in native representation.  No type information is
+// stored: 'formatArguments' parses the format specification again, and
+// decodes each argument according to its conversion.  Each conversion is then
+// formatted by 'snprintf', using a copy of its specification, and passing the
+// argument with the type that the specification requires.
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+#if !defined(va_copy)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    // 'va_copy' is defined by C99 and C++11, but gcc and clang do not define
+    // it in C++03 mode, where the internal '__va_copy' must be used instead.
+    #define va_copy(dest, src) __va_copy(dest, src)
+#else
+    // On the other platforms that do not define 'va_copy' (e.g., MSVC before
+    // VS2013), 'va_list' is a simple pointer.
+    #define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_MAX_SPEC_LENGTH = 31,  // longest supported conversion specification
+                             // (including the '%' character)
+
+    k_BUFFER_SIZE     = 128  // size of the buffer used to format a single
+                             // conversion
+};
+
+const unsigned int k_NULL_STRING = ~0u;  // encoded length of a null 's'
+                                         // argument
+
+enum LengthModifier {
+    // Enumeration of the length modifiers of a conversion specification.
+
+    e_NONE,
+    e_HH,
+    e_H,
+    e_L,
+    e_LL,
+    e_J,
+    e_Z,
+    e_T,
+    e_LONG_DOUBLE
+};
+
+struct Conversion {
+    // This 'struct' describes a conversion specification in a 'printf'-style
+    // format.
+
+    // DATA
+    const char     *d_end_p;         // one past the conversion character
+    int             d_numStars;      // number of '*' width and precision
+    bool            d_hasPrecision;  // 'true' if a precision is specified
+    int             d_precision;     // precision, if given by digits
+    bool            d_precisionStar; // 'true' if the precision is '*'
+    LengthModifier  d_length;        // length modifier
+    char            d_conversion;    // conversion character
+};
+
+int parseConversion(Conversion *result, const char *spec)
+    // Load into the specified 'result' a description of the conversion
+    // specification starting with the '%' character at the specified 'spec'
+    // address.  Return 0 on success, and a non-zero value if the conversion
+    // is not supported by 'captureArguments'.
+{
+    BSLS_ASSERT('%' == *spec);
+
+    const char *p = spec + 1;
+
+    result->d_numStars      = 0;
+    result->d_hasPrecision  = false;
+    result->d_precision     = -1;
+    result->d_precisionStar = false;
+    result->d_length        = e_NONE;
+
+    if ('%' == *p) {
+        result->d_end_p      = p + 1;
+        result->d_conversion = '%';
+        return 0;                                                     // RETURN
+    }
+
+    // Flags
+
+    while ('-' == *p || '+' == *p || ' ' == *p || '#' == *p || '0' == *p
+        || '\'' == *p) {
+        ++p;
+    }
+
+    // Field width
+
+    if ('*' == *p) {
+        ++result->d_numStars;
+        ++p;
+    }
+    else {
+        while ('0' <= *p && *p <= '9') {
+            ++p;
+        }
+    }
+    if ('$' == *p) {
+        return -1;                                                    // RETURN
+    }
+
+    // Precision
+
+    if ('.' == *p) {
+        ++p;
+        result->d_hasPrecision = true;
+        if ('*' == *p) {
+            ++result->d_numStars;
+            result->d_precisionStar = true;
+            ++p;
+        }
+        else {
+            int precision = 0;
+            while ('0' <= *p && *p <= '9') {
+                if (precision < 100000000) {
+                    precision = precision * 10 + (*p - '0');
+                }
+                ++p;
+            }
+            result->d_precision = precision;
+        }
+    }
+
+    // Length modifier
+
+    switch (*p) {
+      case 'h': {
+        ++p;
+        if ('h' == *p) {
+            ++p;
+            result->d_length = e_HH;
+        }
+        else {
+            result->d_length = e_H;
+        }
+      } break;
+      case 'l': {
+        ++p;
+        if ('l' == *p) {
+            ++p;
+            result->d_length = e_LL;
+        }
+        else {
+            result->d_length = e_L;
+        }
+      } break;
+      case 'j': {
+        ++p;
+        result->d_length = e_J;
+      } break;
+      case 'z': {
+        ++p;
+        result->d_length = e_Z;
+      } break;
+      case 't': {
+        ++p;
+        result->d_length = e_T;
+      } break;
+      case 'L': {
+        ++p;
+        result->d_length = e_LONG_DOUBLE;
+      } break;
+      default: {
+      } break;
+    }
+
+    // Conversion
+
+    result->d_conversion = *p;
+    result->d_end_p      = p + 1;
+
+    if (p + 1 - spec > k_MAX_SPEC_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    switch (*p) {
+      case 'd':
+      case 'i':
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+      case 'p': {
+        return 0;                                                     // RETURN
+      }
+      case 'c':
+      case 's': {
+        return e_L == result->d_length ? -1 : 0;                      // RETURN
+      }
+    }
+    return -1;
+}
+
+template <class TYPE>
+inline
+void appendValue(bdlsb::MemOutStreamBuf *output, const TYPE& value)
+    // Append to the specified 'output' the bytes of the specified 'value'.
+{
+    output->sputn(reinterpret_cast<const char *>(&value), sizeof value);
+}
+
+template <class TYPE>
+inline
+TYPE readValue(const char **position, const char *end)
+    // Return the value of the specified 'TYPE' stored at the specified
+    // '*position', and advance '*position' past that value.  The behavior is
+    // undefined unless at least 'sizeof(TYPE)' bytes are available before the
+    // specified 'end'.
+{
+    BSLS_ASSERT(static_cast<bsl::size_t>(end - *position) >= sizeof(TYPE));
+    (void)end;
+
+    TYPE value;
+    bsl::memcpy(&value, *position, sizeof value);
+    *position += sizeof value;
+    return value;
+}
+
+Int64 readSigned(bsl::va_list *args, LengthModifier length)
+    // Return the next argument of the specified 'args', of the signed integral
+    // type indicated by the specified 'length'.
+{
+    switch (length) {
+      case e_L:  return va_arg(*args, long);                          // RETURN
+      case e_LL: return va_arg(*args, long long);                     // RETURN
+      case e_J:  return va_arg(*args, bsl::intmax_t);                 // RETURN
+      case e_Z:  return static_cast<Int64>(va_arg(*args, bsl::size_t));
+                                                                      // RETURN
+      case e_T:  return va_arg(*args, bsl::ptrdiff_t);                // RETURN
+      default:   return va_arg(*args, int);                           // RETURN
+    }
+}
+
+Uint64 readUnsigned(bsl::va_list *args, LengthModifier length)
+    // Return the next argument of the specified 'args', of the unsigned
+    // integral type indicated by the specified 'length'.
+{
+    switch (length) {
+      case e_L:  return va_arg(*args, unsigned long);                 // RETURN
+      case e_LL: return va_arg(*args, unsigned long long);            // RETURN
+      case e_J:  return va_arg(*args, bsl::uintmax_t);                // RETURN
+      case e_Z:  return va_arg(*args, bsl::size_t);                   // RETURN
+      case e_T:  return static_cast<Uint64>(va_arg(*args, bsl::ptrdiff_t));
+                                                                      // RETURN
+      default:   return va_arg(*args, unsigned int);                  // RETURN
+    }
+}
+
+template <class TYPE>
+int printValue(char        *buffer,
+               bsl::size_t  size,
+               const char  *spec,
+               const int   *stars,
+               int          numStars,
+               TYPE         value)
+    // Format into the specified 'buffer' of the specified 'size' the specified
+    // 'value', preceded by the specified 'numStars' field width and precision
+    // at the specified 'stars' address, according to the specified conversion
+    // 'spec', as if by 'snprintf'.  Return the value returned by 'snprintf'.
+{
+    switch (numStars) {
+      case 0: {
+        return snprintf(buffer, size, spec, value);                   // RETURN
+      }
+      case 1: {
+        return snprintf(buffer, size, spec, stars[0], value);         // RETURN
+      }
+      default: {
+        return snprintf(buffer, size, spec, stars[0], stars[1], value);
+                                                                      // RETURN
+      }
+    }
+}
+
+template <class TYPE>
+void formatValue(bdlsb::MemOutStreamBuf *output,
+                 const char             *spec,
+                 const int              *stars,
+                 int                     numStars,
+                 TYPE                    value)
+    // Append to the specified 'output' the result of formatting the specified
+    // 'value', preceded by the specified 'numStars' field width and precision
+    // at the specified 'stars' address, according to the specified conversion
+    // 'spec'.
+{
+    char buffer[k_BUFFER_SIZE];
+
+    int length = printValue(buffer, sizeof buffer, spec, stars, numStars,
+                            value);
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+    if (length < static_cast<int>(sizeof buffer)) {
+        output->sputn(buffer, length);
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<char> largeBuffer(length + 1);
+    length = printValue(largeBuffer.data(),
+                        largeBuffer.size(),
+                        spec,
+                        stars,
+                        numStars,
+                        value);
+    if (0 < length) {
+        output->sputn(largeBuffer.data(), length);
+    }
+}
+
+template <class TYPE>
+void formatInteger(bdlsb::MemOutStreamBuf *output,
+                   const char             *spec,
+                   const int              *stars,
+                   int                     numStars,
+                   Uint64                  value)
+    // Append to the specified 'output' the result of formatting the specified
+    // 'value', converted to the specified 'TYPE', preceded by the specified
+    // 'numStars' field width and precision at the specified 'stars' address,
+    // according to the specified conversion 'spec'.
+{
+    formatValue(output, spec, stars, numStars, static_cast<TYPE>(value));
+}
+
+void formatSigned(bdlsb::MemOutStreamBuf *output,
+                  const char             *spec,
+                  const int              *stars,
+                  int                     numStars,
+                  LengthModifier          length,
+                  Uint64                  value)
+    // Append to the specified 'output' the result of formatting the specified
+    // 'value', converted to the signed integral type indicated by the
+    // specified 'length', preceded by the specified 'numStars' field width and
+    // precision at the specified 'stars' address, according to the specified
+    // conversion 'spec'.
+{
+    switch (length) {
+      case e_L: {
+        formatInteger<long>(output, spec, stars, numStars, value);
+      } break;
+      case e_LL: {
+        formatInteger<long long>(output, spec, stars, numStars, value);
+      } break;
+      case e_J: {
+        formatInteger<bsl::intmax_t>(output, spec, stars, numStars, value);
+      } break;
+      case e_Z: {
+        formatInteger<bsl::size_t>(output, spec, stars, numStars, value);
+      } break;
+      case e_T: {
+        formatInteger<bsl::ptrdiff_t>(output, spec, stars, numStars, value);
+      } break;
+      default: {
+        formatInteger<int>(output, spec, stars, numStars, value);
+      } break;
+    }
+}
+
+void formatUnsigned(bdlsb::MemOutStreamBuf *output,
+                    const char             *spec,
+                    const int              *stars,
+                    int                     numStars,
+                    LengthModifier          length,
+                    Uint64                  value)
+    // Append to the specified 'output' the result of formatting the specified
+    // 'value', converted to the unsigned integral type indicated by the
+    // specified 'length', preceded by the specified 'numStars' field width and
+    // precision at the specified 'stars' address, according to the specified
+    // conversion 'spec'.
+{
+    switch (length) {
+      case e_L: {
+        formatInteger<unsigned long>(output, spec, stars, numStars, value);
+      } break;
+      case e_LL: {
+        formatInteger<unsigned long long>(output,
+                                          spec,
+                                          stars,
+                                          numStars,
+                                          value);
+      } break;
+      case e_J: {
+        formatInteger<bsl::uintmax_t>(output, spec, stars, numStars, value);
+      } break;
+      case e_Z: {
+        formatInteger<bsl::size_t>(output, spec, stars, numStars, value);
+      } break;
+      case e_T: {
+        formatInteger<bsl::ptrdiff_t>(output, spec, stars, numStars, value);
+      } break;
+      default: {
+        formatInteger<unsigned int>(output, spec, stars, numStars, value);
+      } break;
+    }
+}
+
+}  // close unnamed namespace
+
+                        // -------------------------
+                        // struct DeferredFormatUtil
+                        // -------------------------
+
+// CLASS METHODS
+int DeferredFormatUtil::captureArguments(bdlsb::MemOutStreamBuf *arguments,
+                                         const char             *format,
+                                         bsl::va_list            args)
+{
+    BSLS_ASSERT(arguments);
+    BSLS_ASSERT(format);
+
+    // Note that the address of a 'va_list' parameter is not a 'va_list *' on
+    // all platforms, hence the copy.
+
+    bsl::va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    int rc = 0;
+    for (const char *p = bsl::strchr(format, '%'); p; p = bsl::strchr(p, '%'))
+    {
+        Conversion conversion;
+        if (0 != parseConversion(&conversion, p)) {
+            rc = -1;
+            break;
+        }
+        p = conversion.d_end_p;
+
+        if ('%' == conversion.d_conversion) {
+            continue;
+        }
+
+        int star = 0;
+        for (int i = 0; i < conversion.d_numStars; ++i) {
+            star = va_arg(argsCopy, int);
+            appendValue(arguments, star);
+        }
+        const int precision = conversion.d_precisionStar
+                              ? star
+                              : conversion.d_precision;
+
+        switch (conversion.d_conversion) {
+          case 'd':
+          case 'i': {
+            appendValue(arguments, readSigned(&argsCopy,
+                                              conversion.d_length));
+          } break;
+          case 'o':
+          case 'u':
+          case 'x':
+          case 'X': {
+            appendValue(arguments, readUnsigned(&argsCopy,
+                                                conversion.d_length));
+          } break;
+          case 'c': {
+            appendValue(arguments,
+                        static_cast<Int64>(va_arg(argsCopy, int)));
+          } break;
+          case 'p': {
+            appendValue(arguments, va_arg(argsCopy, const void *));
+          } break;
+          case 's': {
+            const char *string = va_arg(argsCopy, const char *);
+            if (0 == string) {
+                appendValue(arguments, k_NULL_STRING);
+                break;
+            }
+
+            // A string having a precision need not be null-terminated.
+
+            bsl::size_t length;
+            if (conversion.d_hasPrecision && 0 <= precision) {
+                const void *end = bsl::memchr(string, '\0', precision);
+                length = end ? static_cast<const char *>(end) - string
+                             : precision;
+            }
+            else {
+                length = bsl::strlen(string);
+            }
+            appendValue(arguments, static_cast<unsigned int>(length));
+            arguments->sputn(string, length);
+            arguments->sputc('\0');
+          } break;
+          default: {
+            if (e_LONG_DOUBLE == conversion.d_length) {
+                appendValue(arguments, va_arg(argsCopy, long double));
+            }
+            else {
+                appendValue(arguments, va_arg(argsCopy, double));
+            }
+          } break;
+        }
+    }
+
+    va_end(argsCopy);
+    return rc;
+}
+
+void DeferredFormatUtil::formatArguments(bdlsb::MemOutStreamBuf *output,
+                                         const char             *format,
+                                         const char             *arguments,
+                                         bsl::size_t             numBytes)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(format);
+    BSLS_ASSERT(arguments || 0 == numBytes);
+
+    const char *position = arguments;
+    const char *end      = arguments + numBytes;
+    const char *literal  = format;
+
+    for (const char *p = bsl::strchr(format, '%'); p; p = bsl::strchr(p, '%'))
+    {
+        output->sputn(literal, p - literal);
+
+        Conversion conversion;
+        int        rc = parseConversion(&conversion, p);
+        BSLS_ASSERT(0 == rc);
+        (void)rc;
+
+        char spec[k_MAX_SPEC_LENGTH + 1];
+        bsl::memcpy(spec, p, conversion.d_end_p - p);
+        spec[conversion.d_end_p - p] = '\0';
+
+        literal = p = conversion.d_end_p;
+
+        if ('%' == conversion.d_conversion) {
+            output->sputc('%');
+            continue;
+        }
+
+        int stars[2] = { 0, 0 };
+        for (int i = 0; i < conversion.d_numStars; ++i) {
+            stars[i] = readValue<int>(&position, end);
+        }
+        const int numStars = conversion.d_numStars;
+
+        switch (conversion.d_conversion) {
+          case 'd':
+          case 'i': {
+            formatSigned(output,
+                         spec,
+                         stars,
+                         numStars,
+                         conversion.d_length,
+                         readValue<Uint64>(&position, end));
+          } break;
+          case 'o':
+          case 'u':
+          case 'x':
+          case 'X': {
+            formatUnsigned(output,
+                           spec,
+                           stars,
+                           numStars,
+                           conversion.d_length,
+                           readValue<Uint64>(&position, end));
+          } break;
+          case 'c': {
+            formatValue(output,
+                        spec,
+                        stars,
+                        numStars,
+                        static_cast<int>(readValue<Int64>(&position, end)));
+          } break;
+          case 'p': {
+            formatValue(output,
+                        spec,
+                        stars,
+                        numStars,
+                        readValue<const void *>(&position, end));
+          } break;
+          case 's': {
+            const unsigned int length = readValue<unsigned int>(&position,
+                                                                end);
+            const char *string = "(null)";
+            if (k_NULL_STRING != length) {
+                BSLS_ASSERT(static_cast<bsl::size_t>(end - position) >
+                                                                      length);
+                string    = position;
+                position += length + 1;
+
+                if ('s' == spec[1]) {  // plain "%s"
+                    output->sputn(string, length);
+                    break;
+                }
+            }
+            else {
+                // As 'vsnprintf' (in glibc) does, format a null string as an
+                // empty string if the precision is less than the length of
+                // "(null)", rather than truncating "(null)".
+
+                const int precision = conversion.d_precisionStar
+                                    ? stars[numStars - 1]
+                                    : conversion.d_precision;
+
+                if (conversion.d_hasPrecision
+                 && 0 <= precision
+                 && precision < 6) {
+                    string = "";
+                }
+            }
+            formatValue(output, spec, stars, numStars, string);
+          } break;
+          default: {
+            if (e_LONG_DOUBLE == conversion.d_length) {
+                formatValue(output,
+                            spec,
+                            stars,
+                            numStars,
+                            readValue<long double>(&position, end));
+            }
+            else {
+                formatValue(output,
+                            spec,
+                            stars,
+                            numStars,
+                            readValue<double>(&position, end));
+            }
+          } break;
+        }
+    }
+    output->sputn(literal, bsl::strlen(literal));
+
+    BSLS_ASSERT(position == end);
+}
+
+void DeferredFormatUtil::formatVaList(bdlsb::MemOutStreamBuf *output,
+                                      const char             *format,
+                                      bsl::va_list            args)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(format);
+
+    // Note that 'args' can be traversed only once, so, as for the buffer
+    // supplied by 'Log::obtainMessageBuffer', the message is truncated if it
+    // does not fit in the buffer.
+
+    enum { k_MESSAGE_BUFFER_SIZE = 8192 };
+
+    char buffer[k_MESSAGE_BUFFER_SIZE];
+
+    int length = vsnprintf(buffer, sizeof buffer, format, args);
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+    if (length >= k_MESSAGE_BUFFER_SIZE) {
+        length = k_MESSAGE_BUFFER_SIZE - 1;
+    }
+    output->sputn(buffer, length);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#undef snprintf
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,172 @@
+// ball_deferredformatutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDFORMATUTIL
+#define INCLUDED_BALL_DEFERREDFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to capture 'printf' arguments for later format.
+//
+//@CLASSES:
+//  ball::DeferredFormatUtil: namespace for deferred 'printf'-style formatting
+//
+//@SEE_ALSO: ball_recordattributes, ball_log
+//
+//@DESCRIPTION: This component provides a 'struct', 'ball::DeferredFormatUtil',
+// that splits 'printf'-style formatting into two steps: 'captureArguments'
+// copies the arguments of a variable argument list into a compact binary
+// encoding, and 'formatArguments' later produces, from that encoding and the
+// same format specification, the text that 'vsnprintf' would have produced
+// from the original arguments.
+//
+// Capturing the arguments requires only a scan of the format specification
+// and a copy of each argument, and is significantly cheaper than formatting
+// them (in particular, floating-point values).  This allows a log message to
+// be formatted by the thread that publishes it, rather than by the thread that
+// logs it (see {'ball_recordattributes'|Deferred Formatting}).  Note that the
+// format specification is *not* captured: it must remain valid, and
+// unchanged, until the arguments are formatted (e.g., it can be a string
+// literal).
+//
+///Supported Conversions
+///---------------------
+// 'captureArguments' supports the conversions of the C99 'printf' function,
+// with the optional flags, field width, precision, and length modifiers (where
+// the field width and precision can be '*'), except for:
+//
+//: o the 'n' conversion,
+//:
+//: o the wide character and string conversions (i.e., 'lc' and 'ls'), and
+//:
+//: o the conversions that use a positional ('n$') argument.
+//
+// The arguments for the 's' conversion are copied when captured, up to the
+// precision, if any.  A null 's' argument is formatted as "(null)", or, if the
+// precision is less than 6, as an empty string (as glibc 'vsnprintf' does).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Arguments Captured Earlier
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to capture the arguments of a log message when the message
+// is logged, but format the message only when it is written out.  First, we
+// define a function taking a variable argument list that captures the
+// arguments into a stream buffer:
+//..
+//  int capture(bdlsb::MemOutStreamBuf *arguments, const char *format, ...)
+//      // Capture into the specified 'arguments' the variable argument list
+//      // to be formatted according to the specified 'format'.  Return 0 on
+//      // success, and a non-zero value otherwise.
+//  {
+//      va_list args;
+//      va_start(args, format);
+//      int rc = ball::DeferredFormatUtil::captureArguments(arguments,
+//                                                          format,
+//                                                          args);
+//      va_end(args);
+//      return rc;
+//  }
+//..
+// Then, we capture the arguments of a message:
+//..
+//  const char *const FORMAT = "%s: %d of %d done (%.1f%%)";
+//
+//  bdlsb::MemOutStreamBuf arguments;
+//
+//  int rc = capture(&arguments, FORMAT, "upload", 3, 8, 37.5);
+//  assert(0 == rc);
+//..
+// Finally, we format the captured arguments:
+//..
+//  bdlsb::MemOutStreamBuf message;
+//
+//  ball::DeferredFormatUtil::formatArguments(&message,
+//                                            FORMAT,
+//                                            arguments.data(),
+//                                            arguments.length());
+//
+//  assert("upload: 3 of 8 done (37.5%)" ==
+//              bsl::string(message.data(), message.length()));
+//..
+
+#include <balscm_version.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bsl_cstdarg.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                        // =========================
+                        // struct DeferredFormatUtil
+                        // =========================
+
+struct DeferredFormatUtil {
+    // This 'struct' provides a namespace for utility functions that capture
+    // the arguments of a 'printf'-style format specification and format them
+    // later.
+
+    // CLASS METHODS
+    static int captureArguments(bdlsb::MemOutStreamBuf *arguments,
+                                const char             *format,
+                                bsl::va_list            args);
+        // Append to the specified 'arguments' an encoding of the specified
+        // 'args' variable argument list from which 'formatArguments' can
+        // produce the result of formatting 'args' according to the specified
+        // 'printf'-style 'format'.  Return 0 on success, and a non-zero value,
+        // with 'arguments' in a valid but unspecified state, if 'format'
+        // contains a conversion that is not supported (see {Supported
+        // Conversions}).  The behavior is undefined unless the number and
+        // types of the arguments in 'args' are compatible with 'format'.  Note
+        // that, as for 'vsnprintf', 'va_arg' is invoked on 'args', whose value
+        // is indeterminate upon return.
+
+    static void formatArguments(bdlsb::MemOutStreamBuf *output,
+                                const char             *format,
+                                const char             *arguments,
+                                bsl::size_t             numBytes);
+        // Append to the specified 'output' the result of formatting,
+        // according to the specified 'printf'-style 'format', the arguments
+        // encoded in the specified 'numBytes' bytes at the specified
+        // 'arguments' address.  The behavior is undefined unless
+        // '[arguments, arguments + numBytes)' holds the encoding appended by a
+        // successful call to 'captureArguments' with 'format'.  Note that
+        // temporary memory is allocated from the default allocator only if
+        // the result of a single conversion, other than an unqualified 's'
+        // conversion, is longer than 127 characters.
+
+    static void formatVaList(bdlsb::MemOutStreamBuf *output,
+                             const char             *format,
+                             bsl::va_list            args);
+        // Append to the specified 'output' the result of formatting the
+        // specified 'args' variable argument list according to the specified
+        // 'printf'-style 'format'.  The behavior is undefined unless the
+        // number and types of the arguments in 'args' are compatible with
+        // 'format'.  Note that, unlike 'captureArguments', this function
+        // supports every conversion supported by 'vsnprintf'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,623 @@
+// ball_deferredformatutil.t.cpp                                      -*-C++-*-
+#include <ball_deferredformatutil.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdarg.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+#include <stdarg.h> // 'va_copy'
+#include <stdio.h>  // 'vsnprintf'
+
+#if !defined(va_copy)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    #define va_copy(dest, src) __va_copy(dest, src)
+#else
+    #define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a utility 'struct' whose functions are
+// tested by comparing their results with the results of 'vsnprintf' for the
+// same format specification and arguments.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int captureArguments(MemOutStreamBuf *, const char *, va_list);
+// [ 2] void formatArguments(StreamBuf *, const char *, const char *, N);
+// [ 3] int captureArguments(MemOutStreamBuf *, const char *, va_list);
+// [ 4] void formatVaList(MemOutStreamBuf *, const char *, va_list);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredFormatUtil Util;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string_view toString(const bdlsb::MemOutStreamBuf& buffer)
+    // Return a string view of the contents of the specified 'buffer'.
+{
+    return bsl::string_view(buffer.data(), buffer.length());
+}
+
+int capture(bdlsb::MemOutStreamBuf *arguments, const char *format, ...)
+    // Capture into the specified 'arguments' the variable argument list to be
+    // formatted according to the specified 'format'.  Return the value
+    // returned by 'captureArguments'.
+{
+    va_list args;
+    va_start(args, format);
+    int rc = Util::captureArguments(arguments, format, args);
+    va_end(args);
+    return rc;
+}
+
+void formatNow(bdlsb::MemOutStreamBuf *output, const char *format, ...)
+    // Append to the specified 'output' the result of formatting the variable
+    // argument list according to the specified 'format' by 'formatVaList'.
+{
+    va_list args;
+    va_start(args, format);
+    Util::formatVaList(output, format, args);
+    va_end(args);
+}
+
+void check(int line, const char *format, ...)
+    // Verify that capturing the variable argument list according to the
+    // specified 'format', and then formatting the captured arguments, has the
+    // same result as 'vsnprintf', and that the captured arguments are fully
+    // consumed by formatting.  Use the specified 'line' to report errors.
+{
+    va_list args;
+    va_start(args, format);
+
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    static char expected[8192];
+    vsnprintf(expected, sizeof expected, format, argsCopy);
+    va_end(argsCopy);
+
+    bslma::TestAllocator   ta("arguments", veryVeryVerbose);
+    bdlsb::MemOutStreamBuf arguments(&ta);
+
+    int rc = Util::captureArguments(&arguments, format, args);
+    va_end(args);
+
+    ASSERTV(line, format, rc, 0 == rc);
+    if (0 != rc) {
+        return;                                                       // RETURN
+    }
+
+    bdlsb::MemOutStreamBuf output(&ta);
+    Util::formatArguments(&output, format, arguments.data(),
+                          arguments.length());
+
+    const bsl::string_view result = toString(output);
+
+    if (veryVerbose) {
+        T_ P_(line) P_(format) P_(arguments.length()) P(result)
+    }
+
+    ASSERTV(line, format, expected, result, expected == result);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Arguments Captured Earlier
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to capture the arguments of a log message when the message
+// is logged, but format the message only when it is written out.  First, we
+// define a function taking a variable argument list that captures the
+// arguments into a stream buffer (here, the 'capture' function defined
+// above).
+//
+// Then, we capture the arguments of a message:
+//..
+    const char *const FORMAT = "%s: %d of %d done (%.1f%%)";
+
+    bdlsb::MemOutStreamBuf arguments;
+
+    int rc = capture(&arguments, FORMAT, "upload", 3, 8, 37.5);
+    ASSERT(0 == rc);
+//..
+// Finally, we format the captured arguments:
+//..
+    bdlsb::MemOutStreamBuf message;
+
+    ball::DeferredFormatUtil::formatArguments(&message,
+                                              FORMAT,
+                                              arguments.data(),
+                                              arguments.length());
+
+    ASSERT("upload: 3 of 8 done (37.5%)" ==
+                  bsl::string(message.data(), message.length()));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'formatVaList'
+        //
+        // Concerns:
+        //: 1 'formatVaList' appends the result of 'vsnprintf' to the stream
+        //:   buffer, including for the conversions not supported by
+        //:   'captureArguments'.
+        //:
+        //: 2 A message longer than the internal buffer is truncated.
+        //
+        // Plan:
+        //: 1 Format messages using supported and unsupported conversions, and
+        //:   compare the result with the expected text.  (C-1)
+        //:
+        //: 2 Format a string argument longer than 8192 characters, and verify
+        //:   that the result is its prefix of 8191 characters.  (C-2)
+        //
+        // Testing:
+        //   void formatVaList(MemOutStreamBuf *, const char *, va_list);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'formatVaList'" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("output", veryVeryVerbose);
+
+        {
+            bdlsb::MemOutStreamBuf output(&ta);
+
+            output.sputn("> ", 2);
+            formatNow(&output, "%d %s %1.1f", 7, "x", 0.25);
+            ASSERTV(toString(output), "> 7 x 0.2" == toString(output)
+                                   || "> 7 x 0.3" == toString(output));
+        }
+        {
+            bdlsb::MemOutStreamBuf output(&ta);
+
+            formatNow(&output, "%1$s-%1$s", "ab");
+            ASSERTV(toString(output), "ab-ab" == toString(output));
+        }
+        {
+            bdlsb::MemOutStreamBuf output(&ta);
+
+            const bsl::string longString(10000, 'z');
+            formatNow(&output, "%s", longString.c_str());
+            ASSERTV(output.length(), 8191 == output.length());
+            ASSERT(bsl::string(8191, 'z') == toString(output));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // UNSUPPORTED CONVERSIONS
+        //
+        // Concerns:
+        //: 1 'captureArguments' returns a non-zero value for the 'n'
+        //:   conversion, the wide character and string conversions, the
+        //:   positional conversions, unknown conversions, incomplete
+        //:   conversions, and conversions having an excessively long
+        //:   specification.
+        //:
+        //: 2 'captureArguments' returns 0 for the '%%' conversion.
+        //
+        // Plan:
+        //: 1 Using a table-driven approach, invoke 'captureArguments' with
+        //:   format specifications containing each unsupported conversion and
+        //:   verify the result.  (C-1..2)
+        //
+        // Testing:
+        //   int captureArguments(MemOutStreamBuf *, const char *, va_list);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "UNSUPPORTED CONVERSIONS" << endl
+                                  << "=======================" << endl;
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_format;     // format specification
+            bool        d_supported;  // expected result
+        } DATA[] = {
+            //LINE  FORMAT                                     SUPPORTED
+            //----  -----------------------------------------  ---------
+            { L_,   "",                                        true      },
+            { L_,   "%%",                                      true      },
+            { L_,   "100%% done",                              true      },
+            { L_,   "%d",                                      true      },
+            { L_,   "%n",                                      false     },
+            { L_,   "%hhn",                                    false     },
+            { L_,   "%ls",                                     false     },
+            { L_,   "%lc",                                     false     },
+            { L_,   "%1$d",                                    false     },
+            { L_,   "%2$*1$d",                                 false     },
+            { L_,   "%q",                                      false     },
+            { L_,   "%k",                                      false     },
+            { L_,   "100%",                                    false     },
+            { L_,   "%-",                                      false     },
+            { L_,   "%012345678901234567890123456789d",        false     },
+            { L_,   "%01234567890123456789012345678d",         true      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE      = DATA[ti].d_line;
+            const char *FORMAT    = DATA[ti].d_format;
+            const bool  SUPPORTED = DATA[ti].d_supported;
+
+            bdlsb::MemOutStreamBuf arguments;
+
+            int n  = 0;
+            int rc = capture(&arguments, FORMAT, 0, 0, &n);
+
+            ASSERTV(LINE, FORMAT, rc, SUPPORTED == (0 == rc));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'captureArguments' AND 'formatArguments'
+        //
+        // Concerns:
+        //: 1 For each supported conversion, with each length modifier, the
+        //:   result of 'formatArguments' for the captured arguments is the
+        //:   same as that of 'vsnprintf' for the original arguments.
+        //:
+        //: 2 Flags, field widths, and precisions, including '*' field widths
+        //:   and precisions, are honored.
+        //:
+        //: 3 String arguments are copied, up to their precision, if any, and
+        //:   need not be null-terminated if a precision is specified.  A null
+        //:   string argument is formatted as "(null)", or, if the precision is
+        //:   less than 6, as an empty string, as glibc 'vsnprintf' does.
+        //:
+        //: 4 Conversions whose result is longer than the internal buffer are
+        //:   not truncated.
+        //:
+        //: 5 The text outside conversions is copied, and '%%' is formatted as
+        //:   '%'.
+        //:
+        //: 6 'formatArguments' appends to the output.
+        //:
+        //: 7 No memory is allocated from the default allocator, unless the
+        //:   result of a single conversion is longer than the internal buffer.
+        //
+        // Plan:
+        //: 1 For a set of format specifications and arguments covering each
+        //:   conversion and length modifier, capture and format the arguments,
+        //:   and compare the result with that of 'vsnprintf'.  (C-1..5)
+        //:
+        //: 2 Format captured arguments into a stream buffer that is not empty,
+        //:   and verify the result.  (C-6)
+        //:
+        //: 3 Verify that the default allocator is not used before formatting
+        //:   the conversions having a long result.  (C-7)
+        //
+        // Testing:
+        //   int captureArguments(MemOutStreamBuf *, const char *, va_list);
+        //   void formatArguments(StreamBuf *, const char *, const char *, N);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'captureArguments' AND 'formatArguments'" << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (veryVerbose) cout << "\tLiteral text" << endl;
+        {
+            check(L_, "");
+            check(L_, "no conversion");
+            check(L_, "%%");
+            check(L_, "50%% of %d%%", 8);
+        }
+
+        if (veryVerbose) cout << "\tSigned integers" << endl;
+        {
+            check(L_, "%d %i", 0, -1);
+            check(L_, "%d %d", INT_MAX, INT_MIN);
+            check(L_, "%hhd %hd", -3, 1234);
+            check(L_, "%ld %li", LONG_MAX, LONG_MIN);
+            check(L_, "%lld", LLONG_MIN);
+            check(L_, "%jd", static_cast<bsl::intmax_t>(-42));
+            check(L_, "%zd", static_cast<bsl::size_t>(4096));
+            check(L_, "%td", static_cast<bsl::ptrdiff_t>(-4096));
+            check(L_, "[%+5d] [%-5d] [%05d] [% d]", 12, 34, -56, 78);
+            check(L_, "[%.3d] [%8.3d]", 5, -5);
+        }
+
+        if (veryVerbose) cout << "\tUnsigned integers" << endl;
+        {
+            check(L_, "%u %o %x %X", 4000000000u, 8u, 255u, 0xBEEFu);
+            check(L_, "%#o %#x %#X", 8u, 255u, 255u);
+            check(L_, "%hhu %hu", 255, 65535);
+            check(L_, "%lu %lx", ULONG_MAX, 0xFEEDFACEul);
+            check(L_, "%llu %llX", ULLONG_MAX, 0xABCDEFull);
+            check(L_, "%ju", static_cast<bsl::uintmax_t>(99));
+            check(L_, "%zu %zx", static_cast<bsl::size_t>(-1),
+                                 static_cast<bsl::size_t>(31));
+            check(L_, "%tu", static_cast<bsl::ptrdiff_t>(7));
+        }
+
+        if (veryVerbose) cout << "\tCharacters and pointers" << endl;
+        {
+            check(L_, "%c%c%c", 'a', 'b', 'c');
+            check(L_, "[%3c] [%-3c]", 'x', 'y');
+            check(L_, "%p", static_cast<void *>(&verbose));
+            check(L_, "%p", static_cast<void *>(0));
+        }
+
+        if (veryVerbose) cout << "\tFloating-point" << endl;
+        {
+            check(L_, "%f %F", 3.25, -0.5);
+            check(L_, "%e %E", 12345.678, 1e-300);
+            check(L_, "%g %G", 0.0001, 1e20);
+            check(L_, "%a %A", 1.0, -2.5);
+            check(L_, "%.2f %10.4f %-10.1e|", 1.005, 3.14159, 2.5e10);
+            check(L_, "%+.0f %#.0f", 2.5, 3.0);
+            check(L_, "%Lf %Le", 1.5L, -7.25L);
+        }
+
+        if (veryVerbose) cout << "\tStrings" << endl;
+        {
+            check(L_, "%s", "");
+            check(L_, "%s and %s", "this", "that");
+            check(L_, "[%10s] [%-10s]", "right", "left");
+            check(L_, "[%.3s] [%.0s] [%.10s]", "abcdef", "abc", "abc");
+
+            const char notTerminated[] = { 'a', 'b', 'c', 'd' };
+            check(L_, "%.4s", notTerminated);
+            check(L_, "%.*s", 3, notTerminated);
+
+            const bsl::string longString(5000, 'q', &ta);
+            check(L_, "<%s>", longString.c_str());
+
+            const char *const nullString = 0;
+
+            bdlsb::MemOutStreamBuf arguments(&ta);
+            ASSERT(0 == capture(&arguments, "%s|%5s|%.2s|%.*s|%.6s",
+                                nullString, nullString, nullString,
+                                -1, nullString, nullString));
+
+            bdlsb::MemOutStreamBuf output(&ta);
+            Util::formatArguments(&output, "%s|%5s|%.2s|%.*s|%.6s",
+                                  arguments.data(), arguments.length());
+            ASSERTV(toString(output),
+                    "(null)|(null)||(null)|(null)" == toString(output));
+
+#if defined(__GLIBC__)
+            // Null strings are formatted by 'vsnprintf' in glibc only.
+
+            check(L_, "[%s] [%10s] [%-8s]", nullString, nullString,
+                                            nullString);
+            check(L_, "[%.0s] [%.2s] [%.5s] [%.6s] [%.10s]", nullString,
+                  nullString, nullString, nullString, nullString);
+            check(L_, "[%.*s] [%.*s] [%8.3s]", 3, nullString, -1, nullString,
+                  nullString);
+#endif
+        }
+
+        if (veryVerbose) cout << "\t'*' field width and precision" << endl;
+        {
+            check(L_, "[%*d]", 6, 42);
+            check(L_, "[%-*d]", 6, 42);
+            check(L_, "[%*d]", -6, 42);
+            check(L_, "[%.*f]", 3, 2.71828);
+            check(L_, "[%*.*f]", 10, 2, 2.71828);
+            check(L_, "[%.*s]", -1, "negative precision");
+            check(L_, "[%*.*s]", 8, 3, "abcdef");
+        }
+
+        if (veryVerbose) cout << "\tMixed" << endl;
+        {
+            check(L_, "%s=%d (%.2f%%) @%p %c",
+                  "ratio", 17, 42.125, static_cast<void *>(0), 'z');
+        }
+
+        if (veryVerbose) cout << "\tAppending" << endl;
+        {
+            bdlsb::MemOutStreamBuf arguments(&ta);
+            ASSERT(0 == capture(&arguments, "%d-%s", 1, "two"));
+
+            bdlsb::MemOutStreamBuf output(&ta);
+            output.sputn("prefix:", 7);
+            Util::formatArguments(&output, "%d-%s", arguments.data(),
+                                  arguments.length());
+            ASSERTV(toString(output), "prefix:1-two" == toString(output));
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) cout << "\tLong conversions" << endl;
+        {
+            check(L_, "%f", 1e300);
+            check(L_, "<%5000s>", "short");
+            check(L_, "<%-300d>", 1);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Capture and format the arguments of a simple message.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bdlsb::MemOutStreamBuf arguments;
+        ASSERT(0 == capture(&arguments, "%s %d", "answer", 42));
+        ASSERT(0 <  arguments.length());
+
+        bdlsb::MemOutStreamBuf output;
+        Util::formatArguments(&output, "%s %d", arguments.data(),
+                              arguments.length());
+        ASSERTV(toString(output), "answer 42" == toString(output));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
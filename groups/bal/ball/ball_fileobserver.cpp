@@ -11,10 +11,15 @@ BSLS_IDENT_RCSID(ball_fileobserver_cpp,"$Id$ $CSID$")
 #include <ball_record.h>
 #include <ball_streamobserver.h>              // for testing only
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bslmt_lockguard.h>
 
+#include <bsls_assert.h>
+
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>                      // for 'bsl::strcmp'
+#include <bsl_ostream.h>
 #include <bsl_sstream.h>
 
 namespace BloombergLP {
@@ -236,6 +241,42 @@ void FileObserver::publish(const Record& record, const Context& context)
     d_fileObserver2.publish(record, context);
 }
 
+void FileObserver::publishBatch(
+                               const bsl::shared_ptr<const Record> *records,
+                               int                                  numRecords,
+                               bool                                 syncFlag)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // Format the records to be written to 'stdout', if any, into a buffer
+    // supplied by the allocator of this observer, and write them together.
+
+    int i = 0;
+    while (i < numRecords
+        && records[i]->fixedFields().severity() > d_stdoutThreshold) {
+        ++i;
+    }
+
+    if (i < numRecords) {
+        bdlsb::MemOutStreamBuf buffer(allocator());
+        bsl::ostream           stream(&buffer);
+
+        for (; i < numRecords; ++i) {
+            if (records[i]->fixedFields().severity() <= d_stdoutThreshold) {
+                d_stdoutFormatter(stream, *records[i]);
+            }
+        }
+
+        bsl::fwrite(buffer.data(), 1, buffer.length(), stdout);
+        bsl::fflush(stdout);
+    }
+
+    d_fileObserver2.publishBatch(records, numRecords, syncFlag);
+}
+
 void FileObserver::setLogFormat(const char *logFileFormat,
                                 const char *stdoutFormat)
 {
@@ -683,6 +683,23 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                  numRecords,
+                      bool                                 syncFlag = false);
+        // Process the specified 'numRecords' records referenced by the
+        // elements of the specified 'records' array by writing them, in
+        // order, to the current log file if file logging is enabled for this
+        // file observer, and to 'stdout' those records whose severity is at
+        // least as severe as the value returned by 'stdoutThreshold'.  The
+        // records written to the log file are formatted into a reusable
+        // buffer and written using a single output operation, and those
+        // written to 'stdout' are also written together.  If the optionally
+        // specified 'syncFlag' is 'true', block until the records written to
+        // the log file are committed to the storage device.  The behavior is
+        // undefined unless '0 <= numRecords' and each of the first
+        // 'numRecords' elements of 'records' refers to a record.  See
+        // 'FileObserver2::publishBatch' for details.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -36,6 +36,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 
 #include <bslstl_stringref.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
@@ -51,6 +52,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -547,36 +549,120 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
     return returnStatus;
 }
 
-int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
-                                     const bdlt::Datetime&  currentLogTimeUtc)
+bool FileObserver2::isRotationDue(const bdlt::Datetime& currentLogTimeUtc,
+                                  bsls::Types::Uint64   numPendingBytes)
 {
     BSLS_ASSERT(d_rotationSize >= 0);
     BSLS_ASSERT(d_rotationInterval.totalSeconds() >= 0);
-    BSLS_ASSERT(rotatedLogFileName);
-
-    if (!d_logStreamBuf.isOpened()) {
-        return 1;                                                     // RETURN
-    }
+    BSLS_ASSERT(d_logStreamBuf.isOpened());
 
     if (d_rotationSize) {
         // 'tellp' returns -1 on failure.  Rotate the log file if either
         // 'tellp' fails, or the rotation size is exceeded.
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
+        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp())
+                                                           + numPendingBytes >
             static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
-
-            return rotateFile(rotatedLogFileName);                    // RETURN
+            return true;                                              // RETURN
         }
     }
 
-    if (d_rotationInterval.totalSeconds()
-        && d_nextRotationTimeUtc <= currentLogTimeUtc) {
+    return d_rotationInterval.totalSeconds()
+        && d_nextRotationTimeUtc <= currentLogTimeUtc;
+}
+
+int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
+                                     const bdlt::Datetime&  currentLogTimeUtc)
+{
+    BSLS_ASSERT(rotatedLogFileName);
+
+    if (!d_logStreamBuf.isOpened()) {
+        return 1;                                                     // RETURN
+    }
+
+    if (isRotationDue(currentLogTimeUtc, 0)) {
         return rotateFile(rotatedLogFileName);                        // RETURN
     }
 
     return 1;
 }
 
+int FileObserver2::writeBatchBuffer(bool syncFlag)
+{
+    BSLS_ASSERT(d_logStreamBuf.isOpened());
+
+    const char  *data   = d_batchStreamBuf.data();
+    bsl::size_t  length = d_batchStreamBuf.length();
+
+    // Empty the buffer of the file stream first, so that anything it holds is
+    // written ahead of the batch.
+
+    int rc = d_logStreamBuf.pubsync();
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    // The log file is opened in text mode, so the batch must go through the
+    // stream buffer for the line endings to be translated.
+
+    if (0 == rc && length) {
+        const bsl::streamsize numBytes = static_cast<bsl::streamsize>(length);
+
+        rc = numBytes == d_logStreamBuf.sputn(data, numBytes)
+           ? d_logStreamBuf.pubsync()
+           : -1;
+    }
+
+    if (0 == rc && syncFlag) {
+        rc = FlushFileBuffers(d_logStreamBuf.fileDescriptor()) ? 0 : -1;
+    }
+#else
+    const bdls::FilesystemUtil::FileDescriptor fd =
+                                               d_logStreamBuf.fileDescriptor();
+
+    while (0 == rc && length) {
+        const int numBytes = length < static_cast<bsl::size_t>(INT_MAX)
+                           ? static_cast<int>(length)
+                           : INT_MAX;
+        const int written  = bdls::FilesystemUtil::write(fd, data, numBytes);
+        if (0 < written) {
+            data   += written;
+            length -= written;
+        }
+        else if (EINTR != errno) {
+            rc = -1;
+        }
+    }
+
+    if (0 == rc && syncFlag) {
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_SOLARIS)
+        rc = ::fdatasync(fd);
+#else
+        rc = ::fsync(fd);
+#endif
+    }
+#endif
+
+    d_batchStreamBuf.pubseekpos(0);
+    d_batchOutStream.clear();
+
+    if (0 != rc) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Error on file stream for %s: %s.",
+                 d_logFileName.c_str(),
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+
+        d_logStreamBuf.clear();
+    }
+
+    return rc;
+}
+
 // PRIVATE ACCESSORS
 template <class STRING>
 bool FileObserver2::isFileLoggingEnabledImpl(STRING *result) const
@@ -615,6 +701,8 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_batchStreamBuf(basicAllocator)
+, d_batchOutStream(&d_batchStreamBuf)
 {
 }
 
@@ -778,6 +866,67 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(
+                               const bsl::shared_ptr<const Record> *records,
+                               int                                  numRecords,
+                               bool                                 syncFlag)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    bsl::string rotatedFileName;
+    int         rotationStatus = 1;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_logStreamBuf.isOpened()) {
+            return;                                                   // RETURN
+        }
+
+        for (int i = 0; i < numRecords; ++i) {
+            BSLS_ASSERT(records[i]);
+
+            const Record& record = *records[i];
+
+            if (0 < rotationStatus
+             && isRotationDue(record.fixedFields().timestamp(),
+                              d_batchStreamBuf.length())) {
+                // Complete the old log file with the records formatted so far
+                // before rotating it.
+
+                if (0 != writeBatchBuffer(false)) {
+                    break;
+                }
+
+                rotationStatus = rotateFile(&rotatedFileName);
+
+                if (!d_logStreamBuf.isOpened()) {
+                    break;
+                }
+            }
+
+            d_logFileFunctor(d_batchOutStream, record);
+        }
+
+        if (d_logStreamBuf.isOpened()) {
+            writeBatchBuffer(syncFlag);
+        }
+        else {
+            d_batchStreamBuf.pubseekpos(0);
+            d_batchOutStream.clear();
+        }
+    }
+
+    if (0 >= rotationStatus) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+        if (d_onRotationCb) {
+            d_onRotationCb(rotationStatus, rotatedFileName);
+        }
+    }
+}
+
 void FileObserver2::suppressUniqueFileNameOnRotation(bool suppress)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -351,6 +351,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -362,6 +364,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_mutex.h>
 
 #include <bsls_libraryfeatures.h>
+#include <bsls_types.h>
 
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
@@ -473,6 +476,16 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // reusable buffer into
+                                                       // which a batch of
+                                                       // records is formatted
+                                                       // (see 'publishBatch')
+
+    bsl::ostream           d_batchOutStream;           // output stream for
+                                                       // batch formatting
+                                                       // (refers to
+                                                       // 'd_batchStreamBuf')
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -494,6 +507,16 @@ class FileObserver2 : public Observer {
         // filename, as determined by the 'logFilenamePattern' of the latest
         // call to 'enableFileLogging', is the same as the old log filename.
 
+    bool isRotationDue(const bdlt::Datetime& currentLogTimeUtc,
+                       bsls::Types::Uint64   numPendingBytes);
+        // Return 'true' if a log file rotation is due, either because the
+        // specified 'currentLogTimeUtc' is later than the scheduled rotation
+        // time of the current log file, or because the size of the log file,
+        // augmented by the specified 'numPendingBytes' not yet written to it,
+        // is larger than the allowable size, and 'false' otherwise.  The
+        // behavior is undefined unless the caller acquired the lock for this
+        // object and file logging is enabled.
+
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
         // Perform log file rotation if the specified 'currentLogTimeUtc' is
@@ -507,6 +530,16 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods, respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    int writeBatchBuffer(bool syncFlag);
+        // Write the contents of the batch buffer to the current log file
+        // using a single output operation (where the platform permits), then
+        // empty the batch buffer.  If the specified 'syncFlag' is 'true',
+        // block until the written data is committed to the storage device.
+        // Return 0 on success, and a non-zero value otherwise, in which case
+        // the log file is closed.  The behavior is undefined unless the
+        // caller acquired the lock for this object and file logging is
+        // enabled.
+
     // PRIVATE ACCESSORS
     template <class t_STRING>
     bool isFileLoggingEnabledImpl(t_STRING *result) const;
@@ -627,6 +660,26 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                  numRecords,
+                      bool                                 syncFlag = false);
+        // Process the specified 'numRecords' records referenced by the
+        // elements of the specified 'records' array by writing them, in
+        // order, to the current log file if file logging is enabled for this
+        // file observer.  The records are formatted into a buffer that is
+        // reused from one call to the next, and written to the log file using
+        // a single output operation, unless a log file rotation is due part
+        // way through the batch, in which case the records preceding the
+        // rotation are written to the rotated log file.  At most one rotation
+        // is performed per call.  If the optionally specified 'syncFlag' is
+        // 'true', block until the written records are committed to the
+        // storage device (e.g., using 'fdatasync').  The method has no effect
+        // if file logging is not enabled, in which case the records are
+        // dropped.  The behavior is undefined unless '0 <= numRecords' and
+        // each of the first 'numRecords' elements of 'records' refers to a
+        // record.  Note that this method produces the same output as calling
+        // 'publish' for each record in turn.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
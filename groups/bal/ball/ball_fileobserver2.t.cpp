@@ -44,6 +44,7 @@
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -53,6 +54,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -106,6 +108,7 @@ using bsl::flush;
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const shared_ptr<const Record> *, int, bool);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
@@ -123,7 +126,8 @@ using bsl::flush;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
+// [14] CONCERN: BATCH OUTPUT IS IDENTICAL TO PER-RECORD OUTPUT
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -640,7 +644,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -715,6 +719,224 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes to the log file exactly what publishing
+        //:   each record of the batch in turn with 'publish' writes, with
+        //:   both the default and a user-supplied log record functor, and
+        //:   whether or not the 'syncFlag' is 'true'.
+        //:
+        //: 2 Publishing an empty batch has no effect.
+        //:
+        //: 3 Records of a batch are dropped if file logging is not enabled.
+        //:
+        //: 4 The batch buffer is reused from one batch to the next, so that
+        //:   a batch no larger than a previous one does not allocate memory.
+        //:
+        //: 5 A rotation that falls due part way through a batch is performed
+        //:   and the records of the batch are split between the rotated and
+        //:   the new log files.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records, with fixed timestamps, to one
+        //:   observer using 'publish' and to another using 'publishBatch'
+        //:   (in batches of varying sizes), then compare the content of the
+        //:   two log files.  (C-1..2)
+        //:
+        //: 2 Call 'publishBatch' on an observer not logging to a file and
+        //:   verify that no file is created.  (C-3)
+        //:
+        //: 3 Publish a batch twice using an object allocator, and verify that
+        //:   the second call does not allocate.  (C-4)
+        //:
+        //: 4 Enable rotation on size with a small size, publish a batch
+        //:   larger than that size, and verify the invocation of the rotation
+        //:   callback and the content of both files.  (C-5)
+        //
+        // Testing:
+        //   void publishBatch(const shared_ptr<const Record> *, int, bool);
+        //   CONCERN: BATCH OUTPUT IS IDENTICAL TO PER-RECORD OUTPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int NUM_RECORDS = 100;
+
+        bsl::vector<bsl::shared_ptr<const ball::Record> > records(&ta);
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::shared_ptr<ball::Record> record =
+                                 bsl::allocate_shared<ball::Record>(&ta);
+
+            bsl::ostringstream message;
+            message << "record " << i << bsl::string(i % 17, '.');
+
+            record->fixedFields().setTimestamp(
+                                   bdlt::Datetime(2023, 1, 2, 3, 4, 5, i));
+            record->fixedFields().setProcessID(1234);
+            record->fixedFields().setThreadID(i);
+            record->fixedFields().setFileName(__FILE__);
+            record->fixedFields().setLineNumber(__LINE__);
+            record->fixedFields().setCategory("batch");
+            record->fixedFields().setSeverity(ball::Severity::e_INFO);
+            record->fixedFields().setMessage(message.str().c_str());
+
+            records.push_back(record);
+        }
+
+        const int BATCH_SIZES[] = { 1, 3, 10, 0, 37, 49 };
+        const int NUM_BATCH_SIZES = static_cast<int>(
+                                   sizeof BATCH_SIZES / sizeof *BATCH_SIZES);
+
+        if (verbose) cout << "\tComparing with per-record output." << endl;
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const bool CUSTOM = ti / 2;
+            const bool SYNC   = ti % 2;
+
+            if (veryVerbose) { T_ P_(CUSTOM) P(SYNC) }
+
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bsl::string              expFileName(fileName);
+            bdls::PathUtil::appendRaw(&expFileName, "expected.log");
+            bdls::PathUtil::appendRaw(&fileName,    "batch.log");
+
+            Obj mE(&ta);
+            Obj mX(&ta);
+
+            if (CUSTOM) {
+                mE.setLogFileFunctor(&logRecord1);
+                mX.setLogFileFunctor(&logRecord1);
+            }
+
+            ASSERT(0 == mE.enableFileLogging(expFileName.c_str()));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            ball::Context context;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mE.publish(records[i], context);
+            }
+
+            int offset = 0;
+            for (int i = 0; offset < NUM_RECORDS; ++i) {
+                const int size = bsl::min(BATCH_SIZES[i % NUM_BATCH_SIZES],
+                                          NUM_RECORDS - offset);
+
+                mX.publishBatch(records.data() + offset, size, SYNC);
+                offset += size;
+            }
+
+            mE.disableFileLogging();
+            mX.disableFileLogging();
+
+            bsl::string expContent;
+            bsl::string content;
+            const int   expNumLines = readFileIntoString(__LINE__,
+                                                         expFileName,
+                                                         expContent);
+            const int   numLines    = readFileIntoString(__LINE__,
+                                                         fileName,
+                                                         content);
+
+            ASSERTV(CUSTOM, SYNC, 0 < expNumLines);
+            ASSERTV(CUSTOM, SYNC, expNumLines, numLines,
+                    expNumLines == numLines);
+            ASSERTV(CUSTOM, SYNC, expContent == content);
+        }
+
+        if (verbose) cout << "\tTesting with file logging disabled." << endl;
+        {
+            Obj mX(&ta);
+
+            mX.publishBatch(records.data(), NUM_RECORDS);
+            mX.publishBatch(records.data(), 0);
+
+            ASSERT(false == mX.isFileLoggingEnabled());
+        }
+
+        if (verbose) cout << "\tTesting reuse of the batch buffer." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "batch.log");
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(records.data(), NUM_RECORDS);
+
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mX.publishBatch(records.data(), NUM_RECORDS);
+
+            ASSERTV(NUM_ALLOCATIONS, oa.numAllocations(),
+                    NUM_ALLOCATIONS == oa.numAllocations());
+
+            mX.disableFileLogging();
+        }
+
+        if (verbose) cout << "\tTesting rotation within a batch." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "batch.log");
+
+            Obj mX(&ta);
+
+            RotCb cb(&ta);
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(records.data(), NUM_RECORDS);
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+            ASSERTV(fileName != cb.rotatedFileName());
+
+            mX.disableFileLogging();
+
+            // Note that 'readFileIntoString' cannot be used to read the new
+            // log file, whose name is a prefix of the rotated log file name.
+
+            bsl::string rotatedContent;
+            const int   numRotatedLines = readFileIntoString(
+                                                         __LINE__,
+                                                         cb.rotatedFileName(),
+                                                         rotatedContent);
+
+            bsl::ifstream fs(fileName.c_str());
+            ASSERT(fs.is_open());
+
+            bsl::string line;
+            int         numLines = 0;
+            while (getline(fs, line)) {
+                ++numLines;
+            }
+            fs.close();
+
+            // The default format writes each record on 2 lines.
+
+            ASSERTV(numRotatedLines, 0 < numRotatedLines);
+            ASSERTV(numLines,        0 < numLines);
+            ASSERTV(numRotatedLines, numLines,
+                    2 * NUM_RECORDS == numRotatedLines + numLines);
+
+            // The rotation falls due once the size exceeds 1 kilobyte.
+
+            ASSERTV(rotatedContent.size(), 1024 < rotatedContent.size());
+            ASSERTV(rotatedContent.size(), 2048 > rotatedContent.size());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -48,6 +48,13 @@ BSLS_IDENT("$Id: $")
 //  BALL_LOGVA_ERROR(MSG, ...): produce 'e_ERROR' record using 'printf' format
 //  BALL_LOGVA_FATAL(MSG, ...): produce 'e_FATAL' record using 'printf' format
 //  BALL_LOGVA(SEV, MSG, ...): produce a 'SEV' log record using 'printf' format
+//  BALL_LOGVA_DEFERRED_TRACE(MSG, ...): 'e_TRACE' record, deferred formatting
+//  BALL_LOGVA_DEFERRED_DEBUG(MSG, ...): 'e_DEBUG' record, deferred formatting
+//  BALL_LOGVA_DEFERRED_INFO( MSG, ...): 'e_INFO' record, deferred formatting
+//  BALL_LOGVA_DEFERRED_WARN( MSG, ...): 'e_WARN' record, deferred formatting
+//  BALL_LOGVA_DEFERRED_ERROR(MSG, ...): 'e_ERROR' record, deferred formatting
+//  BALL_LOGVA_DEFERRED_FATAL(MSG, ...): 'e_FATAL' record, deferred formatting
+//  BALL_LOGVA_DEFERRED(SEV, MSG, ...): 'SEV' record, deferred formatting
 //  BALL_LOG_TRACE_BLOCK: set code block with 'e_TRACE' condition of execution
 //  BALL_LOG_DEBUG_BLOCK: set code block with 'e_DEBUG' condition of execution
 //  BALL_LOG_INFO_BLOCK: set a code block with 'e_INFO' condition of execution
@@ -344,6 +351,33 @@ BSLS_IDENT("$Id: $")
 //      compatible with the format specification in 'MSG'.  Note that each use
 //      of this macro must be terminated by a ';'.
 //..
+// The following macros are variants of the above 'printf'-style macros that
+// defer the formatting of the message:
+//..
+//  BALL_LOGVA_DEFERRED_TRACE(MSG, ...);
+//  BALL_LOGVA_DEFERRED_DEBUG(MSG, ...);
+//  BALL_LOGVA_DEFERRED_INFO( MSG, ...);
+//  BALL_LOGVA_DEFERRED_WARN( MSG, ...);
+//  BALL_LOGVA_DEFERRED_ERROR(MSG, ...);
+//  BALL_LOGVA_DEFERRED_FATAL(MSG, ...);
+//  BALL_LOGVA_DEFERRED(SEVERITY, MSG, ...);
+//      Log, with the severity indicated by the name of the macro or with the
+//      specified 'SEVERITY', a record whose message is the result of
+//      formatting the specified '...' optional arguments, if any, according
+//      to the 'printf'-style format specification in the specified 'MSG'
+//      (assumed to be of type convertible to 'const char *').  The arguments
+//      are captured (and string arguments copied) when the record is logged,
+//      but the message is formatted only when it is first accessed, e.g., by
+//      the publication thread of a 'ball::AsyncFileObserver' (see
+//      {'ball_recordattributes'|Deferred Formatting}).  If 'MSG' contains a
+//      conversion that cannot be deferred (see
+//      {'ball_deferredformatutil'|Supported Conversions}), the message is
+//      formatted when the record is logged.  The behavior is undefined unless
+//      the number and types of optional arguments are compatible with the
+//      format specification in 'MSG', and 'MSG' remains valid and unchanged
+//      until the record is published (e.g., 'MSG' is a string literal).  Note
+//      that each use of these macros must be terminated by a ';'.
+//..
 //
 ///Macros for Logging Code Blocks
 /// - - - - - - - - - - - - - - -
@@ -1327,6 +1361,24 @@ do {                                                                          \
     }                                                                         \
 } while(0)
 
+// BALL_LOGVA_DEFERRED_CONST_IMP requires its first argument to be a
+// compile-time constant, while all the others may be variables.
+
+#define BALL_LOGVA_DEFERRED_CONST_IMP(SEVERITY, ...)                          \
+do {                                                                          \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BloombergLP::ball::Log_DeferredFormatter ball_log_fOrMaTtEr(          \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       (SEVERITY));                           \
+        ball_log_fOrMaTtEr.record()->fixedFields().setDeferredMessage(        \
+                                                                 __VA_ARGS__);\
+    }                                                                         \
+} while(0)
+
                        // =====================
                        // 'printf'-style macros
                        // =====================
@@ -1370,6 +1422,51 @@ do {                                                                          \
 #define BALL_LOGVA_FATAL(...)                                                 \
     BALL_LOGVA_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
 
+                   // ===================================
+                   // Deferred-formatting 'printf' macros
+                   // ===================================
+
+#define BALL_LOGVA_DEFERRED(SEVERITY, ...)                                    \
+do {                                                                          \
+    const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =        \
+                         ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
+    if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
+           BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
+                                                     (SEVERITY))) {           \
+        BloombergLP::ball::Log_DeferredFormatter ball_log_fOrMaTtEr(          \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       (SEVERITY));                           \
+        ball_log_fOrMaTtEr.record()->fixedFields().setDeferredMessage(        \
+                                                                 __VA_ARGS__);\
+    }                                                                         \
+} while(0)
+
+#define BALL_LOGVA_DEFERRED_TRACE(...)                                        \
+    BALL_LOGVA_DEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_TRACE,       \
+                                  __VA_ARGS__)
+
+#define BALL_LOGVA_DEFERRED_DEBUG(...)                                        \
+    BALL_LOGVA_DEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG,       \
+                                  __VA_ARGS__)
+
+#define BALL_LOGVA_DEFERRED_INFO( ...)                                        \
+    BALL_LOGVA_DEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_INFO,        \
+                                  __VA_ARGS__)
+
+#define BALL_LOGVA_DEFERRED_WARN( ...)                                        \
+    BALL_LOGVA_DEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_WARN,        \
+                                  __VA_ARGS__)
+
+#define BALL_LOGVA_DEFERRED_ERROR(...)                                        \
+    BALL_LOGVA_DEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_ERROR,       \
+                                  __VA_ARGS__)
+
+#define BALL_LOGVA_DEFERRED_FATAL(...)                                        \
+    BALL_LOGVA_DEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_FATAL,       \
+                                  __VA_ARGS__)
+
                        // ==============
                        // Utility Macros
                        // ==============
@@ -1764,6 +1861,75 @@ class Log_Formatter {
         // Return the severity held by this logging formatter.
 };
 
+                       // ===========================
+                       // class Log_DeferredFormatter
+                       // ===========================
+
+class Log_DeferredFormatter {
+    // This class provides an aggregate of several objects relevant to the
+    // logging of a message via the deferred-formatting 'printf'-style macros:
+    //..
+    //  - record to be logged
+    //  - category to which to log the record
+    //  - severity at which to log the record
+    //..
+    // As a side-effect of creating an object of this class, the record is
+    // constructed.  As a side-effect of destroying the object, the record,
+    // whose message is expected to have been set by 'setDeferredMessage', is
+    // logged.
+    //
+    // This class should *not* be used directly by client code.  It is an
+    // implementation detail of the macros provided by this component.
+
+    // DATA
+    const Category *d_category_p;  // category to which record is logged
+                                   // (held, not owned)
+
+    Record         *d_record_p;    // logged record (held, not owned)
+
+    const int       d_severity;    // severity at which record is logged
+
+  private:
+    // NOT IMPLEMENTED
+    Log_DeferredFormatter(const Log_DeferredFormatter&);
+    Log_DeferredFormatter& operator=(const Log_DeferredFormatter&);
+
+  public:
+    // CREATORS
+    Log_DeferredFormatter(const Category *category,
+                          const char     *fileName,
+                          int             lineNumber,
+                          int             severity);
+        // Create a deferred logging formatter that holds (1) the specified
+        // 'category' and 'severity', and (2) a record that is created from
+        // the specified 'fileName' and 'lineNumber'.
+
+    ~Log_DeferredFormatter();
+        // Log the record held by this deferred logging formatter to the held
+        // category (as returned by 'category') at the held severity (as
+        // returned by 'severity'), and destroy this deferred logging
+        // formatter.
+
+    // MANIPULATORS
+    Record *record();
+        // Return the address of the modifiable log record held by this
+        // deferred logging formatter.  The address remains valid until this
+        // deferred logging formatter is destroyed.
+
+    // ACCESSORS
+    const Category *category() const;
+        // Return the address of the non-modifiable category held by this
+        // deferred logging formatter.
+
+    const Record *record() const;
+        // Return the address of the non-modifiable log record held by this
+        // deferred logging formatter.  The address remains valid until this
+        // deferred logging formatter is destroyed.
+
+    int severity() const;
+        // Return the severity held by this deferred logging formatter.
+};
+
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
@@ -1894,6 +2060,36 @@ const Record *Log_Formatter::record() const
 
 inline
 int Log_Formatter::severity() const
+{
+    return d_severity;
+}
+
+                       // ---------------------------
+                       // class Log_DeferredFormatter
+                       // ---------------------------
+
+// MANIPULATORS
+inline
+Record *Log_DeferredFormatter::record()
+{
+    return d_record_p;
+}
+
+// ACCESSORS
+inline
+const Category *Log_DeferredFormatter::category() const
+{
+    return d_category_p;
+}
+
+inline
+const Record *Log_DeferredFormatter::record() const
+{
+    return d_record_p;
+}
+
+inline
+int Log_DeferredFormatter::severity() const
 {
     return d_severity;
 }
@@ -168,10 +168,17 @@ using bsl::flush;
 // [31] CONCERN: 'BALL_LOGCB_*_BLOCK' MACROS
 // [32] CONCERN: DEGENERATE LOG MACROS USAGE
 // [36] CONCERN: The logging macros can be used recursively
-// [37] USAGE EXAMPLE
-// [38] RULE-BASED LOGGING USAGE EXAMPLE
-// [39] CLASS-SCOPE LOGGING USAGE EXAMPLE
-// [40] BASIC LOGGING USAGE EXAMPLE
+// [37] BALL_LOGVA_DEFERRED
+// [37] BALL_LOGVA_DEFERRED_TRACE
+// [37] BALL_LOGVA_DEFERRED_DEBUG
+// [37] BALL_LOGVA_DEFERRED_INFO
+// [37] BALL_LOGVA_DEFERRED_WARN
+// [37] BALL_LOGVA_DEFERRED_ERROR
+// [37] BALL_LOGVA_DEFERRED_FATAL
+// [38] USAGE EXAMPLE
+// [39] RULE-BASED LOGGING USAGE EXAMPLE
+// [40] CLASS-SCOPE LOGGING USAGE EXAMPLE
+// [41] BASIC LOGGING USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -640,6 +647,62 @@ void processData(int                      uuid,
 }  // close enterprise namespace
 
 
+// ============================================================================
+//                         CASE 37 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_37 {
+
+class DeferredCheckingObserver : public BloombergLP::ball::Observer {
+    // This concrete implementation of 'ball::Observer' stores, for each
+    // record published to it, whether the message of the record was deferred
+    // when the record was published, and the message of the record.
+
+    // DATA
+    bsl::vector<bool>        d_wasDeferred;  // deferred state on publication
+    bsl::vector<bsl::string> d_messages;     // published messages
+
+  public:
+    // CREATORS
+    explicit
+    DeferredCheckingObserver(BloombergLP::bslma::Allocator *basicAllocator)
+        // Create an observer that has not been published to.  Use the
+        // specified 'basicAllocator' to supply memory.
+    : d_wasDeferred(basicAllocator)
+    , d_messages(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    void publish(const bsl::shared_ptr<const BloombergLP::ball::Record>&
+                                                                  record,
+                 const BloombergLP::ball::Context&) BSLS_KEYWORD_OVERRIDE
+        // Store whether the message of the specified 'record' is deferred,
+        // and then the message.
+    {
+        d_wasDeferred.push_back(record->fixedFields().isMessageDeferred());
+        d_messages.push_back(record->fixedFields().messageRef());
+    }
+
+    // ACCESSORS
+    const bsl::vector<bsl::string>& messages() const
+        // Return the messages of the records published to this observer.
+    {
+        return d_messages;
+    }
+
+    const bsl::vector<bool>& wasDeferred() const
+        // Return, for each record published to this observer, whether its
+        // message was deferred when it was published.
+    {
+        return d_wasDeferred;
+    }
+};
+
+}  // close namespace BALL_LOG_TEST_CASE_37
+
 // ============================================================================
 //                         CASE 35 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2884,7 +2947,7 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 40: {
+      case 41: {
         // --------------------------------------------------------------------
         // BASIC LOGGING USAGE EXAMPLE
         //
@@ -2960,7 +3023,7 @@ if (verbose) bsl::cout << "Example 1: A Basic Logging Example" << bsl::endl;
 // logging configuration.  The special macro 'BALL_LOG_OUTPUT_STREAM' provides
 // access to the log stream within the code.
       } break;
-      case 39: {
+      case 40: {
         // --------------------------------------------------------------------
         // CLASS-SCOPE LOGGING USAGE EXAMPLE
         //
@@ -3027,7 +3090,7 @@ if (verbose) bsl::cout << "Example 1: A Basic Logging Example" << bsl::endl;
         }
 
       } break;
-      case 38: {
+      case 39: {
         // --------------------------------------------------------------------
         // RULE-BASED LOGGING USAGE EXAMPLE
         //
@@ -3104,7 +3167,7 @@ if (verbose) bsl::cout << "Example 1: A Basic Logging Example" << bsl::endl;
 //  ERROR example.cpp:129 EXAMPLE.CATEGORY Processing the third message.
 //..
       } break;
-      case 37: {
+      case 38: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -3361,6 +3424,148 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
         }
 
       } break;
+      case 37: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED-FORMATTING 'printf'-STYLE MACROS
+        //
+        // Concerns:
+        //: 1 Each macro logs a record, at the severity indicated by its name
+        //:   or argument, whose message is the result of formatting its
+        //:   arguments.
+        //:
+        //: 2 The message of the logged record is not formatted before the
+        //:   record is published.
+        //:
+        //: 3 The arguments of the macros are evaluated only if the record is
+        //:   logged.
+        //:
+        //: 4 A message using a conversion that cannot be deferred is formatted
+        //:   when the record is logged.
+        //
+        // Plan:
+        //: 1 Register an observer that stores, for each published record,
+        //:   whether the message was deferred, and the message.  Invoke each
+        //:   macro with a threshold that enables all severities, and verify
+        //:   the published records.  (C-1..2)
+        //:
+        //: 2 Raise the threshold, invoke the macros with arguments having a
+        //:   side-effect, and verify that no record is published and the
+        //:   side-effect does not occur.  (C-3)
+        //:
+        //: 3 Invoke 'BALL_LOGVA_DEFERRED' with a positional conversion, and
+        //:   verify the published record.  (C-4)
+        //
+        // Testing:
+        //   BALL_LOGVA_DEFERRED
+        //   BALL_LOGVA_DEFERRED_TRACE
+        //   BALL_LOGVA_DEFERRED_DEBUG
+        //   BALL_LOGVA_DEFERRED_INFO
+        //   BALL_LOGVA_DEFERRED_WARN
+        //   BALL_LOGVA_DEFERRED_ERROR
+        //   BALL_LOGVA_DEFERRED_FATAL
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout
+                   << bsl::endl
+                   << "TESTING DEFERRED-FORMATTING 'printf'-STYLE MACROS\n"
+                   << "=================================================\n";
+
+        using namespace BALL_LOG_TEST_CASE_37;
+
+        BloombergLP::ball::LoggerManagerConfiguration lmc;
+        BloombergLP::ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        LoggerManager& manager = LoggerManager::singleton();
+
+        bsl::shared_ptr<DeferredCheckingObserver> observer(
+                              new (ta) DeferredCheckingObserver(&ta), &ta);
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+        ASSERT(0 != manager.setCategory("Deferred",
+                                        Sev::e_OFF,
+                                        Sev::e_TRACE,
+                                        Sev::e_OFF,
+                                        Sev::e_OFF));
+
+        BALL_LOG_SET_CATEGORY("Deferred");
+
+        if (verbose) cout << "\tTesting enabled macros." << endl;
+        {
+            char name[] = "name";
+
+            BALL_LOGVA_DEFERRED_TRACE("trace %d %s", 1, name);
+            BALL_LOGVA_DEFERRED_DEBUG("debug %.1f", 2.5);
+            BALL_LOGVA_DEFERRED_INFO( "info %c%c", 'o', 'k');
+            BALL_LOGVA_DEFERRED_WARN( "warn %5s|", "x");
+            BALL_LOGVA_DEFERRED_ERROR("error %x", 255u);
+            BALL_LOGVA_DEFERRED_FATAL("fatal %s", "end");
+            BALL_LOGVA_DEFERRED(Sev::e_INFO, "runtime %lld", -7LL);
+            BALL_LOGVA_DEFERRED(Sev::e_WARN, "no arguments");
+
+            name[0] = 'N';
+
+            const char *const EXPECTED[] = {
+                "trace 1 name",
+                "debug 2.5",
+                "info ok",
+                "warn     x|",
+                "error ff",
+                "fatal end",
+                "runtime -7",
+                "no arguments"
+            };
+            const bsl::size_t NUM_EXPECTED =
+                                          sizeof EXPECTED / sizeof *EXPECTED;
+
+            ASSERTV(observer->messages().size(),
+                    NUM_EXPECTED == observer->messages().size());
+
+            for (bsl::size_t i = 0; i < observer->messages().size(); ++i) {
+                ASSERTV(i, observer->wasDeferred()[i]);
+                ASSERTV(i, observer->messages()[i], EXPECTED[i],
+                        EXPECTED[i] == observer->messages()[i]);
+            }
+        }
+
+        if (verbose) cout << "\tTesting disabled macros." << endl;
+        {
+            ASSERT(0 != manager.setCategory("Deferred",
+                                            Sev::e_OFF,
+                                            Sev::e_ERROR,
+                                            Sev::e_OFF,
+                                            Sev::e_OFF));
+
+            const bsl::size_t numPublished = observer->messages().size();
+
+            int count = 0;
+
+            BALL_LOGVA_DEFERRED_TRACE("%d", ++count);
+            BALL_LOGVA_DEFERRED_DEBUG("%d", ++count);
+            BALL_LOGVA_DEFERRED_INFO( "%d", ++count);
+            BALL_LOGVA_DEFERRED_WARN( "%d", ++count);
+            BALL_LOGVA_DEFERRED(Sev::e_WARN, "%d", ++count);
+
+            ASSERTV(count, 0 == count);
+            ASSERT(numPublished == observer->messages().size());
+
+            BALL_LOGVA_DEFERRED_ERROR("%d", ++count);
+
+            ASSERTV(count, 1 == count);
+            ASSERT(numPublished + 1 == observer->messages().size());
+        }
+
+        if (verbose) cout << "\tTesting a conversion that cannot be deferred."
+                          << endl;
+        {
+            BALL_LOGVA_DEFERRED(Sev::e_FATAL, "%2$s, %1$s", "world", "hello");
+
+            ASSERT(!observer->wasDeferred().back());
+            ASSERTV(observer->messages().back(),
+                    "hello, world" == observer->messages().back());
+        }
+
+        ASSERT(0 == manager.deregisterObserver("test"));
+      } break;
       case 36: {
         // --------------------------------------------------------------------
         // TESTING RECURSIVE USE OF LOGGING MACROS
@@ -8,6 +8,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <ball_context.h>
 #include <ball_fixedsizerecordbuffer.h>
 #include <ball_loggermanagerdefaults.h>
+#include <ball_perthreadrecordbuffer.h>
 #include <ball_record.h>
 #include <ball_recordattributes.h>
 #include <ball_severity.h>
@@ -776,10 +777,20 @@ void LoggerManager::constructObject(
       bsl::allocator<bsl::function<void(Transmission::Cause)> >(d_allocator_p),
       bdlf::MemFnUtil::memFn(&LoggerManager::publishAllImp, this));
 
-    int recordBufferSize = configuration.defaults().defaultRecordBufferSize();
-    d_recordBuffer_p     = new(*d_allocator_p) FixedSizeRecordBuffer(
+    const int perThreadCapacity =
+                               configuration.perThreadRecordBufferCapacity();
+    if (0 < perThreadCapacity) {
+        d_recordBuffer_p = new(*d_allocator_p) PerThreadRecordBuffer(
+                                                             perThreadCapacity,
+                                                             d_allocator_p);
+    }
+    else {
+        int recordBufferSize =
+                            configuration.defaults().defaultRecordBufferSize();
+        d_recordBuffer_p     = new(*d_allocator_p) FixedSizeRecordBuffer(
                                                               recordBufferSize,
                                                               d_allocator_p);
+    }
 
     d_logger_p = new(*d_allocator_p) Logger(d_observer,
                                             d_recordBuffer_p,
@@ -75,6 +75,26 @@ BSLS_IDENT("$Id: $")
 // levels (see below) or can install a logger that uses a different kind of
 // record buffer.
 //
+///Per-Thread Record Buffers
+///-------------------------
+// By default, the record buffer of the default logger is shared by all
+// threads, each of which acquires a mutex to add a record to it.  If the
+// 'perThreadRecordBufferCapacity' attribute of the
+// 'ball::LoggerManagerConfiguration' supplied to the logger manager is
+// positive, the default logger instead uses a 'ball::PerThreadRecordBuffer',
+// in which each thread buffers up to that many of its most recent records in a
+// queue of its own, without acquiring a lock shared with other threads.  When
+// the records of the default logger are published (i.e., on a Trigger or
+// Trigger-All event), the records buffered by all threads are merged in order
+// of their timestamps, so the records published on a Trigger event are the
+// same, in the same order, as with the shared record buffer (up to the
+// different limits on the number of buffered records).  Note that the
+// per-thread capacity is a number of records, whereas the size of the shared
+// record buffer (i.e., 'defaultRecordBufferSize') is a number of bytes: there
+// is *no* limit on the number of bytes buffered by each thread, so the memory
+// used by the per-thread record buffers is proportional to the per-thread
+// capacity, the size of the records, and the number of logging threads.
+//
 ///Logger Manager Singleton Initialization
 ///---------------------------------------
 // The recommended way to initialize the logger manager singleton is to create
@@ -210,6 +210,7 @@ using namespace bdlf::PlaceHolders;
 // [40] USAGE EXAMPLE #3
 // [41] USAGE EXAMPLE #4
 // [37] CONCERN: RECORD POOL MEMORY CONSUMPTION
+// [44] CONCERN: PER-THREAD RECORD BUFFERS
 // [19] CONCERN: PERFORMANCE IMPLICATIONS
 // [12] CONCERN: LOG RECORD POPULATOR CALLBACKS
 // [11] CONCERN: INTERNAL BROADCAST OBSERVER
@@ -1281,6 +1282,79 @@ class MyObserver : public ball::Observer {
 
 }  // close namespace BALL_LOGGERMANAGER_TEST_CASE_17
 
+// ============================================================================
+//                         CASE 44 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGGERMANAGER_TEST_CASE_44 {
+
+class RecordingObserver : public ball::Observer {
+    // This concrete implementation of 'ball::Observer' keeps a copy of the
+    // records published to it, along with their contexts.
+
+    // DATA
+    bslmt::Mutex                d_mutex;     // synchronizes access to members
+    bsl::vector<ball::Record>   d_records;   // published records
+    bsl::vector<ball::Context>  d_contexts;  // contexts of 'd_records'
+
+  public:
+    // CREATORS
+    explicit
+    RecordingObserver(bslma::Allocator *basicAllocator = 0)
+    : d_records(basicAllocator)
+    , d_contexts(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&                       context)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.push_back(*record);
+        d_contexts.push_back(context);
+    }
+
+    // ACCESSORS
+    const ball::Context& context(int index) const
+        // Return the context of the specified 'index'th published record.
+    {
+        return d_contexts[index];
+    }
+
+    int numPublished() const
+        // Return the number of records published to this observer.
+    {
+        return static_cast<int>(d_records.size());
+    }
+
+    const ball::Record& record(int index) const
+        // Return the specified 'index'th published record.
+    {
+        return d_records[index];
+    }
+};
+
+void logMessages(ball::Logger    *logger,
+                 const Cat       *category,
+                 int              severity,
+                 int              threadIndex,
+                 int              numMessages,
+                 bslmt::Barrier  *barrier)
+    // Wait on the specified 'barrier', then log, using the specified 'logger',
+    // to the specified 'category' at the specified 'severity', the specified
+    // 'numMessages' messages having the specified 'threadIndex' as their
+    // line number.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numMessages; ++i) {
+        logger->logMessage(*category, severity, F_, threadIndex, "message");
+    }
+}
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_CASE_44
+
 namespace {
 class TestDestroyObserver : public ball::Observer {
     // This class counts the number of 'releaseRecords' methods invocations.
@@ -1723,6 +1797,161 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 44: {
+        // --------------------------------------------------------------------
+        // CONCERN: PER-THREAD RECORD BUFFERS
+        //
+        // Concerns:
+        //: 1 If the 'perThreadRecordBufferCapacity' attribute of the
+        //:   configuration is positive, the records logged by all threads to
+        //:   the default logger are published on a Trigger event.
+        //:
+        //: 2 The records published on a Trigger event are in timestamp order,
+        //:   with the triggering record published last in FIFO order.
+        //:
+        //: 3 Each thread buffers at most 'perThreadRecordBufferCapacity'
+        //:   records.
+        //:
+        //: 4 All memory is released when the logger manager is destroyed.
+        //
+        // Plan:
+        //: 1 Create a logger manager with a positive per-thread capacity and
+        //:   FIFO log order.  Log records, from several threads, whose
+        //:   severity is between the Record and Trigger thresholds, then log a
+        //:   record at the Trigger threshold from the main thread.  Verify
+        //:   the records published, and their order.  (C-1..2)
+        //:
+        //: 2 Log, from the main thread, more records than the per-thread
+        //:   capacity, then trigger.  Verify the number of records published.
+        //:   (C-3)
+        //:
+        //: 3 Use a test allocator for the logger manager, and verify that no
+        //:   memory is in use after its destruction.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: PER-THREAD RECORD BUFFERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PER-THREAD RECORD BUFFERS" << endl
+                          << "==================================" << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_CASE_44;
+
+        const int k_CAPACITY    = 64;
+        const int k_NUM_THREADS = 4;
+        const int k_NUM_RECORDS = 10;
+
+        const int RECORD  = ball::Severity::e_INFO;
+        const int TRIGGER = ball::Severity::e_ERROR;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            ball::LoggerManagerConfiguration mXC;
+            mXC.setLogOrder(ball::LoggerManagerConfiguration::e_FIFO);
+            mXC.setTriggerMarkers(
+                             ball::LoggerManagerConfiguration::e_NO_MARKERS);
+            ASSERT(0 == mXC.setPerThreadRecordBufferCapacityIfValid(
+                                                                  k_CAPACITY));
+
+            bsl::shared_ptr<RecordingObserver> observer =
+                                  bsl::allocate_shared<RecordingObserver>(&oa);
+
+            bslma::ManagedPtr<Obj> objPtr;
+            Obj::createLoggerManager(&objPtr, mXC, &oa);
+            ASSERT(0 == objPtr->registerObserver(observer, "observer"));
+
+            Obj& mX = *objPtr;
+
+            mX.setDefaultThresholdLevels(RECORD,
+                                         ball::Severity::e_OFF,
+                                         TRIGGER,
+                                         ball::Severity::e_OFF);
+            mX.setCategoryThresholdsToCurrentDefaults(&mX.defaultCategory());
+
+            const Cat     *CATEGORY = &mX.defaultCategory();
+            ball::Logger&  LGR      = mX.getLogger();
+
+            if (veryVerbose) cout << "\tLogging from several threads." << endl;
+            {
+                bslmt::Barrier            barrier(k_NUM_THREADS);
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                       &handles[i],
+                                       bdlf::BindUtil::bind(&logMessages,
+                                                            &LGR,
+                                                            CATEGORY,
+                                                            RECORD,
+                                                            i,
+                                                            k_NUM_RECORDS,
+                                                            &barrier)));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+                ASSERT(0 == observer->numPublished());
+
+                LGR.logMessage(*CATEGORY, TRIGGER, F_, -1, "trigger");
+
+                const int NUM_EXPECTED = k_NUM_THREADS * k_NUM_RECORDS + 1;
+                ASSERTV(observer->numPublished(),
+                        NUM_EXPECTED == observer->numPublished());
+
+                bsl::vector<int> numPerThread(k_NUM_THREADS, 0);
+                for (int i = 0; i < observer->numPublished(); ++i) {
+                    const ball::RecordAttributes& FIELDS =
+                                            observer->record(i).fixedFields();
+                    const ball::Context&          CONTEXT =
+                                                       observer->context(i);
+
+                    ASSERTV(i, ball::Transmission::e_TRIGGER ==
+                                                CONTEXT.transmissionCause());
+                    ASSERTV(i, i == CONTEXT.recordIndex());
+                    ASSERTV(i, NUM_EXPECTED == CONTEXT.sequenceLength());
+
+                    if (0 < i) {
+                        ASSERTV(i, observer->record(i - 1).fixedFields()
+                                               .timestamp() <=
+                                                           FIELDS.timestamp());
+                    }
+
+                    if (NUM_EXPECTED - 1 == i) {
+                        ASSERTV(FIELDS.lineNumber(),
+                                -1 == FIELDS.lineNumber());
+                    }
+                    else if (0 <= FIELDS.lineNumber() &&
+                             k_NUM_THREADS > FIELDS.lineNumber()) {
+                        ++numPerThread[FIELDS.lineNumber()];
+                    }
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERTV(i, numPerThread[i],
+                            k_NUM_RECORDS == numPerThread[i]);
+                }
+            }
+
+            if (veryVerbose) cout << "\tExceeding the capacity." << endl;
+            {
+                const int NUM_PUBLISHED = observer->numPublished();
+
+                for (int i = 0; i < 2 * k_CAPACITY; ++i) {
+                    LGR.logMessage(*CATEGORY, RECORD, F_, i, "message");
+                }
+                LGR.logMessage(*CATEGORY, TRIGGER, F_, -1, "trigger");
+
+                ASSERTV(observer->numPublished(),
+                        NUM_PUBLISHED + k_CAPACITY ==
+                                                    observer->numPublished());
+
+                const ball::RecordAttributes& FIELDS =
+                              observer->record(NUM_PUBLISHED).fixedFields();
+                ASSERTV(FIELDS.lineNumber(),
+                        k_CAPACITY + 1 == FIELDS.lineNumber());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 43: {
         // --------------------------------------------------------------------
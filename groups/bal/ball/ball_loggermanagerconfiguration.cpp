@@ -44,6 +44,12 @@ LoggerManagerConfiguration::areValidDefaultThresholdLevels(int recordLevel,
                                                               triggerAllLevel);
 }
 
+bool LoggerManagerConfiguration::isValidPerThreadRecordBufferCapacity(
+                                                                int numRecords)
+{
+    return 0 <= numRecords;
+}
+
 // CREATORS
 LoggerManagerConfiguration::LoggerManagerConfiguration(
                                               bslma::Allocator *basicAllocator)
@@ -58,6 +64,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 bsl::allocator<DefaultThresholdLevelsCallback>(basicAllocator))
 , d_logOrder(e_LIFO)
 , d_triggerMarkers(e_BEGIN_END_MARKERS)
+, d_perThreadRecordBufferCapacity(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -79,6 +86,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 original.d_defaultThresholdsCb)
 , d_logOrder(original.d_logOrder)
 , d_triggerMarkers(original.d_triggerMarkers)
+, d_perThreadRecordBufferCapacity(original.d_perThreadRecordBufferCapacity)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -87,12 +95,13 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
 LoggerManagerConfiguration&
 LoggerManagerConfiguration::operator=(const LoggerManagerConfiguration& rhs)
 {
-    d_defaults            = rhs.d_defaults;
-    d_userPopulator       = rhs.d_userPopulator;
-    d_categoryNameFilter  = rhs.d_categoryNameFilter;
-    d_defaultThresholdsCb = rhs.d_defaultThresholdsCb;
-    d_logOrder            = rhs.d_logOrder;
-    d_triggerMarkers      = rhs.d_triggerMarkers;
+    d_defaults                      = rhs.d_defaults;
+    d_userPopulator                 = rhs.d_userPopulator;
+    d_categoryNameFilter            = rhs.d_categoryNameFilter;
+    d_defaultThresholdsCb           = rhs.d_defaultThresholdsCb;
+    d_logOrder                      = rhs.d_logOrder;
+    d_triggerMarkers                = rhs.d_triggerMarkers;
+    d_perThreadRecordBufferCapacity = rhs.d_perThreadRecordBufferCapacity;
 
     return *this;
 }
@@ -159,6 +168,17 @@ void LoggerManagerConfiguration::setTriggerMarkers(TriggerMarkers value)
     d_triggerMarkers = value;
 }
 
+int LoggerManagerConfiguration::setPerThreadRecordBufferCapacityIfValid(
+                                                                int numRecords)
+{
+    if (!isValidPerThreadRecordBufferCapacity(numRecords)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_perThreadRecordBufferCapacity = numRecords;
+    return 0;
+}
+
 // ACCESSORS
 const LoggerManagerDefaults& LoggerManagerConfiguration::defaults() const
 {
@@ -225,6 +245,11 @@ LoggerManagerConfiguration::triggerMarkers() const
     return d_triggerMarkers;
 }
 
+int LoggerManagerConfiguration::perThreadRecordBufferCapacity() const
+{
+    return d_perThreadRecordBufferCapacity;
+}
+
 bsl::ostream&
 LoggerManagerConfiguration::print(bsl::ostream& stream,
                                   int           level,
@@ -272,6 +297,10 @@ LoggerManagerConfiguration::print(bsl::ostream& stream,
                                                  : "BEGIN_END_MARKERS";
     stream << "Trigger markers are " << triggerMarker << NL;
 
+    bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+    stream << "Per-thread record buffer capacity is "
+           << d_perThreadRecordBufferCapacity << NL;
+
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << ']' << NL;
 
@@ -295,7 +324,9 @@ bool ball::operator==(const ball::LoggerManagerConfiguration& lhs,
         && (bool)lhs.d_categoryNameFilter  == (bool)rhs.d_categoryNameFilter
         && (bool)lhs.d_defaultThresholdsCb == (bool)rhs.d_defaultThresholdsCb
         && lhs.d_logOrder                  == rhs.d_logOrder
-        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers;
+        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers
+        && lhs.d_perThreadRecordBufferCapacity
+                                        == rhs.d_perThreadRecordBufferCapacity;
 }
 
 bool ball::operator!=(const ball::LoggerManagerConfiguration& lhs,
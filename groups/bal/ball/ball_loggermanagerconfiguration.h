@@ -62,6 +62,8 @@ BSLS_IDENT("$Id: $")
 //
 //  TriggerMarkers                               triggerMarkers
 //
+//  int                                          perThreadRecordBufferCapacity
+//
 //  NAME                            DESCRIPTION
 //  -------------------             -------------------------------------------
 //  defaults                        constrained defaults for buffer size and
@@ -90,6 +92,21 @@ BSLS_IDENT("$Id: $")
 //                                  sequence of records logged due to a Trigger
 //                                  or Trigger-All event; default is
 //                                  'e_BEGIN_END_MARKERS'.
+//
+//  perThreadRecordBufferCapacity   if positive, the maximum number of records
+//                                  each thread can buffer in the record buffer
+//                                  of the default logger, which then uses a
+//                                  queue per thread rather than a buffer
+//                                  shared by all threads (see
+//                                  'ball_perthreadrecordbuffer'); if 0, the
+//                                  record buffer of the default logger is a
+//                                  'ball::FixedSizeRecordBuffer' whose size is
+//                                  'defaults.defaultRecordBufferSize()';
+//                                  default is 0.  Note that the queue of each
+//                                  thread is bounded only by this number of
+//                                  records, and *not* by a number of bytes:
+//                                  'defaults.defaultRecordBufferSize()' does
+//                                  not apply to it.
 //..
 // The constraints are as follows:
 //..
@@ -107,6 +124,8 @@ BSLS_IDENT("$Id: $")
 //  +--------------------------------+--------------------------------+
 //  | triggerMarkers                 | (none)                         |
 //  +--------------------------------+--------------------------------+
+//  | perThreadRecordBufferCapacity  | non-negative                   |
+//  +--------------------------------+--------------------------------+
 //..
 // For convenience, the 'ball::LoggerManagerConfiguration' interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -201,6 +220,7 @@ BSLS_IDENT("$Id: $")
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Per-thread record buffer capacity is 0
 //  ]
 //..
 
@@ -328,6 +348,13 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    int                   d_perThreadRecordBufferCapacity;
+                                                  // capacity of the queue of
+                                                  // each thread in the record
+                                                  // buffer of the default
+                                                  // logger, or 0 for a shared
+                                                  // record buffer
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -359,6 +386,11 @@ class LoggerManagerConfiguration {
         // severity threshold level, and 'false' otherwise.  Valid severity
         // threshold levels are in the range '[0 .. 255]'.
 
+    static bool isValidPerThreadRecordBufferCapacity(int numRecords);
+        // Return 'true' if the specified 'numRecords' is a valid per-thread
+        // record-buffer capacity value, and 'false' otherwise.  'numRecords'
+        // is valid if '0 <= numRecords'.
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(LoggerManagerConfiguration,
                                    bslma::UsesBslmaAllocator);
@@ -450,6 +482,18 @@ class LoggerManagerConfiguration {
         // Set the trigger marker attribute of this object to the specified
         // 'value'.
 
+    int setPerThreadRecordBufferCapacityIfValid(int numRecords);
+        // Set the per-thread record-buffer capacity attribute of this object
+        // to the specified 'numRecords' if '0 <= numRecords'.  Return 0 on
+        // success, and a non-zero value otherwise with no effect on this
+        // object.  See attributes description for effects of the per-thread
+        // record-buffer capacity.  Note that the per-thread record buffers are
+        // bounded only by their number of records: there is *no* limit on the
+        // number of bytes they hold, and the default record-buffer size (a
+        // number of bytes) does not apply to them, so the memory used by the
+        // buffered records grows with the size of these records and with the
+        // number of logging threads.
+
     // ACCESSORS
     const LoggerManagerDefaults& defaults() const;
         // Return a reference to the non-modifiable defaults object attribute
@@ -500,6 +544,16 @@ class LoggerManagerConfiguration {
         // Return the trigger marker attribute of this object.  See attributes
         // description for effects of the trigger markers.
 
+    int perThreadRecordBufferCapacity() const;
+        // Return the per-thread record-buffer capacity attribute of this
+        // object.  See attributes description for effects of the per-thread
+        // record-buffer capacity.  Note that the per-thread record buffers are
+        // bounded only by their number of records: there is *no* limit on the
+        // number of bytes they hold, and the default record-buffer size (a
+        // number of bytes) does not apply to them, so the memory used by the
+        // buffered records grows with the size of these records and with the
+        // number of logging threads.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
                         int           spacesPerLevel = 4) const;
@@ -19,6 +19,7 @@
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 
+#include <bsl_climits.h>     // INT_MAX, INT_MIN
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_cstring.h>     // strlen()
 #include <bsl_functional.h>
@@ -54,6 +55,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] void setDefaultValues(const ball::LMD& defaults);
 // [ 5] void setLogOrder(LogOrder value);
 // [ 6] void setTriggerMarkers(TriggerMarkers value);
+// [ 7] int setPerThreadRecordBufferCapacityIfValid(int numRecords);
 // [ 1] void setUserFieldsPopulatorCallback(const Populator&);
 // [ 1] void setCategoryNameFilterCallback(const CNF& nameFilter);
 // [ 1] void setDefaultThresholdLevelsCallback(const DTC& );
@@ -61,6 +63,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] const ball::LMD& defaults() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] int perThreadRecordBufferCapacity() const;
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -70,7 +73,8 @@ using namespace bsl;  // automatically added by script
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 7] static bool isValidPerThreadRecordBufferCapacity(int numRecords);
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -223,6 +227,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Per-thread record buffer capacity is 0
 //  ]
 //..
 
@@ -309,7 +314,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -329,6 +334,91 @@ int main(int argc, char *argv[])
         initializeConfiguration(verbose);
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'setPerThreadRecordBufferCapacityIfValid'
+        //
+        // Concerns:
+        //: 1 The per-thread record-buffer capacity is 0 by default.
+        //:
+        //: 2 'setPerThreadRecordBufferCapacityIfValid' sets any non-negative
+        //:   capacity, returning 0, and rejects negative capacities, returning
+        //:   a non-zero value with no effect on the object.
+        //:
+        //: 3 The capacity participates in the value of the object.
+        //
+        // Plan:
+        //: 1 Verify the capacity of a default-constructed object.  (C-1)
+        //:
+        //: 2 Set valid and invalid capacities, and verify the return value,
+        //:   the result of 'isValidPerThreadRecordBufferCapacity', and the
+        //:   capacity.  (C-2)
+        //:
+        //: 3 Compare, copy, and assign objects differing only in their
+        //:   capacity.  (C-3)
+        //
+        // Testing:
+        //   int setPerThreadRecordBufferCapacityIfValid(int numRecords);
+        //   int perThreadRecordBufferCapacity() const;
+        //   static bool isValidPerThreadRecordBufferCapacity(int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING 'setPerThreadRecordBufferCapacityIfValid'"
+                 << "\n================================================\n";
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.perThreadRecordBufferCapacity());
+
+        static const struct {
+            int d_line;      // source line number
+            int d_capacity;  // capacity to set
+            int d_isValid;   // whether 'd_capacity' is valid
+        } DATA[] = {
+            //LINE  CAPACITY  VALID
+            //----  --------  -----
+            { L_,          0,     1 },
+            { L_,          1,     1 },
+            { L_,        256,     1 },
+            { L_,    INT_MAX,     1 },
+            { L_,         -1,     0 },
+            { L_,    INT_MIN,     0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int CAPACITY = DATA[ti].d_capacity;
+            const int VALID    = DATA[ti].d_isValid;
+
+            ASSERTV(LINE, VALID ==
+                         Obj::isValidPerThreadRecordBufferCapacity(CAPACITY));
+
+            mX.setPerThreadRecordBufferCapacityIfValid(42);
+
+            const int rc =
+                         mX.setPerThreadRecordBufferCapacityIfValid(CAPACITY);
+            ASSERTV(LINE, rc, VALID == (0 == rc));
+            ASSERTV(LINE, X.perThreadRecordBufferCapacity(),
+                    (VALID ? CAPACITY : 42) ==
+                                           X.perThreadRecordBufferCapacity());
+        }
+
+        Obj mY;  const Obj& Y = mY;
+        ASSERT(X != Y);
+
+        mY.setPerThreadRecordBufferCapacityIfValid(42);
+        ASSERT(X == Y);
+
+        mY.setPerThreadRecordBufferCapacityIfValid(16);
+        ASSERT(X != Y);
+
+        const Obj Z(Y);
+        ASSERT(16 == Z.perThreadRecordBufferCapacity());
+
+        mX = Y;
+        ASSERT(16 == X.perThreadRecordBufferCapacity());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING  'setTriggerMarkers' AND 'triggerMarkers':
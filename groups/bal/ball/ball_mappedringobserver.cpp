@@ -0,0 +1,480 @@
+// ball_mappedringobserver.cpp                                        -*-C++-*-
+#include <ball_mappedringobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_mappedringobserver_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The file descriptor of a ring buffer file is closed as soon as the file has
+// been mapped (the mapping remains valid), so that 'publish' deals with
+// memory only.
+//
+// The crash consistency of the ring (see {Ring Buffer File Format}) relies
+// on the *order* in which the stores of 'write' are performed: when a
+// process terminates, every store it performed is in the page cache, but a
+// store that was reordered (by the compiler or the processor) after the
+// point of termination is lost.  Hence 'tail' is stored with a full barrier
+// before the entries it retires are overwritten, and 'head' is stored with
+// release semantics after the new entry is complete.  'head' and 'tail' are
+// only loaded by the publishing thread (under the mutex), so relaxed loads
+// suffice there.
+//
+// Records are formatted into a 'bdlsb::MemOutStreamBuf' that is rewound
+// (rather than reset) before each record, so that, once it has grown to the
+// length of the longest record, formatting allocates no memory.
+
+#include <ball_record.h>
+#include <ball_recordstringformatter.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+const char k_MAGIC[8] = { 'B', 'A', 'L', 'L', 'R', 'I', 'N', 'G' };
+
+enum {
+    k_VERSION           = 1,           // version of the file format
+
+    k_HEADER_SIZE       = 64,          // size of the file header
+
+    k_ENTRY_HEADER_SIZE = 8,           // size of an entry header, and the
+                                       // alignment of entries
+
+    k_WRAP_FLAG         = 1,           // entry flag: no record, the next
+                                       // entry is at the start of the data
+                                       // region
+
+    k_TRUNCATED_FLAG    = 2,           // entry flag: the record was truncated
+
+    k_MAX_RECORD_LENGTH = 0x7ffffff8   // upper bound of 'maxRecordLength'
+};
+
+const char *const k_DEFAULT_FORMAT = "%d %p:%t %s %f:%l %c %m %u";
+
+                            // =================
+                            // struct RingHeader
+                            // =================
+
+struct RingHeader {
+    // This 'struct' describes the layout of the header of a ring buffer file.
+
+    char                                       d_magic[8];
+    unsigned int                               d_version;
+    unsigned int                               d_headerSize;
+    Int64                                      d_capacity;
+    bsls::AtomicOperations::AtomicTypes::Int64 d_head;
+    bsls::AtomicOperations::AtomicTypes::Int64 d_tail;
+};
+
+BSLMF_ASSERT(sizeof(RingHeader) <= k_HEADER_SIZE);
+
+                            // ==================
+                            // struct EntryHeader
+                            // ==================
+
+struct EntryHeader {
+    // This 'struct' describes the layout of the header of a ring buffer
+    // entry.
+
+    unsigned int d_length;
+    unsigned int d_flags;
+};
+
+BSLMF_ASSERT(sizeof(EntryHeader) == k_ENTRY_HEADER_SIZE);
+
+                            // ----------------
+                            // Local Functions
+                            // ----------------
+
+Int64 entrySize(Int64 length)
+    // Return the number of bytes occupied in the ring by an entry holding a
+    // record of the specified 'length'.
+{
+    const Int64 mask = k_ENTRY_HEADER_SIZE - 1;
+
+    return k_ENTRY_HEADER_SIZE + ((length + mask) & ~mask);
+}
+
+bool isValidHeader(const RingHeader& header, Int64 fileSize)
+    // Return 'true' if the specified 'header' is the header of a valid ring
+    // buffer file of the specified 'fileSize' bytes, and 'false' otherwise.
+{
+    if (0 != bsl::memcmp(header.d_magic, k_MAGIC, sizeof k_MAGIC)
+     || k_VERSION != header.d_version
+     || k_HEADER_SIZE != header.d_headerSize) {
+        return false;                                                 // RETURN
+    }
+
+    const Int64 capacity = header.d_capacity;
+
+    if (capacity < MappedRingObserver::k_MIN_CAPACITY
+     || 0 != capacity % k_ENTRY_HEADER_SIZE
+     || capacity > fileSize - k_HEADER_SIZE) {
+        return false;                                                 // RETURN
+    }
+
+    const Int64 head = bsls::AtomicOperations::getInt64Acquire(&header.d_head);
+    const Int64 tail = bsls::AtomicOperations::getInt64Acquire(&header.d_tail);
+
+    return 0 <= tail
+        && tail <= head
+        && head - tail <= capacity
+        && 0 == head % k_ENTRY_HEADER_SIZE
+        && 0 == tail % k_ENTRY_HEADER_SIZE;
+}
+
+}  // close unnamed namespace
+
+                         // ------------------------
+                         // class MappedRingObserver
+                         // ------------------------
+
+// PRIVATE MANIPULATORS
+void MappedRingObserver::closeImp()
+{
+    if (d_mapping_p) {
+        bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+
+        d_mapping_p       = 0;
+        d_mappingSize     = 0;
+        d_capacity        = 0;
+        d_maxRecordLength = 0;
+    }
+}
+
+void MappedRingObserver::write(const char  *data,
+                               bsl::size_t  length,
+                               bool         truncatedFlag)
+{
+    BSLS_ASSERT(d_mapping_p);
+    BSLS_ASSERT(static_cast<Int64>(length) <= d_maxRecordLength);
+
+    RingHeader *header = reinterpret_cast<RingHeader *>(d_mapping_p);
+    char       *region = d_mapping_p + k_HEADER_SIZE;
+
+    Int64 head = bsls::AtomicOperations::getInt64Relaxed(&header->d_head);
+    Int64 tail = bsls::AtomicOperations::getInt64Relaxed(&header->d_tail);
+
+    const Int64 size      = entrySize(length);
+    const Int64 remaining = d_capacity - head % d_capacity;
+    const Int64 required  = size <= remaining ? size : remaining + size;
+
+    // Since 'size' does not exceed half of the capacity, 'required' does not
+    // exceed the capacity, and the following loop terminates (at the latest)
+    // when the ring is empty.
+
+    if (head + required - tail > d_capacity) {
+        do {
+            const Int64        offset = tail % d_capacity;
+            const EntryHeader *entry  =
+                        reinterpret_cast<const EntryHeader *>(region + offset);
+
+            tail += entry->d_flags & k_WRAP_FLAG
+                    ? d_capacity - offset
+                    : entrySize(entry->d_length);
+        } while (head + required - tail > d_capacity);
+
+        bsls::AtomicOperations::setInt64(&header->d_tail, tail);
+    }
+
+    if (size > remaining) {
+        EntryHeader *wrap = reinterpret_cast<EntryHeader *>(
+                                                region + head % d_capacity);
+        wrap->d_length = 0;
+        wrap->d_flags  = k_WRAP_FLAG;
+
+        head += remaining;
+    }
+
+    char        *position = region + head % d_capacity;
+    EntryHeader *entry    = reinterpret_cast<EntryHeader *>(position);
+
+    entry->d_length = static_cast<unsigned int>(length);
+    entry->d_flags  = truncatedFlag ? k_TRUNCATED_FLAG : 0;
+
+    bsl::memcpy(position + k_ENTRY_HEADER_SIZE, data, length);
+
+    bsls::AtomicOperations::setInt64Release(&header->d_head, head + size);
+}
+
+// CREATORS
+MappedRingObserver::MappedRingObserver(const allocator_type& allocator)
+: d_mapping_p(0)
+, d_mappingSize(0)
+, d_capacity(0)
+, d_maxRecordLength(0)
+, d_buffer(allocator.mechanism())
+, d_stream(&d_buffer)
+, d_formatter(bsl::allocator_arg_t(),
+              allocator,
+              RecordStringFormatter(k_DEFAULT_FORMAT, allocator))
+, d_mutex()
+{
+}
+
+MappedRingObserver::~MappedRingObserver()
+{
+    closeImp();
+}
+
+// MANIPULATORS
+void MappedRingObserver::close()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    closeImp();
+}
+
+int MappedRingObserver::open(const char *path, bsls::Types::Int64 capacity)
+{
+    BSLS_ASSERT(path);
+    BSLS_ASSERT(k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT(0 == capacity % k_ENTRY_HEADER_SIZE);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT(0 == d_mapping_p);
+
+    // The file size is rounded up to a multiple of the page size, as
+    // required by 'FilesystemUtil::sync'.
+
+    const Int64 pageSize = bdls::MemoryUtil::pageSize();
+    const Int64 numPages =
+                        (k_HEADER_SIZE + capacity + pageSize - 1) / pageSize;
+    const Int64 fileSize = numPages * pageSize;
+
+    if (static_cast<Int64>(static_cast<bsl::size_t>(fileSize)) != fileSize) {
+        return -1;                                                    // RETURN
+    }
+
+    FileUtil::FileDescriptor fd = FileUtil::open(path,
+                                                 FileUtil::e_OPEN_OR_CREATE,
+                                                 FileUtil::e_READ_WRITE);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -2;                                                    // RETURN
+    }
+
+    const Int64 existingSize = FileUtil::getFileSize(fd);
+
+    int rc = existingSize < 0 ? -3
+           : existingSize > fileSize
+           ? FileUtil::truncateFileSize(fd, fileSize)
+           : FileUtil::growFile(fd, fileSize, true);
+
+    void *address = 0;
+
+    if (0 == rc) {
+        rc = FileUtil::map(fd,
+                           &address,
+                           0,
+                           static_cast<bsl::size_t>(fileSize),
+                           bdls::MemoryUtil::k_ACCESS_READ_WRITE);
+    }
+
+    FileUtil::close(fd);
+
+    if (0 != rc) {
+        return -4;                                                    // RETURN
+    }
+
+    RingHeader *header = static_cast<RingHeader *>(address);
+
+    if (!isValidHeader(*header, fileSize) || capacity != header->d_capacity) {
+        // Initialize an empty ring.  The magic is cleared first and written
+        // last, so that a partially initialized header is not valid.
+
+        bsl::memset(header->d_magic, 0, sizeof header->d_magic);
+
+        header->d_version    = k_VERSION;
+        header->d_headerSize = k_HEADER_SIZE;
+        header->d_capacity   = capacity;
+
+        bsls::AtomicOperations::setInt64(&header->d_head, 0);
+        bsls::AtomicOperations::setInt64(&header->d_tail, 0);
+
+        bsl::memset(header + 1, 0, k_HEADER_SIZE - sizeof *header);
+        bsl::memcpy(header->d_magic, k_MAGIC, sizeof k_MAGIC);
+    }
+
+    d_mapping_p       = static_cast<char *>(address);
+    d_mappingSize     = static_cast<bsl::size_t>(fileSize);
+    d_capacity        = capacity;
+    d_maxRecordLength = bsl::min<Int64>(capacity / 2 - k_ENTRY_HEADER_SIZE,
+                                        k_MAX_RECORD_LENGTH);
+
+    return 0;
+}
+
+void MappedRingObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&)
+{
+    BSLS_ASSERT(record);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 == d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    d_buffer.pubseekpos(0);
+    d_stream.clear();
+
+    d_formatter(d_stream, *record);
+
+    const bsl::size_t length    = d_buffer.length();
+    const bsl::size_t maxLength =
+                               static_cast<bsl::size_t>(d_maxRecordLength);
+
+    write(d_buffer.data(), bsl::min(length, maxLength), length > maxLength);
+}
+
+void MappedRingObserver::setRecordFormatFunctor(
+                                          const RecordFormatFunctor& formatter)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_formatter = formatter;
+}
+
+int MappedRingObserver::sync()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 == d_mapping_p) {
+        return -1;                                                    // RETURN
+    }
+
+    return bdls::FilesystemUtil::sync(d_mapping_p, d_mappingSize, true);
+}
+
+// ACCESSORS
+bsls::Types::Int64 MappedRingObserver::maxRecordLength() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_maxRecordLength;
+}
+
+                        // -----------------------------
+                        // struct MappedRingObserverUtil
+                        // -----------------------------
+
+// CLASS METHODS
+int MappedRingObserverUtil::loadRecords(bsl::vector<bsl::string> *result,
+                                        const char               *path)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(path);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::open(path,
+                                                 FileUtil::e_OPEN,
+                                                 FileUtil::e_READ_ONLY);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    const Int64 fileSize = FileUtil::getFileSize(fd);
+
+    void *address = 0;
+    int   rc      = -2;
+
+    if (k_HEADER_SIZE <= fileSize
+     && static_cast<Int64>(static_cast<bsl::size_t>(fileSize)) == fileSize) {
+        rc = FileUtil::map(fd,
+                           &address,
+                           0,
+                           static_cast<bsl::size_t>(fileSize),
+                           bdls::MemoryUtil::k_ACCESS_READ);
+    }
+
+    FileUtil::close(fd);
+
+    if (0 != rc) {
+        return -2;                                                    // RETURN
+    }
+
+    const RingHeader *header = static_cast<const RingHeader *>(address);
+    const char       *region = static_cast<const char *>(address)
+                             + k_HEADER_SIZE;
+
+    bsl::vector<bsl::string> records(result->get_allocator());
+
+    rc = isValidHeader(*header, fileSize) ? 0 : -3;
+
+    if (0 == rc) {
+        const Int64 capacity = header->d_capacity;
+        const Int64 head     =
+                   bsls::AtomicOperations::getInt64Acquire(&header->d_head);
+        Int64       tail     =
+                   bsls::AtomicOperations::getInt64Acquire(&header->d_tail);
+
+        while (tail < head) {
+            const Int64        offset = tail % capacity;
+            const EntryHeader *entry  =
+                        reinterpret_cast<const EntryHeader *>(region + offset);
+
+            const Int64 size = entry->d_flags & k_WRAP_FLAG
+                             ? capacity - offset
+                             : entrySize(entry->d_length);
+
+            if (size > capacity - offset || tail + size > head) {
+                rc = -4;  // corrupt entry
+                break;
+            }
+
+            if (0 == (entry->d_flags & k_WRAP_FLAG)) {
+                records.resize(records.size() + 1);
+                records.back().assign(region + offset + k_ENTRY_HEADER_SIZE,
+                                      entry->d_length);
+            }
+
+            tail += size;
+        }
+    }
+
+    FileUtil::unmap(address, static_cast<bsl::size_t>(fileSize));
+
+    if (0 == rc) {
+        result->swap(records);
+    }
+
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,444 @@
+// ball_mappedringobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_MAPPEDRINGOBSERVER
+#define INCLUDED_BALL_MAPPEDRINGOBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer that logs to a memory-mapped ring buffer file.
+//
+//@CLASSES:
+//  ball::MappedRingObserver: observer writing to a memory-mapped ring buffer
+//  ball::MappedRingObserverUtil: utility for reading a ring buffer file
+//
+//@SEE_ALSO: ball_observer, ball_fileobserver2, ball_recordstringformatter
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::MappedRingObserver', that writes the log
+// records it receives into a fixed-size file that is mapped into memory and
+// used as a circular buffer, and a utility, 'ball::MappedRingObserverUtil',
+// that reads the records back out of such a file:
+//..
+//              ,------------------------.
+//             ( ball::MappedRingObserver )
+//              `------------------------'
+//                           |              ctor
+//                           |              open
+//                           |              close
+//                           |              setRecordFormatFunctor
+//                           |              sync
+//                           |              capacity
+//                           |              isOpen
+//                           |              maxRecordLength
+//                           V
+//                    ,--------------.
+//                   ( ball::Observer )
+//                    `--------------'
+//                                          publish
+//                                          releaseRecords
+//                                          dtor
+//..
+// Once a ring buffer file has been opened (see 'open'), publishing a record
+// formats it and copies the result into the mapped memory; no system call is
+// made.  When the buffer is full, the oldest records are overwritten.  This
+// makes 'ball::MappedRingObserver' suitable for "flight recorder" logging:
+// a high volume of records (typically including those of low severity) is
+// retained at very low cost, and the most recent of them are inspected only
+// when something goes wrong.
+//
+// Because the file is written through a shared memory mapping, records are
+// stored in the operating system's page cache as soon as they are published,
+// and are written to the file by the operating system in due course, whether
+// or not the process is still running.  Consequently, the records published
+// by a process that terminates abnormally (e.g., due to a crash or 'SIGKILL')
+// are not lost, and can be read back with
+// 'ball::MappedRingObserverUtil::loadRecords'.  Note that records are *not*
+// protected against a failure of the operating system itself (e.g., a power
+// failure) unless 'sync' has been called after they were published.
+//
+///Ring Buffer File Format
+///-----------------------
+// A ring buffer file consists of a 64-byte header followed by a data region
+// of 'capacity' bytes.  All integers are stored in the native byte order of
+// the writing host.  The header has the following layout:
+//..
+//  Offset  Size  Field
+//  ------  ----  -----------------------------------------------------------
+//       0     8  magic: the characters "BALLRING"
+//       8     4  version: 1
+//      12     4  header size: 64
+//      16     8  capacity: size of the data region, in bytes
+//      24     8  head: position one past the end of the newest entry
+//      32     8  tail: position of the oldest entry
+//      40    24  reserved
+//..
+// 'head' and 'tail' are *positions*: byte counts that increase monotonically
+// over the lifetime of the ring, the byte at position 'p' being stored at
+// offset 'p % capacity' of the data region.  The entries of the ring are
+// stored contiguously in '[tail, head)'.  Each entry starts at a position
+// that is a multiple of 8 with an 8-byte entry header:
+//..
+//  Offset  Size  Field
+//  ------  ----  -----------------------------------------------------------
+//       0     4  length: number of bytes of formatted record that follow
+//       4     4  flags: 1 (wrap), 2 (truncated record), or 0
+//..
+// followed by 'length' bytes of formatted record, padded to a multiple of 8
+// bytes.  An entry never spans the end of the data region: if a record does
+// not fit in the space remaining before the end of the data region, a *wrap*
+// entry (having the wrap flag set, and no record) is written, and the record
+// is stored at the start of the data region.
+//
+// A publishing thread first advances 'tail' past any entry about to be
+// overwritten, then writes the new entry, and finally advances 'head' to
+// include it.  Therefore the entries in '[tail, head)' are complete and
+// unmodified at any point in time, and in particular if the process
+// terminates while publishing a record.
+//
+///Log Record Formatting
+///---------------------
+// By default, records are formatted by a 'ball::RecordStringFormatter'
+// having the format specification:
+//..
+//  "%d %p:%t %s %f:%l %c %m %u"
+//..
+// Note that, unlike the default format of other observers, no newline
+// characters surround the record, as entries of the ring buffer are
+// delimited by their length.  The default format can be overridden by
+// supplying a suitable formatting functor to 'setRecordFormatFunctor'.  The
+// formatting functor may write arbitrary bytes (including null characters)
+// to the stream it is supplied; in particular, it may write records in a
+// binary format, and the bytes it writes are returned unaltered by
+// 'ball::MappedRingObserverUtil::loadRecords'.
+//
+// A formatted record longer than 'maxRecordLength()' (which is half of the
+// capacity of the ring, less the size of an entry header) is truncated to
+// that length, and the truncated flag of its entry is set.
+//
+///Thread Safety
+///-------------
+// All methods of 'ball::MappedRingObserver' are thread-safe, and can be
+// called concurrently by multiple threads.
+//
+// 'ball::MappedRingObserverUtil::loadRecords' is intended to read a ring
+// buffer file that is not being written to (e.g., after the writing process
+// has terminated).  It validates the file, and never reads outside of it,
+// but a file that is being written to concurrently may yield records that
+// have been partially overwritten.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Flight Recorder Logging
+/// - - - - - - - - - - - - - - - - -
+// Suppose that a service logs its warnings and errors to a file (using, e.g.,
+// a 'ball::FileObserver2'), but that, when a failure occurs, we would like to
+// see all of the records (including those of 'DEBUG' and 'TRACE' severity)
+// that were published shortly beforehand.  Writing all of those records to
+// the log file would be too expensive, so we use a
+// 'ball::MappedRingObserver' to keep the most recent of them in a ring
+// buffer file.
+//
+// First, we create the observer, and open a ring buffer file having a
+// capacity of 1MB:
+//..
+//  ball::MappedRingObserver observer;
+//
+//  int rc = observer.open(fileName.c_str(), 1024 * 1024);
+//  assert(0 == rc);
+//  assert(true == observer.isOpen());
+//..
+// Then, we publish records to the observer (typically by registering it with
+// the logger manager, possibly alongside other observers by means of a
+// 'ball::BroadcastObserver').  Here, we publish records directly:
+//..
+//  ball::RecordAttributes attributes;
+//  ball::UserFields       fieldValues;
+//  ball::Context          context;
+//
+//  bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+//  bsl::shared_ptr<ball::Record> record(
+//                         new (*ga) ball::Record(attributes, fieldValues, ga),
+//                         ga);
+//
+//  record->fixedFields().setMessage("connection established");
+//  observer.publish(record, context);
+//
+//  record->fixedFields().setMessage("sending request");
+//  observer.publish(record, context);
+//..
+// Next, we close the file.  Note that the records would be retained in the
+// file just as well if the process were to terminate abnormally at this
+// point:
+//..
+//  observer.close();
+//..
+// Finally, we read back the records, oldest first (typically in a separate
+// process, after the failure occurred):
+//..
+//  bsl::vector<bsl::string> records;
+//
+//  rc = ball::MappedRingObserverUtil::loadRecords(&records, fileName.c_str());
+//  assert(0 == rc);
+//  assert(2 == records.size());
+//  assert(bsl::string::npos != records[0].find("connection established"));
+//  assert(bsl::string::npos != records[1].find("sending request"));
+//..
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                         // ========================
+                         // class MappedRingObserver
+                         // ========================
+
+class MappedRingObserver : public Observer {
+    // This class provides a concrete implementation of the 'Observer'
+    // protocol.  The 'publish' method of this class writes the log records
+    // that it receives to a memory-mapped ring buffer file.
+
+  public:
+    // TYPES
+    typedef bsl::function<void(bsl::ostream&, const Record&)>
+                                                           RecordFormatFunctor;
+        // 'RecordFormatFunctor' is an alias for the type of the functor used
+        // for formatting log records to a stream.
+
+    typedef bsl::allocator<char> allocator_type;
+
+    enum {
+        k_MIN_CAPACITY = 1024  // minimum capacity of a ring buffer file
+    };
+
+  private:
+    // DATA
+    char                *d_mapping_p;      // mapped ring buffer file, or 0 if
+                                           // no file is open
+
+    bsl::size_t          d_mappingSize;    // size of the mapping, in bytes
+
+    bsls::Types::Int64   d_capacity;       // size of the data region of the
+                                           // ring buffer, in bytes
+
+    bsls::Types::Int64   d_maxRecordLength;
+                                           // maximum length of a record
+                                           // written to the ring buffer
+
+    bdlsb::MemOutStreamBuf
+                         d_buffer;         // buffer into which records are
+                                           // formatted (reused across
+                                           // records)
+
+    bsl::ostream         d_stream;         // stream over 'd_buffer' supplied
+                                           // to the formatting functor
+
+    RecordFormatFunctor  d_formatter;      // formatting functor used when
+                                           // writing to the ring buffer
+
+    mutable bslmt::Mutex d_mutex;          // serializes access to the mapping
+                                           // and the formatting buffer
+
+    // NOT IMPLEMENTED
+    MappedRingObserver(const MappedRingObserver&);
+    MappedRingObserver& operator=(const MappedRingObserver&);
+
+    // PRIVATE MANIPULATORS
+    void closeImp();
+        // Unmap the ring buffer file of this observer, if any.  The behavior
+        // is undefined unless 'd_mutex' is locked by the calling thread.
+
+    void write(const char *data, bsl::size_t length, bool truncatedFlag);
+        // Append to the ring buffer an entry holding the specified 'length'
+        // bytes of the specified 'data', setting the truncated flag of the
+        // entry if the specified 'truncatedFlag' is 'true', and overwriting
+        // the oldest entries as needed.  The behavior is undefined unless a
+        // ring buffer file is open, 'length <= d_maxRecordLength', and
+        // 'd_mutex' is locked by the calling thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MappedRingObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    MappedRingObserver(const allocator_type& allocator = allocator_type());
+        // Create a memory-mapped ring buffer observer having no open ring
+        // buffer file.  Optionally specify an 'allocator' (e.g., the address
+        // of a 'bslma::Allocator' object) to supply memory; otherwise, the
+        // default allocator is used.  Note that records published to this
+        // observer are discarded until a ring buffer file is opened (see
+        // 'open'), and that a default record format is in effect (see
+        // 'setRecordFormatFunctor').
+
+    virtual ~MappedRingObserver();
+        // Close the ring buffer file of this observer, if any, and destroy
+        // this observer.
+
+    // MANIPULATORS
+    void close();
+        // Unmap and close the ring buffer file of this observer, if any.
+        // Note that the records written to the file are retained.
+
+    int open(const char *path, bsls::Types::Int64 capacity);
+        // Open the ring buffer file at the specified 'path', having a data
+        // region of the specified 'capacity' bytes, creating it if it does
+        // not exist, and map it into memory.  If the file is a ring buffer
+        // file having 'capacity' (e.g., one that was written by a previous
+        // run of the process), subsequently published records are appended
+        // to the records it holds; otherwise, the file is resized and
+        // reinitialized to an empty ring buffer.  Return 0 on success, and a
+        // non-zero value (with no effect on the state of this observer)
+        // otherwise.  The behavior is undefined unless
+        // 'k_MIN_CAPACITY <= capacity', 'capacity' is a multiple of 8, and no
+        // ring buffer file is open.  Note that the file is fully allocated on
+        // disk by this method, so that writing to the mapped memory can not
+        // fail later because the disk is full.
+
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context' by formatting 'record' and writing the result to the ring
+        // buffer file, overwriting the oldest records as needed.  If no ring
+        // buffer file is open, 'record' is discarded.  The behavior is
+        // undefined if 'record' or 'context' is modified during the execution
+        // of this method.
+
+    using Observer::publish;
+
+    virtual void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method, and is held by this observer.  Note that
+        // this operation has no effect, as this observer does not retain
+        // references to records.
+
+    void setRecordFormatFunctor(const RecordFormatFunctor& formatter);
+        // Set the formatting functor used when writing records to the ring
+        // buffer file of this observer to the specified 'formatter' functor.
+        // Note that a default format ("%d %p:%t %s %f:%l %c %m %u") is in
+        // effect until this method is called (see
+        // 'ball_recordstringformatter').
+
+    int sync();
+        // Write the contents of the ring buffer file of this observer to
+        // nonvolatile storage, and block until the write has completed.
+        // Return 0 on success, and a non-zero value if no ring buffer file is
+        // open or the write fails.  Note that
+        // this operation is needed only to protect published records against
+        // a failure of the operating system; the records of a process that
+        // terminates abnormally are retained without it.
+
+    // ACCESSORS
+    bsls::Types::Int64 capacity() const;
+        // Return the size, in bytes, of the data region of the ring buffer
+        // file of this observer, or 0 if no ring buffer file is open.
+
+    bool isOpen() const;
+        // Return 'true' if this observer has an open ring buffer file, and
+        // 'false' otherwise.
+
+    bsls::Types::Int64 maxRecordLength() const;
+        // Return the maximum length, in bytes, of a formatted record written
+        // to the ring buffer file of this observer (longer records being
+        // truncated), or 0 if no ring buffer file is open.  Note that this
+        // length is half of 'capacity()' less the size of an entry header,
+        // but does not exceed 2GB.
+};
+
+                       // =============================
+                       // struct MappedRingObserverUtil
+                       // =============================
+
+struct MappedRingObserverUtil {
+    // This 'struct' provides a namespace for utility functions that read the
+    // ring buffer files written by 'MappedRingObserver'.
+
+    // CLASS METHODS
+    static int loadRecords(bsl::vector<bsl::string> *result,
+                           const char               *path);
+        // Load into the specified 'result' the formatted records held by the
+        // ring buffer file at the specified 'path', oldest first.  Return 0
+        // on success, and a non-zero value (with no effect on 'result') if
+        // the file can not be opened or is not a valid ring buffer file.
+        // Note that 'result' is cleared before loading the records.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class MappedRingObserver
+                         // ------------------------
+
+// MANIPULATORS
+inline
+void MappedRingObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 MappedRingObserver::capacity() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_capacity;
+}
+
+inline
+bool MappedRingObserver::isOpen() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != d_mapping_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1374 @@
+// ball_mappedringobserver.t.cpp                                      -*-C++-*-
+#include <ball_mappedringobserver.h>
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_tempdirectoryguard.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memcmp', 'strlen'
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <bsl_c_signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides an observer that writes the log records
+// it receives into a memory-mapped ring buffer file, and a utility that reads
+// the records back.  We test the observer and the utility together: the
+// records read back by 'MappedRingObserverUtil::loadRecords' must be the
+// most recent of the records published (as formatted by the formatting
+// functor in effect), in publication order, and must fit in the capacity of
+// the ring.  We also verify that the records of a process that is killed
+// while publishing are retained, and that invalid files are rejected.
+//-----------------------------------------------------------------------------
+// MappedRingObserver
+// CREATORS
+// [ 2] MappedRingObserver(const allocator_type& allocator = {});
+// [ 2] virtual ~MappedRingObserver();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 2] int open(const char *path, bsls::Types::Int64 capacity);
+// [ 3] virtual void publish(const shared_ptr<const Record>&, Context&);
+// [ 3] virtual void releaseRecords();
+// [ 3] void setRecordFormatFunctor(const RecordFormatFunctor& formatter);
+// [ 2] int sync();
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 capacity() const;
+// [ 2] bool isOpen() const;
+// [ 2] bsls::Types::Int64 maxRecordLength() const;
+//
+// MappedRingObserverUtil
+// CLASS METHODS
+// [ 3] int loadRecords(bsl::vector<bsl::string> *, const char *);
+// [ 6] int loadRecords(bsl::vector<bsl::string> *, const char *);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] WRAPAROUND
+// [ 5] REOPENING A RING BUFFER FILE
+// [ 6] INVALID RING BUFFER FILES
+// [ 7] CRASH DURABILITY
+// [ 8] CONCURRENT PUBLICATION
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::MappedRingObserver     Obj;
+typedef ball::MappedRingObserverUtil Util;
+typedef bsls::Types::Int64           Int64;
+
+const Int64 k_ENTRY_HEADER_SIZE = 8;  // size of an entry header
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+bsl::shared_ptr<ball::Record> makeRecord(const bsl::string_view&  message,
+                                         bslma::Allocator        *allocator)
+    // Return a record having the specified 'message' and default values for
+    // its other attributes, using the specified 'allocator' to supply memory.
+{
+    ball::RecordAttributes attributes(allocator);
+    attributes.setMessage(bsl::string(message, allocator).c_str());
+
+    return bsl::allocate_shared<ball::Record>(allocator,
+                                              attributes,
+                                              ball::UserFields(allocator));
+}
+
+void formatMessage(bsl::ostream& stream, const ball::Record& record)
+    // Write the message of the specified 'record' to the specified 'stream'.
+{
+    const bslstl::StringRef message = record.fixedFields().messageRef();
+
+    stream.write(message.data(), message.length());
+}
+
+Int64 entrySize(bsl::size_t length)
+    // Return the number of bytes occupied in a ring by an entry holding a
+    // record of the specified 'length'.
+{
+    return k_ENTRY_HEADER_SIZE + (static_cast<Int64>(length) + 7) / 8 * 8;
+}
+
+bsl::string messageFor(int index)
+    // Return a message, identified by the specified 'index', having a length
+    // that varies with 'index'.
+{
+    bsl::ostringstream oss;
+    oss << "message " << index << ' ' << bsl::string(index * 7 % 61, 'x');
+    return oss.str();
+}
+
+                       // ==========================
+                       // struct PublishThreadArgs
+                       // ==========================
+
+struct PublishThreadArgs {
+    // This 'struct' holds the arguments of 'publishThread'.
+
+    Obj            *d_observer_p;
+    int             d_numRecords;
+    bslmt::Barrier *d_barrier_p;
+    int             d_threadId;
+};
+
+extern "C" void *mappedRingPublishThread(void *arg)
+    // Publish 'd_numRecords' records having messages of the form
+    // "T<threadId>:<index>" to the observer described by the specified 'arg',
+    // which is the address of a 'PublishThreadArgs' object.
+{
+    PublishThreadArgs *args = static_cast<PublishThreadArgs *>(arg);
+
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    ball::Context context;
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < args->d_numRecords; ++i) {
+        bsl::ostringstream oss;
+        oss << 'T' << args->d_threadId << ':' << i;
+
+        args->d_observer_p->publish(makeRecord(oss.str(), allocator),
+                                    context);
+    }
+
+    return 0;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        // This is standard preamble to create the directory and filename for
+        // the test.
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+///Example 1: Flight Recorder Logging
+/// - - - - - - - - - - - - - - - - -
+// Suppose that a service logs its warnings and errors to a file (using, e.g.,
+// a 'ball::FileObserver2'), but that, when a failure occurs, we would like to
+// see all of the records (including those of 'DEBUG' and 'TRACE' severity)
+// that were published shortly beforehand.  Writing all of those records to
+// the log file would be too expensive, so we use a
+// 'ball::MappedRingObserver' to keep the most recent of them in a ring
+// buffer file.
+//
+// First, we create the observer, and open a ring buffer file having a
+// capacity of 1MB:
+//..
+        ball::MappedRingObserver observer;
+
+        int rc = observer.open(fileName.c_str(), 1024 * 1024);
+        ASSERT(0 == rc);
+        ASSERT(true == observer.isOpen());
+//..
+// Then, we publish records to the observer (typically by registering it with
+// the logger manager, possibly alongside other observers by means of a
+// 'ball::BroadcastObserver').  Here, we publish records directly:
+//..
+        ball::RecordAttributes attributes;
+        ball::UserFields       fieldValues;
+        ball::Context          context;
+
+        bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+        bsl::shared_ptr<ball::Record> record(
+                         new (*ga) ball::Record(attributes, fieldValues, ga),
+                         ga);
+
+        record->fixedFields().setMessage("connection established");
+        observer.publish(record, context);
+
+        record->fixedFields().setMessage("sending request");
+        observer.publish(record, context);
+//..
+// Next, we close the file.  Note that the records would be retained in the
+// file just as well if the process were to terminate abnormally at this
+// point:
+//..
+        observer.close();
+//..
+// Finally, we read back the records, oldest first (typically in a separate
+// process, after the failure occurred):
+//..
+        bsl::vector<bsl::string> records;
+
+        rc = ball::MappedRingObserverUtil::loadRecords(&records,
+                                                       fileName.c_str());
+        ASSERT(0 == rc);
+        ASSERT(2 == records.size());
+        ASSERT(bsl::string::npos != records[0].find("connection established"));
+        ASSERT(bsl::string::npos != records[1].find("sending request"));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently by multiple threads are written
+        //:   to the ring intact (i.e., not interleaved).
+        //:
+        //: 2 The records of any given thread are retained in the order in
+        //:   which the thread published them.
+        //
+        // Plan:
+        //: 1 Publish records having messages identifying the publishing thread
+        //:   and a per-thread index from several threads concurrently, to a
+        //:   ring that is too small to hold all of them.  Read back the
+        //:   records, and verify that each has the expected form, and that
+        //:   the indices of each thread are increasing.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT PUBLICATION"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 5000 };
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(0 == mX.open(fileName.c_str(), 64 * 1024));
+        mX.setRecordFormatFunctor(&formatMessage);
+
+        bslmt::Barrier                         barrier(k_NUM_THREADS);
+        bsl::vector<bslmt::ThreadUtil::Handle> threads(k_NUM_THREADS);
+        bsl::vector<PublishThreadArgs>         args(k_NUM_THREADS);
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            PublishThreadArgs a = { &mX, k_NUM_RECORDS, &barrier, i };
+            args[i] = a;
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                  mappedRingPublishThread,
+                                                  &args[i]));
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+        }
+
+        mX.close();
+        ASSERT(false == X.isOpen());
+
+        bsl::vector<bsl::string> records;
+
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERT(0 < records.size());
+
+        bsl::vector<int> lastIndex(k_NUM_THREADS, -1);
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            int  threadId = -1;
+            int  index    = -1;
+            char t;
+            char colon;
+
+            bsl::istringstream iss(records[i]);
+            iss >> t >> threadId >> colon >> index;
+
+            ASSERTV(records[i], iss && iss.eof());
+            ASSERTV(records[i], 'T' == t && ':' == colon);
+            ASSERTV(records[i], 0 <= threadId && threadId < k_NUM_THREADS);
+
+            if (0 <= threadId && threadId < k_NUM_THREADS) {
+                ASSERTV(records[i], lastIndex[threadId] < index);
+                ASSERTV(records[i], index < k_NUM_RECORDS);
+
+                lastIndex[threadId] = index;
+            }
+        }
+
+        // The most recent record of at least one thread is retained.
+
+        bool foundLast = false;
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            foundLast = foundLast || k_NUM_RECORDS - 1 == lastIndex[i];
+        }
+        ASSERT(foundLast);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CRASH DURABILITY
+        //
+        // Concerns:
+        //: 1 The records published by a process that is killed (without
+        //:   closing the ring buffer file) are retained in the file.
+        //
+        // Plan:
+        //: 1 Fork a child process that opens a ring buffer file, publishes
+        //:   records, and kills itself with 'SIGKILL'.  In the parent
+        //:   process, read back the records and verify that they are the
+        //:   ones published by the child.  (C-1)
+        //
+        // Testing:
+        //   CRASH DURABILITY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCRASH DURABILITY"
+                          << "\n================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        enum { k_NUM_RECORDS = 100 };
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const pid_t pid = fork();
+        ASSERT(-1 != pid);
+
+        if (0 == pid) {
+            Obj mX(&oa);
+
+            if (0 != mX.open(fileName.c_str(), 64 * 1024)) {
+                _exit(1);
+            }
+            mX.setRecordFormatFunctor(&formatMessage);
+
+            ball::Context context;
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX.publish(makeRecord(messageFor(i), &oa), context);
+            }
+
+            kill(getpid(), SIGKILL);
+            _exit(2);  // not reached
+        }
+
+        int status = 0;
+        ASSERT(pid == waitpid(pid, &status, 0));
+        ASSERTV(status, WIFSIGNALED(status) && SIGKILL == WTERMSIG(status));
+
+        bsl::vector<bsl::string> records;
+
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERTV(records.size(), k_NUM_RECORDS == records.size());
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            ASSERTV(i, messageFor(static_cast<int>(i)) == records[i]);
+        }
+#else
+        if (verbose) cout << "Skipped on this platform." << endl;
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // INVALID RING BUFFER FILES
+        //
+        // Concerns:
+        //: 1 'loadRecords' fails, with no effect on its 'result', if the file
+        //:   does not exist, is too small, is not a ring buffer file, or
+        //:   holds an invalid header or entry.
+        //
+        // Plan:
+        //: 1 Create a valid ring buffer file and verify that its records can
+        //:   be loaded.  Then, for each of a set of corruptions (applied to
+        //:   the file through a mapping, and reverted afterwards), verify that
+        //:   'loadRecords' returns a non-zero value and leaves its 'result'
+        //:   unchanged.  (C-1)
+        //
+        // Testing:
+        //   int loadRecords(bsl::vector<bsl::string> *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nINVALID RING BUFFER FILES"
+                          << "\n=========================" << endl;
+
+        typedef bdls::FilesystemUtil FileUtil;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::vector<bsl::string> SENTINEL(1, "sentinel", &oa);
+        bsl::vector<bsl::string>       records(&oa);
+
+        if (veryVerbose) cout << "\tMissing file." << endl;
+        {
+            records = SENTINEL;
+            ASSERT(0 != Util::loadRecords(&records, fileName.c_str()));
+            ASSERT(SENTINEL == records);
+        }
+
+        if (veryVerbose) cout << "\tFile that is not a ring." << endl;
+        {
+            FileUtil::FileDescriptor fd = FileUtil::open(
+                                                     fileName,
+                                                     FileUtil::e_CREATE,
+                                                     FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            const char text[] = "this is not a ring buffer file";
+
+            ASSERT(static_cast<int>(sizeof text) ==
+                             FileUtil::write(fd, text, sizeof text));
+            FileUtil::close(fd);
+
+            records = SENTINEL;
+            ASSERT(0 != Util::loadRecords(&records, fileName.c_str()));
+            ASSERT(SENTINEL == records);
+
+            fd = FileUtil::open(fileName,
+                                FileUtil::e_OPEN,
+                                FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+            ASSERT(0 == FileUtil::growFile(fd, 4096));
+            FileUtil::close(fd);
+
+            records = SENTINEL;
+            ASSERT(0 != Util::loadRecords(&records, fileName.c_str()));
+            ASSERT(SENTINEL == records);
+
+            ASSERT(0 == FileUtil::remove(fileName));
+        }
+
+        if (veryVerbose) cout << "\tCorrupted headers and entries." << endl;
+
+        const Int64 CAPACITY = 1024;
+        {
+            Obj mX(&oa);
+
+            ASSERT(0 == mX.open(fileName.c_str(), CAPACITY));
+            mX.setRecordFormatFunctor(&formatMessage);
+
+            ball::Context context;
+            mX.publish(makeRecord("first", &oa), context);
+            mX.publish(makeRecord("second", &oa), context);
+        }
+
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERT(2 == records.size());
+
+        // Offsets in the file (see {Ring Buffer File Format}).
+
+        enum {
+            k_MAGIC      = 0,
+            k_VERSION    = 8,
+            k_HEADER     = 12,
+            k_CAPACITY   = 16,
+            k_HEAD       = 24,
+            k_TAIL       = 32,
+            k_FIRST      = 64
+        };
+
+        static const struct {
+            int   d_line;
+            int   d_offset;    // offset of the corrupted 8 bytes
+            Int64 d_value;     // corrupted value
+        } DATA[] = {
+            //LINE  OFFSET       VALUE
+            //----  ----------   ------------------
+            { L_,   k_MAGIC,     0                   },
+            { L_,   k_VERSION,   2                   },
+            { L_,   k_HEADER,    0                   },
+            { L_,   k_CAPACITY,  0                   },
+            { L_,   k_CAPACITY,  1020                },
+            { L_,   k_CAPACITY,  1024 * 1024         },
+            { L_,   k_HEAD,      -8                  },
+            { L_,   k_HEAD,      12                  },
+            { L_,   k_HEAD,      2048                },
+            { L_,   k_TAIL,      8                   },
+            { L_,   k_TAIL,      -8                  },
+            { L_,   k_FIRST,     1000                },
+            { L_,   k_FIRST,     0xffffffff          },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const Int64 fileSize = FileUtil::getFileSize(fileName);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const int   OFFSET = DATA[ti].d_offset;
+            const Int64 VALUE  = DATA[ti].d_value;
+
+            if (veryVerbose) { T_ P_(LINE) P_(OFFSET) P(VALUE) }
+
+            // Corrupt the file through a mapping, saving the original bytes.
+
+            FileUtil::FileDescriptor fd = FileUtil::open(
+                                                     fileName,
+                                                     FileUtil::e_OPEN,
+                                                     FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            void *address = 0;
+            ASSERT(0 == FileUtil::map(fd,
+                                      &address,
+                                      0,
+                                      static_cast<bsl::size_t>(fileSize),
+                                      bdls::MemoryUtil::k_ACCESS_READ_WRITE));
+            FileUtil::close(fd);
+
+            char *bytes = static_cast<char *>(address);
+            char  original[8];
+
+            bsl::memcpy(original, bytes + OFFSET, sizeof original);
+
+            if (k_VERSION == OFFSET
+             || k_HEADER  == OFFSET
+             || k_FIRST   == OFFSET) {
+                const unsigned int value = static_cast<unsigned int>(VALUE);
+                bsl::memcpy(bytes + OFFSET, &value, sizeof value);
+            }
+            else {
+                bsl::memcpy(bytes + OFFSET, &VALUE, sizeof VALUE);
+            }
+
+            records = SENTINEL;
+            ASSERTV(LINE, 0 != Util::loadRecords(&records, fileName.c_str()));
+            ASSERTV(LINE, SENTINEL == records);
+
+            // Restore the file.
+
+            bsl::memcpy(bytes + OFFSET, original, sizeof original);
+            FileUtil::unmap(address, static_cast<bsl::size_t>(fileSize));
+
+            ASSERTV(LINE, 0 == Util::loadRecords(&records, fileName.c_str()));
+            ASSERTV(LINE, 2 == records.size());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // REOPENING A RING BUFFER FILE
+        //
+        // Concerns:
+        //: 1 Opening an existing ring buffer file having the requested
+        //:   capacity retains its records, and subsequently published
+        //:   records are appended to them.
+        //:
+        //: 2 Opening an existing ring buffer file having a different
+        //:   capacity, or a file that is not a ring buffer file, reinitializes
+        //:   it to an empty ring of the requested capacity.
+        //
+        // Plan:
+        //: 1 Publish records to a ring buffer file, close it, and reopen it
+        //:   with the same capacity.  Publish more records, and verify that
+        //:   all of the records are read back.  (C-1)
+        //:
+        //: 2 Reopen the file with a different capacity, and verify that it
+        //:   holds no records, and that its size reflects the new capacity.
+        //:   Repeat with a file that is not a ring buffer file.  (C-2)
+        //
+        // Testing:
+        //   REOPENING A RING BUFFER FILE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nREOPENING A RING BUFFER FILE"
+                          << "\n============================" << endl;
+
+        typedef bdls::FilesystemUtil FileUtil;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ball::Context            context;
+        bsl::vector<bsl::string> records;
+
+        Obj mX(&oa);  const Obj& X = mX;
+        mX.setRecordFormatFunctor(&formatMessage);
+
+        if (veryVerbose) cout << "\tSame capacity." << endl;
+
+        ASSERT(0 == mX.open(fileName.c_str(), 4096));
+        mX.publish(makeRecord("first run", &oa), context);
+        mX.close();
+
+        ASSERT(0 == mX.open(fileName.c_str(), 4096));
+        mX.publish(makeRecord("second run", &oa), context);
+        mX.close();
+
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERTV(records.size(), 2 == records.size());
+        if (2 == records.size()) {
+            ASSERT("first run"  == records[0]);
+            ASSERT("second run" == records[1]);
+        }
+
+        if (veryVerbose) cout << "\tDifferent capacity." << endl;
+
+        ASSERT(0 == mX.open(fileName.c_str(), 1024 * 1024));
+        ASSERT(1024 * 1024 == X.capacity());
+        mX.close();
+
+        ASSERT(1024 * 1024 < FileUtil::getFileSize(fileName));
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERT(records.empty());
+
+        ASSERT(0 == mX.open(fileName.c_str(), 1024));
+        mX.publish(makeRecord("third run", &oa), context);
+        mX.close();
+
+        ASSERT(1024 * 1024 > FileUtil::getFileSize(fileName));
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERT(1 == records.size() && "third run" == records[0]);
+
+        if (veryVerbose) cout << "\tNot a ring buffer file." << endl;
+
+        ASSERT(0 == FileUtil::remove(fileName));
+        {
+            FileUtil::FileDescriptor fd = FileUtil::open(
+                                                     fileName,
+                                                     FileUtil::e_CREATE,
+                                                     FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            const bsl::string text(8192, 'z');
+            FileUtil::write(fd, text.data(), static_cast<int>(text.length()));
+            FileUtil::close(fd);
+        }
+
+        ASSERT(0 == mX.open(fileName.c_str(), 1024));
+        mX.close();
+
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERT(records.empty());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // WRAPAROUND
+        //
+        // Concerns:
+        //: 1 When the ring is full, publishing a record overwrites the oldest
+        //:   records, and the records read back are the most recent records
+        //:   published, in publication order.
+        //:
+        //: 2 The records read back fit in the capacity of the ring, and no
+        //:   more than the records needed to make room for a new record are
+        //:   overwritten.
+        //:
+        //: 3 Records are written correctly at every position of the ring,
+        //:   including those requiring a wrap entry.
+        //:
+        //: 4 Once the formatting buffer has grown, publishing allocates no
+        //:   memory.
+        //
+        // Plan:
+        //: 1 For each of a set of capacities, publish a sequence of records
+        //:   of varying length, reading back the records after each
+        //:   publication, and verify that they are a suffix of the records
+        //:   published, that their total entry size does not exceed the
+        //:   capacity, and that the total entry size of the records read back
+        //:   and the record that preceded them exceeds the capacity, less the
+        //:   size of the largest wrap entry.  (C-1..3)
+        //:
+        //: 2 Use a test allocator monitor to verify that the object allocator
+        //:   is not used after the first publication of the longest record,
+        //:   and that the default allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   WRAPAROUND
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nWRAPAROUND"
+                          << "\n==========" << endl;
+
+        enum { k_NUM_RECORDS = 400 };
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> messages(&sa);
+        bsl::vector<bsl::shared_ptr<ball::Record> > inputs(&sa);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            messages.push_back(messageFor(i));
+            inputs.push_back(makeRecord(messages.back(), &sa));
+        }
+
+        const Int64 CAPACITIES[] = { 1024, 1032, 1536, 4096 };
+        const int   NUM_CAPACITIES =
+                      static_cast<int>(sizeof CAPACITIES / sizeof *CAPACITIES);
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const Int64 CAPACITY = CAPACITIES[ti];
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(fileName.c_str(), CAPACITY));
+            mX.setRecordFormatFunctor(&formatMessage);
+
+            ASSERT(CAPACITY / 2 - k_ENTRY_HEADER_SIZE == X.maxRecordLength());
+
+            ball::Context            context;
+            bsl::vector<bsl::string> records(&sa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                if (149 == i) {
+                    // The longest message (having index 148) has been
+                    // published.
+
+                    oam.reset(&oa);
+                }
+
+                mX.publish(inputs[i], context);
+
+                ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+
+                const int numRecords = static_cast<int>(records.size());
+
+                ASSERTV(CAPACITY, i, 0 < numRecords && numRecords <= i + 1);
+
+                Int64 total = 0;
+                for (int j = 0; j < numRecords; ++j) {
+                    const int index = i + 1 - numRecords + j;
+
+                    ASSERTV(CAPACITY, i, j, messages[index] == records[j]);
+
+                    total += entrySize(records[j].length());
+                }
+
+                ASSERTV(CAPACITY, i, total, total <= CAPACITY);
+
+                if (numRecords < i + 1) {
+                    const Int64 previous =
+                           entrySize(messages[i - numRecords].length());
+
+                    ASSERTV(CAPACITY, i, total, previous,
+                            total + previous >
+                                   CAPACITY - entrySize(X.maxRecordLength()));
+                }
+            }
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(dam.isTotalSame());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING PUBLISH
+        //
+        // Concerns:
+        //: 1 Published records are formatted with the default format until
+        //:   'setRecordFormatFunctor' is called, and with the supplied
+        //:   functor afterwards.
+        //:
+        //: 2 The bytes written by the formatting functor (including null
+        //:   bytes) are read back unaltered.
+        //:
+        //: 3 Records published while no ring buffer file is open are
+        //:   discarded.
+        //:
+        //: 4 A record longer than 'maxRecordLength()' is truncated to that
+        //:   length.
+        //:
+        //: 5 'releaseRecords' has no effect.
+        //:
+        //: 6 Memory is supplied by the object allocator only.
+        //
+        // Plan:
+        //: 1 Publish records with the default format and with custom
+        //:   formatting functors (including one writing binary data), and
+        //:   verify the records read back.  (C-1..2, 5)
+        //:
+        //: 2 Publish records while the observer is closed, and verify that
+        //:   they are not read back.  (C-3)
+        //:
+        //: 3 Publish records that are shorter than, as long as, and longer
+        //:   than 'maxRecordLength()', and verify the records read back.
+        //:   (C-4)
+        //:
+        //: 4 Verify that the default allocator is not used.  (C-6)
+        //
+        // Testing:
+        //   virtual void publish(const shared_ptr<const Record>&, Context&);
+        //   virtual void releaseRecords();
+        //   void setRecordFormatFunctor(const RecordFormatFunctor& formatter);
+        //   int loadRecords(bsl::vector<bsl::string> *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PUBLISH"
+                          << "\n===============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+        ball::Context            context;
+        bsl::vector<bsl::string> records(&sa);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        if (veryVerbose) cout << "\tPublishing while closed." << endl;
+
+        mX.publish(makeRecord("discarded", &sa), context);
+
+        ASSERT(0 == mX.open(fileName.c_str(), 4096));
+
+        if (veryVerbose) cout << "\tDefault format." << endl;
+        {
+            ball::RecordAttributes attributes(&sa);
+            attributes.setTimestamp(bdlt::Datetime(2023, 1, 2, 3, 4, 5, 678));
+            attributes.setProcessID(123);
+            attributes.setThreadID(45);
+            attributes.setSeverity(ball::Severity::e_WARN);
+            attributes.setFileName("file.cpp");
+            attributes.setLineNumber(99);
+            attributes.setCategory("CAT");
+            attributes.setMessage("hello world");
+
+            bsl::shared_ptr<ball::Record> record =
+                      bsl::allocate_shared<ball::Record>(&sa,
+                                                         attributes,
+                                                         ball::UserFields(&sa));
+            mX.publish(record, context);
+            mX.releaseRecords();
+
+            ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+            ASSERTV(records.size(), 1 == records.size());
+            if (1 == records.size()) {
+                ASSERTV(records[0],
+                        "02JAN2023_03:04:05.678 123:45 WARN file.cpp:99 CAT "
+                        "hello world " == records[0]);
+            }
+        }
+
+        if (veryVerbose) cout << "\tCustom format." << endl;
+        {
+            mX.setRecordFormatFunctor(&formatMessage);
+
+            mX.publish(makeRecord("custom", &sa), context);
+            mX.publish(makeRecord("",       &sa), context);
+
+            ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+            ASSERTV(records.size(), 3 == records.size());
+            if (3 == records.size()) {
+                ASSERT("custom" == records[1]);
+                ASSERT(""       == records[2]);
+            }
+        }
+
+        if (veryVerbose) cout << "\tBinary format." << endl;
+        {
+            struct BinaryFormatter {
+                static void format(bsl::ostream& stream, const ball::Record&)
+                {
+                    const char bytes[] = { 'a', '\0', '\xff', '\n', 'b' };
+                    stream.write(bytes, sizeof bytes);
+                }
+            };
+
+            mX.setRecordFormatFunctor(&BinaryFormatter::format);
+
+            mX.publish(makeRecord("ignored", &sa), context);
+
+            ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+            ASSERTV(records.size(), 4 == records.size());
+            if (4 == records.size()) {
+                ASSERT(bsl::string("a\0\xff\nb", 5) == records[3]);
+            }
+        }
+
+        if (veryVerbose) cout << "\tTruncation." << endl;
+        {
+            mX.setRecordFormatFunctor(&formatMessage);
+
+            const bsl::size_t MAX_LENGTH =
+                                static_cast<bsl::size_t>(X.maxRecordLength());
+
+            ASSERT(4096 / 2 - k_ENTRY_HEADER_SIZE ==
+                                           static_cast<Int64>(MAX_LENGTH));
+
+            const bsl::size_t LENGTHS[] = { MAX_LENGTH - 1,
+                                            MAX_LENGTH,
+                                            MAX_LENGTH + 1,
+                                            3 * MAX_LENGTH };
+            const int         NUM_LENGTHS =
+                            static_cast<int>(sizeof LENGTHS / sizeof *LENGTHS);
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const bsl::size_t LENGTH = LENGTHS[ti];
+
+                bsl::string message(LENGTH, 'a', &sa);
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    message[i] = static_cast<char>('a' + i % 26);
+                }
+
+                mX.publish(makeRecord(message, &sa), context);
+
+                ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+                ASSERTV(LENGTH, 0 < records.size());
+                if (0 < records.size()) {
+                    const bsl::size_t EXP_LENGTH = bsl::min(LENGTH,
+                                                            MAX_LENGTH);
+
+                    ASSERTV(LENGTH, EXP_LENGTH == records.back().length());
+                    ASSERTV(LENGTH, 0 == message.compare(0,
+                                                         EXP_LENGTH,
+                                                         records.back()));
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tPublishing after closing." << endl;
+        {
+            ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+            const bsl::size_t NUM_RECORDS = records.size();
+
+            mX.close();
+            mX.publish(makeRecord("discarded", &sa), context);
+
+            ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+            ASSERT(NUM_RECORDS == records.size());
+            ASSERT("discarded" != records.back());
+        }
+
+        ASSERT(dam.isTotalSame());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING OPEN AND CLOSE
+        //
+        // Concerns:
+        //: 1 A default-constructed observer has no open ring buffer file.
+        //:
+        //: 2 'open' creates the ring buffer file, having a size sufficient to
+        //:   hold the header and the data region, and the accessors reflect
+        //:   the capacity supplied to 'open'.
+        //:
+        //: 3 'close' closes the file and resets the accessors, and has no
+        //:   effect if no file is open.
+        //:
+        //: 4 'open' fails, with no effect, if the file can not be opened.
+        //:
+        //: 5 'sync' succeeds if and only if a file is open.
+        //:
+        //: 6 The destructor closes the file.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an observer and verify the accessors.  Open, sync, and
+        //:   close ring buffer files having various capacities, verifying the
+        //:   accessors and the size of the files.  (C-1..3, 5..6)
+        //:
+        //: 2 Attempt to open a file in a directory that does not exist.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid capacities, a null path, and opening an
+        //:   observer that is already open.  (C-7)
+        //
+        // Testing:
+        //   MappedRingObserver(const allocator_type& allocator = {});
+        //   virtual ~MappedRingObserver();
+        //   void close();
+        //   int open(const char *path, bsls::Types::Int64 capacity);
+        //   int sync();
+        //   bsls::Types::Int64 capacity() const;
+        //   bool isOpen() const;
+        //   bsls::Types::Int64 maxRecordLength() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING OPEN AND CLOSE"
+                          << "\n======================" << endl;
+
+        typedef bdls::FilesystemUtil FileUtil;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+        const Int64 CAPACITIES[] = { Obj::k_MIN_CAPACITY,
+                                     4096 - 64,
+                                     4096,
+                                     1024 * 1024 + 8 };
+        const int   NUM_CAPACITIES =
+                      static_cast<int>(sizeof CAPACITIES / sizeof *CAPACITIES);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(false == X.isOpen());
+            ASSERT(0     == X.capacity());
+            ASSERT(0     == X.maxRecordLength());
+            ASSERT(0     != mX.sync());
+
+            mX.close();
+            ASSERT(false == X.isOpen());
+
+            for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+                const Int64 CAPACITY = CAPACITIES[ti];
+
+                if (veryVerbose) { T_ P(CAPACITY) }
+
+                ASSERTV(CAPACITY, 0 == mX.open(fileName.c_str(), CAPACITY));
+
+                ASSERTV(CAPACITY, true     == X.isOpen());
+                ASSERTV(CAPACITY, CAPACITY == X.capacity());
+                ASSERTV(CAPACITY, CAPACITY / 2 - k_ENTRY_HEADER_SIZE ==
+                                                          X.maxRecordLength());
+                ASSERTV(CAPACITY, 0        == mX.sync());
+
+                const Int64 fileSize = FileUtil::getFileSize(fileName);
+
+                ASSERTV(CAPACITY, fileSize, 64 + CAPACITY <= fileSize);
+                ASSERTV(CAPACITY, fileSize, 0 == fileSize %
+                                                bdls::MemoryUtil::pageSize());
+
+                mX.close();
+
+                ASSERTV(CAPACITY, false == X.isOpen());
+                ASSERTV(CAPACITY, 0     == X.capacity());
+                ASSERTV(CAPACITY, 0     == X.maxRecordLength());
+                ASSERTV(CAPACITY, 0     != mX.sync());
+
+                bsl::vector<bsl::string> records(&oa);
+                ASSERTV(CAPACITY, 0 == Util::loadRecords(&records,
+                                                         fileName.c_str()));
+                ASSERTV(CAPACITY, records.empty());
+            }
+
+            bsl::string badName(tempDirGuard.getTempDirName(), &oa);
+            bdls::PathUtil::appendRaw(&badName, "missing");
+            bdls::PathUtil::appendRaw(&badName, "ring.log");
+
+            ASSERT(0     != mX.open(badName.c_str(), 4096));
+            ASSERT(false == X.isOpen());
+            ASSERT(0     == X.capacity());
+
+            // Leave the file open, to be closed by the destructor.
+
+            ASSERT(0 == mX.open(fileName.c_str(), 4096));
+        }
+
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+
+            ASSERT_FAIL(mX.open(0,                4096));
+            ASSERT_FAIL(mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY - 8));
+            ASSERT_FAIL(mX.open(fileName.c_str(), 4100));
+            ASSERT_PASS(mX.open(fileName.c_str(), 4096));
+            ASSERT_FAIL(mX.open(fileName.c_str(), 4096));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Open a ring buffer file, publish a few records, close the file,
+        //:   and read the records back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(false == X.isOpen());
+        ASSERT(0     == mX.open(fileName.c_str(), 64 * 1024));
+        ASSERT(true  == X.isOpen());
+
+        ball::Context context;
+
+        mX.publish(makeRecord("one",   &oa), context);
+        mX.publish(makeRecord("two",   &oa), context);
+        mX.publish(makeRecord("three", &oa), context);
+
+        mX.close();
+        ASSERT(false == X.isOpen());
+
+        bsl::vector<bsl::string> records;
+
+        ASSERT(0 == Util::loadRecords(&records, fileName.c_str()));
+        ASSERT(3 == records.size());
+
+        if (veryVerbose) {
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                T_ P(records[i])
+            }
+        }
+
+        if (3 == records.size()) {
+            ASSERT(bsl::string::npos != records[0].find("one"));
+            ASSERT(bsl::string::npos != records[1].find("two"));
+            ASSERT(bsl::string::npos != records[2].find("three"));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Publishing a record to a full ring is cheap.
+        //
+        // Plan:
+        //: 1 Publish a large number of records to a ring that is much smaller
+        //:   than the total size of the records, with the default format and
+        //:   with a format writing only the message, and report the time
+        //:   per record.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ball::Context context;
+
+        const bsl::shared_ptr<ball::Record> record = makeRecord(
+                             "a log record message of a fairly typical length",
+                             &oa);
+
+        for (int withDefaultFormat = 1; withDefaultFormat >= 0;
+                                                         --withDefaultFormat) {
+            Obj mX(&oa);
+
+            ASSERT(0 == mX.open(fileName.c_str(), 1024 * 1024));
+
+            if (!withDefaultFormat) {
+                mX.setRecordFormatFunctor(&formatMessage);
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(record, context);
+            }
+
+            timer.stop();
+
+            cout << (withDefaultFormat ? "default format: "
+                                       : "message only:   ")
+                 << timer.elapsedTime() * 1e9 / NUM_RECORDS
+                 << " ns/record" << endl;
+
+            mX.close();
+            ASSERT(0 == bdls::FilesystemUtil::remove(fileName));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,399 @@
+// ball_perthreadrecordbuffer.cpp                                     -*-C++-*-
+#include <ball_perthreadrecordbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_perthreadrecordbuffer_cpp,"$Id$ $CSID$")
+
+#include <ball_recordattributes.h>
+
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each 'PerThreadRecordBuffer_Queue' has a single producer, the thread
+// associated with it through 'd_key', and a single consumer at a time, the
+// thread holding its consumer lock.  The collecting thread acquires the
+// consumer lock of each queue in turn (spinning if necessary, which is brief,
+// since the lock is held by a producer only to discard one record).  A
+// producer finding its queue full only *tries* to acquire the consumer lock,
+// so that 'pushBack' never blocks.
+//
+// A queue is marked as not in use when its producer exits (see
+// 'releaseQueue'), and can then be adopted by another thread in
+// 'acquireQueue'.  The release and acquire operations on 'd_isInUse' order
+// the pushes of the former producer before those of the new one.
+//
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is aligned on a cache line
+// on platforms supporting 'alignas', which is stricter than the alignment
+// guaranteed by 'bslma::Allocator', so the queue is constructed in a suitably
+// aligned part of an oversized block.
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+                            // ===================
+                            // struct TimestampLess
+                            // ===================
+
+struct TimestampLess {
+    // This 'struct' provides a comparator ordering record handles by the
+    // timestamps of the records they refer to.
+
+    // ACCESSORS
+    bool operator()(const bsl::shared_ptr<Record>& lhs,
+                    const bsl::shared_ptr<Record>& rhs) const
+        // Return 'true' if the record referred to by the specified 'lhs' has
+        // an earlier timestamp than the record referred to by the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs->fixedFields().timestamp() <
+                                               rhs->fixedFields().timestamp();
+    }
+};
+
+}  // close unnamed namespace
+
+                     // =================================
+                     // class PerThreadRecordBuffer_Queue
+                     // =================================
+
+class PerThreadRecordBuffer_Queue {
+    // This component-private class provides the bounded queue of record
+    // handles owned by a thread pushing records into a
+    // 'PerThreadRecordBuffer', along with the flags coordinating its producer
+    // and consumers.
+
+  public:
+    // PUBLIC TYPES
+    typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<
+                                              bsl::shared_ptr<Record> > Queue;
+
+  private:
+    // DATA
+    void             *d_memory_p;      // block holding '*d_queue_p' (owned)
+
+    Queue            *d_queue_p;       // queue of record handles (owned)
+
+    bsls::AtomicBool  d_isConsuming;   // consumer lock
+
+    bsls::AtomicBool  d_isInUse;       // 'true' while a thread is the
+                                       // producer of this queue
+
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    PerThreadRecordBuffer_Queue(const PerThreadRecordBuffer_Queue&);
+    PerThreadRecordBuffer_Queue& operator=(const PerThreadRecordBuffer_Queue&);
+
+  public:
+    // CREATORS
+    PerThreadRecordBuffer_Queue(int capacity, bslma::Allocator *allocator);
+        // Create a queue of record handles, in use by the calling thread,
+        // having the specified 'capacity' and using the specified 'allocator'
+        // to supply memory.
+
+    ~PerThreadRecordBuffer_Queue();
+        // Destroy this object.
+
+    // MANIPULATORS
+    bool acquire();
+        // Make the calling thread the producer of this queue if it has no
+        // producer.  Return 'true' on success, and 'false' otherwise.
+
+    void release();
+        // Make this queue available to another producer.
+
+    void lockConsumer();
+        // Make the calling thread the consumer of this queue, blocking until
+        // no other thread is.
+
+    bool tryLockConsumer();
+        // Make the calling thread the consumer of this queue if no other
+        // thread is.  Return 'true' on success, and 'false' otherwise.
+
+    void unlockConsumer();
+        // Release the consumer lock of this queue.
+
+    Queue& queue();
+        // Return a reference providing modifiable access to the queue of
+        // record handles.
+};
+
+                     // ---------------------------------
+                     // class PerThreadRecordBuffer_Queue
+                     // ---------------------------------
+
+// CREATORS
+PerThreadRecordBuffer_Queue::PerThreadRecordBuffer_Queue(
+                                                   int               capacity,
+                                                   bslma::Allocator *allocator)
+: d_memory_p(0)
+, d_queue_p(0)
+, d_isConsuming(false)
+, d_isInUse(true)
+, d_allocator_p(allocator)
+{
+    const int alignment = bslmt::Platform::e_CACHE_LINE_SIZE;
+
+    d_memory_p = d_allocator_p->allocate(sizeof(Queue) + alignment);
+
+    char *address = static_cast<char *>(d_memory_p);
+    address += bsls::AlignmentUtil::calculateAlignmentOffset(address,
+                                                             alignment);
+
+    d_queue_p = new (address) Queue(capacity, d_allocator_p);
+}
+
+PerThreadRecordBuffer_Queue::~PerThreadRecordBuffer_Queue()
+{
+    d_queue_p->~Queue();
+    d_allocator_p->deallocate(d_memory_p);
+}
+
+// MANIPULATORS
+inline
+bool PerThreadRecordBuffer_Queue::acquire()
+{
+    return false == d_isInUse.testAndSwapAcqRel(false, true);
+}
+
+inline
+void PerThreadRecordBuffer_Queue::release()
+{
+    d_isInUse.storeRelease(false);
+}
+
+inline
+void PerThreadRecordBuffer_Queue::lockConsumer()
+{
+    while (!tryLockConsumer()) {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+inline
+bool PerThreadRecordBuffer_Queue::tryLockConsumer()
+{
+    return false == d_isConsuming.testAndSwapAcqRel(false, true);
+}
+
+inline
+void PerThreadRecordBuffer_Queue::unlockConsumer()
+{
+    d_isConsuming.storeRelease(false);
+}
+
+inline
+PerThreadRecordBuffer_Queue::Queue& PerThreadRecordBuffer_Queue::queue()
+{
+    return *d_queue_p;
+}
+
+                        // ---------------------------
+                        // class PerThreadRecordBuffer
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+void PerThreadRecordBuffer::releaseQueue(void *queue)
+{
+    static_cast<PerThreadRecordBuffer_Queue *>(queue)->release();
+}
+
+// PRIVATE MANIPULATORS
+PerThreadRecordBuffer_Queue *PerThreadRecordBuffer::acquireQueue()
+{
+    PerThreadRecordBuffer_Queue *queue = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_queuesMutex);
+
+        for (bsl::size_t i = 0; i < d_queues.size(); ++i) {
+            if (d_queues[i]->acquire()) {
+                queue = d_queues[i];
+                break;
+            }
+        }
+
+        if (!queue) {
+            d_queues.reserve(d_queues.size() + 1);
+
+            queue = new (*d_allocator_p) PerThreadRecordBuffer_Queue(
+                                                         d_maxRecordsPerThread,
+                                                         d_allocator_p);
+            d_queues.push_back(queue);
+        }
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_key, queue);
+    return queue;
+}
+
+// PRIVATE ACCESSORS
+void PerThreadRecordBuffer::collect() const
+{
+    const bsl::size_t numPrevious = d_records.size();
+
+    bsl::size_t numQueues;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_queuesMutex);
+
+        numQueues = d_queues.size();
+
+        bsl::shared_ptr<Record> handle;
+        for (bsl::size_t i = 0; i < numQueues; ++i) {
+            PerThreadRecordBuffer_Queue *queue = d_queues[i];
+
+            queue->lockConsumer();
+            while (0 == queue->queue().tryPopFront(&handle)) {
+                d_records.push_back(handle);
+            }
+            queue->unlockConsumer();
+        }
+    }
+
+    if (numPrevious == d_records.size()) {
+        return;                                                       // RETURN
+    }
+
+    // The records of each thread are (almost always) already in timestamp
+    // order, as are the records collected earlier; a stable sort preserves
+    // the order of the records of a thread having equal timestamps.
+
+    RecordHandles::iterator middle = d_records.begin() + numPrevious;
+
+    bsl::stable_sort(middle, d_records.end(), TimestampLess());
+    bsl::inplace_merge(d_records.begin(),
+                       middle,
+                       d_records.end(),
+                       TimestampLess());
+
+    const bsl::size_t maxLength = numQueues * d_maxRecordsPerThread;
+    while (d_records.size() > maxLength) {
+        d_records.pop_front();
+    }
+}
+
+// CREATORS
+PerThreadRecordBuffer::PerThreadRecordBuffer(
+                                         int               maxRecordsPerThread,
+                                         bslma::Allocator *basicAllocator)
+: d_queues(basicAllocator)
+, d_records(basicAllocator)
+, d_maxRecordsPerThread(maxRecordsPerThread)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxRecordsPerThread);
+
+    int rc = bslmt::ThreadUtil::createKey(
+                             &d_key,
+                             (bslmt::ThreadUtil::Destructor)&releaseQueue);
+    (void)rc;
+    BSLS_ASSERT_OPT(0 == rc);
+}
+
+PerThreadRecordBuffer::~PerThreadRecordBuffer()
+{
+    // Deleting the key does not invoke 'releaseQueue'; all queues are
+    // destroyed below.
+
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    for (bsl::size_t i = 0; i < d_queues.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_queues[i]);
+    }
+}
+
+// MANIPULATORS
+void PerThreadRecordBuffer::beginSequence()
+{
+    d_mutex.lock();
+    collect();
+}
+
+int PerThreadRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
+{
+    PerThreadRecordBuffer_Queue *queue =
+                            static_cast<PerThreadRecordBuffer_Queue *>(
+                                    bslmt::ThreadUtil::getSpecific(d_key));
+    if (!queue) {
+        queue = acquireQueue();
+    }
+
+    if (0 == queue->queue().tryPushBack(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    // The queue is full: discard its oldest record, unless the queue is being
+    // collected, in which case 'handle' is discarded instead.
+
+    if (!queue->tryLockConsumer()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::shared_ptr<Record> oldest;
+    queue->queue().tryPopFront(&oldest);
+    queue->unlockConsumer();
+
+    return queue->queue().tryPushBack(handle);
+}
+
+void PerThreadRecordBuffer::removeAll()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> queuesGuard(&d_queuesMutex);
+
+        for (bsl::size_t i = 0; i < d_queues.size(); ++i) {
+            PerThreadRecordBuffer_Queue *queue = d_queues[i];
+
+            queue->lockConsumer();
+            queue->queue().removeAll();
+            queue->unlockConsumer();
+        }
+    }
+
+    d_records.clear();
+}
+
+// ACCESSORS
+int PerThreadRecordBuffer::length() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    collect();
+
+    return static_cast<int>(d_records.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,405 @@
+// ball_perthreadrecordbuffer.h                                       -*-C++-*-
+#ifndef INCLUDED_BALL_PERTHREADRECORDBUFFER
+#define INCLUDED_BALL_PERTHREADRECORDBUFFER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a record buffer that buffers records per logging thread.
+//
+//@CLASSES:
+//  ball::PerThreadRecordBuffer: record buffer with a queue per logging thread
+//
+//@SEE_ALSO: ball_recordbuffer, ball_fixedsizerecordbuffer, ball_loggermanager
+//
+//@DESCRIPTION: This component provides a concrete thread-safe implementation
+// of the 'ball::RecordBuffer' protocol, 'ball::PerThreadRecordBuffer':
+//..
+//              ( ball::PerThreadRecordBuffer )
+//                            |              ctor
+//                            V
+//                  ( ball::RecordBuffer )
+//                                           dtor
+//                                           beginSequence
+//                                           endSequence
+//                                           popBack
+//                                           popFront
+//                                           pushBack
+//                                           pushFront
+//                                           removeAll
+//                                           length
+//                                           back
+//                                           front
+//..
+// Unlike 'ball::FixedSizeRecordBuffer', which protects a single buffer of
+// record handles with a mutex that every logging thread must acquire, a
+// 'ball::PerThreadRecordBuffer' gives each thread that calls 'pushBack' its
+// own bounded single-producer/single-consumer queue (see
+// 'bdlcc_singleproducersingleconsumerboundedqueue').  Pushing a record handle
+// therefore does not contend with other logging threads, and acquires no
+// lock unless the queue of the calling thread is full.
+//
+// The record handles buffered by the logging threads are *collected* --
+// removed from the per-thread queues and merged, in order of their
+// timestamps, at the back of a buffer shared by all threads -- by the
+// 'beginSequence', 'length', and 'removeAll' methods.  The remaining methods
+// ('back', 'front', 'popBack', 'popFront', and 'pushFront') operate on the
+// collected records only.  Consequently, the usual sequence of operations
+// performed when publishing the content of a record buffer:
+//..
+//  recordBuffer.beginSequence();
+//  int len = recordBuffer.length();
+//  for (int i = 0; i < len; ++i) {
+//      publish(recordBuffer.front());
+//      recordBuffer.popFront();
+//  }
+//  recordBuffer.endSequence();
+//..
+// observes all of the records pushed (and not discarded) before the call to
+// 'beginSequence', in timestamp order.  This is how 'ball::Logger' publishes
+// its record buffer on a Trigger or Trigger-All event, so a
+// 'ball::PerThreadRecordBuffer' preserves the "log on trigger" semantics of
+// the logger manager (see {'ball_loggermanager'|Per-Thread Record Buffers}).
+//
+///Capacity
+///--------
+// The number of records each thread can buffer is specified at construction.
+// If a thread pushes a record handle when its queue is full, the oldest record
+// handle in that queue is discarded to make room for the new one, unless the
+// queue is concurrently being collected, in which case the new record handle
+// is discarded.  The number of collected records is bounded by the
+// per-thread capacity times the number of threads that have pushed records
+// into the buffer; the oldest collected records are discarded to maintain
+// that bound.  Note that, unlike the size of a 'ball::FixedSizeRecordBuffer',
+// these bounds are numbers of records, and that there is *no* limit on the
+// number of bytes used by the buffered records.
+//
+// The queue of a thread is reused by another thread once the former thread
+// exits, so the memory used by a 'ball::PerThreadRecordBuffer' is bounded by
+// the maximum number of threads concurrently logging to it.  Note that the
+// records buffered by a thread that has exited remain in the buffer until
+// they are collected.
+//
+///Thread Safety
+///-------------
+// 'ball::PerThreadRecordBuffer' is fully thread-safe, except that the methods
+// 'front' and 'back' must be called after locking the buffer by invoking
+// 'beginSequence'.  The behavior is undefined if a
+// 'ball::PerThreadRecordBuffer' object is destroyed while another thread can
+// push records into it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Records Buffered by Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example we demonstrate the creation of a per-thread record
+// buffer, into which several threads push records, followed by the
+// publication, in timestamp order, of the records buffered by all threads.
+//
+// First, we define a function, executed by each of several threads, that
+// pushes a few records, each having the current time as its timestamp, into a
+// record buffer:
+//..
+//  void pushRecords(ball::RecordBuffer *recordBuffer, int threadIndex)
+//      // Push into the specified 'recordBuffer' three records logged by the
+//      // thread having the specified 'threadIndex'.
+//  {
+//      for (int i = 0; i < 3; ++i) {
+//          bsl::shared_ptr<ball::Record> record =
+//                                         bsl::allocate_shared<ball::Record>(
+//                                             bslma::Default::allocator());
+//
+//          record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+//          record->fixedFields().setLineNumber(threadIndex);
+//
+//          recordBuffer->pushBack(record);
+//      }
+//  }
+//..
+// Then, we create a record buffer that can hold at most 16 records per
+// thread:
+//..
+//  ball::PerThreadRecordBuffer recordBuffer(16);
+//..
+// Next, we push records into 'recordBuffer' from four threads, and wait for
+// these threads to complete:
+//..
+//  enum { k_NUM_THREADS = 4 };
+//
+//  bslmt::ThreadGroup threadGroup;
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      threadGroup.addThread(bdlf::BindUtil::bind(&pushRecords,
+//                                                 &recordBuffer,
+//                                                 i));
+//  }
+//  threadGroup.joinAll();
+//..
+// Now, we observe that 'recordBuffer' contains the records pushed by all
+// threads:
+//..
+//  recordBuffer.beginSequence();
+//  assert(3 * k_NUM_THREADS == recordBuffer.length());
+//..
+// Finally, we remove the records from 'recordBuffer' in FIFO order, and
+// verify that they are ordered by their timestamps:
+//..
+//  bdlt::Datetime previous = recordBuffer.front()->fixedFields().timestamp();
+//  while (recordBuffer.length()) {
+//      const ball::RecordAttributes& fields =
+//                                         recordBuffer.front()->fixedFields();
+//
+//      assert(previous <= fields.timestamp());
+//      previous = fields.timestamp();
+//
+//      recordBuffer.popFront();
+//  }
+//  recordBuffer.endSequence();
+//..
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+#include <ball_recordbuffer.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_recursivemutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_deque.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class PerThreadRecordBuffer_Queue;
+
+                        // ===========================
+                        // class PerThreadRecordBuffer
+                        // ===========================
+
+class PerThreadRecordBuffer : public RecordBuffer {
+    // This class provides a concrete, thread-safe implementation of the
+    // 'RecordBuffer' protocol that buffers the record handles pushed by each
+    // thread in a bounded queue owned by that thread, and merges these queues,
+    // in timestamp order, into a buffer shared by all threads when a sequence
+    // of operations begins.  The class is thread-safe, except that the methods
+    // 'front' and 'back' must be called after locking the buffer by invoking
+    // 'beginSequence'.
+
+    // PRIVATE TYPES
+    typedef bsl::deque<bsl::shared_ptr<Record> > RecordHandles;
+
+    // DATA
+    mutable bslmt::RecursiveMutex   d_mutex;       // synchronizes access to
+                                                   // 'd_records'
+
+    mutable bslmt::Mutex            d_queuesMutex; // synchronizes access to
+                                                   // 'd_queues'
+
+    bslmt::ThreadUtil::Key          d_key;         // key of the queue owned
+                                                   // by the calling thread
+
+    bsl::vector<PerThreadRecordBuffer_Queue *>
+                                    d_queues;      // queues of all threads
+                                                   // (owned)
+
+    mutable RecordHandles           d_records;     // collected record handles
+
+    int                             d_maxRecordsPerThread;
+                                                   // capacity of each queue
+
+    bslma::Allocator               *d_allocator_p; // memory allocator (held,
+                                                   // not owned)
+
+    // NOT IMPLEMENTED
+    PerThreadRecordBuffer(const PerThreadRecordBuffer&);
+    PerThreadRecordBuffer& operator=(const PerThreadRecordBuffer&);
+
+    // PRIVATE CLASS METHODS
+    static void releaseQueue(void *queue);
+        // Make the specified 'queue' available to a thread other than its
+        // current producer.  This method is invoked when a thread that pushed
+        // records into a 'PerThreadRecordBuffer' exits.
+
+    // PRIVATE MANIPULATORS
+    PerThreadRecordBuffer_Queue *acquireQueue();
+        // Return the address of a queue that is not used by any thread,
+        // allocating a new one if necessary, and associate that queue with the
+        // calling thread.
+
+    // PRIVATE ACCESSORS
+    void collect() const;
+        // Move the record handles buffered by all threads to the back of
+        // 'd_records', in timestamp order.  The behavior is undefined unless
+        // 'd_mutex' is locked by the calling thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PerThreadRecordBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    PerThreadRecordBuffer(int               maxRecordsPerThread,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a record buffer in which each thread can buffer at most the
+        // specified 'maxRecordsPerThread' record handles before they are
+        // collected.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < maxRecordsPerThread'.
+
+    virtual ~PerThreadRecordBuffer();
+        // Remove all record handles from this record buffer and destroy this
+        // record buffer.
+
+    // MANIPULATORS
+    virtual void beginSequence();
+        // *Lock* this record buffer so that a sequence of method invocations
+        // on this record buffer can occur uninterrupted by other threads, and
+        // collect the record handles buffered by all threads.  The buffer will
+        // remain *locked* until 'endSequence' is called.  It is valid to
+        // invoke other methods on this record buffer between the calls to
+        // 'beginSequence' and 'endSequence' (the implementation guarantees
+        // this by employing a recursive mutex).  Note that threads can push
+        // record handles while this buffer is locked.
+
+    virtual void endSequence();
+        // *Unlock* this record buffer, thus allowing other threads to access
+        // it.  The behavior is undefined unless the buffer is already *locked*
+        // by 'beginSequence'.
+
+    virtual void popBack();
+        // Remove from this record buffer the collected record handle
+        // positioned at the back end of the buffer.  The behavior is undefined
+        // unless '0 < length()'.
+
+    virtual void popFront();
+        // Remove from this record buffer the collected record handle
+        // positioned at the front end of the buffer.  The behavior is
+        // undefined unless '0 < length()'.
+
+    virtual int pushBack(const bsl::shared_ptr<Record>& handle);
+        // Push the specified 'handle' at the back end of the queue of the
+        // calling thread.  Return 0 on success, and a non-zero value if
+        // 'handle' is discarded.  In order to accommodate 'handle', the oldest
+        // record handle in the queue of the calling thread may be removed.
+
+    virtual int pushFront(const bsl::shared_ptr<Record>& handle);
+        // Push the specified 'handle' at the front end of the collected record
+        // handles of this record buffer.  Return 0.
+
+    virtual void removeAll();
+        // Remove all record handles stored in this record buffer, including
+        // those buffered by the threads that pushed them.  Note that
+        // 'length()' is now 0, unless record handles are pushed concurrently.
+
+    // ACCESSORS
+    virtual const bsl::shared_ptr<Record>& back() const;
+        // Return a reference of the shared pointer referring to the collected
+        // record positioned at the back end of this record buffer.  The
+        // behavior is undefined unless this record buffer has been locked by
+        // the 'beginSequence' method and unless '0 < length()'.
+
+    virtual const bsl::shared_ptr<Record>& front() const;
+        // Return a reference of the shared pointer referring to the collected
+        // record positioned at the front end of this record buffer.  The
+        // behavior is undefined unless this record buffer has been locked by
+        // the 'beginSequence' method and unless '0 < length()'.
+
+    virtual int length() const;
+        // Collect the record handles buffered by all threads, and return the
+        // number of record handles in this record buffer.
+
+    int maxRecordsPerThread() const;
+        // Return the maximum number of record handles each thread can buffer
+        // before they are collected.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class PerThreadRecordBuffer
+                        // ---------------------------
+
+// MANIPULATORS
+inline
+void PerThreadRecordBuffer::endSequence()
+{
+    d_mutex.unlock();
+}
+
+inline
+void PerThreadRecordBuffer::popBack()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    d_records.pop_back();
+}
+
+inline
+void PerThreadRecordBuffer::popFront()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    d_records.pop_front();
+}
+
+inline
+int PerThreadRecordBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    d_records.push_front(handle);
+    return 0;
+}
+
+// ACCESSORS
+inline
+const bsl::shared_ptr<Record>& PerThreadRecordBuffer::back() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    return d_records.back();
+}
+
+inline
+const bsl::shared_ptr<Record>& PerThreadRecordBuffer::front() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    return d_records.front();
+}
+
+inline
+int PerThreadRecordBuffer::maxRecordsPerThread() const
+{
+    return d_maxRecordsPerThread;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
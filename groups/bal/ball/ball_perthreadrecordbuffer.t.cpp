@@ -0,0 +1,729 @@
+// ball_perthreadrecordbuffer.t.cpp                                   -*-C++-*-
+#include <ball_perthreadrecordbuffer.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism implementing the
+// 'ball::RecordBuffer' protocol.  We first verify, from a single thread, that
+// the record handles pushed by a thread are collected, in order, by
+// 'beginSequence' and 'length', and that the manipulators and accessors
+// operate on the collected record handles.  We then verify the bound on the
+// number of record handles buffered by a thread, and the reuse of the queue of
+// a thread that exited.  Finally, we verify that the record handles pushed
+// concurrently by several threads are merged in timestamp order, and that no
+// record handle is lost while a thread collects them concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] PerThreadRecordBuffer(int maxRecordsPerThread, Allocator *ba = 0);
+// [ 2] ~PerThreadRecordBuffer();
+//
+// MANIPULATORS
+// [ 2] void beginSequence();
+// [ 2] void endSequence();
+// [ 2] void popBack();
+// [ 2] void popFront();
+// [ 2] int pushBack(const bsl::shared_ptr<Record>& handle);
+// [ 3] int pushBack(const bsl::shared_ptr<Record>& handle);
+// [ 2] int pushFront(const bsl::shared_ptr<Record>& handle);
+// [ 2] void removeAll();
+//
+// ACCESSORS
+// [ 2] const bsl::shared_ptr<Record>& back() const;
+// [ 2] const bsl::shared_ptr<Record>& front() const;
+// [ 2] int length() const;
+// [ 2] int maxRecordsPerThread() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: RECORDS OF ALL THREADS ARE MERGED BY TIMESTAMP
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::PerThreadRecordBuffer Obj;
+typedef bsl::shared_ptr<ball::Record> Handle;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Handle makeRecord(int               lineNumber,
+                  int               microseconds,
+                  bslma::Allocator *allocator)
+    // Return a handle to a new record, allocated from the specified
+    // 'allocator', having the specified 'lineNumber', and a timestamp that is
+    // the specified 'microseconds' after an arbitrary fixed time.
+{
+    Handle record = bsl::allocate_shared<ball::Record>(allocator);
+
+    bdlt::Datetime timestamp(2023, 1, 1);
+    timestamp.addMicroseconds(microseconds);
+
+    record->fixedFields().setTimestamp(timestamp);
+    record->fixedFields().setLineNumber(lineNumber);
+
+    return record;
+}
+
+void pushSequence(Obj              *recordBuffer,
+                  int               threadIndex,
+                  int               numThreads,
+                  int               numRecords,
+                  bslmt::Barrier   *barrier,
+                  bslma::Allocator *allocator)
+    // Wait on the specified 'barrier', then push into the specified
+    // 'recordBuffer' the specified 'numRecords' records, allocated from the
+    // specified 'allocator', the 'i'th of which has 'i' as its line number and
+    // a timestamp of 'i * numThreads + threadIndex' microseconds, where
+    // 'numThreads' and 'threadIndex' are also specified, and wait on
+    // 'barrier' again.  Note that the second wait prevents the queue of this
+    // thread from being reused by another thread calling this function.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numRecords; ++i) {
+        int rc = recordBuffer->pushBack(
+                       makeRecord(i, i * numThreads + threadIndex, allocator));
+        ASSERTV(threadIndex, i, 0 == rc);
+    }
+
+    barrier->wait();
+}
+
+void collectRecords(Obj               *recordBuffer,
+                    bsl::vector<int>  *numCollected,
+                    int                numThreads,
+                    int                numExpected,
+                    bsls::AtomicBool  *failed)
+    // Repeatedly remove, in FIFO order, the records from the specified
+    // 'recordBuffer', into which 'pushSequence' is invoked concurrently by the
+    // specified 'numThreads' threads, until the specified 'numExpected'
+    // records are removed, and load into the specified 'numCollected' the
+    // number of records removed for each thread.  Set the specified 'failed'
+    // flag if the records of a thread are not removed in order.
+{
+    numCollected->assign(numThreads, 0);
+
+    int total = 0;
+    while (total < numExpected) {
+        recordBuffer->beginSequence();
+        while (recordBuffer->length()) {
+            const ball::RecordAttributes& fields =
+                                          recordBuffer->front()->fixedFields();
+
+            const bdlt::Datetime base(2023, 1, 1);
+            const bsls::Types::Int64 microseconds =
+                               (fields.timestamp() - base).totalMicroseconds();
+
+            const int threadIndex = static_cast<int>(microseconds %
+                                                     numThreads);
+
+            if (fields.lineNumber() != (*numCollected)[threadIndex]) {
+                *failed = true;
+            }
+            ++(*numCollected)[threadIndex];
+            ++total;
+
+            recordBuffer->popFront();
+        }
+        recordBuffer->endSequence();
+
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Example 1: Publishing Records Buffered by Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example we demonstrate the creation of a per-thread record
+// buffer, into which several threads push records, followed by the
+// publication, in timestamp order, of the records buffered by all threads.
+//
+// First, we define a function, executed by each of several threads, that
+// pushes a few records, each having the current time as its timestamp, into a
+// record buffer:
+//..
+    void pushRecords(ball::RecordBuffer *recordBuffer, int threadIndex)
+        // Push into the specified 'recordBuffer' three records logged by the
+        // thread having the specified 'threadIndex'.
+    {
+        for (int i = 0; i < 3; ++i) {
+            bsl::shared_ptr<ball::Record> record =
+                                           bsl::allocate_shared<ball::Record>(
+                                               bslma::Default::allocator());
+
+            record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+            record->fixedFields().setLineNumber(threadIndex);
+
+            recordBuffer->pushBack(record);
+        }
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+// Then, we create a record buffer that can hold at most 16 records per
+// thread:
+//..
+    ball::PerThreadRecordBuffer recordBuffer(16);
+//..
+// Next, we push records into 'recordBuffer' from four threads, and wait for
+// these threads to complete:
+//..
+    enum { k_NUM_THREADS = 4 };
+
+    bslmt::ThreadGroup threadGroup;
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        threadGroup.addThread(bdlf::BindUtil::bind(&pushRecords,
+                                                   &recordBuffer,
+                                                   i));
+    }
+    threadGroup.joinAll();
+//..
+// Now, we observe that 'recordBuffer' contains the records pushed by all
+// threads:
+//..
+    recordBuffer.beginSequence();
+    ASSERT(3 * k_NUM_THREADS == recordBuffer.length());
+//..
+// Finally, we remove the records from 'recordBuffer' in FIFO order, and
+// verify that they are ordered by their timestamps:
+//..
+    bdlt::Datetime previous = recordBuffer.front()->fixedFields().timestamp();
+    while (recordBuffer.length()) {
+        const ball::RecordAttributes& fields =
+                                           recordBuffer.front()->fixedFields();
+
+        ASSERT(previous <= fields.timestamp());
+        previous = fields.timestamp();
+
+        recordBuffer.popFront();
+    }
+    recordBuffer.endSequence();
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: RECORDS OF ALL THREADS ARE MERGED BY TIMESTAMP
+        //
+        // Concerns:
+        //: 1 The records pushed by several threads are collected in the order
+        //:   of their timestamps.
+        //:
+        //: 2 The records pushed by a thread while another thread collects
+        //:   records are neither lost nor reordered.
+        //
+        // Plan:
+        //: 1 Push, from each of several threads, records whose timestamps
+        //:   interleave with those of the records of the other threads.  Join
+        //:   the threads, then remove the records in FIFO and LIFO order and
+        //:   verify that their timestamps are consecutive.  (C-1)
+        //:
+        //: 2 Push records from several threads while another thread
+        //:   repeatedly removes them in FIFO order, using a per-thread
+        //:   capacity large enough for no record to be discarded.  Verify that
+        //:   each record is removed once, and that the records of each thread
+        //:   are removed in the order they were pushed.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: RECORDS OF ALL THREADS ARE MERGED BY TIMESTAMP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: RECORDS OF ALL THREADS ARE MERGED BY TIMESTAMP"
+                 << endl
+                 << "======================================================="
+                 << endl;
+
+        const int k_NUM_THREADS = 6;
+        const int k_NUM_RECORDS = 500;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator ra("records", veryVeryVerbose);
+
+        if (verbose) cout << "\tMerging after the threads complete." << endl;
+        {
+            Obj mX(k_NUM_RECORDS, &ta);  const Obj& X = mX;
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup threadGroup;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bind(&pushSequence,
+                                                           &mX,
+                                                           i,
+                                                           k_NUM_THREADS,
+                                                           k_NUM_RECORDS,
+                                                           &barrier,
+                                                           &ra));
+            }
+            threadGroup.joinAll();
+
+            const int NUM_TOTAL = k_NUM_THREADS * k_NUM_RECORDS;
+
+            mX.beginSequence();
+            ASSERTV(X.length(), NUM_TOTAL == X.length());
+
+            const bdlt::Datetime base(2023, 1, 1);
+            for (int i = 0; i < NUM_TOTAL / 2; ++i) {
+                const bsls::Types::Int64 FRONT = (
+                      X.front()->fixedFields().timestamp() - base)
+                                                         .totalMicroseconds();
+                const bsls::Types::Int64 BACK = (
+                      X.back()->fixedFields().timestamp() - base)
+                                                         .totalMicroseconds();
+
+                ASSERTV(i, FRONT, i == FRONT);
+                ASSERTV(i, BACK,  NUM_TOTAL - 1 - i == BACK);
+
+                mX.popFront();
+                mX.popBack();
+            }
+            ASSERTV(X.length(), 0 == X.length());
+            mX.endSequence();
+        }
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+
+        if (verbose) cout << "\tCollecting while the threads push." << endl;
+        {
+            Obj mX(k_NUM_RECORDS, &ta);
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup threadGroup;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bind(&pushSequence,
+                                                           &mX,
+                                                           i,
+                                                           k_NUM_THREADS,
+                                                           k_NUM_RECORDS,
+                                                           &barrier,
+                                                           &ra));
+            }
+
+            bsl::vector<int> numCollected;
+            bsls::AtomicBool failed(false);
+            collectRecords(&mX,
+                           &numCollected,
+                           k_NUM_THREADS,
+                           k_NUM_THREADS * k_NUM_RECORDS,
+                           &failed);
+
+            threadGroup.joinAll();
+
+            ASSERT(!failed);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, numCollected[i], k_NUM_RECORDS == numCollected[i]);
+            }
+            ASSERT(0 == mX.length());
+        }
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CAPACITY
+        //
+        // Concerns:
+        //: 1 A thread buffers at most 'maxRecordsPerThread' records; pushing a
+        //:   record into a full queue discards the oldest record of that
+        //:   queue.
+        //:
+        //: 2 The records pushed by a thread that exited remain in the buffer.
+        //:
+        //: 3 The queue of a thread that exited is reused by another thread.
+        //:
+        //: 4 The number of collected records is bounded.
+        //
+        // Plan:
+        //: 1 Push, from a separate thread, more records than the per-thread
+        //:   capacity.  Join the thread and verify that the buffer holds the
+        //:   most recent records only.  (C-1..2)
+        //:
+        //: 2 Push records from a second thread, after the first thread exited,
+        //:   and verify that the buffer allocates no memory.  (C-3)
+        //:
+        //: 3 Repeatedly push records and collect them without removing them,
+        //:   and verify that the number of collected records remains bounded.
+        //:   (C-4)
+        //
+        // Testing:
+        //   int pushBack(const bsl::shared_ptr<Record>& handle);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING CAPACITY" << endl
+                                  << "================" << endl;
+
+        const int k_CAPACITY    = 8;
+        const int k_NUM_RECORDS = 20;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator ra("records", veryVeryVerbose);
+
+        Obj mX(k_CAPACITY, &ta);  const Obj& X = mX;
+
+        bslmt::Barrier barrier(1);
+        bslmt::ThreadUtil::Handle handle;
+
+        ASSERT(0 == bslmt::ThreadUtil::create(
+                                     &handle,
+                                     bdlf::BindUtil::bind(&pushSequence,
+                                                          &mX,
+                                                          0,
+                                                          1,
+                                                          k_NUM_RECORDS,
+                                                          &barrier,
+                                                          &ra)));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        mX.beginSequence();
+        ASSERTV(X.length(), k_CAPACITY == X.length());
+        ASSERTV(X.front()->fixedFields().lineNumber(),
+                k_NUM_RECORDS - k_CAPACITY ==
+                                       X.front()->fixedFields().lineNumber());
+        ASSERTV(X.back()->fixedFields().lineNumber(),
+                k_NUM_RECORDS - 1 == X.back()->fixedFields().lineNumber());
+        mX.removeAll();
+        mX.endSequence();
+
+        const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+        ASSERT(0 == bslmt::ThreadUtil::create(
+                                     &handle,
+                                     bdlf::BindUtil::bind(&pushSequence,
+                                                          &mX,
+                                                          0,
+                                                          1,
+                                                          k_CAPACITY / 2,
+                                                          &barrier,
+                                                          &ra)));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        ASSERTV(NUM_BLOCKS, ta.numBlocksTotal(),
+                NUM_BLOCKS == ta.numBlocksTotal());
+        ASSERTV(X.length(), k_CAPACITY / 2 == X.length());
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            mX.pushBack(makeRecord(i, i, &ra));
+            ASSERTV(i, X.length(), 2 * k_CAPACITY >= X.length());
+        }
+
+        mX.removeAll();
+        ASSERTV(X.length(), 0 == X.length());
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The records pushed by a thread are collected in the order they
+        //:   were pushed.
+        //:
+        //: 2 'back', 'front', 'popBack', 'popFront', and 'pushFront' operate
+        //:   on the collected records.
+        //:
+        //: 3 'removeAll' removes the collected records as well as the records
+        //:   that are not yet collected.
+        //:
+        //: 4 All memory is supplied by the object allocator, and is released
+        //:   on destruction.
+        //:
+        //: 5 Records are released when removed from the buffer.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Push records from the main thread and verify the values returned
+        //:   by the accessors as records are pushed and removed.  (C-1..3)
+        //:
+        //: 2 Use a test allocator for the object, another for the records,
+        //:   and install a test allocator as the default allocator.  Verify
+        //:   that the default allocator is not used, and that no memory is in
+        //:   use after destruction.  (C-4..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid capacities.  (C-6)
+        //
+        // Testing:
+        //   PerThreadRecordBuffer(int maxRecordsPerThread, Allocator *ba = 0);
+        //   ~PerThreadRecordBuffer();
+        //   void beginSequence();
+        //   void endSequence();
+        //   void popBack();
+        //   void popFront();
+        //   int pushBack(const bsl::shared_ptr<Record>& handle);
+        //   int pushFront(const bsl::shared_ptr<Record>& handle);
+        //   void removeAll();
+        //   const bsl::shared_ptr<Record>& back() const;
+        //   const bsl::shared_ptr<Record>& front() const;
+        //   int length() const;
+        //   int maxRecordsPerThread() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVerbose);
+        bslma::TestAllocator ra("records", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(4 == X.maxRecordsPerThread());
+            ASSERT(0 == X.length());
+
+            ASSERT(0 == mX.pushBack(makeRecord(1, 10, &ra)));
+            ASSERT(0 == mX.pushBack(makeRecord(2, 20, &ra)));
+            ASSERT(0 == mX.pushBack(makeRecord(3, 30, &ra)));
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 3 == X.length());
+            ASSERT(1 == X.front()->fixedFields().lineNumber());
+            ASSERT(3 == X.back()->fixedFields().lineNumber());
+
+            ASSERT(0 == mX.pushFront(makeRecord(0, 0, &ra)));
+            ASSERT(4 == X.length());
+            ASSERT(0 == X.front()->fixedFields().lineNumber());
+
+            mX.popFront();
+            ASSERT(3 == X.length());
+            ASSERT(1 == X.front()->fixedFields().lineNumber());
+
+            mX.popBack();
+            ASSERT(2 == X.length());
+            ASSERT(2 == X.back()->fixedFields().lineNumber());
+            mX.endSequence();
+
+            ASSERT(0 == mX.pushBack(makeRecord(4, 40, &ra)));
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 3 == X.length());
+            ASSERT(1 == X.front()->fixedFields().lineNumber());
+            ASSERT(4 == X.back()->fixedFields().lineNumber());
+            mX.endSequence();
+
+            ASSERT(0 == mX.pushBack(makeRecord(5, 50, &ra)));
+
+            mX.removeAll();
+            ASSERT(0 == X.length());
+            ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+
+            ASSERT(0 == mX.pushBack(makeRecord(6, 60, &ra)));
+            ASSERT(0 <  ra.numBlocksInUse());
+        }
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push a few records, then publish them in LIFO order.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(16, &ta);  const Obj& X = mX;
+
+        for (int i = 0; i < 5; ++i) {
+            ASSERT(0 == mX.pushBack(makeRecord(i, i, &ta)));
+        }
+
+        mX.beginSequence();
+        ASSERT(5 == X.length());
+        for (int i = 4; 0 <= i; --i) {
+            ASSERTV(i, i == X.back()->fixedFields().lineNumber());
+            mX.popBack();
+        }
+        ASSERT(0 == X.length());
+        mX.endSequence();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
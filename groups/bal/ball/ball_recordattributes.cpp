@@ -12,16 +12,77 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ball_recordattributes_cpp,"$Id$ $CSID$")
 
+#include <ball_deferredformatutil.h>
+
 #include <bdlb_print.h>
 
+#include <bdlma_localsequentialallocator.h>
+
 #include <bslma_default.h>
+
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
+#include <bsl_cstdarg.h>
 #include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
+#include <stdarg.h> // 'va_copy'
+
+#if !defined(va_copy)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    // 'va_copy' is defined by C99 and C++11, but gcc and clang do not define
+    // it in C++03 mode, where the internal '__va_copy' must be used instead.
+    #define va_copy(dest, src) __va_copy(dest, src)
+#else
+    // On the other platforms that do not define 'va_copy' (e.g., MSVC before
+    // VS2013), 'va_list' is a simple pointer.
+    #define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 namespace BloombergLP {
 namespace ball {
+namespace {
+
+                        // =======================
+                        // class MessageStateGuard
+                        // =======================
+
+class MessageStateGuard {
+    // This class implements a guard that stores a value into an atomic
+    // integer upon destruction.
+
+    // DATA
+    bsls::AtomicInt *d_state_p;  // state to update (held, not owned)
+    int              d_value;    // value stored upon destruction
+
+  private:
+    // NOT IMPLEMENTED
+    MessageStateGuard(const MessageStateGuard&);
+    MessageStateGuard& operator=(const MessageStateGuard&);
+
+  public:
+    // CREATORS
+    MessageStateGuard(bsls::AtomicInt *state, int value)
+        // Create a guard that stores the specified 'value' into the specified
+        // 'state' upon destruction.
+    : d_state_p(state)
+    , d_value(value)
+    {
+    }
+
+    ~MessageStateGuard()
+        // Store the value supplied at construction into the guarded state,
+        // with release semantics, and destroy this guard.
+    {
+        d_state_p->storeRelease(d_value);
+    }
+};
+
+}  // close unnamed namespace
 
                         // ----------------------
                         // class RecordAttributes
@@ -37,6 +98,8 @@ RecordAttributes::RecordAttributes(bslma::Allocator *basicAllocator)
 , d_category(basicAllocator)
 , d_severity(0)
 , d_messageStreamBuf(basicAllocator)
+, d_deferredFormat_p(0)
+, d_messageState(e_FORMATTED)
 {
 }
 
@@ -57,6 +120,8 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&  timestamp,
 , d_category(category, basicAllocator)
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
+, d_deferredFormat_p(0)
+, d_messageState(e_FORMATTED)
 {
     setMessage(message);
 }
@@ -71,15 +136,88 @@ RecordAttributes::RecordAttributes(const RecordAttributes&  original,
 , d_category(original.d_category, basicAllocator)
 , d_severity(original.d_severity)
 , d_messageStreamBuf(basicAllocator)
+, d_deferredFormat_p(0)
+, d_messageState(e_FORMATTED)
 {
+    original.formatMessageIfDeferred();
+
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(original.d_messageStreamBuf.data(),
                              original.d_messageStreamBuf.length());
 }
 
+// PRIVATE ACCESSORS
+void RecordAttributes::formatDeferredMessage() const
+{
+    if (e_DEFERRED != d_messageState.testAndSwap(e_DEFERRED, e_FORMATTING)) {
+        // Another thread is formatting the message, or has formatted it.
+
+        while (e_FORMATTED != d_messageState.loadAcquire()) {
+            bslmt::ThreadUtil::yield();
+        }
+        return;                                                       // RETURN
+    }
+
+    // Mark the message as formatted on exit, even if an exception is thrown,
+    // so that no other thread waits forever.
+
+    MessageStateGuard guard(&d_messageState, e_FORMATTED);
+
+    bdlsb::MemOutStreamBuf& streamBuf =
+                      const_cast<RecordAttributes *>(this)->d_messageStreamBuf;
+
+    // Copy the arguments, since they are overwritten by the message.
+
+    bdlma::LocalSequentialAllocator<k_RESET_MESSAGE_STREAM_CAPACITY>
+                      localAllocator(d_fileName.get_allocator().mechanism());
+    const bsl::string arguments(streamBuf.data(),
+                                streamBuf.length(),
+                                &localAllocator);
+
+    streamBuf.pubseekpos(0);
+    DeferredFormatUtil::formatArguments(&streamBuf,
+                                        d_deferredFormat_p,
+                                        arguments.data(),
+                                        arguments.length());
+}
+
 // MANIPULATORS
+void RecordAttributes::setDeferredMessage(const char *format, ...)
+{
+    BSLS_ASSERT(format);
+
+    d_messageState.storeRelaxed(e_FORMATTED);
+    d_deferredFormat_p = 0;
+    d_messageStreamBuf.pubseekpos(0);
+
+    bsl::va_list args;
+    va_start(args, format);
+
+    bsl::va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    if (0 == DeferredFormatUtil::captureArguments(&d_messageStreamBuf,
+                                                  format,
+                                                  args)) {
+        d_deferredFormat_p = format;
+        d_messageState.storeRelaxed(e_DEFERRED);
+    }
+    else {
+        d_messageStreamBuf.pubseekpos(0);
+        DeferredFormatUtil::formatVaList(&d_messageStreamBuf,
+                                         format,
+                                         argsCopy);
+    }
+
+    va_end(argsCopy);
+    va_end(args);
+}
+
 void RecordAttributes::setMessage(const char *message)
 {
+    d_deferredFormat_p = 0;
+    d_messageState.storeRelaxed(e_FORMATTED);
+
     d_messageStreamBuf.pubseekpos(0);
     while (*message) {
         d_messageStreamBuf.sputc(*message);
@@ -90,6 +228,11 @@ void RecordAttributes::setMessage(const char *message)
 RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
 {
     if (this != &rhs) {
+        rhs.formatMessageIfDeferred();
+
+        d_deferredFormat_p = 0;
+        d_messageState.storeRelaxed(e_FORMATTED);
+
         d_timestamp  = rhs.d_timestamp;
         d_processID  = rhs.d_processID;
         d_threadID   = rhs.d_threadID;
@@ -107,6 +250,8 @@ RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
 // ACCESSORS
 const char *RecordAttributes::message() const
 {
+    formatMessageIfDeferred();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     if (0 == length || '\0' != *(d_messageStreamBuf.data() + length - 1)) {
         // Null terminate the string.
@@ -122,6 +267,8 @@ const char *RecordAttributes::message() const
 
 bslstl::StringRef RecordAttributes::messageRef() const
 {
+    formatMessageIfDeferred();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     const char *str = d_messageStreamBuf.data();
 #if defined(BSLS_PLATFORM_OS_SOLARIS) || defined(BSLS_PLATFORM_OS_SUNOS)
@@ -56,6 +56,25 @@ BSLS_IDENT("$Id: $")
 // respective attributes by the default constructor of
 // 'ball::RecordAttributes'.
 //
+///Deferred Formatting
+///-------------------
+// The message attribute can also be set from a 'printf'-style format
+// specification and arguments using 'setDeferredMessage', which captures the
+// arguments (see 'ball_deferredformatutil') but does not format them.  The
+// message is formatted when it is first accessed (e.g., by 'messageRef'), so
+// that, for a record published by an asynchronous observer (e.g.,
+// 'ball::AsyncFileObserver'), the cost of formatting is borne by the
+// publication thread rather than by the thread that logs the record.  The
+// format specification is not copied, and must remain valid until the message
+// is formatted (e.g., it can be a string literal).
+//
+// The accessors of the message attribute ('message', 'messageRef', and
+// 'messageStreamBuf') can be called concurrently on an object whose message is
+// deferred: the message is formatted exactly once, and the other threads wait
+// until it is.  'isMessageDeferred' indicates whether the message has yet to
+// be formatted.  Note that the result of copying an object, or of comparing it
+// with another object, is as if its message had been formatted beforehand.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -182,6 +201,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_annotation.h>
+#include <bsls_atomic.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
@@ -229,6 +250,15 @@ class RecordAttributes {
                                                // (and not rewound)
     };
 
+    enum MessageState {
+        // Enumeration of the states of the message attribute.
+
+        e_FORMATTED  = 0,  // 'd_messageStreamBuf' holds the message
+        e_DEFERRED   = 1,  // 'd_messageStreamBuf' holds the arguments to be
+                           // formatted according to 'd_deferredFormat_p'
+        e_FORMATTING = 2   // the message is being formatted by a thread
+    };
+
     // DATA
     bdlt::Datetime   d_timestamp;    // creation date and time
     int              d_processID;    // process id of creator
@@ -238,8 +268,27 @@ class RecordAttributes {
     bsl::string      d_category;     // category of log record
     int              d_severity;     // severity of log record
 
-    bdlsb::MemOutStreamBuf d_messageStreamBuf;  // stream buffer associated
-                                                // with the message attribute
+    bdlsb::MemOutStreamBuf
+                     d_messageStreamBuf;  // stream buffer associated with the
+                                          // message attribute (or holding its
+                                          // deferred arguments)
+
+    const char      *d_deferredFormat_p;  // 'printf'-style format of the
+                                          // deferred message, if any
+
+    mutable bsls::AtomicInt
+                     d_messageState;      // state of the message attribute
+                                          // (see 'MessageState')
+
+    // PRIVATE ACCESSORS
+    void formatDeferredMessage() const;
+        // Format the deferred message attribute of this record attributes
+        // object, or, if another thread is formatting it, wait until it is
+        // formatted.
+
+    void formatMessageIfDeferred() const;
+        // Format the message attribute of this record attributes object if
+        // it is deferred.  Note that this method is const thread-safe.
 
     // FRIENDS
     friend bool operator==(const RecordAttributes&, const RecordAttributes&);
@@ -293,7 +342,8 @@ class RecordAttributes {
 
     bdlsb::MemOutStreamBuf& messageStreamBuf();
         // Return a reference to the modifiable stream buffer associated with
-        // the message attribute of this record attributes object.
+        // the message attribute of this record attributes object.  If the
+        // message attribute is deferred, it is first formatted.
 
     void setCategory(const char *category);
         // Set the category attribute of this record attributes object to the
@@ -307,6 +357,19 @@ class RecordAttributes {
         // Set the line number attribute of this record attributes object to
         // the specified 'lineNumber'.
 
+    void setDeferredMessage(const char *format, ...)
+                                                  BSLS_ANNOTATION_PRINTF(2, 3);
+        // Set the message attribute of this record attributes object to the
+        // result of formatting the variable argument list according to the
+        // specified 'printf'-style 'format', deferring the formatting until
+        // the message attribute is first accessed (see {Deferred Formatting}).
+        // If 'format' contains a conversion that cannot be deferred (see
+        // {'ball_deferredformatutil'|Supported Conversions}), the message is
+        // formatted immediately, and at most 8191 characters of it are kept.
+        // The behavior is undefined unless the number and types of the
+        // arguments are compatible with 'format', and 'format' remains valid
+        // and unchanged until the message attribute is formatted.
+
     void setMessage(const char *message);
         // Set the message attribute of this record attributes object to the
         // specified (non-null) 'message'.
@@ -331,6 +394,11 @@ class RecordAttributes {
     const char *category() const;
         // Return the category attribute of this record attributes object.
 
+    bool isMessageDeferred() const;
+        // Return 'true' if the message attribute of this record attributes
+        // object was set by 'setDeferredMessage' and has not yet been
+        // formatted, and 'false' otherwise.
+
     const char *fileName() const;
         // Return the filename attribute of this record attributes object.
 
@@ -338,19 +406,20 @@ class RecordAttributes {
         // Return the line number attribute of this record attributes object.
 
     const char *message() const;
-        // Return the message attribute of this record attributes object.  Note
-        // that this method will return a truncated message if it contains
-        // embedded null ('\0') characters; see 'messageRef' for an alternative
-        // to this method.  **Warning:** This method is *not* const thread-safe,
-        // and cannot be safely called concurrently.
+        // Return the message attribute of this record attributes object,
+        // formatting it first if it is deferred.  Note that this method will
+        // return a truncated message if it contains embedded null ('\0')
+        // characters; see 'messageRef' for an alternative to this method.
+        // **Warning:** This method is *not* const thread-safe, and cannot be
+        // safely called concurrently.
         //
         // !DEPRECATED!: Use 'messageRef' instead.
 
     bslstl::StringRef messageRef() const;
         // Return a string reference providing non-modifiable access to the
-        // message attribute of this record attributes object.  Note that the
-        // returned string reference is not null-terminated, and may contain
-        // null ('\0') characters.
+        // message attribute of this record attributes object, formatting it
+        // first if it is deferred.  Note that the returned string reference is
+        // not null-terminated, and may contain null ('\0') characters.
 
     int processID() const;
         // Return the processID attribute of this record attributes object.
@@ -366,7 +435,8 @@ class RecordAttributes {
 
     const bdlsb::MemOutStreamBuf& messageStreamBuf() const;
         // Return a reference to the non-modifiable stream buffer associated
-        // with the message attribute of this record attributes object.
+        // with the message attribute of this record attributes object,
+        // formatting the message attribute first if it is deferred.
 
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -411,10 +481,24 @@ bsl::ostream& operator<<(bsl::ostream& stream, const RecordAttributes& object);
                         // class RecordAttributes
                         // ----------------------
 
+// PRIVATE ACCESSORS
+inline
+void RecordAttributes::formatMessageIfDeferred() const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                              e_FORMATTED != d_messageState.loadAcquire())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        formatDeferredMessage();
+    }
+}
+
 // MANIPULATORS
 inline
 void RecordAttributes::clearMessage()
 {
+    d_deferredFormat_p = 0;
+    d_messageState.storeRelaxed(e_FORMATTED);
+
     // Note that the stream buffer holding the message attribute has initial
     // capacity of 256 bytes (by implementation).  Reset those stream buffers
     // that are bigger than the default and "rewind" those that are smaller or
@@ -432,6 +516,7 @@ void RecordAttributes::clearMessage()
 inline
 bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf()
 {
+    formatMessageIfDeferred();
     return d_messageStreamBuf;
 }
 
@@ -484,6 +569,12 @@ const char *RecordAttributes::category() const
     return d_category.c_str();
 }
 
+inline
+bool RecordAttributes::isMessageDeferred() const
+{
+    return e_FORMATTED != d_messageState.loadAcquire();
+}
+
 inline
 const char *RecordAttributes::fileName() const
 {
@@ -517,6 +608,7 @@ bsls::Types::Uint64 RecordAttributes::threadID() const
 inline
 const bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf() const
 {
+    formatMessageIfDeferred();
     return d_messageStreamBuf;
 }
 
@@ -16,21 +16,29 @@
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
 
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
 #include <bslmf_assert.h>
 
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
+#include <bsl_cstdio.h>       // snprintf()
 #include <bsl_cstdlib.h>      // atoi()
 #include <bsl_cstring.h>      // strlen(), memset(), memcpy(), memcmp()
 #include <bsl_iostream.h>
 #include <bsl_new.h>          // placement 'new' syntax
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <unistd.h>           // getpid()
@@ -75,12 +83,14 @@ using namespace bsl;
 // [ 2] void setFileName(const char *fileName);
 // [ 2] void setLineNumber(int lineNumber);
 // [ 2] void setMessage(const char *message);
+// [ 4] void setDeferredMessage(const char *format, ...);
 // [ 2] void setProcessID(int processID);
 // [ 2] void setSeverity(int severity);
 // [ 2] void setThreadID(bsls::Types::Uint64 threadID);
 // [ 2] void setTimestamp(const bdlt::Datetime& timestamp);
 // [ 2] const char *category() const;
 // [ 2] const char *fileName() const;
+// [ 4] bool isMessageDeferred() const;
 // [ 2] int lineNumber() const;
 // [ 2] const char *message() const;
 // [ 2] bslstl::StringRef messageRef() const;
@@ -269,6 +279,39 @@ using namespace bsl;  // automatically added by script
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+class MessageReader {
+    // This functor reads the message attribute of a record attributes object
+    // after waiting on a barrier, so that several threads read it
+    // concurrently.
+
+    // DATA
+    const ball::RecordAttributes *d_attributes_p;  // held, not owned
+    bslmt::Barrier               *d_barrier_p;     // held, not owned
+    bsl::string                  *d_message_p;     // held, not owned
+
+  public:
+    // CREATORS
+    MessageReader(const ball::RecordAttributes *attributes,
+                  bslmt::Barrier               *barrier,
+                  bsl::string                  *message)
+        // Create a functor that loads the message attribute of the specified
+        // 'attributes' into the specified 'message' after waiting on the
+        // specified 'barrier'.
+    : d_attributes_p(attributes)
+    , d_barrier_p(barrier)
+    , d_message_p(message)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Wait on the barrier, and then load the message attribute.
+    {
+        d_barrier_p->wait();
+        *d_message_p = d_attributes_p->messageRef();
+    }
+};
+
 void initRecordAttributes(ball::RecordAttributes&    lhs,
                           const my_RecordAttributes& rhs)
 {
@@ -326,7 +369,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //
@@ -354,7 +397,7 @@ int main(int argc, char *argv[])
 
       } break;
 
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -402,6 +445,214 @@ int main(int argc, char *argv[])
         }
       } break;
 
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGE
+        //
+        // Concerns:
+        //: 1 'setDeferredMessage' sets the message attribute to the result of
+        //:   formatting its arguments, and the message is formatted upon the
+        //:   first access to it, by any of 'message', 'messageRef', or
+        //:   'messageStreamBuf'.
+        //:
+        //: 2 A string argument is copied by 'setDeferredMessage'.
+        //:
+        //: 3 A message using a conversion that cannot be deferred is formatted
+        //:   immediately.
+        //:
+        //: 4 'setMessage', 'clearMessage', and 'setDeferredMessage' discard a
+        //:   deferred message.
+        //:
+        //: 5 Copying, assigning, comparing, and printing an object having a
+        //:   deferred message behave as if the message were formatted.
+        //:
+        //: 6 The message is formatted once, and correctly, when it is first
+        //:   accessed by several threads concurrently.
+        //:
+        //: 7 Setting, formatting, copying, and comparing a deferred message
+        //:   allocate memory only from the object allocator.
+        //
+        // Plan:
+        //: 1 Set a deferred message, verify that it is deferred, and verify
+        //:   the value returned by each accessor of the message attribute.
+        //:   (C-1..2)
+        //:
+        //: 2 Set a deferred message using the 'n$' positional conversion, and
+        //:   verify that it is not deferred.  (C-3)
+        //:
+        //: 3 Set a deferred message, then invoke each manipulator of the
+        //:   message attribute, and verify the message.  (C-4)
+        //:
+        //: 4 Copy, assign, compare, and (after P-6) print objects having a
+        //:   deferred message.  (C-5)
+        //:
+        //: 5 Start several threads that wait on a barrier, and then access
+        //:   the deferred message of the same object, and verify the message
+        //:   loaded by each thread.  (C-6)
+        //:
+        //: 6 Use a test allocator as the object allocator, and verify that the
+        //:   default allocator is not used before printing.  (C-7)
+        //
+        // Testing:
+        //   void setDeferredMessage(const char *format, ...);
+        //   bool isMessageDeferred() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING DEFERRED MESSAGE" << endl
+                                  << "========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tTesting the message accessors." << endl;
+        {
+            const char *const EXP = "id=17 ratio=0.25 name=alpha";
+
+            for (int ti = 0; ti < 3; ++ti) {
+                Obj mX(&testAllocator);  const Obj& X = mX;
+
+                ASSERTV(ti, !X.isMessageDeferred());
+
+                char name[] = "alpha";
+                mX.setDeferredMessage("id=%d ratio=%.2f name=%s",
+                                      17,
+                                      0.25,
+                                      name);
+                strcpy(name, "omega");
+
+                ASSERTV(ti, X.isMessageDeferred());
+
+                bsl::string message(&testAllocator);
+                switch (ti) {
+                  case 0: {
+                    message = X.messageRef();
+                  } break;
+                  case 1: {
+                    message = X.message();
+                  } break;
+                  case 2: {
+                    message.assign(X.messageStreamBuf().data(),
+                                   X.messageStreamBuf().length());
+                  } break;
+                }
+
+                ASSERTV(ti, !X.isMessageDeferred());
+                ASSERTV(ti, message, EXP == message);
+                ASSERTV(ti, X.messageRef(), EXP == X.messageRef());
+            }
+        }
+
+        if (verbose) cout << "\tTesting a conversion that cannot be deferred."
+                          << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            mX.setDeferredMessage("%2$s %1$s", "world", "hello");
+
+            ASSERT(!X.isMessageDeferred());
+            ASSERTV(X.messageRef(), "hello world" == X.messageRef());
+        }
+
+        if (verbose) cout << "\tTesting the message manipulators." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            mX.setDeferredMessage("%d", 1);
+            mX.setMessage("plain");
+            ASSERT(!X.isMessageDeferred());
+            ASSERTV(X.messageRef(), "plain" == X.messageRef());
+
+            mX.setDeferredMessage("%d", 2);
+            mX.clearMessage();
+            ASSERT(!X.isMessageDeferred());
+            ASSERTV(X.messageRef(), X.messageRef().isEmpty());
+
+            mX.setDeferredMessage("%d", 3);
+            mX.setDeferredMessage("%s-%d", "four", 4);
+            ASSERT(X.isMessageDeferred());
+            ASSERTV(X.messageRef(), "four-4" == X.messageRef());
+
+            mX.setDeferredMessage("%d", 5);
+            bsl::ostream os(&mX.messageStreamBuf());
+            os << "+6" << bsl::flush;
+            ASSERTV(X.messageRef(), "5+6" == X.messageRef());
+        }
+
+        if (verbose) cout << "\tTesting copy, assignment, and comparison."
+                          << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            mX.setDeferredMessage("%s %05.1f", "value", 3.14159);
+
+            Obj mY(X, &testAllocator);  const Obj& Y = mY;
+            ASSERT(!X.isMessageDeferred());
+            ASSERT(!Y.isMessageDeferred());
+            ASSERTV(Y.messageRef(), "value 003.1" == Y.messageRef());
+
+            mX.setDeferredMessage("%s %05.1f", "value", 3.14159);
+
+            Obj mZ(&testAllocator);  const Obj& Z = mZ;
+            mZ.setDeferredMessage("%d", 0);
+            mZ = X;
+            ASSERT(!Z.isMessageDeferred());
+            ASSERTV(Z.messageRef(), "value 003.1" == Z.messageRef());
+
+            mX.setDeferredMessage("%s %05.1f", "value", 3.14159);
+            mZ.setDeferredMessage("%s %.1f", "value", 3.1);
+            ASSERT(Y == X);
+            ASSERT(Y != Z);
+        }
+
+        if (verbose) cout << "\tTesting concurrent formatting." << endl;
+        {
+            enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 50 };
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                Obj mX(&testAllocator);  const Obj& X = mX;
+
+                mX.setDeferredMessage("iteration %d: %s %e",
+                                      i,
+                                      "formatted concurrently",
+                                      1.0 / (i + 1));
+
+                char expected[128];
+                snprintf(expected, sizeof expected, "iteration %d: %s %e",
+                         i, "formatted concurrently", 1.0 / (i + 1));
+
+                bslmt::Barrier            barrier(k_NUM_THREADS);
+                bsl::vector<bsl::string>  messages(k_NUM_THREADS,
+                                                   &testAllocator);
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    int rc = bslmt::ThreadUtil::createWithAllocator(
+                                  &handles[t],
+                                  MessageReader(&X, &barrier, &messages[t]),
+                                  &testAllocator);
+                    ASSERTV(i, t, 0 == rc);
+                }
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    bslmt::ThreadUtil::join(handles[t]);
+                    ASSERTV(i, t, messages[t], expected == messages[t]);
+                }
+                ASSERT(!X.isMessageDeferred());
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tTesting printing." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            mX.setDeferredMessage("%s", "printed");
+
+            bsl::ostringstream oss(&testAllocator);
+            oss << X;
+            ASSERTV(oss.str(), bsl::string::npos != oss.str().find("printed"));
+        }
+      } break;
+
       case 3: {
         // --------------------------------------------------------------------
         // Initialization Constructor Test
@@ -15,6 +15,13 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 // corresponding field in the log record.  When a log record is published,
 // these formatters are supplied with to the log record to render it as JSON.
 //
+// The formatters for the timestamp and (hexadecimal) thread id fields cache
+// the text they rendered for the most recent record, so that the date and
+// time (up to the second) of records logged within the same second, and the
+// thread id of records logged by the same thread, are rendered only once.
+// Note that these caches are modified by the (logically 'const')
+// 'operator()'.
+//
 ///Record JSON Formatter Schema
 /// - - - - - - - - - - - - - -
 // The following is a JSON schema of the Message Format Specification:
@@ -204,6 +211,7 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 //..
 // TBD: verify the schema in a JSON schema validator
 
+#include <ball_cachedtimestampformatter.h>
 #include <ball_managedattribute.h>
 #include <ball_record.h>
 #include <ball_recordattributes.h>
@@ -222,16 +230,18 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
-#include <bdlt_iso8601util.h>
-#include <bdlt_iso8601utilconfiguration.h>
+
+#include <bslalg_numericformatterutil.h>
 
 #include <bslim_printer.h>
 
 #include <bslma_managedptr.h>
 
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -240,13 +250,14 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 #include <bsl_climits.h>   // for 'INT_MAX'
 #include <bsl_cstring.h>   // for 'bsl::strcmp'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
+#include <bsl_c_stdio.h>   // for 'sprintf'
 
 #include <bsl_algorithm.h>
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_set.h>
 #include <bsl_sstream.h>
+#include <bsl_streambuf.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -368,6 +379,8 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
     Format                    d_format;
     TimeZone                  d_timeZone;
     FractionalSecondPrecision d_precision;
+    CachedTimestampFormatter  d_formatter;  // renders (and caches) the text
+                                            // in 'd_format' and 'd_precision'
 
   public:
     // TRAITS
@@ -383,6 +396,7 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
     , d_format(e_FORMAT_ISO_8601)
     , d_timeZone(e_TZ_UTC)
     , d_precision(e_FSP_MILLISECONDS)
+    , d_formatter(CachedTimestampFormatter::e_ISO_8601, e_FSP_MILLISECONDS)
     {}
 
     // MANIPULATORS
@@ -412,11 +426,22 @@ class ThreadIdFormatter : public RecordJsonFormatter_FieldFormatter {
         e_HEXADECIMAL = 1
     };
 
-    typedef bsl::allocator<char>  allocator_type;
+    typedef bsl::allocator<char>         allocator_type;
+
+    typedef bslalg::NumericFormatterUtil NfUtil;
+
+    enum {
+        k_MAX_HEX_LENGTH =
+                     NfUtil::ToCharsMaxLength<bsls::Types::Uint64, 16>::k_VALUE
+    };
 
     // DATA
-    bsl::string d_name;
-    Format      d_format;
+    bsl::string         d_name;
+    Format              d_format;
+    bsls::Types::Uint64 d_threadId;                // thread id of 'd_text'
+    int                 d_length;                  // length of 'd_text', or 0
+                                                   // if nothing is cached
+    char                d_text[k_MAX_HEX_LENGTH];  // cached hex thread id
 
   public:
     // TRAITS
@@ -431,6 +456,8 @@ class ThreadIdFormatter : public RecordJsonFormatter_FieldFormatter {
         // supply memory.
     : d_name(k_KEY_THREAD_ID, allocator)
     , d_format(e_DECIMAL)
+    , d_threadId(0)
+    , d_length(0)
     {}
 
     // MANIPULATORS
@@ -902,6 +929,50 @@ class FieldFormattersDestructor {
     }
 };
 
+                        // ===========================
+                        // class StringAppendStreamBuf
+                        // ===========================
+
+class StringAppendStreamBuf : public bsl::streambuf {
+    // This class implements a stream buffer that appends the characters
+    // written to it to a string supplied at construction.
+
+    // DATA
+    bsl::string *d_string_p;  // string to append to (held, not owned)
+
+  protected:
+    // PROTECTED MANIPULATORS
+    int_type overflow(int_type character) BSLS_KEYWORD_OVERRIDE
+        // Append the specified 'character' to the string, unless it is EOF,
+        // and return a value other than EOF.
+    {
+        if (!traits_type::eq_int_type(character, traits_type::eof())) {
+            d_string_p->push_back(traits_type::to_char_type(character));
+        }
+        return traits_type::not_eof(character);
+    }
+
+    bsl::streamsize xsputn(const char      *characters,
+                           bsl::streamsize  numCharacters)
+                                                          BSLS_KEYWORD_OVERRIDE
+        // Append the specified 'numCharacters' characters starting at the
+        // specified 'characters' address to the string, and return
+        // 'numCharacters'.
+    {
+        d_string_p->append(characters, numCharacters);
+        return numCharacters;
+    }
+
+  public:
+    // CREATORS
+    explicit StringAppendStreamBuf(bsl::string *string)
+        // Create a stream buffer that appends the characters written to it to
+        // the specified 'string'.
+    : d_string_p(string)
+    {
+    }
+};
+
                    // ------------------------
                    // class TimestampFormatter
                    // ------------------------
@@ -919,46 +990,14 @@ int TimestampFormatter::format(baljsn::SimpleFormatter *formatter,
 
         offset.setTotalSeconds(localTimeOffsetInSeconds);
     }
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
-
-    switch (d_format) {
-      case e_FORMAT_ISO_8601: {
-        bdlt::Iso8601UtilConfiguration config;
+    const bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
+                                     static_cast<int>(offset.totalMinutes()));
 
-        config.setFractionalSecondPrecision(d_precision);
-        config.setUseZAbbreviationForUtc(true);
+    char buffer[CachedTimestampFormatter::k_MAX_LENGTH];
 
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+    const int length = d_formatter.format(buffer, timestamp);
 
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
-        int rc = formatter->addValue(d_name,
-                                     bsl::string_view(buffer, outputLength));
-        if (rc) {
-            return rc;                                                // RETURN
-        }
-      } break;
-      case e_FORMAT_BDE_PRINT: {
-        char buffer[32];
-
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                d_precision);
-
-        int rc = formatter->addValue(d_name, buffer);
-        if (rc) {
-            return rc;                                                // RETURN
-        }
-      } break;
-      default: {
-          BSLS_ASSERT(!"Unexpected timestamp format");
-          return -1;                                                  // RETURN
-      }
-    }
-
-    return 0;
+    return formatter->addValue(d_name, bsl::string_view(buffer, length));
 }
 
 int TimestampFormatter::parse(bdld::DatumMapRef v)
@@ -1007,6 +1046,12 @@ int TimestampFormatter::parse(bdld::DatumMapRef v)
             }
         }
     }
+
+    d_formatter = CachedTimestampFormatter(
+                                 e_FORMAT_BDE_PRINT == d_format
+                                 ? CachedTimestampFormatter::e_BDE_PRINT
+                                 : CachedTimestampFormatter::e_ISO_8601,
+                                 d_precision);
     return 0;
 }
 
@@ -1024,21 +1069,22 @@ int ThreadIdFormatter::format(baljsn::SimpleFormatter *formatter,
         rc = formatter->addValue(d_name, record.fixedFields().threadID());
       } break;
       case e_HEXADECIMAL: {
-        char buffer[32];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-        snprintf(buffer,
-                 sizeof(buffer),
-                 "%llX",
-                 record.fixedFields().threadID());
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-        rc = formatter->addValue(d_name, &buffer[0]);
+        const bsls::Types::Uint64 threadId = record.fixedFields().threadID();
+
+        if (0 == d_length || threadId != d_threadId) {
+            char *end = NfUtil::toChars(d_text,
+                                        d_text + k_MAX_HEX_LENGTH,
+                                        threadId,
+                                        16);
+            for (char *i = d_text; i != end; ++i) {
+                if ('a' <= *i && *i <= 'f') {
+                    *i = static_cast<char>(*i - 'a' + 'A');
+                }
+            }
+            d_length   = static_cast<int>(end - d_text);
+            d_threadId = threadId;
+        }
+        rc = formatter->addValue(d_name, bsl::string_view(d_text, d_length));
       } break;
       default: {
           BSLS_ASSERT(!"Unexpected thread format");
@@ -1573,6 +1619,17 @@ void RecordJsonFormatter::operator()(bsl::ostream& stream,
     return;
 }
 
+void RecordJsonFormatter::operator()(bsl::string   *output,
+                                     const Record&  record) const
+{
+    BSLS_ASSERT(output);
+
+    StringAppendStreamBuf buffer(output);
+    bsl::ostream          stream(&buffer);
+
+    (*this)(stream, record);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
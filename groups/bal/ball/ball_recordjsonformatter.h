@@ -24,6 +24,18 @@ BSLS_IDENT("$Id: $")
 // but, for example, a resulting log file would contain a sequence of JSON
 // strings, which is not itself valid JSON text.
 //
+// A second overload of 'operator()' appends the formatted record to a
+// 'bsl::string' supplied by the caller instead of writing it to a stream,
+// which allows a caller to format many records into one reusable buffer.
+//
+// The formatters for the "timestamp" and (hexadecimal) "tid" fields cache the
+// text rendered for the most recent record, so that the date and time (up to
+// the second) of records logged within the same second, and the thread id of
+// records logged by the same thread, are rendered only once.  As a result,
+// the (logically 'const') 'operator()' modifies internal state, and
+// concurrent invocations of 'operator()' on the same formatter must be
+// synchronized by the caller (as is done by all 'ball' observers).
+//
 ///Record Format Specification
 ///---------------------------
 // A format specification is, itself, a JSON array, supplied to a
@@ -531,6 +543,14 @@ class RecordJsonFormatter {
         // Format the specified 'record' according to the current 'format' and
         // 'recordSeparator' to the specified 'stream'.
 
+    void operator()(bsl::string *output, const Record& record) const;
+        // Format the specified 'record' according to the current 'format' and
+        // 'recordSeparator' and append the result to the specified 'output'
+        // string.  Note that a caller formatting many records can reuse the
+        // same 'output' (clearing it between records) so that the formatted
+        // text is written directly into its (contiguous) buffer without
+        // further allocation.
+
     const bsl::string& format() const;
         // Return the message format specification of this record JSON
         // formatter.  See {'Record Format Specification'}.
@@ -24,6 +24,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
@@ -69,6 +70,7 @@ using namespace bsl;
 //
 // ACCESSORS
 // [ 4] int operator(bsl::ostream& stream, const Record& record) const;
+// [10] void operator()(bsl::string *, const Record& record) const;
 // [ 3] const bsl::string& format() const;
 // [ 3] const bsl::string& recordSeparator() const;
 // [ 3] const allocator_type& allocator() const;
@@ -77,6 +79,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATING TEST
 // [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -251,6 +254,143 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()(bsl::string *, const ball::Record&)'
+        //
+        // Concerns:
+        //: 1 The 'bsl::string' overload appends to the supplied string exactly
+        //:   the text that the 'bsl::ostream' overload writes.
+        //:
+        //: 2 The existing contents of the supplied string are preserved.
+        //:
+        //: 3 The timestamp and thread id text cached by a formatter is never
+        //:   rendered for a record having a different timestamp (in the same
+        //:   second, in a later second, or in an earlier second), a different
+        //:   local time offset, or a different thread id.
+        //:
+        //: 4 No memory is leaked from the default allocator.
+        //
+        // Plan:
+        //: 1 For each of a set of format specifications and local time
+        //:   offsets, format a sequence of records, having a variety of
+        //:   timestamps and thread ids, using a single formatter and the
+        //:   'bsl::string' overload, and verify that the appended text equals
+        //:   the text written by a freshly created formatter using the
+        //:   'bsl::ostream' overload.  (C-1..4)
+        //
+        // Testing:
+        //   void operator()(bsl::string *, const ball::Record&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING STRING 'operator()'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+        static const char *SPECS[] = {
+            "[\"timestamp\"]",
+            "[{\"timestamp\":{\"format\":\"bdePrint\"}}]",
+            "[{\"timestamp\":{\"fractionalSecPrecision\":\"none\"}}]",
+            "[{\"timestamp\":{\"fractionalSecPrecision\":\"milliseconds\","
+                             "\"timeZone\":\"local\"}}]",
+            "[{\"timestamp\":{\"format\":\"bdePrint\","
+                             "\"fractionalSecPrecision\":\"microseconds\","
+                             "\"timeZone\":\"local\"}}]",
+            "[\"tid\"]",
+            "[{\"tid\":{\"format\":\"hex\"}}]",
+            k_DEFAULT_FORMAT,
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        static const struct {
+            int                 d_line;         // source line number
+            int                 d_year;         // timestamp year
+            int                 d_month;        // timestamp month
+            int                 d_day;          // timestamp day
+            int                 d_hour;         // timestamp hour
+            int                 d_minute;       // timestamp minute
+            int                 d_second;       // timestamp second
+            int                 d_millisecond;  // timestamp millisecond
+            int                 d_microsecond;  // timestamp microsecond
+            bsls::Types::Uint64 d_threadId;     // thread id
+        } DATA[] = {
+            //LN  YEAR  MO  DAY  HR  MI  SC  MSEC  USEC      THREAD ID
+            //--  ----  --  ---  --  --  --  ----  ----  -------------
+            { L_, 2023,  6,  15, 10, 20, 30,    0,    0,            1 },
+            { L_, 2023,  6,  15, 10, 20, 30,    0,    1,            1 },
+            { L_, 2023,  6,  15, 10, 20, 30,  999,  999,           10 },
+            { L_, 2023,  6,  15, 10, 20, 31,    5,   50,          255 },
+            { L_, 2023,  6,  15, 10, 20, 29,  500,    0,          256 },
+            { L_, 2023,  6,  15, 11, 21, 29,  500,    0,   0xABCDEF12 },
+            { L_, 2023,  6,  16, 11, 21, 29,  123,  456,   0xABCDEF12 },
+            { L_, 1999, 12,  31, 23, 59, 59,  999,  999,            0 },
+            { L_, 2000,  1,   1,  0,  0,  0,    0,    0,            0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const bsls::Types::Int64 OFFSETS[] = { 0, 60, -5400, 86340 };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        bdlt::LocalTimeOffset::LocalTimeOffsetCallback defaultCallback =
+                             bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(
+                                        &LocalTimeOffsetUtil::localTimeOffset);
+
+        Rec mR(&oa);  const Rec& R = mR;
+
+        mR.fixedFields().setMessage("Hello, World!");
+
+        for (int si = 0; si < NUM_SPECS; ++si) {
+            const char *const SPEC = SPECS[si];
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERTV(SPEC, 0 == mX.setFormat(SPEC));
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const bsls::Types::Int64 OFFSET = OFFSETS[oi];
+
+                LocalTimeOffsetUtil::d_offset = OFFSET;
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int LINE = DATA[ti].d_line;
+
+                    const bdlt::Datetime TIMESTAMP(DATA[ti].d_year,
+                                                   DATA[ti].d_month,
+                                                   DATA[ti].d_day,
+                                                   DATA[ti].d_hour,
+                                                   DATA[ti].d_minute,
+                                                   DATA[ti].d_second,
+                                                   DATA[ti].d_millisecond,
+                                                   DATA[ti].d_microsecond);
+
+                    mR.fixedFields().setTimestamp(TIMESTAMP);
+                    mR.fixedFields().setThreadID(DATA[ti].d_threadId);
+
+                    Obj mY(&oa);
+                    mY.setFormat(SPEC);
+
+                    bsl::ostringstream expected(&oa);
+                    mY(expected, R);
+
+                    bsl::string result("prefix", &oa);
+                    X(&result, R);
+
+                    ASSERTV(LINE, SPEC, OFFSET,
+                            0 == result.compare(0, 6, "prefix"));
+                    ASSERTV(LINE, SPEC, OFFSET, expected.view(), result,
+                            expected.view() ==
+                                         bsl::string_view(result).substr(6));
+                }
+            }
+        }
+
+        bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(defaultCallback);
+
+        ASSERT(dam.isInUseSame());
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -2498,6 +2638,94 @@ int main(int argc, char *argv[])
         P(oss.str().c_str());
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The time taken to format a record, using either overload of
+        //:   'operator()', is small.
+        //
+        // Plan:
+        //: 1 For each of a set of format specifications, format a large
+        //:   number of records, having increasing timestamps and a small set
+        //:   of thread ids, using each overload of 'operator()' and report
+        //:   the number of records formatted per second.  The number of
+        //:   records may be supplied as the second command line argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const char *SPECS[] = {
+            k_DEFAULT_FORMAT,
+            "[{\"timestamp\":{\"format\":\"bdePrint\"}},"
+             "{\"tid\":{\"format\":\"hex\"}},\"message\"]",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        Rec mR(&oa);  const Rec& R = mR;
+
+        mR.fixedFields().setFileName("subdir/process.cpp");
+        mR.fixedFields().setLineNumber(542);
+        mR.fixedFields().setCategory("FOO.BAR.BAZ");
+        mR.fixedFields().setSeverity(ball::Severity::e_WARN);
+        mR.fixedFields().setMessage("Hello, World!");
+
+        for (int si = 0; si < NUM_SPECS; ++si) {
+            const char *const SPEC = SPECS[si];
+
+            cout << endl << "Format: " << SPEC << endl;
+
+            for (int overload = 0; overload < 2; ++overload) {
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.setFormat(SPEC);
+
+                bdlt::Datetime timestamp(2023, 6, 15, 10, 20, 30);
+
+                bsl::string       output(&oa);
+                bsl::stringstream stream(&oa);
+
+                output.reserve(256);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    timestamp.addMicroseconds(10);
+
+                    mR.fixedFields().setTimestamp(timestamp);
+                    mR.fixedFields().setThreadID(0x1000 + i % 4);
+
+                    if (overload) {
+                        output.clear();
+                        X(&output, R);
+                    }
+                    else {
+                        stream.seekp(0);
+                        X(stream, R);
+                    }
+                }
+
+                timer.stop();
+
+                const double elapsed = timer.elapsedTime();
+
+                cout << (overload ? "\tbsl::string:  " : "\tbsl::ostream: ")
+                     << bsl::setw(12)
+                     << static_cast<bsls::Types::Int64>(NUM_RECORDS / elapsed)
+                     << " records/sec" << endl;
+            }
+        }
+      } break;
       default: {
           bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND."
                     << bsl::endl;
@@ -10,7 +10,19 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
-
+//
+// 'parseFormatSpecification' compiles the format specification into a
+// sequence of field formatters, each appending the text of one field (or of
+// a literal run of the specification) to a string.  The field formatters for
+// the timestamp and thread id specifiers cache the text they rendered for the
+// most recent record: consecutive records are typically logged within the
+// same second and by a small set of threads, so the text of the date and time
+// (up to the second) and of the thread id is rarely recomputed.  Note that
+// these caches are modified by the (logically 'const') 'operator()', which is
+// therefore not safe to invoke concurrently on the same object (as is already
+// the case for the attribute formatters, which cache attribute indices).
+
+#include <ball_cachedtimestampformatter.h>
 #include <ball_managedattribute.h>
 #include <ball_record.h>
 #include <ball_recordattributes.h>
@@ -28,24 +40,24 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
-#include <bdlt_iso8601util.h>
-#include <bdlt_iso8601utilconfiguration.h>
 
 #include <bdlsb_overflowmemoutstreambuf.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bslim_printer.h>
 
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstdio.h>    // for 'bsl::sprintf'
 #include <bsl_cstring.h>   // for 'bsl::strcmp'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_algorithm.h>
 #include <bsl_iomanip.h>
@@ -99,23 +111,6 @@ struct PrintUtil {
     // This "struct" provides a namespace for utility functions that render
     // values of various types to string.
 
-    // TYPES
-    enum FractionalSecondPrecision {
-        // Enumeration used to distinguish among different fractional second
-        // precision.
-        e_FSP_NONE         = 0,
-        e_FSP_MILLISECONDS = 3,
-        e_FSP_MICROSECONDS = 6
-    };
-
-    enum TimestampFormat {
-        // Enumeration used to distinguish among different formats of
-        // timestamp representation.
-        e_TF_DATETIME           = 0,
-        e_TF_DATETIME_TZ_OFFSET = 1,
-        e_TF_ISO8601            = 2
-    };
-
     // CLASS METHODS
     static void appendAttribute(bsl::string             *result,
                                 const ManagedAttribute&  attribute,
@@ -132,17 +127,6 @@ struct PrintUtil {
         // specified 'result' string.  Note that this method is invoked when
         // processing "%c" specifier.
 
-    static void appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               TimestampFormat               timestampFormat,
-                               FractionalSecondPrecision     secondPrecision);
-        // Append to the specified 'result' the datetime provided by the
-        // specified 'record' in the specified 'timestampFormat', having the
-        // specified fractional 'secondPrecision' numbers, and the specified
-        // 'timestampOffset'.  Note that this method is invoked when processing
-        // "%d", "%D", "%dtz", "%Dtz", "%i", "%I" or  "%O" specifiers.
-
     static void appendFilename(bsl::string   *result,
                                bool           fullPath,
                                const Record&  record);
@@ -190,35 +174,15 @@ struct PrintUtil {
         // non-printable characters in 'value' will be printed in their
         // hexadecimal representation ('\xHH').
 
-    static void appendThreadId(bsl::string *result, const Record& record);
-        // Append a thread ID provided by the specified 'record' to the
-        // specified 'result' string.  Note that this method is invoked when
-        // processing "%t" specifier.
-
-    static void appendThreadIdAsHex(bsl::string *result, const Record& record);
-        // Append a thread ID provided by the specified 'record' to the
-        // specified 'result' string in hex format.  Note that this method is
-        // invoked when processing "%T" specifier.
-
     static void appendSeverity(bsl::string *result, const Record& record);
         // Append a severity provided by the specified 'record' to the
         // specified 'result' string.  Note that this method is invoked when
         // processing "%s" specifier.
 
-    template <class T>
-    static void appendValue(bsl::string  *result,
-                            const char   *format,
-                            T             value);
-        // Append the specified 'value' to the specified 'result' string
-        // according to the specified 'format'.
-
-    static void appendValue(bsl::string  *result, int                value);
-    static void appendValue(bsl::string  *result, long               value);
-    static void appendValue(bsl::string  *result, long long          value);
-    static void appendValue(bsl::string  *result, unsigned int       value);
-    static void appendValue(bsl::string  *result, unsigned long      value);
-    static void appendValue(bsl::string  *result, unsigned long long value);
-        // Append the specified 'value' to the specified 'result' string.
+    template <class INTEGRAL_TYPE>
+    static void appendValue(bsl::string *result, INTEGRAL_TYPE value);
+        // Append the decimal text of the specified integral 'value' to the
+        // specified 'result' string.
 
     static void appendUserFields(bsl::string *result, const Record& record);
         // Append user fields provided by the specified 'record' to the
@@ -226,6 +190,78 @@ struct PrintUtil {
         // processing "%u" specifier.
 };
 
+                       // ========================
+                       // class TimestampFormatter
+                       // ========================
+
+class TimestampFormatter {
+    // This class implements a functional object that renders the timestamp
+    // of a record to a string, caching the text of the most recently rendered
+    // second.
+
+    // DATA
+    const bdlt::DatetimeInterval *d_timestampOffset_p;  // timestamp offset
+                                                        // (held, not owned)
+
+    CachedTimestampFormatter      d_formatter;          // renders (and
+                                                        // caches) the text
+
+  public:
+    // CREATORS
+    TimestampFormatter(const bdlt::DatetimeInterval     *timestampOffset,
+                       CachedTimestampFormatter::Format  format,
+                       int                               precision);
+        // Create a timestamp formatter object that renders timestamps in the
+        // specified 'format' with the specified 'precision' fractional second
+        // digits, biased by the specified 'timestampOffset' (or by the local
+        // time offset if 'timestampOffset' holds
+        // 'PublishInLocalTimeUtil::k_ENABLE' milliseconds).  Note that this
+        // class is used when processing "%d", "%D", "%dtz", "%Dtz", "%i",
+        // "%I" or "%O" specifiers.
+
+    // MANIPULATORS
+    void operator()(bsl::string *result, const Record& record);
+        // Append the timestamp provided by the specified 'record' to the
+        // specified 'result' string.
+};
+
+                       // =======================
+                       // class ThreadIdFormatter
+                       // =======================
+
+class ThreadIdFormatter {
+    // This class implements a functional object that renders the thread id
+    // of a record to a string, caching the text of the most recently rendered
+    // thread id.
+
+    // PRIVATE TYPES
+    typedef bslalg::NumericFormatterUtil NfUtil;
+
+    enum {
+        k_MAX_LENGTH = NfUtil::ToCharsMaxLength<bsls::Types::Uint64>::k_VALUE
+    };
+
+    // DATA
+    bsls::Types::Uint64 d_threadId;            // thread id of the cached text
+    int                 d_length;              // length of the cached text, or
+                                               // 0 if nothing is cached
+    bool                d_isHex;               // render in (uppercase) hex
+    char                d_text[k_MAX_LENGTH];  // cached text
+
+  public:
+    // CREATORS
+    explicit ThreadIdFormatter(bool isHex);
+        // Create a thread id formatter object that renders thread ids in
+        // decimal if the specified 'isHex' is 'false', and in uppercase
+        // hexadecimal otherwise.  Note that this class is used when
+        // processing "%t" or "%T" specifiers.
+
+    // MANIPULATORS
+    void operator()(bsl::string *result, const Record& record);
+        // Append the thread id provided by the specified 'record' to the
+        // specified 'result' string.
+};
+
                        // ========================
                        // class AttributeFormatter
                        // ========================
@@ -386,104 +422,6 @@ void PrintUtil::appendCategory(bsl::string *result, const Record& record)
     *result += record.fixedFields().category();
 }
 
-void PrintUtil::appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               TimestampFormat               timestampFormat,
-                               FractionalSecondPrecision     secondPrecision)
-{
-    bdlt::DatetimeInterval  offset;
-
-    if (PublishInLocalTimeUtil::k_ENABLE ==
-                                          timestampOffset->totalMilliseconds())
-    {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                              record.fixedFields().timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (PublishInLocalTimeUtil::k_DISABLE !=
-                                        timestampOffset->totalMilliseconds()) {
-        offset = *timestampOffset;
-    }
-
-    int              offsetInMinutes = static_cast<int>(offset.totalMinutes());
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               offsetInMinutes);
-
-    switch (timestampFormat) {
-      case e_TF_ISO8601: {
-        bdlt::Iso8601UtilConfiguration config;
-
-        if (secondPrecision) {
-            config.setFractionalSecondPrecision(secondPrecision);
-        }
-        config.setUseZAbbreviationForUtc(true);
-
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
-
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
-
-        if (e_FSP_NONE == secondPrecision) {
-
-            enum { k_DECIMAL_SIGN_OFFSET = 19,
-                   k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-
-            bsl::string_view head(buffer, k_DECIMAL_SIGN_OFFSET);
-            bsl::string_view tail(buffer + k_TZINFO_OFFSET,
-                                  outputLength - k_TZINFO_OFFSET);
-            *result += head;
-            *result += tail;
-        }
-        else {
-            result->append(buffer, outputLength);
-        }
-      } break;
-      case e_TF_DATETIME: {
-        char buffer[32];
-
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                secondPrecision);
-        *result += buffer;
-      } break;
-      case e_TF_DATETIME_TZ_OFFSET: {
-        char buffer[64];
-
-        // Printing local time.
-
-        int numChars = timestamp.localDatetime().printToBuffer(
-                                                              buffer,
-                                                              sizeof buffer,
-                                                              secondPrecision);
-
-        // Printing offset.
-
-        char       *offsetBuffer = buffer + numChars;
-        const char  sign         = offsetInMinutes < 0 ? '-' : '+';
-        offsetInMinutes          = offsetInMinutes < 0 ? -offsetInMinutes
-                                                       :  offsetInMinutes;
-        const int   hours        = offsetInMinutes / 60;
-        const int   minutes      = offsetInMinutes % 60;
-
-        // Although an offset greater than 24 hours is undefined behavior, such
-        // invalid 'DatetimeTz' objects still can be created under certain
-        // circumstances.  We want to enable clients to detect these errors as
-        // quickly as possible (DRQS 12693813).
-
-        if (hours < 100) {
-            bsl::sprintf(offsetBuffer, "%c%02d%02d", sign, hours, minutes);
-        }
-        else {
-            bsl::sprintf(offsetBuffer, "%cXX%02d",   sign,        minutes);
-        }
-
-        *result += buffer;
-      } break;
-    }
-}
-
 void PrintUtil::appendFilename(bsl::string   *result,
                                bool           fullPath,
                                const Record&  record)
@@ -544,54 +482,15 @@ void PrintUtil::appendMessageAsHex(bsl::string *result, const Record& record)
     appendHexDump(result, record.fixedFields().messageRef());
 }
 
-template <class T>
-void PrintUtil::appendValue(bsl::string *result,
-                            const char  *format,
-                            T            value)
+template <class INTEGRAL_TYPE>
+void PrintUtil::appendValue(bsl::string *result, INTEGRAL_TYPE value)
 {
-    char buffer[16];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    typedef bslalg::NumericFormatterUtil NfUtil;
 
-    snprintf(buffer, sizeof buffer, format, value);
+    char buffer[NfUtil::ToCharsMaxLength<INTEGRAL_TYPE>::k_VALUE];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
-}
-
-void PrintUtil::appendValue(bsl::string *result, int value)
-{
-    appendValue(result, "%d", value);
-}
-
-void PrintUtil::appendValue(bsl::string  *result, long value)
-{
-    appendValue(result, "%ld", value);
-}
-
-void PrintUtil::appendValue(bsl::string  *result, long long value)
-{
-    appendValue(result, "%lld", value);
-}
-
-void PrintUtil::appendValue(bsl::string  *result, unsigned int value)
-{
-    appendValue(result, "%u", value);
-}
-
-void PrintUtil::appendValue(bsl::string  *result, unsigned long value)
-{
-    appendValue(result, "%lu", value);
-}
-
-void PrintUtil::appendValue(bsl::string  *result, unsigned long long value)
-{
-    appendValue(result, "%llu", value);
+    const char *end = NfUtil::toChars(buffer, buffer + sizeof buffer, value);
+    result->append(buffer, end - buffer);
 }
 
 void PrintUtil::appendProcessId(bsl::string   *result,
@@ -638,18 +537,6 @@ void PrintUtil::appendString(bsl::string             *result,
     }
 }
 
-void PrintUtil::appendThreadId(bsl::string   *result,
-                               const Record&  record)
-{
-    appendValue(result, "%llu", record.fixedFields().threadID());
-}
-
-void PrintUtil::appendThreadIdAsHex(bsl::string   *result,
-                                    const Record&  record)
-{
-    appendValue(result, "%llX", record.fixedFields().threadID());
-}
-
 void PrintUtil::appendSeverity(bsl::string   *result,
                                const Record&  record)
 {
@@ -686,6 +573,78 @@ void PrintUtil::appendUserFields(bsl::string *result, const Record& record)
     }
 }
 
+                       // ------------------------
+                       // class TimestampFormatter
+                       // ------------------------
+
+TimestampFormatter::TimestampFormatter(
+                             const bdlt::DatetimeInterval     *timestampOffset,
+                             CachedTimestampFormatter::Format  format,
+                             int                               precision)
+: d_timestampOffset_p(timestampOffset)
+, d_formatter(format, precision)
+{
+}
+
+void TimestampFormatter::operator()(bsl::string *result, const Record& record)
+{
+    bdlt::DatetimeInterval offset;
+
+    if (PublishInLocalTimeUtil::k_ENABLE ==
+                                      d_timestampOffset_p->totalMilliseconds())
+    {
+        bsls::Types::Int64 localTimeOffsetInSeconds =
+            bdlt::LocalTimeOffset::localTimeOffset(
+                              record.fixedFields().timestamp()).totalSeconds();
+        offset.setTotalSeconds(localTimeOffsetInSeconds);
+    } else if (PublishInLocalTimeUtil::k_DISABLE !=
+                                    d_timestampOffset_p->totalMilliseconds()) {
+        offset = *d_timestampOffset_p;
+    }
+
+    const bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
+                                     static_cast<int>(offset.totalMinutes()));
+
+    char buffer[CachedTimestampFormatter::k_MAX_LENGTH];
+
+    result->append(buffer, d_formatter.format(buffer, timestamp));
+}
+
+                       // -----------------------
+                       // class ThreadIdFormatter
+                       // -----------------------
+
+ThreadIdFormatter::ThreadIdFormatter(bool isHex)
+: d_threadId(0)
+, d_length(0)
+, d_isHex(isHex)
+{
+}
+
+void ThreadIdFormatter::operator()(bsl::string *result, const Record& record)
+{
+    const bsls::Types::Uint64 threadId = record.fixedFields().threadID();
+
+    if (0 == d_length || threadId != d_threadId) {
+        char *end = NfUtil::toChars(d_text,
+                                    d_text + k_MAX_LENGTH,
+                                    threadId,
+                                    d_isHex ? 16 : 10);
+        d_length = static_cast<int>(end - d_text);
+
+        if (d_isHex) {
+            for (char *i = d_text; i != end; ++i) {
+                if ('a' <= *i && *i <= 'f') {
+                    *i = static_cast<char>(*i - 'a' + 'A');
+                }
+            }
+        }
+        d_threadId = threadId;
+    }
+
+    result->append(d_text, d_length);
+}
+
                        // ------------------------
                        // class AttributeFormatter
                        // ------------------------
@@ -912,21 +871,17 @@ void RecordStringFormatter::parseFormatSpecification()
                     'z' == *(i + 2)) {  //  Datetime + timezone offset ('%dtz')
                     i += 2;
                     d_fieldFormatters.emplace_back(
-                       bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                            _1,
-                                            _2,
-                                            &d_timestampOffset,
-                                            PrintUtil::e_TF_DATETIME_TZ_OFFSET,
-                                            PrintUtil::e_FSP_MILLISECONDS));
+                        TimestampFormatter(
+                             &d_timestampOffset,
+                             CachedTimestampFormatter::e_BDE_PRINT_WITH_OFFSET,
+                             3));
                 }
                 else {
                     d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_DATETIME,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                        TimestampFormatter(
+                                         &d_timestampOffset,
+                                         CachedTimestampFormatter::e_BDE_PRINT,
+                                         3));
                 }
               } break;
               case 'D': {  // ---------------- Datetime -----------------------
@@ -936,49 +891,39 @@ void RecordStringFormatter::parseFormatSpecification()
                     'z' == *(i + 2)) {  //  Datetime + timezone offset ('%Dtz')
                     i += 2;
                     d_fieldFormatters.emplace_back(
-                        bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                            _1,
-                                            _2,
-                                            &d_timestampOffset,
-                                            PrintUtil::e_TF_DATETIME_TZ_OFFSET,
-                                            PrintUtil::e_FSP_MICROSECONDS));
+                        TimestampFormatter(
+                             &d_timestampOffset,
+                             CachedTimestampFormatter::e_BDE_PRINT_WITH_OFFSET,
+                             6));
                 }
                 else {
                     d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_DATETIME,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                        TimestampFormatter(
+                                         &d_timestampOffset,
+                                         CachedTimestampFormatter::e_BDE_PRINT,
+                                         6));
                 }
               } break;
               case 'i': {  // ---------------- Datetime ISO 8601 --------------
                 d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_NONE));
+                    TimestampFormatter(
+                                          &d_timestampOffset,
+                                          CachedTimestampFormatter::e_ISO_8601,
+                                          0));
               } break;
               case 'I': {  // ---------------- Datetime ISO 8601 --------------
                 d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                    TimestampFormatter(
+                                          &d_timestampOffset,
+                                          CachedTimestampFormatter::e_ISO_8601,
+                                          3));
               } break;
               case 'O': {  // ---------------- Datetime ISO 8601 --------------
                 d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                    TimestampFormatter(
+                                          &d_timestampOffset,
+                                          CachedTimestampFormatter::e_ISO_8601,
+                                          6));
               } break;
               case 'p': {  // ---------------- Process ID ---------------------
                 d_fieldFormatters.emplace_back(
@@ -987,16 +932,10 @@ void RecordStringFormatter::parseFormatSpecification()
                                                    _2));
               } break;
               case 't': {  // ---------------- Thread ID ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendThreadId,
-                                                    _1,
-                                                    _2));
+                d_fieldFormatters.emplace_back(ThreadIdFormatter(false));
               } break;
               case 'T': {  // ---------------- Thread ID hex ------------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendThreadIdAsHex,
-                                               _1,
-                                               _2));
+                d_fieldFormatters.emplace_back(ThreadIdFormatter(true));
               } break;
               case 's': {  // ---------------- Severity -----------------------
                 d_fieldFormatters.emplace_back(
@@ -1239,10 +1178,13 @@ RecordStringFormatter& RecordStringFormatter::operator=(
                                               const RecordStringFormatter& rhs)
 {
     if (this != &rhs) {
+        // The field formatters refer to the timestamp offset and skipped
+        // attributes of the object that created them, and so are re-created
+        // rather than copied from 'rhs'.
+
         d_formatSpec      = rhs.d_formatSpec;
-        d_fieldFormatters = rhs.d_fieldFormatters;
-        d_skipAttributes  = rhs.d_skipAttributes;
         d_timestampOffset = rhs.d_timestampOffset;
+        parseFormatSpecification();
     }
 
     return *this;
@@ -1263,12 +1205,7 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(k_STRING_RESERVATION);
 
-    for (FieldStringFormatters::const_iterator i = d_fieldFormatters.cbegin();
-         i != d_fieldFormatters.cend();
-         ++i)
-    {
-        (*i)(&output, record);
-    }
+    (*this)(&output, record);
 
     stream.write(output.c_str(), output.size());
     stream.flush();
@@ -1276,6 +1213,19 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     return;
 }
 
+void RecordStringFormatter::operator()(bsl::string   *output,
+                                       const Record&  record) const
+{
+    BSLS_ASSERT(output);
+
+    for (FieldStringFormatters::const_iterator i = d_fieldFormatters.cbegin();
+         i != d_fieldFormatters.cend();
+         ++i)
+    {
+        (*i)(output, record);
+    }
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
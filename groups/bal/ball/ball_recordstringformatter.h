@@ -32,6 +32,22 @@ BSLS_IDENT("$Id: $")
 // facilitates the logging of records in local time, if desired, in the event
 // that the timestamp attribute of records are in UTC.
 //
+// A second overload of 'operator()' appends the formatted record to a
+// 'bsl::string' supplied by the caller instead of writing it to a stream.
+// This overload writes directly into the contiguous buffer of the string, so
+// a caller that formats many records (e.g., to batch them into a single
+// write) can reuse one string and avoid both the per-record allocation and
+// the overhead of a stream.
+//
+// The format specification is compiled, when it is set, into a sequence of
+// field formatters.  The formatters for the timestamp and thread id cache the
+// text rendered for the most recent record, so that the date and time (up to
+// the second) of records logged within the same second, and the thread id of
+// records logged by the same thread, are rendered only once.  As a result,
+// the (logically 'const') 'operator()' modifies internal state, and
+// concurrent invocations of 'operator()' on the same record formatter must be
+// synchronized by the caller (as is done by all 'ball' observers).
+//
 ///Record Format Specification
 ///---------------------------
 // The following table lists the 'printf'-style ('%'-prefixed) conversion
@@ -343,6 +359,17 @@ class RecordStringFormatter {
         // 'stream'.  The timestamp offset of this record formatter is added to
         // each timestamp that is output to 'stream'.
 
+    void operator()(bsl::string *output, const Record& record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter and append the result to the specified
+        // 'output' string.  The timestamp offset of this record formatter is
+        // added to each timestamp that is appended to 'output'.  Note that
+        // this overload writes directly into the (contiguous) buffer of
+        // 'output' and so, if 'output' has sufficient capacity, neither
+        // allocates memory nor incurs the overhead of a stream; a caller
+        // formatting many records can reuse the same 'output' (clearing it
+        // between records) to amortize its allocation.
+
     const char *format() const;
         // Return the format specification of this record formatter.
 
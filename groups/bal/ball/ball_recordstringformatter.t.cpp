@@ -24,6 +24,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -89,6 +90,7 @@ using bsl::uppercase;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [16] void operator()(bsl::string *, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -96,6 +98,7 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -285,6 +288,208 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()(bsl::string *, const ball::Record&)'
+        //
+        // Concerns:
+        //: 1 The 'bsl::string' overload appends to the supplied string exactly
+        //:   the text that the 'bsl::ostream' overload writes, for every
+        //:   supported format specifier.
+        //:
+        //: 2 The existing contents of the supplied string are preserved.
+        //:
+        //: 3 The timestamp and thread id text cached by a formatter is never
+        //:   rendered for a record having a different timestamp (in the same
+        //:   second, in a later second, or in an earlier second), a different
+        //:   timestamp offset, or a different thread id.
+        //:
+        //: 4 A formatter that was assigned a value does not depend on the
+        //:   object from which it was assigned.
+        //
+        // Plan:
+        //: 1 For each of a set of format specifications and timestamp offsets,
+        //:   format a sequence of records, having a variety of timestamps and
+        //:   thread ids, using a single formatter and the 'bsl::string'
+        //:   overload, and verify that the appended text equals the text
+        //:   written by a freshly created formatter using the 'bsl::ostream'
+        //:   overload.  (C-1..3)
+        //:
+        //: 2 Assign to a formatter the value of another formatter, destroy
+        //:   the source, and verify that the assigned formatter renders the
+        //:   expected text.  (C-4)
+        //
+        // Testing:
+        //   void operator()(bsl::string *, const ball::Record&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'operator()(bsl::string *, ...)'"
+                          << "\n========================================"
+                          << endl;
+
+        bslma::TestAllocator testAllocator("objectAllocator",
+                                           veryVeryVeryVerbose);
+        Obj::allocator_type  oa(&testAllocator);
+
+        static const char *SPECS[] = {
+            "%d", "%D", "%dtz", "%Dtz", "%i", "%I", "%O", "%t", "%T",
+            "%p:%t %s %f:%l %c %m %u", "%%%n%i %T %%",
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "\n%I %p:%T %s %f:%l %c %m %a\n",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        static const struct {
+            int    d_line;         // source line number
+            int    d_year;         // timestamp year
+            int    d_month;        // timestamp month
+            int    d_day;          // timestamp day
+            int    d_hour;         // timestamp hour
+            int    d_minute;       // timestamp minute
+            int    d_second;       // timestamp second
+            int    d_millisecond;  // timestamp millisecond
+            int    d_microsecond;  // timestamp microsecond
+            Uint64 d_threadId;     // thread id
+        } DATA[] = {
+            //LN  YEAR  MO  DAY  HR  MI  SC  MSEC  USEC      THREAD ID
+            //--  ----  --  ---  --  --  --  ----  ----  -------------
+            { L_, 2023,  6,  15, 10, 20, 30,    0,    0,            1 },
+            { L_, 2023,  6,  15, 10, 20, 30,    0,    1,            1 },
+            { L_, 2023,  6,  15, 10, 20, 30,  999,  999,            1 },
+            { L_, 2023,  6,  15, 10, 20, 31,    5,   50,           10 },
+            { L_, 2023,  6,  15, 10, 20, 31,    5,   50,           11 },
+            { L_, 2023,  6,  15, 10, 20, 29,  500,    0,           11 },
+            { L_, 2023,  6,  15, 10, 21, 29,  500,    0,          255 },
+            { L_, 2023,  6,  15, 11, 21, 29,  500,    0,          256 },
+            { L_, 2023,  6,  16, 11, 21, 29,  500,    0,   0xABCDEF12 },
+            { L_, 2023,  6,  16, 11, 21, 29,  123,  456,   0xABCDEF12 },
+            { L_, 2023,  6,  15, 23, 59, 59,  999,  999,            0 },
+            { L_, 2023,  6,  16,  0,  0,  0,    0,    0,            0 },
+            { L_, 1999, 12,  31, 23, 59, 59,  999,  999,        12345 },
+            { L_, 2000,  1,   1,  0,  0,  0,    0,    0,        12345 },
+            { L_, 2000,  1,   1,  0,  0,  0,    0,    0, ~Uint64(0)    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const struct {
+            int  d_line;      // source line number
+            int  d_minutes;   // timestamp offset (in minutes)
+            bool d_local;     // publish in local time
+        } OFFSETS[] = {
+            //LINE   MINUTES  LOCAL
+            //----   -------  -----
+            { L_,          0, false },
+            { L_,          1, false },
+            { L_,        -90, false },
+            { L_,     23 * 60, false },
+            { L_,          0,  true },
+        };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        ball::RecordAttributes fixedFields(bdlt::Datetime(),
+                                           1234,
+                                           0,
+                                           "subdir/process.cpp",
+                                           542,
+                                           "FOO.BAR.BAZ",
+                                           ball::Severity::e_WARN,
+                                           "Hello world!",
+                                           oa.mechanism());
+
+        ball::UserFields userFields(oa.mechanism());
+        userFields.appendString("string");
+        userFields.appendInt64(1000000);
+
+        ball::Record mRecord(fixedFields, userFields, oa.mechanism());
+        mRecord.addAttribute(ball::Attribute("name", "Name", oa));
+
+        const ball::Record& record = mRecord;
+
+        if (verbose) cout << "\tCompare with the 'bsl::ostream' overload."
+                          << endl;
+
+        for (int si = 0; si < NUM_SPECS; ++si) {
+            const char *const SPEC = SPECS[si];
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int  OLINE = OFFSETS[oi].d_line;
+                const bool LOCAL = OFFSETS[oi].d_local;
+
+                const bdlt::DatetimeInterval OFFSET(0,
+                                                    0,
+                                                    OFFSETS[oi].d_minutes);
+
+                if (veryVerbose) { T_ P_(SPEC) P_(OFFSET) P(LOCAL) }
+
+                Obj mX(SPEC, OFFSET, oa);  const Obj& X = mX;
+                if (LOCAL) {
+                    mX.enablePublishInLocalTime();
+                }
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int LINE = DATA[ti].d_line;
+
+                    const bdlt::Datetime TIMESTAMP(DATA[ti].d_year,
+                                                   DATA[ti].d_month,
+                                                   DATA[ti].d_day,
+                                                   DATA[ti].d_hour,
+                                                   DATA[ti].d_minute,
+                                                   DATA[ti].d_second,
+                                                   DATA[ti].d_millisecond,
+                                                   DATA[ti].d_microsecond);
+
+                    mRecord.fixedFields().setTimestamp(TIMESTAMP);
+                    mRecord.fixedFields().setThreadID(DATA[ti].d_threadId);
+
+                    Obj mY(SPEC, OFFSET, oa);
+                    if (LOCAL) {
+                        mY.enablePublishInLocalTime();
+                    }
+
+                    ostringstream expected(oa);
+                    mY(expected, record);
+
+                    bsl::string result("prefix", oa);
+                    X(&result, record);
+
+                    ASSERTV(LINE, OLINE, SPEC,
+                            0 == result.compare(0, 6, "prefix"));
+                    ASSERTV(LINE, OLINE, SPEC, expected.view(), result,
+                            expected.view() ==
+                                         bsl::string_view(result).substr(6));
+
+                    ostringstream actual(oa);
+                    X(actual, record);
+
+                    ASSERTV(LINE, OLINE, SPEC, expected.view(), actual.view(),
+                            expected.view() == actual.view());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTest assignment." << endl;
+        {
+            mRecord.fixedFields().setTimestamp(
+                                  bdlt::Datetime(2023, 6, 15, 10, 20, 30, 1));
+            mRecord.fixedFields().setThreadID(0xABC);
+
+            Obj mX(oa);  const Obj& X = mX;
+            {
+                Obj mY("%I %T %m", TA, oa);
+
+                bsl::string dummy(oa);
+                mY(&dummy, record);
+
+                mX = mY;
+            }
+
+            bsl::string result(oa);
+            X(&result, record);
+
+            ASSERTV(result, "2023-06-15T11:20:30.001+01:00 ABC Hello world!" ==
+                                                                       result);
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING: Overload resolution for 'RecordStringFormatter' changed due
@@ -2645,6 +2850,100 @@ int main(int argc, char *argv[])
         ASSERT( 0 == (X1 == X3));        ASSERT(1 == (X1 != X3));
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The time taken to format a record, using either overload of
+        //:   'operator()', is small.
+        //
+        // Plan:
+        //: 1 For each of a set of format specifications, format a large
+        //:   number of records, having increasing timestamps and a small set
+        //:   of thread ids, using each overload of 'operator()' and report
+        //:   the number of records formatted per second.  The number of
+        //:   records may be supplied as the second command line argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE TEST"
+             << "\n================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        bslma::TestAllocator testAllocator("objectAllocator",
+                                           veryVeryVeryVerbose);
+        Obj::allocator_type  oa(&testAllocator);
+
+        static const char *SPECS[] = {
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "\n%I %p:%T %s %f:%l %c %m\n",
+            "%O %s %m\n",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        ball::RecordAttributes fixedFields(bdlt::Datetime(),
+                                           1234,
+                                           0,
+                                           "subdir/process.cpp",
+                                           542,
+                                           "FOO.BAR.BAZ",
+                                           ball::Severity::e_WARN,
+                                           "Hello world!",
+                                           oa.mechanism());
+
+        ball::Record mRecord(fixedFields, ball::UserFields(), oa.mechanism());
+
+        const ball::Record& record = mRecord;
+
+        for (int si = 0; si < NUM_SPECS; ++si) {
+            const char *const SPEC = SPECS[si];
+
+            cout << "\nFormat: \"" << SPEC << "\"" << endl;
+
+            for (int overload = 0; overload < 2; ++overload) {
+                Obj mX(SPEC, oa);  const Obj& X = mX;
+
+                bdlt::Datetime timestamp(2023, 6, 15, 10, 20, 30);
+
+                bsl::string       output(oa);
+                bsl::stringstream stream(oa);
+
+                output.reserve(256);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    timestamp.addMicroseconds(10);
+
+                    mRecord.fixedFields().setTimestamp(timestamp);
+                    mRecord.fixedFields().setThreadID(0x1000 + i % 4);
+
+                    if (overload) {
+                        output.clear();
+                        X(&output, record);
+                    }
+                    else {
+                        stream.seekp(0);
+                        X(stream, record);
+                    }
+                }
+
+                timer.stop();
+
+                const double elapsed = timer.elapsedTime();
+
+                cout << (overload ? "\tbsl::string:  " : "\tbsl::ostream: ")
+                     << bsl::setw(12) << static_cast<Int64>(NUM_RECORDS /
+                                                            elapsed)
+                     << " records/sec" << endl;
+            }
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -4,6 +4,7 @@
 #include <bslim_testutil.h>
 
 #include <bdlb_printmethods.h>
+#include <bdlde_base64encoder.h>
 
 #include <bsls_libraryfeatures.h>
 #include <bsls_nameof.h>
@@ -16,6 +17,8 @@
 #include <bsl_istream.h>
 #include <bsl_iterator.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
@@ -584,7 +587,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -598,6 +601,125 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PUSHING CONTIGUOUS CHARACTERS
+        //   Characters pushed as a range of 'const char' may be decoded in
+        //   bulk.
+        //
+        // Concerns:
+        //: 1 Pushing a range of 'const char' yields the same status from
+        //:   'pushCharacters' and 'endParse', and the same value, as pushing
+        //:   the same characters through an input iterator, whether the
+        //:   encoding is valid or not, and however it is split into pushes.
+        //:
+        //: 2 Long encodings, with or without line breaks, are decoded
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 Encode random data of lengths up to 300 bytes, with and without
+        //:   line breaks.  Depending on random choices, replace a character of
+        //:   the encoding, or remove its last character.  Split the encoding
+        //:   into up to 3 pushes at random positions.  Parse the pushes with a
+        //:   parser given 'const char *' ranges and with a parser given
+        //:   'bsl::istreambuf_iterator' ranges, and verify that all the
+        //:   statuses and the resulting values are the same.  (C-1..2)
+        //
+        // Testing:
+        //   int pushCharacters(const char *begin, const char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPUSHING CONTIGUOUS CHARACTERS"
+                          << "\n=============================" << endl;
+
+        typedef balxml::Base64Parser<bsl::vector<char> > Parser;
+        typedef bdlde::Base64EncoderOptions              EncoderOptions;
+
+        unsigned          seed = 1;
+        bsl::vector<char> data;
+
+        for (int len = 0; len <= 300; ++len) {
+            for (int ti = 0; ti < 4; ++ti) {
+                data.resize(len);
+                for (int ii = 0; ii < len; ++ii) {
+                    seed     = seed * 1103515245 + 12345;
+                    data[ii] = static_cast<char>(seed >> 16);
+                }
+
+                const EncoderOptions options = ti & 1
+                                             ? EncoderOptions::mime()
+                                             : EncoderOptions::standard();
+
+                bsl::string input(bdlde::Base64Encoder::encodedLength(options,
+                                                                      len),
+                                  '\0');
+                if (len) {
+                    bdlde::Base64Encoder::encode(&input[0],
+                                                 data.data(),
+                                                 len,
+                                                 options);
+                }
+
+                seed = seed * 1103515245 + 12345;
+                const unsigned choice = seed >> 16;
+
+                if ((ti & 2) && !input.empty()) {
+                    if (choice & 1) {
+                        input[choice % input.length()] = '*';
+                    }
+                    else {
+                        input.resize(input.length() - 1);
+                    }
+                }
+
+                bsl::size_t split[4] = { 0, 0, 0, input.length() };
+                for (int jj = 1; jj < 3; ++jj) {
+                    seed      = seed * 1103515245 + 12345;
+                    split[jj] = (seed >> 16) % (input.length() + 1);
+                }
+                if (split[1] > split[2]) {
+                    bsl::swap(split[1], split[2]);
+                }
+
+                bsl::vector<char> x;
+                bsl::vector<char> y;
+                Parser            mX;
+                Parser            mY;
+
+                ASSERT(0 == mX.beginParse(&x));
+                ASSERT(0 == mY.beginParse(&y));
+
+                bool isValid = true;
+                for (int jj = 0; isValid && jj < 3; ++jj) {
+                    const char *begin = input.data() + split[jj];
+                    const char *end   = input.data() + split[jj + 1];
+
+                    bsl::istringstream stream(bsl::string(begin, end));
+
+                    const int rcX = mX.pushCharacters(begin, end);
+                    const int rcY = mY.pushCharacters(
+                                      bsl::istreambuf_iterator<char>(stream),
+                                      bsl::istreambuf_iterator<char>());
+
+                    LOOP4_ASSERT(len, ti, jj, rcX, (0 == rcX) == (0 == rcY));
+                    isValid = 0 == rcY;
+                }
+
+                if (isValid) {
+                    const int rcX = mX.endParse();
+                    const int rcY = mY.endParse();
+
+                    LOOP3_ASSERT(len, ti, rcX, (0 == rcX) == (0 == rcY));
+                    LOOP2_ASSERT(len, ti, x == y);
+
+                    if (0 == (ti & 2)) {
+                        LOOP3_ASSERT(len, ti, rcX, 0 == rcX);
+                        LOOP2_ASSERT(len, ti, data == x);
+                    }
+                }
+            }
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // THOROUGH TEST
@@ -158,8 +158,8 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 // do they seee '5e-324' in their printout when '<limits.h>' from C clearly has
 // 'DBL_TRUE_MIN' defined as '4.9406564584124654e-324'.
 
-#include <bdlb_print.h>
 #include <bdlde_base64encoder.h>
+#include <bdlde_hexencoder.h>
 #include <bdldfp_decimalutil.h>
 
 #include <bsla_fallthrough.h>
@@ -170,6 +170,7 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 #include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
 #include <bsl_cstdio.h>
@@ -184,30 +185,58 @@ namespace u {
 
 // HELPER FUNCTIONS
 
-template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
-                           INPUT_ITERATOR begin,
-                           INPUT_ITERATOR end)
+                           const char    *begin,
+                           const char    *end)
     // Write the base64 encoding of the character sequence defined by the
-    // specified 'begin' and 'end' iterators into the specified 'stream' and
-    // return 'stream'.  Each instantiation of this private function is called
-    // only once (by the functions below) and can thus be inlined without
-    // causing code bloat.
+    // specified 'begin' and 'end' pointers into the specified 'stream' and
+    // return 'stream'.  The sequence is encoded in bulk, one chunk at a time,
+    // into a local buffer that is then written to 'stream'.
 {
-    bdlde::Base64Encoder base64Encoder(0);  // 0 means do not insert CRLF
+    enum {
+        k_CHUNK_INPUT  = 3 * 256,          // multiple of 3: no padding
+        k_CHUNK_OUTPUT = 4 * 256
+    };
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    const bdlde::Base64EncoderOptions options =
+                                       bdlde::Base64EncoderOptions::standard();
+
+    char buffer[k_CHUNK_OUTPUT];
 
-        int status = base64Encoder.convert(outputIterator, begin, end);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+    while (begin != end) {
+        const bsl::size_t numIn = bsl::min<bsl::size_t>(end - begin,
+                                                        k_CHUNK_INPUT);
+
+        const bsl::size_t numOut = bdlde::Base64Encoder::encode(buffer,
+                                                                begin,
+                                                                numIn,
+                                                                options);
+        stream.write(buffer, numOut);
+        begin += numIn;
     }
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    return stream;
+}
+
+bsl::ostream& encodeHex(bsl::ostream&  stream,
+                        const char    *begin,
+                        const char    *end)
+    // Write the uppercase hex encoding of the character sequence defined by
+    // the specified 'begin' and 'end' pointers into the specified 'stream' and
+    // return 'stream'.  The sequence is encoded in bulk, one chunk at a time,
+    // into a local buffer that is then written to 'stream'.
+{
+    enum { k_CHUNK_INPUT = 512 };
+
+    char buffer[2 * k_CHUNK_INPUT];
 
-        int status = base64Encoder.endConvert(outputIterator);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+    while (begin != end) {
+        const bsl::size_t numIn = bsl::min<bsl::size_t>(end - begin,
+                                                        k_CHUNK_INPUT);
+
+        stream.write(buffer,
+                     bdlde::HexEncoder::encode(buffer, begin, numIn));
+        begin += numIn;
     }
 
     return stream;
@@ -1044,7 +1073,9 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream,
+                           object.data(),
+                           object.data() + object.size());
 }
 
 bsl::ostream&
@@ -1054,7 +1085,9 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&              stream,
                                 bdlat_TypeCategory::Array)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream,
+                           object.data(),
+                           object.data() + object.size());
 }
 
 // HEX FUNCTIONS
@@ -1065,9 +1098,8 @@ TypesPrintUtil_Imp::printHex(bsl::ostream&               stream,
                              const EncoderOptions       *,
                              bdlat_TypeCategory::Simple)
 {
-    return bdlb::Print::singleLineHexDump(stream,
-                                          object.begin(),
-                                          object.end());
+    // Calls a function in the unnamed namespace.  Cannot be inlined.
+    return u::encodeHex(stream, object.data(), object.data() + object.size());
 }
 
 bsl::ostream&
@@ -1076,9 +1108,8 @@ TypesPrintUtil_Imp::printHex(bsl::ostream&              stream,
                              const EncoderOptions      *,
                              bdlat_TypeCategory::Array)
 {
-    return bdlb::Print::singleLineHexDump(stream,
-                                          object.begin(),
-                                          object.end());
+    // Calls a function in the unnamed namespace.  Cannot be inlined.
+    return u::encodeHex(stream, object.data(), object.data() + object.size());
 }
 
 // TEXT FUNCTIONS
@@ -0,0 +1,163 @@
+// bdlb_stringviewhash.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLB_STRINGVIEWHASH
+#define INCLUDED_BDLB_STRINGVIEWHASH
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a transparent hash functor for string views.
+//
+//@CLASSES:
+//  bdlb::StringViewHash: transparent hash functor for string views
+//
+//@SEE_ALSO: bdlb_transparenthash, bdlb_transparentequalto,
+//           bdlb_caselessstringviewhash
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlb::StringViewHash',
+// that defines a transparent functor to generate a hash code for a string
+// view.  Any argument convertible to 'bsl::string_view' (e.g., a
+// 'bsl::string', a 'bsl::string_view', a string literal, or a pointer to a
+// null-terminated string) is hashed by its characters, and has the same hash
+// code as a 'bsl::string' having the same characters.  Used together with
+// 'bdlb::TransparentEqualTo', this hash functor allows an unordered container
+// of 'bsl::string' keys to be searched using any of these types, without
+// creating a temporary 'bsl::string' (and hence without allocating memory).
+//
+// Note that, unlike 'bdlb::TransparentHash', which hashes a 'const char *' by
+// its address (as 'bsl::hash' does), 'bdlb::StringViewHash' hashes it by the
+// characters it addresses: 'bdlb::StringViewHash' is meant to be used by
+// containers whose keys are strings, and not by containers whose keys are
+// pointers.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Set of Strings Using a String Literal
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a set of the names of the cities in which we have an
+// office, and we need to search it using names that are supplied as string
+// literals or as 'const char *'.  Searching a 'bsl::unordered_set' that uses
+// the default hash functor and equality comparator with such an argument
+// creates a temporary 'bsl::string', which may allocate memory.
+//
+// First, we create a container that uses 'bdlb::StringViewHash' and the
+// transparent comparator 'bdlb::TransparentEqualTo':
+//..
+//  typedef bsl::unordered_set<bsl::string,
+//                             bdlb::StringViewHash,
+//                             bdlb::TransparentEqualTo> CitySet;
+//
+//  CitySet cities;
+//..
+// Then, we fill the container with the names of the cities:
+//..
+//  cities.insert("New York");
+//  cities.insert("London");
+//..
+// Finally, we observe that the container can be searched using a string
+// literal, a 'const char *', or a 'bsl::string_view', without creating a
+// temporary string:
+//..
+//  const char *const tokyo = "Tokyo";
+//
+//  assert(cities.end() != cities.find("London"));
+//  assert(cities.end() != cities.find(bsl::string_view("New York")));
+//  assert(cities.end() == cities.find(tokyo));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_istriviallydefaultconstructible.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                           // =====================
+                           // struct StringViewHash
+                           // =====================
+
+struct StringViewHash {
+    // This 'struct' defines a hash operation for string views, enabling
+    // 'bsl::string's, 'bsl::string_view's, and null-terminated strings to be
+    // used for heterogeneous lookup in the standard unordered associative
+    // containers such as 'bsl::unordered_map' and 'bsl::unordered_set'.  Note
+    // that this class is an empty POD type.
+
+    // PUBLIC TYPES
+    typedef bsl::string_view  argument_type;
+    typedef bsl::size_t       result_type;
+    typedef void              is_transparent;
+        // Type alias indicating this is a transparent hash functor.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringViewHash, bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(StringViewHash,
+                                      bsl::is_trivially_default_constructible);
+
+    //! StringViewHash() = default;
+        // Create a 'StringViewHash' object.
+
+    //! StringViewHash(const StringViewHash& original) = default;
+        // Create a 'StringViewHash' object.  Note that as 'StringViewHash' is
+        // an empty (stateless) type, this operation has no observable effect.
+
+    //! ~StringViewHash() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! StringViewHash& operator=(const StringViewHash& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+        // Note that as 'StringViewHash' is an empty (stateless) type, this
+        // operation has no observable effect.
+
+    // ACCESSORS
+    bsl::size_t operator()(const bsl::string_view& argument) const;
+        // Return a hash code generated from the characters of the specified
+        // 'argument' string.  Note that the returned value is the same as the
+        // hash code that 'bsl::hash<bsl::string>' returns for a string having
+        // the same characters.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // struct StringViewHash
+                           // ---------------------
+
+// ACCESSORS
+inline
+bsl::size_t StringViewHash::operator()(const bsl::string_view& argument) const
+{
+    return bsl::hash<bsl::string_view>().operator()(argument);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
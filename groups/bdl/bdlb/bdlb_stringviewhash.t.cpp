@@ -0,0 +1,563 @@
+// bdlb_stringviewhash.t.cpp                                          -*-C++-*-
+#include <bdlb_stringviewhash.h>
+
+#include <bdlb_transparentequalto.h>
+
+#include <bslalg_constructorproxy.h>
+#include <bslalg_typetraits.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_issame.h>
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_istriviallydefaultconstructible.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>  // 'bsl::size_t'
+#include <bsl_cstring.h>  // 'bsl::strcmp'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_unordered_set.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// 'bdlb::StringViewHash' provides a stateless type and thus very little to
+// test.  The primary concern is that the function call operator hashes the
+// different string types by their characters, consistently with 'bsl::hash'.
+// CREATORS can be tested only for mechanical functioning.  And BSL traits
+// presence should be checked as we declare that 'bdlb::StringViewHash' is an
+// empty POD.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o No memory is ever allocated from the default allocator.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// [ 3] bsl::size_t operator()(const bsl::string_view& argument) const
+// [ 2] StringViewHash()
+// [ 2] StringViewHash(const bdlb::StringViewHash&)
+// [ 2] ~StringViewHash()
+// [ 2] StringViewHash& operator=(const bdlb::StringViewHash&)
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] TESTING TYPEDEFS AND TRAITS
+// [ 5] QoI: Support for empty base optimization
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                    NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlb::StringViewHash Obj;
+
+//=============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+template<class STRING>
+void testHashString()
+    // Verify the correctness of the function call operator for values of the
+    // (template parameter) 'STRING' type.
+{
+    static const struct {
+        int         d_lineNum;  // source line number
+        const char *d_str_p;    // specification string
+    } DATA[] = {
+        //line  string
+        //----  ------------------------------------------------------------
+        { L_,   "",                                                          },
+        { L_,   "A",                                                         },
+        { L_,   "B",                                                         },
+        { L_,   "AB",                                                        },
+        { L_,   "BC",                                                        },
+        { L_,   "BCA",                                                       },
+        { L_,   "CAB",                                                       },
+        { L_,   "CDAB",                                                      },
+        { L_,   "DABC"                                                       },
+        { L_,   "ABCDE"                                                      },
+        { L_,   "EDCBA"                                                      },
+        { L_,   "ABCDEA"                                                     },
+        { L_,   "ABCDEAB"                                                    },
+        { L_,   "BACDEABC"                                                   },
+        { L_,   "CBADEABCD"                                                  },
+        { L_,   "CBADEABCDAB"                                                },
+        { L_,   "CBADEABCDABC"                                               },
+        { L_,   "CBADEABCDABCDE"                                             },
+        { L_,   "CBADEABCDABCDEA"                                            },
+        { L_,   "CBADEABCDABCDEAB"                                           },
+        { L_,   "CBADEABCDABCDEABCBADEABCDABCDEA"                            },
+        { L_,   "CBADEABCDABCDEABCBADEABCDABCDEABCBADEABCDABCDEABCBADEABABC" }
+    };
+
+    bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    bslma::TestAllocator ta("test");
+
+    for (bsl::size_t i = 0; i < NUM_DATA; ++i) {
+        const char                       *SPEC     = DATA[i].d_str_p;
+        bslalg::ConstructorProxy<STRING>  proxy(SPEC, &ta);
+        const STRING&                     STR      = proxy.object();
+        const bsl::string                 STRING_VALUE(SPEC, &ta);
+        const std::size_t                 EXPECTED =
+                           bsl::hash<bsl::string>().operator()(STRING_VALUE);
+
+        // XLC version 16.1 (on AIX) complains about creating a const object
+        // that does not have an "initializer or user-defined default
+        // constructor".  To work around that, we create a non-const object,
+        // and a const reference to that object, and use the reference.
+        Obj hash;
+        const Obj& hasher = hash;
+
+        ASSERTV(i, EXPECTED == hasher(STR));
+
+        // A null-terminated string hashes to the same value.
+
+        char buffer[64];
+        bsl::strcpy(buffer, SPEC);
+
+        ASSERTV(i, EXPECTED == hasher(SPEC));
+        ASSERTV(i, EXPECTED == hasher(buffer));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Set of Strings Using a String Literal
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a set of the names of the cities in which we have an
+// office, and we need to search it using names that are supplied as string
+// literals or as 'const char *'.  Searching a 'bsl::unordered_set' that uses
+// the default hash functor and equality comparator with such an argument
+// creates a temporary 'bsl::string', which may allocate memory.
+//
+// First, we create a container that uses 'bdlb::StringViewHash' and the
+// transparent comparator 'bdlb::TransparentEqualTo':
+//..
+    typedef bsl::unordered_set<bsl::string,
+                               bdlb::StringViewHash,
+                               bdlb::TransparentEqualTo> CitySet;
+
+    CitySet cities;
+//..
+// Then, we fill the container with the names of the cities:
+//..
+    cities.insert("New York");
+    cities.insert("London");
+//..
+// Finally, we observe that the container can be searched using a string
+// literal, a 'const char *', or a 'bsl::string_view', without creating a
+// temporary string:
+//..
+    const char *const tokyo = "Tokyo";
+
+    ASSERT(cities.end() != cities.find("London"));
+    ASSERT(cities.end() != cities.find(bsl::string_view("New York")));
+    ASSERT(cities.end() == cities.find(tokyo));
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING QOI: 'StringViewHash' IS AN EMPTY TYPE
+        //   As a quality of implementation issue, the class has no state and
+        //   should support the use of the empty base class optimization on
+        //   compilers that support it.
+        //
+        // Concerns:
+        //: 1 Class 'bdlb::StringViewHash' does not increase the size of an
+        //:   object when used as a base class.
+        //:
+        //: 2 Object of 'bdlb::StringViewHash' class increases size of an
+        //:   object when used as a class member.
+        //
+        // Plan:
+        //: 1 Define two identical non-empty classes with no padding, but
+        //:   derive one of them from 'bdlb::StringViewHash', then assert
+        //:   that both classes have the same size. (C-1)
+        //:
+        //: 2 Create a non-empty class with an 'bdlb::StringViewHash'
+        //:   additional data member, assert that class size is larger than sum
+        //:   of other data member's sizes. (C-2)
+        //
+        // Testing:
+        //   QoI: Support for empty base optimization
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+               << endl
+               << "TESTING QOI: 'StringViewHash' IS AN EMPTY TYPE" << endl
+               << "==============================================" << endl;
+
+        struct TwoInts {
+            int d_a;
+            int d_b;
+        };
+
+        struct DerivedInts : bdlb::StringViewHash {
+            int d_a;
+            int d_b;
+        };
+
+        struct IntWithMember {
+            Obj d_dummy;
+            int d_a;
+        };
+
+        ASSERT(sizeof(TwoInts) == sizeof(DerivedInts));
+        ASSERT(sizeof(int)     <  sizeof(IntWithMember));
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING TYPEDEFS AND TRAITS
+        //   The hash functor's transparency is determined by the presence of
+        //   the 'is_transparent' type.  We need to verify that the class
+        //   offers the required typedefs, and has the declared traits.
+        //
+        // Concerns:
+        //: 1 The types 'is_transparent', 'argument_type', and 'result_type'
+        //:   are defined, publicly accessible, and aliases for 'void',
+        //:   'bsl::string_view', and 'bsl::size_t', respectively.
+        //:
+        //: 2 The class is trivially copyable and trivially default
+        //:   constructible.
+        //
+        // Plan:
+        //: 1 ASSERT each of the typedefs has accessibly aliases the correct
+        //:   type using 'bsl::is_same'. (C-1)
+        //:
+        //: 2 ASSERT the presence of each trait using the
+        //:   'bsl::is_trivially_copyable' and
+        //:   'bsl::is_trivially_default_constructible' metafunctions.  (C-2)
+        //
+        // Testing:
+        //  TESTING TYPEDEFS AND TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TYPEDEFS AND TRAITS" << endl
+                          << "===========================" << endl;
+
+        ASSERT((bsl::is_same<void,             Obj::is_transparent>::value));
+        ASSERT((bsl::is_same<bsl::string_view, Obj::argument_type>::value));
+        ASSERT((bsl::is_same<bsl::size_t,      Obj::result_type>::value));
+
+        ASSERT(bsl::is_trivially_copyable<Obj>::value);
+        ASSERT(bsl::is_trivially_default_constructible<Obj>::value);
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FUNCTION CALL OPERATOR
+        //
+        // Concerns:
+        //: 1 Objects of type 'bdlb::StringViewHash' can be invoked as a
+        //:   function returning 'bsl::size_t' and taking an argument of any
+        //:   type convertible to 'bsl::string_view'.
+        //:
+        //: 2 The function call operator can be invoked on constant objects.
+        //:
+        //: 3 The function call returns the same result as 'bsl::hash' on a
+        //:   'bsl::string' having the same characters, whether the argument
+        //:   is a 'bsl::string', a 'bsl::string_view', a 'const char *', or a
+        //:   'char *'.
+        //:
+        //: 4 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Specify a set of string types 'SS'.  For each type from 'SS'
+        //:   create a variable of this type.  Iterate through a set of table
+        //:   values and compute hash code using function call operator for
+        //:   each value, and for the specification string and a modifiable
+        //:   copy of it.  Verify the results by explicit call of
+        //:   'bsl::hash<bsl::string>' on each value.  (C-1..3)
+        //:
+        //: 2 Verify that no memory have been allocated from the default
+        //:   allocator.  (C-4)
+        //
+        // Testing:
+        //   bsl::size_t operator()(const bsl::string_view& argument) const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FUNCTION CALL OPERATOR" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tTesting operator with string types." << endl;
+
+        testHashString<bsl::string>();
+        testHashString<bsl::string_view>();
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // IMPLICITLY DEFINED OPERATIONS
+        //   Ensure that the four implicitly declared and defined special
+        //   member functions are publicly callable and have no unexpected side
+        //   effects such as allocating memory.  As there is no observable
+        //   state to inspect, there is little to verify other than that the
+        //   expected expressions all compile.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the copy constructor.
+        //:
+        //: 3 The copy constructor is not declared as explicit.
+        //:
+        //: 4 Objects can be assigned to from constant objects.
+        //:
+        //: 5 Assignments operations can be chained.
+        //:
+        //: 6 Objects can be destroyed.
+        //:
+        //: 7 No memory is allocated by the default allocator.
+        //
+        // Plan:
+        //: 1 Verify the default constructor exists and is publicly accessible
+        //:   by default-constructing a 'const bdlb::StringViewHash'
+        //:   object. (C-1)
+        //:
+        //: 2 Verify the copy constructor is publicly accessible and not
+        //:   'explicit' by using the copy-initialization syntax to create a
+        //:   second 'bdlb::StringViewHash' from the first. (C-2..3)
+        //:
+        //: 3 Assign the value of the first ('const') object to the second.
+        //:   (C-4)
+        //:
+        //: 4 Chain the assignment of the value of the first ('const') object
+        //:   to the second, into a self-assignment of the second object to
+        //:   itself. (C-5)
+        //:
+        //: 5 Verify the destructor is publicly accessible by allowing the two
+        //:   'bdlb::StringViewHash' object to leave scope and be
+        //:   destroyed. (C-6)
+        //:
+        //: 6 Verify that no memory have been allocated from the default
+        //:   allocator.  (C-7)
+        //
+        // Testing:
+        //   StringViewHash()
+        //   StringViewHash(const bdlb::StringViewHash&)
+        //   ~StringViewHash()
+        //   StringViewHash& operator=(const bdlb::StringViewHash&)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "IMPLICITLY DEFINED OPERATIONS" << endl
+                          << "=============================" << endl;
+
+        if (verbose) cout <<
+            "\nCreate a test allocator and install it as the default." << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            if (verbose) cout << "Value initialization" << endl;
+            const bdlb::StringViewHash obj1 = bdlb::StringViewHash();
+
+
+            if (verbose) cout << "Copy initialization" << endl;
+            bdlb::StringViewHash obj2 = obj1;
+
+            if (verbose) cout << "Copy assignment" << endl;
+            obj2 = obj1;
+            obj2 = obj2 = obj1;
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Execute function call operator to verify functionality for simple
+        //:   case.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bsl::hash<bsl::string> StringHash;
+
+        bdlb::StringViewHash hasher;
+        bsl::string          aStr("A");
+        bsl::string_view     zStrView("z");
+
+        ASSERT(StringHash().operator()(aStr) == hasher(aStr));
+        ASSERT(StringHash().operator()("z")  == hasher(zStrView));
+        ASSERT(hasher("A")                   == hasher(aStr));
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,7 +12,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlbb_blobutil_cpp, "$Id$ $CSID$")
 
-#include <bdlb_print.h>
+#include <bdlde_crc32c.h>
+#include <bdlde_hexencoder.h>
 #include <bslma_allocator.h>
 #include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
@@ -22,6 +23,7 @@ BSLS_IDENT_RCSID(bdlbb_blobutil_cpp, "$Id$ $CSID$")
 #include <bsl_algorithm.h>
 
 #include <bsl_c_ctype.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 
 namespace BloombergLP {
@@ -56,6 +58,136 @@ void copyFromPlace(char                *dstBuffer,
     } while (copied < length);
 }
 
+char *formatHexDumpOffset(char *out, int offset)
+    // Write to the specified 'out' buffer the specified 'offset' right-aligned
+    // in a field of (at least) 6 characters, followed by a colon and 3 spaces,
+    // and return the address following the last character written.  The
+    // behavior is undefined unless '0 <= offset' and 'out' has room for 14
+    // characters.
+{
+    BSLS_ASSERT(0 <= offset);
+
+    char digits[10];
+    int  numDigits = 0;
+
+    do {
+        digits[numDigits++] = static_cast<char>('0' + offset % 10);
+        offset /= 10;
+    } while (offset);
+
+    for (int i = numDigits; i < 6; ++i) {
+        *out++ = ' ';
+    }
+    while (numDigits) {
+        *out++ = digits[--numDigits];
+    }
+
+    bsl::memcpy(out, ":   ", 4);
+    return out + 4;
+}
+
+bsl::ostream& hexDumpBuffers(bsl::ostream&                       stream,
+                             const bsl::pair<const char *, int> *buffers,
+                             int                                 numBuffers)
+    // Write to the specified 'stream' a hexdump of the contents of the
+    // specified 'numBuffers' 'buffers', each being the address and the length
+    // of a buffer, and return 'stream'.  The output is identical to that of
+    // 'bdlb::Print::hexDump', but the bytes are gathered into chunks of up to
+    // 64 lines, each of which is encoded by a single call to
+    // 'bdlde::HexEncoder::encode' and written by a single call to
+    // 'stream.write'.
+{
+    BSLS_ASSERT(0 <= numBuffers);
+    BSLS_ASSERT(buffers || 0 == numBuffers);
+
+    enum {
+        k_BLOCK_SIZE      =  4,
+        k_CHAR_PER_LINE   = 16,
+        k_LINES_PER_CHUNK = 64,
+        k_CHUNK_SIZE      = k_CHAR_PER_LINE * k_LINES_PER_CHUNK,
+        k_MAX_LINE_LENGTH = 80   // 73, for a 10-digit offset
+    };
+
+    char data[k_CHUNK_SIZE];
+    char hex[2 * k_CHUNK_SIZE];
+    char output[k_LINES_PER_CHUNK * k_MAX_LINE_LENGTH];
+
+    int bufferIndex  = 0;  // current buffer
+    int bufferOffset = 0;  // offset of the next byte to read in the buffer
+    int lineOffset   = 0;  // offset of the first byte of the line
+
+    while (bufferIndex < numBuffers) {
+        int numBytes = 0;
+
+        while (numBytes < k_CHUNK_SIZE && bufferIndex < numBuffers) {
+            const int numToCopy = bsl::min(
+                              static_cast<int>(k_CHUNK_SIZE) - numBytes,
+                              buffers[bufferIndex].second - bufferOffset);
+
+            bsl::memcpy(data + numBytes,
+                        buffers[bufferIndex].first + bufferOffset,
+                        numToCopy);
+            numBytes     += numToCopy;
+            bufferOffset += numToCopy;
+
+            if (bufferOffset == buffers[bufferIndex].second) {
+                ++bufferIndex;
+                bufferOffset = 0;
+            }
+        }
+
+        bdlde::HexEncoder::encode(hex, data, numBytes);
+
+        char *out = output;
+
+        for (int i = 0; i < numBytes; i += k_CHAR_PER_LINE) {
+            const int lineLength = bsl::min(numBytes - i,
+                                            static_cast<int>(k_CHAR_PER_LINE));
+
+            out = formatHexDumpOffset(out, lineOffset);
+            lineOffset += k_CHAR_PER_LINE;
+
+            for (int j = 0; j < k_CHAR_PER_LINE; ++j) {
+                if (j < lineLength) {
+                    out[0] = hex[2 * (i + j)];
+                    out[1] = hex[2 * (i + j) + 1];
+                }
+                else {
+                    out[0] = ' ';
+                    out[1] = ' ';
+                }
+                out += 2;
+
+                if (j % k_BLOCK_SIZE == k_BLOCK_SIZE - 1) {
+                    *out++ = ' ';
+                }
+            }
+
+            bsl::memcpy(out, "    |", 5);
+            out += 5;
+
+            for (int j = 0; j < k_CHAR_PER_LINE; ++j) {
+                if (j < lineLength) {
+                    const char c = data[i + j];
+
+                    *out++ = ' ' <= c && c <= '~' ? c : '.';
+                }
+                else {
+                    *out++ = ' ';
+                }
+            }
+
+            out[0] = '|';
+            out[1] = '\n';
+            out   += 2;
+        }
+
+        stream.write(output, out - output);
+    }
+
+    return stream;
+}
+
 }  // close unnamed namespace
 
 namespace bdlbb {
@@ -594,7 +726,45 @@ bsl::ostream& BlobUtil::hexDump(bsl::ostream& stream,
         }
     }
 
-    return bdlb::Print::hexDump(stream, buffers, numBufferInfo);
+    return hexDumpBuffers(stream, buffers, numBufferInfo);
+}
+
+unsigned int BlobUtil::calculateCrc32c(const Blob& source, unsigned int crc)
+{
+    return calculateCrc32c(source, 0, source.length(), crc);
+}
+
+unsigned int BlobUtil::calculateCrc32c(const Blob&  source,
+                                       int          offset,
+                                       int          length,
+                                       unsigned int crc)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(length <= source.length());
+    BSLS_ASSERT(offset <= source.length() - length);
+
+    if (0 == length) {
+        return crc;                                                   // RETURN
+    }
+
+    bsl::pair<int, int> place = findBufferIndexAndOffset(source, offset);
+
+    while (0 < length) {
+        const BlobBuffer& buffer   = source.buffer(place.first);
+        const int         numBytes = bsl::min(length,
+                                              buffer.size() - place.second);
+
+        crc = bdlde::Crc32c::calculate(buffer.data() + place.second,
+                                       numBytes,
+                                       crc);
+
+        length -= numBytes;
+        ++place.first;
+        place.second = 0;
+    }
+
+    return crc;
 }
 
 int BlobUtil::compare(const Blob& a, const Blob& b)
@@ -250,6 +250,23 @@ struct BlobUtil {
         // lexicographically less than 'b', and a positive value if 'a' is
         // lexicographically greater than 'b'.
 
+    static unsigned int calculateCrc32c(const Blob&  source,
+                                        unsigned int crc = 0);
+    static unsigned int calculateCrc32c(const Blob&  source,
+                                        int          offset,
+                                        int          length,
+                                        unsigned int crc = 0);
+        // Return the CRC32-C value (see 'bdlde_crc32c') calculated for the
+        // data of the specified 'source' or, if specified, for the 'length'
+        // bytes of that data starting at the specified 'offset', using the
+        // optionally specified 'crc' value as the starting point for the
+        // calculation.  The data buffers of 'source' are processed in place,
+        // without being copied into contiguous storage.  The behavior is
+        // undefined unless '0 <= offset', '0 <= length', and
+        // 'offset <= source.length() - length'.  Note that the value returned
+        // is the same as that of 'bdlde::Crc32c::calculate' for the same bytes
+        // held in a contiguous buffer.
+
     static int appendBufferIfValid(Blob *dest, const BlobBuffer& buffer);
         // Append the specified 'buffer' after the last buffer of the specified
         // 'dest' if neither the resulting total size of 'dest' nor its
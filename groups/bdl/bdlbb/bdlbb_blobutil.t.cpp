@@ -12,6 +12,10 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_simpleblobbufferfactory.h>
 
+#include <bdlb_print.h>
+
+#include <bdlde_crc32c.h>
+
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bslim_testutil.h>
@@ -42,6 +46,8 @@ using namespace bsl;  // automatically added by script
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// [16] unsigned int calculateCrc32c(const Blob&, unsigned int);
+// [16] unsigned int calculateCrc32c(const Blob&, int, int, unsigned int);
 // [15] void prependWithCapacityBuffer(Blob*,BlobBuffer*,const char*,int);
 // [14] void appendWithCapacityBuffer(Blob*,BlobBuffer*,const char*,int);
 // [13] int appendBufferIfValid(Blob *d, const BlobBuffer& b);
@@ -469,6 +475,117 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'calculateCrc32c'
+        //
+        // Concerns:
+        //: 1 The CRC32-C value of the data of a blob is the same as that of
+        //:   the same bytes held in a contiguous buffer, however the data is
+        //:   split across the buffers of the blob.
+        //:
+        //: 2 Only the data of the blob, and not the capacity beyond its
+        //:   length, is taken into account.
+        //:
+        //: 3 Any range of the data, including an empty range, may be
+        //:   processed, and the optionally specified starting value is used.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For blobs of various lengths created with factories of various
+        //:   buffer sizes, and also having capacity beyond their length,
+        //:   compare the CRC32-C value of the whole blob, and of every range
+        //:   of a set of ranges of it, to that calculated by
+        //:   'bdlde::Crc32c::calculate' on a contiguous copy of the same data,
+        //:   with and without a starting value.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid offsets and lengths.  (C-4)
+        //
+        // Testing:
+        //   unsigned int calculateCrc32c(const Blob&, unsigned int);
+        //   unsigned int calculateCrc32c(const Blob&, int, int, unsigned int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'calculateCrc32c'\n"
+                             "=========================\n";
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const int BUFFER_SIZES[] = { 1, 2, 3, 7, 16, 64, 1000 };
+        const int NUM_BUFFER_SIZES = sizeof  BUFFER_SIZES
+                                   / sizeof *BUFFER_SIZES;
+
+        const int LENGTHS[] = { 0, 1, 2, 15, 16, 17, 100, 333 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        char data[333];
+        for (int i = 0; i < 333; ++i) {
+            data[i] = static_cast<char>(i * 7 + 3);
+        }
+
+        for (int i = 0; i < NUM_BUFFER_SIZES; ++i) {
+            const int BUFFER_SIZE = BUFFER_SIZES[i];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+            for (int j = 0; j < NUM_LENGTHS; ++j) {
+                const int LENGTH = LENGTHS[j];
+
+                if (veryVerbose) { T_ P_(BUFFER_SIZE) P(LENGTH) }
+
+                Blob blob(&factory, &ta);
+                Util::append(&blob, data, LENGTH);
+                blob.setLength(LENGTH + 2 * BUFFER_SIZE);
+                blob.setLength(LENGTH);
+
+                const unsigned int EXP = bdlde::Crc32c::calculate(data,
+                                                                  LENGTH);
+
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        EXP == Util::calculateCrc32c(blob));
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        bdlde::Crc32c::calculate(data, LENGTH, 0xE3069283) ==
+                                   Util::calculateCrc32c(blob, 0xE3069283));
+
+                for (int offset = 0; offset <= LENGTH; offset += 3) {
+                    for (int length = 0;
+                         length <= LENGTH - offset;
+                         length += 5) {
+                        const unsigned int EXP_RANGE =
+                                bdlde::Crc32c::calculate(data + offset,
+                                                         length,
+                                                         EXP);
+
+                        ASSERTV(BUFFER_SIZE, LENGTH, offset, length,
+                                EXP_RANGE == Util::calculateCrc32c(blob,
+                                                                   offset,
+                                                                   length,
+                                                                   EXP));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(10, &ta);
+
+            Blob blob(&factory, &ta);
+            Util::append(&blob, data, 15);
+
+            ASSERT_PASS(Util::calculateCrc32c(blob,  0, 15));
+            ASSERT_PASS(Util::calculateCrc32c(blob, 15,  0));
+            ASSERT_FAIL(Util::calculateCrc32c(blob, -1,  1));
+            ASSERT_FAIL(Util::calculateCrc32c(blob,  0, -1));
+            ASSERT_FAIL(Util::calculateCrc32c(blob,  0, 16));
+            ASSERT_FAIL(Util::calculateCrc32c(blob,  1, 15));
+            ASSERT_FAIL(Util::calculateCrc32c(blob, 16,  0));
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING 'prependWithCapacityBuffer' FUNCTION
@@ -3339,8 +3456,9 @@ int main(int argc, char *argv[])
 
                 bdlbb::Blob blob(&factory);
 
-                int totalSize = numBuffers * bufferSize;
-                copyStringToBlob(&blob, g(totalSize));
+                int               totalSize = numBuffers * bufferSize;
+                const bsl::string DATA      = g(totalSize);
+                copyStringToBlob(&blob, DATA);
 
                 for (int offset = 0; offset < totalSize; ++offset)
                 {
@@ -3360,6 +3478,17 @@ int main(int argc, char *argv[])
                         if (veryVeryVerbose) {
                             bsl::cout << os.str() << bsl::endl;
                         }
+
+                        // The output is that of 'bdlb::Print::hexDump' on
+                        // the same bytes in a contiguous buffer.
+
+                        bsl::stringstream expected;
+                        bdlb::Print::hexDump(expected,
+                                             DATA.data() + offset,
+                                             length);
+
+                        ASSERTV(bufferSize, numBuffers, offset, length,
+                                expected.str() == os.str());
                     }
                 }
             }
@@ -265,6 +265,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_addconst.h>
 #include <bslmf_enableif.h>
 #include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 #include <bslmf_util.h>    // 'forward(V)'
 
@@ -582,6 +583,25 @@ class FlatHashMap {
         // map maintains unique keys, the range will contain at most one
         // element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having a key equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence
+        // and the second iterator is positioned one past the end of the
+        // sequence.  If this map contains no such elements, then the two
+        // returned iterators will have the same value.  Note that this
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
     bsl::size_t erase(const KEY& key);
         // Remove from this map the element whose key is equal to the specified
         // 'key', if it exists, and return 1; otherwise (there is no element
@@ -614,6 +634,39 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator referring to the modifiable element in this map
+        // having a key equivalent to the specified 'key', or 'end()' if no
+        // such entry exists in this map.  No 'KEY' object is created.  Note
+        // that this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result);
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator referring to the modifiable element in
+        // this map having that key, or 'end()' if no such entry exists in this
+        // map; return the position of 'result' following the last iterator
+        // written.  The result is the same as calling 'find' for each key, but
+        // the hash values of several keys are computed, and their entries
+        // prefetched, before any of them is compared, which makes looking up
+        // many keys in a map that does not fit in the cache of the processor
+        // significantly faster.  The behavior is undefined unless
+        // 'FORWARD_ITERATOR' dereferences to a type convertible to
+        // 'const KEY&'.
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class VALUE_TYPE>
     bsl::pair<iterator, bool>
@@ -752,11 +805,40 @@ class FlatHashMap {
         // Return 'true' if this map contains an element having the specified
         // 'key', and 'false' otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map contains an element having a key
+        // equivalent to the specified 'key', and 'false' otherwise.  Note that
+        // this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        return d_impl.contains(key);
+    }
+
     bsl::size_t count(const KEY& key) const;
         // Return the number of elements in this map having the specified
         // 'key'.  Note that since a flat hash map maintains unique keys, the
         // returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::size_t>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements in this map having a key equivalent to
+        // the specified 'key'.  Note that this overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are transparent.
+        // Also note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.count(key);
+    }
+
     bool empty() const;
         // Return 'true' if this map contains no elements, and 'false'
         // otherwise.
@@ -771,11 +853,63 @@ class FlatHashMap {
         // iterators will have the same value.  Note that since a map maintains
         // unique keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this map having a key equivalent to the specified 'key', where
+        // the first iterator is positioned at the start of the sequence and
+        // the second iterator is positioned one past the end of the sequence.
+        // If this map contains no such elements, then the two returned
+        // iterators will have the same value.  Note that this overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
     const_iterator find(const KEY& key) const;
         // Return a 'const_iterator' referring to the element in this map
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return a 'const_iterator' referring to the element in this map
+        // having a key equivalent to the specified 'key', or 'end()' if no
+        // such entry exists in this map.  No 'KEY' object is created.  Note
+        // that this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result) const;
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, a 'const_iterator' referring to the element in
+        // this map having that key, or 'end()' if no such entry exists in this
+        // map; return the position of 'result' following the last iterator
+        // written.  The result is the same as calling 'find' for each key, but
+        // the hash values of several keys are computed, and their entries
+        // prefetched, before any of them is compared, which makes looking up
+        // many keys in a map that does not fit in the cache of the processor
+        // significantly faster.  The behavior is undefined unless
+        // 'FORWARD_ITERATOR' dereferences to a type convertible to
+        // 'const KEY&'.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this map to
         // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
@@ -1254,6 +1388,17 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashMap<KEY, VALUE, HASH, EQUAL>::find_batch(
+                                                   FORWARD_ITERATOR first,
+                                                   FORWARD_ITERATOR last,
+                                                   OUTPUT_ITERATOR  result)
+{
+    return d_impl.find_batch(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -1380,6 +1525,17 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashMap<KEY, VALUE, HASH, EQUAL>::find_batch(
+                                             FORWARD_ITERATOR first,
+                                             FORWARD_ITERATOR last,
+                                             OUTPUT_ITERATOR  result) const
+{
+    return d_impl.find_batch(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
@@ -4,6 +4,9 @@
 #include <bdlc_flathashtable.h>
 #include <bdlc_flathashtable_groupcontrol.h>
 
+#include <bdlb_stringviewhash.h>
+#include <bdlb_transparentequalto.h>
+
 #include <bslalg_hasstliterators.h>
 
 #include <bslh_fibonaccibadhashwrapper.h>
@@ -51,6 +54,7 @@
 #include <bsl_map.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_unordered_map.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
@@ -144,6 +148,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [24] iterator find(const KEY& key);
+// [31] OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
 // [28] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) entry)
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
@@ -165,6 +170,7 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [31] OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -185,12 +191,15 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashMap&, FlatHashMap&);
 // ----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [33] USAGE EXAMPLE
 // [26] CONCERN: 'FlatHashMap' has the necessary type traits
 // [27] DRQS 165583038: 'insert' with conversion can crash
 // [30] DRQS 169531176: bsl::inserter compatibility on Sun
+// [32] CONCERN: transparent lookups create no 'KEY' objects
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: HIGH LOAD FACTORS
+// [-3] PERFORMANCE TEST: 'find' VS. 'find_batch'
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -973,6 +982,108 @@ bsls::TimeInterval performanceFindNotPresent(MAP *map)
     return results[NUM_TRIAL / 2];
 }
 
+template <class TABLE>
+void performanceHighLoad(double *hitRate,
+                         double *missRate,
+                         TABLE  *table,
+                         double  loadFactor)
+    // Clear the specified 'table', insert distinct keys into it until its
+    // load factor reaches the specified 'loadFactor', and then invoke 'find()'
+    // with keys present in, and absent from, the 'table'.  Load into the
+    // specified 'hitRate' and 'missRate' the median number of, respectively,
+    // successful and unsuccessful 'find()' invocations per microsecond.  The
+    // behavior is undefined unless 'loadFactor <= table->max_load_factor()'.
+    // Note that the capacity of 'table' is not changed.
+{
+    const int NUM_TRIAL = 21;
+
+    const bsl::size_t CAPACITY = table->capacity();
+    const int         NUM_KEYS = static_cast<int>(
+                                   loadFactor * static_cast<double>(CAPACITY));
+
+    table->clear();
+
+    for (int i = 0; i < NUM_KEYS; ++i) {
+        const int KEY = i * 2;
+        table->insert(bsl::make_pair(KEY, KEY));
+    }
+    ASSERT(CAPACITY == table->capacity());
+
+    // Look up the keys in a pseudo-random order so that successive lookups
+    // do not access neighboring groups.
+
+    bsl::vector<int> hits(NUM_KEYS);
+    bsl::vector<int> misses(NUM_KEYS);
+    {
+        unsigned int state = 1;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            state = state * 1103515245u + 12345u;
+
+            const int index = static_cast<int>(
+                                 state % static_cast<unsigned int>(NUM_KEYS));
+
+            hits[i]   = index * 2;
+            misses[i] = index * 2 + 1;
+        }
+    }
+
+    bsl::vector<bsls::TimeInterval> hitResults;
+    bsl::vector<bsls::TimeInterval> missResults;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            if (table->end() != table->find(hits[i])) {
+                ++s_antiOptimization;
+            }
+        }
+
+        bsls::TimeInterval middle = bsls::SystemTime::nowMonotonicClock();
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            if (table->end() == table->find(misses[i])) {
+                ++s_antiOptimization;
+            }
+        }
+
+        bsls::TimeInterval end = bsls::SystemTime::nowMonotonicClock();
+
+        hitResults.push_back(middle - start);
+        missResults.push_back(end - middle);
+    }
+
+    bsl::sort(hitResults.begin(), hitResults.end());
+    bsl::sort(missResults.begin(), missResults.end());
+
+    *hitRate  = NUM_KEYS
+              / (hitResults[NUM_TRIAL / 2].totalSecondsAsDouble() * 1e6);
+    *missRate = NUM_KEYS
+              / (missResults[NUM_TRIAL / 2].totalSecondsAsDouble() * 1e6);
+}
+
+template <class TABLE>
+void reportHighLoad(const char *name, TABLE *table)
+    // Print, for the specified 'table' described by the specified 'name',
+    // the lookup throughput measured by 'performanceHighLoad' at several load
+    // factors up to 85%.
+{
+    const double LOADS[]   = { 0.50, 0.75, 0.85 };
+    const int    NUM_LOADS = static_cast<int>(sizeof LOADS / sizeof *LOADS);
+
+    for (int i = 0; i < NUM_LOADS; ++i) {
+        double hitRate;
+        double missRate;
+
+        performanceHighLoad(&hitRate, &missRate, table, LOADS[i]);
+
+        cout << setw(28) << name
+             << setw(8)  << static_cast<int>(LOADS[i] * 100 + 0.5) << '%'
+             << setw(12) << setprecision(1) << fixed << hitRate
+             << setw(12) << setprecision(1) << fixed << missRate
+             << endl;
+    }
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -996,7 +1107,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 33: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1144,6 +1255,227 @@ int main(int argc, char *argv[])
 //  among         3
 //..
       } break;
+      case 32: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //   Ensure lookups with a transparent hasher and key-equality functor
+        //   do not create 'KEY' objects.
+        //
+        // Concerns:
+        //: 1 If 'HASH' and 'EQUAL' are transparent, 'find', 'contains',
+        //:   'count', and 'equal_range' accept a key of another type and find
+        //:   the element having an equivalent key.
+        //:
+        //: 2 Such lookups allocate no memory, whether or not the key is found.
+        //:
+        //: 3 If 'HASH' and 'EQUAL' are transparent, 'operator[]' with a key
+        //:   already present allocates no memory, and with a new key converts
+        //:   the key only to construct the element.
+        //:
+        //: 4 If 'HASH' and 'EQUAL' are not transparent, 'operator[]' converts
+        //:   a key of another type to 'KEY' at most once.
+        //
+        // Plan:
+        //: 1 Populate a map having 'bdlb::StringViewHash' and
+        //:   'bdlb::TransparentEqualTo', then look up each key, and a key not
+        //:   in the map, using 'bsl::string_view', 'const char *', and
+        //:   'bsl::string'.  Verify the results, and, using test allocator
+        //:   monitors, that no memory is allocated.  (C-1..2)
+        //:
+        //: 2 Use 'operator[]' with existing and new keys given as
+        //:   'const char *', and verify the memory allocated.  (C-3)
+        //:
+        //: 3 Use 'operator[]' with an existing 'const char *' key on a map
+        //:   having the default hasher and key-equality functor, and verify
+        //:   exactly one temporary string is allocated.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: transparent lookups create no 'KEY' objects
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TRANSPARENT LOOKUP" << endl
+                          << "==========================" << endl;
+
+        typedef bdlc::FlatHashMap<bsl::string,
+                                  int,
+                                  bdlb::StringViewHash,
+                                  bdlb::TransparentEqualTo> Obj;
+        typedef bdlc::FlatHashMap<bsl::string, int>         NonTransparentObj;
+
+        const int NUM_KEYS = 100;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> keys(&sa);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            char buffer[80];
+            sprintf(buffer,
+                    "a key that is too long for the short string buffer %d",
+                    i);
+            keys.emplace_back(buffer);
+        }
+
+        const char *const MISSING = "a key that is not in the map at all";
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX[keys[i]] = i;
+        }
+
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string_view  KEY(keys[i]);
+                const char             *CSTR = keys[i].c_str();
+
+                Obj::iterator mIt = mX.find(KEY);
+                ASSERTV(i, mX.end() != mIt);
+                ASSERTV(i, i        == mIt->second);
+
+                Obj::const_iterator it = X.find(KEY);
+                ASSERTV(i, mIt == it);
+                ASSERTV(i, it  == X.find(CSTR));
+                ASSERTV(i, it  == X.find(keys[i]));
+                ASSERTV(i, X.contains(KEY));
+                ASSERTV(i, X.contains(CSTR));
+                ASSERTV(i, 1   == X.count(KEY));
+                ASSERTV(i, it  == X.equal_range(KEY).first);
+                ASSERTV(i, mIt == mX.equal_range(CSTR).first);
+
+                ASSERTV(i, i == mX[CSTR]);
+                ASSERTV(i, i == mX[KEY]);
+            }
+
+            ASSERT(X.end()  == X.find(MISSING));
+            ASSERT(mX.end() == mX.find(bsl::string_view(MISSING)));
+            ASSERT(!X.contains(MISSING));
+            ASSERT(0        == X.count(MISSING));
+            ASSERT(X.equal_range(MISSING).first ==
+                                              X.equal_range(MISSING).second);
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(dam.isTotalSame());
+        }
+
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            mX[MISSING] = -1;
+
+            ASSERT(X.contains(MISSING));
+            ASSERT(-1 == X.find(MISSING)->second);
+            ASSERT(dam.isTotalSame());
+        }
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            NonTransparentObj mY(&oa);
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mY[keys[i]] = i;
+            }
+
+            ASSERT(0 == da.numAllocations());
+
+            ASSERT(7 == mY[keys[7].c_str()]);
+
+            ASSERT(1 == da.numAllocations());
+        }
+      } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'find_batch'
+        //   Ensure the 'find_batch' methods operate as expected.
+        //
+        // Concerns:
+        //: 1 The 'find_batch' methods correctly forward to the underlying
+        //:   implementation and write, for each key, the iterator that 'find'
+        //:   returns for that key.
+        //:
+        //: 2 The returned output iterator follows the last iterator written.
+        //:
+        //: 3 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Create an object holding the even keys of a range, and look up
+        //:   the keys of a larger range with both 'find_batch' methods,
+        //:   comparing the results with those of 'find'.  (C-1..2)
+        //:
+        //: 2 Verify no memory is allocated from the object or the default
+        //:   allocator.  (C-3)
+        //
+        // Testing:
+        //   OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT);
+        //   OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'find_batch'" << endl
+                          << "====================" << endl;
+
+        typedef bdlc::FlatHashMap<int, int> Obj;
+
+        const int NUM_ELEMENTS = 100;
+        const int NUM_KEYS     = 2 * NUM_ELEMENTS + 10;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX[2 * i] = i;
+        }
+
+        bsl::vector<int> keys(&sa);
+        for (int k = -5; k < NUM_KEYS - 5; ++k) {
+            keys.push_back(k);
+        }
+
+        bsl::vector<Obj::iterator>       results(NUM_KEYS, &sa);
+        bsl::vector<Obj::const_iterator> constResults(NUM_KEYS, &sa);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+        bsl::vector<Obj::iterator>::iterator end =
+                     mX.find_batch(keys.begin(), keys.end(), results.begin());
+        bsl::vector<Obj::const_iterator>::iterator constEnd =
+                 X.find_batch(keys.begin(), keys.end(), constResults.begin());
+
+        ASSERT(results.end()      == end);
+        ASSERT(constResults.end() == constEnd);
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int KEY = keys[i];
+
+            ASSERTV(KEY, mX.find(KEY) == results[i]);
+            ASSERTV(KEY,  X.find(KEY) == constResults[i]);
+
+            if (X.end() != constResults[i]) {
+                ASSERTV(KEY, KEY / 2 == constResults[i]->second);
+            }
+        }
+
+        // Modify the values through the non-'const' results.
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            if (X.end() != results[i]) {
+                results[i]->second = -1;
+            }
+        }
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            ASSERTV(i, -1 == X.find(2 * i)->second);
+        }
+
+        ASSERT(oam.isTotalSame());
+        ASSERT(dam.isTotalSame());
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // INSERTER
@@ -4984,6 +5316,190 @@ int main(int argc, char *argv[])
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: HIGH LOAD FACTORS
+        //    Report the lookup throughput of 'bdlc::FlatHashMap', and of the
+        //    underlying 'bdlc::FlatHashTable' using each of the group
+        //    controls, at high load factors.
+        //
+        // Concerns:
+        //: 1 The throughput of 'find' for keys present in, and absent from,
+        //:   a table having a load factor close to the maximum load factor is
+        //:   reported for each of the group controls of
+        //:   'bdlc_flathashtable_groupcontrol'.
+        //
+        // Plan:
+        //: 1 For the default 'bdlc::FlatHashMap', and for a
+        //:   'bdlc::FlatHashTable' having the same entry type, hash functor,
+        //:   and equality functor and each of the group controls, load the
+        //:   table to load factors of 50%, 75%, and 85%, and report the median
+        //:   number of successful and unsuccessful lookups per microsecond.
+        //:   Note that the vectorized implementations of the wider group
+        //:   controls are measured only on a processor supporting AVX2 and
+        //:   AVX-512BW, as they are selected at run-time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: HIGH LOAD FACTORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: HIGH LOAD FACTORS" << endl
+                          << "===================================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        typedef bsl::pair<int, int>                          Entry;
+        typedef bdlc::FlatHashMap_EntryUtil<int, int, Entry> EntryUtil;
+        typedef bdlc::FlatHashMap<int, int>                  Default;
+        typedef bdlc::FlatHashTable<int,
+                                    Entry,
+                                    EntryUtil,
+                                    Default::hasher,
+                                    Default::key_compare,
+                                    bdlc::FlatHashTable_GroupControl>
+                                                                    Table16;
+        typedef bdlc::FlatHashTable<int,
+                                    Entry,
+                                    EntryUtil,
+                                    Default::hasher,
+                                    Default::key_compare,
+                                    bdlc::FlatHashTable_GroupControl32>
+                                                                    Table32;
+        typedef bdlc::FlatHashTable<int,
+                                    Entry,
+                                    EntryUtil,
+                                    Default::hasher,
+                                    Default::key_compare,
+                                    bdlc::FlatHashTable_GroupControl64>
+                                                                    Table64;
+        const bsl::size_t CAPACITY = 1 << 20;
+
+        cout << "capacity: " << CAPACITY << endl
+             << setw(28) << "table"
+             << setw(9)  << "load"
+             << setw(12) << "hits/us"
+             << setw(12) << "misses/us"
+             << endl;
+
+        {
+            Default mX(CAPACITY);
+            reportHighLoad("FlatHashMap", &mX);
+        }
+        {
+            Table16 mX(CAPACITY, Default::hasher(), Default::key_compare());
+            reportHighLoad("FlatHashTable_GroupControl", &mX);
+        }
+        {
+            Table32 mX(CAPACITY, Default::hasher(), Default::key_compare());
+            reportHighLoad("FlatHashTable_GroupControl32", &mX);
+        }
+        {
+            Table64 mX(CAPACITY, Default::hasher(), Default::key_compare());
+            reportHighLoad("FlatHashTable_GroupControl64", &mX);
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'find' VS. 'find_batch'
+        //    Report the time taken to look up keys in a map much larger than
+        //    the cache of the processor using 'find' and 'find_batch'.
+        //
+        // Concerns:
+        //: 1 Looking up many keys with 'find_batch' is faster than calling
+        //:   'find' for each key when the map does not fit in the cache.
+        //
+        // Plan:
+        //: 1 Create a map of 10 million 'int' keys and look up the same
+        //:   sequence of pseudo-random keys, half of which are present in the
+        //:   map, once calling 'find' for each key and once calling
+        //:   'find_batch' for chunks of keys.  Report the time taken by each
+        //:   and verify that both find the same elements.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'find' VS. 'find_batch'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'find' VS. 'find_batch'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        typedef bdlc::FlatHashMap<int, int> Obj;
+        typedef Obj::const_iterator         ConstIter;
+
+        const int          NUM_ELEMENTS = 10 * 1000 * 1000;
+        const int          NUM_LOOKUPS  = NUM_ELEMENTS;
+        const unsigned int KEY_RANGE    = 2u * NUM_ELEMENTS;
+
+        Obj mX;  const Obj& X = mX;
+        mX.reserve(NUM_ELEMENTS);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX[2 * i] = i;
+        }
+
+        bsl::vector<int> keys;
+        keys.reserve(NUM_LOOKUPS);
+        unsigned int seed = 12345;
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            keys.push_back(static_cast<int>((seed >> 1) % KEY_RANGE));
+        }
+
+        bsls::Types::Int64 findSum = 0;
+
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            ConstIter it = X.find(keys[i]);
+            if (X.end() != it) {
+                findSum += it->second;
+            }
+        }
+        const bsls::TimeInterval findTime =
+                                 bsls::SystemTime::nowMonotonicClock() - start;
+
+        const int CHUNK_SIZE = 1024;
+
+        bsl::vector<ConstIter> results(CHUNK_SIZE);
+        bsls::Types::Int64     batchSum = 0;
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < NUM_LOOKUPS; i += CHUNK_SIZE) {
+            const int numKeys = bsl::min(CHUNK_SIZE, NUM_LOOKUPS - i);
+
+            X.find_batch(keys.begin() + i,
+                         keys.begin() + i + numKeys,
+                         results.begin());
+
+            for (int j = 0; j < numKeys; ++j) {
+                if (X.end() != results[j]) {
+                    batchSum += results[j]->second;
+                }
+            }
+        }
+        const bsls::TimeInterval batchTime =
+                                 bsls::SystemTime::nowMonotonicClock() - start;
+
+        ASSERTV(findSum, batchSum, findSum == batchSum);
+
+        cout << NUM_ELEMENTS << " elements, "
+             << NUM_LOOKUPS  << " lookups" << endl
+             << "    'find':       " << findTime.totalSecondsAsDouble()
+             << "s" << endl
+             << "    'find_batch': " << batchTime.totalSecondsAsDouble()
+             << "s" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
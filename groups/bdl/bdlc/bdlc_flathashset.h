@@ -410,6 +410,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_enableif.h>
 #include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 #include <bslmf_util.h>    // 'forward(V)'
 
@@ -821,11 +822,40 @@ class FlatHashSet {
         // Return 'true' if this set contains an element having the specified
         // 'key', and 'false' otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this set contains an element equivalent to the
+        // specified 'key', and 'false' otherwise.  Note that this overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return d_impl.contains(key);
+    }
+
     bsl::size_t count(const KEY& key) const;
         // Return the number of elements in this set having the specified
         // 'key'.  Note that since a flat hash set maintains unique keys, the
         // returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::size_t>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements in this set equivalent to the
+        // specified 'key'.  Note that this overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent.  Also
+        // note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.count(key);
+    }
+
     bool empty() const;
         // Return 'true' if this set contains no elements, and 'false'
         // otherwise.
@@ -840,11 +870,45 @@ class FlatHashSet {
         // iterators will have the same value.  Note that since a set maintains
         // unique keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this set equivalent to the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // set contains no such elements, then the two returned iterators will
+        // have the same value.  Note that this overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are transparent.
+        // Also note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
     const_iterator find(const KEY& key) const;
         // Return a 'const_iterator' referring to the element in this set
         // having the specified 'key', or 'end()' if no such entry exists in
         // this set.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return a 'const_iterator' referring to the element in this set
+        // equivalent to the specified 'key', or 'end()' if no such entry
+        // exists in this set.  No 'KEY' object is created.  Note that this
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this set to
         // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
@@ -178,6 +178,7 @@ using namespace bsl;
 // [27] DRQS 169531176: 'bsl::inserter' usage on Sun
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: HIGH LOAD FACTORS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -937,6 +938,108 @@ bsls::TimeInterval performanceFindNotPresent(SET *set)
     return results[NUM_TRIAL / 2];
 }
 
+template <class TABLE>
+void performanceHighLoad(double *hitRate,
+                         double *missRate,
+                         TABLE  *table,
+                         double  loadFactor)
+    // Clear the specified 'table', insert distinct keys into it until its
+    // load factor reaches the specified 'loadFactor', and then invoke 'find()'
+    // with keys present in, and absent from, the 'table'.  Load into the
+    // specified 'hitRate' and 'missRate' the median number of, respectively,
+    // successful and unsuccessful 'find()' invocations per microsecond.  The
+    // behavior is undefined unless 'loadFactor <= table->max_load_factor()'.
+    // Note that the capacity of 'table' is not changed.
+{
+    const int NUM_TRIAL = 21;
+
+    const bsl::size_t CAPACITY = table->capacity();
+    const int         NUM_KEYS = static_cast<int>(
+                                   loadFactor * static_cast<double>(CAPACITY));
+
+    table->clear();
+
+    for (int i = 0; i < NUM_KEYS; ++i) {
+        const int KEY = i * 2;
+        table->insert(KEY);
+    }
+    ASSERT(CAPACITY == table->capacity());
+
+    // Look up the keys in a pseudo-random order so that successive lookups
+    // do not access neighboring groups.
+
+    bsl::vector<int> hits(NUM_KEYS);
+    bsl::vector<int> misses(NUM_KEYS);
+    {
+        unsigned int state = 1;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            state = state * 1103515245u + 12345u;
+
+            const int index = static_cast<int>(
+                                 state % static_cast<unsigned int>(NUM_KEYS));
+
+            hits[i]   = index * 2;
+            misses[i] = index * 2 + 1;
+        }
+    }
+
+    bsl::vector<bsls::TimeInterval> hitResults;
+    bsl::vector<bsls::TimeInterval> missResults;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            if (table->end() != table->find(hits[i])) {
+                ++s_antiOptimization;
+            }
+        }
+
+        bsls::TimeInterval middle = bsls::SystemTime::nowMonotonicClock();
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            if (table->end() == table->find(misses[i])) {
+                ++s_antiOptimization;
+            }
+        }
+
+        bsls::TimeInterval end = bsls::SystemTime::nowMonotonicClock();
+
+        hitResults.push_back(middle - start);
+        missResults.push_back(end - middle);
+    }
+
+    bsl::sort(hitResults.begin(), hitResults.end());
+    bsl::sort(missResults.begin(), missResults.end());
+
+    *hitRate  = NUM_KEYS
+              / (hitResults[NUM_TRIAL / 2].totalSecondsAsDouble() * 1e6);
+    *missRate = NUM_KEYS
+              / (missResults[NUM_TRIAL / 2].totalSecondsAsDouble() * 1e6);
+}
+
+template <class TABLE>
+void reportHighLoad(const char *name, TABLE *table)
+    // Print, for the specified 'table' described by the specified 'name',
+    // the lookup throughput measured by 'performanceHighLoad' at several load
+    // factors up to 85%.
+{
+    const double LOADS[]   = { 0.50, 0.75, 0.85 };
+    const int    NUM_LOADS = static_cast<int>(sizeof LOADS / sizeof *LOADS);
+
+    for (int i = 0; i < NUM_LOADS; ++i) {
+        double hitRate;
+        double missRate;
+
+        performanceHighLoad(&hitRate, &missRate, table, LOADS[i]);
+
+        cout << setw(28) << name
+             << setw(8)  << static_cast<int>(LOADS[i] * 100 + 0.5) << '%'
+             << setw(12) << setprecision(1) << fixed << hitRate
+             << setw(12) << setprecision(1) << fixed << missRate
+             << endl;
+    }
+}
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -4459,6 +4562,94 @@ cout << endl
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: HIGH LOAD FACTORS
+        //    Report the lookup throughput of 'bdlc::FlatHashSet', and of the
+        //    underlying 'bdlc::FlatHashTable' using each of the group
+        //    controls, at high load factors.
+        //
+        // Concerns:
+        //: 1 The throughput of 'find' for keys present in, and absent from,
+        //:   a table having a load factor close to the maximum load factor is
+        //:   reported for each of the group controls of
+        //:   'bdlc_flathashtable_groupcontrol'.
+        //
+        // Plan:
+        //: 1 For the default 'bdlc::FlatHashSet', and for a
+        //:   'bdlc::FlatHashTable' having the same entry type, hash functor,
+        //:   and equality functor and each of the group controls, load the
+        //:   table to load factors of 50%, 75%, and 85%, and report the median
+        //:   number of successful and unsuccessful lookups per microsecond.
+        //:   Note that the vectorized implementations of the wider group
+        //:   controls are measured only on a processor supporting AVX2 and
+        //:   AVX-512BW, as they are selected at run-time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: HIGH LOAD FACTORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: HIGH LOAD FACTORS" << endl
+                          << "===================================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        typedef bdlc::FlatHashSet_EntryUtil<int> EntryUtil;
+        typedef bdlc::FlatHashSet<int>           Default;
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    EntryUtil,
+                                    Default::hasher,
+                                    Default::key_compare,
+                                    bdlc::FlatHashTable_GroupControl>
+                                                                    Table16;
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    EntryUtil,
+                                    Default::hasher,
+                                    Default::key_compare,
+                                    bdlc::FlatHashTable_GroupControl32>
+                                                                    Table32;
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    EntryUtil,
+                                    Default::hasher,
+                                    Default::key_compare,
+                                    bdlc::FlatHashTable_GroupControl64>
+                                                                    Table64;
+        const bsl::size_t CAPACITY = 1 << 20;
+
+        cout << "capacity: " << CAPACITY << endl
+             << setw(28) << "table"
+             << setw(9)  << "load"
+             << setw(12) << "hits/us"
+             << setw(12) << "misses/us"
+             << endl;
+
+        {
+            Default mX(CAPACITY);
+            reportHighLoad("FlatHashSet", &mX);
+        }
+        {
+            Table16 mX(CAPACITY, Default::hasher(), Default::key_compare());
+            reportHighLoad("FlatHashTable_GroupControl", &mX);
+        }
+        {
+            Table32 mX(CAPACITY, Default::hasher(), Default::key_compare());
+            reportHighLoad("FlatHashTable_GroupControl32", &mX);
+        }
+        {
+            Table64 mX(CAPACITY, Default::hasher(), Default::key_compare());
+            reportHighLoad("FlatHashTable_GroupControl64", &mX);
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
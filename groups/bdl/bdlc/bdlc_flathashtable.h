@@ -10,7 +10,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlc::FlatHashTable: open-addressed hash table like Abseil 'flat_hash_map'
 //
-//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset, bslstl_flathashtable
 //
 //@DESCRIPTION: This component provides the class template
 // 'bdlc::FlatHashTable', which forms the underlying implementation of
@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // use of platform-specific instructions to optimize various methods (e.g.,
 // through use of SSE instructions).
 //
+// Note that 'bslstl::FlatHashTable', which implements
+// 'bsl::flat_unordered_map' and 'bsl::flat_unordered_set' below this package,
+// duplicates the probing, insertion, and erasure logic of this component, and
+// the group control inquiries of 'bdlc_flathashtable_groupcontrol'.  A change
+// to the representation of the control values, to the group inquiries, or to
+// the probe sequence of either component must be made to both.
+//
 // The implemented data structure is inspired by Google's 'flat_hash_map'
 // CppCon presentations (available on YouTube).  The implementation draws from
 // Google's open source 'raw_hash_set.h' file at:
@@ -48,6 +55,21 @@ BSLS_IDENT("$Id: $")
 // Note that the value returned by 'max_load_factor' is implementation
 // dependent and cannot be changed by the user.
 //
+///Group Control
+///-------------
+// The optional template parameter 'GROUP_CONTROL' selects the class used to
+// inspect a group of hashlets at once, and therefore the width of the groups
+// probed when searching the table.  It defaults to
+// 'bdlc::FlatHashTable_GroupControl', whose width (8 or 16) depends on the
+// instruction sets available on the platform.  The classes
+// 'bdlc::FlatHashTable_GroupControl32' and
+// 'bdlc::FlatHashTable_GroupControl64' provide groups of 32 and 64 hashlets,
+// inspected with AVX2 and AVX-512BW instructions, respectively, when the
+// processor supports them at run-time.  Wider groups reduce the number of
+// probe steps at high load factors, in particular when searching for absent
+// keys, at the cost of a larger minimum capacity.  See
+// 'bdlc_flathashtable_groupcontrol' for details.
+//
 ///Requirements on 'KEY', 'ENTRY', 'ENTRY_UTIL', 'HASH', and 'EQUAL'
 ///-----------------------------------------------------------------
 // The template parameter type 'ENTRY' must be copy or move constructible.  The
@@ -131,9 +153,11 @@ BSLS_IDENT("$Id: $")
 #include <bslma_destructorproctor.h>
 
 #include <bslmf_assert.h>
+#include <bslmf_conditional.h>
 #include <bslmf_enableif.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_movableref.h>
 #include <bslmf_util.h>    // 'forward(V)'
@@ -246,13 +270,18 @@ bool operator==(const FlatHashTable_IteratorImp<ENTRY>& a,
                            // class FlatHashTable
                            // ===================
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL = FlatHashTable_GroupControl>
 class FlatHashTable
     // This class template provides a flat hash table implementation useful for
     // implementing a flat hash set and flat hash map.
 {
     // PRIVATE TYPES
-    typedef FlatHashTable_GroupControl       GroupControl;
+    typedef GROUP_CONTROL                    GroupControl;
     typedef FlatHashTable_ImplUtil           ImplUtil;
     typedef FlatHashTable_IteratorImp<ENTRY> IteratorImp;
 
@@ -264,6 +293,8 @@ class FlatHashTable
     typedef HASH       hash_type;
     typedef EQUAL      key_equal_type;
 
+    typedef GROUP_CONTROL group_control_type;
+
     typedef typename bslstl::ForwardIterator<ENTRY,
                                              IteratorImp> iterator;
     typedef typename bslstl::ForwardIterator<const ENTRY,
@@ -291,9 +322,10 @@ class FlatHashTable
         // entries.
 
     // PRIVATE MANIPULATORS
-    bsl::size_t indexOfKey(bool        *notFound,
-                           const KEY&   key,
-                           bsl::size_t  hashValue);
+    template <class LOOKUP_KEY>
+    bsl::size_t indexOfKey(bool              *notFound,
+                           const LOOKUP_KEY&  key,
+                           bsl::size_t        hashValue);
         // Load 'true' into the specified 'notFound' if there is no entry in
         // this table having the specified 'key' with the specified
         // 'hashValue', and 'false' otherwise.  Return the index of the entry
@@ -303,7 +335,8 @@ class FlatHashTable
         // method rehashes the table if the 'key' was not present and the
         // addition of an entry would cause the load factor to exceed
         // 'max_load_factor()'.  The behavior is undefined unless
-        // 'hashValue == d_hasher(key)'.
+        // 'hashValue == d_hasher(key)'.  Note that 'LOOKUP_KEY' is 'KEY'
+        // unless 'HASH' and 'EQUAL' are transparent.
 
     void rehashRaw(bsl::size_t newCapacity);
         // Change the capacity of this table to the specified 'newCapacity',
@@ -313,11 +346,29 @@ class FlatHashTable
         // invariants.
 
     // PRIVATE ACCESSORS
-    bsl::size_t findKey(const KEY& key, bsl::size_t hashValue) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t findKey(const LOOKUP_KEY& key, bsl::size_t hashValue) const;
         // Return the index of the entry within 'd_entries_p' containing the
         // specified 'key', which has the specified 'hashValue', or
         // 'd_capacity' if the 'key' is not present.  The behavior is undefined
-        // unless 'hashValue == d_hasher(key)'.
+        // unless 'hashValue == d_hasher(key)'.  Note that 'LOOKUP_KEY' is
+        // 'KEY' unless 'HASH' and 'EQUAL' are transparent.
+
+    template <class FORWARD_ITERATOR>
+    bsl::size_t findKeys(bsl::size_t      *indices,
+                         FORWARD_ITERATOR *first,
+                         FORWARD_ITERATOR  last) const;
+        // Load, into consecutive elements of the specified 'indices', the
+        // index of the entry within 'd_entries_p' containing each of the keys
+        // in the range starting at the specified '*first' and ending at the
+        // earlier of the specified 'last' and 'k_FIND_BATCH_SIZE' keys past
+        // '*first', or 'd_capacity' for each key that is not present; then
+        // advance '*first' past the keys processed and return the number of
+        // keys processed.  The hash values of all the keys are computed, and
+        // the memory at which the keys are expected to be found is prefetched,
+        // before any key is compared, so that the cache misses incurred by
+        // the lookups overlap.  The behavior is undefined unless 'indices'
+        // has at least 'k_FIND_BATCH_SIZE' elements.
 
     bsl::size_t minimumCompliantCapacity(bsl::size_t minimumCapacity) const;
         // Return the minimum capacity that satisfies all class invariants, and
@@ -333,6 +384,10 @@ class FlatHashTable
 
     static const bsl::int8_t  k_HASHLET_MASK = 0x7f;  // hashlet = hash & MASK
 
+    static const bsl::size_t  k_FIND_BATCH_SIZE = 16; // number of keys whose
+                                                      // lookups 'find_batch'
+                                                      // overlaps
+
     static const bsl::size_t  k_MAX_LOAD_FACTOR_NUMERATOR = 7;
                                                       // numerator of fraction
                                                       // that specifies the
@@ -433,6 +488,31 @@ class FlatHashTable
         // since each key in a flat hash table is unique, the returned range
         // contains at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of objects in this flat hash table having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this table contains no such object, then
+        // the two returned iterators will have the same value, 'end()'.  Note
+        // that this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        iterator it1 = find(key);
+        if (it1 == end()) {
+            return bsl::make_pair(it1, it1);                          // RETURN
+        }
+        iterator it2 = it1;
+        ++it2;
+        return bsl::make_pair(it1, it2);
+    }
+
     bsl::size_t erase(const KEY& key);
         // Remove from this table the object having the specified 'key', if it
         // exists, and return 1; otherwise (there is no object with a key equal
@@ -463,6 +543,44 @@ class FlatHashTable
         // flat hash table with a key equal to the specified 'key', if such an
         // entry exists, and 'end()' otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the object in this
+        // flat hash table with a key equivalent to the specified 'key', if
+        // such an entry exists, and 'end()' otherwise.  No 'KEY' object is
+        // created.  Note that this overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent.  Also
+        // note: implemented inline due to Sun CC compilation error.
+    {
+        bsl::size_t index = findKey(key, d_hasher(key));
+        if (index < d_capacity) {
+            return iterator(IteratorImp(d_entries_p  + index,
+                                        d_controls_p + index,
+                                        d_capacity   - index - 1));   // RETURN
+        }
+        return end();
+    }
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result);
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator providing modifiable access to the
+        // object in this flat hash table with a key equal to that key, if such
+        // an entry exists, and 'end()' otherwise; return the position of
+        // 'result' following the last iterator written.  The result is the
+        // same as calling 'find' for each key, but the lookups of up to
+        // 'k_FIND_BATCH_SIZE' keys are overlapped, which is faster when the
+        // table does not fit in the cache of the processor.  The behavior is
+        // undefined unless 'FORWARD_ITERATOR' dereferences to a type
+        // convertible to 'const KEY&'.
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class ENTRY_TYPE>
     bsl::pair<iterator, bool> insert(
@@ -577,6 +695,21 @@ class FlatHashTable
         // Return 'true' if this table contains an entry having the specified
         // 'key', and 'false' otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this table contains an entry having a key
+        // equivalent to the specified 'key', and 'false' otherwise.  Note that
+        // this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        return d_capacity != findKey(key, d_hasher(key));
+    }
+
     const bsl::uint8_t *controls() const;
         // Return the address of the first element of the underlying array of
         // control values in this table, or 0 if this table is in the
@@ -590,6 +723,21 @@ class FlatHashTable
         // specified 'key'.  Note that since a table maintains unique keys, the
         // returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::size_t>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of objects contained within this table having a
+        // key equivalent to the specified 'key'.  Note that this overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return contains(key) ? 1 : 0;
+    }
+
     bool empty() const;
         // Return 'true' if this table contains no entries, and 'false'
         // otherwise.
@@ -612,11 +760,74 @@ class FlatHashTable
         // table maintains unique keys, the range will contain at most one
         // entry.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of objects in this table having a key equivalent to the
+        // specified 'key', where the first iterator is positioned at the start
+        // of the sequence, and the second is positioned one past the end of
+        // the sequence.  If this table contains no such object, then the two
+        // returned iterators will have the same value, 'end()'.  Note that
+        // this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        const_iterator cit1 = find(key);
+        const_iterator cit2 = cit1;
+        if (cit1 != end()) {
+            ++cit2;
+        }
+        return bsl::make_pair(cit1, cit2);
+    }
+
     const_iterator find(const KEY& key) const;
         // Return an iterator representing the position of the entry in this
         // flat hash table having the specified 'key', or 'end()' if no such
         // entry exists in this table.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator representing the position of the entry in this
+        // flat hash table having a key equivalent to the specified 'key', or
+        // 'end()' if no such entry exists in this table.  No 'KEY' object is
+        // created.  Note that this overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent.  Also
+        // note: implemented inline due to Sun CC compilation error.
+    {
+        bsl::size_t index = findKey(key, d_hasher(key));
+        if (index < d_capacity) {
+            return const_iterator(IteratorImp(
+                                         d_entries_p  + index,
+                                         d_controls_p + index,
+                                         d_capacity   - index - 1));  // RETURN
+        }
+        return end();
+    }
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result) const;
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator representing the position of the
+        // entry in this flat hash table having that key, or 'end()' if no such
+        // entry exists in this table; return the position of 'result'
+        // following the last iterator written.  The result is the same as
+        // calling 'find' for each key, but the lookups of up to
+        // 'k_FIND_BATCH_SIZE' keys are overlapped, which is faster when the
+        // table does not fit in the cache of the processor.  The behavior is
+        // undefined unless 'FORWARD_ITERATOR' dereferences to a type
+        // convertible to 'const KEY&'.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this flat hash
         // table to generate a hash value (of type 'bsl::size_t) for a 'KEY'
@@ -661,9 +872,24 @@ class FlatHashTable
 };
 
 // FREE OPERATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bool operator==(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
-                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bool operator==(const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& lhs,
+                const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
     // value, and 'false' otherwise.  Two 'FlatHashTable' objects have the same
     // value if they have the same number of entries, and for each entry that
@@ -671,9 +897,24 @@ bool operator==(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
     // same value.  Note that this method requires the (template parameter)
     // type 'ENTRY' to be equality-comparable.
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bool operator!=(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
-                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bool operator!=(const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& lhs,
+                const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
     // same value, and 'false' otherwise.  Two 'FlatHashTable' objects do not
     // have the same value if they do not have the same number of entries, or
@@ -682,9 +923,24 @@ bool operator!=(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
     // parameter) type 'ENTRY' to be equality-comparable.
 
 // FREE FUNCTIONS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
-          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void swap(FlatHashTable<KEY,
+                        ENTRY,
+                        ENTRY_UTIL,
+                        HASH,
+                        EQUAL,
+                        GROUP_CONTROL>& a,
+          FlatHashTable<KEY,
+                        ENTRY,
+                        ENTRY_UTIL,
+                        HASH,
+                        EQUAL,
+                        GROUP_CONTROL>& b);
     // Exchange the values of the specified 'a' and 'b' objects.  This function
     // provides the no-throw exception-safety guarantee if the two objects were
     // created with the same allocator and the basic guarantee otherwise.
@@ -1024,8 +1280,18 @@ namespace bdlc {
                            // -------------------
 
 // PRIVATE CLASS METHODS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::findAvailable(
                                                         bsl::uint8_t *controls,
                                                         bsl::size_t   index,
                                                         bsl::size_t   capacity)
@@ -1035,8 +1301,8 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
     for (bsl::size_t i = 0; i < capacity; i += GroupControl::k_SIZE) {
         bsl::uint8_t *controlStart = controls + index;
 
-        GroupControl  groupControl(controlStart);
-        bsl::uint32_t candidates = groupControl.available();
+        GroupControl                   groupControl(controlStart);
+        typename GroupControl::BitMask candidates = groupControl.available();
 
         if (candidates) {
             return index
@@ -1051,14 +1317,22 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
 }
 
 // PRIVATE MANIPULATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+template <class LOOKUP_KEY>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::indexOfKey(bool        *notFound,
-                                             const KEY&   key,
-                                             bsl::size_t  hashValue)
+                          EQUAL,
+                          GROUP_CONTROL>::indexOfKey(
+                                                bool              *notFound,
+                                                const LOOKUP_KEY&  key,
+                                                bsl::size_t        hashValue)
 {
     BSLS_ASSERT_SAFE(hashValue == d_hasher(key));
 
@@ -1082,8 +1356,18 @@ bsl::size_t FlatHashTable<KEY,
     return index;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::rehashRaw(
                                                        bsl::size_t newCapacity)
 {
     BSLS_ASSERT_SAFE(          0 <  newCapacity);
@@ -1098,8 +1382,8 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
         bsl::uint8_t *controlStart = d_controls_p + i;
         ENTRY        *entryStart   = d_entries_p  + i;
 
-        GroupControl  groupControl(controlStart);
-        bsl::uint32_t candidates = groupControl.inUse();
+        GroupControl                   groupControl(controlStart);
+        typename GroupControl::BitMask candidates = groupControl.inUse();
         while (candidates) {
             int   offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
             ENTRY *entry = entryStart + offset;
@@ -1150,10 +1434,21 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
 }
 
 // PRIVATE ACCESSORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
-                                                   const KEY&  key,
-                                                   bsl::size_t hashValue) const
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+template <class LOOKUP_KEY>
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::findKey(
+                                            const LOOKUP_KEY& key,
+                                            bsl::size_t       hashValue) const
 {
     BSLS_ASSERT_SAFE(hashValue == d_hasher(key));
 
@@ -1166,8 +1461,9 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
         bsl::uint8_t *controlStart = d_controls_p + index;
         ENTRY        *entryStart   = d_entries_p  + index;
 
-        GroupControl  groupControl(controlStart);
-        bsl::uint32_t candidates = groupControl.match(hashlet);
+        GroupControl                   groupControl(controlStart);
+        typename GroupControl::BitMask candidates =
+                                                   groupControl.match(hashlet);
         while (candidates) {
             int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
 
@@ -1189,12 +1485,66 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
     return d_capacity;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+template <class FORWARD_ITERATOR>
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::findKeys(
+                                         bsl::size_t      *indices,
+                                         FORWARD_ITERATOR *first,
+                                         FORWARD_ITERATOR  last) const
+{
+    BSLS_ASSERT_SAFE(indices);
+    BSLS_ASSERT_SAFE(first);
+
+    bsl::size_t      hashValues[k_FIND_BATCH_SIZE];
+    FORWARD_ITERATOR groupFirst = *first;
+    bsl::size_t      numKeys    = 0;
+
+    for (; numKeys < k_FIND_BATCH_SIZE && last != *first; ++numKeys) {
+        const KEY& key = **first;
+
+        hashValues[numKeys] = d_hasher(key);
+
+        if (d_capacity) {
+            bsl::size_t index = (hashValues[numKeys] >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+
+            bsls::PerformanceHint::prefetchForReading(d_controls_p + index);
+            bsls::PerformanceHint::prefetchForReading(d_entries_p  + index);
+        }
+        ++*first;
+    }
+
+    for (bsl::size_t i = 0; i < numKeys; ++i, ++groupFirst) {
+        const KEY& key = *groupFirst;
+
+        indices[i] = findKey(key, hashValues[i]);
+    }
+
+    return numKeys;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::minimumCompliantCapacity(
+                          EQUAL,
+                          GROUP_CONTROL>::minimumCompliantCapacity(
                                              bsl::size_t minimumCapacity) const
 {
     bsl::size_t minForEntries = ((d_size + k_MAX_LOAD_FACTOR_NUMERATOR - 1)
@@ -1216,9 +1566,19 @@ bsl::size_t FlatHashTable<KEY,
 }
 
 // CREATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                                               bsl::size_t       capacity,
                                               const HASH&       hash,
                                               const EQUAL&      equal,
@@ -1259,9 +1619,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                                           const FlatHashTable&  original,
                                           bslma::Allocator     *basicAllocator)
 : d_entries_p(0)
@@ -1306,9 +1676,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                                      bslmf::MovableRef<FlatHashTable> original)
 : d_entries_p(bslmf::MovableRefUtil::access(original).d_entries_p)
 , d_controls_p(bslmf::MovableRefUtil::access(original).d_controls_p)
@@ -1329,8 +1709,18 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     reference.d_groupControlShift = 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
     bslmf::MovableRef<FlatHashTable>  original,
     bslma::Allocator                 *basicAllocator)
 : d_entries_p(0)
@@ -1384,9 +1774,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::~FlatHashTable()
 {
     BSLS_ASSERT(
         (d_capacity == 0 && d_groupControlShift == 0) ||
@@ -1407,10 +1807,15 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
 }
 
 // MANIPULATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::operator=(
                                                       const FlatHashTable& rhs)
 {
     if (this != &rhs) {
@@ -1420,10 +1825,15 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
     return *this;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::operator=(
                                           bslmf::MovableRef<FlatHashTable> rhs)
 {
     FlatHashTable& reference = rhs;
@@ -1435,15 +1845,38 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
     return *this;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 template <class KEY_TYPE>
 inline
-ENTRY& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator[](
+ENTRY& FlatHashTable<KEY,
+                     ENTRY,
+                     ENTRY_UTIL,
+                     HASH,
+                     EQUAL,
+                     GROUP_CONTROL>::operator[](
                                BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
 {
+    // Look 'key' up as is if 'HASH' and 'EQUAL' are transparent; otherwise,
+    // convert it to 'KEY' once, rather than once for hashing and again for
+    // each comparison.
+
+    typedef typename bslmf::MovableRefUtil::Decay<KEY_TYPE>::type ArgType;
+    typedef typename bsl::conditional<
+                        bslmf::IsTransparentPredicate<HASH,  ArgType>::value
+                     && bslmf::IsTransparentPredicate<EQUAL, ArgType>::value,
+                        ArgType,
+                        KEY>::type                             LookupType;
+
+    const LookupType& lookupKey = key;
+
     bool        notFound;
-    bsl::size_t hashValue = d_hasher(key);
-    bsl::size_t index     = indexOfKey(&notFound, key, hashValue);
+    bsl::size_t hashValue = d_hasher(lookupKey);
+    bsl::size_t index     = indexOfKey(&notFound, lookupKey, hashValue);
 
     if (notFound) {
         ENTRY_UTIL::construct(d_entries_p + index,
@@ -1459,9 +1892,14 @@ ENTRY& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator[](
     return d_entries_p[index];
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::clear()
 {
     ImplUtil::destroyEntryArray(d_entries_p,
                                 d_entries_p + d_capacity,
@@ -1472,12 +1910,32 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
     d_size = 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 bsl::pair<
-         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
-         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator>
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(const KEY& key)
+         typename FlatHashTable<KEY,
+                                ENTRY,
+                                ENTRY_UTIL,
+                                HASH,
+                                EQUAL,
+                                GROUP_CONTROL>::iterator,
+         typename FlatHashTable<KEY,
+                                ENTRY,
+                                ENTRY_UTIL,
+                                HASH,
+                                EQUAL,
+                                GROUP_CONTROL>::iterator>
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::equal_range(const KEY& key)
 {
     iterator it1 = find(key);
     if (it1 == end()) {
@@ -1488,9 +1946,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(const KEY& key)
     return bsl::make_pair(it1, it2);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::erase(
                                                                 const KEY& key)
 {
     iterator it = find(key);
@@ -1501,15 +1969,21 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return 1;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
-                        typename FlatHashTable<KEY,
-                                               ENTRY,
-                                               ENTRY_UTIL,
-                                               HASH,
-                                               EQUAL>::const_iterator position)
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::erase(
+                                                       const_iterator position)
 {
     BSLS_ASSERT_SAFE(position != end());
 
@@ -1530,15 +2004,21 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
-                        typename FlatHashTable<KEY,
-                                               ENTRY,
-                                               ENTRY_UTIL,
-                                               HASH,
-                                               EQUAL>::iterator position)
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::erase(
+                                                             iterator position)
 {
     // Note that this overload is necessary to avoid ambiguity when the key is
     // a table iterator.
@@ -1562,19 +2042,21 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
-                           typename FlatHashTable<KEY,
-                                                  ENTRY,
-                                                  ENTRY_UTIL,
-                                                  HASH,
-                                                  EQUAL>::const_iterator first,
-                           typename FlatHashTable<KEY,
-                                                  ENTRY,
-                                                  ENTRY_UTIL,
-                                                  HASH,
-                                                  EQUAL>::const_iterator last)
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
 {
     iterator rv;
     {
@@ -1596,10 +2078,25 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return rv;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::find(const KEY& key)
 {
     bsl::size_t index = findKey(key, d_hasher(key));
     if (index < d_capacity) {
@@ -1610,10 +2107,52 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
     return end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR FlatHashTable<KEY,
+                              ENTRY,
+                              ENTRY_UTIL,
+                              HASH,
+                              EQUAL,
+                              GROUP_CONTROL>::find_batch(
+                                                   FORWARD_ITERATOR first,
+                                                   FORWARD_ITERATOR last,
+                                                   OUTPUT_ITERATOR  result)
+{
+    bsl::size_t indices[k_FIND_BATCH_SIZE];
+
+    while (last != first) {
+        const bsl::size_t numKeys = findKeys(indices, &first, last);
+
+        for (bsl::size_t i = 0; i < numKeys; ++i, ++result) {
+            const bsl::size_t index = indices[i];
+            if (index < d_capacity) {
+                *result = iterator(IteratorImp(d_entries_p  + index,
+                                               d_controls_p + index,
+                                               d_capacity   - index - 1));
+            }
+            else {
+                *result = end();
+            }
+        }
+    }
+    return result;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 template <class INPUT_ITERATOR>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::insert(
                                                           INPUT_ITERATOR first,
                                                           INPUT_ITERATOR last)
 {
@@ -1622,9 +2161,14 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::rehash(
                                                    bsl::size_t minimumCapacity)
 {
     minimumCapacity = minimumCompliantCapacity(minimumCapacity);
@@ -1643,9 +2187,19 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::reserve(
                                                         bsl::size_t numEntries)
 {
     if (0 == d_capacity && 0 == numEntries) {
@@ -1662,9 +2216,14 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
     rehash(minForEntries);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::reset()
 {
     if (0 != d_entries_p) {
         ImplUtil::destroyEntryArray(d_entries_p,
@@ -1685,10 +2244,20 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
 
                             // Iterators
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::begin()
 {
     if (d_size) {
         for (bsl::size_t i = 0; i < d_capacity; ++i) {
@@ -1702,19 +2271,34 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
     return iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::end()
 {
     return iterator();
 }
 
                            // Aspects
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::swap(
                                                           FlatHashTable& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
@@ -1729,72 +2313,126 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
 }
 
 // ACCESSORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::
                                                                capacity() const
 {
     return d_capacity;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+bool FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::contains(
                                                           const KEY& key) const
 {
     return find(key) != end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 const bsl::uint8_t *FlatHashTable<KEY,
                                   ENTRY,
                                   ENTRY_UTIL,
                                   HASH,
-                                  EQUAL>::controls() const
+                                  EQUAL,
+                                  GROUP_CONTROL>::controls() const
 {
     return d_controls_p;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::count(
                                                           const KEY& key) const
 {
     return contains(key) ? 1 : 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+bool FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::empty() const
 {
     return 0 == d_size;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 const ENTRY *FlatHashTable<KEY,
                            ENTRY,
                            ENTRY_UTIL,
                            HASH,
-                           EQUAL>::entries() const
+                           EQUAL,
+                           GROUP_CONTROL>::entries() const
 {
     return d_entries_p;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 bsl::pair<typename FlatHashTable<KEY,
                                  ENTRY,
                                  ENTRY_UTIL,
                                  HASH,
-                                 EQUAL>::const_iterator,
+                                 EQUAL,
+                                 GROUP_CONTROL>::const_iterator,
           typename FlatHashTable<KEY,
                                  ENTRY,
                                  ENTRY_UTIL,
                                  HASH,
-                                 EQUAL>::const_iterator>
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                 EQUAL,
+                                 GROUP_CONTROL>::const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::equal_range(
                                                           const KEY& key) const
 {
     const_iterator cit1 = find(key);
@@ -1805,10 +2443,25 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
     return bsl::make_pair(cit1, cit2);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::find(const KEY& key) const
 {
     bsl::size_t index = findKey(key, d_hasher(key));
     if (index < d_capacity) {
@@ -1819,58 +2472,153 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
     return end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR FlatHashTable<KEY,
+                              ENTRY,
+                              ENTRY_UTIL,
+                              HASH,
+                              EQUAL,
+                              GROUP_CONTROL>::find_batch(
+                                             FORWARD_ITERATOR first,
+                                             FORWARD_ITERATOR last,
+                                             OUTPUT_ITERATOR  result) const
+{
+    bsl::size_t indices[k_FIND_BATCH_SIZE];
+
+    while (last != first) {
+        const bsl::size_t numKeys = findKeys(indices, &first, last);
+
+        for (bsl::size_t i = 0; i < numKeys; ++i, ++result) {
+            const bsl::size_t index = indices[i];
+            if (index < d_capacity) {
+                *result = const_iterator(
+                                       IteratorImp(d_entries_p  + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1));
+            }
+            else {
+                *result = end();
+            }
+        }
+    }
+    return result;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+HASH FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::hash_function() const
 {
     return d_hasher;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+EQUAL FlatHashTable<KEY,
+                    ENTRY,
+                    ENTRY_UTIL,
+                    HASH,
+                    EQUAL,
+                    GROUP_CONTROL>::key_eq() const
 {
     return d_equal;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 float bdlc::FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::load_factor() const
+                          EQUAL,
+                          GROUP_CONTROL>::load_factor() const
 {
     return d_capacity > 0
          ? static_cast<float>(d_size) / static_cast<float>(d_capacity)
          : 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 float bdlc::FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::max_load_factor() const
+                          EQUAL,
+                          GROUP_CONTROL>::max_load_factor() const
 {
     return static_cast<float>(k_MAX_LOAD_FACTOR_NUMERATOR)
          / static_cast<float>(k_MAX_LOAD_FACTOR_DENOMINATOR);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::size() const
 {
     return d_size;
 }
 
                             // Iterators
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::begin() const
 {
     if (d_size) {
         for (bsl::size_t i = 0; i < d_capacity; ++i) {
@@ -1885,35 +2633,80 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
     return const_iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cbegin() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::cbegin() const
 {
     return begin();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cend() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::cend() const
 {
     return end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::end() const
 {
     return const_iterator();
 }
 
                            // Aspects
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bslma::Allocator *FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+bslma::Allocator *FlatHashTable<KEY,
+                                ENTRY,
+                                ENTRY_UTIL,
+                                HASH,
+                                EQUAL,
+                                GROUP_CONTROL>::
                                                               allocator() const
 {
     return d_allocator_p;
@@ -1922,23 +2715,32 @@ bslma::Allocator *FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
 }  // close package namespace
 
 // FREE OPERATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bool bdlc::operator==(const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& lhs,
+                                          EQUAL,
+                                          GROUP_CONTROL>& lhs,
                       const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& rhs)
+                                          EQUAL,
+                                          GROUP_CONTROL>& rhs)
 {
     typedef typename FlatHashTable<KEY,
                                    ENTRY,
                                    ENTRY_UTIL,
                                    HASH,
-                                   EQUAL>::const_iterator ConstIterator;
+                                   EQUAL,
+                                   GROUP_CONTROL>::const_iterator
+                                                                 ConstIterator;
 
     if (lhs.size() == rhs.size()) {
         ConstIterator lhsEnd = lhs.end();
@@ -1966,26 +2768,48 @@ bool bdlc::operator==(const FlatHashTable<KEY,
     return false;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bool bdlc::operator!=(const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& lhs,
+                                          EQUAL,
+                                          GROUP_CONTROL>& lhs,
                       const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& rhs)
+                                          EQUAL,
+                                          GROUP_CONTROL>& rhs)
 {
     return !(lhs == rhs);
 }
 
 // FREE FUNCTIONS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
-                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+void bdlc::swap(FlatHashTable<KEY,
+                              ENTRY,
+                              ENTRY_UTIL,
+                              HASH,
+                              EQUAL,
+                              GROUP_CONTROL>& a,
+                FlatHashTable<KEY,
+                              ENTRY,
+                              ENTRY_UTIL,
+                              HASH,
+                              EQUAL,
+                              GROUP_CONTROL>& b)
 {
     if (a.allocator() == b.allocator()) {
         a.swap(b);
@@ -1993,7 +2817,12 @@ void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
         return;                                                       // RETURN
     }
 
-    typedef FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> Table;
+    typedef FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL> Table;
 
     Table futureA(b, a.allocator());
     Table futureB(a, b.allocator());
@@ -2004,12 +2833,19 @@ void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
 
 namespace bslma {
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 struct UsesBslmaAllocator<bdlc::FlatHashTable<KEY,
                                               ENTRY,
                                               ENTRY_UTIL,
                                               HASH,
-                                              EQUAL> > : bsl::true_type {
+                                              EQUAL,
+                                              GROUP_CONTROL> >
+: bsl::true_type {
 };
 
 }  // close namespace bslma
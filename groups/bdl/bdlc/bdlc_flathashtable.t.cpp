@@ -19,6 +19,7 @@
 #include <bslma_testallocatormonitor.h>
 
 #include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_movableref.h>
 
@@ -110,6 +111,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [12] iterator find(const KEY&);
+// [23] OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
 // [16] void insert(INPUT_IT, INPUT_IT);
 // [19] void rehash(size_t);
@@ -130,6 +132,7 @@ using namespace bsl;
 // [ 4] const ENTRY *entries() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [12] const_iterator find(const KEY&) const;
+// [23] OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -159,6 +162,7 @@ using namespace bsl;
 // [12] CONCERN: 'bool operator==(FHTCI&, FHTCI&)'
 // [12] CONCERN: 'ENTRY& FHTI::operator*()'
 // [21] CONCERN: {DRQS 167125039} BASIC OPERATIONS OF MOVED-TO TABLES
+// [22] CONCERN: GROUP_CONTROL TEMPLATE PARAMETER
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -906,13 +910,20 @@ IsValidResult::Enum isValid(bsl::size_t        *errorIndex,
     return IsValidResult::e_SUCCESS;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-IsValidResult::Enum isValid(bsl::size_t                       *errorIndex,
-                            const bdlc::FlatHashTable<KEY,
-                                                      ENTRY,
-                                                      ENTRY_UTIL,
-                                                      HASH,
-                                                      EQUAL>&  table)
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+IsValidResult::Enum isValid(
+                        bsl::size_t                                *errorIndex,
+                        const bdlc::FlatHashTable<KEY,
+                                                  ENTRY,
+                                                  ENTRY_UTIL,
+                                                  HASH,
+                                                  EQUAL,
+                                                  GROUP_CONTROL>&  table)
     // Return 'IsValidResult::e_SUCCESS' if the specified 'table' is valid;
     // otherwise return an 'IsValidResult::Enum' value indicating the found
     // error and populate the specified 'errorIndex' with the location of the
@@ -922,12 +933,188 @@ IsValidResult::Enum isValid(bsl::size_t                       *errorIndex,
                    table.entries(),
                    table.controls(),
                    table.size(),
-                   k_SIZE,
+                   GROUP_CONTROL::k_SIZE,
                    table.capacity(),
                    table.hash_function(),
                    ENTRY_UTIL());
 }
 
+template <class GROUP_CONTROL, class HASH>
+void testCase22GroupControl(int id)
+    // Address the concerns of test case 22 for a table using the (template
+    // parameter) 'GROUP_CONTROL' and 'HASH' types, and the specified 'id'
+    // value.  Note that, in case of a test failure, 'id' can be used to
+    // determine 'GROUP_CONTROL' and 'HASH'.
+{
+    typedef TestEntryUtil<int> EntryUtil;
+    typedef bsl::equal_to<int> Equal;
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                EntryUtil,
+                                HASH,
+                                Equal,
+                                GROUP_CONTROL> Obj;
+
+    const int NUM_KEYS = 1000;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    {
+        Obj mX(1, HASH(), Equal(), &oa);  const Obj& X = mX;
+
+        ASSERTV(id, Obj::k_MIN_CAPACITY == 2 * GROUP_CONTROL::k_SIZE);
+        ASSERTV(id, X.capacity(), Obj::k_MIN_CAPACITY == X.capacity());
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ASSERTV(id, i, true == mX.insert(i).second);
+            ASSERTV(id, i, false == mX.insert(i).second);
+            ASSERTV(id, i, X.load_factor() <= X.max_load_factor());
+        }
+        ASSERTV(id, X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        bsl::size_t errorIndex;
+        ASSERTV(id, IsValidResult::e_SUCCESS == isValid(&errorIndex, X));
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ASSERTV(id, i, X.contains(i));
+            ASSERTV(id, i, X.end() != X.find(i) && i == *X.find(i));
+            ASSERTV(id, i, !X.contains(NUM_KEYS + i));
+            ASSERTV(id, i, !X.contains(-i - 1));
+        }
+
+        // Erase every other key, leaving erased control values behind, and
+        // verify lookups probe past them.
+
+        for (int i = 0; i < NUM_KEYS; i += 2) {
+            ASSERTV(id, i, 1 == mX.erase(i));
+        }
+        ASSERTV(id, IsValidResult::e_SUCCESS == isValid(&errorIndex, X));
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ASSERTV(id, i, (i % 2 == 1) == X.contains(i));
+        }
+
+        int count = 0;
+        typedef typename Obj::const_iterator ConstIterator;
+        for (ConstIterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(id, *it, 1 == *it % 2);
+            ++count;
+        }
+        ASSERTV(id, count, NUM_KEYS / 2 == count);
+
+        for (int i = 0; i < NUM_KEYS; i += 2) {
+            ASSERTV(id, i, true == mX.insert(i).second);
+        }
+        ASSERTV(id, IsValidResult::e_SUCCESS == isValid(&errorIndex, X));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+
+        ASSERTV(id, X == Y);
+
+        mY.rehash(8 * X.capacity());
+
+        ASSERTV(id, X == Y);
+        ASSERTV(id, IsValidResult::e_SUCCESS == isValid(&errorIndex, Y));
+
+        mX.clear();
+
+        ASSERTV(id, 0 == X.size());
+        ASSERTV(id, X.begin() == X.end());
+        ASSERTV(id, !X.contains(1));
+        ASSERTV(id, IsValidResult::e_SUCCESS == isValid(&errorIndex, X));
+    }
+
+    ASSERTV(id, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+template <class GROUP_CONTROL, class HASH>
+void testCase23FindBatch(int id)
+    // Address the concerns of test case 23 for a table using the (template
+    // parameter) 'GROUP_CONTROL' and 'HASH' types, and the specified 'id'
+    // value.  Note that, in case of a test failure, 'id' can be used to
+    // determine 'GROUP_CONTROL' and 'HASH'.
+{
+    typedef TestEntryUtil<int> EntryUtil;
+    typedef bsl::equal_to<int> Equal;
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                EntryUtil,
+                                HASH,
+                                Equal,
+                                GROUP_CONTROL> Obj;
+
+    typedef typename Obj::iterator       Iter;
+    typedef typename Obj::const_iterator ConstIter;
+
+    const int DATA[]   = { 0, 1, 15, 16, 17, 100, 1000 };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int N = DATA[ti];
+
+        Obj mX(0, HASH(), Equal(), &oa);  const Obj& X = mX;
+
+        // Insert the even keys, then erase every fourth one so that lookups
+        // have to probe past erased control values.
+
+        for (int i = 0; i < N; ++i) {
+            mX.insert(2 * i);
+        }
+        for (int i = 0; i < N; i += 2) {
+            mX.erase(2 * i);
+        }
+
+        // Look up every key in '[-3 .. 2 * N + 3)', including keys that were
+        // never present and keys that were erased.
+
+        bsl::vector<int> keys(&sa);
+        for (int k = -3; k < 2 * N + 3; ++k) {
+            keys.push_back(k);
+        }
+        const bsl::size_t NUM_LOOKUPS = keys.size();
+
+        bsl::vector<Iter>      results(NUM_LOOKUPS, &sa);
+        bsl::vector<ConstIter> constResults(NUM_LOOKUPS, &sa);
+
+        for (bsl::size_t len = 0; len <= NUM_LOOKUPS; ++len) {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            typename bsl::vector<Iter>::iterator end = mX.find_batch(
+                                                         keys.begin(),
+                                                         keys.begin() + len,
+                                                         results.begin());
+            typename bsl::vector<ConstIter>::iterator constEnd =
+                                           X.find_batch(keys.begin(),
+                                                        keys.begin() + len,
+                                                        constResults.begin());
+
+            ASSERTV(id, N, len, oam.isTotalSame());
+            ASSERTV(id, N, len, results.begin() + len == end);
+            ASSERTV(id, N, len, constResults.begin() + len == constEnd);
+
+            for (bsl::size_t i = 0; i < len; ++i) {
+                const int  KEY      = keys[i];
+                const bool EXPECTED = 0 <= KEY
+                                   && KEY < 2 * N
+                                   && 2 == KEY % 4;
+
+                ASSERTV(id, N, len, KEY, mX.find(KEY) == results[i]);
+                ASSERTV(id, N, len, KEY, X.find(KEY) == constResults[i]);
+                ASSERTV(id, N, len, KEY,
+                        EXPECTED == (X.end() != constResults[i]));
+                if (EXPECTED) {
+                    ASSERTV(id, N, len, KEY, KEY == *results[i]);
+                    ASSERTV(id, N, len, KEY, KEY == *constResults[i]);
+                }
+            }
+        }
+    }
+
+    ASSERTV(id, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
 
 template <class ENTRY>
 void testCase21OperationsWhenMoved(int id)
@@ -3066,6 +3253,115 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 23: {
+        // --------------------------------------------------------------------
+        // 'find_batch'
+        //
+        // Ensure that 'find_batch' produces the same results as 'find'.
+        //
+        // Concerns:
+        //: 1 For each key in the supplied range, in order, 'find_batch'
+        //:   writes the iterator that 'find' returns for the key.
+        //:
+        //: 2 'find_batch' returns the position of the output iterator
+        //:   following the last iterator written.
+        //:
+        //: 3 Ranges of keys longer than, equal to, and shorter than
+        //:   'k_FIND_BATCH_SIZE', including the empty range, are supported.
+        //:
+        //: 4 Keys that were never present and keys that were erased are
+        //:   reported as absent, including when the table has no capacity.
+        //:
+        //: 5 Both the 'const' and non-'const' overloads work with each of the
+        //:   group controls, and do not allocate memory.
+        //
+        // Plan:
+        //: 1 For each of the group controls, and for hash functors that
+        //:   spread the keys and that map all keys to the first group, create
+        //:   tables of varying sizes from which some keys were erased, look up
+        //:   every prefix of a range of present and absent keys with both
+        //:   overloads of 'find_batch', and compare the results with those of
+        //:   'find'.  Verify the returned output iterators and that no memory
+        //:   is allocated from the object allocator.  (C-1..5)
+        //
+        // Testing
+        //   OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT);
+        //   OUTPUT_IT find_batch(FORWARD_IT, FORWARD_IT, OUTPUT_IT) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'find_batch'" << endl
+                          << "============" << endl;
+
+        typedef bdlc::FlatHashTable_GroupControl   GC;
+        typedef bdlc::FlatHashTable_GroupControl32 GC32;
+        typedef bdlc::FlatHashTable_GroupControl64 GC64;
+
+        testCase23FindBatch<GC,   bslh::Hash<> >(0);
+        testCase23FindBatch<GC,   IntValueIsHash>(1);
+        testCase23FindBatch<GC32, bslh::Hash<> >(2);
+        testCase23FindBatch<GC32, IntValueIsHash>(3);
+        testCase23FindBatch<GC64, bslh::Hash<> >(4);
+        testCase23FindBatch<GC64, IntValueIsHash>(5);
+      } break;
+      case 22: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL TEMPLATE PARAMETER
+        //
+        // Ensure that a table instantiated with any of the group controls
+        // provided by 'bdlc_flathashtable_groupcontrol' operates as expected.
+        //
+        // Concerns:
+        //: 1 The minimum capacity of the table is twice the width of the
+        //:   group control.
+        //:
+        //: 2 Insertions, lookups of present and absent keys, erasures,
+        //:   iteration, copying, and rehashing produce the expected results
+        //:   and leave the table in a valid state, including when the keys
+        //:   collide on the initial group of their probe sequence.
+        //:
+        //: 3 The group control defaults to 'FlatHashTable_GroupControl'.
+        //
+        // Plan:
+        //: 1 For each of the group controls, and for hash functors that
+        //:   spread the keys and that map all keys to the first group, insert
+        //:   keys, look up present and absent keys, erase some keys, re-insert
+        //:   them, copy, rehash, and clear the table, verifying the results
+        //:   and the validity of the table at each step.  (C-1,2)
+        //:
+        //: 2 Verify the 'group_control_type' of a table instantiated without
+        //:   specifying a group control.  (C-3)
+        //
+        // Testing
+        //   CONCERN: GROUP_CONTROL TEMPLATE PARAMETER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL TEMPLATE PARAMETER" << endl
+                          << "================================" << endl;
+
+        {
+            typedef bdlc::FlatHashTable<int,
+                                        int,
+                                        TestEntryUtil<int>,
+                                        IntValueIsHash,
+                                        bsl::equal_to<int> > Obj;
+
+            ASSERT((bsl::is_same<bdlc::FlatHashTable_GroupControl,
+                                 Obj::group_control_type>::value));
+        }
+
+        typedef bdlc::FlatHashTable_GroupControl   GC;
+        typedef bdlc::FlatHashTable_GroupControl32 GC32;
+        typedef bdlc::FlatHashTable_GroupControl64 GC64;
+
+        testCase22GroupControl<GC,   bslh::Hash<> >(0);
+        testCase22GroupControl<GC,   IntValueIsHash>(1);
+        testCase22GroupControl<GC32, bslh::Hash<> >(2);
+        testCase22GroupControl<GC32, IntValueIsHash>(3);
+        testCase22GroupControl<GC64, bslh::Hash<> >(4);
+        testCase22GroupControl<GC64, IntValueIsHash>(5);
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // {DRQS 167125039} BASIC OPERATIONS OF MOVED-TO TABLES
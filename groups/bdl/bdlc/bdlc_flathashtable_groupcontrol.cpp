@@ -4,6 +4,160 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlc_flathashtable_groupcontrol_cpp,"$Id$ $CSID$")
 
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 50000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLC_FLATHASHTABLE_GROUPCONTROL_SIMD_ENABLED
+# define BDLC_FLATHASHTABLE_GROUPCONTROL_TARGET(ISA)                          \
+                                                   __attribute__((target(ISA)))
+    // The vectorized inquiries are compiled for their instruction set by
+    // means of the 'target' attribute, so that they are available regardless
+    // of the '-m' flags used to build this component, and are selected at run
+    // time according to the capabilities of the processor.
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                    // ----------------------------------
+                    // class FlatHashTable_GroupControl32
+                    // ----------------------------------
+
+// PRIVATE CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int
+                                FlatHashTable_GroupControl32::s_hasAvx2 = {0};
+
+// PRIVATE CLASS METHODS
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SIMD_ENABLED)
+BDLC_FLATHASHTABLE_GROUPCONTROL_TARGET("avx2")
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::availableAvx2(const bsl::uint8_t *data)
+{
+    const __m256i group = _mm256_loadu_si256(static_cast<const __m256i *>(
+                                             static_cast<const void *>(data)));
+
+    const BitMask result = static_cast<BitMask>(_mm256_movemask_epi8(group));
+
+    // The upper halves of the vector registers are cleared explicitly, lest
+    // the SSE code of the caller incur transition penalties (the compiler does
+    // not always do so itself for functions having a 'target' attribute).
+
+    _mm256_zeroupper();
+
+    return result;
+}
+
+int FlatHashTable_GroupControl32::detectAvx2()
+{
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("avx2") ? 1 : -1;
+}
+
+BDLC_FLATHASHTABLE_GROUPCONTROL_TARGET("avx2")
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::matchAvx2(const bsl::uint8_t *data,
+                                        bsl::uint8_t        value)
+{
+    const __m256i group = _mm256_loadu_si256(static_cast<const __m256i *>(
+                                             static_cast<const void *>(data)));
+
+    const BitMask result = static_cast<BitMask>(
+                   _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                    _mm256_set1_epi8(static_cast<char>(value)),
+                                    group)));
+
+    _mm256_zeroupper();
+
+    return result;
+}
+#else
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::availableAvx2(const bsl::uint8_t *)
+{
+    BSLS_ASSERT_INVOKE_NORETURN("AVX2 is not supported");
+}
+
+int FlatHashTable_GroupControl32::detectAvx2()
+{
+    return -1;
+}
+
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::matchAvx2(const bsl::uint8_t *, bsl::uint8_t)
+{
+    BSLS_ASSERT_INVOKE_NORETURN("AVX2 is not supported");
+}
+#endif
+
+                    // ----------------------------------
+                    // class FlatHashTable_GroupControl64
+                    // ----------------------------------
+
+// PRIVATE CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int
+                              FlatHashTable_GroupControl64::s_hasAvx512 = {0};
+
+// PRIVATE CLASS METHODS
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SIMD_ENABLED)
+BDLC_FLATHASHTABLE_GROUPCONTROL_TARGET("avx512f,avx512bw")
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::availableAvx512(const bsl::uint8_t *data)
+{
+    const BitMask result = _mm512_movepi8_mask(_mm512_loadu_si512(data));
+
+    _mm256_zeroupper();
+
+    return result;
+}
+
+int FlatHashTable_GroupControl64::detectAvx512()
+{
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx512bw") ? 1 : -1;
+}
+
+BDLC_FLATHASHTABLE_GROUPCONTROL_TARGET("avx512f,avx512bw")
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::matchAvx512(const bsl::uint8_t *data,
+                                          bsl::uint8_t        value)
+{
+    const BitMask result = _mm512_cmpeq_epi8_mask(
+                                    _mm512_set1_epi8(static_cast<char>(value)),
+                                    _mm512_loadu_si512(data));
+
+    _mm256_zeroupper();
+
+    return result;
+}
+#else
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::availableAvx512(const bsl::uint8_t *)
+{
+    BSLS_ASSERT_INVOKE_NORETURN("AVX-512BW is not supported");
+}
+
+int FlatHashTable_GroupControl64::detectAvx512()
+{
+    return -1;
+}
+
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::matchAvx512(const bsl::uint8_t *, bsl::uint8_t)
+{
+    BSLS_ASSERT_INVOKE_NORETURN("AVX-512BW is not supported");
+}
+#endif
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2020 Bloomberg Finance L.P.
 //
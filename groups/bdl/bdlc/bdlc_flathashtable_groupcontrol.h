@@ -9,11 +9,40 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//  bdlc::FlatHashTable_GroupControl32: 32-entry group control inquiries
+//  bdlc::FlatHashTable_GroupControl64: 64-entry group control inquiries
+//
+//@SEE_ALSO: bdlc_flathashtable, bslstl_flathashtable
 //
 //@DESCRIPTION: This component implements the class,
 // 'bdlc::FlatHashTable_GroupControl', that provides query methods to a group
 // of flat hash table control values.  Note that the number of entries in a
-// group control and the inquiry performance is platform dependant.
+// group control and the inquiry performance is platform dependant: a group
+// has 16 entries, inspected with SSE2 or NEON instructions, on platforms
+// supporting either of these instruction sets, and 8 entries, inspected with
+// portable 64-bit arithmetic, otherwise.  Note that
+// 'bslstl::FlatHashTable_GroupControl' (see 'bslstl_flathashtable') duplicates
+// the SSE2 and portable implementations of 'bdlc::FlatHashTable_GroupControl',
+// and must be kept in sync with them.
+//
+// This component also implements the classes,
+// 'bdlc::FlatHashTable_GroupControl32' and
+// 'bdlc::FlatHashTable_GroupControl64', that provide the same query methods
+// to wider groups of, respectively, 32 and 64 control values.  A group of 32
+// entries is inspected with a single AVX2 instruction sequence, and a group of
+// 64 entries with a single AVX-512BW instruction sequence, when the processor
+// supports these instruction sets; otherwise, the inquiries are composed from
+// the inquiries of narrower groups.  The instruction set is selected at
+// run-time, the first time it is needed, so that the vectorized inquiries are
+// available regardless of the options used to build this component.  Note
+// that the vectorized inquiries are not inlined.
+//
+// A flat hash table selects its group control type as a template parameter.
+// Since the group width determines both the layout of the table (the capacity
+// is a multiple of twice the group width) and the probe sequence, the group
+// width is selected at compile-time, per table instantiation.  Wider groups
+// reduce the number of probe steps needed to find an entry, or to establish
+// that a key is absent, in a table with a high load factor.
 //
 // The flat hash map/set/table data structures are inspired by Google's
 // flat_hash_map CppCon presentations (available on youtube).  The
@@ -28,7 +57,9 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_byteorder.h>
+#include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
 #include <bsl_cstddef.h>
@@ -40,6 +71,14 @@ BSLS_IDENT("$Id: $")
 #include <emmintrin.h>
 #endif
 
+#if defined(BSLS_PLATFORM_CPU_NEON)                                           \
+ && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_NEON 1
+    // The NEON implementation uses across-vector operations that are only
+    // available on 64-bit ARM platforms.
+#endif
+
 namespace BloombergLP {
 namespace bdlc {
 
@@ -55,10 +94,15 @@ class FlatHashTable_GroupControl
     // TYPES
 #if defined(BSLS_PLATFORM_CPU_SSE2)
     typedef __m128i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    typedef uint8x16_t    Storage;
 #else
     typedef bsl::uint64_t Storage;
 #endif
 
+    typedef bsl::uint32_t BitMask;
+        // Type of the bit masks returned by the inquiries of this class.
+
   private:
     // CLASS DATA
     static const bsl::uint64_t k_MULT          = 0x0101010101010101ull;
@@ -69,6 +113,14 @@ class FlatHashTable_GroupControl
     // DATA
     Storage d_value;  // efficiently cached value for inquiries
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    // PRIVATE CLASS METHODS
+    static bsl::uint32_t moveMask(uint8x16_t value);
+        // Return a bit mask having the bit at index 'i' set if the byte at
+        // index 'i' of the specified 'value' is non-zero.  The behavior is
+        // undefined unless each byte of 'value' is either 0x00 or 0xFF.
+#endif
+
     // PRIVATE ACCESSORS
     bsl::uint32_t matchRaw(bsl::uint8_t value) const;
         // Return a bit mask of the 'k_SIZE' entries that have the specified
@@ -110,6 +162,185 @@ class FlatHashTable_GroupControl
         // 'value'.  The bit at index 'i' corresponds to the result for
         // 'data[i]'.  The behavior is undefined unless '0 == (0x80 & value)'.
 
+    bool neverFull() const;
+        // Return 'true' if this group control was never full (i.e., has a
+        // value that is empty, but not erased).
+};
+
+                    // ==================================
+                    // class FlatHashTable_GroupControl32
+                    // ==================================
+
+class FlatHashTable_GroupControl32
+    // This class provides methods for making inquires to the data of a group
+    // of 32 control values supplied at construction.
+{
+  public:
+    // TYPES
+    typedef bsl::uint32_t BitMask;
+        // Type of the bit masks returned by the inquiries of this class.
+
+    // PUBLIC CLASS DATA
+    static const bsl::uint8_t k_EMPTY  = FlatHashTable_GroupControl::k_EMPTY;
+    static const bsl::uint8_t k_ERASED = FlatHashTable_GroupControl::k_ERASED;
+    static const bsl::size_t  k_SIZE   = 32;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl Narrow;
+
+    // PRIVATE CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int s_hasAvx2;
+        // 1 if the processor supports the AVX2 instruction set, -1 if it does
+        // not, and 0 until this is first determined by 'hasAvx2'.
+
+    // DATA
+    const bsl::uint8_t *d_data_p;  // data (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static BitMask availableAvx2(const bsl::uint8_t *data);
+        // Return a bit mask of the 'k_SIZE' entries of the specified 'data'
+        // that are empty or erased, computed using AVX2 instructions.  The
+        // behavior is undefined unless 'hasAvx2()' is 'true'.
+
+    static int detectAvx2();
+        // Return 1 if the processor supports the AVX2 instruction set, and -1
+        // otherwise.
+
+    static bool hasAvx2();
+        // Return 'true' if the processor supports the AVX2 instruction set,
+        // and 'false' otherwise.
+
+    static BitMask matchAvx2(const bsl::uint8_t *data, bsl::uint8_t value);
+        // Return a bit mask of the 'k_SIZE' entries of the specified 'data'
+        // that have the specified 'value', computed using AVX2 instructions.
+        // The behavior is undefined unless 'hasAvx2()' is 'true'.
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl32();
+    FlatHashTable_GroupControl32(const FlatHashTable_GroupControl32&);
+    FlatHashTable_GroupControl32& operator=(
+                                          const FlatHashTable_GroupControl32&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl32(const bsl::uint8_t *data);
+        // Create a group control query object using the specified 'data'.  The
+        // bytes of 'data' have no alignment requirement.  The behavior is
+        // undefined unless 'data' has at least 'k_SIZE' bytes available, and
+        // these bytes are not modified during the lifetime of this object.
+        // Note that, unlike 'FlatHashTable_GroupControl', this object does not
+        // copy 'data', as reading back a copy of 32 or more bytes with a
+        // single vector load would stall on store forwarding.
+
+    //! ~FlatHashTable_GroupControl32() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the 'k_SIZE' entries that are empty or erased.
+        // The bit at index 'i' corresponds to the result for 'data[i]'.
+
+    BitMask inUse() const;
+        // Return a bit mask of the 'k_SIZE' entries that are in use (i.e., not
+        // empty or erased).  The bit at index 'i' corresponds to the result
+        // for 'data[i]'.
+
+    BitMask match(bsl::uint8_t value) const;
+        // Return a bit mask of the 'k_SIZE' entries that have the specified
+        // 'value'.  The bit at index 'i' corresponds to the result for
+        // 'data[i]'.  The behavior is undefined unless '0 == (0x80 & value)'.
+
+    bool neverFull() const;
+        // Return 'true' if this group control was never full (i.e., has a
+        // value that is empty, but not erased).
+};
+
+                    // ==================================
+                    // class FlatHashTable_GroupControl64
+                    // ==================================
+
+class FlatHashTable_GroupControl64
+    // This class provides methods for making inquires to the data of a group
+    // of 64 control values supplied at construction.
+{
+  public:
+    // TYPES
+    typedef bsl::uint64_t BitMask;
+        // Type of the bit masks returned by the inquiries of this class.
+
+    // PUBLIC CLASS DATA
+    static const bsl::uint8_t k_EMPTY  = FlatHashTable_GroupControl::k_EMPTY;
+    static const bsl::uint8_t k_ERASED = FlatHashTable_GroupControl::k_ERASED;
+    static const bsl::size_t  k_SIZE   = 64;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl32 Narrow;
+
+    // PRIVATE CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int s_hasAvx512;
+        // 1 if the processor supports the AVX-512BW instruction set, -1 if it
+        // does not, and 0 until this is first determined by 'hasAvx512'.
+
+    // DATA
+    const bsl::uint8_t *d_data_p;  // data (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static BitMask availableAvx512(const bsl::uint8_t *data);
+        // Return a bit mask of the 'k_SIZE' entries of the specified 'data'
+        // that are empty or erased, computed using AVX-512BW instructions.
+        // The behavior is undefined unless 'hasAvx512()' is 'true'.
+
+    static int detectAvx512();
+        // Return 1 if the processor supports the AVX-512BW instruction set,
+        // and -1 otherwise.
+
+    static bool hasAvx512();
+        // Return 'true' if the processor supports the AVX-512BW instruction
+        // set, and 'false' otherwise.
+
+    static BitMask matchAvx512(const bsl::uint8_t *data, bsl::uint8_t value);
+        // Return a bit mask of the 'k_SIZE' entries of the specified 'data'
+        // that have the specified 'value', computed using AVX-512BW
+        // instructions.  The behavior is undefined unless 'hasAvx512()' is
+        // 'true'.
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl64();
+    FlatHashTable_GroupControl64(const FlatHashTable_GroupControl64&);
+    FlatHashTable_GroupControl64& operator=(
+                                          const FlatHashTable_GroupControl64&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl64(const bsl::uint8_t *data);
+        // Create a group control query object using the specified 'data'.  The
+        // bytes of 'data' have no alignment requirement.  The behavior is
+        // undefined unless 'data' has at least 'k_SIZE' bytes available, and
+        // these bytes are not modified during the lifetime of this object.
+        // Note that, unlike 'FlatHashTable_GroupControl', this object does not
+        // copy 'data', as reading back a copy of 32 or more bytes with a
+        // single vector load would stall on store forwarding.
+
+    //! ~FlatHashTable_GroupControl64() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the 'k_SIZE' entries that are empty or erased.
+        // The bit at index 'i' corresponds to the result for 'data[i]'.
+
+    BitMask inUse() const;
+        // Return a bit mask of the 'k_SIZE' entries that are in use (i.e., not
+        // empty or erased).  The bit at index 'i' corresponds to the result
+        // for 'data[i]'.
+
+    BitMask match(bsl::uint8_t value) const;
+        // Return a bit mask of the 'k_SIZE' entries that have the specified
+        // 'value'.  The bit at index 'i' corresponds to the result for
+        // 'data[i]'.  The behavior is undefined unless '0 == (0x80 & value)'.
+
     bool neverFull() const;
         // Return 'true' if this group control was never full (i.e., has a
         // value that is empty, but not erased).
@@ -123,6 +354,23 @@ class FlatHashTable_GroupControl
                      // class FlatHashTable_GroupControl
                      // --------------------------------
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+// PRIVATE CLASS METHODS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::moveMask(uint8x16_t value)
+{
+    // Keep, in each byte, the bit corresponding to its index within its half
+    // of the vector, then sum each half into a byte of the result.
+
+    const uint8x16_t masked = vandq_u8(
+                 value,
+                 vreinterpretq_u8_u64(vdupq_n_u64(0x8040201008040201ull)));
+
+    return static_cast<bsl::uint32_t>(vaddv_u8(vget_low_u8(masked)))
+         | (static_cast<bsl::uint32_t>(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+#endif
+
 // PRIVATE ACCESSORS
 inline
 bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
@@ -131,6 +379,8 @@ bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
     return _mm_movemask_epi8(_mm_cmpeq_epi8(
                                        _mm_set1_epi8(static_cast<char>(value)),
                                        d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    return moveMask(vceqq_u8(vdupq_n_u8(value), d_value));
 #else
     Storage t = d_value ^ (k_MULT * value);
 
@@ -151,6 +401,8 @@ FlatHashTable_GroupControl::FlatHashTable_GroupControl(
 #if defined(BSLS_PLATFORM_CPU_SSE2)
     d_value = _mm_loadu_si128(static_cast<const Storage *>(
                                              static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    d_value = vld1q_u8(data);
 #else
     bsl::memcpy(&d_value, data, k_SIZE);
     d_value = BSLS_BYTEORDER_HOST_U64_TO_LE(d_value);
@@ -163,6 +415,8 @@ bsl::uint32_t FlatHashTable_GroupControl::available() const
 {
 #if defined(BSLS_PLATFORM_CPU_SSE2)
     return _mm_movemask_epi8(d_value);
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    return moveMask(vcltzq_s8(vreinterpretq_s8_u8(d_value)));
 #else
     return static_cast<bsl::uint32_t>(
                       ((d_value & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
@@ -172,11 +426,7 @@ bsl::uint32_t FlatHashTable_GroupControl::available() const
 inline
 bsl::uint32_t FlatHashTable_GroupControl::inUse() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
-    return (~available()) & 0xFFFF;
-#else
-    return (~available()) & 0xFF;
-#endif
+    return (~available()) & ((1u << k_SIZE) - 1);
 }
 
 inline
@@ -193,6 +443,164 @@ bool FlatHashTable_GroupControl::neverFull() const
     return 0 != matchRaw(k_EMPTY);
 }
 
+                    // ----------------------------------
+                    // class FlatHashTable_GroupControl32
+                    // ----------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bool FlatHashTable_GroupControl32::hasAvx2()
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&s_hasAvx2);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == result)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        result = detectAvx2();
+        bsls::AtomicOperations::setIntRelaxed(&s_hasAvx2, result);
+    }
+
+    return 0 < result;
+}
+
+// CREATORS
+inline
+FlatHashTable_GroupControl32::FlatHashTable_GroupControl32(
+                                                      const bsl::uint8_t *data)
+: d_data_p(data)
+{
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::available() const
+{
+    if (hasAvx2()) {
+        return availableAvx2(d_data_p);                               // RETURN
+    }
+
+    BitMask result = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; i += Narrow::k_SIZE) {
+        result |= static_cast<BitMask>(Narrow(d_data_p + i).available()) << i;
+    }
+    return result;
+}
+
+inline
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::inUse() const
+{
+    return ~available();
+}
+
+inline
+FlatHashTable_GroupControl32::BitMask
+FlatHashTable_GroupControl32::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0 == (value & 0x80));
+
+    if (hasAvx2()) {
+        return matchAvx2(d_data_p, value);                            // RETURN
+    }
+
+    BitMask result = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; i += Narrow::k_SIZE) {
+        result |= static_cast<BitMask>(Narrow(d_data_p + i).match(value)) << i;
+    }
+    return result;
+}
+
+inline
+bool FlatHashTable_GroupControl32::neverFull() const
+{
+    if (hasAvx2()) {
+        return 0 != matchAvx2(d_data_p, k_EMPTY);                     // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < k_SIZE; i += Narrow::k_SIZE) {
+        if (Narrow(d_data_p + i).neverFull()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+                    // ----------------------------------
+                    // class FlatHashTable_GroupControl64
+                    // ----------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bool FlatHashTable_GroupControl64::hasAvx512()
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&s_hasAvx512);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == result)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        result = detectAvx512();
+        bsls::AtomicOperations::setIntRelaxed(&s_hasAvx512, result);
+    }
+
+    return 0 < result;
+}
+
+// CREATORS
+inline
+FlatHashTable_GroupControl64::FlatHashTable_GroupControl64(
+                                                      const bsl::uint8_t *data)
+: d_data_p(data)
+{
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::available() const
+{
+    if (hasAvx512()) {
+        return availableAvx512(d_data_p);                             // RETURN
+    }
+
+    return static_cast<BitMask>(Narrow(d_data_p).available())
+         | static_cast<BitMask>(Narrow(d_data_p + Narrow::k_SIZE).available())
+                                                             << Narrow::k_SIZE;
+}
+
+inline
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::inUse() const
+{
+    return ~available();
+}
+
+inline
+FlatHashTable_GroupControl64::BitMask
+FlatHashTable_GroupControl64::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0 == (value & 0x80));
+
+    if (hasAvx512()) {
+        return matchAvx512(d_data_p, value);                          // RETURN
+    }
+
+    return static_cast<BitMask>(Narrow(d_data_p).match(value))
+         | static_cast<BitMask>(Narrow(d_data_p + Narrow::k_SIZE).match(value))
+                                                             << Narrow::k_SIZE;
+}
+
+inline
+bool FlatHashTable_GroupControl64::neverFull() const
+{
+    if (hasAvx512()) {
+        return 0 != matchAvx512(d_data_p, k_EMPTY);                   // RETURN
+    }
+
+    return Narrow(d_data_p).neverFull()
+        || Narrow(d_data_p + Narrow::k_SIZE).neverFull();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
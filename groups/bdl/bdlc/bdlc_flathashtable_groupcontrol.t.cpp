@@ -22,10 +22,14 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 //                              Overview
 //                              --------
-// The component under test defines a mechanism,
-// 'bdlc::FlatHashTable_GroupControl'.  No allocator is involved.  Testing
-// concerns are (safely) limited to the mechanical functioning of the various
-// methods.
+// The component under test defines three mechanisms,
+// 'bdlc::FlatHashTable_GroupControl', 'bdlc::FlatHashTable_GroupControl32',
+// and 'bdlc::FlatHashTable_GroupControl64'.  No allocator is involved.
+// Testing concerns are (safely) limited to the mechanical functioning of the
+// various methods.  The wider group controls are tested with the same oracle
+// as 'bdlc::FlatHashTable_GroupControl'; note that the implementation of these
+// classes is selected at run-time, so this test driver should be run on
+// processors with and without AVX2 and AVX-512BW to test both implementations.
 //
 // Global Concerns:
 //: o The test driver is robust w.r.t. reuse in other, similar components.
@@ -44,6 +48,20 @@ using namespace bsl;
 // [ 3] bsl::uint32_t inUse() const;
 // [ 3] bsl::uint32_t match(bsl::uint8_t value) const;
 // [ 3] bool neverFull() const;
+//
+// FlatHashTable_GroupControl32
+// [ 4] FlatHashTable_GroupControl32(const bsl::uint8_t *data);
+// [ 4] BitMask available() const;
+// [ 4] BitMask inUse() const;
+// [ 4] BitMask match(bsl::uint8_t value) const;
+// [ 4] bool neverFull() const;
+//
+// FlatHashTable_GroupControl64
+// [ 4] FlatHashTable_GroupControl64(const bsl::uint8_t *data);
+// [ 4] BitMask available() const;
+// [ 4] BitMask inUse() const;
+// [ 4] BitMask match(bsl::uint8_t value) const;
+// [ 4] bool neverFull() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // ----------------------------------------------------------------------------
@@ -107,7 +125,9 @@ void aSsErT(bool condition, const char *message, int line)
 //                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
 
-typedef bdlc::FlatHashTable_GroupControl Obj;
+typedef bdlc::FlatHashTable_GroupControl   Obj;
+typedef bdlc::FlatHashTable_GroupControl32 Obj32;
+typedef bdlc::FlatHashTable_GroupControl64 Obj64;
 
 const bsl::uint8_t EE = Obj::k_EMPTY;
 const bsl::uint8_t XX = Obj::k_ERASED;
@@ -121,13 +141,15 @@ const bsl::uint8_t VE = 0x11;
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
 
+template <class OBJ>
 void print(const bsl::uint8_t *data)
-    // Print a representation of the specified 'data'.
+    // Print a representation of the 'OBJ::k_SIZE' bytes of the specified
+    // 'data'.
 {
     const char *hex = "0123456789abcdef";
 
     bsl::cout << "   ";
-    for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
+    for (bsl::size_t i = 0; i < OBJ::k_SIZE; ++i) {
         bsl::cout << ' '
                   << hex[static_cast<bsl::uint32_t>((data[i] >> 4) & 0xF)]
                   << hex[static_cast<bsl::uint32_t>(data[i] & 0xF)];
@@ -135,21 +157,25 @@ void print(const bsl::uint8_t *data)
     bsl::cout << bsl::endl;
 }
 
+template <class OBJ>
 void verifyWithOracle(const bsl::uint8_t *data)
-    // Verify the accessor methods of a 'bdlc::FlatHashTable_GroupControl'
-    // return the expected values for the specified 'data'.
+    // Verify the accessor methods of an object of the (template parameter)
+    // type 'OBJ', one of the group control classes under test, return the
+    // expected values for the specified 'data'.
 {
-    Obj mX(data);  const Obj& X = mX;
-
-    bsl::uint32_t expAvailable = 0;
-    bsl::uint32_t expInUse     = 0;
-    bsl::uint32_t expMatchA    = 0;
-    bsl::uint32_t expMatchB    = 0;
-    bsl::uint32_t expMatchC    = 0;
-    bsl::uint32_t expMatchD    = 0;
-    bsl::uint32_t expMatchE    = 0;
-    bool          expNeverFull = false;
-    for (int i = Obj::k_SIZE - 1; i >= 0; --i) {
+    typedef typename OBJ::BitMask BitMask;
+
+    OBJ mX(data);  const OBJ& X = mX;
+
+    BitMask expAvailable = 0;
+    BitMask expInUse     = 0;
+    BitMask expMatchA    = 0;
+    BitMask expMatchB    = 0;
+    BitMask expMatchC    = 0;
+    BitMask expMatchD    = 0;
+    BitMask expMatchE    = 0;
+    bool    expNeverFull = false;
+    for (int i = static_cast<int>(OBJ::k_SIZE) - 1; i >= 0; --i) {
         expAvailable = expAvailable * 2 + (data[i] >= 0x80u ? 1 : 0);
         expInUse     = expInUse * 2     + (data[i] <  0x80u ? 1 : 0);
         expMatchA    = expMatchA * 2    + (data[i] == VA    ? 1 : 0);
@@ -161,46 +187,134 @@ void verifyWithOracle(const bsl::uint8_t *data)
     }
 
     if (expAvailable != X.available()) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expAvailable == X.available());
 
     if (expInUse != X.inUse()) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expInUse == X.inUse());
 
     if (expMatchA != X.match(VA)) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expMatchA == X.match(VA));
 
     if (expMatchB != X.match(VB)) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expMatchB == X.match(VB));
 
     if (expMatchC != X.match(VC)) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expMatchC == X.match(VC));
 
     if (expMatchD != X.match(VD)) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expMatchD == X.match(VD));
 
     if (expMatchE != X.match(VE)) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expMatchE == X.match(VE));
 
     if (expNeverFull != X.neverFull()) {
-        print(data);
+        print<OBJ>(data);
     }
     ASSERT(expNeverFull == X.neverFull());
 }
 
+template <class OBJ>
+void testWideAccessors(bool verbose)
+    // Verify, using the depth-enumerated technique up to a depth of two and
+    // pseudo-random data, that the accessors of the (template parameter) type
+    // 'OBJ', one of the wide group control classes under test, return the
+    // same values as an oracle implementation.  Also verify the defensive
+    // checks of 'match'.  Use the specified 'verbose' to control the output.
+{
+    BSLMF_ASSERT(OBJ::k_SIZE <= 64);
+    BSLMF_ASSERT(OBJ::k_SIZE <= 8 * sizeof(typename OBJ::BitMask));
+
+    const bsl::size_t SIZE = OBJ::k_SIZE;
+
+    const bsl::uint8_t BACKGROUND[] = { EE, XX, VA };
+    const bsl::size_t  NUM_BACKGROUND = sizeof BACKGROUND / sizeof *BACKGROUND;
+
+    const bsl::uint8_t VALUE[] = { VA, VB, VC, VD, VE, EE, XX };
+    const bsl::size_t  NUM_VALUE = sizeof VALUE / sizeof *VALUE;
+
+    if (verbose) cout << "\tDepth-enumerated data." << endl;
+
+    for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
+        bsl::uint8_t data[64];
+        bsl::memset(data, BACKGROUND[bi], sizeof data);
+
+        verifyWithOracle<OBJ>(data);
+
+        for (bsl::size_t i = 0; i < SIZE; ++i) {
+            for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
+                data[i] = VALUE[ii];
+                verifyWithOracle<OBJ>(data);
+                for (bsl::size_t j = i + 1; j < SIZE; ++j) {
+                    for (bsl::size_t jj = 0; jj < NUM_VALUE; ++jj) {
+                        data[j] = VALUE[jj];
+                        verifyWithOracle<OBJ>(data);
+                        data[j] = BACKGROUND[bi];
+                    }
+                }
+                data[i] = BACKGROUND[bi];
+            }
+        }
+    }
+
+    if (verbose) cout << "\tPseudo-random data." << endl;
+    {
+        bsl::uint32_t state = 12345;
+
+        for (int iteration = 0; iteration < 10000; ++iteration) {
+            bsl::uint8_t data[64];
+
+            for (bsl::size_t i = 0; i < SIZE; ++i) {
+                state = state * 1103515245u + 12345u;
+                data[i] = VALUE[(state >> 16) % NUM_VALUE];
+            }
+            verifyWithOracle<OBJ>(data);
+        }
+    }
+
+    if (verbose) cout << "\tUnaligned data." << endl;
+    {
+        bsl::uint8_t buffer[128];
+        bsl::memset(buffer, EE, sizeof buffer);
+
+        for (bsl::size_t offset = 0; offset < 64; ++offset) {
+            buffer[offset + offset % SIZE] = VA;
+            buffer[offset + SIZE - 1]      = XX;
+            verifyWithOracle<OBJ>(buffer + offset);
+            bsl::memset(buffer, EE, sizeof buffer);
+        }
+    }
+
+    if (verbose) cout << "\tNegative Testing." << endl;
+    {
+        bsls::AssertTestHandlerGuard hG;
+
+        bsl::uint8_t data[64];
+        bsl::memset(data, EE, sizeof data);
+        data[1] = VA;
+
+        OBJ mX(data);  const OBJ& X = mX;
+
+        ASSERT_SAFE_PASS(X.match(VA));
+        ASSERT_SAFE_FAIL(X.match(OBJ::k_EMPTY));
+        ASSERT_SAFE_FAIL(X.match(OBJ::k_ERASED));
+        ASSERT_SAFE_FAIL(X.match(0xFF));
+    }
+}
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -235,6 +349,73 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // WIDE GROUP CONTROLS
+        //   Ensure the 32 and 64-entry group controls operate as expected.
+        //
+        // Concerns:
+        //: 1 The constructors of 'FlatHashTable_GroupControl32' and
+        //:   'FlatHashTable_GroupControl64' accept 'k_SIZE' control values
+        //:   from data having no alignment requirement.
+        //:
+        //: 2 The accessors 'available', 'inUse', 'match', and 'neverFull'
+        //:   return masks having one bit for each of the 'k_SIZE' control
+        //:   values, including the control values in the upper half
+        //:   (and, for the scalar implementation, in each sub-group).
+        //:
+        //: 3 The control value constants are those of
+        //:   'FlatHashTable_GroupControl', so that tables using any of the
+        //:   group controls share a representation of control values.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the values of 'k_SIZE', 'k_EMPTY', and 'k_ERASED'.  (C-3)
+        //:
+        //: 2 Using the depth-enumerated technique, up to a depth of two, and
+        //:   pseudo-random data, compare the results of 'available', 'inUse',
+        //:   'match(V)', and 'neverFull' with oracle implementations.  Repeat
+        //:   for data at every offset of a buffer.  (C-1,2)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl32(const bsl::uint8_t *data);
+        //   BitMask available() const;
+        //   BitMask inUse() const;
+        //   BitMask match(bsl::uint8_t value) const;
+        //   bool neverFull() const;
+        //   FlatHashTable_GroupControl64(const bsl::uint8_t *data);
+        //   BitMask available() const;
+        //   BitMask inUse() const;
+        //   BitMask match(bsl::uint8_t value) const;
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WIDE GROUP CONTROLS" << endl
+                          << "===================" << endl;
+
+        ASSERT(32 == Obj32::k_SIZE);
+        ASSERT(64 == Obj64::k_SIZE);
+        ASSERT(EE == Obj32::k_EMPTY);
+        ASSERT(EE == Obj64::k_EMPTY);
+        ASSERT(XX == Obj32::k_ERASED);
+        ASSERT(XX == Obj64::k_ERASED);
+        ASSERT(4 == sizeof(Obj32::BitMask));
+        ASSERT(8 == sizeof(Obj64::BitMask));
+
+        if (verbose) cout << "\nTesting 'FlatHashTable_GroupControl32'."
+                          << endl;
+
+        testWideAccessors<Obj32>(verbose);
+
+        if (verbose) cout << "\nTesting 'FlatHashTable_GroupControl64'."
+                          << endl;
+
+        testWideAccessors<Obj64>(verbose);
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // ACCESSORS
@@ -284,7 +465,7 @@ int main(int argc, char *argv[])
 
             { // depth 0
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    verifyWithOracle(BACKGROUND[bi]);
+                    verifyWithOracle<Obj>(BACKGROUND[bi]);
                 }
             }
             { // depth 1
@@ -295,7 +476,7 @@ int main(int argc, char *argv[])
                     for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
                             data[i] = VALUE[ii];
-                            verifyWithOracle(data);
+                            verifyWithOracle<Obj>(data);
                             data[i] = BACKGROUND[bi][i];
                         }
                     }
@@ -312,7 +493,7 @@ int main(int argc, char *argv[])
                     for (bsl::size_t j = i + 1; j < Obj::k_SIZE; ++j) {
                         for (bsl::size_t jj = 0; jj < NUM_VALUE; ++jj) {
                             data[j] = VALUE[jj];
-                            verifyWithOracle(data);
+                            verifyWithOracle<Obj>(data);
                             data[j] = BACKGROUND[bi][j];
                         }
                     }
@@ -336,7 +517,7 @@ int main(int argc, char *argv[])
                         for (bsl::size_t k = j + 1; k < Obj::k_SIZE; ++k) {
                             for (bsl::size_t kk = 0; kk < NUM_VALUE; ++kk) {
                                 data[k] = VALUE[kk];
-                                verifyWithOracle(data);
+                                verifyWithOracle<Obj>(data);
                                 data[k] = BACKGROUND[bi][k];
                             }
                         }
@@ -366,7 +547,7 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t m = k + 1; m < Obj::k_SIZE; ++m) {
                             for (bsl::size_t mm = 0; mm < NUM_VALUE; ++mm) {
                                 data[m] = VALUE[mm];
-                                verifyWithOracle(data);
+                                verifyWithOracle<Obj>(data);
                                 data[m] = BACKGROUND[bi][m];
                             }
                         }
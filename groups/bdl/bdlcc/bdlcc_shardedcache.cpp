@@ -0,0 +1,186 @@
+// bdlcc_shardedcache.cpp                                             -*-C++-*-
+#include <bdlcc_shardedcache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_shardedcache_cpp,"$Id$ $CSID$")
+
+#include <bsl_climits.h>
+
+///Implementation Notes
+///--------------------
+// The frequency sketch follows the design of the sketch used by the Caffeine
+// library: a table of 64-bit words, each holding 16 4-bit saturating
+// counters.  A hash value is mapped to 4 counters by 4 independent mixes of
+// the hash value, each mix selecting a word (using its low bits) and a counter
+// within the word (using its high bits).  The estimated frequency of a hash
+// value is the minimum of its 4 counters, as in any count-min sketch.
+//
+// The counters are modified with compare-and-swap loops, so that concurrent
+// increments of different counters of the same word are not lost.  Aging
+// (halving every counter) is performed by the thread whose increment reaches
+// the sample size, concurrently with other increments; an increment racing
+// with the halving of its word may be applied before or after the halving,
+// which is immaterial for an approximate frequency.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+const bsls::Types::Uint64 k_SEEDS[4] = {
+    0x9E3779B97F4A7C15ULL,
+    0xC2B2AE3D27D4EB4FULL,
+    0x165667B19E3779F9ULL,
+    0xD6E8FEB86659FD93ULL
+};
+
+const bsls::Types::Uint64 k_HALF_MASK = 0x7777777777777777ULL;
+    // Mask clearing the high bit of each of the 16 counters of a word once the
+    // word is shifted right by one bit.
+
+inline
+bsls::Types::Uint64 mix(bsls::Types::Uint64 value)
+    // Return a hash value obtained by applying the finalization mix of the
+    // 64-bit MurmurHash3 to the specified 'value'.
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+}  // close unnamed namespace
+
+                    // ----------------------------------
+                    // class ShardedCache_FrequencySketch
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+void ShardedCache_FrequencySketch::age()
+{
+    for (bsl::size_t i = 0; i <= d_tableMask; ++i) {
+        bsls::Types::Uint64 word = d_table_p[i].loadRelaxed();
+        for (;;) {
+            const bsls::Types::Uint64 aged = (word >> 1) & k_HALF_MASK;
+            const bsls::Types::Uint64 prev = d_table_p[i].testAndSwap(word,
+                                                                      aged);
+            if (prev == word) {
+                break;
+            }
+            word = prev;
+        }
+    }
+}
+
+// CREATORS
+ShardedCache_FrequencySketch::ShardedCache_FrequencySketch(
+                                            bsl::size_t       capacity,
+                                            bslma::Allocator *basicAllocator)
+: d_table_p(0)
+, d_tableMask(0)
+, d_sampleSize(0)
+, d_numIncrements(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Use one word (16 counters) per item, rounded up to a power of 2.
+
+    bsl::size_t tableSize = 1;
+    while (tableSize < capacity && tableSize < (1u << 30)) {
+        tableSize <<= 1;
+    }
+    d_tableMask = tableSize - 1;
+
+    const bsl::size_t sampleSize = 10 * (capacity ? capacity : 1);
+    d_sampleSize = sampleSize < static_cast<bsl::size_t>(INT_MAX / 2)
+                 ? static_cast<int>(sampleSize)
+                 : INT_MAX / 2;
+
+    d_table_p = static_cast<bsls::AtomicUint64 *>(
+                     d_allocator_p->allocate(tableSize * sizeof *d_table_p));
+    for (bsl::size_t i = 0; i < tableSize; ++i) {
+        new (d_table_p + i) bsls::AtomicUint64(0);
+    }
+}
+
+ShardedCache_FrequencySketch::~ShardedCache_FrequencySketch()
+{
+    // 'bsls::AtomicUint64' is trivially destructible.
+
+    d_allocator_p->deallocate(d_table_p);
+}
+
+// MANIPULATORS
+void ShardedCache_FrequencySketch::clear()
+{
+    for (bsl::size_t i = 0; i <= d_tableMask; ++i) {
+        d_table_p[i].storeRelaxed(0);
+    }
+    d_numIncrements.storeRelaxed(0);
+}
+
+void ShardedCache_FrequencySketch::increment(bsl::size_t hashValue)
+{
+    for (int i = 0; i < 4; ++i) {
+        const bsls::Types::Uint64 hash  = mix(hashValue + k_SEEDS[i]);
+        bsls::AtomicUint64&       word  = d_table_p[hash & d_tableMask];
+        const int                 shift = static_cast<int>(hash >> 60) * 4;
+
+        bsls::Types::Uint64 value = word.loadRelaxed();
+        for (;;) {
+            if (0xF == ((value >> shift) & 0xF)) {
+                break;  // saturated
+            }
+            const bsls::Types::Uint64 prev = word.testAndSwap(
+                                  value,
+                                  value + (static_cast<bsls::Types::Uint64>(1)
+                                                                    << shift));
+            if (prev == value) {
+                break;
+            }
+            value = prev;
+        }
+    }
+
+    if (d_numIncrements.addRelaxed(1) == d_sampleSize) {
+        age();
+        d_numIncrements.addRelaxed(-d_sampleSize / 2);
+    }
+}
+
+// ACCESSORS
+int ShardedCache_FrequencySketch::frequency(bsl::size_t hashValue) const
+{
+    int result = 0xF;
+    for (int i = 0; i < 4; ++i) {
+        const bsls::Types::Uint64 hash  = mix(hashValue + k_SEEDS[i]);
+        const int                 shift = static_cast<int>(hash >> 60) * 4;
+        const int                 count = static_cast<int>(
+                 (d_table_p[hash & d_tableMask].loadRelaxed() >> shift) & 0xF);
+
+        if (count < result) {
+            result = count;
+        }
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1434 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded in-process cache with frequency-based admission.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: sharded in-process key-value cache
+//  bdlcc::ShardedCacheAdmissionPolicy: namespace for admission policies
+//
+//@SEE_ALSO: bdlcc_cache
+//
+//@DESCRIPTION: This component defines a class template, 'bdlcc::ShardedCache',
+// implementing a thread-safe in-memory key-value cache that is partitioned
+// into a number of independently locked shards, and whose read path does not
+// require exclusive access to the cache, regardless of the eviction policy.
+//
+// 'bdlcc::ShardedCache' uses the same template parameters as 'bdlcc::Cache':
+// the key type ('KEY'), the value type ('VALUE'), the optional hash function
+// ('HASH'), and the optional equal function ('EQUAL').  Values are held by
+// 'bsl::shared_ptr', as they are in 'bdlcc::Cache'.
+//
+///Sharding
+///--------
+// The cache is split into a number of shards, specified at construction, each
+// having its own reader-writer lock, hash table, and eviction state.  The
+// shard of a key is determined by the hash value of the key, so that
+// operations on keys belonging to different shards never contend for the same
+// lock.  The capacity specified at construction is divided evenly between the
+// shards (rounding up), and each shard enforces its own share of the capacity,
+// so that eviction may begin before the size of the cache as a whole reaches
+// its capacity if the keys are not evenly distributed between the shards.
+//
+///Eviction Policies
+///-----------------
+// Rather than maintaining an exact eviction queue, which requires a write lock
+// to reorder on every access, each shard approximates the eviction policy
+// with the CLOCK algorithm: the items of a shard are kept in a circular array
+// of slots, each item having a "referenced" bit, and a "clock hand" sweeps the
+// array to find the item to evict, clearing the referenced bits it passes and
+// stopping at the first item whose bit is already clear.
+//
+// With the 'bdlcc::CacheEvictionPolicy::e_LRU' policy, 'tryGetValue' sets the
+// referenced bit of the item it returns, giving recently accessed items a
+// second chance before being evicted.  Setting the bit is a relaxed atomic
+// store, so that 'tryGetValue' needs only a read lock on the shard.  With the
+// 'bdlcc::CacheEvictionPolicy::e_FIFO' policy, the referenced bits are never
+// set, and the items of a shard are evicted in their order of insertion.
+//
+///Admission Policies
+///------------------
+// Two admission policies, enumerated by 'bdlcc::ShardedCacheAdmissionPolicy',
+// are supported.  With 'e_ALWAYS', every inserted item is admitted to the
+// cache, evicting another item if needed, as 'bdlcc::Cache' does.
+//
+// With 'e_TINY_LFU', each shard implements the W-TinyLFU scheme: the accesses
+// to each key (both hits and misses) are recorded in a compact, periodically
+// aged, count-min sketch approximating the frequency of recent accesses to the
+// key.  Newly inserted items are placed in a small FIFO "admission window"
+// (1% of the capacity of the shard, and at least one item), and an item
+// leaving the window is admitted to the main (CLOCK) part of the shard only if
+// its estimated frequency is higher than that of the item the CLOCK algorithm
+// would evict in its place; otherwise the item leaving the window is rejected
+// and removed from the cache.  This prevents a burst of keys that are accessed
+// only once (e.g., a scan) from flushing frequently used items from the cache.
+//
+///Statistics
+///----------
+// The cache counts the number of hits and misses of 'tryGetValue', the number
+// of items evicted from the cache to make room for other items, and the number
+// of items rejected by the admission policy.  The counters are maintained
+// with atomic operations on per-shard counters, and are summed by the
+// corresponding accessors.  Note that removing an item by calling 'erase' or
+// 'clear' is neither an eviction nor a rejection.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.  The thread-safety of the container does not extend to
+// thread-safety of the contained objects.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// When an item is evicted, rejected, or erased from the cache, the previously
+// set post-eviction callback (via the 'setPostEvictionCallback' method) is
+// invoked within the calling thread, supplying a pointer to the item being
+// removed.  As with 'bdlcc::Cache', the write lock of the shard of the item is
+// held during the call to the callback; therefore, the cache object itself
+// must not be used in a post-eviction callback, or a deadlock may result.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Caching Reference Data
+///- - - - - - - - - - - - - - - - -
+// Suppose that we have a service that frequently looks up some reference data
+// (say, the names of securities) identified by an integer, and that a small
+// subset of the identifiers is looked up far more often than the rest.  We
+// cache the data using a 'bdlcc::ShardedCache' that uses the TinyLFU
+// admission policy, so that occasional lookups of the less popular
+// identifiers do not evict the popular ones.
+//
+// First, we define the cache type and a function that computes the value to
+// cache (in practice, for instance, by querying a database):
+//..
+//  typedef bdlcc::ShardedCache<int, bsl::string> NameCache;
+//
+//  bsl::string retrieveName(int id)
+//  {
+//      bsl::ostringstream oss;
+//      oss << "SECURITY-" << id;
+//      return oss.str();
+//  }
+//..
+// Then, we define a function that looks up a name in the cache, and inserts
+// it if it is missing:
+//..
+//  bsl::string lookupName(NameCache *cache, int id)
+//  {
+//      NameCache::ValuePtrType name;
+//      if (0 != cache->tryGetValue(&name, id)) {
+//          cache->insert(id, retrieveName(id));
+//          return retrieveName(id);                                  // RETURN
+//      }
+//      return *name;
+//  }
+//..
+// Next, we create a cache having 4 shards and a capacity of 400 items, using
+// the LRU (approximated by CLOCK) eviction policy and the TinyLFU admission
+// policy:
+//..
+//  NameCache cache(bdlcc::CacheEvictionPolicy::e_LRU,
+//                  bdlcc::ShardedCacheAdmissionPolicy::e_TINY_LFU,
+//                  400,
+//                  4);
+//
+//  assert(400 == cache.capacity());
+//  assert(  4 == cache.numShards());
+//..
+// Then, we look up the 100 popular identifiers a few times each, so that they
+// are cached and their frequency is recorded:
+//..
+//  for (int round = 0; round < 4; ++round) {
+//      for (int id = 0; id < 100; ++id) {
+//          assert(retrieveName(id) == lookupName(&cache, id));
+//      }
+//  }
+//..
+// Next, we look up 1000 other identifiers once each, as a batch job scanning
+// all the securities would:
+//..
+//  for (int id = 1000; id < 2000; ++id) {
+//      assert(retrieveName(id) == lookupName(&cache, id));
+//  }
+//..
+// Now, we observe that the popular identifiers are still in the cache, since
+// the items inserted by the scan were rejected by the admission policy:
+//..
+//  int numCached = 0;
+//  for (int id = 0; id < 100; ++id) {
+//      NameCache::ValuePtrType name;
+//      if (0 == cache.tryGetValue(&name, id)) {
+//          ++numCached;
+//      }
+//  }
+//  assert(100 == numCached);
+//  assert(  0 <  cache.numRejections());
+//..
+// Finally, we observe that the size of the cache never exceeds its capacity:
+//..
+//  assert(cache.size() <= cache.capacity());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_list.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                    // ==================================
+                    // struct ShardedCacheAdmissionPolicy
+                    // ==================================
+
+struct ShardedCacheAdmissionPolicy {
+    // This 'struct' provides a namespace for enumerating the policies deciding
+    // whether a newly inserted item is admitted to a 'bdlcc::ShardedCache'.
+
+    // TYPES
+    enum Enum {
+        e_ALWAYS,    // admit every inserted item
+        e_TINY_LFU   // admit items based on their estimated access frequency
+                     // (W-TinyLFU)
+    };
+};
+
+                    // ==================================
+                    // class ShardedCache_FrequencySketch
+                    // ==================================
+
+class ShardedCache_FrequencySketch {
+    // This component-private class implements a count-min sketch of 4-bit
+    // counters approximating the number of recent occurrences of hash values.
+    // Each hash value is mapped to 4 counters, and its estimated frequency is
+    // the minimum of these counters.  After a number of increments
+    // proportional to the capacity supplied at construction, all the counters
+    // are halved, so that the sketch reflects recent history.  The
+    // 'increment' and 'frequency' methods can be called concurrently.
+
+    // DATA
+    bsls::AtomicUint64 *d_table_p;       // table of 16 4-bit counters per word
+
+    bsl::size_t         d_tableMask;     // number of words in 'd_table_p',
+                                         // minus one
+
+    int                 d_sampleSize;    // number of increments after which
+                                         // the counters are halved
+
+    bsls::AtomicInt     d_numIncrements; // number of increments since the
+                                         // counters were last halved
+
+    bslma::Allocator   *d_allocator_p;   // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_FrequencySketch(const ShardedCache_FrequencySketch&);
+    ShardedCache_FrequencySketch& operator=(
+                                          const ShardedCache_FrequencySketch&);
+
+    // PRIVATE MANIPULATORS
+    void age();
+        // Halve all the counters of this sketch.
+
+  public:
+    // CREATORS
+    explicit ShardedCache_FrequencySketch(
+                                       bsl::size_t       capacity,
+                                       bslma::Allocator *basicAllocator = 0);
+        // Create a sketch suitable for estimating the frequencies of the
+        // specified 'capacity' most frequent hash values.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~ShardedCache_FrequencySketch();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Reset all the counters of this sketch to 0.
+
+    void increment(bsl::size_t hashValue);
+        // Increment the estimated frequency of the specified 'hashValue'.
+
+    // ACCESSORS
+    int frequency(bsl::size_t hashValue) const;
+        // Return the estimated frequency of the specified 'hashValue', in the
+        // range '[0 .. 15]'.
+};
+
+                      // ================================
+                      // class ShardedCache_WindowProctor
+                      // ================================
+
+template <class TYPE>
+class ShardedCache_WindowProctor {
+    // This component-private class implements a proctor that, on
+    // destruction, removes the last element of a list, unless 'release' has
+    // been called.
+
+    // DATA
+    bsl::list<TYPE> *d_list_p;  // list (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_WindowProctor(const ShardedCache_WindowProctor&);
+    ShardedCache_WindowProctor& operator=(const ShardedCache_WindowProctor&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache_WindowProctor(bsl::list<TYPE> *list);
+        // Create a proctor that removes the last element of the specified
+        // 'list' on destruction.  The behavior is undefined unless an element
+        // is appended to 'list' before this proctor is destroyed or
+        // released.
+
+    ~ShardedCache_WindowProctor();
+        // Destroy this proctor, removing the last element of the list
+        // specified on construction, unless 'release' has been called.
+
+    // MANIPULATORS
+    void release();
+        // Release the list specified on construction, so that it will not be
+        // modified on the destruction of this proctor.
+};
+
+                         // ========================
+                         // class ShardedCache_Entry
+                         // ========================
+
+template <class KEY, class VALUE>
+class ShardedCache_Entry {
+    // This component-private class holds the state of an item of a
+    // 'ShardedCache_Shard', i.e., the mapped type of the hash table of the
+    // shard.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<const KEY, ShardedCache_Entry>    Node;
+        // Type of the nodes of the hash table of a shard.
+
+    typedef typename bsl::list<Node *>::iterator        WindowIterator;
+        // Iterator in the admission window of a shard.
+
+    // PUBLIC CONSTANTS
+    static const bsl::size_t k_IN_WINDOW = ~static_cast<bsl::size_t>(0);
+        // Value of 'd_slot' for an item that is in the admission window.
+
+    static const bsl::size_t k_DETACHED  = ~static_cast<bsl::size_t>(1);
+        // Value of 'd_slot' for an item that is neither in the admission
+        // window nor in the CLOCK array.
+
+    // PUBLIC DATA
+    bsl::shared_ptr<VALUE> d_value;       // cached value
+
+    bsl::size_t            d_slot;        // index of the item in the CLOCK
+                                          // array, 'k_IN_WINDOW', or
+                                          // 'k_DETACHED'
+
+    WindowIterator         d_windowIt;    // position in the admission window,
+                                          // if 'k_IN_WINDOW == d_slot'
+
+    bsls::AtomicBool       d_referenced;  // CLOCK referenced bit
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Entry& operator=(const ShardedCache_Entry&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache_Entry(const bsl::shared_ptr<VALUE>& value);
+        // Create an entry holding the specified 'value', that is neither in
+        // the admission window nor in the CLOCK array.
+
+    ShardedCache_Entry(const ShardedCache_Entry& original);
+        // Create an entry having the same state as the specified 'original'.
+};
+
+                         // ========================
+                         // class ShardedCache_Shard
+                         // ========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class ShardedCache_Shard {
+    // This component-private class implements one shard of a
+    // 'bdlcc::ShardedCache': a hash table of items protected by a
+    // reader-writer lock, and the CLOCK and admission state used to choose
+    // the items to evict.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                           ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)>         PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Entry<KEY, VALUE>                   Entry;
+    typedef typename Entry::Node                             Node;
+    typedef bsl::unordered_map<KEY, Entry, HASH, EQUAL>      MapType;
+    typedef bsl::list<Node *>                                WindowType;
+    typedef bslmt::ReaderWriterMutex                         LockType;
+
+    // DATA
+    mutable LockType              d_lock;           // reader-writer lock
+
+    MapType                       d_map;            // hash table storing the
+                                                    // items of this shard
+
+    bsl::vector<Node *>           d_clock;          // CLOCK array of items
+                                                    // (0 for a free slot)
+
+    bsl::vector<bsl::size_t>      d_freeSlots;      // indices of the free
+                                                    // slots of 'd_clock'
+
+    bsl::size_t                   d_hand;           // index of the next slot
+                                                    // examined by the CLOCK
+                                                    // algorithm
+
+    WindowType                    d_window;         // admission window, in
+                                                    // FIFO order
+
+    bsl::size_t                   d_windowCapacity; // maximum number of items
+                                                    // in 'd_window'
+
+    ShardedCache_FrequencySketch  d_sketch;         // access frequencies (only
+                                                    // used with TinyLFU)
+
+    bool                          d_recordAccess;   // 'true' if hits set the
+                                                    // referenced bit (LRU)
+
+    bool                          d_admitByFrequency;
+                                                    // 'true' if using TinyLFU
+
+    const PostEvictionCallback   *d_callback_p;     // post-eviction callback
+                                                    // (held, not owned)
+
+    bsls::AtomicUint64            d_numHits;        // number of hits
+    bsls::AtomicUint64            d_numMisses;      // number of misses
+    bsls::AtomicUint64            d_numEvictions;   // number of evictions
+    bsls::AtomicUint64            d_numRejections;  // number of rejections
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Shard(const ShardedCache_Shard&);
+    ShardedCache_Shard& operator=(const ShardedCache_Shard&);
+
+    // PRIVATE MANIPULATORS
+    void admit(Node *candidate);
+        // Move the specified 'candidate' item, that is either in the
+        // admission window or detached, to the CLOCK array, evicting an item
+        // from the CLOCK array if it is full.  If this shard uses the TinyLFU
+        // admission policy and the estimated frequency of 'candidate' is not
+        // higher than that of the item that would be evicted, remove
+        // 'candidate' from this shard instead.
+
+    bsl::size_t findVictim();
+        // Return the index of the slot of the CLOCK array holding the next
+        // item to evict.  The behavior is undefined unless the CLOCK array is
+        // full.
+
+    void removeItem(const typename MapType::iterator& mapIt);
+        // Remove the item at the specified 'mapIt' from this shard and invoke
+        // the post-eviction callback for that item.
+
+  public:
+    // CREATORS
+    ShardedCache_Shard(
+                      CacheEvictionPolicy::Enum          evictionPolicy,
+                      ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                      bsl::size_t                        capacity,
+                      const HASH&                        hashFunction,
+                      const EQUAL&                       equalFunction,
+                      const PostEvictionCallback        *postEvictionCallback,
+                      bslma::Allocator                  *basicAllocator);
+        // Create an empty shard holding at most the specified 'capacity'
+        // items, using the specified 'evictionPolicy', 'admissionPolicy',
+        // 'hashFunction', and 'equalFunction', and invoking the specified
+        // 'postEvictionCallback' for each item removed.  Use the specified
+        // 'basicAllocator' to supply memory.  The behavior is undefined
+        // unless '1 <= capacity', and '2 <= capacity' if 'admissionPolicy' is
+        // 'e_TINY_LFU'.
+
+    //! ~ShardedCache_Shard() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this shard.  Do *not* invoke the
+        // post-eviction callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this shard.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    void insert(const KEY&          key,
+                bsl::size_t         hashValue,
+                const ValuePtrType& valuePtr);
+        // Insert the specified 'key', having the specified 'hashValue', and
+        // its associated 'valuePtr' into this shard.  If 'key' already
+        // exists, then its value is replaced with 'valuePtr'.
+
+    LockType& lock() const;
+        // Return a reference providing modifiable access to the lock of this
+        // shard.
+
+    int tryGetValue(ValuePtrType *value,
+                    const KEY&    key,
+                    bsl::size_t   hashValue);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key', having the specified 'hashValue', in this shard.
+        // Return 0 on success, and 1 if 'key' does not exist in this shard.
+        // Note that only a read lock is acquired.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this shard.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the hash functor used by this shard.
+
+    bsls::Types::Uint64 numEvictions() const;
+        // Return the number of items evicted from this shard.
+
+    bsls::Types::Uint64 numHits() const;
+        // Return the number of calls to 'tryGetValue' that found their key.
+
+    bsls::Types::Uint64 numMisses() const;
+        // Return the number of calls to 'tryGetValue' that did not find their
+        // key.
+
+    bsls::Types::Uint64 numRejections() const;
+        // Return the number of items rejected by the admission policy of this
+        // shard.
+
+    bsl::size_t size() const;
+        // Return the current number of items in this shard.
+
+    template <class VISITOR>
+    bool visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this shard
+        // until 'visitor' returns 'false'.  Return 'false' if 'visitor'
+        // returned 'false', and 'true' otherwise.
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store partitioned into
+    // independently locked shards, supporting a variety of eviction and
+    // admission policies.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                            ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>       Shard;
+
+    // DATA
+    bslma::Allocator                  *d_allocator_p;   // memory allocator
+                                                        // (held, not owned)
+
+    HASH                               d_hashFunction;  // hash functor used
+                                                        // to select shards
+
+    Shard                             *d_shards_p;      // array of shards
+
+    int                                d_numShards;     // number of shards
+
+    bsl::size_t                        d_capacity;      // maximum number of
+                                                        // items
+
+    CacheEvictionPolicy::Enum          d_evictionPolicy;
+                                                        // eviction policy
+
+    ShardedCacheAdmissionPolicy::Enum  d_admissionPolicy;
+                                                        // admission policy
+
+    PostEvictionCallback               d_postEvictionCallback;
+                                                        // the function to
+                                                        // call after an item
+                                                        // has been removed
+                                                        // from the cache
+
+    // PRIVATE MANIPULATORS
+    void initialize(const EQUAL& equalFunction);
+        // Create the shards of this cache using the specified
+        // 'equalFunction'.
+
+    // PRIVATE ACCESSORS
+    Shard& shard(bsl::size_t hashValue) const;
+        // Return a reference providing modifiable access to the shard of the
+        // keys having the specified 'hashValue'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShardedCache, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    ShardedCache(CacheEvictionPolicy::Enum          evictionPolicy,
+                 ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                 bsl::size_t                        capacity,
+                 int                                numShards,
+                 bslma::Allocator                  *basicAllocator = 0);
+    ShardedCache(CacheEvictionPolicy::Enum          evictionPolicy,
+                 ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                 bsl::size_t                        capacity,
+                 int                                numShards,
+                 const HASH&                        hashFunction,
+                 const EQUAL&                       equalFunction,
+                 bslma::Allocator                  *basicAllocator = 0);
+        // Create an empty cache holding at most (approximately, see
+        // {Sharding}) the specified 'capacity' items divided between the
+        // specified 'numShards' shards, and using the specified
+        // 'evictionPolicy' and 'admissionPolicy'.  Optionally specify a
+        // 'hashFunction' used to generate the hash values for a given key,
+        // and an 'equalFunction' used to determine whether two keys have the
+        // same value.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numShards' and 'numShards <= capacity', and
+        // '2 * numShards <= capacity' if 'admissionPolicy' is 'e_TINY_LFU'.
+
+    ~ShardedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    void insert(const KEY& key, const VALUE& value);
+        // Insert the specified 'key' and its associated 'value' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that, with the TinyLFU admission policy, a newly
+        // inserted item may later be rejected rather than admitted to the
+        // main part of its shard (see {Admission Policies}).
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'valuePtr'.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted, rejected, or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value, const KEY& key);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the eviction policy is LRU, mark
+        // the cached item as recently accessed.  Return 0 on success, and 1
+        // if 'key' does not exist in this cache.  Note that only a read lock
+        // on the shard of 'key' is acquired.
+
+    // ACCESSORS
+    ShardedCacheAdmissionPolicy::Enum admissionPolicy() const;
+        // Return the admission policy used by this cache.
+
+    bsl::size_t capacity() const;
+        // Return the capacity of this cache, as specified at construction.
+
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsls::Types::Uint64 numEvictions() const;
+        // Return the number of items evicted from this cache to make room for
+        // other items.
+
+    bsls::Types::Uint64 numHits() const;
+        // Return the number of calls to 'tryGetValue' that found their key.
+
+    bsls::Types::Uint64 numMisses() const;
+        // Return the number of calls to 'tryGetValue' that did not find their
+        // key.
+
+    bsls::Types::Uint64 numRejections() const;
+        // Return the number of items removed from this cache because they
+        // were rejected by the admission policy.
+
+    int numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the returned
+        // value is not a snapshot of the size at a single point in time if
+        // the cache is modified concurrently.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // one shard at a time and in an unspecified order, until 'visitor'
+        // returns 'false'.  The 'VISITOR' type must be a callable object that
+        // can be invoked in the same way as the function
+        // 'bool (const KEY&, const VALUE&)'.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class ShardedCache_WindowProctor
+                      // --------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ShardedCache_WindowProctor<TYPE>::ShardedCache_WindowProctor(
+                                                        bsl::list<TYPE> *list)
+: d_list_p(list)
+{
+}
+
+template <class TYPE>
+inline
+ShardedCache_WindowProctor<TYPE>::~ShardedCache_WindowProctor()
+{
+    if (d_list_p) {
+        d_list_p->pop_back();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void ShardedCache_WindowProctor<TYPE>::release()
+{
+    d_list_p = 0;
+}
+
+                         // ------------------------
+                         // class ShardedCache_Entry
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+ShardedCache_Entry<KEY, VALUE>::ShardedCache_Entry(
+                                            const bsl::shared_ptr<VALUE>& value)
+: d_value(value)
+, d_slot(k_DETACHED)
+, d_windowIt()
+, d_referenced(false)
+{
+}
+
+template <class KEY, class VALUE>
+inline
+ShardedCache_Entry<KEY, VALUE>::ShardedCache_Entry(
+                                           const ShardedCache_Entry& original)
+: d_value(original.d_value)
+, d_slot(original.d_slot)
+, d_windowIt(original.d_windowIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+                         // ------------------------
+                         // class ShardedCache_Shard
+                         // ------------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::admit(Node *candidate)
+{
+    if (Entry::k_IN_WINDOW == candidate->second.d_slot) {
+        d_window.erase(candidate->second.d_windowIt);
+        candidate->second.d_slot = Entry::k_DETACHED;
+    }
+
+    if (!d_freeSlots.empty()) {
+        const bsl::size_t slot = d_freeSlots.back();
+        d_freeSlots.pop_back();
+
+        candidate->second.d_slot = slot;
+        candidate->second.d_referenced.storeRelaxed(false);
+        d_clock[slot] = candidate;
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t  slot   = findVictim();
+    Node              *victim = d_clock[slot];
+
+    if (d_admitByFrequency) {
+        const HASH& hasher = d_map.hash_function();
+
+        if (d_sketch.frequency(hasher(candidate->first)) <=
+                                    d_sketch.frequency(hasher(victim->first))) {
+            ++d_numRejections;
+            removeItem(d_map.find(candidate->first));
+            return;                                                   // RETURN
+        }
+    }
+
+    ++d_numEvictions;
+    removeItem(d_map.find(victim->first));
+
+    // 'removeItem' returned the slot of 'victim' to the free list.
+
+    BSLS_ASSERT(!d_freeSlots.empty() && slot == d_freeSlots.back());
+    d_freeSlots.pop_back();
+
+    candidate->second.d_slot = slot;
+    candidate->second.d_referenced.storeRelaxed(false);
+    d_clock[slot] = candidate;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::findVictim()
+{
+    BSLS_ASSERT(d_freeSlots.empty());
+
+    // Since every slot is occupied, and the referenced bit of every slot
+    // passed is cleared, this loop terminates after at most two sweeps.
+
+    for (;;) {
+        const bsl::size_t slot = d_hand;
+
+        d_hand = d_hand + 1 == d_clock.size() ? 0 : d_hand + 1;
+
+        Entry& entry = d_clock[slot]->second;
+        if (entry.d_referenced.loadRelaxed()) {
+            entry.d_referenced.storeRelaxed(false);
+        }
+        else {
+            return slot;                                              // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::removeItem(
+                                       const typename MapType::iterator& mapIt)
+{
+    BSLS_ASSERT(mapIt != d_map.end());
+
+    ValuePtrType  value = mapIt->second.d_value;
+    Entry&        entry = mapIt->second;
+
+    if (Entry::k_IN_WINDOW == entry.d_slot) {
+        d_window.erase(entry.d_windowIt);
+    }
+    else if (Entry::k_DETACHED != entry.d_slot) {
+        d_clock[entry.d_slot] = 0;
+        d_freeSlots.push_back(entry.d_slot);
+    }
+    d_map.erase(mapIt);
+
+    if (*d_callback_p) {
+        (*d_callback_p)(value);
+    }
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                      CacheEvictionPolicy::Enum          evictionPolicy,
+                      ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                      bsl::size_t                        capacity,
+                      const HASH&                        hashFunction,
+                      const EQUAL&                       equalFunction,
+                      const PostEvictionCallback        *postEvictionCallback,
+                      bslma::Allocator                  *basicAllocator)
+: d_lock()
+, d_map(0, hashFunction, equalFunction, basicAllocator)
+, d_clock(basicAllocator)
+, d_freeSlots(basicAllocator)
+, d_hand(0)
+, d_window(basicAllocator)
+, d_windowCapacity(0)
+, d_sketch(ShardedCacheAdmissionPolicy::e_TINY_LFU == admissionPolicy
+           ? capacity
+           : 0,
+           basicAllocator)
+, d_recordAccess(CacheEvictionPolicy::e_LRU == evictionPolicy)
+, d_admitByFrequency(ShardedCacheAdmissionPolicy::e_TINY_LFU ==
+                                                              admissionPolicy)
+, d_callback_p(postEvictionCallback)
+{
+    BSLS_ASSERT(1 <= capacity);
+    BSLS_ASSERT(postEvictionCallback);
+
+    if (d_admitByFrequency) {
+        BSLS_ASSERT(2 <= capacity);
+
+        d_windowCapacity = capacity / 100 ? capacity / 100 : 1;
+    }
+
+    const bsl::size_t clockCapacity = capacity - d_windowCapacity;
+
+    d_clock.resize(clockCapacity, 0);
+    d_freeSlots.reserve(clockCapacity);
+    for (bsl::size_t i = clockCapacity; 0 < i; --i) {
+        d_freeSlots.push_back(i - 1);
+    }
+    d_map.reserve(capacity);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_lock);
+
+    d_map.clear();
+    d_window.clear();
+    d_sketch.clear();
+
+    d_freeSlots.clear();
+    for (bsl::size_t i = d_clock.size(); 0 < i; --i) {
+        d_clock[i - 1] = 0;
+        d_freeSlots.push_back(i - 1);
+    }
+    d_hand = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_lock);
+
+    const typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    removeItem(mapIt);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 bsl::size_t         hashValue,
+                                                 const ValuePtrType& valuePtr)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_lock);
+
+    if (d_admitByFrequency) {
+        d_sketch.increment(hashValue);
+    }
+
+    typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt != d_map.end()) {
+        Entry& entry = mapIt->second;
+
+        entry.d_value = valuePtr;
+
+        if (Entry::k_IN_WINDOW == entry.d_slot) {
+            d_window.splice(d_window.end(), d_window, entry.d_windowIt);
+        }
+        else if (d_recordAccess) {
+            entry.d_referenced.storeRelaxed(true);
+        }
+        return;                                                       // RETURN
+    }
+
+    if (0 == d_windowCapacity) {
+        mapIt = d_map.emplace(key, Entry(valuePtr)).first;
+        admit(&*mapIt);
+        return;                                                       // RETURN
+    }
+
+    // Reserve the position of the item in the window first, so that the item
+    // is never in the hash table without being in the window.
+
+    ShardedCache_WindowProctor<Node *> proctor(&d_window);
+
+    d_window.push_back(0);
+    typename WindowType::iterator windowIt = d_window.end();
+    --windowIt;
+
+    mapIt = d_map.emplace(key, Entry(valuePtr)).first;
+    proctor.release();
+
+    Entry& entry     = mapIt->second;
+    entry.d_slot     = Entry::k_IN_WINDOW;
+    entry.d_windowIt = windowIt;
+    *windowIt        = &*mapIt;
+
+    if (d_window.size() > d_windowCapacity) {
+        admit(d_window.front());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::LockType&
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::lock() const
+{
+    return d_lock;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                                    ValuePtrType *value,
+                                                    const KEY&    key,
+                                                    bsl::size_t   hashValue)
+{
+    if (d_admitByFrequency) {
+        d_sketch.increment(hashValue);
+    }
+
+    bslmt::ReadLockGuard<LockType> guard(&d_lock);
+
+    typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        ++d_numMisses;
+        return 1;                                                     // RETURN
+    }
+
+    ++d_numHits;
+
+    Entry& entry = mapIt->second;
+    *value = entry.d_value;
+
+    // Avoid writing to the cache line of the entry if the bit is already set.
+
+    if (d_recordAccess && !entry.d_referenced.loadRelaxed()) {
+        entry.d_referenced.storeRelaxed(true);
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_map.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_map.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    return d_numEvictions;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64 ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    return d_numHits;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    return d_numMisses;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::numRejections() const
+{
+    return d_numRejections;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_lock);
+    return d_map.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+bool ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_lock);
+
+    for (typename MapType::const_iterator mapIt = d_map.begin();
+         mapIt != d_map.end();
+         ++mapIt) {
+        if (!visitor(mapIt->first, *mapIt->second.d_value)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::initialize(
+                                                   const EQUAL& equalFunction)
+{
+    BSLS_ASSERT(1 <= d_numShards);
+    BSLS_ASSERT(static_cast<bsl::size_t>(d_numShards) <= d_capacity);
+    BSLS_ASSERT(ShardedCacheAdmissionPolicy::e_TINY_LFU != d_admissionPolicy
+             || 2 * static_cast<bsl::size_t>(d_numShards) <= d_capacity);
+
+    const bsl::size_t shardCapacity = (d_capacity + d_numShards - 1)
+                                    / d_numShards;
+
+    d_shards_p = static_cast<Shard *>(
+                          d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(d_shards_p,
+                                                            d_allocator_p);
+    bslma::AutoDestructor<Shard>                destructor(d_shards_p);
+
+    for (int i = 0; i < d_numShards; ++i) {
+        new (d_shards_p + i) Shard(d_evictionPolicy,
+                                   d_admissionPolicy,
+                                   shardCapacity,
+                                   d_hashFunction,
+                                   equalFunction,
+                                   &d_postEvictionCallback,
+                                   d_allocator_p);
+        ++destructor;
+    }
+
+    destructor.release();
+    deallocator.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shard(bsl::size_t hashValue) const
+{
+    // Use the high bits of a multiplicative hash, so that the shard does not
+    // depend only on the low bits of 'hashValue', which are also used by the
+    // hash table of the shard.
+
+    const bsls::Types::Uint64 mixed =
+           static_cast<bsls::Types::Uint64>(hashValue) * 0x9E3779B97F4A7C15ULL;
+
+    return d_shards_p[(mixed >> 32) % static_cast<unsigned>(d_numShards)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                           CacheEvictionPolicy::Enum          evictionPolicy,
+                           ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                           bsl::size_t                        capacity,
+                           int                                numShards,
+                           bslma::Allocator                  *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction()
+, d_shards_p(0)
+, d_numShards(numShards)
+, d_capacity(capacity)
+, d_evictionPolicy(evictionPolicy)
+, d_admissionPolicy(admissionPolicy)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    initialize(EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                           CacheEvictionPolicy::Enum          evictionPolicy,
+                           ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                           bsl::size_t                        capacity,
+                           int                                numShards,
+                           const HASH&                        hashFunction,
+                           const EQUAL&                       equalFunction,
+                           bslma::Allocator                  *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction(hashFunction)
+, d_shards_p(0)
+, d_numShards(numShards)
+, d_capacity(capacity)
+, d_evictionPolicy(evictionPolicy)
+, d_admissionPolicy(admissionPolicy)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    initialize(equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::~ShardedCache()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].~Shard();
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return shard(d_hashFunction(key)).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    // Create the value before acquiring the lock of the shard.
+
+    ValuePtrType valuePtr;
+    valuePtr.createInplace(d_allocator_p, value);
+
+    insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    const bsl::size_t hashValue = d_hashFunction(key);
+
+    shard(hashValue).insert(key, hashValue, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    // Every shard refers to 'd_postEvictionCallback' while holding its write
+    // lock, so all of them must be locked to modify it.
+
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].lock().lockWrite();
+    }
+
+    d_postEvictionCallback = postEvictionCallback;
+
+    for (int i = d_numShards; 0 < i; --i) {
+        d_shards_p[i - 1].lock().unlock();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                                 bsl::shared_ptr<VALUE> *value,
+                                                 const KEY&              key)
+{
+    const bsl::size_t hashValue = d_hashFunction(key);
+
+    return shard(hashValue).tryGetValue(value, key, hashValue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCacheAdmissionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::admissionPolicy() const
+{
+    return d_admissionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards_p[0].equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        result += d_shards_p[i].numEvictions();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        result += d_shards_p[i].numHits();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        result += d_shards_p[i].numMisses();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64
+ShardedCache<KEY, VALUE, HASH, EQUAL>::numRejections() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        result += d_shards_p[i].numRejections();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        result += d_shards_p[i].size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        if (!d_shards_p[i].visit(visitor)) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
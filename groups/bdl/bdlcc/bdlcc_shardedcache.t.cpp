@@ -0,0 +1,1214 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// provides an in-memory key-value cache partitioned into independently locked
+// shards, using CLOCK to approximate its eviction policy and supporting a
+// W-TinyLFU admission policy, implemented using the component-private class
+// 'bdlcc::ShardedCache_FrequencySketch'.
+//
+// We first test the frequency sketch in isolation.  We then test the basic
+// manipulators and accessors of the cache, and the eviction and admission
+// policies using caches having a single shard, for which the order of
+// evictions is deterministic.  Finally, we test the statistics, and
+// exercise the cache concurrently from multiple threads.
+// ----------------------------------------------------------------------------
+// ShardedCache_FrequencySketch
+// [ 2] ShardedCache_FrequencySketch(capacity, basicAllocator);
+// [ 2] void clear();
+// [ 2] void increment(bsl::size_t hashValue);
+// [ 2] int frequency(bsl::size_t hashValue) const;
+//
+// ShardedCache
+// CREATORS
+// [ 3] ShardedCache(evict, admit, capacity, numShards, basicAllocator);
+// [ 3] ShardedCache(evict, admit, cap, numShards, hash, equal, alloc);
+// [ 3] ~ShardedCache();
+//
+// MANIPULATORS
+// [ 4] void clear();
+// [ 4] int erase(const KEY& key);
+// [ 4] void insert(const KEY& key, const VALUE& value);
+// [ 4] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 4] int tryGetValue(bsl::shared_ptr<VALUE> *value, const KEY& key);
+//
+// ACCESSORS
+// [ 3] ShardedCacheAdmissionPolicy::Enum admissionPolicy() const;
+// [ 3] bsl::size_t capacity() const;
+// [ 3] EQUAL equalFunction() const;
+// [ 3] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 3] HASH hashFunction() const;
+// [ 7] bsls::Types::Uint64 numEvictions() const;
+// [ 7] bsls::Types::Uint64 numHits() const;
+// [ 7] bsls::Types::Uint64 numMisses() const;
+// [ 7] bsls::Types::Uint64 numRejections() const;
+// [ 3] int numShards() const;
+// [ 4] bsl::size_t size() const;
+// [ 4] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CLOCK EVICTION
+// [ 6] TINYLFU ADMISSION
+// [ 8] CONCURRENCY
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose = false;
+static bool         veryVerbose = false;
+static bool     veryVeryVerbose = false;
+
+typedef bdlcc::ShardedCache<int, int>           Obj;
+typedef bdlcc::ShardedCache_FrequencySketch     Sketch;
+typedef bdlcc::CacheEvictionPolicy              EvictionPolicy;
+typedef bdlcc::ShardedCacheAdmissionPolicy      AdmissionPolicy;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct EvictionRecorder {
+    // This 'struct' provides a post-eviction callback recording the evicted
+    // values.
+
+    // DATA
+    bsl::vector<int> *d_evicted_p;  // evicted values (held, not owned)
+
+    // CREATORS
+    explicit EvictionRecorder(bsl::vector<int> *evicted)
+    : d_evicted_p(evicted)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(const bsl::shared_ptr<int>& value) const
+        // Append the specified 'value' to the recorded values.
+    {
+        d_evicted_p->push_back(*value);
+    }
+};
+
+struct SumVisitor {
+    // This 'struct' provides a visitor summing the keys and values of a
+    // 'ShardedCache<int, int>', stopping after a maximum number of items.
+
+    // DATA
+    int d_keySum;     // sum of the visited keys
+    int d_valueSum;   // sum of the visited values
+    int d_count;      // number of visited items
+    int d_maxCount;   // number of items after which to stop
+
+    // CREATORS
+    explicit SumVisitor(int maxCount)
+    : d_keySum(0)
+    , d_valueSum(0)
+    , d_count(0)
+    , d_maxCount(maxCount)
+    {
+    }
+
+    // MANIPULATORS
+    bool operator()(int key, int value)
+        // Add the specified 'key' and 'value' to the sums, and return 'true'
+        // if fewer than the maximum number of items were visited.
+    {
+        d_keySum   += key;
+        d_valueSum += value;
+        return ++d_count < d_maxCount;
+    }
+};
+
+struct ModHash {
+    // This 'struct' provides a hash functor returning its argument modulo
+    // 1000, consistent with 'ModEqual'.
+
+    // DATA
+    int d_id;  // identifier used to compare functors
+
+    // CREATORS
+    explicit ModHash(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' modulo 1000.
+    {
+        return static_cast<bsl::size_t>(key % 1000);
+    }
+};
+
+struct ModEqual {
+    // This 'struct' provides an equality functor comparing its arguments
+    // modulo 1000.
+
+    // DATA
+    int d_id;  // identifier used to compare functors
+
+    // CREATORS
+    explicit ModEqual(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal modulo
+        // 1000, and 'false' otherwise.
+    {
+        return lhs % 1000 == rhs % 1000;
+    }
+};
+
+bool contains(Obj *cache, int key)
+    // Return 'true' if the specified 'cache' contains the specified 'key', and
+    // 'false' otherwise.  Note that this function accesses 'key'.
+{
+    Obj::ValuePtrType value;
+    return 0 == cache->tryGetValue(&value, key);
+}
+
+void exerciseCache(Obj             *cache,
+                   bslmt::Barrier  *barrier,
+                   bsls::AtomicInt *numGets,
+                   int              seed,
+                   int              numIterations)
+    // Wait on the specified 'barrier', then perform the specified
+    // 'numIterations' random operations on the specified 'cache', using the
+    // specified 'seed' to generate the operations, and add the number of
+    // calls to 'tryGetValue' to the specified 'numGets'.
+{
+    barrier->wait();
+
+    unsigned int state = static_cast<unsigned int>(seed) * 2654435761u + 1;
+    int          gets  = 0;
+
+    for (int i = 0; i < numIterations; ++i) {
+        state = state * 1103515245u + 12345u;
+        const int key = static_cast<int>((state >> 8) % 512);
+        const int op  = static_cast<int>((state >> 24) % 16);
+
+        if (op < 11) {
+            Obj::ValuePtrType value;
+            if (0 == cache->tryGetValue(&value, key)) {
+                ASSERTV(key, *value, key == *value);
+            }
+            ++gets;
+        }
+        else if (op < 15) {
+            cache->insert(key, key);
+        }
+        else {
+            cache->erase(key);
+        }
+    }
+
+    numGets->add(gets);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Caching Reference Data
+///- - - - - - - - - - - - - - - - -
+// Suppose that we have a service that frequently looks up some reference data
+// (say, the names of securities) identified by an integer, and that a small
+// subset of the identifiers is looked up far more often than the rest.  We
+// cache the data using a 'bdlcc::ShardedCache' that uses the TinyLFU
+// admission policy, so that occasional lookups of the less popular
+// identifiers do not evict the popular ones.
+//
+// First, we define the cache type and a function that computes the value to
+// cache (in practice, for instance, by querying a database):
+//..
+    typedef bdlcc::ShardedCache<int, bsl::string> NameCache;
+
+    bsl::string retrieveName(int id)
+    {
+        bsl::ostringstream oss;
+        oss << "SECURITY-" << id;
+        return oss.str();
+    }
+//..
+// Then, we define a function that looks up a name in the cache, and inserts
+// it if it is missing:
+//..
+    bsl::string lookupName(NameCache *cache, int id)
+    {
+        NameCache::ValuePtrType name;
+        if (0 != cache->tryGetValue(&name, id)) {
+            cache->insert(id, retrieveName(id));
+            return retrieveName(id);                                  // RETURN
+        }
+        return *name;
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Next, we create a cache having 4 shards and a capacity of 400 items, using
+// the LRU (approximated by CLOCK) eviction policy and the TinyLFU admission
+// policy:
+//..
+    NameCache cache(bdlcc::CacheEvictionPolicy::e_LRU,
+                    bdlcc::ShardedCacheAdmissionPolicy::e_TINY_LFU,
+                    400,
+                    4);
+
+    ASSERT(400 == cache.capacity());
+    ASSERT(  4 == cache.numShards());
+//..
+// Then, we look up the 100 popular identifiers a few times each, so that they
+// are cached and their frequency is recorded:
+//..
+    for (int round = 0; round < 4; ++round) {
+        for (int id = 0; id < 100; ++id) {
+            ASSERT(retrieveName(id) == lookupName(&cache, id));
+        }
+    }
+//..
+// Next, we look up 1000 other identifiers once each, as a batch job scanning
+// all the securities would:
+//..
+    for (int id = 1000; id < 2000; ++id) {
+        ASSERT(retrieveName(id) == lookupName(&cache, id));
+    }
+//..
+// Now, we observe that the popular identifiers are still in the cache, since
+// the items inserted by the scan were rejected by the admission policy:
+//..
+    int numCached = 0;
+    for (int id = 0; id < 100; ++id) {
+        NameCache::ValuePtrType name;
+        if (0 == cache.tryGetValue(&name, id)) {
+            ++numCached;
+        }
+    }
+    ASSERT(100 == numCached);
+    ASSERT(  0 <  cache.numRejections());
+//..
+// Finally, we observe that the size of the cache never exceeds its capacity:
+//..
+    ASSERT(cache.size() <= cache.capacity());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The cache can be used concurrently from multiple threads, with
+        //:   every combination of policies.
+        //:
+        //: 2 The values obtained by 'tryGetValue' are those inserted for the
+        //:   key.
+        //:
+        //: 3 The size of each shard never exceeds its share of the capacity.
+        //:
+        //: 4 Every call to 'tryGetValue' is counted as either a hit or a miss.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For every combination of policies, create a cache having 8
+        //:   shards, and have several threads perform random insertions,
+        //:   lookups, and removals, inserting only values equal to their key.
+        //:   Verify the values found, the final size of the cache, the
+        //:   statistics, and that all the memory is released.  (C-1..5)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 50000 };
+
+        const EvictionPolicy::Enum  EVICTIONS[]  = { EvictionPolicy::e_LRU,
+                                                     EvictionPolicy::e_FIFO };
+        const AdmissionPolicy::Enum ADMISSIONS[] = {
+                                                 AdmissionPolicy::e_ALWAYS,
+                                                 AdmissionPolicy::e_TINY_LFU };
+
+        for (int ei = 0; ei < 2; ++ei) {
+            for (int ai = 0; ai < 2; ++ai) {
+                if (veryVerbose) { T_ P_(ei) P(ai) }
+
+                {
+                    Obj mX(EVICTIONS[ei], ADMISSIONS[ai], 128, 8, &ta);
+                    const Obj& X = mX;
+
+                    bslmt::Barrier  barrier(k_NUM_THREADS);
+                    bsls::AtomicInt numGets(0);
+
+                    bslmt::ThreadGroup threads(&ta);
+                    for (int i = 0; i < k_NUM_THREADS; ++i) {
+                        threads.addThread(bdlf::BindUtil::bind(
+                                     &exerciseCache,
+                                     &mX,
+                                     &barrier,
+                                     &numGets,
+                                     i + 4 * ei + 8 * ai,
+                                     static_cast<int>(k_NUM_ITERATIONS)));
+                    }
+                    threads.joinAll();
+
+                    ASSERTV(X.size(), X.size() <= 128);
+                    ASSERTV(numGets, X.numHits(), X.numMisses(),
+                            static_cast<bsls::Types::Uint64>(numGets) ==
+                                                 X.numHits() + X.numMisses());
+                    ASSERTV(X.numEvictions() + X.numRejections(),
+                            0 < X.numEvictions() + X.numRejections());
+                }
+                ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // STATISTICS
+        //
+        // Concerns:
+        //: 1 'numHits' and 'numMisses' count the calls to 'tryGetValue' that
+        //:   did and did not find their key, respectively.
+        //:
+        //: 2 'numEvictions' counts the items evicted to make room for other
+        //:   items, and 'numRejections' the items rejected by the admission
+        //:   policy.
+        //:
+        //: 3 Removing items with 'erase' and 'clear' is neither an eviction
+        //:   nor a rejection.
+        //:
+        //: 4 The statistics are summed over all the shards.
+        //
+        // Plan:
+        //: 1 Using caches having several shards, perform a sequence of
+        //:   operations and verify the statistics after each step.  (C-1..4)
+        //
+        // Testing:
+        //   bsls::Types::Uint64 numEvictions() const;
+        //   bsls::Types::Uint64 numHits() const;
+        //   bsls::Types::Uint64 numMisses() const;
+        //   bsls::Types::Uint64 numRejections() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATISTICS" << endl
+                          << "==========" << endl;
+
+        {
+            Obj mX(EvictionPolicy::e_LRU, AdmissionPolicy::e_ALWAYS, 16, 4,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(0 == X.numHits());
+            ASSERT(0 == X.numMisses());
+            ASSERT(0 == X.numEvictions());
+            ASSERT(0 == X.numRejections());
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, !contains(&mX, i));
+                mX.insert(i, i);
+            }
+            ASSERTV(X.numMisses(), 10 == X.numMisses());
+            ASSERTV(X.numHits(),    0 == X.numHits());
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, contains(&mX, i));
+            }
+            ASSERTV(X.numMisses(), 10 == X.numMisses());
+            ASSERTV(X.numHits(),   10 == X.numHits());
+
+            mX.erase(3);
+            mX.clear();
+            ASSERT(0 == X.numEvictions());
+            ASSERT(0 == X.numRejections());
+
+            // Each shard holds at most 4 items, so inserting 1000 distinct
+            // keys evicts all but at most 16 of them.
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERTV(X.size(), X.numEvictions(),
+                    1000 == X.size() + X.numEvictions());
+            ASSERT(0 == X.numRejections());
+        }
+        {
+            Obj mX(EvictionPolicy::e_LRU, AdmissionPolicy::e_TINY_LFU, 400, 4,
+                   &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 10000; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERTV(X.size(), X.numEvictions(), X.numRejections(),
+                    10000 == X.size() + X.numEvictions() + X.numRejections());
+            ASSERTV(X.numRejections(), 0 < X.numRejections());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TINYLFU ADMISSION
+        //
+        // Concerns:
+        //: 1 With the TinyLFU admission policy, a new item is placed in the
+        //:   admission window, and is admitted to the CLOCK array when it
+        //:   leaves the window if there is a free slot.
+        //:
+        //: 2 If the CLOCK array is full, an item leaving the window is
+        //:   admitted only if it is accessed more frequently than the item
+        //:   that would be evicted in its place, and is otherwise rejected
+        //:   (invoking the post-eviction callback).
+        //:
+        //: 3 A frequently accessed item is not evicted by a scan of items
+        //:   accessed once, whereas it is with the 'e_ALWAYS' policy.
+        //
+        // Plan:
+        //: 1 Using a cache having a single shard of capacity 4 (an admission
+        //:   window of 1 item and a CLOCK array of 3 items), insert and
+        //:   access items so as to control their frequency, and verify the
+        //:   items evicted or rejected.  (C-1..2)
+        //:
+        //: 2 Using caches with both admission policies, access a set of items
+        //:   repeatedly, then scan many other items, and verify which of the
+        //:   frequently accessed items remain in the cache.  (C-3)
+        //
+        // Testing:
+        //   TINYLFU ADMISSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TINYLFU ADMISSION" << endl
+                          << "=================" << endl;
+
+        if (verbose) cout << "\tAdmission and rejection." << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+
+            Obj mX(EvictionPolicy::e_LRU, AdmissionPolicy::e_TINY_LFU, 4, 1,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            // Fill the CLOCK array with 0, 1, and 2, and the window with 3.
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, i * 10);
+            }
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERT(evicted.empty());
+
+            // Make 0, 1, and 2 frequent.
+
+            for (int round = 0; round < 4; ++round) {
+                for (int i = 0; i < 3; ++i) {
+                    ASSERTV(round, i, contains(&mX, i));
+                }
+            }
+
+            // Inserting 4 pushes 3, which is infrequent, out of the window,
+            // and 3 is rejected.
+
+            mX.insert(4, 40);
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], 30 == evicted[0]);
+            ASSERTV(X.numRejections(), 1 == X.numRejections());
+            ASSERTV(X.numEvictions(),  0 == X.numEvictions());
+
+            // Make 4 more frequent than the items in the CLOCK array, then
+            // push it out of the window: it is admitted, evicting one of 0,
+            // 1, and 2.
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, contains(&mX, 4));
+            }
+            mX.insert(5, 50);
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERTV(evicted.size(), 2 == evicted.size());
+            ASSERTV(evicted[1], 0 == evicted[1] % 10 && evicted[1] < 30);
+            ASSERTV(X.numRejections(), 1 == X.numRejections());
+            ASSERTV(X.numEvictions(),  1 == X.numEvictions());
+            ASSERT(contains(&mX, 4));
+            ASSERT(contains(&mX, 5));
+        }
+
+        if (verbose) cout << "\tScan resistance." << endl;
+        {
+            const AdmissionPolicy::Enum POLICIES[] = {
+                                                 AdmissionPolicy::e_ALWAYS,
+                                                 AdmissionPolicy::e_TINY_LFU };
+
+            for (int pi = 0; pi < 2; ++pi) {
+                Obj mX(EvictionPolicy::e_LRU, POLICIES[pi], 100, 1, &ta);
+
+                for (int round = 0; round < 5; ++round) {
+                    for (int i = 0; i < 50; ++i) {
+                        if (!contains(&mX, i)) {
+                            mX.insert(i, i);
+                        }
+                    }
+                }
+                for (int i = 1000; i < 1500; ++i) {
+                    if (!contains(&mX, i)) {
+                        mX.insert(i, i);
+                    }
+                }
+
+                int numCached = 0;
+                for (int i = 0; i < 50; ++i) {
+                    numCached += contains(&mX, i);
+                }
+
+                if (veryVerbose) { T_ P_(pi) P(numCached) }
+
+                if (AdmissionPolicy::e_TINY_LFU == POLICIES[pi]) {
+                    ASSERTV(numCached, 50 == numCached);
+                }
+                else {
+                    ASSERTV(numCached, 0 == numCached);
+                }
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION
+        //
+        // Concerns:
+        //: 1 When a shard is full, inserting a new item evicts an existing
+        //:   item and invokes the post-eviction callback for it.
+        //:
+        //: 2 With the FIFO policy, items are evicted in their order of
+        //:   insertion, regardless of accesses.
+        //:
+        //: 3 With the LRU policy, an item accessed since the clock hand last
+        //:   passed it is given a second chance.
+        //:
+        //: 4 Replacing the value of an existing item does not evict.
+        //
+        // Plan:
+        //: 1 Using caches having a single shard of capacity 4 and the
+        //:   'e_ALWAYS' admission policy, insert and access items, and verify
+        //:   the evicted values.  (C-1..4)
+        //
+        // Testing:
+        //   CLOCK EVICTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION" << endl
+                          << "==============" << endl;
+
+        if (verbose) cout << "\tFIFO." << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+
+            Obj mX(EvictionPolicy::e_FIFO, AdmissionPolicy::e_ALWAYS, 4, 1,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(contains(&mX, 0));
+            ASSERT(contains(&mX, 1));
+
+            mX.insert(3, 33);
+            ASSERT(evicted.empty());
+
+            mX.insert(4, 4);
+            mX.insert(5, 5);
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERTV(evicted.size(), 2 == evicted.size());
+            ASSERTV(evicted[0], 0 == evicted[0]);
+            ASSERTV(evicted[1], 1 == evicted[1]);
+            ASSERTV(X.numEvictions(), 2 == X.numEvictions());
+        }
+
+        if (verbose) cout << "\tLRU." << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+
+            Obj mX(EvictionPolicy::e_LRU, AdmissionPolicy::e_ALWAYS, 4, 1,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(contains(&mX, 0));
+
+            mX.insert(4, 4);
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], 1 == evicted[0]);
+
+            mX.insert(5, 5);
+            ASSERTV(evicted.size(), 2 == evicted.size());
+            ASSERTV(evicted[1], 2 == evicted[1]);
+
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERT( contains(&mX, 0));
+            ASSERT(!contains(&mX, 1));
+            ASSERT(!contains(&mX, 2));
+            ASSERT( contains(&mX, 3));
+            ASSERT( contains(&mX, 4));
+            ASSERT( contains(&mX, 5));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'insert' adds an item, or replaces the value of an existing item,
+        //:   and 'tryGetValue' finds the value of an item.
+        //:
+        //: 2 'erase' removes an item, invokes the post-eviction callback, and
+        //:   returns 1 if the key is not found.
+        //:
+        //: 3 'clear' removes all the items without invoking the post-eviction
+        //:   callback, and the cache is usable afterwards.
+        //:
+        //: 4 'visit' visits every item until the visitor returns 'false'.
+        //:
+        //: 5 All memory is supplied by the allocator specified at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Using caches having several shards and large enough capacities
+        //:   not to evict, perform a sequence of operations and verify the
+        //:   content of the cache after each step.  (C-1..5)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   int tryGetValue(bsl::shared_ptr<VALUE> *value, const KEY& key);
+        //   bsl::size_t size() const;
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC MANIPULATORS" << endl
+                          << "==================" << endl;
+
+        const AdmissionPolicy::Enum POLICIES[] = {
+                                                 AdmissionPolicy::e_ALWAYS,
+                                                 AdmissionPolicy::e_TINY_LFU };
+
+        for (int pi = 0; pi < 2; ++pi) {
+            if (veryVerbose) { T_ P(pi) }
+
+            bsl::vector<int> evicted(&ta);
+
+            Obj mX(EvictionPolicy::e_LRU, POLICIES[pi], 1000, 8, &ta);
+            const Obj& X = mX;
+
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            ASSERT(0 == X.size());
+            ASSERT(!contains(&mX, 1));
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i, i * 2);
+            }
+            ASSERTV(X.size(), 100 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                Obj::ValuePtrType value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+                ASSERTV(i, value && i * 2 == *value);
+            }
+
+            mX.insert(7, 70);
+            mX.insert(8, bsl::allocate_shared<int>(&ta, 80));
+            ASSERTV(X.size(), 100 == X.size());
+            {
+                Obj::ValuePtrType value;
+                ASSERT(0 == mX.tryGetValue(&value, 7));
+                ASSERT(70 == *value);
+                ASSERT(0 == mX.tryGetValue(&value, 8));
+                ASSERT(80 == *value);
+            }
+
+            SumVisitor all(1000);
+            X.visit(all);
+            ASSERTV(all.d_count,  100      == all.d_count);
+            ASSERTV(all.d_keySum, 99 * 50  == all.d_keySum);
+            ASSERTV(all.d_valueSum,
+                    99 * 100 - 14 - 16 + 70 + 80 == all.d_valueSum);
+
+            SumVisitor some(10);
+            X.visit(some);
+            ASSERTV(some.d_count, 10 == some.d_count);
+
+            ASSERT(evicted.empty());
+
+            ASSERT(0 == mX.erase(5));
+            ASSERT(1 == mX.erase(5));
+            ASSERT(!contains(&mX, 5));
+            ASSERTV(X.size(), 99 == X.size());
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], 10 == evicted[0]);
+
+            mX.clear();
+            ASSERTV(X.size(), 0 == X.size());
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERT(!contains(&mX, 1));
+
+            mX.insert(1, 1);
+            ASSERT(1 == X.size());
+            ASSERT(contains(&mX, 1));
+
+            ASSERTV(defaultAllocator.numBlocksTotal(),
+                    0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors create an empty cache with the specified
+        //:   policies, capacity, number of shards, and functors.
+        //:
+        //: 2 The supplied hash and equality functors are used.
+        //:
+        //: 3 The allocator specified at construction is used, and all memory
+        //:   is released on destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create caches with both constructors and several combinations of
+        //:   arguments, and verify the accessors.  (C-1, 3)
+        //:
+        //: 2 Create a cache whose equality functor compares keys modulo 1000,
+        //:   and verify that keys equal modulo 1000 are found.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ShardedCache(evict, admit, capacity, numShards, basicAllocator);
+        //   ShardedCache(evict, admit, cap, numShards, hash, equal, alloc);
+        //   ~ShardedCache();
+        //   ShardedCacheAdmissionPolicy::Enum admissionPolicy() const;
+        //   bsl::size_t capacity() const;
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   int numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        const EvictionPolicy::Enum  LRU  = EvictionPolicy::e_LRU;
+        const EvictionPolicy::Enum  FIFO = EvictionPolicy::e_FIFO;
+        const AdmissionPolicy::Enum ALL  = AdmissionPolicy::e_ALWAYS;
+        const AdmissionPolicy::Enum LFU  = AdmissionPolicy::e_TINY_LFU;
+
+        const struct {
+            int                    d_line;
+            EvictionPolicy::Enum   d_eviction;
+            AdmissionPolicy::Enum  d_admission;
+            bsl::size_t            d_capacity;
+            int                    d_numShards;
+        } DATA[] = {
+            //LINE  EVICT  ADMIT  CAPACITY  SHARDS
+            //----  -----  -----  --------  ------
+            { L_,   LRU,   ALL,          1,      1 },
+            { L_,   FIFO,  ALL,         10,      3 },
+            { L_,   LRU,   LFU,          2,      1 },
+            { L_,   FIFO,  LFU,       1000,     16 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                   LINE       = DATA[ti].d_line;
+            const EvictionPolicy::Enum  EVICTION   = DATA[ti].d_eviction;
+            const AdmissionPolicy::Enum ADMISSION  = DATA[ti].d_admission;
+            const bsl::size_t           CAPACITY   = DATA[ti].d_capacity;
+            const int                   NUM_SHARDS = DATA[ti].d_numShards;
+
+            if (veryVerbose) { T_ P_(LINE) P_(CAPACITY) P(NUM_SHARDS) }
+
+            {
+                Obj mX(EVICTION, ADMISSION, CAPACITY, NUM_SHARDS, &ta);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, EVICTION   == X.evictionPolicy());
+                ASSERTV(LINE, ADMISSION  == X.admissionPolicy());
+                ASSERTV(LINE, CAPACITY   == X.capacity());
+                ASSERTV(LINE, NUM_SHARDS == X.numShards());
+                ASSERTV(LINE, 0          == X.size());
+                ASSERTV(LINE, 0          <  ta.numBlocksInUse());
+
+                mX.insert(1, 1);
+                ASSERTV(LINE, 1 == X.size());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tFunctors." << endl;
+        {
+            typedef bdlcc::ShardedCache<int, int, ModHash, ModEqual> ObjF;
+
+            ObjF mX(EvictionPolicy::e_LRU,
+                    AdmissionPolicy::e_ALWAYS,
+                    100,
+                    4,
+                    ModHash(7),
+                    ModEqual(9),
+                    &ta);
+            const ObjF& X = mX;
+
+            ASSERT(7 == X.hashFunction().d_id);
+            ASSERT(9 == X.equalFunction().d_id);
+
+            for (int i = 0; i < 20; ++i) {
+                mX.insert(i, i);
+            }
+            for (int i = 0; i < 20; ++i) {
+                ObjF::ValuePtrType value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i + 1000));
+                ASSERTV(i, value && i == *value);
+            }
+            ASSERT(0 == mX.erase(2005));
+            ASSERTV(X.size(), 19 == X.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(EvictionPolicy::e_LRU,
+                            AdmissionPolicy::e_ALWAYS, 1, 1, &ta));
+            ASSERT_FAIL(Obj(EvictionPolicy::e_LRU,
+                            AdmissionPolicy::e_ALWAYS, 1, 0, &ta));
+            ASSERT_FAIL(Obj(EvictionPolicy::e_LRU,
+                            AdmissionPolicy::e_ALWAYS, 1, 2, &ta));
+            ASSERT_PASS(Obj(EvictionPolicy::e_LRU,
+                            AdmissionPolicy::e_TINY_LFU, 2, 1, &ta));
+            ASSERT_FAIL(Obj(EvictionPolicy::e_LRU,
+                            AdmissionPolicy::e_TINY_LFU, 1, 1, &ta));
+            ASSERT_FAIL(Obj(EvictionPolicy::e_LRU,
+                            AdmissionPolicy::e_TINY_LFU, 3, 2, &ta));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FREQUENCY SKETCH
+        //
+        // Concerns:
+        //: 1 The estimated frequency of a hash value is 0 initially, and
+        //:   increases with each increment until saturating at 15.
+        //:
+        //: 2 The estimated frequency of a hash value is not smaller than the
+        //:   number of increments of that value (before aging).
+        //:
+        //: 3 After a number of increments proportional to the capacity, all
+        //:   the frequencies are halved.
+        //:
+        //: 4 'clear' resets all the frequencies to 0.
+        //:
+        //: 5 All memory is supplied by the specified allocator, and released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Increment hash values a known number of times and verify the
+        //:   estimated frequencies.  (C-1..2)
+        //:
+        //: 2 Increment a hash value, then increment many other values to
+        //:   trigger aging, and verify that the frequency of the first value
+        //:   decreased.  (C-3)
+        //:
+        //: 3 Call 'clear' and verify the frequencies.  (C-4)
+        //:
+        //: 4 Use a test allocator and verify its use.  (C-5)
+        //
+        // Testing:
+        //   ShardedCache_FrequencySketch(capacity, basicAllocator);
+        //   void clear();
+        //   void increment(bsl::size_t hashValue);
+        //   int frequency(bsl::size_t hashValue) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FREQUENCY SKETCH" << endl
+                          << "================" << endl;
+
+        {
+            Sketch mX(1000, &ta);
+            const Sketch& X = mX;
+
+            ASSERT(0 < ta.numBlocksInUse());
+
+            for (bsl::size_t h = 0; h < 100; ++h) {
+                ASSERTV(h, 0 == X.frequency(h));
+            }
+
+            for (int i = 1; i <= 20; ++i) {
+                mX.increment(42);
+                ASSERTV(i, X.frequency(42),
+                        (i < 15 ? i : 15) == X.frequency(42));
+            }
+
+            for (bsl::size_t h = 0; h < 200; ++h) {
+                for (bsl::size_t i = 0; i < h % 5; ++i) {
+                    mX.increment(h * 7919 + 1);
+                }
+            }
+            for (bsl::size_t h = 0; h < 200; ++h) {
+                ASSERTV(h, static_cast<int>(h % 5) <=
+                                                 X.frequency(h * 7919 + 1));
+            }
+
+            mX.clear();
+            ASSERTV(X.frequency(42), 0 == X.frequency(42));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tAging." << endl;
+        {
+            Sketch mX(16, &ta);
+            const Sketch& X = mX;
+
+            for (int i = 0; i < 12; ++i) {
+                mX.increment(7);
+            }
+            const int before = X.frequency(7);
+            ASSERTV(before, 12 <= before);
+
+            // The sample size is 10 times the capacity, i.e., 160.
+
+            for (bsl::size_t h = 0; h < 160; ++h) {
+                mX.increment(1000 + h);
+            }
+            const int after = X.frequency(7);
+            ASSERTV(before, after, after < before);
+            ASSERTV(before, after, before / 2 <= after);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a cache, insert, look up, and erase some items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(EvictionPolicy::e_LRU, AdmissionPolicy::e_TINY_LFU, 64, 4,
+               &ta);
+        const Obj& X = mX;
+
+        for (int i = 0; i < 32; ++i) {
+            mX.insert(i, i * i);
+        }
+        ASSERTV(X.size(), 32 == X.size());
+
+        for (int i = 0; i < 32; ++i) {
+            Obj::ValuePtrType value;
+            ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+            ASSERTV(i, i * i == *value);
+        }
+
+        ASSERT(0 == mX.erase(3));
+        ASSERT(!contains(&mX, 3));
+
+        for (int i = 100; i < 1000; ++i) {
+            mX.insert(i, i);
+        }
+        ASSERTV(X.size(), X.size() <= 64);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
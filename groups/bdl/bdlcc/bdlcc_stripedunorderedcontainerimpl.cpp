@@ -19,6 +19,111 @@ BSLS_IDENT_RCSID(bdlcc_stripedunorderedcontainerimpl,"$Id$ $CSID$")
 // table, but the stripes are locked one at a time.
 //
 // The number of stripes must not be bigger than the number of buckets.
+//
+// In 'e_READ_LOCK_FREE' mode, 'getValue' and 'visitReadOnly(key, visitor)'
+// traverse a bucket without locking.  Writers still serialize on the stripe
+// locks, and maintain the following invariants so that readers need no
+// synchronization beyond that provided by
+// 'StripedUnorderedContainerImpl_EpochManager':
+//: o A node is fully constructed before it is linked (release store), and
+//:   its key and value are never modified afterward; updates replace the node
+//:   by a modified copy ("copy on write").
+//:
+//: o An unlinked node keeps its pointer to its successor, and is destroyed
+//:   only once every reader that may have reached it has left (see
+//:   'StripedUnorderedContainerImpl_EpochManager::tryAdvance').  Unlinked
+//:   nodes are held in one list per stripe, under the write lock of the
+//:   stripe, so that writers of different stripes do not contend; the epoch
+//:   is advanced only once every several retirements, as this requires
+//:   scanning all the reader counts.
+//:
+//: o 'rehash' and 'clear', which relink or destroy every node and reallocate
+//:   the bucket array, first suspend lock-free readers and wait for the
+//:   registered ones to leave; readers arriving meanwhile fall back to the
+//:   stripe locks.
+
+#include <bslmt_threadutil.h>
+
+#include <bslma_default.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+            // ------------------------------------------------
+            // class StripedUnorderedContainerImpl_EpochManager
+            // ------------------------------------------------
+
+// CREATORS
+StripedUnorderedContainerImpl_EpochManager::
+                                    StripedUnorderedContainerImpl_EpochManager(
+                                              bsl::size_t       numSlots,
+                                              bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_numSuspensions(0)
+, d_slotMask(numSlots - 1)
+, d_counts_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numSlots);
+    BSLS_ASSERT(0 == (numSlots & (numSlots - 1)));
+
+    bsl::size_t numCounts = numSlots * k_SLOT_SIZE;
+    d_counts_p = static_cast<bsls::AtomicInt *>(
+                 d_allocator_p->allocate(numCounts * sizeof(bsls::AtomicInt)));
+    for (bsl::size_t i = 0; i < numCounts; ++i) {
+        new (d_counts_p + i) bsls::AtomicInt(0);
+    }
+}
+
+StripedUnorderedContainerImpl_EpochManager::
+                                  ~StripedUnorderedContainerImpl_EpochManager()
+{
+    // 'bsls::AtomicInt' is trivially destructible.
+
+    d_allocator_p->deallocate(d_counts_p);
+}
+
+// MANIPULATORS
+void StripedUnorderedContainerImpl_EpochManager::suspendReaders()
+{
+    // The increment is a sequentially consistent read-modify-write, so a
+    // reader that registers after we find its count to be 0 will observe the
+    // suspension (and leave) before reading the hash table.
+
+    ++d_numSuspensions;
+
+    bsl::size_t numSlots = d_slotMask + 1;
+    for (bsl::size_t i = 0; i < numSlots; ++i) {
+        for (int parity = 0; parity < 2; ++parity) {
+            const bsls::AtomicInt& count =
+                                         d_counts_p[i * k_SLOT_SIZE + parity];
+            while (0 != count.load()) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+}
+
+bool StripedUnorderedContainerImpl_EpochManager::tryAdvance()
+{
+    unsigned int epoch     = d_epoch.load();
+    int          oldParity = static_cast<int>((epoch + 1) & 1);
+
+    bsl::size_t numSlots = d_slotMask + 1;
+    for (bsl::size_t i = 0; i < numSlots; ++i) {
+        if (0 != d_counts_p[i * k_SLOT_SIZE + oldParity].load()) {
+            return false;                                             // RETURN
+        }
+    }
+
+    // Writers of different stripes may call this method concurrently; only
+    // one of them advances a given epoch.
+
+    return epoch == d_epoch.testAndSwap(epoch, epoch + 1);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
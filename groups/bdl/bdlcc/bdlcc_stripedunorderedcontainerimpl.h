@@ -90,6 +90,17 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Lock-Free Reads
+///---------------
+// A container constructed with the 'e_READ_LOCK_FREE' read mode performs
+// 'getValue' and 'visitReadOnly(key, visitor)' without locking.  Readers
+// register with a 'bdlcc::StripedUnorderedContainerImpl_EpochManager' for
+// the duration of the lookup, writers never modify a node that is linked
+// into a bucket (updates replace the node by a modified copy), and unlinked
+// nodes are destroyed only once no registered reader may be accessing them.
+// 'rehash' and 'clear' suspend lock-free readers, which then fall back to the
+// stripe read locks.  See {'bdlcc_stripedunorderedmap'|Lock-Free Reads}.
+//
 ///Usage
 ///-----
 // There is no usage example for this component since it is not meant for
@@ -106,17 +117,22 @@ BSLS_IDENT("$Id: $")
 
 #include <bslma_allocator.h>
 #include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 #include <bslma_destructionutil.h>
 #include <bslma_destructorproctor.h>
 #include <bslma_rawdeleterproctor.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_assert.h>
+#include <bslmf_iscopyconstructible.h>
 #include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_platform.h>
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
@@ -124,6 +140,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_libraryfeatures.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>   // BSLS_PLATFORM_CPU_X86_64
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>     // 'NULL'
@@ -159,8 +176,11 @@ class StripedUnorderedContainerImpl_Node {
 
   private:
     // DATA
-    mutable StripedUnorderedContainerImpl_Node *d_next_p;
-        // Pointer to next element of the bucket
+    bsls::AtomicPointer<StripedUnorderedContainerImpl_Node>
+                                       d_next_p;
+        // Pointer to next element of the bucket; stored with release and
+        // loaded with acquire semantics, so that lock-free readers always
+        // observe fully constructed nodes
 
     bsls::ObjectBuffer<KEY>            d_key;
         // footprint of key
@@ -212,9 +232,6 @@ class StripedUnorderedContainerImpl_Node {
         // Destroy this object.
 
     // MANIPULATORS
-    StripedUnorderedContainerImpl_Node **nextAddress();
-        // Return the address of the pointer to the next node.
-
     void setNext(StripedUnorderedContainerImpl_Node *nextPtr);
         // Set this node's pointer-to-next-node to the specified 'nextPtr'.
 
@@ -256,8 +273,10 @@ class StripedUnorderedContainerImpl_Bucket {
         // movable references.
 
     // DATA
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *d_head_p;
-        // Pointer to the first element in the bucket
+    bsls::AtomicPointer<StripedUnorderedContainerImpl_Node<KEY, VALUE> >
+                                                    d_head_p;
+        // Pointer to the first element in the bucket; stored with release and
+        // loaded with acquire semantics (see 'StripedUnorderedContainerImpl')
 
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *d_tail_p;
         // Pointer to the last element in the bucket
@@ -314,13 +333,23 @@ class StripedUnorderedContainerImpl_Bucket {
     void clear();
         // Empty 'StripedUnorderedContainerImpl_Bucket' and delete all nodes.
 
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> **headAddress();
-        // Return the address of the head (node) of this bucket list.
-
     void incrementSize(int amount);
         // Increment the 'size' attribute of this bucket by the specified
         // 'amount'.
 
+    void replaceNode(StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevNode,
+                     StripedUnorderedContainerImpl_Node<KEY, VALUE> *node,
+                     StripedUnorderedContainerImpl_Node<KEY, VALUE> *newNode);
+        // Replace, in this bucket, the specified 'node' by the specified
+        // 'newNode', where the specified 'prevNode' is the node preceding
+        // 'node', or 0 if 'node' is the head of this bucket.  'newNode' is
+        // linked to the successor of 'node' before it is itself linked into
+        // the bucket, so that a concurrent lock-free reader observes either
+        // 'node' or 'newNode', but always a well-formed list.  The behavior is
+        // undefined unless 'newNode' is not part of any bucket.  Note that
+        // 'node' is not destroyed, and its pointer to the next node is left
+        // unchanged.
+
     void setHead(StripedUnorderedContainerImpl_Node<KEY, VALUE> *value);
         // Set the address of the head of this bucket list to the specified
         // 'value'.
@@ -354,7 +383,9 @@ class StripedUnorderedContainerImpl_Bucket {
         // 'key', the selection of "first" is unspecified and subject to
         // change.  Also note that specifying 'e_BUCKETSCOPE_FIRST' is more
         // performant when there is a single element in the bucket having
-        // 'key'.
+        // 'key'.  Also note that existing values are assigned in place, so
+        // this method must not be used on a bucket that may be read without
+        // locking.
 
     template <class EQUAL>
     bsl::size_t setValue(const KEY&               key,
@@ -368,7 +399,9 @@ class StripedUnorderedContainerImpl_Bucket {
         // Return the number of elements found having 'key' that had their
         // value set.  Note that, when there are multiple elements having
         // 'key', the selection of "first" is unspecified and subject to
-        // change.
+        // change.  Also note that an existing value is assigned in place, so
+        // this method must not be used on a bucket that may be read without
+        // locking.
 
     // ACCESSORS
     bool empty() const;
@@ -400,6 +433,11 @@ class StripedUnorderedContainerImpl_TestUtil;
 class StripedUnorderedContainerImpl_LockElement;
 class StripedUnorderedContainerImpl_LockElementReadGuard;
 class StripedUnorderedContainerImpl_LockElementWriteGuard;
+class StripedUnorderedContainerImpl_EpochManager;
+class StripedUnorderedContainerImpl_EpochGuard;
+
+template <class KEY, class VALUE>
+class StripedUnorderedContainerImpl_RetireList;
 
                      // ===================================
                      // class StripedUnorderedContainerImpl
@@ -417,6 +455,14 @@ class StripedUnorderedContainerImpl {
         k_DEFAULT_NUM_STRIPES  =  4  // Default # of stripes
     };
 
+    enum ReadMode {
+        // Enumeration of the synchronization used by 'getValue' and
+        // 'visitReadOnly(key, visitor)' (see {Lock-Free Reads}).
+
+        e_READ_LOCKED    = 0,  // Acquire the read lock of the stripe.
+        e_READ_LOCK_FREE = 1   // Traverse the bucket without locking.
+    };
+
     typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
         // Node in a bucket.
 
@@ -463,7 +509,9 @@ class StripedUnorderedContainerImpl {
         k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
                                             bslmt::Platform::e_CACHE_LINE_SIZE,
         // Cacheline size to use; may be 1 or 2 cachelines
-        k_INT_PADDING = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt)
+        k_INT_PADDING = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt),
+        k_MIN_NUM_READER_SLOTS = 16
+        // Minimum number of slots tracking lock-free readers
     };
 
     enum Multiplicity {
@@ -490,6 +538,14 @@ class StripedUnorderedContainerImpl {
     typedef StripedUnorderedContainerImpl_LockElement           LockElement;
     typedef StripedUnorderedContainerImpl_LockElementReadGuard  LERGuard;
     typedef StripedUnorderedContainerImpl_LockElementWriteGuard LEWGuard;
+    typedef StripedUnorderedContainerImpl_EpochManager          EpochManager;
+    typedef StripedUnorderedContainerImpl_EpochGuard            EpochGuard;
+    typedef StripedUnorderedContainerImpl_RetireList<KEY, VALUE> RetireList;
+
+    typedef Node *(*CloneNodeFunction)(const Node&       node,
+                                       bslma::Allocator *allocator);
+        // 'CloneNodeFunction' is an alias for a pointer to a function
+        // returning a copy of a node (see 'cloneNode').
 
     // DATA
     bsl::size_t                       d_numStripes;
@@ -533,6 +589,20 @@ class StripedUnorderedContainerImpl {
         // Pointer to an array of locks for the stripes.  Note that mutex can't
         // be moved or copied, hence can't be in a vector.
 
+    EpochManager                     *d_epochManager_p;
+        // tracker of lock-free readers (owned), or 0 unless the read mode is
+        // 'e_READ_LOCK_FREE'
+
+    CloneNodeFunction                 d_cloneNode_p;
+        // function copying the nodes updated by a visitor, or 0 unless the
+        // read mode is 'e_READ_LOCK_FREE'
+
+    RetireList                       *d_retireLists_p;
+        // Pointer to an array of 'd_numStripes' lists of the nodes unlinked
+        // from the buckets of each stripe and awaiting destruction, or 0
+        // unless the read mode is 'e_READ_LOCK_FREE'.  A list is protected by
+        // the write lock of its stripe.
+
     bslma::Allocator                 *d_allocator_p;
         // memory allocator (held, not owned)
 
@@ -557,6 +627,13 @@ class StripedUnorderedContainerImpl {
         // integer that is a power of 2 that is greater than or equal
         // 'numBuckets', 'numStripes', and 2.
 
+    static Node *cloneNode(const Node& node, bslma::Allocator *allocator);
+        // Return the address of a new node, allocated and having its key and
+        // value supplied by the specified 'allocator', having the key and
+        // value of the specified 'node'.  Note that this function is
+        // instantiated only by the constructor taking a 'ReadMode', hence
+        // 'VALUE' need not be copy-constructible otherwise.
+
     static bsl::size_t powerCeil(bsl::size_t num);
         // Return the nearest higher power of 2 for the specified 'num'.
 
@@ -565,7 +642,17 @@ class StripedUnorderedContainerImpl {
         // Perform a rehash if the 'loadFactor() > maxLoadFactor()', and
         // 'true == canRehash()'.
 
-    bsl::size_t erase(const KEY& key, Scope scope);
+    void deleteNode(
+               Node                                                   *node,
+               const StripedUnorderedContainerImpl_Bucket<KEY, VALUE> *bucket);
+        // Destroy the specified 'node', which has been unlinked from the
+        // specified 'bucket', and deallocate its memory.  If the read mode is
+        // 'e_READ_LOCK_FREE', destruction is deferred until no lock-free
+        // reader can be accessing 'node'.  The behavior is undefined unless
+        // the calling thread holds the write lock of the stripe of 'bucket'.
+
+    template <class LOOKUP_KEY>
+    bsl::size_t erase(const LOOKUP_KEY& key, Scope scope);
         // Remove from this hash map the element, if any, having the specified
         // 'key'.  If there a multiple elements having 'key' and the specified
         // 'scope' is 'e_SCOPE_ALL', erase them all; otherwise; erase just the
@@ -662,6 +749,24 @@ class StripedUnorderedContainerImpl {
         // 'visitor' are unspecified and subject to change.  Also note that a
         // return value of '0' implies that an element was inserted.
 
+    bsl::size_t setValueInBucket(
+                     StripedUnorderedContainerImpl_Bucket<KEY, VALUE> *bucket,
+                     const KEY&                                        key,
+                     const VALUE&                                      value,
+                     Scope                                             scope);
+    bsl::size_t setValueInBucket(
+                     StripedUnorderedContainerImpl_Bucket<KEY, VALUE> *bucket,
+                     const KEY&                                        key,
+                     bslmf::MovableRef<VALUE>                          value);
+        // Set the value attribute of the first element (or, if the optionally
+        // specified 'scope' is 'e_SCOPE_ALL', of every element) in the
+        // specified 'bucket' having the specified 'key' to the specified
+        // 'value'.  If no such element exists, append '(key, value)' to
+        // 'bucket'.  Return the number of elements found having 'key'.  If
+        // the read mode is 'e_READ_LOCK_FREE', each element found is replaced
+        // by a new node instead of being assigned in place.  The behavior is
+        // undefined unless the stripe of 'bucket' is locked for write.
+
     bsl::size_t setValue(const KEY&   key,
                          const VALUE& value,
                          Scope        scope);
@@ -684,8 +789,25 @@ class StripedUnorderedContainerImpl {
         // note that specifying 'e_SCOPE_FIRST' is more performant when there
         // is a single element in the bucket having 'key'.
 
+    bool visitNode(StripedUnorderedContainerImpl_Bucket<KEY, VALUE>  *bucket,
+                   Node                                              *prevNode,
+                   Node                                             **nodePtr,
+                   const VisitorFunction&                             visitor,
+                   const KEY&                                         key);
+        // Invoke the specified 'visitor' passing the address of the value of
+        // the specified '*nodePtr' node of the specified 'bucket', and the
+        // specified 'key', and return the value returned by 'visitor'.  If
+        // the read mode is 'e_READ_LOCK_FREE', 'visitor' is applied to a copy
+        // of '*nodePtr', which then replaces '*nodePtr' in 'bucket' (the
+        // specified 'prevNode' being its predecessor, or 0 if it is the head),
+        // and '*nodePtr' is loaded with the address of that copy.  The
+        // behavior is undefined unless the stripe of 'bucket' is locked for
+        // write.
+
     // PRIVATE ACCESSORS
-    bsl::size_t bucketIndex(const KEY& key, bsl::size_t numBuckets) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t bucketIndex(const LOOKUP_KEY& key,
+                            bsl::size_t       numBuckets) const;
         // Return the index of the bucket, in the array of buckets maintained
         // by this hash map, where values having a key equivalent to the
         // specified 'key' would be inserted using the specified 'numBuckets'.
@@ -703,13 +825,24 @@ class StripedUnorderedContainerImpl {
         // number of elements found with 'key'.  Note that the order of the
         // values returned is not specified.
 
-    LockElement *lockRead(bsl::size_t *bucketIdx, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    Node *lockFreeHead(const LOOKUP_KEY& key) const;
+        // Return the first node of the bucket where elements having the
+        // specified 'key' are stored, without locking the related stripe.
+        // The behavior is undefined unless the calling thread is registered
+        // as a lock-free reader (see 'EpochGuard').
+
+    template <class LOOKUP_KEY>
+    LockElement *lockRead(bsl::size_t       *bucketIdx,
+                          const LOOKUP_KEY&  key) const;
         // Lock for read the stripe related to the specified 'key', setting the
         // specified 'bucketIdx' to the bucket index associated with 'key'.
         // Return the address to the lock-element associated with the returned
         // 'bucketIdx'.
 
-    LockElement *lockWrite(bsl::size_t *bucketIdx, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    LockElement *lockWrite(bsl::size_t       *bucketIdx,
+                           const LOOKUP_KEY&  key) const;
         // Lock for write the stripe related to the specified 'key', setting
         // the specified 'bucketIdx' to the bucket index associated with 'key'.
         // Return the address to the lock-element associated with the returned
@@ -730,6 +863,19 @@ class StripedUnorderedContainerImpl {
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.  The hash map has rehash enabled.
 
+    StripedUnorderedContainerImpl(bsl::size_t       numInitialBuckets,
+                                  bsl::size_t       numStripes,
+                                  ReadMode          readMode,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedContainerImpl' object having the
+        // specified 'numInitialBuckets' minimum number of buckets, the
+        // specified 'numStripes' number of stripes, and using the specified
+        // 'readMode' synchronization for lookups (see {Lock-Free Reads}).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The hash map has rehash enabled.  This constructor does not
+        // compile unless 'VALUE' is copy-constructible.
+
     ~StripedUnorderedContainerImpl();
         // Destroy this hash map.  This method is *not* thread-safe.
 
@@ -749,9 +895,13 @@ class StripedUnorderedContainerImpl {
         // factor to its current value) will trigger a rehash if needed but
         // otherwise does not change the hash map.
 
-    bsl::size_t eraseAll(const KEY& key);
+    template <class LOOKUP_KEY>
+    bsl::size_t eraseAll(const LOOKUP_KEY& key);
         // Erase from this hash map the elements having the specified 'key'.
-        // Return the number of elements erased.
+        // Return the number of elements erased.  Note that 'LOOKUP_KEY' is
+        // 'KEY' unless 'HASH' and 'EQUAL' are transparent (see
+        // 'bslmf::IsTransparentPredicate'), in which case no 'KEY' object is
+        // created.
 
     template <class RANDOM_ITER>
     bsl::size_t eraseBulkAll(RANDOM_ITER first, RANDOM_ITER last);
@@ -776,11 +926,13 @@ class StripedUnorderedContainerImpl {
         // elements removed.  The behavior is undefined unless 'first <= last'.
         // Note that the map may not have an element for every value in 'keys'.
 
-    bsl::size_t eraseFirst(const KEY& key);
+    template <class LOOKUP_KEY>
+    bsl::size_t eraseFirst(const LOOKUP_KEY& key);
         // Erase from this hash map the *first* element (of possibly many)
         // found to the specified 'key'.  Return the number of elements erased.
         // Note that method is more performant than 'eraseAll' when there is
-        // one element having 'key'.
+        // one element having 'key'.  Also note that 'LOOKUP_KEY' is 'KEY'
+        // unless 'HASH' and 'EQUAL' are transparent.
 
     void insertAlways(const KEY& key, const VALUE& value);
         // Insert into this hash map an element having the specified 'key' and
@@ -975,11 +1127,13 @@ class StripedUnorderedContainerImpl {
         // 'visitor', as it may lead to a deadlock.
 
     // ACCESSORS
-    bsl::size_t bucketIndex(const KEY& key) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t bucketIndex(const LOOKUP_KEY& key) const;
         // Return the index of the bucket, in the array of buckets maintained
         // by this hash map, where elements having the specified 'key' are
         // inserted.  Note that unless rehash is disabled, the value returned
-        // may be obsolete at the time it is returned.
+        // may be obsolete at the time it is returned.  Also note that
+        // 'LOOKUP_KEY' is 'KEY' unless 'HASH' and 'EQUAL' are transparent.
 
     bsl::size_t bucketCount() const;
         // Return the number of buckets in the array of buckets maintained by
@@ -1005,14 +1159,17 @@ class StripedUnorderedContainerImpl {
         // that returns 'true' if two 'KEY' objects have the same value, and
         // 'false' otherwise.
 
-    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t getValue(VALUE *value, const LOOKUP_KEY& key) const;
         // Load, into the specified '*value', the value attribute of the first
         // element (of possibly many elements) found in this hash map having
         // the specified 'key'.  Return 1 on success, and 0 if 'key' does not
         // exist in this hash.  Note that the return value equals the number of
         // values returned.  Also note that, when there are multiple elements
         // having 'key', the selection of "first" is implementation specific
-        // and subject to change.
+        // and subject to change.  Also note that 'LOOKUP_KEY' is 'KEY' unless
+        // 'HASH' and 'EQUAL' are transparent, in which case no 'KEY' object
+        // is created.
 
     bsl::size_t getValue(bsl::vector<VALUE> *valuesPtr, const KEY& key) const;
     bsl::size_t getValue(std::vector<VALUE> *valuesPtr, const KEY& key) const;
@@ -1049,6 +1206,9 @@ class StripedUnorderedContainerImpl {
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
+    ReadMode readMode() const;
+        // Return the synchronization used by lookups in this hash map.
+
     int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
         // Call the specified 'visitor' (in an unspecified order) on the
         // elements in this hash table until each element has been visited or
@@ -1067,7 +1227,8 @@ class StripedUnorderedContainerImpl {
         // within 'visitor', as it may lead to a deadlock.  Note that 'visitor'
         // can *not* change the value of the visited elements.
 
-    int visitReadOnly(const KEY&                     key,
+    template <class LOOKUP_KEY>
+    int visitReadOnly(const LOOKUP_KEY&              key,
                       const ReadOnlyVisitorFunction& visitor) const;
         // Serially call the specified 'visitor' on each element (if one
         // exists) in this hash map having the specified 'key' until every such
@@ -1080,7 +1241,9 @@ class StripedUnorderedContainerImpl {
         // if visitations stopped because 'visitor' returned 'false'.
         // 'visitor' has read-only access to each element for duration of each
         // invocation.  The behavior is undefined if hash map manipulators are
-        // invoked from within 'visitor', as it may lead to a deadlock.
+        // invoked from within 'visitor', as it may lead to a deadlock.  Note
+        // that the key passed to 'visitor' is that of the element, and that
+        // 'LOOKUP_KEY' is 'KEY' unless 'HASH' and 'EQUAL' are transparent.
 
     bsl::size_t size() const;
         // Return the current number of elements in this hash.
@@ -1251,6 +1414,257 @@ class StripedUnorderedContainerImpl_LockElementWriteGuard {
         // Release the guarded object
 };
 
+              // ================================================
+              // class StripedUnorderedContainerImpl_EpochManager
+              // ================================================
+
+class StripedUnorderedContainerImpl_EpochManager {
+    // This class tracks the threads reading a striped hash map without
+    // locking, so that writers can determine when memory that such readers
+    // may still be accessing can be reclaimed.  A reader registers itself for
+    // the duration of a lookup by calling 'enter', and unregisters by calling
+    // 'leave'.  Readers are counted in an array of cache-line-padded slots,
+    // selected by hashing the identifier of the reading thread, so that
+    // concurrent readers of the same stripe do not contend on a common cache
+    // line.  Each slot keeps one count for each parity of a global epoch
+    // number.  A writer may advance the epoch ('tryAdvance') only when no
+    // reader is registered under the parity of the epoch preceding the
+    // current one; hence, once the epoch has advanced twice, every reader
+    // that might have observed a node unlinked before the first advance has
+    // left.  'suspendReaders' provides a stronger barrier, used by
+    // operations that restructure the whole hash table.
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+    #if BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
+        k_PREFETCH_ENABLED = 1,
+    #else
+        k_PREFETCH_ENABLED = 0,
+    #endif
+        // Can be 0 or 1; if prefetch, we use 2 cachelines at a time
+        k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
+                                            bslmt::Platform::e_CACHE_LINE_SIZE,
+        // Cacheline size to use; may be 1 or 2 cachelines
+        k_SLOT_SIZE = k_EFFECTIVE_CACHELINE_SIZE / sizeof(bsls::AtomicInt)
+        // Number of 'bsls::AtomicInt' objects per (padded) slot
+    };
+
+    // DATA
+    bsls::AtomicUint  d_epoch;
+        // current epoch number
+
+    bsls::AtomicInt   d_numSuspensions;
+        // number of pending 'suspendReaders' calls; readers may not register
+        // unless 0
+
+    bsl::size_t       d_slotMask;
+        // number of slots - 1; the number of slots is a power of 2
+
+    bsls::AtomicInt  *d_counts_p;
+        // array of reader counts; the two counts of slot 'i' are at indices
+        // 'i * k_SLOT_SIZE' (even epochs) and 'i * k_SLOT_SIZE + 1' (odd
+        // epochs)
+
+    bslma::Allocator *d_allocator_p;
+        // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_EpochManager(
+                            const StripedUnorderedContainerImpl_EpochManager&);
+                                                                    // = delete
+    StripedUnorderedContainerImpl_EpochManager& operator=(
+                            const StripedUnorderedContainerImpl_EpochManager&);
+                                                                    // = delete
+
+  public:
+    // CREATORS
+    explicit StripedUnorderedContainerImpl_EpochManager(
+                                       bsl::size_t       numSlots,
+                                       bslma::Allocator *basicAllocator = 0);
+        // Create a 'StripedUnorderedContainerImpl_EpochManager' object having
+        // the specified 'numSlots' reader slots.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'numSlots' is a power of 2.
+
+    ~StripedUnorderedContainerImpl_EpochManager();
+        // Destroy this object.  The behavior is undefined unless no reader is
+        // registered.
+
+    // MANIPULATORS
+    bsls::AtomicInt *enter();
+        // Register the calling thread as a lock-free reader, and return the
+        // address of the count to be supplied to 'leave' when the read is
+        // done.  Return 0, without registering, if readers are suspended
+        // (see 'suspendReaders').
+
+    void leave(bsls::AtomicInt *count);
+        // Unregister the calling thread as a lock-free reader, where the
+        // specified 'count' was returned by the matching call to 'enter'.
+
+    void resumeReaders();
+        // Cancel the effect of one previous call to 'suspendReaders'.
+
+    void suspendReaders();
+        // Prevent threads from registering as lock-free readers until the
+        // matching call to 'resumeReaders', and block until every reader
+        // registered at the time of the call has left.  The behavior is
+        // undefined if the calling thread is itself registered.
+
+    bool tryAdvance();
+        // Advance the epoch if no reader is registered under the epoch
+        // preceding the current one.  Return 'true' if the epoch was advanced
+        // by this call, and 'false' otherwise.  Note that this method may be
+        // called concurrently: a call fails if another one advanced the epoch
+        // first.
+
+    // ACCESSORS
+    unsigned int epoch() const;
+        // Return the current epoch number.  Note that the epoch numbers wrap
+        // around, so only their differences are meaningful.
+};
+
+               // ==============================================
+               // class StripedUnorderedContainerImpl_EpochGuard
+               // ==============================================
+
+class StripedUnorderedContainerImpl_EpochGuard {
+    // A guard pattern on 'StripedUnorderedContainerImpl_EpochManager', that
+    // registers the calling thread as a lock-free reader on construction and
+    // unregisters it on destruction.
+
+  private:
+    // DATA
+    StripedUnorderedContainerImpl_EpochManager *d_manager_p;
+        // guarded epoch manager, or 0 if not registered
+
+    bsls::AtomicInt                            *d_count_p;
+        // reader count supplied to 'leave'
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_EpochGuard(
+                              const StripedUnorderedContainerImpl_EpochGuard&);
+                                                                    // = delete
+    StripedUnorderedContainerImpl_EpochGuard& operator=(
+                              const StripedUnorderedContainerImpl_EpochGuard&);
+                                                                    // = delete
+
+  public:
+    // CREATORS
+    explicit StripedUnorderedContainerImpl_EpochGuard(
+                         StripedUnorderedContainerImpl_EpochManager *manager);
+        // Create a guard object that registers the calling thread as a
+        // lock-free reader of the specified 'manager', if 'manager' is not 0
+        // and readers are not suspended.
+
+    ~StripedUnorderedContainerImpl_EpochGuard();
+        // Unregister the calling thread, if registered by this guard.
+
+    // ACCESSORS
+    bool isEntered() const;
+        // Return 'true' if this guard registered the calling thread as a
+        // lock-free reader, and 'false' otherwise.
+};
+
+              // ===============================================
+              // class StripedUnorderedContainerImpl_RetireList
+              // ===============================================
+
+template <class KEY, class VALUE>
+class StripedUnorderedContainerImpl_RetireList {
+    // This class holds the nodes unlinked from the buckets of one stripe of a
+    // hash map read without locking, until no lock-free reader can be
+    // accessing them.  Each node is tagged with the epoch of a
+    // 'StripedUnorderedContainerImpl_EpochManager' at the time it is retired,
+    // and is destroyed once that epoch has advanced twice.  To amortize the
+    // cost of scanning the reader counts, the epoch is advanced, and the
+    // eligible nodes destroyed, only once every 'k_ADVANCE_INTERVAL'
+    // retirements.  Objects of this class are padded to cache-line size, as
+    // there is one per stripe.  This class is *not* thread-safe: it is
+    // protected by the write lock of its stripe.
+
+  private:
+    // PRIVATE TYPES
+    typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
+
+    struct RetiredNode {
+        // A node awaiting destruction, and the epoch at its retirement.
+
+        Node         *d_node_p;
+        unsigned int  d_epoch;
+    };
+
+    typedef bsl::vector<RetiredNode> RetiredNodes;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_ADVANCE_INTERVAL = 64,
+        // Number of retirements between two attempts to advance the epoch
+    #if BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
+        k_PREFETCH_ENABLED = 1,
+    #else
+        k_PREFETCH_ENABLED = 0,
+    #endif
+        // Can be 0 or 1; if prefetch, we use 2 cachelines at a time
+        k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
+                                            bslmt::Platform::e_CACHE_LINE_SIZE,
+        // Cacheline size to use; may be 1 or 2 cachelines
+        k_DATA_SIZE = sizeof(RetiredNodes) + sizeof(int) +
+                                                    sizeof(bslma::Allocator *),
+        // Size of the data members, excluding the padding
+        k_PADDING = k_EFFECTIVE_CACHELINE_SIZE -
+                                       k_DATA_SIZE % k_EFFECTIVE_CACHELINE_SIZE
+        // Size of the padding
+    };
+
+    // DATA
+    RetiredNodes      d_nodes;
+        // retired nodes, in order of retirement (hence of epoch)
+
+    int               d_numUntilAdvance;
+        // number of retirements until the next attempt to advance the epoch
+
+    bslma::Allocator *d_allocator_p;
+        // memory allocator of the nodes (held, not owned)
+
+    const char        d_pad[k_PADDING];
+        // padding, so that each object has its own cache lines
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_RetireList(
+                              const StripedUnorderedContainerImpl_RetireList&);
+                                                                    // = delete
+    StripedUnorderedContainerImpl_RetireList& operator=(
+                              const StripedUnorderedContainerImpl_RetireList&);
+                                                                    // = delete
+
+  public:
+    // CREATORS
+    explicit StripedUnorderedContainerImpl_RetireList(
+                                             bslma::Allocator *basicAllocator);
+        // Create an empty 'StripedUnorderedContainerImpl_RetireList' object
+        // destroying the retired nodes using, and supplying memory from, the
+        // specified 'basicAllocator'.
+
+    ~StripedUnorderedContainerImpl_RetireList();
+        // Destroy this object and the nodes it holds.  The behavior is
+        // undefined unless no lock-free reader can be accessing these nodes.
+
+    // MANIPULATORS
+    void clear();
+        // Destroy the nodes held by this object.  The behavior is undefined
+        // unless no lock-free reader can be accessing these nodes.
+
+    void retire(Node                                       *node,
+                StripedUnorderedContainerImpl_EpochManager *epochManager);
+        // Hold the specified 'node', which has been unlinked from its bucket
+        // and was allocated by the allocator supplied at construction, until
+        // no lock-free reader registered with the specified 'epochManager'
+        // can be accessing it, and destroy the nodes held that no such reader
+        // can be accessing any longer.
+};
+
 struct StripedUnorderedContainerImpl_SortItem {
     // A vector element needed for efficient sorting for the 'insertBulk' and
     // 'eraseBulk' methods.
@@ -1352,20 +1766,12 @@ StripedUnorderedContainerImpl_Node<KEY, VALUE>::
 
 
 // MANIPULATORS
-template <class KEY, class VALUE>
-inline
-StripedUnorderedContainerImpl_Node<KEY, VALUE> **
-                  StripedUnorderedContainerImpl_Node<KEY, VALUE>::nextAddress()
-{
-    return &d_next_p;
-}
-
 template <class KEY, class VALUE>
 inline
 void StripedUnorderedContainerImpl_Node<KEY, VALUE>::setNext(
                        StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr)
 {
-    d_next_p = nextPtr;
+    d_next_p.storeRelease(nextPtr);
 }
 
 template <class KEY, class VALUE>
@@ -1388,7 +1794,7 @@ inline
 StripedUnorderedContainerImpl_Node<KEY, VALUE> *
                    StripedUnorderedContainerImpl_Node<KEY, VALUE>::next() const
 {
-    return d_next_p;
+    return d_next_p.loadAcquire();
 }
 
 template <class KEY, class VALUE>
@@ -1432,12 +1838,12 @@ StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::
            bslmf::MovableRef<StripedUnorderedContainerImpl_Bucket<KEY, VALUE> >
                                                                       original,
            bslma::Allocator                                          *)
-: d_head_p(MoveUtil::move(MoveUtil::access(original).d_head_p))
+: d_head_p(MoveUtil::access(original).d_head_p.loadRelaxed())
 , d_tail_p(MoveUtil::move(MoveUtil::access(original).d_tail_p))
 , d_size(  MoveUtil::access(original).d_size)
 , d_allocator_p(MoveUtil::access(original).d_allocator_p)
 {
-    MoveUtil::access(original).d_head_p = NULL;
+    MoveUtil::access(original).d_head_p.storeRelaxed(NULL);
     MoveUtil::access(original).d_tail_p = NULL;
     MoveUtil::access(original).d_size   = 0;
 }
@@ -1458,8 +1864,8 @@ void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::addNode(
 {
     BSLS_ASSERT(nodePtr->next() == NULL);
 
-    if (d_head_p == NULL) {
-        d_head_p = nodePtr;
+    if (d_head_p.loadRelaxed() == NULL) {
+        d_head_p.storeRelease(nodePtr);
     }
     else {
         d_tail_p->setNext(nodePtr);
@@ -1473,32 +1879,46 @@ inline
 void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::clear()
 {
     // Delete all content in a loop
-    for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
-                                                            curNode != NULL;) {
+    for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
+                                  d_head_p.loadRelaxed(); curNode != NULL;) {
         StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr =
                                                                curNode->next();
         d_allocator_p->deleteObject(curNode);
         curNode = nextPtr;
     }
-    d_head_p = NULL;
+    d_head_p.storeRelaxed(NULL);
     d_tail_p = NULL;
     d_size = 0;
 }
 
 template <class KEY, class VALUE>
 inline
-StripedUnorderedContainerImpl_Node<KEY, VALUE>
-              **StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::headAddress()
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::incrementSize(
+                                                                    int amount)
 {
-    return &d_head_p;
+    d_size += amount;
 }
 
 template <class KEY, class VALUE>
 inline
-void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::incrementSize(
-                                                                    int amount)
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::replaceNode(
+                      StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevNode,
+                      StripedUnorderedContainerImpl_Node<KEY, VALUE> *node,
+                      StripedUnorderedContainerImpl_Node<KEY, VALUE> *newNode)
 {
-    d_size += amount;
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(newNode);
+
+    newNode->setNext(node->next());
+    if (prevNode) {
+        prevNode->setNext(newNode);
+    }
+    else {
+        d_head_p.storeRelease(newNode);
+    }
+    if (d_tail_p == node) {
+        d_tail_p = newNode;
+    }
 }
 
 template <class KEY, class VALUE>
@@ -1506,7 +1926,7 @@ inline
 void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setHead(
                          StripedUnorderedContainerImpl_Node<KEY, VALUE> *value)
 {
-    d_head_p = value;
+    d_head_p.storeRelease(value);
 }
 
 template <class KEY, class VALUE>
@@ -1533,19 +1953,20 @@ bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
                                                             const VALUE& value,
                                                             BucketScope  scope)
 {
-    if (d_head_p == NULL) {
-        d_head_p = new (*d_allocator_p)
+    if (d_head_p.loadRelaxed() == NULL) {
+        d_tail_p = new (*d_allocator_p)
                                 StripedUnorderedContainerImpl_Node<KEY, VALUE>(
                                                                 key,
                                                                 value,
                                                                 NULL,
                                                                 d_allocator_p);
-        d_tail_p = d_head_p;
+        d_head_p.storeRelease(d_tail_p);
         d_size = 1;
         return 0;                                                     // RETURN
     }
 
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
+                                                        d_head_p.loadRelaxed();
     int                                             count   = 0;
     for (; curNode != NULL; curNode = curNode->next()) {
         if (equal(curNode->key(), key)) {
@@ -1578,18 +1999,19 @@ bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
                                                 const EQUAL&             equal,
                                                 bslmf::MovableRef<VALUE> value)
 {
-    if (d_head_p == NULL) {
-        d_head_p = new (*d_allocator_p)
+    if (d_head_p.loadRelaxed() == NULL) {
+        d_tail_p = new (*d_allocator_p)
                                 StripedUnorderedContainerImpl_Node<KEY, VALUE>(
                                             key,
                                             bslmf::MovableRefUtil::move(value),
                                             NULL,
                                             d_allocator_p);
-        d_tail_p = d_head_p;
+        d_head_p.storeRelease(d_tail_p);
         d_size = 1;
         return 0;                                                     // RETURN
     }
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
+                                                        d_head_p.loadRelaxed();
     for (; curNode != NULL; curNode = curNode->next()) {
         if (equal(curNode->key(), key)) {
 #if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
@@ -1625,7 +2047,7 @@ inline
 StripedUnorderedContainerImpl_Node<KEY, VALUE>
                 *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::head() const
 {
-    return d_head_p;
+    return d_head_p.loadAcquire();
 }
 
 template <class KEY, class VALUE>
@@ -1751,6 +2173,161 @@ void StripedUnorderedContainerImpl_LockElementWriteGuard::release()
     }
 }
 
+              // ------------------------------------------------
+              // class StripedUnorderedContainerImpl_EpochManager
+              // ------------------------------------------------
+
+// MANIPULATORS
+inline
+bsls::AtomicInt *StripedUnorderedContainerImpl_EpochManager::enter()
+{
+    // Thread identifiers are often aligned addresses, so scramble the bits
+    // (Fibonacci hashing) before selecting a slot.
+
+    bsls::Types::Uint64 threadId = bslmt::ThreadUtil::selfIdAsUint64();
+    bsl::size_t         slotIdx  = static_cast<bsl::size_t>(
+                               (threadId * 0x9E3779B97F4A7C15ULL) >> 32)
+                                                                  & d_slotMask;
+    bsls::AtomicInt    *counts   = d_counts_p + slotIdx * k_SLOT_SIZE;
+
+    for (;;) {
+        unsigned int     epoch = d_epoch.load();
+        bsls::AtomicInt *count = counts + (epoch & 1);
+        ++*count;
+
+        // If the epoch advanced before we were counted, the writer that
+        // advanced it may not have seen us; retry with the new epoch.
+
+        if (epoch == d_epoch.load()) {
+            if (0 != d_numSuspensions.load()) {
+                --*count;
+                return 0;                                             // RETURN
+            }
+            return count;                                             // RETURN
+        }
+        --*count;
+    }
+}
+
+inline
+void StripedUnorderedContainerImpl_EpochManager::leave(bsls::AtomicInt *count)
+{
+    BSLS_ASSERT(count);
+
+    --*count;
+}
+
+inline
+void StripedUnorderedContainerImpl_EpochManager::resumeReaders()
+{
+    --d_numSuspensions;
+}
+
+// ACCESSORS
+inline
+unsigned int StripedUnorderedContainerImpl_EpochManager::epoch() const
+{
+    return d_epoch.load();
+}
+
+               // ----------------------------------------------
+               // class StripedUnorderedContainerImpl_EpochGuard
+               // ----------------------------------------------
+
+// CREATORS
+inline
+StripedUnorderedContainerImpl_EpochGuard::
+                                      StripedUnorderedContainerImpl_EpochGuard(
+                          StripedUnorderedContainerImpl_EpochManager *manager)
+: d_manager_p(manager)
+, d_count_p(manager ? manager->enter() : 0)
+{
+    if (!d_count_p) {
+        d_manager_p = 0;
+    }
+}
+
+inline
+StripedUnorderedContainerImpl_EpochGuard::
+                                    ~StripedUnorderedContainerImpl_EpochGuard()
+{
+    if (d_manager_p) {
+        d_manager_p->leave(d_count_p);
+    }
+}
+
+// ACCESSORS
+inline
+bool StripedUnorderedContainerImpl_EpochGuard::isEntered() const
+{
+    return 0 != d_manager_p;
+}
+
+              // ----------------------------------------------
+              // class StripedUnorderedContainerImpl_RetireList
+              // ----------------------------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+StripedUnorderedContainerImpl_RetireList<KEY, VALUE>::
+                                      StripedUnorderedContainerImpl_RetireList(
+                                              bslma::Allocator *basicAllocator)
+: d_nodes(basicAllocator)
+, d_numUntilAdvance(k_ADVANCE_INTERVAL)
+, d_allocator_p(basicAllocator)
+, d_pad()
+{
+}
+
+template <class KEY, class VALUE>
+inline
+StripedUnorderedContainerImpl_RetireList<KEY, VALUE>::
+                                    ~StripedUnorderedContainerImpl_RetireList()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+void StripedUnorderedContainerImpl_RetireList<KEY, VALUE>::clear()
+{
+    for (bsl::size_t i = 0; i < d_nodes.size(); ++i) {
+        d_allocator_p->deleteObject(d_nodes[i].d_node_p);
+    }
+    d_nodes.clear();
+}
+
+template <class KEY, class VALUE>
+void StripedUnorderedContainerImpl_RetireList<KEY, VALUE>::retire(
+                     Node                                       *node,
+                     StripedUnorderedContainerImpl_EpochManager *epochManager)
+{
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(epochManager);
+
+    // A reader that may have reached 'node' registered no later than the
+    // current epoch, and has left once the epoch has advanced twice.
+
+    RetiredNode retiredNode = { node, epochManager->epoch() };
+    d_nodes.push_back(retiredNode);
+
+    if (0 != --d_numUntilAdvance) {
+        return;                                                       // RETURN
+    }
+    d_numUntilAdvance = k_ADVANCE_INTERVAL;
+
+    epochManager->tryAdvance();
+
+    const unsigned int epoch = epochManager->epoch();
+
+    typename RetiredNodes::iterator it = d_nodes.begin();
+    for (; it != d_nodes.end() && 2 <= epoch - it->d_epoch; ++it) {
+        d_allocator_p->deleteObject(it->d_node_p);
+    }
+    d_nodes.erase(d_nodes.begin(), it);
+}
+
                       // -----------------------------------
                       // class StripedUnorderedContainerImpl
                       // -----------------------------------
@@ -1775,6 +2352,15 @@ bsl::size_t
     return numBuckets;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedUnorderedContainerImpl_Node<KEY, VALUE> *
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::cloneNode(
+                                                const Node&       node,
+                                                bslma::Allocator *allocator)
+{
+    return new (*allocator) Node(node.key(), node.value(), NULL, allocator);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::powerCeil(
@@ -1809,9 +2395,26 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::deleteNode(
+                Node                                                   *node,
+                const StripedUnorderedContainerImpl_Bucket<KEY, VALUE> *bucket)
+{
+    if (!d_retireLists_p) {
+        d_allocator_p->deleteObject(node);
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t bucketIdx = static_cast<bsl::size_t>(bucket -
+                                                     d_buckets.data());
+    d_retireLists_p[bucketToStripe(bucketIdx)].retire(node, d_epochManager_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
-                                                              const KEY& key,
-                                                              Scope      scope)
+                                                       const LOOKUP_KEY& key,
+                                                       Scope             scope)
 {
     bool        eraseAll = scope == e_SCOPE_ALL;
     bsl::size_t bucketIdx;
@@ -1824,16 +2427,21 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
 
     bsl::size_t count = 0;
 
-    Node **prevNodeAddress = bucket.headAddress();
-    Node  *prevNode        = NULL;
-    while (*prevNodeAddress) {
-        Node *node = *prevNodeAddress;
+    Node *prevNode = NULL;
+    Node *node     = bucket.head();
+    while (node) {
+        Node *nextNode = node->next();
         if (d_comparator(node->key(), key)) {
-            *prevNodeAddress = node->next();
+            if (prevNode) {
+                prevNode->setNext(nextNode);
+            }
+            else {
+                bucket.setHead(nextNode);
+            }
             if (bucket.tail() == node) {
                 bucket.setTail(prevNode);
             }
-            d_allocator_p->deleteObject(node);
+            deleteNode(node, &bucket);
             bucket.incrementSize(-1);
             d_numElements.addRelaxed(-1);
             ++count;
@@ -1842,9 +2450,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
             }
         }
         else {
-            prevNode        = node;
-            prevNodeAddress = node->nextAddress();
+            prevNode = node;
         }
+        node = nextNode;
     }
     return count;
 }
@@ -1896,16 +2504,21 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
 
             const KEY& key  = first[dataIdx];
 
-            Node **prevNodeAddress = bucket.headAddress();
-            Node  *prevNode        = NULL;
-            while (*prevNodeAddress) {
-                Node *node = *prevNodeAddress;
+            Node *prevNode = NULL;
+            Node *node     = bucket.head();
+            while (node) {
+                Node *nextNode = node->next();
                 if (d_comparator(node->key(), key)) {
-                    *prevNodeAddress = node->next();
+                    if (prevNode) {
+                        prevNode->setNext(nextNode);
+                    }
+                    else {
+                        bucket.setHead(nextNode);
+                    }
                     if (bucket.tail() == node) {
                         bucket.setTail(prevNode);
                     }
-                    d_allocator_p->deleteObject(node);
+                    deleteNode(node, &bucket);
                     bucket.incrementSize(-1);
                     d_numElements.addRelaxed(-1);
                     ++count;
@@ -1914,9 +2527,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
                     }
                 }
                 else {
-                    prevNode        = node;
-                    prevNodeAddress = node->nextAddress();
+                    prevNode = node;
                 }
+                node = nextNode;
             }
         }
     }
@@ -1948,11 +2561,10 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
     }
     else {
         // Update only the first value if key exists.  Use only in hash map.
-        ret = d_buckets[bucketIdx].setValue(
-        key,
-        d_comparator,
-        value,
-        StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::e_BUCKETSCOPE_FIRST);
+        ret = setValueInBucket(&d_buckets[bucketIdx],
+                               key,
+                               value,
+                               e_SCOPE_FIRST);
     }
     if (ret == 1) {
         return 0;                                                     // RETURN
@@ -1984,10 +2596,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
     }
     else {
         // Update only the first value if key exists.  Use only in hash map.
-        ret = d_buckets[bucketIdx].setValue(
-                                           key,
-                                           d_comparator,
-                                           bslmf::MovableRefUtil::move(value));
+        ret = setValueInBucket(&d_buckets[bucketIdx],
+                               key,
+                               bslmf::MovableRefUtil::move(value));
     }
     if (ret == 1) {
         return 0;                                                     // RETURN
@@ -2057,12 +2668,10 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
                 ++count;
                 d_numElements.addRelaxed(1);
             } else {
-                bsl::size_t ret = d_buckets[bucketIdx].setValue(
-                    key,
-                    d_comparator,
-                    value,
-                    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::
-                                                          e_BUCKETSCOPE_FIRST);
+                bsl::size_t ret = setValueInBucket(&d_buckets[bucketIdx],
+                                                   key,
+                                                   value,
+                                                   e_SCOPE_FIRST);
                 if (ret == 0) {
                     ++count;
                     d_numElements.addRelaxed(1);
@@ -2091,11 +2700,12 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setComputedValue(
     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
     // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
+    int                                             count    = 0;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevNode = NULL;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode  = bucket.head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
-            bool ret = visitor(&curNode->value(), key);
+            bool ret = visitNode(&bucket, prevNode, &curNode, visitor, key);
             if (false == setAll) {
                 return ret ? 1 : -1;                                  // RETURN
             }
@@ -2147,18 +2757,13 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
                                                             const VALUE& value,
                                                             Scope        scope)
 {
-    typedef StripedUnorderedContainerImpl_Bucket<KEY, VALUE> BucketClass;
-    typename BucketClass::BucketScope setAll = scope == e_SCOPE_ALL
-                                            ? BucketClass::e_BUCKETSCOPE_ALL
-                                            : BucketClass::e_BUCKETSCOPE_FIRST;
-
     bsl::size_t                bucketIdx;
     LEWGuard                   guard(lockWrite(&bucketIdx, key));
 
     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
 
-    bsl::size_t count = bucket.setValue(key, d_comparator, value, setAll);
+    bsl::size_t count = setValueInBucket(&bucket, key, value, scope);
     if (count == 0) {
         guard.release();
         d_numElements.addRelaxed(1);
@@ -2167,13 +2772,132 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
     return count;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueInBucket(
+                     StripedUnorderedContainerImpl_Bucket<KEY, VALUE> *bucket,
+                     const KEY&                                        key,
+                     const VALUE&                                      value,
+                     Scope                                             scope)
+{
+    typedef StripedUnorderedContainerImpl_Bucket<KEY, VALUE> BucketClass;
+
+    if (!d_epochManager_p) {
+        typename BucketClass::BucketScope setAll = scope == e_SCOPE_ALL
+                                            ? BucketClass::e_BUCKETSCOPE_ALL
+                                            : BucketClass::e_BUCKETSCOPE_FIRST;
+        return bucket->setValue(key, d_comparator, value, setAll);    // RETURN
+    }
+
+    // Lock-free readers may be copying the values of the nodes in 'bucket',
+    // so replace matching nodes instead of assigning to them.
+
+    bsl::size_t count    = 0;
+    Node       *prevNode = NULL;
+    for (Node *curNode = bucket->head(); curNode != NULL;
+                               prevNode = curNode, curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            Node *newNode = new (*d_allocator_p) Node(curNode->key(),
+                                                      value,
+                                                      NULL,
+                                                      d_allocator_p);
+            bucket->replaceNode(prevNode, curNode, newNode);
+            deleteNode(curNode, bucket);
+            curNode = newNode;
+            ++count;
+            if (e_SCOPE_FIRST == scope) {
+                return count;                                         // RETURN
+            }
+        }
+    }
+    if (count > 0) {
+        return count;                                                 // RETURN
+    }
+    bucket->addNode(new (*d_allocator_p) Node(key,
+                                              value,
+                                              NULL,
+                                              d_allocator_p));
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueInBucket(
+                     StripedUnorderedContainerImpl_Bucket<KEY, VALUE> *bucket,
+                     const KEY&                                        key,
+                     bslmf::MovableRef<VALUE>                          value)
+{
+    if (!d_epochManager_p) {
+        return bucket->setValue(key,                                  // RETURN
+                                d_comparator,
+                                bslmf::MovableRefUtil::move(value));
+    }
+
+    // Lock-free readers may be copying the values of the nodes in 'bucket',
+    // so replace the matching node instead of assigning to it.
+
+    Node *prevNode = NULL;
+    for (Node *curNode = bucket->head(); curNode != NULL;
+                               prevNode = curNode, curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            Node *newNode = new (*d_allocator_p) Node(
+                                            curNode->key(),
+                                            bslmf::MovableRefUtil::move(value),
+                                            NULL,
+                                            d_allocator_p);
+            bucket->replaceNode(prevNode, curNode, newNode);
+            deleteNode(curNode, bucket);
+            return 1;                                                 // RETURN
+        }
+    }
+    bucket->addNode(new (*d_allocator_p) Node(
+                                            key,
+                                            bslmf::MovableRefUtil::move(value),
+                                            NULL,
+                                            d_allocator_p));
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitNode(
+                  StripedUnorderedContainerImpl_Bucket<KEY, VALUE>  *bucket,
+                  Node                                              *prevNode,
+                  Node                                             **nodePtr,
+                  const VisitorFunction&                             visitor,
+                  const KEY&                                         key)
+{
+    if (!d_epochManager_p) {
+        return visitor(&(*nodePtr)->value(), key);                    // RETURN
+    }
+
+    // Lock-free readers may be copying the value of '*nodePtr', so let
+    // 'visitor' modify a copy, and publish the copy when done.
+
+    BSLS_ASSERT(d_cloneNode_p);
+
+    Node *newNode = d_cloneNode_p(**nodePtr, d_allocator_p);
+    bool  ret;
+    {
+        bslma::RawDeleterProctor<Node, bslma::Allocator> proctor(
+                                                                newNode,
+                                                                d_allocator_p);
+        ret = visitor(&newNode->value(), key);
+        proctor.release();
+    }
+    bucket->replaceNode(prevNode, *nodePtr, newNode);
+    deleteNode(*nodePtr, bucket);
+    *nodePtr = newNode;
+    return ret;
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketIndex(
-                                                  const KEY&  key,
-                                                  bsl::size_t numBuckets) const
+                                            const LOOKUP_KEY& key,
+                                            bsl::size_t       numBuckets) const
 {
     bsl::size_t hashVal   = d_hasher(key);
     bsl::size_t bucketIdx =
@@ -2210,6 +2934,19 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValueImpl(
 
     valuesPtr->clear();
 
+    EpochGuard epochGuard(d_epochManager_p);
+    if (epochGuard.isEntered()) {
+        bsl::size_t count = 0;
+        for (const Node *curNode = lockFreeHead(key); curNode != NULL;
+                                                   curNode = curNode->next()) {
+            if (d_comparator(curNode->key(), key)) {
+                valuesPtr->push_back(curNode->value());
+                ++count;
+            }
+        }
+        return count;                                                 // RETURN
+    }
+
     bsl::size_t bucketIdx;
     LERGuard    guard(lockRead(&bucketIdx, key));
 
@@ -2228,11 +2965,25 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValueImpl(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+inline
+StripedUnorderedContainerImpl_Node<KEY, VALUE> *
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockFreeHead(
+                                                   const LOOKUP_KEY& key) const
+{
+    // 'd_numBuckets' and 'd_buckets' are stable while lock-free readers are
+    // registered (see 'rehash').
+
+    return d_buckets[bucketIndex(key, d_numBuckets)].head();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 StripedUnorderedContainerImpl_LockElement *
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
+                                                 bsl::size_t       *bucketIdx,
+                                                 const LOOKUP_KEY&  key) const
 {
     // From key, get hash value, and current number of buckets.
     bsl::size_t  hashVal    = d_hasher(key);
@@ -2252,11 +3003,12 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 StripedUnorderedContainerImpl_LockElement *
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockWrite(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
+                                                 bsl::size_t       *bucketIdx,
+                                                 const LOOKUP_KEY&  key) const
 {
     // From key, get hash value, and current number of buckets.
     bsl::size_t  hashVal      = d_hasher(key);
@@ -2293,6 +3045,9 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
 , d_statePad()
 , d_numElementsPad()
 , d_buckets(d_numBuckets, basicAllocator)
+, d_epochManager_p(0)
+, d_cloneNode_p(0)
+, d_retireLists_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
@@ -2306,6 +3061,68 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                                                 StripedUnorderedContainerImpl(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadMode          readMode,
+                                           bslma::Allocator *basicAllocator)
+: d_numStripes(powerCeil(numStripes))
+, d_numBuckets(adjustBuckets(numInitialBuckets, d_numStripes))
+, d_hashMask(d_numStripes - 1)
+, d_maxLoadFactor(1.0)
+, d_hasher()
+, d_comparator()
+, d_statePad()
+, d_numElementsPad()
+, d_buckets(d_numBuckets, basicAllocator)
+, d_epochManager_p(0)
+, d_cloneNode_p(0)
+, d_retireLists_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
+    d_numElements = 0; // Hash empty
+
+    // Lock-free reads require to copy the value of the updated elements.
+
+    BSLMF_ASSERT(bsl::is_copy_constructible<VALUE>::value);
+
+    if (e_READ_LOCK_FREE == readMode) {
+        const bsl::size_t minNumReaderSlots = k_MIN_NUM_READER_SLOTS;
+        const bsl::size_t numReaderSlots    = d_numStripes < minNumReaderSlots
+                                            ? minNumReaderSlots
+                                            : d_numStripes;
+        d_epochManager_p = new (*d_allocator_p) EpochManager(numReaderSlots,
+                                                             d_allocator_p);
+        d_cloneNode_p    = &cloneNode;
+    }
+    bslma::RawDeleterProctor<EpochManager, bslma::Allocator> proctor(
+                                                              d_epochManager_p,
+                                                              d_allocator_p);
+
+    if (d_epochManager_p) {
+        // Allocate array of 'RetireList' objects, and construct them.
+        d_retireLists_p = reinterpret_cast<RetireList *>(
+                   d_allocator_p->allocate(d_numStripes * sizeof(RetireList)));
+        for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+            new (d_retireLists_p + i) RetireList(d_allocator_p);
+        }
+    }
+    bslma::DeallocatorProctor<bslma::Allocator> listsProctor(d_retireLists_p,
+                                                             d_allocator_p);
+
+    // Allocate array of 'LockElement' objects, and construct them.
+    d_locks_p = reinterpret_cast<LockElement*>(
+                  d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        bslma::ConstructionUtil::construct(&d_locks_p[i], d_allocator_p);
+    }
+    listsProctor.release();
+    proctor.release();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
@@ -2315,6 +3132,16 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
         bslma::DestructionUtil::destroy(&d_locks_p[i]);
     }
     d_allocator_p->deallocate(d_locks_p);
+
+    if (d_retireLists_p) {
+        for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+            bslma::DestructionUtil::destroy(&d_retireLists_p[i]);
+        }
+        d_allocator_p->deallocate(d_retireLists_p);
+    }
+    if (d_epochManager_p) {
+        d_allocator_p->deleteObject(d_epochManager_p);
+    }
 }
 
 // MANIPULATORS
@@ -2322,10 +3149,26 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clear()
 {
+    // Wait for the lock-free readers to leave before deleting the nodes.  This
+    // is done before locking, as a reader may be blocked on a stripe lock
+    // (e.g., when calling 'getValue' from a read-only visitor).
+
+    if (d_epochManager_p) {
+        d_epochManager_p->suspendReaders();
+    }
+
     // Locking all stripes will inherently block until a rehash will complete
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
     }
+    if (d_retireLists_p) {
+        // As no lock-free reader remains, the retired nodes can be deleted as
+        // well.
+
+        for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+            d_retireLists_p[i].clear();
+        }
+    }
     for (bsl::size_t j = 0; j < d_numBuckets; ++j) {
         d_buckets[j].clear();
     }
@@ -2333,6 +3176,9 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clear()
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].unlockW();
     }
+    if (d_epochManager_p) {
+        d_epochManager_p->resumeReaders();
+    }
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2362,9 +3208,10 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::enableRehash()
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseAll(
-                                                                const KEY& key)
+                                                         const LOOKUP_KEY& key)
 {
     return erase(key, e_SCOPE_ALL);
 }
@@ -2396,9 +3243,10 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulkFirst(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseFirst(
-                                                                const KEY& key)
+                                                         const LOOKUP_KEY& key)
 {
     return erase(key, e_SCOPE_FIRST);
 }
@@ -2511,6 +3359,14 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
                                                                 numBuckets,
                                                                 d_allocator_p);
 
+    // Lock-free readers traverse 'd_buckets' without the stripe locks, so they
+    // must be kept out while nodes are relinked and 'd_buckets' is swapped.
+    // Readers arriving meanwhile fall back to the stripe locks.
+
+    if (d_epochManager_p) {
+        d_epochManager_p->suspendReaders();
+    }
+
     // Main loop on stripes: lock a stripe and process all buckets in it
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
@@ -2546,6 +3402,10 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
     // Update number of buckets.
     d_numBuckets = numBuckets;
 
+    if (d_epochManager_p) {
+        d_epochManager_p->resumeReaders();
+    }
+
     // Unlock all stripes.  This could not be done on the spot, as we store the
     /// rehashed data in a new set of buckets.
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
@@ -2609,9 +3469,9 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueFirst(
     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
 
-    bsl::size_t count = bucket.setValue(key,
-                                        d_comparator,
-                                        bslmf::MovableRefUtil::move(value));
+    bsl::size_t count = setValueInBucket(&bucket,
+                                         key,
+                                         bslmf::MovableRefUtil::move(value));
     if (count == 0) {
         guard.release();
         d_numElements.addRelaxed(1);
@@ -2645,11 +3505,16 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visit(
             StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
                                                                   d_buckets[j];
             // Loop on the nodes in the bucket.
+            StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevNode = NULL;
             for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
                                                 bucket.head(); curNode != NULL;
-                                                   curNode = curNode->next()) {
+                               prevNode = curNode, curNode = curNode->next()) {
                 ++count;
-                bool ret = visitor(&(curNode->value()), curNode->key());
+                bool ret = visitNode(&bucket,
+                                     prevNode,
+                                     &curNode,
+                                     visitor,
+                                     curNode->key());
                 if (!ret) {
                     d_locks_p[i].unlockW();
                     return -count;                                    // RETURN
@@ -2674,12 +3539,13 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visit(
                                                           d_buckets[bucketIdx];
 
     // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
+    int                                             count    = 0;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevNode = NULL;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode  = bucket.head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
             ++count;
-            bool ret = visitor(&curNode->value(), key);
+            bool ret = visitNode(&bucket, prevNode, &curNode, visitor, key);
             if (ret == false) {
                 return -count;                                        // RETURN
             }
@@ -2698,10 +3564,11 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketCount() const
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketIndex(
-                                                          const KEY& key) const
+                                                   const LOOKUP_KEY& key) const
 {
     return bucketIndex(key, d_numBuckets);
 }
@@ -2744,13 +3611,26 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::equalFunction() const
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
-                                                         VALUE      *value,
-                                                         const KEY&  key) const
+                                                  VALUE             *value,
+                                                  const LOOKUP_KEY&  key) const
 {
     BSLS_ASSERT(NULL != value);
 
+    EpochGuard epochGuard(d_epochManager_p);
+    if (epochGuard.isEntered()) {
+        for (const Node *curNode = lockFreeHead(key); curNode != NULL;
+                                                   curNode = curNode->next()) {
+            if (d_comparator(curNode->key(), key)) {
+                *value = curNode->value();
+                return 1;                                             // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+    }
+
     bsl::size_t bucketIdx;
     LERGuard    guard(lockRead(&bucketIdx, key));
 
@@ -2837,6 +3717,14 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::numStripes() const
     return static_cast<bsl::size_t>(d_numStripes);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::ReadMode
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::readMode() const
+{
+    return d_epochManager_p ? e_READ_LOCK_FREE : e_READ_LOCKED;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
                                   const ReadOnlyVisitorFunction& visitor) const
@@ -2870,11 +3758,27 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
-                                  const KEY&                     key,
+                                  const LOOKUP_KEY&              key,
                                   const ReadOnlyVisitorFunction& visitor) const
 {
+    EpochGuard epochGuard(d_epochManager_p);
+    if (epochGuard.isEntered()) {
+        int count = 0;
+        for (const Node *curNode = lockFreeHead(key); curNode != NULL;
+                                                   curNode = curNode->next()) {
+            if (d_comparator(curNode->key(), key)) {
+                ++count;
+                if (!visitor(curNode->value(), curNode->key())) {
+                    return -count;                                    // RETURN
+                }
+            }
+        }
+        return count;                                                 // RETURN
+    }
+
     bsl::size_t bucketIdx;
     LERGuard    guard(lockRead(&bucketIdx, key));
 
@@ -2887,7 +3791,7 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
     for (; curNode != NULL; curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
             ++count;
-            bool ret = visitor(curNode->value(), key);
+            bool ret = visitor(curNode->value(), curNode->key());
             if (ret == false) {
                 return -count;                                        // RETURN
             }
@@ -107,6 +107,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedContainerImpl(numInitialBuckets, numStripes, *ba);
+// [23] StripedUnorderedContainerImpl(nIB, nS, readMode, *ba);
 // [ 2] ~StripedUnorderedContainerImpl();
 //
 // MANIPULATORS
@@ -148,6 +149,7 @@ using namespace bsl;
 // [15] float loadFactor() const;
 // [15] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [23] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 // [19] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
 // [19] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
@@ -159,6 +161,8 @@ using namespace bsl;
 // [20] LOCKING TEST UTIL
 // [21] LOCKING
 // [22] MULTI-THREADED STRESS TEST
+// [23] LOCK-FREE READS
+// [24] MULTI-THREADED LOCK-FREE READS STRESS TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -986,6 +990,146 @@ void testLocking()
         ASSERT(duration < k_SLEEP_PERIOD / 2);
     }
 }
+
+void testLockFreeReads()
+    // Test the 'e_READ_LOCK_FREE' read mode.
+{
+    // ------------------------------------------------------------------------
+    // LOCK-FREE READS
+    //
+    // Concerns:
+    //: 1 The read mode supplied at construction is reported by 'readMode',
+    //:   and defaults to 'e_READ_LOCKED'.
+    //:
+    //: 2 In 'e_READ_LOCK_FREE' mode, 'getValue' and
+    //:   'visitReadOnly(key, visitor)' do not acquire the lock of the stripe
+    //:   of 'key'.
+    //:
+    //: 3 The manipulators observe the usual semantics in
+    //:   'e_READ_LOCK_FREE' mode.
+    //:
+    //: 4 Elements replaced or erased in 'e_READ_LOCK_FREE' mode are
+    //:   eventually destroyed, and no memory is leaked.
+    //
+    // Plan:
+    //: 1 Create hash maps with and without a read mode, and verify the
+    //:   value returned by 'readMode'.  (C-1)
+    //:
+    //: 2 Using 'bdlcc::StripedUnorderedContainerImpl_TestUtil', acquire the
+    //:   write lock of the stripe of a key from the main thread, and then
+    //:   invoke 'getValue' and 'visitReadOnly(key, visitor)' for that key
+    //:   from the same thread.  Since the lock is not recursive, these
+    //:   calls complete only if they do not lock.  (C-2)
+    //:
+    //: 3 Repeatedly replace and erase elements, and verify the values
+    //:   observed and that the memory in use remains bounded.  (C-3..4)
+    //:
+    //: 4 Verify that all memory is returned by 'clear' and on destruction.
+    //:   (C-4)
+    //
+    // Testing:
+    //   StripedUnorderedContainerImpl(nIB, nS, readMode, *ba);
+    //   ReadMode readMode() const;
+    //   LOCK-FREE READS
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "LOCK-FREE READS" << endl
+                      << "---------------" << endl;
+
+    bslma::TestAllocator ta("lockFree", veryVeryVeryVerbose);
+
+    if (veryVerbose) cout << "'readMode'" << endl;
+    {
+        StripType mX(16, 4, &ta);
+        StripType mY(16, 4, StripType::e_READ_LOCKED,    &ta);
+        StripType mZ(16, 4, StripType::e_READ_LOCK_FREE, &ta);
+
+        ASSERT(StripType::e_READ_LOCKED    == mX.readMode());
+        ASSERT(StripType::e_READ_LOCKED    == mY.readMode());
+        ASSERT(StripType::e_READ_LOCK_FREE == mZ.readMode());
+    }
+
+    if (veryVerbose) cout << "Reads under a write-locked stripe" << endl;
+    {
+        StripType           strip(16, 4, StripType::e_READ_LOCK_FREE, &ta);
+        Strip_TestUtilType  strip_TestUtil(strip);
+        const int           key = 1001;
+
+        strip.insertUnique(key, "value");
+
+        strip_TestUtil.lockWrite(key);
+
+        bsl::string value;
+        ASSERT(1       == strip.getValue(&value, key));
+        ASSERT("value" == value);
+        ASSERT(0       == strip.getValue(&value, key + 1));
+
+        TestReader func;
+        ASSERT(1 == strip.visitReadOnly(key, func));
+
+        strip_TestUtil.unlockWrite(key);
+    }
+    ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+    if (veryVerbose) cout << "Replacement and reclamation" << endl;
+    {
+        const int k_NUM_KEYS    = 32;
+        const int k_NUM_UPDATES = 100;
+
+        StripType strip(16, 4, StripType::e_READ_LOCK_FREE, &ta);
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            strip.insertUnique(i, bsl::string(40, 'a'));
+        }
+
+        // Retired elements are destroyed in batches, so the memory in use
+        // oscillates.  Verify that its peak over the first half of the
+        // updates, during which the retired lists reach their steady state,
+        // is not exceeded during the second half.
+
+        bsls::Types::Int64 maxNumBlocks = 0;
+
+        for (int j = 0; j < k_NUM_UPDATES; ++j) {
+            const bsl::string newValue(40, static_cast<char>('b' + j % 20));
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ASSERTV(i, j, 1 == strip.setValueFirst(i, newValue));
+
+                bsl::string value;
+                ASSERTV(i, j, 1 == strip.getValue(&value, i));
+                ASSERTV(i, j, newValue == value);
+
+                if (j < k_NUM_UPDATES / 2) {
+                    maxNumBlocks = bsl::max(maxNumBlocks,
+                                            ta.numBlocksInUse());
+                }
+                else {
+                    ASSERTV(i,
+                            j,
+                            maxNumBlocks,
+                            ta.numBlocksInUse(),
+                            maxNumBlocks >= ta.numBlocksInUse());
+                }
+            }
+        }
+
+        for (int i = 0; i < k_NUM_KEYS; i += 2) {
+            ASSERTV(i, 1 == strip.eraseFirst(i));
+        }
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            bsl::string value;
+            ASSERTV(i, (i % 2) == static_cast<int>(strip.getValue(&value,
+                                                                  i)));
+        }
+        ASSERTV(strip.size(), k_NUM_KEYS / 2 == strip.size());
+
+        strip.clear();
+
+        ASSERT(strip.empty());
+    }
+    ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+}
 }  // close namespace testLock
 
 namespace threaded {
@@ -1167,6 +1311,157 @@ void threadedTest1()
             initialNumBuckets < finalNumBuckets);
 }
 
+struct LockFreeThreadArg {
+    typedef bdlcc::StripedUnorderedContainerImpl<int, bsl::string> StripType;
+
+    StripType       *d_strip_p;
+    bsls::AtomicInt *d_stop_p;
+    bsls::AtomicInt *d_numErrors_p;
+    int              d_numItems;
+    int              d_workerId;
+};
+
+bool checkValue(const bsl::string& value, int key)
+    // Return 'true' if the specified 'value' is a value written by
+    // 'lockFreeWriter' for the specified 'key', and 'false' otherwise.
+{
+    return value.length() > static_cast<bsl::size_t>(key % 64)
+        && value[0] == static_cast<char>('a' + key % 26)
+        && value[value.length() - 1] == static_cast<char>('a' + key % 26);
+}
+
+extern "C" void *lockFreeReader(void *v_arg)
+{
+    // Look up random keys of the hash map in the specified 'v_arg', and count
+    // the values not consistent with their key.
+    LockFreeThreadArg *arg = static_cast<LockFreeThreadArg *>(v_arg);
+
+    int seed = arg->d_workerId;
+    while (0 == *arg->d_stop_p) {
+        int         key = bdlb::Random::generate15(&seed) % arg->d_numItems;
+        bsl::string value;
+
+        if (1 == arg->d_strip_p->getValue(&value, key)
+         && !checkValue(value, key)) {
+            ++*arg->d_numErrors_p;
+        }
+    }
+    return v_arg;
+}
+
+extern "C" void *lockFreeWriter(void *v_arg)
+{
+    // Insert, update, and erase random keys of the hash map in the specified
+    // 'v_arg', writing values determined by the key.
+    LockFreeThreadArg *arg = static_cast<LockFreeThreadArg *>(v_arg);
+
+    int seed = arg->d_workerId;
+    while (0 == *arg->d_stop_p) {
+        int key    = bdlb::Random::generate15(&seed) % arg->d_numItems;
+        int length = key % 64 + 1 + bdlb::Random::generate15(&seed) % 64;
+
+        bsl::string value(length, static_cast<char>('a' + key % 26));
+
+        switch (bdlb::Random::generate15(&seed) % 4) {
+          case 0: {
+            arg->d_strip_p->eraseFirst(key);
+          } break;
+          case 1: {
+            arg->d_strip_p->insertUnique(key, value);
+          } break;
+          default: {
+            arg->d_strip_p->setValueFirst(key, value);
+          } break;
+        }
+    }
+    return v_arg;
+}
+
+void threadedTest2()
+    // Multi threaded stress test of lock-free reads.
+{
+    // ------------------------------------------------------------------------
+    // MULTI-THREADED LOCK-FREE READS STRESS TEST
+    //
+    // Concerns:
+    //: 1 In 'e_READ_LOCK_FREE' mode, 'getValue' observes only complete
+    //:   values, written by some writer, while other threads concurrently
+    //:   insert, replace, and erase elements, and rehash the hash map.
+    //:
+    //: 2 Elements are not destroyed while a reader may access them, and are
+    //:   all destroyed eventually.
+    //
+    // Plan:
+    //: 1 Create a hash map in 'e_READ_LOCK_FREE' mode, a set of writer
+    //:   threads that insert, replace, and erase elements having values
+    //:   determined by the key, and a set of reader threads that verify the
+    //:   values they look up.  Allocated 'bsl::string' values ensure that a
+    //:   prematurely destroyed element is likely to be detected (and is
+    //:   reported by sanitizers).  (C-1..2)
+    //:
+    //: 2 Have the main thread rehash the hash map periodically.  (C-1)
+    //:
+    //: 3 Verify that no inconsistent value was observed, and that all memory
+    //:   is returned on destruction.  (C-1..2)
+    //
+    // Testing:
+    //   MULTI-THREADED LOCK-FREE READS STRESS TEST
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "MULTI-THREADED LOCK-FREE READS STRESS TEST" << endl
+                      << "------------------------------------------" << endl;
+
+    const int k_NUM_READERS = 6;
+    const int k_NUM_WRITERS = 2;
+    const int k_NUM_THREADS = k_NUM_READERS + k_NUM_WRITERS;
+    const int k_NUM_ITEMS   = 256;
+
+    bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+    {
+        typedef LockFreeThreadArg::StripType StripType;
+
+        StripType       strip(16, 8, StripType::e_READ_LOCK_FREE, &supplied);
+        bsls::AtomicInt stop(0);
+        bsls::AtomicInt numErrors(0);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        LockFreeThreadArg         args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            LockFreeThreadArg arg = { &strip, &stop, &numErrors,
+                                      k_NUM_ITEMS, i + 1 };
+            args[i] = arg;
+
+            bslmt::ThreadUtil::create(&handles[i],
+                                      i < k_NUM_READERS ? lockFreeReader
+                                                        : lockFreeWriter,
+                                      &args[i]);
+        }
+
+        for (int i = 0; i < 10; ++i) {
+            bslmt::ThreadUtil::microSleep(100 * 1000, 0);
+            strip.rehash(strip.bucketCount() * 2);
+        }
+
+        stop = 1;
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(numErrors, 0 == numErrors);
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            bsl::string value;
+            if (1 == strip.getValue(&value, i)) {
+                ASSERTV(i, value, checkValue(value, i));
+            }
+        }
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+}
+
 }  // close namespace threaded
 
 // TestDriver template
@@ -9474,6 +9769,12 @@ int main(int argc, char *argv[])
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 24: {
+        threaded::threadedTest2();
+      } break;
+      case 23: {
+        testLock::testLockFreeReads();
+      } break;
       case 22: {
         threaded::threadedTest1();
       } break;
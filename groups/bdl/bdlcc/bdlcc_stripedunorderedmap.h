@@ -114,6 +114,34 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Lock-Free Reads
+///---------------
+// By default, 'getValue' and 'visitReadOnly(key, visitor)' acquire the read
+// lock of the stripe of 'key'.  When many threads look up the same few keys,
+// the cache-line traffic on those locks can dominate the cost of the lookups.
+// A map constructed with the 'e_READ_LOCK_FREE' read mode serves these lookups
+// without locking:
+//
+//: o Readers register themselves in one of several cache-line-padded
+//:   counters, selected by thread, and traverse the bucket directly.
+//:
+//: o Writers still acquire the write lock of the stripe.  They link new
+//:   elements only once fully constructed, and never modify an element that
+//:   readers may be accessing: the 'set*', 'insert', 'update', and 'visit'
+//:   methods replace an existing element by a modified copy.
+//:
+//: o Erased and replaced elements are destroyed once no reader that may be
+//:   accessing them remains, which can be some time after they are removed.
+//:
+//: o 'rehash' and 'clear' wait for the registered readers to finish; lookups
+//:   made in the meantime acquire the read lock as in the default mode.
+//
+// This mode favors readers at the expense of writers, as updating a value
+// allocates a new element and 'visit' copies every element it visits.  The
+// constructor taking a 'ReadMode' therefore requires 'VALUE' to be
+// copy-constructible, whereas the other constructor does not.  The read mode
+// is fixed at construction and does not affect 'visitReadOnly(visitor)'.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -347,6 +375,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlcc_stripedunorderedcontainerimpl.h>
 
+#include <bslmf_enableif.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 
 #include <bsls_assert.h>
@@ -403,6 +433,17 @@ class StripedUnorderedMap {
     };
 
     // PUBLIC TYPES
+    enum ReadMode {
+        // Enumeration of the synchronization used by 'getValue' and
+        // 'visitReadOnly(key, visitor)' (see {Lock-Free Reads}).
+
+        e_READ_LOCKED    = Impl::e_READ_LOCKED,    // Acquire the read lock
+                                                   // of the stripe.
+
+        e_READ_LOCK_FREE = Impl::e_READ_LOCK_FREE  // Traverse the bucket
+                                                   // without locking.
+    };
+
     typedef bsl::pair<KEY, VALUE> KVType;
         // Value type of a bulk insert entry.
 
@@ -448,6 +489,20 @@ class StripedUnorderedMap {
         // stripes will not change after construction, but the number of
         // buckets may (unless rehashing is disabled via 'disableRehash').
 
+    StripedUnorderedMap(bsl::size_t       numInitialBuckets,
+                        bsl::size_t       numStripes,
+                        ReadMode          readMode,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedMap' object having the specified
+        // 'numInitialBuckets' minimum number of buckets and the specified
+        // 'numStripes' number of stripes, whose 'getValue' and
+        // 'visitReadOnly(key, visitor)' methods use the specified 'readMode'
+        // synchronization (see {Lock-Free Reads}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The hash map
+        // has rehash enabled.  This constructor does not compile unless
+        // 'VALUE' is copy-constructible.
+
     //! ~StripedUnorderedMap() = default;
         // Destroy this hash map.
 
@@ -472,6 +527,22 @@ class StripedUnorderedMap {
         // Return 1 on success and 0 if 'key' does not exist.  Note that the
         // returned value equals the number of elements removed.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::size_t>::type
+    erase(const LOOKUP_KEY& key)
+        // Erase from this hash map the element having a key equivalent to the
+        // specified 'key'.  Return 1 on success and 0 if no such element
+        // exists.  Note that this overload participates in overload resolution
+        // only if both 'HASH' and 'EQUAL' are transparent, and creates no
+        // 'KEY' object.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return d_imp.eraseFirst(key);
+    }
+
     template <class RANDOM_ITER>
     bsl::size_t eraseBulk(RANDOM_ITER first, RANDOM_ITER last);
         // Erase from this hash map elements in this hash map having any of the
@@ -624,6 +695,22 @@ class StripedUnorderedMap {
         // inserted.  Note that unless rehash is disabled, the value returned
         // may be obsolete at the time it is returned.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::size_t>::type
+    bucketIndex(const LOOKUP_KEY& key) const
+        // Return the index of the bucket, in the array of buckets maintained
+        // by this hash map, where elements having a key equivalent to the
+        // specified 'key' are inserted.  Note that this overload participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent, and creates no 'KEY' object.  Also note: implemented
+        // inline due to Sun CC compilation error.
+    {
+        return d_imp.bucketIndex(key);
+    }
+
     bsl::size_t bucketSize(bsl::size_t index) const;
         // Return the number of elements contained in the bucket at the
         // specified 'index' in the array of buckets maintained by this hash
@@ -646,6 +733,23 @@ class StripedUnorderedMap {
         // success and 0 if 'key' does not exist in this hash map.  Note that
         // the return value equals the number of values returned.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               bsl::size_t>::type
+    getValue(VALUE *value, const LOOKUP_KEY& key) const
+        // Load, into the specified '*value', the value attribute of the
+        // element in this hash map having a key equivalent to the specified
+        // 'key'.  Return 1 on success and 0 if no such element exists in this
+        // hash map.  Note that this overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent, and
+        // creates no 'KEY' object.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        return d_imp.getValue(value, key);
+    }
+
     HASH hashFunction() const;
         // Return (a copy of) the unary hash functor used by this hash map.
         // The return function will generate a hash value (of type
@@ -654,6 +758,10 @@ class StripedUnorderedMap {
     bool isRehashEnabled() const;
         // Return 'true' if rehash is enabled, or 'false' otherwise.
 
+    ReadMode readMode() const;
+        // Return the synchronization used by the 'getValue' and
+        // 'visitReadOnly(key, visitor)' methods of this hash map.
+
     float loadFactor() const;
         // Return the current quotient of the size of this hash map and the
         // number of buckets.  Note that the load factor is a measure of
@@ -703,6 +811,24 @@ class StripedUnorderedMap {
         // manipulators are invoked from within 'visitor', as it may lead to a
         // deadlock.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+                  bslmf::IsTransparentPredicate<HASH,  LOOKUP_KEY>::value
+               && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+               int>::type
+    visitReadOnly(const LOOKUP_KEY&              key,
+                  const ReadOnlyVisitorFunction& visitor) const
+        // Call the specified 'visitor' on the element (if one exists) in this
+        // hash map having a key equivalent to the specified 'key', passing the
+        // value and the key of that element.  Return the number of elements
+        // visited or '-1' if 'visitor' returned 'false'.  Note that this
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent, and creates no 'KEY' object.  Also note:
+        // implemented inline due to Sun CC compilation error.
+    {
+        return d_imp.visitReadOnly(key, visitor);
+    }
+
     bsl::size_t size() const;
         // Return the current number of elements in this hash map.
 
@@ -741,6 +867,20 @@ StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMap(
 {
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMap(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadMode          readMode,
+                                           bslma::Allocator *basicAllocator)
+: d_imp(numInitialBuckets,
+        numStripes,
+        static_cast<typename Impl::ReadMode>(readMode),
+        basicAllocator)
+{
+}
+
 // MANIPULATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
@@ -967,6 +1107,14 @@ bsl::size_t StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::numStripes() const
     return d_imp.numStripes();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::ReadMode
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::readMode() const
+{
+    return static_cast<ReadMode>(d_imp.readMode());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 int StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
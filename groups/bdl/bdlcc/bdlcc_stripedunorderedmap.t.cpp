@@ -11,6 +11,8 @@
 
 #include <bdlb_random.h>
 #include <bdlb_randomdevice.h>
+#include <bdlb_stringviewhash.h>
+#include <bdlb_transparentequalto.h>
 
 #include <bslim_testutil.h>
 #include <bslmt_threadutil.h>
@@ -60,6 +62,7 @@
 #include <bsl_ostream.h>    // operator<<
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 #include <bsl_unordered_map.h>
 
@@ -113,6 +116,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedMap(numInitialBuckets, numStripes, *basicAllocator);
+// [23] StripedUnorderedMap(nIB, nS, readMode, *basicAllocator);
 // [ 2] ~StripedUnorderedMap();
 //
 // MANIPULATORS
@@ -145,14 +149,20 @@ using namespace bsl;
 // [14] float loadFactor() const;
 // [14] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [23] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 // [18] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
 // [18] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
+// [22] bsl::size_t erase(const LOOKUP_KEY& key);
+// [22] bsl::size_t bucketIndex(const LOOKUP_KEY& key) const;
+// [22] bsl::size_t getValue(VALUE *value, const LOOKUP_KEY& key) const;
+// [22] int visitReadOnly(const LOOKUP_KEY&, const ROVisitor&) const;
 //
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [22] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
+// [23] LOCK-FREE READS
 // [21] DRQS 169188100: ALLOCATOR AWARE DEFAULT CONSTRUCTION
 // [15] TYPE TRAITS
 // [19] MULTI-THREADED STRESS TEST
@@ -6527,6 +6537,89 @@ bsl::vector<int> stringSplit(bsl::string csString)
     return ret;
 }
 
+// ============================================================================
+//                          TRANSPARENT LOOKUP TEST
+// ----------------------------------------------------------------------------
+
+namespace transparent {
+
+bool keyLengthVisitor(const int& value, const bsl::string& key)
+    // Return 'true' if the specified 'value' is the length of the specified
+    // 'key', and 'false' otherwise.
+{
+    return static_cast<bsl::size_t>(value) == key.length();
+}
+
+}  // close namespace transparent
+
+// ============================================================================
+//                           LOCK-FREE READS TEST
+// ----------------------------------------------------------------------------
+
+namespace lockFree {
+
+typedef bdlcc::StripedUnorderedMap<int, bsl::string> Obj;
+
+bool appendVisitor(bsl::string *value, const int& key)
+    // Append to the specified 'value' a character determined by the specified
+    // 'key'.  Return 'true'.
+{
+    value->push_back(static_cast<char>('a' + key % 26));
+    return true;
+}
+
+bool keyLengthVisitor(const bsl::string& value, const int& key)
+    // Return 'true' if the length of the specified 'value' is at least the
+    // specified 'key', and 'false' otherwise.
+{
+    return value.length() >= static_cast<bsl::size_t>(key);
+}
+
+struct UpdateArgs {
+    // Arguments of 'updateThread'.
+
+    Obj *d_map_p;  // map to update
+    int  d_key;    // key of the element to update
+};
+
+extern "C" void *updateThread(void *arg)
+{
+    // Set the value of the element of the map described by the specified
+    // 'arg' to "updated value".
+    UpdateArgs *args = static_cast<UpdateArgs *>(arg);
+
+    args->d_map_p->setValue(args->d_key, "updated value");
+    return arg;
+}
+
+struct UpdatingVisitor {
+    // This 'struct' provides a read-only visitor that updates the visited
+    // element from another thread before inspecting the visited value.
+
+    // DATA
+    Obj *d_map_p;      // map being visited
+    int *d_numVisits;  // number of invocations
+
+    // ACCESSORS
+    bool operator()(const bsl::string& value, const int& key) const
+        // Update the element having the specified 'key' from another thread,
+        // and verify that the specified 'value' is unchanged.  Return 'true'.
+    {
+        ++*d_numVisits;
+
+        UpdateArgs                args = { d_map_p, key };
+        bslmt::ThreadUtil::Handle handle;
+
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle, updateThread, &args));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        ASSERTV(value, "original value" == value);
+        return true;
+    }
+};
+
+}  // close namespace lockFree
+
 // ============================================================================
 //                                PERFORMANCE TEST
 // ----------------------------------------------------------------------------
@@ -6772,7 +6865,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 22: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -6795,6 +6888,254 @@ int main(int argc, char *argv[])
         usage::example3();
 
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE READS
+        //
+        // Concerns:
+        //: 1 The read mode supplied at construction is reported by
+        //:   'readMode', and defaults to 'e_READ_LOCKED'.
+        //:
+        //: 2 A map in 'e_READ_LOCK_FREE' mode has the same observable
+        //:   behavior as a map in 'e_READ_LOCKED' mode.
+        //:
+        //: 3 A 'visitReadOnly(key, visitor)' visitor observes the value of
+        //:   the element at the time of the lookup, even if the element is
+        //:   updated by another thread while the visitor runs.
+        //:
+        //: 4 All memory allocated by the map, including replaced and erased
+        //:   elements, is returned on destruction.
+        //
+        // Plan:
+        //: 1 Create maps with and without a read mode, and verify the value
+        //:   returned by 'readMode'.  (C-1)
+        //:
+        //: 2 Apply the same sequence of 'insert', 'setValue', 'update',
+        //:   'setComputedValue', 'erase', and 'rehash' operations to a map in
+        //:   each mode, and verify after each step that 'getValue' and
+        //:   'visitReadOnly' report the same results for both maps.  (C-2)
+        //:
+        //: 3 From a visitor, update the visited element from another thread
+        //:   and verify that the visited value is unchanged.  (C-3)
+        //:
+        //: 4 Use a test allocator to verify that all memory is returned.
+        //:   (C-4)
+        //
+        // Testing:
+        //   StripedUnorderedMap(nIB, nS, readMode, *basicAllocator);
+        //   ReadMode readMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "LOCK-FREE READS\n"
+                          << "===============\n";
+
+        typedef bdlcc::StripedUnorderedMap<int, bsl::string> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "\t'readMode'\n";
+        {
+            Obj mX(&oa);
+            Obj mY(16, 4, Obj::e_READ_LOCKED,    &oa);
+            Obj mZ(16, 4, Obj::e_READ_LOCK_FREE, &oa);
+
+            ASSERT(Obj::e_READ_LOCKED    == mX.readMode());
+            ASSERT(Obj::e_READ_LOCKED    == mY.readMode());
+            ASSERT(Obj::e_READ_LOCK_FREE == mZ.readMode());
+            ASSERT(&oa                   == mZ.allocator());
+        }
+
+        if (veryVerbose) cout << "\tComparison with 'e_READ_LOCKED'\n";
+        {
+            const int NUM_KEYS  = 100;
+            const int NUM_STEPS = 6;
+
+            Obj mX(4, 4, Obj::e_READ_LOCKED,    &oa);  const Obj& X = mX;
+            Obj mY(4, 4, Obj::e_READ_LOCK_FREE, &oa);  const Obj& Y = mY;
+
+            Obj *const OBJS[] = { &mX, &mY };
+
+            for (int step = 0; step < NUM_STEPS; ++step) {
+                for (int j = 0; j < 2; ++j) {
+                    Obj& mZ = *OBJS[j];
+
+                    for (int i = 0; i < NUM_KEYS; ++i) {
+                        const bsl::string VALUE(i + step, 'a' + step);
+
+                        switch (step) {
+                          case 0: {
+                            mZ.insert(i, VALUE);
+                          } break;
+                          case 1: {
+                            if (i % 2) {
+                                mZ.setValue(i, VALUE);
+                            }
+                          } break;
+                          case 2: {
+                            mZ.update(i, &lockFree::appendVisitor);
+                          } break;
+                          case 3: {
+                            mZ.setComputedValue(i, &lockFree::appendVisitor);
+                          } break;
+                          case 4: {
+                            if (0 == i % 3) {
+                                mZ.erase(i);
+                            }
+                          } break;
+                          default: {
+                            mZ.insert(i + NUM_KEYS, VALUE);
+                          } break;
+                        }
+                    }
+                    if (3 == step) {
+                        mZ.rehash(mZ.bucketCount() * 4);
+                    }
+                }
+
+                ASSERTV(step, X.size(), Y.size(), X.size() == Y.size());
+
+                for (int i = 0; i < 2 * NUM_KEYS; ++i) {
+                    bsl::string xValue, yValue;
+
+                    const bsl::size_t xRc = X.getValue(&xValue, i);
+                    const bsl::size_t yRc = Y.getValue(&yValue, i);
+
+                    ASSERTV(step, i, xRc, yRc, xRc == yRc);
+                    ASSERTV(step, i, xValue, yValue, xValue == yValue);
+
+                    const Obj::ReadOnlyVisitorFunction visitor(
+                                              &lockFree::keyLengthVisitor);
+
+                    ASSERTV(step, i, X.visitReadOnly(i, visitor) ==
+                                     Y.visitReadOnly(i, visitor));
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tUpdate during 'visitReadOnly'\n";
+        {
+            Obj mX(16, 4, Obj::e_READ_LOCK_FREE, &oa);  const Obj& X = mX;
+
+            mX.insert(7, "original value");
+
+            int                       numVisits = 0;
+            lockFree::UpdatingVisitor visitor   = { &mX, &numVisits };
+
+            const Obj::ReadOnlyVisitorFunction f(bsl::allocator_arg,
+                                                 &oa,
+                                                 visitor);
+            ASSERT(1 == X.visitReadOnly(7, f));
+            ASSERT(1 == numVisits);
+
+            bsl::string value;
+            ASSERT(1 == X.getValue(&value, 7));
+            ASSERTV(value, "updated value" == value);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 22: {
+        // --------------------------------------------------------------------
+        // TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If 'HASH' and 'EQUAL' are transparent, 'getValue',
+        //:   'visitReadOnly', 'bucketIndex', and 'erase' accept a key of
+        //:   another type and operate on the element having an equivalent key.
+        //:
+        //: 2 The lookups allocate no memory, whether or not the key is found.
+        //:
+        //: 3 The visitor is passed the key of the visited element.
+        //
+        // Plan:
+        //: 1 Populate a map having 'bdlb::StringViewHash' and
+        //:   'bdlb::TransparentEqualTo', then look up each key, and a key not
+        //:   in the map, using 'bsl::string_view' and 'const char *'.  Verify
+        //:   the results, and, using test allocator monitors, that no memory
+        //:   is allocated.  (C-1..3)
+        //:
+        //: 2 Erase each key using 'bsl::string_view', and verify the map is
+        //:   empty.  (C-1)
+        //
+        // Testing:
+        //   bsl::size_t erase(const LOOKUP_KEY& key);
+        //   bsl::size_t bucketIndex(const LOOKUP_KEY& key) const;
+        //   bsl::size_t getValue(VALUE *value, const LOOKUP_KEY& key) const;
+        //   int visitReadOnly(const LOOKUP_KEY&, const ROVisitor&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TRANSPARENT LOOKUP\n"
+                          << "==================\n";
+
+        typedef bdlcc::StripedUnorderedMap<bsl::string,
+                                           int,
+                                           bdlb::StringViewHash,
+                                           bdlb::TransparentEqualTo> Obj;
+
+        const int NUM_KEYS = 64;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> keys(&sa);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            bsl::string key("a key that is too long for the short buffer ",
+                            &sa);
+            key.append(static_cast<bsl::size_t>(i), 'x');
+            keys.push_back(key);
+        }
+
+        const char *const MISSING = "a key that is not in the map at all";
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(keys[i], static_cast<int>(keys[i].length()));
+        }
+
+        const Obj::ReadOnlyVisitorFunction visitor(
+                                             &transparent::keyLengthVisitor);
+
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string_view  KEY(keys[i]);
+                const char             *CSTR = keys[i].c_str();
+                const int               EXP  =
+                                          static_cast<int>(keys[i].length());
+
+                int value = -1;
+                ASSERTV(i, 1   == X.getValue(&value, KEY));
+                ASSERTV(i, EXP == value);
+
+                value = -1;
+                ASSERTV(i, 1   == X.getValue(&value, CSTR));
+                ASSERTV(i, EXP == value);
+
+                ASSERTV(i, 1 == X.visitReadOnly(KEY,  visitor));
+                ASSERTV(i, 1 == X.visitReadOnly(CSTR, visitor));
+
+                ASSERTV(i, X.bucketIndex(keys[i]) == X.bucketIndex(KEY));
+                ASSERTV(i, X.bucketIndex(keys[i]) == X.bucketIndex(CSTR));
+            }
+
+            int value = -1;
+            ASSERT(0  == X.getValue(&value, MISSING));
+            ASSERT(-1 == value);
+            ASSERT(0  == X.visitReadOnly(bsl::string_view(MISSING), visitor));
+
+            ASSERT(oam.isInUseSame());
+            ASSERT(oam.isTotalSame());
+            ASSERT(dam.isTotalSame());
+        }
+
+        ASSERT(0 == mX.erase(MISSING));
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ASSERTV(i, 1 == mX.erase(bsl::string_view(keys[i])));
+            ASSERTV(i, 0 == mX.erase(keys[i].c_str()));
+        }
+        ASSERT(X.empty());
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // DRQS 169188100: ALLOCATOR AWARE DEFAULT CONSTRUCTION
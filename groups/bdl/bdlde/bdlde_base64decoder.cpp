@@ -14,7 +14,24 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_BASE64DECODER_SIMD_ENABLED
+# define BDLDE_BASE64DECODER_TARGET(ISA) __attribute__((target(ISA)))
+    // The SSSE3 and AVX2 implementations of the bulk decoding loop are
+    // compiled for those instruction sets by means of the 'target' attribute,
+    // and the fastest one supported by the processor is selected at run time.
+#endif
 
 namespace {
 namespace u {
@@ -174,6 +191,340 @@ static const char urlAlphabet[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+                // ========================
+                // FILE-SCOPE BULK DECODING
+                // ========================
+
+const bool *ignorableCharacters(
+                      const BloombergLP::bdlde::Base64DecoderOptions& options)
+    // Return the table of the characters ignored by a decoder configured with
+    // the specified 'options'.
+{
+    typedef BloombergLP::bdlde::Base64Alphabet   Alphabet;
+    typedef BloombergLP::bdlde::Base64IgnoreMode IgnoreMode;
+
+    return options.ignoreMode() == IgnoreMode::e_IGNORE_NONE
+         ? charsNone
+         : options.ignoreMode() == IgnoreMode::e_IGNORE_WHITESPACE
+         ? charsWhitespace
+         : options.alphabet() == Alphabet::e_BASIC
+         ? (options.isPadded() ? charsInvalidBasicEncodingPadded
+                               : charsInvalidBasicEncodingUnpadded)
+         : (options.isPadded() ? charsInvalidUrlEncodingPadded
+                               : charsInvalidUrlEncodingUnpadded);
+}
+
+typedef bsl::size_t (*DecodeBlocksFunction)(
+                               char                                  *out,
+                               const char                            *in,
+                               bsl::size_t                            numIn,
+                               BloombergLP::bdlde::Base64Alphabet::Enum
+                                                                  alphabet);
+    // Alias for a function that decodes the longest prefix of the specified
+    // 'numIn' characters at the specified 'in' address consisting of whole
+    // 4-character groups of characters of the specified 'alphabet', writes
+    // the resulting bytes to the specified 'out' buffer, and returns the
+    // number of input characters decoded.
+
+bsl::size_t decodeBlocksScalar(
+                        char                                     *out,
+                        const char                               *in,
+                        bsl::size_t                               numIn,
+                        BloombergLP::bdlde::Base64Alphabet::Enum  alphabet)
+    // Decode the longest prefix of the specified 'numIn' characters at the
+    // specified 'in' address consisting of whole 4-character groups of
+    // characters of the specified 'alphabet', write the resulting bytes to
+    // the specified 'out' buffer, and return the number of input characters
+    // decoded.
+{
+    const unsigned char *table = reinterpret_cast<const unsigned char *>(
+                   BloombergLP::bdlde::Base64Alphabet::e_BASIC == alphabet
+                   ? basicAlphabet
+                   : urlAlphabet);
+    const unsigned char *input = reinterpret_cast<const unsigned char *>(in);
+    bsl::size_t          consumed = 0;
+
+    for (; consumed + 4 <= numIn; consumed += 4, input += 4, out += 3) {
+        const unsigned int a = table[input[0]];
+        const unsigned int b = table[input[1]];
+        const unsigned int c = table[input[2]];
+        const unsigned int d = table[input[3]];
+
+        // Characters outside of the alphabet map to 0xff.
+
+        if ((a | b | c | d) & 0xc0) {
+            break;
+        }
+
+        const unsigned int word = (a << 18) | (b << 12) | (c << 6) | d;
+
+        out[0] = static_cast<char>(word >> 16);
+        out[1] = static_cast<char>(word >>  8);
+        out[2] = static_cast<char>(word);
+    }
+
+    return consumed;
+}
+
+#if defined(BDLDE_BASE64DECODER_SIMD_ENABLED)
+
+inline BDLDE_BASE64DECODER_TARGET("ssse3")
+__m128i isInRangeSsse3(__m128i input, char low, char high)
+    // Return a mask having all the bits of the byte 'i' set if and only if
+    // the character 'i' of the specified 'input' is in the range
+    // '[low .. high]' for the specified 'low' and 'high'.  Note that the
+    // characters are compared as signed values.
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(low - 1)),
+                         _mm_cmpgt_epi8(_mm_set1_epi8(high + 1), input));
+}
+
+inline BDLDE_BASE64DECODER_TARGET("ssse3")
+int decodeValuesSsse3(__m128i *values,
+                      __m128i  input,
+                      char     char62,
+                      char     char63)
+    // Load into the specified 'values' the 6-bit values of the 16 characters
+    // of the specified 'input' in the alphabet whose last two characters are
+    // the specified 'char62' and 'char63', and return a mask having the bit
+    // 'i' set if and only if the character 'i' of 'input' is in the alphabet.
+{
+    // Characters not in the 7-bit ASCII range compare as negative, and are
+    // thus in none of the ranges below.
+
+    const __m128i isUpper = isInRangeSsse3(input, 'A', 'Z');
+    const __m128i isLower = isInRangeSsse3(input, 'a', 'z');
+    const __m128i isDigit = isInRangeSsse3(input, '0', '9');
+    const __m128i is62    = _mm_cmpeq_epi8(input, _mm_set1_epi8(char62));
+    const __m128i is63    = _mm_cmpeq_epi8(input, _mm_set1_epi8(char63));
+
+    __m128i offsets = _mm_and_si128(isUpper, _mm_set1_epi8(-'A'));
+    offsets = _mm_or_si128(offsets,
+                           _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a')));
+    offsets = _mm_or_si128(offsets,
+                           _mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')));
+    offsets = _mm_or_si128(offsets,
+                           _mm_and_si128(is62,
+                                         _mm_set1_epi8(
+                                          static_cast<char>(62 - char62))));
+    offsets = _mm_or_si128(offsets,
+                           _mm_and_si128(is63,
+                                         _mm_set1_epi8(
+                                          static_cast<char>(63 - char63))));
+
+    *values = _mm_add_epi8(input, offsets);
+
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(isUpper, isLower),
+                                          _mm_or_si128(_mm_or_si128(isDigit,
+                                                                    is62),
+                                                       is63)));
+}
+
+inline BDLDE_BASE64DECODER_TARGET("ssse3")
+__m128i packValuesSsse3(__m128i values)
+    // Return the 12 bytes, in order and followed by 4 zero bytes, encoded by
+    // the specified 16 6-bit 'values'.
+{
+    // Combine pairs of 6-bit values into 12-bit values, then pairs of those
+    // into the 24-bit value of each 4-character group, and finally gather the
+    // three bytes of each group in big-endian order.
+
+    const __m128i pairs = _mm_maddubs_epi16(values,
+                                            _mm_set1_epi32(0x01400140));
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+    return _mm_shuffle_epi8(quads, _mm_setr_epi8( 2,  1,  0,
+                                                  6,  5,  4,
+                                                 10,  9,  8,
+                                                 14, 13, 12,
+                                                 -1, -1, -1, -1));
+}
+
+inline
+void storeTwelveBytes(char *out, __m128i bytes)
+    // Store the first 12 of the specified 'bytes' to the specified 'out'
+    // address.
+{
+    const int last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out), bytes);
+    bsl::memcpy(out + 8, &last, sizeof last);
+}
+
+BDLDE_BASE64DECODER_TARGET("ssse3")
+bsl::size_t decodeBlocksSsse3(
+                        char                                     *out,
+                        const char                               *in,
+                        bsl::size_t                               numIn,
+                        BloombergLP::bdlde::Base64Alphabet::Enum  alphabet)
+    // Decode the longest prefix of the specified 'numIn' characters at the
+    // specified 'in' address consisting of whole 4-character groups of
+    // characters of the specified 'alphabet', write the resulting bytes to
+    // the specified 'out' buffer, and return the number of input characters
+    // decoded.
+{
+    const bool  isBasic  = BloombergLP::bdlde::Base64Alphabet::e_BASIC ==
+                                                                      alphabet;
+    const char  char62   = isBasic ? '+' : '-';
+    const char  char63   = isBasic ? '/' : '_';
+    bsl::size_t consumed = 0;
+
+    for (; consumed + 16 <= numIn; consumed += 16, out += 12) {
+        const __m128i input = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(in + consumed));
+        __m128i       values;
+
+        if (0xffff != decodeValuesSsse3(&values, input, char62, char63)) {
+            break;
+        }
+
+        storeTwelveBytes(out, packValuesSsse3(values));
+    }
+
+    return consumed + decodeBlocksScalar(out,
+                                         in + consumed,
+                                         numIn - consumed,
+                                         alphabet);
+}
+
+inline BDLDE_BASE64DECODER_TARGET("avx2")
+__m256i isInRangeAvx2(__m256i input, char low, char high)
+    // Return a mask having all the bits of the byte 'i' set if and only if
+    // the character 'i' of the specified 'input' is in the range
+    // '[low .. high]' for the specified 'low' and 'high'.  Note that the
+    // characters are compared as signed values.
+{
+    return _mm256_and_si256(
+                         _mm256_cmpgt_epi8(input, _mm256_set1_epi8(low - 1)),
+                         _mm256_cmpgt_epi8(_mm256_set1_epi8(high + 1), input));
+}
+
+inline BDLDE_BASE64DECODER_TARGET("avx2")
+unsigned int decodeValuesAvx2(__m256i *values,
+                              __m256i  input,
+                              char     char62,
+                              char     char63)
+    // Load into the specified 'values' the 6-bit values of the 32 characters
+    // of the specified 'input' in the alphabet whose last two characters are
+    // the specified 'char62' and 'char63', and return a mask having the bit
+    // 'i' set if and only if the character 'i' of 'input' is in the alphabet.
+{
+    const __m256i isUpper = isInRangeAvx2(input, 'A', 'Z');
+    const __m256i isLower = isInRangeAvx2(input, 'a', 'z');
+    const __m256i isDigit = isInRangeAvx2(input, '0', '9');
+    const __m256i is62    = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char62));
+    const __m256i is63    = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char63));
+
+    __m256i offsets = _mm256_and_si256(isUpper, _mm256_set1_epi8(-'A'));
+    offsets = _mm256_or_si256(offsets,
+                              _mm256_and_si256(isLower,
+                                               _mm256_set1_epi8(26 - 'a')));
+    offsets = _mm256_or_si256(offsets,
+                              _mm256_and_si256(isDigit,
+                                               _mm256_set1_epi8(52 - '0')));
+    offsets = _mm256_or_si256(offsets,
+                              _mm256_and_si256(is62,
+                                               _mm256_set1_epi8(
+                                          static_cast<char>(62 - char62))));
+    offsets = _mm256_or_si256(offsets,
+                              _mm256_and_si256(is63,
+                                               _mm256_set1_epi8(
+                                          static_cast<char>(63 - char63))));
+
+    *values = _mm256_add_epi8(input, offsets);
+
+    return static_cast<unsigned int>(_mm256_movemask_epi8(
+                     _mm256_or_si256(_mm256_or_si256(isUpper, isLower),
+                                     _mm256_or_si256(_mm256_or_si256(isDigit,
+                                                                     is62),
+                                                     is63))));
+}
+
+BDLDE_BASE64DECODER_TARGET("avx2")
+bsl::size_t decodeBlocksAvx2(
+                        char                                     *out,
+                        const char                               *in,
+                        bsl::size_t                               numIn,
+                        BloombergLP::bdlde::Base64Alphabet::Enum  alphabet)
+    // Decode the longest prefix of the specified 'numIn' characters at the
+    // specified 'in' address consisting of whole 4-character groups of
+    // characters of the specified 'alphabet', write the resulting bytes to
+    // the specified 'out' buffer, and return the number of input characters
+    // decoded.
+{
+    const bool  isBasic  = BloombergLP::bdlde::Base64Alphabet::e_BASIC ==
+                                                                      alphabet;
+    const char  char62   = isBasic ? '+' : '-';
+    const char  char63   = isBasic ? '/' : '_';
+    bsl::size_t consumed = 0;
+
+    for (; consumed + 32 <= numIn; consumed += 32, out += 24) {
+        const __m256i input = _mm256_loadu_si256(
+                           reinterpret_cast<const __m256i *>(in + consumed));
+        __m256i       values;
+
+        if (0xffffffffu != decodeValuesAvx2(&values, input, char62, char63)) {
+            break;
+        }
+
+        // Pack each 128-bit lane as in 'packValuesSsse3'.
+
+        const __m256i pairs = _mm256_maddubs_epi16(
+                                               values,
+                                               _mm256_set1_epi32(0x01400140));
+        const __m256i quads = _mm256_madd_epi16(pairs,
+                                                _mm256_set1_epi32(0x00011000));
+        const __m256i bytes = _mm256_shuffle_epi8(
+                                   quads,
+                                   _mm256_setr_epi8( 2,  1,  0,  6,  5,  4,
+                                                    10,  9,  8, 14, 13, 12,
+                                                    -1, -1, -1, -1,
+                                                     2,  1,  0,  6,  5,  4,
+                                                    10,  9,  8, 14, 13, 12,
+                                                    -1, -1, -1, -1));
+
+        storeTwelveBytes(out,      _mm256_castsi256_si128(bytes));
+        storeTwelveBytes(out + 12, _mm256_extracti128_si256(bytes, 1));
+    }
+
+    return consumed + decodeBlocksSsse3(out,
+                                        in + consumed,
+                                        numIn - consumed,
+                                        alphabet);
+}
+
+#endif  // BDLDE_BASE64DECODER_SIMD_ENABLED
+
+DecodeBlocksFunction selectDecodeBlocksFunction()
+    // Return the fastest implementation of the bulk decoding loop supported
+    // by the processor.
+{
+#if defined(BDLDE_BASE64DECODER_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return &decodeBlocksAvx2;                                     // RETURN
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return &decodeBlocksSsse3;                                    // RETURN
+    }
+#endif
+    return &decodeBlocksScalar;
+}
+
+DecodeBlocksFunction decodeBlocksFunction()
+    // Return the fastest implementation of the bulk decoding loop supported
+    // by the processor, selecting it on the first call.
+{
+    static DecodeBlocksFunction s_decodeBlocks = 0;
+
+    BSLMT_ONCE_DO {
+        s_decodeBlocks = selectDecodeBlocksFunction();
+    }
+
+    return s_decodeBlocks;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -184,20 +535,130 @@ namespace bdlde {
                          // class Base64Decoder
                          // -------------------
 
+// CLASS METHODS
+int Base64Decoder::decode(char                        *out,
+                          bsl::size_t                 *numOut,
+                          const char                  *in,
+                          bsl::size_t                  numIn,
+                          const Base64DecoderOptions&  options)
+{
+    BSLS_ASSERT(out || 0 == numIn);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(in  || 0 == numIn);
+
+    const u::DecodeBlocksFunction  decodeBlocks = u::decodeBlocksFunction();
+    const unsigned char           *table        =
+                                       reinterpret_cast<const unsigned char *>(
+                                                 e_BASIC == options.alphabet()
+                                                 ? u::basicAlphabet
+                                                 : u::urlAlphabet);
+    const bool                    *ignorable    =
+                                              u::ignorableCharacters(options);
+    const char *const              end          = in + numIn;
+    char                          *output       = out;
+    unsigned int                   word         = 0;  // current group
+    int                            numValues    = 0;  // values in 'word'
+    bool                           hasPadding   = false;
+
+    // Alternate between decoding runs of whole groups in bulk, and decoding
+    // the remaining characters (ignorable characters, padding, and the
+    // groups interrupted by either) one at a time, as 'convert' does.
+
+    while (in != end) {
+        if (0 == numValues) {
+            const bsl::size_t consumed = decodeBlocks(output,
+                                                      in,
+                                                      end - in,
+                                                      options.alphabet());
+            in     += consumed;
+            output += consumed / 4 * 3;
+
+            if (in == end) {
+                break;
+            }
+        }
+
+        const unsigned char byte  = static_cast<unsigned char>(*in++);
+        const unsigned int  value = table[byte];
+
+        if (value < 64) {
+            word = (word << 6) | value;
+            if (4 == ++numValues) {
+                output[0]  = static_cast<char>(word >> 16);
+                output[1]  = static_cast<char>(word >>  8);
+                output[2]  = static_cast<char>(word);
+                output    += 3;
+                word       = 0;
+                numValues  = 0;
+            }
+        }
+        else if (!ignorable[byte]) {
+            if ('=' != byte || !options.isPadded() || numValues < 2) {
+                return -1;                                            // RETURN
+            }
+
+            // A group of 2 (respectively 3) values is completed by 2
+            // (respectively 1) '=', after which only ignorable characters may
+            // follow.
+
+            int numEquals = 4 - numValues - 1;
+
+            for (; in != end; ++in) {
+                const unsigned char next = static_cast<unsigned char>(*in);
+
+                if (ignorable[next]) {
+                    continue;
+                }
+                if ('=' != next || 0 == numEquals) {
+                    return -1;                                        // RETURN
+                }
+                --numEquals;
+            }
+
+            if (0 != numEquals) {
+                return -1;                                            // RETURN
+            }
+            hasPadding = true;
+        }
+    }
+
+    if (options.isPadded() && 0 != numValues && !hasPadding) {
+        return -1;                                                    // RETURN
+    }
+
+    // The bits of the last group past its last full byte must be zero.
+
+    switch (numValues) {
+      case 1: {
+        return -1;                                                    // RETURN
+      }
+      case 2: {
+        if (word & 0x0f) {
+            return -1;                                                // RETURN
+        }
+        *output++ = static_cast<char>(word >> 4);
+      } break;
+      case 3: {
+        if (word & 0x03) {
+            return -1;                                                // RETURN
+        }
+        output[0]  = static_cast<char>(word >> 10);
+        output[1]  = static_cast<char>(word >>  2);
+        output    += 2;
+      } break;
+    }
+
+    *numOut = output - out;
+
+    return 0;
+}
+
 // CREATORS
 Base64Decoder::Base64Decoder(const Base64DecoderOptions& options)
 : d_outputLength(0)
 , d_alphabet_p(e_BASIC == options.alphabet() ? u::basicAlphabet
                                              : u::urlAlphabet)
-, d_ignorable_p(options.ignoreMode() == IgnoreMode::e_IGNORE_NONE
-              ? u::charsNone
-              : options.ignoreMode() == IgnoreMode::e_IGNORE_WHITESPACE
-              ? u::charsWhitespace
-              : options.alphabet() == e_BASIC
-              ? (options.isPadded() ? u::charsInvalidBasicEncodingPadded
-                                    : u::charsInvalidBasicEncodingUnpadded)
-              : (options.isPadded() ? u::charsInvalidUrlEncodingPadded
-                                    : u::charsInvalidUrlEncodingUnpadded))
+, d_ignorable_p(u::ignorableCharacters(options))
 , d_stack(0)
 , d_bitsInStack(0)
 , d_state(e_INPUT_STATE)
@@ -191,6 +191,20 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Bulk Decoding
+///-------------
+// When the entire input is available in a contiguous buffer, the class method
+// 'bdlde::Base64Decoder::decode' produces the same output, and accepts the
+// same inputs, as a 'convert' followed by an 'endConvert' on a decoder
+// configured with the same options, but does so without the per-character
+// overhead of the streaming interface.  Runs of input consisting solely of
+// characters of the alphabet are decoded four characters at a time and, on
+// x86-64 processors supporting SSSE3 or AVX2, 16 (respectively 32) characters
+// at a time using vector instructions; the instruction set is selected at run
+// time.  Ignorable characters, padding, and errors are handled by a scalar
+// loop, so inputs broken into short lines decode somewhat more slowly than
+// unbroken ones.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -444,6 +458,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iostream.h>
 
 namespace BloombergLP {
@@ -525,6 +540,24 @@ class Base64Decoder {
 
   public:
     // CLASS METHODS
+    static int decode(char                        *out,
+                      bsl::size_t                 *numOut,
+                      const char                  *in,
+                      bsl::size_t                  numIn,
+                      const Base64DecoderOptions&  options);
+        // Decode the specified 'numIn' characters starting at the specified
+        // 'in' address, writing the resulting bytes to the specified 'out'
+        // buffer, according to the specified 'options'.  Load into the
+        // specified 'numOut' the number of bytes written.  Return 0 on
+        // success, and a non-zero value if the input is not a complete, valid
+        // Base64 encoding under 'options', in which case the contents of
+        // 'out' and the value of '*numOut' are unspecified.  The behavior is
+        // undefined unless 'out' refers to a buffer of at least
+        // '(numIn + 3) / 4 * 3' bytes (see 'maxDecodedLength') that does not
+        // overlap '[in, in + numIn)'.  Note that this method succeeds exactly
+        // when a 'convert' followed by an 'endConvert' on a decoder
+        // constructed with 'options' succeeds, and produces the same output.
+
     static int maxDecodedLength(int inputLength);
         // Return the maximum number of decoded bytes that could result from an
         // input byte sequence of the specified 'inputLength' provided to the
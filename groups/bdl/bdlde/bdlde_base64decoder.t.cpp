@@ -209,6 +209,7 @@ using bsl::ptrdiff_t;
 // for the decoder; we will therefore ensure (using metafunctions) that no
 // default constructor can be instantiated.
 //-----------------------------------------------------------------------------
+// [15] static int decode(char *, size_t *, const char *, size_t, options);
 // [ 2] bdlde::Base64Decoder(int unrecognizedIsErrorFlag);
 // [ 3] ~bdlde::Base64Decoder();
 // [ 6] int LLVMFuzzerTestOneInput(const uint8_t *, size_t);
@@ -2393,6 +2394,155 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(15)
+{
+    // ------------------------------------------------------------------------
+    // BULK DECODING: 'decode'
+    //
+    // Concerns:
+    //: 1 'decode' succeeds exactly when 'convert' followed by 'endConvert' on
+    //:   a decoder configured with the same options succeeds, and then
+    //:   produces the same output.
+    //:
+    //: 2 Runs of valid input long enough to be decoded in bulk are decoded
+    //:   correctly regardless of their alignment, and regardless of the
+    //:   position of the whitespace, garbage, and padding interrupting them.
+    //:
+    //: 3 'decode' writes no bytes past the number it reports.
+    //
+    // Plan:
+    //: 1 Encode random byte strings of lengths up to 300 bytes, with each
+    //:   alphabet, with and without padding, and with maximum line lengths of
+    //:   0, 3, and 76.  Depending on random choices, inject whitespace,
+    //:   garbage, or both, into the encoding with 'u::RandGen', and remove or
+    //:   replace its final character.
+    //:
+    //: 2 For each ignore mode and padding option, decode the input with
+    //:   'convert' and 'endConvert', then with 'decode' into a buffer of
+    //:   'maxDecodedLength' bytes followed by sentinel bytes, at an offset
+    //:   varying with the iteration.  Verify that both methods agree on
+    //:   success, and that on success both produce the same output, and the
+    //:   sentinel bytes are unchanged.  (C-1..3)
+    //
+    // Testing:
+    //   static int decode(char *, size_t *, const char *, size_t, options);
+    // ------------------------------------------------------------------------
+
+    (void)veryVeryVeryVerbose;
+    (void)veryVeryVerbose;
+
+    if (verbose) cout << "BULK DECODING: 'decode'\n"
+                         "=======================\n";
+
+    static const int  LINE_LENGTHS[]   = { 0, 3, 76 };
+    static const int  NUM_LINE_LENGTHS = sizeof LINE_LENGTHS /
+                                                        sizeof *LINE_LENGTHS;
+    static const char SENTINEL         = '\xa5';
+
+    u::RandGen  rand;
+    bsl::string data;
+    bsl::string input;
+    bsl::string expected;
+    int         numSuccesses = 0;
+
+    for (int len = 0; len <= 300; ++len) {
+        rand.randString(&data, len);
+
+        for (int ti = 0; ti < 2 * 2 * NUM_LINE_LENGTHS; ++ti) {
+            const bool        URL         = ti & 1;
+            const bool        PAD         = ti & 2;
+            const int         LINE_LENGTH = LINE_LENGTHS[ti / 4];
+            const Alpha::Enum ALPHA       = URL ? Alpha::e_URL
+                                                : Alpha::e_BASIC;
+
+            const EncoderOptions encoderOptions = EncoderOptions::custom(
+                                                                   LINE_LENGTH,
+                                                                   ALPHA,
+                                                                   PAD);
+
+            bdlde::Base64Encoder encoder(encoderOptions);
+
+            input.clear();
+            ASSERT(0 == encoder.convert(bsl::back_inserter(input),
+                                        data.begin(),
+                                        data.end()));
+            ASSERT(0 == encoder.endConvert(bsl::back_inserter(input)));
+
+            const unsigned choice = rand();
+
+            if (choice & 0x01) {
+                rand.injectWhitespace(&input);
+            }
+            if (0 == (choice & 0x06)) {
+                rand.injectGarbage(&input, !PAD, URL);
+            }
+            if (0 == (choice & 0x38) && !input.empty()) {
+                input.resize(input.length() - 1);
+            }
+            if (0x08 == (choice & 0x38) && !input.empty()) {
+                input[input.length() - 1] = rand.getChar();
+            }
+
+            for (int oi = 0; oi < 2 * k_NUM_IGNORE; ++oi) {
+                const bool         DECODE_PAD = oi & 1;
+                const Ignore::Enum IGNORE     =
+                                            static_cast<Ignore::Enum>(oi / 2);
+
+                const Options options = Options::custom(IGNORE,
+                                                        ALPHA,
+                                                        DECODE_PAD);
+
+                Obj  decoder(options);
+                bool success = false;
+
+                expected.clear();
+                if (0 <= decoder.convert(bsl::back_inserter(expected),
+                                         input.begin(),
+                                         input.end())) {
+                    success = 0 == decoder.endConvert(
+                                                bsl::back_inserter(expected));
+                }
+
+                const int    INPUT_LENGTH = static_cast<int>(input.length());
+                const size_t MAX_LENGTH   = Obj::maxDecodedLength(
+                                                                INPUT_LENGTH);
+                const size_t OFFSET       = (len + ti + oi) % 8;
+
+                bsl::vector<char> buffer(OFFSET + MAX_LENGTH + 8, SENTINEL);
+                char *const       out    = buffer.data() + OFFSET;
+                size_t            numOut = 0;
+
+                const int rc = Obj::decode(out,
+                                           &numOut,
+                                           input.data(),
+                                           input.length(),
+                                           options);
+
+                ASSERTV(len, ti, oi, success, rc, success == (0 == rc));
+
+                if (success && 0 == rc) {
+                    ++numSuccesses;
+
+                    ASSERTV(len, ti, oi, expected.length(), numOut,
+                            expected.length() == numOut);
+                    ASSERTV(len, ti, oi,
+                            0 == bsl::memcmp(out,
+                                             expected.data(),
+                                             expected.length()));
+
+                    for (size_t ii = numOut; ii < MAX_LENGTH + 8; ++ii) {
+                        ASSERTV(len, ti, oi, ii, SENTINEL == out[ii]);
+                    }
+                }
+            }
+        }
+    }
+
+    if (veryVerbose) {
+        P(numSuccesses);
+    }
+}
+
 DEFINE_TEST_CASE(14)
 {
     // ------------------------------------------------------------------------
@@ -8043,6 +8193,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(15);
         CASE(14);
         CASE(13);
         CASE(12);
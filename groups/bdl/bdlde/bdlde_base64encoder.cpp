@@ -12,7 +12,24 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_BASE64ENCODER_SIMD_ENABLED
+# define BDLDE_BASE64ENCODER_TARGET(ISA) __attribute__((target(ISA)))
+    // The SSSE3 and AVX2 implementations of the bulk encoding loop are
+    // compiled for those instruction sets by means of the 'target' attribute,
+    // and the fastest one supported by the processor is selected at run time.
+#endif
 
 namespace {
 namespace u {
@@ -51,6 +68,282 @@ const char base64url[] = {
     '4', '5', '6', '7', '8', '9', '-', '_',  // 070
 };
 
+                // ========================
+                // FILE-SCOPE BULK ENCODING
+                // ========================
+
+typedef bsl::size_t (*EncodeBlocksFunction)(char        *out,
+                                            const char  *in,
+                                            bsl::size_t  numIn,
+                                            const char  *alphabet);
+    // Alias for a function that encodes, using the specified 'alphabet', the
+    // longest prefix of the specified 'numIn' bytes at the specified 'in'
+    // address consisting of whole 3-byte groups, writes the resulting
+    // characters to the specified 'out' buffer, and returns the number of
+    // input bytes encoded.
+
+bsl::size_t encodeBlocksScalar(char        *out,
+                               const char  *in,
+                               bsl::size_t  numIn,
+                               const char  *alphabet)
+    // Encode, using the specified 'alphabet', the longest prefix of the
+    // specified 'numIn' bytes at the specified 'in' address consisting of
+    // whole 3-byte groups, write the resulting characters to the specified
+    // 'out' buffer, and return the number of input bytes encoded.
+{
+    const unsigned char *input     = reinterpret_cast<const unsigned char *>(
+                                                                           in);
+    const bsl::size_t    numBlocks = numIn / 3;
+
+    for (bsl::size_t i = 0; i < numBlocks; ++i, input += 3, out += 4) {
+        const unsigned int word = (static_cast<unsigned int>(input[0]) << 16)
+                                | (static_cast<unsigned int>(input[1]) <<  8)
+                                |  static_cast<unsigned int>(input[2]);
+
+        out[0] = alphabet[ word >> 18        ];
+        out[1] = alphabet[(word >> 12) & 0x3f];
+        out[2] = alphabet[(word >>  6) & 0x3f];
+        out[3] = alphabet[ word        & 0x3f];
+    }
+
+    return numBlocks * 3;
+}
+
+#if defined(BDLDE_BASE64ENCODER_SIMD_ENABLED)
+
+__m128i encodingOffsets(const char *alphabet)
+    // Return the table of the values to add to a 6-bit index to obtain the
+    // corresponding character of the specified 'alphabet', indexed by the
+    // reduced index computed by 'encodeCharactersSsse3' and
+    // 'encodeCharactersAvx2'.
+{
+    return _mm_setr_epi8('a' - 26,
+                         '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                         '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                         static_cast<char>(alphabet[62] - 62),
+                         static_cast<char>(alphabet[63] - 63),
+                         'A',
+                         0,
+                         0);
+}
+
+inline BDLDE_BASE64ENCODER_TARGET("ssse3")
+__m128i encodeIndicesSsse3(__m128i input)
+    // Return the 16 6-bit indices, in order, encoding the first 12 bytes of
+    // the specified 'input'.
+{
+    // Rearrange each 3-byte group 'a b c' into the 32-bit lane 'b a c b', so
+    // that each index is a contiguous bit field of one of the 16-bit halves,
+    // then move each index to its byte by means of multiplications.
+
+    input = _mm_shuffle_epi8(input, _mm_setr_epi8(1,  0,  2,  1,
+                                                  4,  3,  5,  4,
+                                                  7,  6,  8,  7,
+                                                 10,  9, 11, 10));
+
+    const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+    return _mm_or_si128(t1, t3);
+}
+
+inline BDLDE_BASE64ENCODER_TARGET("ssse3")
+__m128i encodeCharactersSsse3(__m128i indices, __m128i offsets)
+    // Return the characters corresponding to the specified 16 'indices' using
+    // the specified 'offsets' table (see 'encodingOffsets').
+{
+    // Reduce '[0 .. 25]' to 13, '[26 .. 51]' to 0, and '[52 .. 63]' to
+    // '[1 .. 12]'.
+
+    const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    const __m128i reduced = _mm_or_si128(
+                                 _mm_subs_epu8(indices, _mm_set1_epi8(51)),
+                                 _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, reduced));
+}
+
+BDLDE_BASE64ENCODER_TARGET("ssse3")
+bsl::size_t encodeBlocksSsse3(char        *out,
+                              const char  *in,
+                              bsl::size_t  numIn,
+                              const char  *alphabet)
+    // Encode, using the specified 'alphabet', the longest prefix of the
+    // specified 'numIn' bytes at the specified 'in' address consisting of
+    // whole 3-byte groups, write the resulting characters to the specified
+    // 'out' buffer, and return the number of input bytes encoded.
+{
+    const __m128i offsets  = encodingOffsets(alphabet);
+    bsl::size_t   consumed = 0;
+
+    // Each iteration loads 16 bytes but encodes only the first 12.
+
+    for (; consumed + 16 <= numIn; consumed += 12, out += 16) {
+        const __m128i input = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(in + consumed));
+
+        const __m128i indices = encodeIndicesSsse3(input);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         encodeCharactersSsse3(indices, offsets));
+    }
+
+    return consumed + encodeBlocksScalar(out,
+                                         in + consumed,
+                                         numIn - consumed,
+                                         alphabet);
+}
+
+inline BDLDE_BASE64ENCODER_TARGET("avx2")
+__m256i encodeIndicesAvx2(__m256i input)
+    // Return the 32 6-bit indices, in order within each 128-bit lane,
+    // encoding the first 12 bytes of each 128-bit lane of the specified
+    // 'input'.
+{
+    input = _mm256_shuffle_epi8(input, _mm256_setr_epi8(1,  0,  2,  1,
+                                                        4,  3,  5,  4,
+                                                        7,  6,  8,  7,
+                                                       10,  9, 11, 10,
+                                                        1,  0,  2,  1,
+                                                        4,  3,  5,  4,
+                                                        7,  6,  8,  7,
+                                                       10,  9, 11, 10));
+
+    const __m256i t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+    return _mm256_or_si256(t1, t3);
+}
+
+inline BDLDE_BASE64ENCODER_TARGET("avx2")
+__m256i encodeCharactersAvx2(__m256i indices, __m256i offsets)
+    // Return the characters corresponding to the specified 32 'indices' using
+    // the specified 'offsets' table (see 'encodingOffsets') repeated in both
+    // 128-bit lanes.
+{
+    const __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    const __m256i reduced = _mm256_or_si256(
+                            _mm256_subs_epu8(indices, _mm256_set1_epi8(51)),
+                            _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+
+    return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, reduced));
+}
+
+BDLDE_BASE64ENCODER_TARGET("avx2")
+bsl::size_t encodeBlocksAvx2(char        *out,
+                             const char  *in,
+                             bsl::size_t  numIn,
+                             const char  *alphabet)
+    // Encode, using the specified 'alphabet', the longest prefix of the
+    // specified 'numIn' bytes at the specified 'in' address consisting of
+    // whole 3-byte groups, write the resulting characters to the specified
+    // 'out' buffer, and return the number of input bytes encoded.
+{
+    const __m256i offsets  = _mm256_broadcastsi128_si256(
+                                                   encodingOffsets(alphabet));
+    bsl::size_t   consumed = 0;
+
+    // Each iteration loads 12 bytes into each 128-bit lane, reading 4 bytes
+    // past them.
+
+    for (; consumed + 28 <= numIn; consumed += 24, out += 32) {
+        const __m128i low  = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(in + consumed));
+        const __m128i high = _mm_loadu_si128(
+                      reinterpret_cast<const __m128i *>(in + consumed + 12));
+        const __m256i input = _mm256_inserti128_si256(
+                                      _mm256_castsi128_si256(low), high, 1);
+
+        const __m256i indices = encodeIndicesAvx2(input);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            encodeCharactersAvx2(indices, offsets));
+    }
+
+    return consumed + encodeBlocksSsse3(out,
+                                        in + consumed,
+                                        numIn - consumed,
+                                        alphabet);
+}
+
+#endif  // BDLDE_BASE64ENCODER_SIMD_ENABLED
+
+EncodeBlocksFunction selectEncodeBlocksFunction()
+    // Return the fastest implementation of the bulk encoding loop supported
+    // by the processor.
+{
+#if defined(BDLDE_BASE64ENCODER_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return &encodeBlocksAvx2;                                     // RETURN
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return &encodeBlocksSsse3;                                    // RETURN
+    }
+#endif
+    return &encodeBlocksScalar;
+}
+
+EncodeBlocksFunction encodeBlocksFunction()
+    // Return the fastest implementation of the bulk encoding loop supported
+    // by the processor, selecting it on the first call.
+{
+    static EncodeBlocksFunction s_encodeBlocks = 0;
+
+    BSLMT_ONCE_DO {
+        s_encodeBlocks = selectEncodeBlocksFunction();
+    }
+
+    return s_encodeBlocks;
+}
+
+bsl::size_t encodeLine(char                 *out,
+                       const char           *in,
+                       bsl::size_t           numIn,
+                       const char           *alphabet,
+                       bool                  isPadded,
+                       EncodeBlocksFunction  encodeBlocks)
+    // Encode, using the specified 'alphabet', the specified 'numIn' bytes at
+    // the specified 'in' address, followed by '=' padding if the specified
+    // 'isPadded' is 'true', without line breaks, write the resulting
+    // characters to the specified 'out' buffer, and return the number of
+    // characters written.  Use the specified 'encodeBlocks' to encode the
+    // whole 3-byte groups of the input.
+{
+    const bsl::size_t    consumed = encodeBlocks(out, in, numIn, alphabet);
+    const unsigned char *input    = reinterpret_cast<const unsigned char *>(
+                                                                in + consumed);
+    char                *output   = out + consumed / 3 * 4;
+
+    switch (numIn - consumed) {
+      case 2: {
+        output[0] = alphabet[input[0] >> 2];
+        output[1] = alphabet[((input[0] & 0x03) << 4) | (input[1] >> 4)];
+        output[2] = alphabet[(input[1] & 0x0f) << 2];
+        output   += 3;
+        if (isPadded) {
+            *output++ = '=';
+        }
+      } break;
+      case 1: {
+        output[0] = alphabet[input[0] >> 2];
+        output[1] = alphabet[(input[0] & 0x03) << 4];
+        output   += 2;
+        if (isPadded) {
+            *output++ = '=';
+            *output++ = '=';
+        }
+      } break;
+    }
+
+    return output - out;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -61,6 +354,81 @@ namespace bdlde {
                          // class Base64Encoder
                          // -------------------
 
+// CLASS METHODS
+bsl::size_t Base64Encoder::encode(char                  *out,
+                                  const char            *in,
+                                  bsl::size_t            numIn,
+                                  const EncoderOptions&  options)
+{
+    BSLS_ASSERT(out || 0 == numIn);
+    BSLS_ASSERT(in  || 0 == numIn);
+
+    const char *const              alphabet      =
+                                                 e_BASIC == options.alphabet()
+                                                 ? u::base64
+                                                 : u::base64url;
+    const bool                     isPadded      = options.isPadded();
+    const bsl::size_t              maxLineLength = options.maxLineLength();
+    const bsl::size_t              length        = lengthWithoutCrlfs(options,
+                                                                      numIn);
+    const u::EncodeBlocksFunction  encodeBlocks  = u::encodeBlocksFunction();
+
+    if (0 == maxLineLength || length <= maxLineLength) {
+        return u::encodeLine(out,
+                             in,
+                             numIn,
+                             alphabet,
+                             isPadded,
+                             encodeBlocks);                           // RETURN
+    }
+
+    const bsl::size_t totalLength = encodedLength(options, numIn);
+    const bsl::size_t numCrlfs    = (totalLength - length) / 2;
+
+    if (0 == maxLineLength % 4) {
+        // Each full line encodes a whole number of 3-byte groups, so each
+        // line can be encoded directly into its final position.
+
+        const bsl::size_t lineInput = maxLineLength / 4 * 3;
+
+        for (bsl::size_t i = 0; i < numCrlfs; ++i) {
+            encodeBlocks(out, in, lineInput, alphabet);
+            out   += maxLineLength;
+            *out++ = '\r';
+            *out++ = '\n';
+            in    += lineInput;
+            numIn -= lineInput;
+        }
+        u::encodeLine(out, in, numIn, alphabet, isPadded, encodeBlocks);
+
+        return totalLength;                                           // RETURN
+    }
+
+    // Otherwise, encode the input as a single line at the end of 'out', then
+    // move each line to its final position, inserting the CRLFs.  No line is
+    // moved past the start of the next one, and the last line is already in
+    // its final position.
+
+    const char *line = out + 2 * numCrlfs;
+
+    u::encodeLine(out + 2 * numCrlfs,
+                  in,
+                  numIn,
+                  alphabet,
+                  isPadded,
+                  encodeBlocks);
+
+    for (bsl::size_t i = 0; i < numCrlfs; ++i) {
+        bsl::memmove(out, line, maxLineLength);
+        out   += maxLineLength;
+        *out++ = '\r';
+        *out++ = '\n';
+        line  += maxLineLength;
+    }
+
+    return totalLength;
+}
+
 // CREATORS
 Base64Encoder::Base64Encoder(const EncoderOptions& options)
 : d_maxLineLength(options.maxLineLength())
@@ -191,6 +191,17 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Bulk Encoding
+///-------------
+// When the entire input is available in a contiguous buffer, the class method
+// 'bdlde::Base64Encoder::encode' produces the same output as a 'convert'
+// followed by an 'endConvert' on an encoder configured with the same options,
+// but does so without the per-character overhead of the streaming interface.
+// On x86-64 processors supporting SSSE3 or AVX2, the bulk of the input is
+// encoded 12 (respectively 24) bytes at a time using vector instructions; the
+// instruction set is selected at run time.  The caller supplies an output
+// buffer of at least 'encodedLength(options, numIn)' bytes.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -530,6 +541,22 @@ class Base64Encoder {
 
   public:
     // CLASS METHODS
+    static bsl::size_t encode(
+                      char                  *out,
+                      const char            *in,
+                      bsl::size_t            numIn,
+                      const EncoderOptions&  options = EncoderOptions::mime());
+        // Encode the specified 'numIn' bytes starting at the specified 'in'
+        // address, writing the resulting characters to the specified 'out'
+        // buffer, according to the optionally specified 'options'.  If
+        // 'options' is not specified, 'EncoderOptions::mime()' is used.
+        // Return the number of characters written, which is
+        // 'encodedLength(options, numIn)'.  The behavior is undefined unless
+        // 'out' refers to a buffer of at least that many bytes that does not
+        // overlap '[in, in + numIn)'.  Note that the output is identical to
+        // that of a 'convert' followed by an 'endConvert' on an encoder
+        // constructed with 'options'.
+
     static bsl::size_t encodedLength(const EncoderOptions& options,
                                      bsl::size_t           inputLength);
         // Return the exact number of encoded bytes that would result from an
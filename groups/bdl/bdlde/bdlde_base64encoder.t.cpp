@@ -122,6 +122,7 @@ using bsl::ptrdiff_t;
 // arguments, 'bdeut::InputIterator' for 'convert' and 'bdeut::OutputIterator'
 // for both of these template methods.
 //-----------------------------------------------------------------------------
+// [15] static size_t encode(char *, const char *, size_t, options);
 // [ 8] static int encodedLength(int numInputBytes, int maxLineLength);
 // [11] bdlde::Base64Encoder(Alphabet alphabet);
 // [ 2] bdlde::Base64Encoder(int maxLineLength, Alphabet alphabet);
@@ -141,7 +142,7 @@ using bsl::ptrdiff_t;
 // [ 3] int outputLength() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [14] 0 == U_ENABLE_DEPRECATIONS
 // [ ?] That the input iterator can have *minimal* functionality.
 // [ ?] That the output iterator can have *minimal* functionality.
@@ -1924,7 +1925,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Demonstrate that the example compiles, links, and runs.
@@ -1978,6 +1979,128 @@ int main(int argc, char *argv[])
 
         ASSERT(inStr == backInStream.str());
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // BULK ENCODING: 'encode'
+        //
+        // Concerns:
+        //: 1 'encode' produces the same output as 'convert' followed by
+        //:   'endConvert' on an encoder configured with the same options,
+        //:   for each alphabet, with and without padding.
+        //:
+        //: 2 Line breaks are inserted correctly whether or not the maximum
+        //:   line length is a multiple of 4, and no line break follows the
+        //:   last character.
+        //:
+        //: 3 Inputs long enough to be encoded in bulk are encoded correctly
+        //:   regardless of their alignment.
+        //:
+        //: 4 'encode' returns, and writes exactly, 'encodedLength' characters.
+        //:
+        //: 5 If 'options' is not specified, MIME options are used.
+        //
+        // Plan:
+        //: 1 For random byte strings of every length up to 300 bytes, and for
+        //:   each alphabet, padding, and a set of maximum line lengths
+        //:   including 0, 1, multiples of 4, and others, encode the input with
+        //:   'convert' and 'endConvert', then with 'encode', reading from an
+        //:   offset and writing to a buffer at an offset varying with the
+        //:   iteration and followed by sentinel bytes.  Verify that the
+        //:   results are the same, and that the sentinel bytes are unchanged.
+        //:   (C-1..4)
+        //:
+        //: 2 Encode a string with and without specifying MIME options, and
+        //:   verify that the results are the same.  (C-5)
+        //
+        // Testing:
+        //   static size_t encode(char *, const char *, size_t, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK ENCODING: 'encode'" << endl
+                          << "=======================" << endl;
+
+        static const int  LINE_LENGTHS[]   = { 0, 1, 2, 3, 4, 5, 8, 13,
+                                               72, 76, 77, 100 };
+        static const int  NUM_LINE_LENGTHS = sizeof LINE_LENGTHS /
+                                                         sizeof *LINE_LENGTHS;
+        static const char SENTINEL         = '\xa5';
+
+        bsl::vector<char> data;
+        bsl::string       expected;
+        unsigned          seed = 12345;
+
+        if (verbose) cout << "\tCompare with 'convert' and 'endConvert'.\n";
+
+        for (int len = 0; len <= 300; ++len) {
+            const size_t IN_OFFSET = len % 8;
+
+            data.resize(IN_OFFSET + len);
+            for (size_t ii = 0; ii < data.size(); ++ii) {
+                seed     = seed * 1103515245 + 12345;
+                data[ii] = static_cast<char>(seed >> 16);
+            }
+            const char *const IN = data.data() + IN_OFFSET;
+
+            for (int ti = 0; ti < 2 * 2 * NUM_LINE_LENGTHS; ++ti) {
+                const bool            URL         = ti & 1;
+                const bool            PAD         = ti & 2;
+                const int             LINE_LENGTH = LINE_LENGTHS[ti / 4];
+                const Alphabet::Enum  ALPHA       = URL ? Alphabet::e_URL
+                                                        : Alphabet::e_BASIC;
+
+                const EncoderOptions options = EncoderOptions::custom(
+                                                                   LINE_LENGTH,
+                                                                   ALPHA,
+                                                                   PAD);
+
+                Obj encoder(options);
+
+                expected.clear();
+                ASSERT(0 == encoder.convert(bsl::back_inserter(expected),
+                                            IN,
+                                            IN + len));
+                ASSERT(0 == encoder.endConvert(bsl::back_inserter(expected)));
+
+                const size_t LENGTH     = Obj::encodedLength(options, len);
+                const size_t OUT_OFFSET = (len + ti) % 8;
+
+                ASSERTV(len, ti, expected.length() == LENGTH);
+
+                bsl::vector<char> buffer(OUT_OFFSET + LENGTH + 8, SENTINEL);
+                char *const       out = buffer.data() + OUT_OFFSET;
+
+                const size_t numOut = Obj::encode(out, IN, len, options);
+
+                ASSERTV(len, ti, numOut, LENGTH, LENGTH == numOut);
+                ASSERTV(len, ti,
+                        0 == bsl::memcmp(out, expected.data(), LENGTH));
+
+                for (size_t ii = LENGTH; ii < LENGTH + 8; ++ii) {
+                    ASSERTV(len, ti, ii, SENTINEL == out[ii]);
+                }
+                if (veryVeryVerbose) {
+                    P_(len) P_(ti) P(expected);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tDefault options.\n";
+        {
+            const size_t LENGTH = Obj::encodedLength(EncoderOptions::mime(),
+                                                     data.size());
+
+            bsl::vector<char> x(LENGTH);
+            bsl::vector<char> y(LENGTH);
+
+            ASSERT(LENGTH == Obj::encode(x.data(), data.data(), data.size()));
+            ASSERT(LENGTH == Obj::encode(y.data(),
+                                         data.data(),
+                                         data.size(),
+                                         EncoderOptions::mime()));
+            ASSERT(x == y);
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // ENSURE U_ENABLE_DEPRECATIONS IS DISABLED
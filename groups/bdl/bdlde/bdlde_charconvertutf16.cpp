@@ -19,11 +19,16 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -343,13 +348,19 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t atMost(bsl::size_t rhs) const
+        // Return the lesser of 'd_capacity' and the specified 'rhs'.
+    {
+        return d_capacity < rhs ? d_capacity : rhs;
+    }
 };
 
 struct NoOpCapacity {
@@ -363,12 +374,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t atMost(bsl::size_t rhs) const { return rhs; }
+        // Return the specified 'rhs'.
 };
 
 // LOCAL HELPER STRUCT
@@ -436,6 +450,14 @@ struct Utf8 {
             }
         }
 
+        bsl::size_t numRemaining(const OctetType *position) const
+            // Return the number of octets of input from the specified
+            // 'position' to the end of input.  The behavior is undefined
+            // unless 'position <= d_end'.
+        {
+            return d_end - position;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets' that are prior to
@@ -497,6 +519,15 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        bsl::size_t numRemaining(const OctetType *) const
+            // Return 0.  Note that the amount of input remaining is not known
+            // without scanning it for the terminating null, so that input
+            // terminated by a null is always translated one code point at a
+            // time.
+        {
+            return 0;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets'.  The behavior is
@@ -770,6 +801,14 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        bsl::size_t numRemaining(const UTF16_WORD *utf16Buf) const
+            // Return the number of words of input from the specified
+            // 'utf16Buf' to the end of input.  The behavior is undefined
+            // unless 'utf16Buf <= d_end'.
+        {
+            return d_end - utf16Buf;
+        }
     };
 
     template <class UTF16_WORD>
@@ -790,6 +829,15 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        bsl::size_t numRemaining(const UTF16_WORD *) const
+            // Return 0.  Note that the amount of input remaining is not known
+            // without scanning it for the terminating null, so that input
+            // terminated by a null is always translated one code point at a
+            // time.
+        {
+            return 0;
+        }
     };
 
     // CLASS METHODS
@@ -1022,6 +1070,166 @@ struct NoOpSwapper {
     }
 };
 
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t widenAscii(UTF16_WORD            *dstBuffer,
+                       const Utf8::OctetType *octets,
+                       bsl::size_t            length)
+    // Translate the run of single-octet code points beginning at the
+    // specified 'octets' and lying within its first specified 'length'
+    // octets, examined in blocks of 16 octets, to the specified 'dstBuffer'
+    // as 'UTF16_WORD's encoded by 'SWAPPER', and return the number of octets
+    // translated.  The behavior is undefined unless 'dstBuffer' has room for
+    // 'length' words.  Note that this function translates nothing if
+    // 'length < 16' or if SSE2 instructions are not available, in which case
+    // the caller translates the run one code point at a time.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    enum { k_BLOCK = 16 };
+
+    const bool    swap = !bslmf::IsSame<SWAPPER,
+                                        NoOpSwapper<UTF16_WORD> >::value;
+    const __m128i zero = _mm_setzero_si128();
+
+    bsl::size_t n = 0;
+    while (length - n >= k_BLOCK) {
+        const __m128i input = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(octets + n));
+
+        if (_mm_movemask_epi8(input)) {
+            // The run ends within this block.
+
+            while (Utf8::isSingleOctet(octets[n])) {
+                dstBuffer[n] = SWAPPER::encodeSingleWord(octets[n]);
+                ++n;
+            }
+            break;
+        }
+
+        // Interleaving zero bytes after each octet (or before it, to swap
+        // the bytes of the word) widens it to 16 bits, and doing so again
+        // with zero words widens it to 32 bits.
+
+        const __m128i lo = swap ? _mm_unpacklo_epi8(zero, input)
+                                : _mm_unpacklo_epi8(input, zero);
+        const __m128i hi = swap ? _mm_unpackhi_epi8(zero, input)
+                                : _mm_unpackhi_epi8(input, zero);
+
+        __m128i *dst = reinterpret_cast<__m128i *>(dstBuffer + n);
+        if (2 == sizeof(UTF16_WORD)) {
+            _mm_storeu_si128(dst,     lo);
+            _mm_storeu_si128(dst + 1, hi);
+        }
+        else {
+            _mm_storeu_si128(dst,     swap ? _mm_unpacklo_epi16(zero, lo)
+                                           : _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(dst + 1, swap ? _mm_unpackhi_epi16(zero, lo)
+                                           : _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(dst + 2, swap ? _mm_unpacklo_epi16(zero, hi)
+                                           : _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(dst + 3, swap ? _mm_unpackhi_epi16(zero, hi)
+                                           : _mm_unpackhi_epi16(hi, zero));
+        }
+        n += k_BLOCK;
+    }
+
+    return n;
+#else
+    (void) dstBuffer;
+    (void) octets;
+    (void) length;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t narrowAscii(char             *dstBuffer,
+                        const UTF16_WORD *srcBuffer,
+                        bsl::size_t       length)
+    // Translate the run of words encoding single-octet code points beginning
+    // at the specified 'srcBuffer', decoded by 'SWAPPER', and lying within its
+    // first specified 'length' words, examined in blocks of 16 words, to
+    // single octets at the specified 'dstBuffer', and return the number of
+    // words translated.  The behavior is undefined unless 'dstBuffer' has
+    // room for 'length' octets.  Note that this function translates nothing
+    // if 'length < 16' or if SSE2 instructions are not available, in which
+    // case the caller translates the run one code point at a time.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    enum { k_BLOCK = 16 };
+
+    const bool    swap = !bslmf::IsSame<SWAPPER,
+                                        NoOpSwapper<UTF16_WORD> >::value;
+    const __m128i zero = _mm_setzero_si128();
+
+    bsl::size_t n = 0;
+    while (length - n >= k_BLOCK) {
+        const __m128i *src = reinterpret_cast<const __m128i *>(srcBuffer + n);
+
+        // 'nonAscii' has a bit set in every position that is zero in a word
+        // encoding a single-octet code point.
+
+        __m128i nonAscii;
+        __m128i octets;
+        if (2 == sizeof(UTF16_WORD)) {
+            __m128i a = _mm_loadu_si128(src);
+            __m128i b = _mm_loadu_si128(src + 1);
+
+            nonAscii = _mm_and_si128(_mm_or_si128(a, b),
+                                     _mm_set1_epi16(static_cast<short>(
+                                                   swap ? 0x80ff : 0xff80)));
+            if (swap) {
+                a = _mm_srli_epi16(a, 8);
+                b = _mm_srli_epi16(b, 8);
+            }
+            octets = _mm_packus_epi16(a, b);
+        }
+        else {
+            __m128i a = _mm_loadu_si128(src);
+            __m128i b = _mm_loadu_si128(src + 1);
+            __m128i c = _mm_loadu_si128(src + 2);
+            __m128i d = _mm_loadu_si128(src + 3);
+
+            nonAscii = _mm_and_si128(
+                          _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)),
+                           _mm_set1_epi32(static_cast<int>(
+                                         swap ? 0x80ffffffu : 0xffffff80u)));
+            if (swap) {
+                a = _mm_srli_epi32(a, 24);
+                b = _mm_srli_epi32(b, 24);
+                c = _mm_srli_epi32(c, 24);
+                d = _mm_srli_epi32(d, 24);
+            }
+            octets = _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                      _mm_packs_epi32(c, d));
+        }
+
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(nonAscii, zero))) {
+            // The run ends within this block.
+
+            UnicodeCodePoint word;
+            while (Utf16::isSingleUtf8(
+                          word = SWAPPER::decodeSingleWord(srcBuffer + n))) {
+                dstBuffer[n] = Utf16::getUtf8Value(word);
+                ++n;
+            }
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer + n), octets);
+        n += k_BLOCK;
+    }
+
+    return n;
+#else
+    (void) dstBuffer;
+    (void) srcBuffer;
+    (void) length;
+
+    return 0;
+#endif
+}
+
 // These compile-time asserts aren't strictly necessary, but we may plan to
 // expand this component to support UTF-16 wstrings someday, which won't work
 // if the size of a 'wchar_t' is less than that of a 'short' on any platform
@@ -1206,6 +1414,21 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
+            // Translate a run of single-octet code points in bulk if the
+            // input remaining and the room in the output permit it.
+
+            const bsl::size_t run = widenAscii<UTF16_WORD, SWAPPER>(
+                dstBuffer,
+                octets,
+                dstCapacity.atMost(endFunctor.numRemaining(octets) + 1) - 1);
+            if (run) {
+                octets      += run;
+                dstBuffer   += run;
+                dstCapacity -= run;
+                nCodePoints += run;
+                continue;
+            }
+
             *dstBuffer = SWAPPER::encodeSingleWord(*octets);
             ++octets;
             ++dstBuffer;
@@ -1511,6 +1734,19 @@ int localUtf16ToUtf8(char             *dstBuffer,
                 returnStatus |= OUT_OF_SPACE_BIT;
                 break;
             }
+
+            const bsl::size_t run = narrowAscii<UTF16_WORD, SWAPPER>(
+             dstBuffer,
+             srcBuffer,
+             dstCapacity.atMost(endFunctor.numRemaining(srcBuffer) + 1) - 1);
+            if (run) {
+                srcBuffer   += run;
+                dstBuffer   += run;
+                dstCapacity -= run;
+                nCodePoints += run;
+                continue;
+            }
+
             *dstBuffer = Utf16::getUtf8Value(word0);
             ++srcBuffer;
             ++dstBuffer;
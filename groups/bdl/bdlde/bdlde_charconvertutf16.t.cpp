@@ -131,6 +131,7 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
+// [19] CONCERN: BULK TRANSLATION OF ASCII RUNS
 // [18] USAGE EXAMPLE 2
 // [17] USAGE EXAMPLE 1
 // [16] UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
@@ -4875,6 +4876,13 @@ class TestDriver {
 
   public:
     // PUBLIC CLASS METHODS
+    template <class WIDE_CHAR>
+    static void testCase19(bdlde::ByteOrder::Enum byteOrder);
+        // Verify that translating runs of ASCII in bulk, as is done for input
+        // of known length, yields the same results as translating them one
+        // code point at a time, as is done for null-terminated input, in both
+        // directions, where the UTF-16 is of the specified 'byteOrder'.
+
     static void testCase16(bdlde::ByteOrder::Enum byteOrder);
         // Test the calculations of length estimates for UTF-16 containing
         // errors translated into UTF-8.  The UTF-16 is to be of the specified
@@ -7728,6 +7736,191 @@ void TestDriver::testCase10()
     }
 }
 
+int utf16ToUtf8WithLength(char                   *dstBuffer,
+                          bsl::size_t             dstCapacity,
+                          const unsigned short   *srcString,
+                          bsl::size_t             srcLength,
+                          bsl::size_t            *numCodePointsWritten,
+                          bsl::size_t            *numBytesWritten,
+                          bdlde::ByteOrder::Enum  byteOrder)
+    // Translate the specified 'srcString' having the specified 'srcLength'
+    // into the specified 'dstBuffer' having the specified 'dstCapacity' with
+    // the 'utf16ToUtf8' overload taking the input length, loading the
+    // specified 'numCodePointsWritten' and 'numBytesWritten', and interpreting
+    // 'srcString' in the specified 'byteOrder'.  Return the status returned
+    // by 'utf16ToUtf8'.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             srcString,
+                             srcLength,
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             '?',
+                             byteOrder);
+}
+
+int utf16ToUtf8WithLength(char                   *dstBuffer,
+                          bsl::size_t             dstCapacity,
+                          const wchar_t          *srcString,
+                          bsl::size_t             srcLength,
+                          bsl::size_t            *numCodePointsWritten,
+                          bsl::size_t            *numBytesWritten,
+                          bdlde::ByteOrder::Enum  byteOrder)
+    // Translate the specified 'srcString' having the specified 'srcLength'
+    // into the specified 'dstBuffer' having the specified 'dstCapacity' with
+    // the 'utf16ToUtf8' overload taking a 'wstring_view', loading the
+    // specified 'numCodePointsWritten' and 'numBytesWritten', and interpreting
+    // 'srcString' in the specified 'byteOrder'.  Return the status returned
+    // by 'utf16ToUtf8'.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             bsl::wstring_view(srcString, srcLength),
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             '?',
+                             byteOrder);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+int utf16ToUtf8WithLength(char                   *dstBuffer,
+                          bsl::size_t             dstCapacity,
+                          const char16_t         *srcString,
+                          bsl::size_t             srcLength,
+                          bsl::size_t            *numCodePointsWritten,
+                          bsl::size_t            *numBytesWritten,
+                          bdlde::ByteOrder::Enum  byteOrder)
+    // Translate the specified 'srcString' having the specified 'srcLength'
+    // into the specified 'dstBuffer' having the specified 'dstCapacity' with
+    // the 'utf16ToUtf8' overload taking a 'u16string_view', loading the
+    // specified 'numCodePointsWritten' and 'numBytesWritten', and
+    // interpreting 'srcString' in the specified 'byteOrder'.  Return the
+    // status returned by 'utf16ToUtf8'.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             bsl::u16string_view(srcString, srcLength),
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             '?',
+                             byteOrder);
+}
+#endif
+
+template <class WIDE_CHAR>
+void TestDriver::testCase19(bdlde::ByteOrder::Enum byteOrder)
+{
+    static const char *const NON_ASCII[] = {
+        "\xc3\xa9",                  // 2 octets
+        "\xe4\xb8\xad",              // 3 octets
+        "\xf0\x9f\x98\x80",          // 4 octets
+        "\xe4\xb8",                  // truncated
+        "\x80",                      // unexpected continuation
+        "\xff",                      // invalid
+    };
+    enum { k_NUM_NON_ASCII = sizeof NON_ASCII / sizeof *NON_ASCII };
+
+    enum { k_BUF_LEN = 1024 };
+
+    bsl::string utf8(&ta);
+    WIDE_CHAR   expWide[k_BUF_LEN];
+    WIDE_CHAR   wide[k_BUF_LEN];
+    char        expNarrow[k_BUF_LEN];
+    char        narrow[k_BUF_LEN];
+
+    for (int ti = 0; ti < 4000; ++ti) {
+        // Build a string of runs of random lengths of non-null ASCII, each
+        // followed by a multi-octet sequence, valid or not.
+
+        const unsigned length = s_randGen.bits(8);
+
+        utf8.clear();
+        while (utf8.length() < length) {
+            for (unsigned run = s_randGen.bits(6); 0 < run; --run) {
+                utf8.push_back(static_cast<char>(1 + s_randGen() % 127));
+            }
+            utf8 += NON_ASCII[s_randGen() % k_NUM_NON_ASCII];
+        }
+        const bsl::size_t LEN = utf8.length();
+
+        // UTF-8 -> UTF-16, with random and ample capacity, leaving the
+        // translation with ample capacity in 'wide'.
+
+        bsl::size_t numWords = 0;
+        for (int tj = 0; tj < 2; ++tj) {
+            const bsl::size_t CAP = 0 == tj ? s_randGen() % (LEN + 2)
+                                            : LEN + 1;
+
+            bsl::size_t expNc = -1, expNw = -1, nc = -2, nw = -2;
+
+            bsl::memset(expWide, 0xa5, sizeof expWide);
+            const int expRc = Util::utf8ToUtf16(expWide,
+                                                CAP,
+                                                utf8.c_str(),
+                                                &expNc,
+                                                &expNw,
+                                                WIDE_CHAR('?'),
+                                                byteOrder);
+
+            bsl::memset(wide, 0xa5, sizeof wide);
+            const int rc = Util::utf8ToUtf16(wide,
+                                             CAP,
+                                             bsl::string_view(utf8),
+                                             &nc,
+                                             &nw,
+                                             WIDE_CHAR('?'),
+                                             byteOrder);
+
+            ASSERTV(ti, CAP, expRc, rc, expRc == rc);
+            ASSERTV(ti, CAP, expNc, nc, expNc == nc);
+            ASSERTV(ti, CAP, expNw, nw, expNw == nw);
+            ASSERTV(ti, CAP, 0 == bsl::memcmp(expWide, wide, sizeof wide));
+
+            if (1 == tj) {
+                ASSERTV(ti, 0 == rc || Status::k_INVALID_INPUT_BIT == rc);
+                numWords = nw;
+            }
+        }
+
+        // UTF-16 -> UTF-8, from the translation with ample capacity.
+
+        ASSERTV(ti, 0 < numWords && 0 == wide[numWords - 1]);
+
+        for (int tj = 0; tj < 2; ++tj) {
+            const bsl::size_t CAP = 0 == tj ? 3 * numWords + 1
+                                            : s_randGen() % (LEN + 2);
+
+            bsl::size_t expNc = -1, expNb = -1, nc = -2, nb = -2;
+
+            bsl::memset(expNarrow, 0xa5, sizeof expNarrow);
+            const int expRc = Util::utf16ToUtf8(expNarrow,
+                                                CAP,
+                                                wide,
+                                                &expNc,
+                                                &expNb,
+                                                '?',
+                                                byteOrder);
+
+            bsl::memset(narrow, 0xa5, sizeof narrow);
+            const int rc = utf16ToUtf8WithLength(narrow,
+                                                 CAP,
+                                                 wide,
+                                                 numWords - 1,
+                                                 &nc,
+                                                 &nb,
+                                                 byteOrder);
+
+            ASSERTV(ti, CAP, expRc, rc, expRc == rc);
+            ASSERTV(ti, CAP, expNc, nc, expNc == nc);
+            ASSERTV(ti, CAP, expNb, nb, expNb == nb);
+            ASSERTV(ti,
+                    CAP,
+                    0 == bsl::memcmp(expNarrow, narrow, sizeof narrow));
+        }
+    }
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -7750,6 +7943,60 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // BULK TRANSLATION OF ASCII RUNS
+        //
+        // Concerns:
+        //: 1 Runs of ASCII in input of known length, which are translated in
+        //:   blocks of 16 code points where the platform supports it, are
+        //:   translated exactly as they are one code point at a time.
+        //:
+        //: 2 Runs ending within a block, and blocks straddling the end of the
+        //:   input or the end of the room in the output, are handled
+        //:   correctly.
+        //:
+        //: 3 Bulk translation respects the byte order and the size of the
+        //:   UTF-16 words.
+        //
+        // Plan:
+        //: 1 Generate random strings of ASCII runs of random lengths,
+        //:   separated by valid and invalid multi-octet sequences.
+        //:
+        //: 2 Translate each string to UTF-16, both as a null-terminated
+        //:   string and as a 'string_view', with ample and random capacity,
+        //:   and verify that the results are identical.
+        //:
+        //: 3 Translate the UTF-16 back to UTF-8, both null-terminated and
+        //:   with its length, with ample and random capacity, and verify that
+        //:   the results are identical.
+        //:
+        //: 4 Repeat for 'unsigned short', 'wchar_t', and 'char16_t' words
+        //:   and for both byte orders.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: BULK TRANSLATION OF ASCII RUNS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BULK TRANSLATION OF ASCII RUNS\n"
+                             "==============================\n";
+
+        const bdlde::ByteOrder::Enum BYTE_ORDERS[] = {
+                                                  bdlde::ByteOrder::e_HOST,
+                                                  e_BACKWARDS };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const bdlde::ByteOrder::Enum ORDER = BYTE_ORDERS[ti];
+
+            if (veryVerbose) { T_ P(ORDER); }
+
+            TestDriver::testCase19<unsigned short>(ORDER);
+            TestDriver::testCase19<wchar_t>(ORDER);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+            TestDriver::testCase19<char16_t>(ORDER);
+#endif
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>    // 'bsl::find'
@@ -25,6 +26,10 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 #include <bsl_climits.h>      // 'CHAR_BIT'
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -182,7 +187,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -193,6 +198,9 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t atMost(bsl::size_t rhs) const;
+        // Return the lesser of 'd_capacity' and the specified 'rhs'.
 };
 
                            // ---------------------
@@ -214,7 +222,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +245,13 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::atMost(bsl::size_t rhs) const
+    // Return the lesser of 'd_capacity' and the specified 'rhs'.
+{
+    return d_capacity < rhs ? d_capacity : rhs;
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +272,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +281,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t atMost(bsl::size_t rhs) const;
+        // Return the specified 'rhs'.
 };
 
                          // -------------------------
@@ -285,7 +303,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +322,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::atMost(bsl::size_t rhs) const
+    // Return the specified 'rhs'.
+{
+    return rhs;
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -370,6 +395,11 @@ class Utf8PtrBasedEnd {
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
 
+    bsl::size_t numRemaining(const OctetType *position) const;
+        // Return the number of octets of input from the specified 'position'
+        // to the end of input.  The behavior is undefined unless
+        // 'position <= d_end'.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after the specified 'skipBy' consecutive
@@ -406,6 +436,14 @@ bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
     }
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numRemaining(const OctetType *position) const
+{
+    BSLS_ASSERT(position <= d_end);
+
+    return d_end - position;
+}
+
 inline
 const OctetType *Utf8PtrBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -462,6 +500,12 @@ struct Utf8ZeroBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
 
+    bsl::size_t numRemaining(const OctetType *position) const;
+        // Return 0.  Note that the amount of input remaining from the
+        // specified 'position' is not known without scanning it for the
+        // terminating null, so that null-terminated input is always
+        // translated one code point at a time.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after up to the specified 'skipBy' consecutive
@@ -493,6 +537,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numRemaining(const OctetType *) const
+{
+    return 0;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -554,6 +604,11 @@ class Utf32PtrBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input and
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
+
+    bsl::size_t numRemaining(const unsigned int *position) const;
+        // Return the number of words of input from the specified 'position'
+        // to the end of input.  The behavior is undefined unless
+        // 'position <= d_end'.
 };
 
                         // ---------------------------
@@ -579,6 +634,14 @@ bool Utf32PtrBasedEnd::isFinished(const unsigned int *position) const
     }
 }
 
+inline
+bsl::size_t Utf32PtrBasedEnd::numRemaining(const unsigned int *position) const
+{
+    BSLS_ASSERT(position <= d_end_p);
+
+    return d_end_p - position;
+}
+
                        // ==============================
                        // local struct Utf32ZeroBasedEnd
                        // ==============================
@@ -592,6 +655,12 @@ struct Utf32ZeroBasedEnd {
     bool isFinished(const unsigned int *position) const;
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
+
+    bsl::size_t numRemaining(const unsigned int *position) const;
+        // Return 0.  Note that the amount of input remaining from the
+        // specified 'position' is not known without scanning it for the
+        // terminating null, so that null-terminated input is always
+        // translated one code point at a time.
 };
 
                        // ------------------------------
@@ -611,6 +680,12 @@ bool Utf32ZeroBasedEnd::isFinished(const unsigned int *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf32ZeroBasedEnd::numRemaining(const unsigned int *) const
+{
+    return 0;
+}
+
 }  // close unnamed namespace
 
 static inline
@@ -841,6 +916,144 @@ const OctetType *skipUtf8CodePoint(const OctetType *input)
     return input + lookaheadContinuations(input, expected);
 }
 
+template <class SWAPPER>
+static
+bsl::size_t widenAscii(unsigned int    *output,
+                       const OctetType *input,
+                       bsl::size_t      length)
+    // Translate the run of single-octet code points beginning at the
+    // specified 'input' and lying within its first specified 'length' octets,
+    // examined in blocks of 16 octets, to UTF-32 words at the specified
+    // 'output' in the byte order produced by 'SWAPPER', and return the number
+    // of octets translated.  The behavior is undefined unless 'output' has
+    // room for 'length' words.  Note that this function translates nothing if
+    // 'length < 16' or if SSE2 instructions are not available, in which case
+    // the caller translates the run one code point at a time.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    enum { k_BLOCK = 16 };
+
+    const bool    swap = bsl::is_same<SWAPPER, Swapper>::value;
+    const __m128i zero = _mm_setzero_si128();
+
+    bsl::size_t n = 0;
+    while (length - n >= k_BLOCK) {
+        const __m128i octets = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(input + n));
+
+        if (_mm_movemask_epi8(octets)) {
+            // The run ends within this block.
+
+            while (isSingleOctet(input[n])) {
+                output[n] = SWAPPER::swapBytes(input[n]);
+                ++n;
+            }
+            break;
+        }
+
+        // Interleaving zero bytes after each octet, then zero 16-bit words
+        // after each 16-bit word, widens the octets to 32 bits; interleaving
+        // the zeros before them leaves each octet in the high byte of its
+        // word instead, as swapping would.
+
+        const __m128i lo = swap ? _mm_unpacklo_epi8(zero, octets)
+                                : _mm_unpacklo_epi8(octets, zero);
+        const __m128i hi = swap ? _mm_unpackhi_epi8(zero, octets)
+                                : _mm_unpackhi_epi8(octets, zero);
+
+        __m128i *dst = reinterpret_cast<__m128i *>(output + n);
+        _mm_storeu_si128(dst,     swap ? _mm_unpacklo_epi16(zero, lo)
+                                       : _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(dst + 1, swap ? _mm_unpackhi_epi16(zero, lo)
+                                       : _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(dst + 2, swap ? _mm_unpacklo_epi16(zero, hi)
+                                       : _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(dst + 3, swap ? _mm_unpackhi_epi16(zero, hi)
+                                       : _mm_unpackhi_epi16(hi, zero));
+        n += k_BLOCK;
+    }
+
+    return n;
+#else
+    (void) output;
+    (void) input;
+    (void) length;
+
+    return 0;
+#endif
+}
+
+template <class SWAPPER>
+static
+bsl::size_t narrowAscii(OctetType          *output,
+                        const unsigned int *input,
+                        bsl::size_t         length)
+    // Translate the run of words encoding single-octet code points, in the
+    // byte order decoded by 'SWAPPER', beginning at the specified 'input' and
+    // lying within its first specified 'length' words, examined in blocks of
+    // 16 words, to single octets at the specified 'output', and return the
+    // number of words translated.  The behavior is undefined unless 'output'
+    // has room for 'length' octets.  Note that this function translates
+    // nothing if 'length < 16' or if SSE2 instructions are not available, in
+    // which case the caller translates the run one code point at a time.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    enum { k_BLOCK = 16 };
+
+    const bool    swap = bsl::is_same<SWAPPER, Swapper>::value;
+    const __m128i mask = _mm_set1_epi32(static_cast<int>(
+                                           swap ? 0x80ffffffu : 0xffffff80u));
+
+    bsl::size_t n = 0;
+    while (length - n >= k_BLOCK) {
+        const __m128i *src = reinterpret_cast<const __m128i *>(input + n);
+
+        __m128i a = _mm_loadu_si128(src);
+        __m128i b = _mm_loadu_si128(src + 1);
+        __m128i c = _mm_loadu_si128(src + 2);
+        __m128i d = _mm_loadu_si128(src + 3);
+
+        // 'nonAscii' has a bit set in every position that is zero in a word
+        // encoding a single-octet code point.
+
+        const __m128i nonAscii = _mm_and_si128(
+                          _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)),
+                          mask);
+
+        if (0xffff != _mm_movemask_epi8(
+                              _mm_cmpeq_epi8(nonAscii, _mm_setzero_si128()))) {
+            // The run ends within this block.
+
+            unsigned int uc;
+            while (fitsInSingleOctet(uc = SWAPPER::swapBytes(input[n]))) {
+                output[n] = static_cast<OctetType>(uc);
+                ++n;
+            }
+            break;
+        }
+
+        if (swap) {
+            a = _mm_srli_epi32(a, 24);
+            b = _mm_srli_epi32(b, 24);
+            c = _mm_srli_epi32(c, 24);
+            d = _mm_srli_epi32(d, 24);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + n),
+                         _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                          _mm_packs_epi32(c, d)));
+        n += k_BLOCK;
+    }
+
+    return n;
+#else
+    (void) output;
+    (void) input;
+    (void) length;
+
+    return 0;
+#endif
+}
+
 template <class END_FUNCTOR>
 static
 bsl::size_t utf32BufferLengthNeeded(const char  *input,
@@ -1011,6 +1224,13 @@ class Utf8ToUtf32Translator {
         // capacity for the output, and 0 otherwise.  The behavior is undefined
         // unless at least 1 word of space is available in the output buffer.
 
+    bsl::size_t translateAsciiRun();
+        // Translate, in bulk, the run of single-octet code points at the
+        // start of 'd_input' insofar as the input and the room in the output
+        // buffer (reserving one word for the terminating null) allow, update
+        // the state of this object accordingly, and return the number of code
+        // points translated, which may be 0.
+
   public:
     // CLASS METHODS
     static
@@ -1124,6 +1344,25 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint()
     return 0;
 }
 
+template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
+inline
+bsl::size_t
+Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translateAsciiRun()
+{
+    const bsl::size_t room = d_capacity.atMost(
+                                       d_endFunctor.numRemaining(d_input) + 1);
+    if (room < 2) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t run = widenAscii<SWAPPER>(d_output, d_input, room - 1);
+    d_input    += run;
+    d_output   += run;
+    d_capacity -= run;
+
+    return run;
+}
+
 template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
 inline
 void
@@ -1159,6 +1398,10 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
 
     int ret = 0;
     while (!endFunctor.isFinished(translator.d_input)) {
+        if (isSingleOctet(*translator.d_input)
+         && 0 != translator.translateAsciiRun()) {
+            continue;
+        }
         if (0 != translator.decodeCodePoint()) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret = k_OUT_OF_SPACE_BIT;
@@ -1261,6 +1504,14 @@ class Utf32ToUtf8Translator {
         // Return a non-zero value if there was insufficient capacity for the
         // output, and 0 otherwise.
 
+    bsl::size_t translateAsciiRun(const END_FUNCTOR& endFunctor);
+        // Translate, in bulk, the run of words encoding single-octet code
+        // points at the start of 'd_input', using the specified 'endFunctor'
+        // to determine the end of input, insofar as the input and the room in
+        // the output buffer (reserving one byte for the terminating null)
+        // allow, update the state of this object accordingly, and return the
+        // number of code points translated, which may be 0.
+
     int decodeCodePoint(const unsigned int uc);
         // Translate the specified UTF-32 code point 'uc' to UTF-8 in the
         // output stream, updating this object appropriately.  If insufficient
@@ -1352,6 +1603,27 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::handleInvalidWord()
     }
 }
 
+template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
+inline
+bsl::size_t
+Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translateAsciiRun(
+                                                const END_FUNCTOR& endFunctor)
+{
+    const bsl::size_t room = d_capacity.atMost(
+                                         endFunctor.numRemaining(d_input) + 1);
+    if (room < 2) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t run = narrowAscii<SWAPPER>(d_output, d_input, room - 1);
+    d_input                += run;
+    d_output               += run;
+    d_capacity             -= run;
+    d_numCodePointsWritten += run;
+
+    return run;
+}
+
 template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
 int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint(
                                                          const unsigned int uc)
@@ -1432,6 +1704,10 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
     int          ret = 0;
     unsigned int uc;
     while (!endFunctor.isFinished(translator.d_input)) {
+        if (fitsInSingleOctet(SWAPPER::swapBytes(*translator.d_input))
+         && 0 != translator.translateAsciiRun(endFunctor)) {
+            continue;
+        }
         uc = SWAPPER::swapBytes(*translator.d_input++);
         if (0 != translator.decodeCodePoint(uc)) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
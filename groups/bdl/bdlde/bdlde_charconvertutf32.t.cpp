@@ -72,6 +72,7 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
+// [19] CONCERN: BULK TRANSLATION OF ASCII RUNS
 // [17] USAGE EXAMPLE
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
@@ -5779,6 +5780,151 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // BULK TRANSLATION OF ASCII RUNS
+        //
+        // Concerns:
+        //: 1 Runs of ASCII in input of known length, which are translated in
+        //:   blocks of 16 code points where the platform supports it, are
+        //:   translated exactly as they are one code point at a time.
+        //:
+        //: 2 Runs ending within a block, and blocks straddling the end of the
+        //:   input or the end of the room in the output, are handled
+        //:   correctly.
+        //:
+        //: 3 Bulk translation respects the byte order of the UTF-32.
+        //
+        // Plan:
+        //: 1 Generate random strings of ASCII runs of random lengths,
+        //:   separated by valid and invalid multi-octet sequences.
+        //:
+        //: 2 Translate each string to UTF-32, both as a null-terminated
+        //:   string and as a 'string_view', with random and ample capacity,
+        //:   and verify that the results are identical.
+        //:
+        //: 3 Translate the UTF-32 back to UTF-8, both null-terminated and
+        //:   with its length, with ample and random capacity, and verify that
+        //:   the results are identical.
+        //:
+        //: 4 Repeat for both byte orders.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: BULK TRANSLATION OF ASCII RUNS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BULK TRANSLATION OF ASCII RUNS\n"
+                             "==============================\n";
+
+        static const char *const NON_ASCII[] = {
+            "\xc3\xa9",                  // 2 octets
+            "\xe4\xb8\xad",              // 3 octets
+            "\xf0\x9f\x98\x80",          // 4 octets
+            "\xe4\xb8",                  // truncated
+            "\x80",                      // unexpected continuation
+            "\xff",                      // invalid
+        };
+        enum { k_NUM_NON_ASCII = sizeof NON_ASCII / sizeof *NON_ASCII,
+               k_BUF_LEN       = 1024 };
+
+        bsl::string  utf8;
+        unsigned int expWide[k_BUF_LEN];
+        unsigned int wide[k_BUF_LEN];
+        char         expNarrow[k_BUF_LEN];
+        char         narrow[k_BUF_LEN];
+
+        for (int ti = 0; ti < 8 * 1000; ++ti) {
+            const bdlde::ByteOrder::Enum endian =
+                            ti & 1 ? oppositeEndian : bdlde::ByteOrder::e_HOST;
+
+            // Build a string of runs of random lengths of non-null ASCII,
+            // each followed by a multi-octet sequence, valid or not.
+
+            const unsigned int length = myRand15() % 256;
+
+            utf8.clear();
+            while (utf8.length() < length) {
+                for (unsigned int run = myRand15() % 64; 0 < run; --run) {
+                    utf8.push_back(static_cast<char>(1 + myRand15() % 127));
+                }
+                utf8 += NON_ASCII[myRand15() % k_NUM_NON_ASCII];
+            }
+            const bsl::size_t LEN = utf8.length();
+
+            // UTF-8 -> UTF-32, with random and ample capacity, leaving the
+            // translation with ample capacity in 'wide'.
+
+            bsl::size_t numWords = 0;
+            for (int tj = 0; tj < 2; ++tj) {
+                const bsl::size_t CAP = 0 == tj ? myRand15() % (LEN + 2)
+                                                : LEN + 1;
+
+                bsl::size_t expNw = -1, nw = -2;
+
+                bsl::memset(expWide, 0xa5, sizeof expWide);
+                const int expRc = Util::utf8ToUtf32(expWide,
+                                                    CAP,
+                                                    utf8.c_str(),
+                                                    &expNw,
+                                                    '?',
+                                                    endian);
+
+                bsl::memset(wide, 0xa5, sizeof wide);
+                const int rc = Util::utf8ToUtf32(wide,
+                                                 CAP,
+                                                 bsl::string_view(utf8),
+                                                 &nw,
+                                                 '?',
+                                                 endian);
+
+                LOOP4_ASSERT(ti, CAP, expRc, rc, expRc == rc);
+                LOOP4_ASSERT(ti, CAP, expNw, nw, expNw == nw);
+                LOOP2_ASSERT(ti,
+                             CAP,
+                             0 == bsl::memcmp(expWide, wide, sizeof wide));
+
+                numWords = nw;
+            }
+            LOOP_ASSERT(ti, 0 < numWords && 0 == wide[numWords - 1]);
+
+            // UTF-32 -> UTF-8, from the translation with ample capacity.
+
+            for (int tj = 0; tj < 2; ++tj) {
+                const bsl::size_t CAP = 0 == tj ? 4 * numWords
+                                                : myRand15() % (LEN + 2);
+
+                bsl::size_t expNc = -1, expNb = -1, nc = -2, nb = -2;
+
+                bsl::memset(expNarrow, 0xa5, sizeof expNarrow);
+                const int expRc = Util::utf32ToUtf8(expNarrow,
+                                                    CAP,
+                                                    wide,
+                                                    &expNc,
+                                                    &expNb,
+                                                    '?',
+                                                    endian);
+
+                bsl::memset(narrow, 0xa5, sizeof narrow);
+                const int rc = Util::utf32ToUtf8(narrow,
+                                                 CAP,
+                                                 wide,
+                                                 numWords - 1,
+                                                 &nc,
+                                                 &nb,
+                                                 '?',
+                                                 endian);
+
+                LOOP4_ASSERT(ti, CAP, expRc, rc, expRc == rc);
+                LOOP4_ASSERT(ti, CAP, expNc, nc, expNc == nc);
+                LOOP4_ASSERT(ti, CAP, expNb, nb, expNb == nb);
+                LOOP2_ASSERT(ti,
+                             CAP,
+                             0 == bsl::memcmp(expNarrow,
+                                              narrow,
+                                              sizeof narrow));
+            }
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -14,7 +14,23 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_annotation.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_CRC32_SIMD_ENABLED
+# define BDLDE_CRC32_TARGET(ISA) __attribute__((target(ISA)))
+    // The folding implementations are compiled for their instruction set by
+    // means of the 'target' attribute, and are selected at run time according
+    // to the capabilities of the processor.
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -93,6 +109,25 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// On x86-64 processors supporting the carry-less multiplication instructions,
+// long inputs are instead processed 16 bytes (PCLMULQDQ) or 64 bytes
+// (VPCLMULQDQ) at a time by "folding", as described in "Fast CRC Computation
+// for Generic Polynomials Using PCLMULQDQ Instruction" (Gopal et al., Intel,
+// 2009).  With the bit-reflected convention used by this CRC, a 128-bit lane
+// holding the pending message bits 'H * x^64 + L' (where 'H' is the low
+// quadword) is advanced past 'D' more bits of the message by computing
+// 'H * (x^(D + 63) mod P) + L * (x^(D - 1) mod P)', the extra factor of 'x'
+// being introduced by the reflected carry-less multiplication.  The 128 bits
+// left once the input is exhausted have the same remainder as the message
+// processed so far, which is computed by Barrett reduction (with
+// 'mu = floor(x^96 / P)') before any remaining bytes are processed with
+// 'CRC_TABLE'.  The folding constants below are 'x^n mod P' bit-reflected
+// into 64 bits, hence their low 32 bits are zero.
+//
+// 'combine' is the method used by zlib's 'crc32_combine': appending 'n' bytes
+// to a message multiplies its remainder by 'x^(8 * n) mod P', and the pre- and
+// post-conditioning cancel out because they are the same.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
@@ -158,21 +193,29 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc32
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
-{
-    BSLS_ASSERT(data || !length);
+typedef unsigned int (*UpdateFunction)(unsigned int         crc,
+                                       const unsigned char *data,
+                                       bsl::size_t          length);
+    // 'UpdateFunction' is an alias for a function that returns the CRC-32
+    // register resulting from processing the specified 'data' having the
+    // specified 'length' starting from the specified 'crc' register.
+
+const unsigned int k_POLYNOMIAL = 0xedb88320;  // bit-reflected 'P'
 
+unsigned int updateSoftware(unsigned int         crc,
+                            const unsigned char *data,
+                            bsl::size_t          length)
+    // Return the CRC-32 register resulting from processing the specified
+    // 'data' having the specified 'length' starting from the specified 'crc'
+    // register, one byte at a time.
+{
     // The following is a Duff's Device-based implementation of a common
     // algorithm (see end of RFC 1952).
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
+    const unsigned char *d   = data;
+    unsigned int         tmp = crc;
 
     switch (length % 4) {
       case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
@@ -193,7 +236,281 @@ void Crc32::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+#if defined(BDLDE_CRC32_SIMD_ENABLED)
+
+// Folding constants, as 'x^n mod P' bit-reflected into 64 bits.  A lane is
+// advanced by 'D' bits by multiplying its low quadword by 'x^(D + 63) mod P'
+// and its high quadword by 'x^(D - 1) mod P'.
+
+const bsls::Types::Uint64 k_X2111 = 0x7cc8e1e700000000ULL;  // D = 2048
+const bsls::Types::Uint64 k_X2047 = 0x03f9f86300000000ULL;
+const bsls::Types::Uint64 k_X575  = 0x653d982200000000ULL;  // D =  512
+const bsls::Types::Uint64 k_X511  = 0xcad38e8f00000000ULL;
+const bsls::Types::Uint64 k_X447  = 0x69ccfc0d00000000ULL;  // D =  384
+const bsls::Types::Uint64 k_X383  = 0x2a28386200000000ULL;
+const bsls::Types::Uint64 k_X319  = 0x9570d49500000000ULL;  // D =  256
+const bsls::Types::Uint64 k_X255  = 0x01b5fd1d00000000ULL;
+const bsls::Types::Uint64 k_X191  = 0x65673b4600000000ULL;  // D =  128
+const bsls::Types::Uint64 k_X127  = 0x9ba54c6f00000000ULL;
+const bsls::Types::Uint64 k_X95   = 0xccaa009e00000000ULL;
+
+const bsls::Types::Uint64 k_MU    = 0x5a72d812fb808b20ULL;  // 'mu - x^64'
+const bsls::Types::Uint64 k_P     = 0xedb8832000000000ULL;  // 'P - x^32'
+
+inline BDLDE_CRC32_TARGET("pclmul,sse4.1")
+__m128i fold128(__m128i lane, __m128i constants)
+    // Return the specified 'lane' multiplied by the specified folding
+    // 'constants'.
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(lane, constants, 0x00),
+                         _mm_clmulepi64_si128(lane, constants, 0x11));
+}
+
+inline BDLDE_CRC32_TARGET("pclmul,sse4.1")
+unsigned int reducePclmul(__m128i lane)
+    // Return the CRC-32 register resulting from processing the 16 bytes of
+    // the specified 'lane' starting from a zero register.
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    const __m128i k = _mm_set_epi64x(k_MU, k_X95);
+
+    // Fold the low quadword into the rest, leaving (at most) 96 bits of
+    // 'lane * x^32', congruent modulo 'P' and having 'q' as quotient.
+
+    const __m128i folded = _mm_xor_si128(
+                              _mm_clmulepi64_si128(lane, k, 0x00),
+                              _mm_slli_si128(_mm_srli_si128(lane, 8), 4));
+    const __m128i high   = _mm_srli_si128(folded, 4);
+
+    const Uint64 q = static_cast<Uint64>(_mm_cvtsi128_si64(high))
+                   ^ (static_cast<Uint64>(_mm_cvtsi128_si64(
+                                 _mm_clmulepi64_si128(high, k, 0x10))) << 1);
+
+    const __m128i qp = _mm_clmulepi64_si128(_mm_cvtsi64_si128(q),
+                                            _mm_cvtsi64_si128(k_P),
+                                            0x00);
+
+    return static_cast<unsigned int>(
+                    (static_cast<Uint64>(_mm_extract_epi64(folded, 1)) >> 32)
+                  ^ (static_cast<Uint64>(_mm_extract_epi64(qp, 1)) >> 31));
+}
+
+inline BDLDE_CRC32_TARGET("pclmul,sse4.1")
+unsigned int finishPclmul(__m128i              lane,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+    // Return the CRC-32 register resulting from folding the specified 'data'
+    // having the specified 'length' into the specified 'lane' 16 bytes at a
+    // time, and then reducing 'lane' and the remaining bytes of 'data'.
+{
+    const __m128i k128 = _mm_set_epi64x(k_X127, k_X191);
+
+    for (; length >= 16; data += 16, length -= 16) {
+        lane = _mm_xor_si128(fold128(lane, k128),
+                             _mm_loadu_si128((const __m128i *)data));
+    }
+
+    return updateSoftware(reducePclmul(lane), data, length);
+}
+
+BDLDE_CRC32_TARGET("pclmul,sse4.1")
+unsigned int updatePclmul(unsigned int         crc,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+    // Return the CRC-32 register resulting from processing the specified
+    // 'data' having the specified 'length' starting from the specified 'crc'
+    // register, 64 bytes at a time using PCLMULQDQ.
+{
+    if (length < 64) {
+        return updateSoftware(crc, data, length);                     // RETURN
+    }
+
+    const __m128i *d = (const __m128i *)data;
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(d + 0),
+                               _mm_cvtsi32_si128(crc));
+    __m128i x1 = _mm_loadu_si128(d + 1);
+    __m128i x2 = _mm_loadu_si128(d + 2);
+    __m128i x3 = _mm_loadu_si128(d + 3);
+
+    d      += 4;
+    length -= 64;
+
+    const __m128i k512 = _mm_set_epi64x(k_X511, k_X575);
+
+    for (; length >= 64; d += 4, length -= 64) {
+        x0 = _mm_xor_si128(fold128(x0, k512), _mm_loadu_si128(d + 0));
+        x1 = _mm_xor_si128(fold128(x1, k512), _mm_loadu_si128(d + 1));
+        x2 = _mm_xor_si128(fold128(x2, k512), _mm_loadu_si128(d + 2));
+        x3 = _mm_xor_si128(fold128(x3, k512), _mm_loadu_si128(d + 3));
+    }
+
+    const __m128i k128 = _mm_set_epi64x(k_X127, k_X191);
+
+    x1 = _mm_xor_si128(fold128(x0, k128), x1);
+    x2 = _mm_xor_si128(fold128(x1, k128), x2);
+    x3 = _mm_xor_si128(fold128(x2, k128), x3);
+
+    return finishPclmul(x3, (const unsigned char *)d, length);
+}
+
+inline BDLDE_CRC32_TARGET("vpclmulqdq,avx512f,pclmul,sse4.1")
+__m512i fold512(__m512i lanes, __m512i constants, __m512i data)
+    // Return the specified 'lanes' multiplied by the specified folding
+    // 'constants', plus the specified 'data'.
+{
+    return _mm512_ternarylogic_epi64(
+                             _mm512_clmulepi64_epi128(lanes, constants, 0x00),
+                             _mm512_clmulepi64_epi128(lanes, constants, 0x11),
+                             data,
+                             0x96);
+}
+
+BDLDE_CRC32_TARGET("vpclmulqdq,avx512f,pclmul,sse4.1")
+unsigned int updateVpclmul(unsigned int         crc,
+                           const unsigned char *data,
+                           bsl::size_t          length)
+    // Return the CRC-32 register resulting from processing the specified
+    // 'data' having the specified 'length' starting from the specified 'crc'
+    // register, 256 bytes at a time using VPCLMULQDQ.
+{
+    if (length < 256) {
+        return updatePclmul(crc, data, length);                       // RETURN
+    }
+
+    const __m512i *d = (const __m512i *)data;
+
+    __m512i z0 = _mm512_xor_si512(_mm512_loadu_si512(d + 0),
+                                  _mm512_set_epi64(0, 0, 0, 0, 0, 0, 0, crc));
+    __m512i z1 = _mm512_loadu_si512(d + 1);
+    __m512i z2 = _mm512_loadu_si512(d + 2);
+    __m512i z3 = _mm512_loadu_si512(d + 3);
+
+    d      += 4;
+    length -= 256;
+
+    const __m512i k2048 = _mm512_set_epi64(k_X2047, k_X2111, k_X2047, k_X2111,
+                                           k_X2047, k_X2111, k_X2047, k_X2111);
+
+    for (; length >= 256; d += 4, length -= 256) {
+        z0 = fold512(z0, k2048, _mm512_loadu_si512(d + 0));
+        z1 = fold512(z1, k2048, _mm512_loadu_si512(d + 1));
+        z2 = fold512(z2, k2048, _mm512_loadu_si512(d + 2));
+        z3 = fold512(z3, k2048, _mm512_loadu_si512(d + 3));
+    }
+
+    const __m512i k512 = _mm512_set_epi64(k_X511, k_X575, k_X511, k_X575,
+                                          k_X511, k_X575, k_X511, k_X575);
+
+    z1 = fold512(z0, k512, z1);
+    z2 = fold512(z1, k512, z2);
+    z3 = fold512(z2, k512, z3);
+
+    // Fold the four lanes of 'z3' into one, the first lane being 384 bits
+    // away from the last one.
+
+    const __m128i lane0 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 0);
+    const __m128i lane1 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 1);
+    const __m128i lane2 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 2);
+    const __m128i lane3 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 3);
+
+    __m128i x = _mm_xor_si128(fold128(lane0, _mm_set_epi64x(k_X383, k_X447)),
+                              fold128(lane1, _mm_set_epi64x(k_X255, k_X319)));
+    x = _mm_xor_si128(x, fold128(lane2, _mm_set_epi64x(k_X127, k_X191)));
+    x = _mm_xor_si128(x, lane3);
+
+    // The upper halves of the vector registers are cleared explicitly, lest
+    // the SSE and scalar code that follows incur transition penalties (the
+    // compiler does not do so itself for functions having a 'target'
+    // attribute).
+
+    _mm256_zeroupper();
+
+    return finishPclmul(x, (const unsigned char *)d, length);
+}
+
+#endif  // BDLDE_CRC32_SIMD_ENABLED
+
+UpdateFunction selectUpdateFunction()
+    // Return the fastest implementation of the CRC-32 update supported by the
+    // processor.
+{
+#if defined(BDLDE_CRC32_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("vpclmulqdq")
+     && __builtin_cpu_supports("avx512f")) {
+        return updateVpclmul;                                         // RETURN
+    }
+    if (__builtin_cpu_supports("pclmul")
+     && __builtin_cpu_supports("sse4.1")) {
+        return updatePclmul;                                          // RETURN
+    }
+#endif
+
+    return updateSoftware;
+}
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b' modulo the CRC-32
+    // polynomial, all three being bit-reflected.
+{
+    unsigned int product = 0;
+    for (unsigned int mask = 1U << 31; mask; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = b & 1 ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+unsigned int xPowerModP(bsl::size_t numBytes)
+    // Return 'x^(8 * numBytes)' modulo the CRC-32 polynomial, bit-reflected.
+{
+    unsigned int result = 1U << 31;         // x^0
+    unsigned int power  = 1U << (31 - 8);   // x^8, then x^16, x^32, ...
+
+    for (; numBytes; numBytes >>= 1) {
+        if (numBytes & 1) {
+            result = multiplyModP(result, power);
+        }
+        power = multiplyModP(power, power);
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc32
+                                // -----------
+
+// CLASS METHODS
+unsigned int Crc32::combine(unsigned int crcA,
+                            unsigned int crcB,
+                            bsl::size_t  lengthB)
+{
+    return multiplyModP(xPowerModP(lengthB), crcA) ^ crcB;
+}
+
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    static UpdateFunction s_update = 0;
+
+    BSLMT_ONCE_DO {
+        s_update = selectUpdateFunction();
+    }
+
+    d_crc = s_update(d_crc, (const unsigned char *)data, length);
 }
 
 // ACCESSORS
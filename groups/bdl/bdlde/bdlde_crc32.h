@@ -29,6 +29,28 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Performance
+///-----------
+// On x86-64 processors supporting the PCLMULQDQ (or VPCLMULQDQ and AVX-512)
+// instructions, 'update' processes long inputs with carry-less
+// multiplications, many times faster than the table-driven algorithm used
+// otherwise.  The implementation is selected at run time, and all
+// implementations produce the same checksums.
+//
+///Combining Checksums
+///-------------------
+// The class method 'combine' computes the checksum of the concatenation of two
+// datasets from the checksums of each dataset and the length of the second,
+// in time logarithmic in that length.  This allows, for example, a large
+// buffer to be checksummed in chunks by several threads:
+//..
+//  const unsigned int crcA = bdlde::Crc32(data, lengthA).checksum();
+//  const unsigned int crcB = bdlde::Crc32(data + lengthA, lengthB).checksum();
+//
+//  assert(bdlde::Crc32::combine(crcA, crcB, lengthB)
+//            == bdlde::Crc32(data, lengthA + lengthB).checksum());
+//..
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -122,6 +144,14 @@ class Crc32 {
 
   public:
     // CLASS METHODS
+    static unsigned int combine(unsigned int crcA,
+                                unsigned int crcB,
+                                bsl::size_t  lengthB);
+        // Return the CRC-32 checksum of the concatenation of a dataset 'A'
+        // having the specified 'crcA' checksum and a dataset 'B' having the
+        // specified 'crcB' checksum and the specified 'lengthB' (in bytes).
+        // Note that the length of 'A' is not needed.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
@@ -72,6 +72,7 @@ using namespace bsl;  // automatically added by script
 //
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static unsigned int combine(unsigned int, unsigned int, size_t);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -86,6 +87,7 @@ using namespace bsl;  // automatically added by script
 // [ 4] unsigned int checksumAndReset();
 // [13] void reset();
 // [11] void update(const void *data, int length);
+// [15] void update(const void *data, int length);  // long inputs
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -98,10 +100,11 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: LONG INPUTS
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -516,7 +519,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -547,6 +550,179 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine' returns the checksum of the concatenation of two
+        //:   datasets given the checksum of each and the length of the second,
+        //:   for any lengths, including 0.
+        //:
+        //: 2 'combine' is consistent for lengths too large to be checksummed
+        //:   in a test driver.
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random bytes.  For a set of lengths,
+        //:   and for each way of splitting the corresponding portion of the
+        //:   buffer in two, verify that 'combine' applied to the checksums of
+        //:   the two parts (computed by the oracle) yields the checksum of the
+        //:   whole.  (C-1)
+        //:
+        //: 2 For a table of lengths, some of them larger than 2^32 on 64-bit
+        //:   platforms, verify that combining three checksums gives the same
+        //:   result regardless of the order in which the pairs are combined.
+        //:   (C-2)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING 'combine'"
+                             "\n" "=================" "\n";
+
+        enum { k_BUFFER_SIZE = 1100 };
+
+        char buffer[k_BUFFER_SIZE];
+        for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+            buffer[i] = static_cast<char>((i * 2654435761U) >> 24);
+        }
+
+        if (verbose) cout << "\nCombining the checksums of two parts." << endl;
+        {
+            static const int LENGTHS[] = {
+                0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65,
+                255, 256, 257, 1000, k_BUFFER_SIZE
+            };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const int LENGTH = LENGTHS[i];
+                const unsigned int EXP = crc(buffer, LENGTH);
+
+                for (int lengthA = 0; lengthA <= LENGTH; ++lengthA) {
+                    const int LENGTH_B = LENGTH - lengthA;
+
+                    const unsigned int CRC_A = crc(buffer, lengthA);
+                    const unsigned int CRC_B = crc(buffer + lengthA, LENGTH_B);
+
+                    LOOP2_ASSERT(LENGTH, lengthA,
+                                 EXP == Obj::combine(CRC_A, CRC_B, LENGTH_B));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nCombining three checksums." << endl;
+        {
+            const bsl::size_t BIG = static_cast<bsl::size_t>(-1) / 3;
+
+            static const bsl::size_t LENGTHS[] = {
+                0, 1, 7, 64, 4096, 65537, 1000000007, BIG, BIG + 1
+            };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            const unsigned int A = crc(buffer,       100);
+            const unsigned int B = crc(buffer + 100, 200);
+            const unsigned int C = crc(buffer + 300, 300);
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                for (int j = 0; j < NUM_LENGTHS; ++j) {
+                    const bsl::size_t LB = LENGTHS[i];
+                    const bsl::size_t LC = LENGTHS[j];
+
+                    const unsigned int BC = Obj::combine(B, C, LC);
+                    const unsigned int AB = Obj::combine(A, B, LB);
+
+                    LOOP2_ASSERT(i, j, Obj::combine(AB, C, LC)
+                                              == Obj::combine(A, BC, LB + LC));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nCombining with an empty dataset." << endl;
+        {
+            const unsigned int A = crc(buffer, 100);
+
+            ASSERT(A == Obj::combine(A, 0, 0));
+            ASSERT(A == Obj::combine(0, A, 100));
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'update' WITH LONG INPUTS
+        //   On processors supporting carry-less multiplication, 'update'
+        //   processes long inputs in blocks of 16, 64, or 256 bytes.
+        //
+        // Concerns:
+        //: 1 'update' computes the same checksum as the oracle for inputs of
+        //:   every length up to several blocks, in particular around the
+        //:   lengths at which the block implementations take over.
+        //:
+        //: 2 The checksum does not depend on the alignment of the input.
+        //:
+        //: 3 The checksum does not depend on how the input is split across
+        //:   calls to 'update', in particular when the first part leaves the
+        //:   checksum in a state other than the default.
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random bytes.  For every length in
+        //:   '[0 .. 1100]' and every offset in '[0 .. 15]', verify that the
+        //:   checksum of the corresponding portion of the buffer is the same
+        //:   as that computed by the oracle.  (C-1..2)
+        //:
+        //: 2 For a set of lengths, and for each way of splitting the
+        //:   corresponding portion of the buffer in two, verify that the
+        //:   checksum computed by two calls to 'update' is the same as that
+        //:   computed by the oracle.  (C-3)
+        //
+        // Testing:
+        //   void update(const void *data, int length);  // long inputs
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING 'update' WITH LONG INPUTS"
+                             "\n" "=================================" "\n";
+
+        enum { k_MAX_LENGTH = 1100, k_MAX_OFFSET = 16 };
+
+        char buffer[k_MAX_LENGTH + k_MAX_OFFSET];
+        for (int i = 0; i < k_MAX_LENGTH + k_MAX_OFFSET; ++i) {
+            buffer[i] = static_cast<char>((i * 2654435761U) >> 24);
+        }
+
+        if (verbose) cout << "\nAll lengths and alignments." << endl;
+
+        for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                const char *DATA = buffer + offset;
+
+                Obj mX;  const Obj& X = mX;
+                mX.update(DATA, length);
+
+                LOOP2_ASSERT(offset,
+                             length,
+                             crc(DATA, length) == X.checksum());
+            }
+        }
+
+        if (verbose) cout << "\nSplit inputs." << endl;
+
+        static const int LENGTHS[] = { 64, 65, 255, 256, 257, 320, 1024 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS; ++i) {
+            const int LENGTH = LENGTHS[i];
+
+            const unsigned int EXP = crc(buffer, LENGTH);
+
+            for (int split = 0; split <= LENGTH; ++split) {
+                Obj mX;  const Obj& X = mX;
+                mX.update(buffer, split);
+                mX.update(buffer + split, LENGTH - split);
+
+                LOOP2_ASSERT(LENGTH, split, EXP == X.checksum());
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2680,6 +2856,72 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LONG INPUTS
+        //
+        // Concerns:
+        //: 1 The throughput of 'update' on long inputs is substantially
+        //:   higher than that of the table-driven oracle on processors
+        //:   supporting carry-less multiplication.
+        //
+        // Plan:
+        //: 1 Time 'update' and the oracle on buffers of a few sizes, and
+        //:   report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LONG INPUTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: LONG INPUTS"
+                          << "\n=============================" << endl;
+
+        enum { k_TOTAL_BYTES = 1 << 30 };
+
+        bsl::vector<char> buffer(1 << 20);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>((i * 2654435761U) >> 24);
+        }
+
+        static const int SIZES[] = { 256, 4096, 65536, 1 << 20 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE           = SIZES[i];
+            const int NUM_ITERATIONS = k_TOTAL_BYTES / SIZE;
+
+            Obj             mX;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                mX.update(buffer.data(), SIZE);
+            }
+            timer.stop();
+
+            const double updateTime = timer.elapsedTime();
+
+            unsigned int oracle = 0;
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS / 16; ++j) {
+                oracle = update_crc(oracle, buffer.data(), SIZE);
+            }
+            timer.stop();
+
+            const double oracleTime = timer.elapsedTime() * 16;
+
+            cout << "size " << SIZE << ": update "
+                 << k_TOTAL_BYTES / updateTime / 1e9 << " GB/s, oracle "
+                 << k_TOTAL_BYTES / oracleTime / 1e9 << " GB/s"
+                 << endl;
+
+            if (veryVerbose) {
+                T_ P_(mX.checksum()) P(oracle)
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -9,10 +9,14 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 #include <bsl_cstddef.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 #include <bsla_unused.h>
 
+#include <bslma_default.h>
+
 #include <bslmt_once.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -1293,6 +1297,92 @@ unsigned int Crc32cCalculator::operator()(const unsigned char *data,
     return s_crc32cFn(data, length, crc);
 }
 
+                        // ----------------------------
+                        // CRC32-C combination helpers
+                        // ----------------------------
+
+const unsigned int k_CASTAGNOLI_POLYNOMIAL = 0x82F63B78U;
+    // The CRC32-C (Castagnoli) generator polynomial, bit-reflected.
+
+const bsl::size_t k_MIN_PARALLEL_CHUNK = 1024 * 1024;
+    // The minimum number of bytes assigned to each thread by
+    // 'Crc32c::calculateParallel'; below this size the cost of creating and
+    // joining a thread exceeds that of the calculation it saves.
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b' modulo the CRC32-C
+    // polynomial, all three being bit-reflected.
+{
+    unsigned int product = 0;
+    for (unsigned int mask = 1U << 31; mask; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = b & 1 ? (b >> 1) ^ k_CASTAGNOLI_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+unsigned int xPowerModP(bsl::size_t numBytes)
+    // Return 'x^(8 * numBytes)' modulo the CRC32-C polynomial, bit-reflected.
+{
+    unsigned int result = 1U << 31;         // x^0
+    unsigned int power  = 1U << (31 - 8);   // x^8, then x^16, x^32, ...
+
+    for (; numBytes; numBytes >>= 1) {
+        if (numBytes & 1) {
+            result = multiplyModP(result, power);
+        }
+        power = multiplyModP(power, power);
+    }
+    return result;
+}
+
+                        // -------------------
+                        // struct ParallelChunk
+                        // -------------------
+
+struct ParallelChunk {
+    // This 'struct' describes the part of a buffer assigned to one thread by
+    // 'Crc32c::calculateParallel', and holds the result of its calculation.
+
+    // DATA
+    const unsigned char *d_data_p;   // first byte of the chunk
+    bsl::size_t          d_length;   // number of bytes in the chunk
+    unsigned int         d_crc;      // CRC32-C of the chunk, once calculated
+};
+
+                        // --------------------------
+                        // class ParallelChunkFunctor
+                        // --------------------------
+
+class ParallelChunkFunctor {
+    // This class provides an invocable object, suitable for
+    // 'bslmt::ThreadUtil::create', that calculates the CRC32-C value of a
+    // 'ParallelChunk'.
+
+    // DATA
+    ParallelChunk *d_chunk_p;  // chunk to process (held, not owned)
+
+  public:
+    // CREATORS
+    explicit ParallelChunkFunctor(ParallelChunk *chunk)
+        // Create a functor that calculates the CRC32-C value of the specified
+        // 'chunk'.
+    : d_chunk_p(chunk)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Calculate the CRC32-C value of the chunk held by this object and
+        // store it in that chunk.
+    {
+        d_chunk_p->d_crc = Crc32c::calculate(d_chunk_p->d_data_p,
+                                             d_chunk_p->d_length);
+    }
+};
+
 }  // close unnamed namespace
 
 
@@ -1317,6 +1407,78 @@ unsigned int Crc32c::calculate(const void   *data,
     return calculator(static_cast<const unsigned char *>(data), length, crc);
 }
 
+unsigned int Crc32c::calculateParallel(const void   *data,
+                                       bsl::size_t   length,
+                                       int           numThreads,
+                                       unsigned int  crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(   (data || !length)
+                     && "If 'data' is 0, then 'length' also must be 0");
+    BSLS_ASSERT(0 < numThreads);
+
+    const bsl::size_t numChunks = bsl::min(
+                                static_cast<bsl::size_t>(numThreads),
+                                length / k_MIN_PARALLEL_CHUNK);
+
+    if (numChunks <= 1) {
+        return calculate(data, length, crc);                          // RETURN
+    }
+
+    // Split 'data' into 'numChunks' chunks of nearly equal length, the first
+    // of which is processed by this thread (and seeded with 'crc'), and each
+    // of the others by a new thread.
+
+    const unsigned char *begin     = static_cast<const unsigned char *>(data);
+    const bsl::size_t    chunkSize = length / numChunks;
+
+    bsl::vector<ParallelChunk>             chunks(numChunks);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numChunks);
+    bsl::vector<char>                      started(numChunks, 0);
+
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        chunks[i].d_data_p = begin + i * chunkSize;
+        chunks[i].d_length = i + 1 < numChunks
+                           ? chunkSize
+                           : length - i * chunkSize;
+        chunks[i].d_crc    = k_NULL_CRC32C;
+    }
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    for (bsl::size_t i = 1; i < numChunks; ++i) {
+        started[i] = 0 == bslmt::ThreadUtil::createWithAllocator(
+                                             &handles[i],
+                                             ParallelChunkFunctor(&chunks[i]),
+                                             allocator);
+    }
+
+    chunks[0].d_crc = calculate(chunks[0].d_data_p, chunks[0].d_length, crc);
+
+    for (bsl::size_t i = 1; i < numChunks; ++i) {
+        if (started[i]) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+        else {
+            const ParallelChunkFunctor functor(&chunks[i]);
+            functor();
+        }
+    }
+
+    unsigned int result = chunks[0].d_crc;
+    for (bsl::size_t i = 1; i < numChunks; ++i) {
+        result = combine(result, chunks[i].d_crc, chunks[i].d_length);
+    }
+    return result;
+}
+
+unsigned int Crc32c::combine(unsigned int crcA,
+                             unsigned int crcB,
+                             bsl::size_t  lengthB)
+{
+    return multiplyModP(xPowerModP(lengthB), crcA) ^ crcB;
+}
+
                              // ------------------
                              // struct Crc32c_Impl
                              // ------------------
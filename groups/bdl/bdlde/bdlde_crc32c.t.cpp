@@ -229,14 +229,17 @@ using namespace bsl;
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] unsigned int Crc32c::combine(unsigned int, unsigned int, size_t);
+// [8] unsigned int Crc32c::calculateParallel(const void *, size_t, int, uint);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
 // [-4] DEFAULT & FOLLY PERFORMANCE TEST
 // [-5] PERFORMANCE TEST ON USER INPUT
+// [-6] PARALLEL PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1319,6 +1322,175 @@ void test6_multithreadedCrc32cSoftware()
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
 
+void test7_combine()
+    // ------------------------------------------------------------------------
+    // COMBINE
+    //
+    // Concerns:
+    //: 1 'combine' returns the CRC32-C value of the concatenation of two
+    //:   buffers given the CRC32-C value of each and the length of the second.
+    //:
+    //: 2 Combining with an empty second buffer returns the first CRC32-C
+    //:   value, and combining into the null CRC32-C value returns the second.
+    //:
+    //: 3 'combine' is correct for second buffers long enough to exercise
+    //:   many bits of the length.
+    //
+    // Plan:
+    //: 1 For a buffer of pseudo-random bytes, and for every split point in a
+    //:   set of split points, compare the combination of the CRC32-C values
+    //:   of the prefix and the suffix to the CRC32-C value of the buffer,
+    //:   including split points at both ends.  (C-1..3)
+    //
+    // Testing:
+    //   unsigned int Crc32c::combine(unsigned int, unsigned int, size_t);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "COMBINE" << bsl::endl
+                           << "=======" << bsl::endl;
+
+    const bsl::size_t k_LENGTH = 70000;
+
+    bsl::vector<unsigned char> buffer(k_LENGTH, pa);
+    unsigned int               seed = 12345;
+    for (bsl::size_t i = 0; i < k_LENGTH; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<unsigned char>(seed >> 16);
+    }
+
+    const unsigned char *DATA = buffer.data();
+
+    const bsl::size_t LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 63, 64, 65, 255, 256,
+                                    4096, 65536, k_LENGTH };
+    const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t  LENGTH   = LENGTHS[ti];
+        const unsigned int EXPECTED = Crc32c::calculate(DATA, LENGTH);
+
+        if (veryVerbose) { T_ P(LENGTH) }
+
+        ASSERTV(LENGTH, EXPECTED == Crc32c::combine(EXPECTED,
+                                                    Crc32c::k_NULL_CRC32C,
+                                                    0));
+        ASSERTV(LENGTH, EXPECTED == Crc32c::combine(Crc32c::k_NULL_CRC32C,
+                                                    EXPECTED,
+                                                    LENGTH));
+
+        for (bsl::size_t tj = 0; tj < NUM_LENGTHS; ++tj) {
+            const bsl::size_t PREFIX = LENGTHS[tj];
+
+            if (PREFIX > LENGTH) {
+                continue;
+            }
+
+            const unsigned int crcA = Crc32c::calculate(DATA, PREFIX);
+            const unsigned int crcB = Crc32c::calculate(DATA + PREFIX,
+                                                        LENGTH - PREFIX);
+
+            ASSERTV(LENGTH, PREFIX,
+                    EXPECTED == Crc32c::combine(crcA, crcB, LENGTH - PREFIX));
+        }
+    }
+}
+
+void test8_calculateParallel()
+    // ------------------------------------------------------------------------
+    // CALCULATE PARALLEL
+    //
+    // Concerns:
+    //: 1 'calculateParallel' returns the same value as 'calculate' for any
+    //:   buffer, any number of threads, and any starting CRC32-C value.
+    //:
+    //: 2 Buffers too short to be split, including the empty buffer, are
+    //:   handled.
+    //:
+    //: 3 The last chunk of a buffer whose length is not a multiple of the
+    //:   number of chunks is processed in full.
+    //:
+    //: 4 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 For a table of buffer lengths, both shorter and longer than the
+    //:   minimum length of a chunk, and several numbers of threads and
+    //:   starting values, compare the result of 'calculateParallel' to that
+    //:   of 'calculate'.  (C-1..3)
+    //:
+    //: 2 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for a non-positive number of threads.  (C-4)
+    //
+    // Testing:
+    //   unsigned Crc32c::calculateParallel(const void *, size_t, int, uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "CALCULATE PARALLEL" << bsl::endl
+                           << "==================" << bsl::endl;
+
+    const bsl::size_t k_MAX_LENGTH = 9 * 1024 * 1024 + 7;
+
+    bsl::vector<unsigned char> buffer(k_MAX_LENGTH, pa);
+    unsigned int               seed = 54321;
+    for (bsl::size_t i = 0; i < k_MAX_LENGTH; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<unsigned char>(seed >> 16);
+    }
+
+    const unsigned char *DATA = buffer.data();
+
+    const bsl::size_t LENGTHS[] = { 0,
+                                    1,
+                                    1000,
+                                    1024 * 1024 - 1,
+                                    1024 * 1024,
+                                    2 * 1024 * 1024 + 1,
+                                    5 * 1024 * 1024 + 3,
+                                    k_MAX_LENGTH };
+    const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    const int          THREADS[] = { 1, 2, 3, 4, 8 };
+    const bsl::size_t  NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+    const unsigned int CRCS[] = { Crc32c::k_NULL_CRC32C, 0xE3069283 };
+    const bsl::size_t  NUM_CRCS = sizeof CRCS / sizeof *CRCS;
+
+    for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t LENGTH = LENGTHS[ti];
+
+        for (bsl::size_t tc = 0; tc < NUM_CRCS; ++tc) {
+            const unsigned int CRC      = CRCS[tc];
+            const unsigned int EXPECTED = Crc32c::calculate(DATA,
+                                                            LENGTH,
+                                                            CRC);
+
+            for (bsl::size_t tt = 0; tt < NUM_THREADS; ++tt) {
+                const int NUM = THREADS[tt];
+
+                if (veryVerbose) { T_ P_(LENGTH) P_(CRC) P(NUM) }
+
+                ASSERTV(LENGTH, CRC, NUM,
+                        EXPECTED == Crc32c::calculateParallel(DATA,
+                                                              LENGTH,
+                                                              NUM,
+                                                              CRC));
+            }
+        }
+    }
+
+    ASSERT(Crc32c::k_NULL_CRC32C == Crc32c::calculateParallel(0, 0, 2));
+
+    if (verbose) cout << "\nNegative Testing." << endl;
+    {
+        bsls::AssertTestHandlerGuard hG;
+
+        ASSERT_PASS(Crc32c::calculateParallel(DATA, 10,  1));
+        ASSERT_FAIL(Crc32c::calculateParallel(DATA, 10,  0));
+        ASSERT_FAIL(Crc32c::calculateParallel(DATA, 10, -1));
+        ASSERT_FAIL(Crc32c::calculateParallel(0,    10,  1));
+    }
+}
+
 void testN1_performanceDefault()
     // ------------------------------------------------------------------------
     // PERFORMANCE: CALCULATE CRC32-C ON BUFFER DEFAULT
@@ -1835,6 +2007,66 @@ void testN5_performanceDefaultUserInput()
          << "\n\n";
 }
 
+void testN6_performanceParallel()
+    // ------------------------------------------------------------------------
+    // PERFORMANCE: CALCULATE CRC32-C PARALLEL
+    //
+    // Concerns:
+    //: 1 Compare the throughput of 'bdlde::Crc32c::calculateParallel' using
+    //:   various numbers of threads to that of 'bdlde::Crc32c::calculate' on
+    //:   large buffers.
+    //
+    // Testing:
+    //   unsigned Crc32c::calculateParallel(const void *, size_t, int, uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                    << "PERFORMANCE: CALCULATE CRC32-C PARALLEL" << bsl::endl
+                    << "=======================================" << bsl::endl;
+
+    const bsl::size_t k_MAX_LENGTH = 256 * 1024 * 1024;  // 256 Mi
+    const int         k_NUM_ITERS  = 10;
+
+    bsl::vector<char> buffer(k_MAX_LENGTH, pa);
+    for (bsl::size_t i = 0; i < k_MAX_LENGTH; ++i) {
+        buffer[i] = static_cast<char>(bsl::rand());
+    }
+
+    const int THREADS[] = { 2, 4, 8, 16 };
+
+    for (bsl::size_t length = 4 * 1024 * 1024;
+         length <= k_MAX_LENGTH;
+         length *= 4) {
+        bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ITERS; ++i) {
+            Crc32c::calculate(buffer.data(), length);
+        }
+        const bsls::Types::Int64 serialTime =
+                            (bsls::TimeUtil::getTimer() - startTime) /
+                                                                   k_NUM_ITERS;
+
+        cout << "length: " << length << ", serial (ns): " << serialTime
+             << '\n';
+
+        for (bsl::size_t t = 0; t < sizeof THREADS / sizeof *THREADS; ++t) {
+            startTime = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < k_NUM_ITERS; ++i) {
+                Crc32c::calculateParallel(buffer.data(), length, THREADS[t]);
+            }
+            const bsls::Types::Int64 parallelTime =
+                            (bsls::TimeUtil::getTimer() - startTime) /
+                                                                   k_NUM_ITERS;
+
+            cout << "    threads: " << THREADS[t]
+                 << ", parallel (ns): " << parallelTime
+                 << ", speedup: "
+                 << static_cast<double>(serialTime) /
+                                           static_cast<double>(parallelTime)
+                 << '\n';
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1868,7 +2100,7 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1911,6 +2143,12 @@ int main(int argc, char* argv[])
                                             checksum);
 //..
       } break;
+      case  8: {
+        test8_calculateParallel();
+      } break;
+      case  7: {
+        test7_combine();
+      } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
       } break;
@@ -1944,6 +2182,9 @@ int main(int argc, char* argv[])
       case -5: {
         testN5_performanceDefaultUserInput();
       } break;
+      case -6: {
+        testN6_performanceParallel();
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
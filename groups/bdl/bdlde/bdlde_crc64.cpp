@@ -6,11 +6,47 @@
 // This implements the CRC-64 defined in ECMA 182 (with reversed polynomial
 // 0xC96C5795D7870F42), in the usual manner:
 //   http://en.wikipedia.org/wiki/Cyclic_redundancy_check
+//
+// On x86-64 processors supporting the carry-less multiplication instructions,
+// long inputs are instead processed 16 bytes (PCLMULQDQ) or 64 bytes
+// (VPCLMULQDQ) at a time by "folding", as described in "Fast CRC Computation
+// for Generic Polynomials Using PCLMULQDQ Instruction" (Gopal et al., Intel,
+// 2009).  With the bit-reflected convention used by this CRC, a 128-bit lane
+// holding the pending message bits 'H * x^64 + L' (where 'H' is the low
+// quadword) is advanced past 'D' more bits of the message by computing
+// 'H * (x^(D + 63) mod P) + L * (x^(D - 1) mod P)', the extra factor of 'x'
+// being introduced by the reflected carry-less multiplication.  The 128 bits
+// left once the input is exhausted have the same remainder as the message
+// processed so far, which is computed by Barrett reduction (with
+// 'mu = floor(x^128 / P)') before any remaining bytes are processed with
+// 'CRC_TABLE'.  The folding constants below are 'x^n mod P', bit-reflected
+// into 64 bits.
+//
+// 'combine' relies on the linearity of the CRC: appending 'n' bytes to a
+// message multiplies its (unconditioned) remainder by 'x^(8 * n) mod P', and
+// the pre- and post-conditioning cancel out for a CRC (such as this one) whose
+// initial value and final XOR are equal.
+
+#include <bslmt_once.h>
 
-#include <bsl_ostream.h>
 #include <bsls_annotation.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_ostream.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_CRC64_SIMD_ENABLED
+# define BDLDE_CRC64_TARGET(ISA) __attribute__((target(ISA)))
+    // The folding implementations are compiled for their instruction set by
+    // means of the 'target' attribute, and are selected at run time according
+    // to the capabilities of the processor.
+#endif
+
 namespace BloombergLP {
 
 // STATIC DATA
@@ -274,18 +310,28 @@ static const bsls::Types::Uint64 CRC_TABLE[256] = {
     0xe0ada17364673f59ULL
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc64
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc64::update(const void *data, bsl::size_t length)
-{
-    BSLS_ASSERT(data || !length);
+typedef bsls::Types::Uint64 Uint64;
+
+typedef Uint64 (*UpdateFunction)(Uint64               crc,
+                                 const unsigned char *data,
+                                 bsl::size_t          length);
+    // 'UpdateFunction' is an alias for a function that returns the CRC-64
+    // register resulting from processing the specified 'data' having the
+    // specified 'length' starting from the specified 'crc' register.
 
-    const unsigned char *d = (const unsigned char *)data;
-    bsls::Types::Uint64 tmp = d_crc;
+const Uint64 k_POLYNOMIAL = 0xC96C5795D7870F42ULL;  // bit-reflected 'P'
+
+Uint64 updateSoftware(Uint64               crc,
+                      const unsigned char *data,
+                      bsl::size_t          length)
+    // Return the CRC-64 register resulting from processing the specified
+    // 'data' having the specified 'length' starting from the specified 'crc'
+    // register, one byte at a time.
+{
+    const unsigned char *d = data;
+    Uint64               tmp = crc;
 
     switch (length % 8) {
       case 7:
@@ -325,7 +371,275 @@ void Crc64::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+#if defined(BDLDE_CRC64_SIMD_ENABLED)
+
+// Folding constants, as 'x^n mod P' bit-reflected into 64 bits.  A lane is
+// advanced by 'D' bits by multiplying its low quadword by 'x^(D + 63) mod P'
+// and its high quadword by 'x^(D - 1) mod P'.
+
+const Uint64 k_X2111 = 0x8260adf2381ad81cULL;  // D = 2048
+const Uint64 k_X2047 = 0xf31fd9271e228b79ULL;
+const Uint64 k_X575  = 0x6ae3efbb9dd441f3ULL;  // D =  512
+const Uint64 k_X511  = 0x081f6054a7842df4ULL;
+const Uint64 k_X447  = 0xb5ea1af9c013aca4ULL;  // D =  384
+const Uint64 k_X383  = 0x69a35d91c3730254ULL;
+const Uint64 k_X319  = 0x60095b008a9efa44ULL;  // D =  256
+const Uint64 k_X255  = 0x3be653a30fe1af51ULL;
+const Uint64 k_X191  = 0xe05dd497ca393ae4ULL;  // D =  128
+const Uint64 k_X127  = 0xdabe95afc7875f40ULL;
+
+const Uint64 k_MU    = 0x4e1f23360b94b1eaULL;  // 'mu - x^64', bit-reflected
+
+inline BDLDE_CRC64_TARGET("pclmul,sse4.1")
+__m128i fold128(__m128i lane, __m128i constants)
+    // Return the specified 'lane' multiplied by the specified folding
+    // 'constants'.
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(lane, constants, 0x00),
+                         _mm_clmulepi64_si128(lane, constants, 0x11));
+}
+
+inline BDLDE_CRC64_TARGET("pclmul,sse4.1")
+Uint64 reducePclmul(__m128i lane)
+    // Return the CRC-64 register resulting from processing the 16 bytes of
+    // the specified 'lane' starting from a zero register.
+{
+    const __m128i k = _mm_set_epi64x(k_MU, k_X127);
+
+    // Fold the low quadword into the high one, leaving (at most) 128 bits of
+    // 'lane * x^64', congruent modulo 'P' and having 'q' as quotient.
+
+    const __m128i folded = _mm_xor_si128(_mm_clmulepi64_si128(lane, k, 0x00),
+                                         _mm_srli_si128(lane, 8));
+
+    const Uint64 high = _mm_cvtsi128_si64(folded);
+    const Uint64 q    = high ^ (static_cast<Uint64>(_mm_cvtsi128_si64(
+                               _mm_clmulepi64_si128(folded, k, 0x10))) << 1);
+
+    const __m128i qp = _mm_clmulepi64_si128(_mm_cvtsi64_si128(q),
+                                            _mm_cvtsi64_si128(k_POLYNOMIAL),
+                                            0x00);
+
+    return static_cast<Uint64>(_mm_extract_epi64(folded, 1))
+         ^ (static_cast<Uint64>(_mm_extract_epi64(qp, 1)) << 1)
+         ^ (static_cast<Uint64>(_mm_cvtsi128_si64(qp)) >> 63);
+}
+
+inline BDLDE_CRC64_TARGET("pclmul,sse4.1")
+Uint64 finishPclmul(__m128i              lane,
+                    const unsigned char *data,
+                    bsl::size_t          length)
+    // Return the CRC-64 register resulting from folding the specified 'data'
+    // having the specified 'length' into the specified 'lane' 16 bytes at a
+    // time, and then reducing 'lane' and the remaining bytes of 'data'.
+{
+    const __m128i k128 = _mm_set_epi64x(k_X127, k_X191);
+
+    for (; length >= 16; data += 16, length -= 16) {
+        lane = _mm_xor_si128(fold128(lane, k128),
+                             _mm_loadu_si128((const __m128i *)data));
+    }
+
+    return updateSoftware(reducePclmul(lane), data, length);
+}
+
+BDLDE_CRC64_TARGET("pclmul,sse4.1")
+Uint64 updatePclmul(Uint64               crc,
+                    const unsigned char *data,
+                    bsl::size_t          length)
+    // Return the CRC-64 register resulting from processing the specified
+    // 'data' having the specified 'length' starting from the specified 'crc'
+    // register, 64 bytes at a time using PCLMULQDQ.
+{
+    if (length < 64) {
+        return updateSoftware(crc, data, length);                     // RETURN
+    }
+
+    const __m128i *d = (const __m128i *)data;
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(d + 0),
+                               _mm_cvtsi64_si128(crc));
+    __m128i x1 = _mm_loadu_si128(d + 1);
+    __m128i x2 = _mm_loadu_si128(d + 2);
+    __m128i x3 = _mm_loadu_si128(d + 3);
+
+    d      += 4;
+    length -= 64;
+
+    const __m128i k512 = _mm_set_epi64x(k_X511, k_X575);
+
+    for (; length >= 64; d += 4, length -= 64) {
+        x0 = _mm_xor_si128(fold128(x0, k512), _mm_loadu_si128(d + 0));
+        x1 = _mm_xor_si128(fold128(x1, k512), _mm_loadu_si128(d + 1));
+        x2 = _mm_xor_si128(fold128(x2, k512), _mm_loadu_si128(d + 2));
+        x3 = _mm_xor_si128(fold128(x3, k512), _mm_loadu_si128(d + 3));
+    }
+
+    const __m128i k128 = _mm_set_epi64x(k_X127, k_X191);
+
+    x1 = _mm_xor_si128(fold128(x0, k128), x1);
+    x2 = _mm_xor_si128(fold128(x1, k128), x2);
+    x3 = _mm_xor_si128(fold128(x2, k128), x3);
+
+    return finishPclmul(x3, (const unsigned char *)d, length);
+}
+
+inline BDLDE_CRC64_TARGET("vpclmulqdq,avx512f,pclmul,sse4.1")
+__m512i fold512(__m512i lanes, __m512i constants, __m512i data)
+    // Return the specified 'lanes' multiplied by the specified folding
+    // 'constants', plus the specified 'data'.
+{
+    return _mm512_ternarylogic_epi64(
+                             _mm512_clmulepi64_epi128(lanes, constants, 0x00),
+                             _mm512_clmulepi64_epi128(lanes, constants, 0x11),
+                             data,
+                             0x96);
+}
+
+BDLDE_CRC64_TARGET("vpclmulqdq,avx512f,pclmul,sse4.1")
+Uint64 updateVpclmul(Uint64               crc,
+                     const unsigned char *data,
+                     bsl::size_t          length)
+    // Return the CRC-64 register resulting from processing the specified
+    // 'data' having the specified 'length' starting from the specified 'crc'
+    // register, 256 bytes at a time using VPCLMULQDQ.
+{
+    if (length < 256) {
+        return updatePclmul(crc, data, length);                       // RETURN
+    }
+
+    const __m512i *d = (const __m512i *)data;
+
+    __m512i z0 = _mm512_xor_si512(_mm512_loadu_si512(d + 0),
+                                  _mm512_set_epi64(0, 0, 0, 0, 0, 0, 0, crc));
+    __m512i z1 = _mm512_loadu_si512(d + 1);
+    __m512i z2 = _mm512_loadu_si512(d + 2);
+    __m512i z3 = _mm512_loadu_si512(d + 3);
+
+    d      += 4;
+    length -= 256;
+
+    const __m512i k2048 = _mm512_set_epi64(k_X2047, k_X2111, k_X2047, k_X2111,
+                                           k_X2047, k_X2111, k_X2047, k_X2111);
+
+    for (; length >= 256; d += 4, length -= 256) {
+        z0 = fold512(z0, k2048, _mm512_loadu_si512(d + 0));
+        z1 = fold512(z1, k2048, _mm512_loadu_si512(d + 1));
+        z2 = fold512(z2, k2048, _mm512_loadu_si512(d + 2));
+        z3 = fold512(z3, k2048, _mm512_loadu_si512(d + 3));
+    }
+
+    const __m512i k512 = _mm512_set_epi64(k_X511, k_X575, k_X511, k_X575,
+                                          k_X511, k_X575, k_X511, k_X575);
+
+    z1 = fold512(z0, k512, z1);
+    z2 = fold512(z1, k512, z2);
+    z3 = fold512(z2, k512, z3);
+
+    // Fold the four lanes of 'z3' into one, the first lane being 384 bits
+    // away from the last one.
+
+    const __m128i lane0 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 0);
+    const __m128i lane1 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 1);
+    const __m128i lane2 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 2);
+    const __m128i lane3 = _mm512_maskz_extracti32x4_epi32(0xf, z3, 3);
+
+    __m128i x = _mm_xor_si128(fold128(lane0, _mm_set_epi64x(k_X383, k_X447)),
+                              fold128(lane1, _mm_set_epi64x(k_X255, k_X319)));
+    x = _mm_xor_si128(x, fold128(lane2, _mm_set_epi64x(k_X127, k_X191)));
+    x = _mm_xor_si128(x, lane3);
+
+    // The upper halves of the vector registers are cleared explicitly, lest
+    // the SSE and scalar code that follows incur transition penalties (the
+    // compiler does not do so itself for functions having a 'target'
+    // attribute).
+
+    _mm256_zeroupper();
+
+    return finishPclmul(x, (const unsigned char *)d, length);
+}
+
+#endif  // BDLDE_CRC64_SIMD_ENABLED
+
+UpdateFunction selectUpdateFunction()
+    // Return the fastest implementation of the CRC-64 update supported by the
+    // processor.
+{
+#if defined(BDLDE_CRC64_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("vpclmulqdq")
+     && __builtin_cpu_supports("avx512f")) {
+        return updateVpclmul;                                         // RETURN
+    }
+    if (__builtin_cpu_supports("pclmul")
+     && __builtin_cpu_supports("sse4.1")) {
+        return updatePclmul;                                          // RETURN
+    }
+#endif
+
+    return updateSoftware;
+}
+
+Uint64 multiplyModP(Uint64 a, Uint64 b)
+    // Return the product of the specified 'a' and 'b' modulo the CRC-64
+    // polynomial, all three being bit-reflected.
+{
+    Uint64 product = 0;
+    for (Uint64 mask = 1ULL << 63; mask; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = b & 1 ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+Uint64 xPowerModP(bsl::size_t numBytes)
+    // Return 'x^(8 * numBytes)' modulo the CRC-64 polynomial, bit-reflected.
+{
+    Uint64 result = 1ULL << 63;         // x^0
+    Uint64 power  = 1ULL << (63 - 8);   // x^8, then x^16, x^32, ...
+
+    for (; numBytes; numBytes >>= 1) {
+        if (numBytes & 1) {
+            result = multiplyModP(result, power);
+        }
+        power = multiplyModP(power, power);
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc64
+                                // -----------
+
+// CLASS METHODS
+bsls::Types::Uint64 Crc64::combine(bsls::Types::Uint64 crcA,
+                                   bsls::Types::Uint64 crcB,
+                                   bsl::size_t         lengthB)
+{
+    return multiplyModP(xPowerModP(lengthB), crcA) ^ crcB;
+}
+
+// MANIPULATORS
+void Crc64::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    static UpdateFunction s_update = 0;
+
+    BSLMT_ONCE_DO {
+        s_update = selectUpdateFunction();
+    }
+
+    d_crc = s_update(d_crc, (const unsigned char *)data, length);
 }
 
 // ACCESSORS
@@ -21,6 +21,29 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Performance
+///-----------
+// On x86-64 processors supporting the PCLMULQDQ (or VPCLMULQDQ and AVX-512)
+// instructions, 'update' processes long inputs with carry-less
+// multiplications, many times faster than the table-driven algorithm used
+// otherwise.  The implementation is selected at run time, and all
+// implementations produce the same checksums.
+//
+///Combining Checksums
+///-------------------
+// The class method 'combine' computes the checksum of the concatenation of two
+// datasets from the checksums of each dataset and the length of the second,
+// in time logarithmic in that length.  This allows, for example, a large
+// buffer to be checksummed in chunks by several threads:
+//..
+//  const bsls::Types::Uint64 crcA = bdlde::Crc64(data, lengthA).checksum();
+//  const bsls::Types::Uint64 crcB = bdlde::Crc64(data + lengthA,
+//                                                lengthB).checksum();
+//
+//  assert(bdlde::Crc64::combine(crcA, crcB, lengthB)
+//            == bdlde::Crc64(data, lengthA + lengthB).checksum());
+//..
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -115,6 +138,14 @@ class Crc64 {
 
   public:
     // CLASS METHODS
+    static bsls::Types::Uint64 combine(bsls::Types::Uint64 crcA,
+                                       bsls::Types::Uint64 crcB,
+                                       bsl::size_t         lengthB);
+        // Return the CRC-64 checksum of the concatenation of a dataset 'A'
+        // having the specified 'crcA' checksum and a dataset 'B' having the
+        // specified 'crcB' checksum and the specified 'lengthB' (in bytes).
+        // Note that the length of 'A' is not needed.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
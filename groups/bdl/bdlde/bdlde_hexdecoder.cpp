@@ -5,6 +5,23 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_hexdecoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_HEXDECODER_SIMD_ENABLED
+# define BDLDE_HEXDECODER_TARGET(ISA) __attribute__((target(ISA)))
+    // The SSSE3 implementation of the bulk decoding loop is compiled for that
+    // instruction set by means of the 'target' attribute, and is selected at
+    // run time if the processor supports it.
+#endif
+
 namespace {
 namespace u {
 
@@ -144,6 +161,157 @@ static const char hexValueTable[128] =
     0    // 127  7f - DEL
 };
 
+                // ========================
+                // FILE-SCOPE BULK DECODING
+                // ========================
+
+inline
+int digitValue(char character)
+    // Return the value of the specified 'character' if it is a hex digit, and
+    // -1 otherwise.
+{
+    const unsigned int digit  = static_cast<unsigned char>(character) - '0';
+    const unsigned int letter = (static_cast<unsigned char>(character) | 0x20)
+                              - 'a';
+
+    return digit  <= 9 ? static_cast<int>(digit)
+         : letter <= 5 ? static_cast<int>(letter) + 10
+         :               -1;
+}
+
+typedef bsl::size_t (*DecodeBlocksFunction)(char        *out,
+                                            const char  *in,
+                                            bsl::size_t  numIn);
+    // Alias for a function that decodes the longest prefix of the specified
+    // 'numIn' characters at the specified 'in' address consisting of pairs of
+    // hex digits, writes the resulting bytes to the specified 'out' buffer,
+    // and returns the number of characters decoded.
+
+bsl::size_t decodeBlocksScalar(char        *out,
+                               const char  *in,
+                               bsl::size_t  numIn)
+    // Decode the longest prefix of the specified 'numIn' characters at the
+    // specified 'in' address consisting of pairs of hex digits, write the
+    // resulting bytes to the specified 'out' buffer, and return the number of
+    // characters decoded.
+{
+    bsl::size_t consumed = 0;
+
+    for (; consumed + 2 <= numIn; consumed += 2) {
+        const int high = digitValue(in[consumed]);
+        const int low  = digitValue(in[consumed + 1]);
+
+        if ((high | low) < 0) {
+            break;
+        }
+
+        *out++ = static_cast<char>((high << 4) | low);
+    }
+
+    return consumed;
+}
+
+#if defined(BDLDE_HEXDECODER_SIMD_ENABLED)
+
+inline BDLDE_HEXDECODER_TARGET("ssse3")
+__m128i decodeValuesSsse3(__m128i input, int *validMask)
+    // Return the values of the 16 hex digits of the specified 'input', and
+    // load into the specified 'validMask' a mask having the bit 'i' set if
+    // and only if the character 'i' of 'input' is a hex digit.  The value of
+    // a character that is not a hex digit is unspecified.
+{
+    // Subtract the first character of each range, so that each range maps to
+    // '[0 .. n]', and compare as unsigned values by means of 'min'.
+
+    const __m128i digits   = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+    const __m128i letters  = _mm_sub_epi8(
+                                     _mm_or_si128(input, _mm_set1_epi8(0x20)),
+                                     _mm_set1_epi8('a'));
+    const __m128i isDigit  = _mm_cmpeq_epi8(
+                                      _mm_min_epu8(digits, _mm_set1_epi8(9)),
+                                      digits);
+    const __m128i isLetter = _mm_cmpeq_epi8(
+                                     _mm_min_epu8(letters, _mm_set1_epi8(5)),
+                                     letters);
+
+    *validMask = _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter));
+
+    return _mm_or_si128(
+                 _mm_and_si128(isDigit, digits),
+                 _mm_and_si128(isLetter,
+                               _mm_add_epi8(letters, _mm_set1_epi8(10))));
+}
+
+BDLDE_HEXDECODER_TARGET("ssse3")
+bsl::size_t decodeBlocksSsse3(char        *out,
+                              const char  *in,
+                              bsl::size_t  numIn)
+    // Decode the longest prefix of the specified 'numIn' characters at the
+    // specified 'in' address consisting of pairs of hex digits, write the
+    // resulting bytes to the specified 'out' buffer, and return the number of
+    // characters decoded.
+{
+    // Each pair of values is combined into a 16-bit lane as 'high * 16 + low'
+    // by a multiply-add, and the lanes are then narrowed back to bytes.
+
+    const __m128i weights  = _mm_set1_epi16(0x0110);
+    bsl::size_t   consumed = 0;
+
+    for (; consumed + 32 <= numIn; consumed += 32, out += 16) {
+        const __m128i input0 = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(in + consumed));
+        const __m128i input1 = _mm_loadu_si128(
+                      reinterpret_cast<const __m128i *>(in + consumed + 16));
+
+        int           valid0;
+        int           valid1;
+        const __m128i values0 = decodeValuesSsse3(input0, &valid0);
+        const __m128i values1 = decodeValuesSsse3(input1, &valid1);
+
+        if ((valid0 & valid1) != 0xffff) {
+            break;
+        }
+
+        _mm_storeu_si128(
+                   reinterpret_cast<__m128i *>(out),
+                   _mm_packus_epi16(_mm_maddubs_epi16(values0, weights),
+                                    _mm_maddubs_epi16(values1, weights)));
+    }
+
+    return consumed + decodeBlocksScalar(out,
+                                         in + consumed,
+                                         numIn - consumed);
+}
+
+#endif  // BDLDE_HEXDECODER_SIMD_ENABLED
+
+DecodeBlocksFunction selectDecodeBlocksFunction()
+    // Return the fastest implementation of the bulk decoding loop supported
+    // by the processor.
+{
+#if defined(BDLDE_HEXDECODER_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("ssse3")) {
+        return &decodeBlocksSsse3;                                    // RETURN
+    }
+#endif
+    return &decodeBlocksScalar;
+}
+
+DecodeBlocksFunction decodeBlocksFunction()
+    // Return the fastest implementation of the bulk decoding loop supported
+    // by the processor, selecting it on the first call.
+{
+    static DecodeBlocksFunction s_decodeBlocks = 0;
+
+    BSLMT_ONCE_DO {
+        s_decodeBlocks = selectDecodeBlocksFunction();
+    }
+
+    return s_decodeBlocks;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -154,6 +322,58 @@ namespace bdlde {
                            // HexDecoder
                            // ----------
 
+// CLASS METHODS
+int HexDecoder::decode(char        *out,
+                       bsl::size_t *numOut,
+                       const char  *in,
+                       bsl::size_t  numIn)
+{
+    BSLS_ASSERT(out    || 0 == numIn);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(in     || 0 == numIn);
+
+    const u::DecodeBlocksFunction decodeBlocks = u::decodeBlocksFunction();
+
+    const char *const end        = in + numIn;
+    char             *output     = out;
+    int               firstValue = -1;
+
+    while (in != end) {
+        if (firstValue < 0) {
+            const bsl::size_t consumed = decodeBlocks(output, in, end - in);
+
+            in     += consumed;
+            output += consumed / 2;
+
+            if (in == end) {
+                break;
+            }
+        }
+
+        // The next character is whitespace, an invalid character, or a digit
+        // that is not followed by another digit.
+
+        const char character = *in++;
+        const int  value     = u::digitValue(character);
+
+        if (value < 0) {
+            if (!isSpace(character)) {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (firstValue < 0) {
+            firstValue = value;
+        }
+        else {
+            *output++  = static_cast<char>((firstValue << 4) | value);
+            firstValue = -1;
+        }
+    }
+
+    *numOut = output - out;
+    return firstValue < 0 ? 0 : -1;
+}
+
 // CREATORS
 HexDecoder::HexDecoder()
 : d_state(e_INPUT_STATE)
@@ -146,6 +146,17 @@ BSLS_IDENT("$Id: $")
 //    Encoding: A?
 //..
 //
+///Bulk Decoding
+///-------------
+// When the entire input is available in a contiguous buffer, the class method
+// 'bdlde::HexDecoder::decode' produces the same output, and accepts the same
+// inputs, as a 'convert' followed by an 'endConvert', but does so without the
+// per-character overhead of the streaming interface.  On x86-64 processors
+// supporting SSSE3, runs of input consisting solely of hex digits are
+// validated and decoded 32 characters at a time using vector instructions;
+// the instruction set is selected at run time.  Whitespace and errors are
+// handled by a scalar loop.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -265,6 +276,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iterator.h>
 
 namespace BloombergLP {
@@ -303,6 +315,24 @@ class HexDecoder {
     HexDecoder& operator=(const HexDecoder&);
 
   public:
+    // CLASS METHODS
+    static int decode(char        *out,
+                      bsl::size_t *numOut,
+                      const char  *in,
+                      bsl::size_t  numIn);
+        // Decode the specified 'numIn' characters starting at the specified
+        // 'in' address, writing the resulting bytes to the specified 'out'
+        // buffer, and load into the specified 'numOut' the number of bytes
+        // written.  Whitespace characters are ignored.  Return 0 on success,
+        // and a non-zero value if the input contains a character that is
+        // neither a hex digit nor whitespace, or an odd number of hex digits,
+        // in which case the contents of 'out' and the value of '*numOut' are
+        // unspecified.  The behavior is undefined unless 'out' refers to a
+        // buffer of at least 'numIn / 2' bytes that does not overlap
+        // '[in, in + numIn)'.  Note that this method succeeds exactly when a
+        // 'convert' followed by an 'endConvert' succeeds, and produces the
+        // same output.
+
     // CREATORS
     HexDecoder();
         // Create a Hex decoder in the initial state.
@@ -8,9 +8,11 @@
 #include <bsls_asserttest.h>
 
 #include <bsl_cstring.h>  // 'bsl::strlen', 'bsl::strncmp'
+#include <bsl_iterator.h>
 #include <bsl_list.h>
 #include <bsl_map.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 using namespace BloombergLP;
@@ -28,6 +30,9 @@ using namespace bsl;
 // sequence is converted correctly and the object itself takes the expected
 // state as a result of method calls.
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 6] static int decode(char *, size_t *, const char *, size_t);
+//
 // CREATORS
 // [ 2] HexDecoder();
 //
@@ -46,7 +51,7 @@ using namespace bsl;
 // [ 4] bool isMaximal() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -480,7 +485,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -522,6 +527,108 @@ int main(int argc, char *argv[])
     ASSERT(0 == strcmp(BLOOMBERG_NEWS, backInStream.str().c_str()));
 //..
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BULK DECODING: 'decode'
+        //
+        // Concerns:
+        //: 1 The 'decode' class method succeeds exactly when 'convert'
+        //:   followed by 'endConvert' succeeds, and then produces the same
+        //:   output.
+        //:
+        //: 2 Uppercase and lowercase digits are decoded, and whitespace is
+        //:   ignored anywhere in the input.
+        //:
+        //: 3 Characters that are not hex digits or whitespace, and an odd
+        //:   number of digits, are reported as errors wherever they occur,
+        //:   including within runs of digits long enough to be decoded by the
+        //:   vector implementation.
+        //:
+        //: 4 No byte past the output is modified.
+        //
+        // Plan:
+        //: 1 For lengths from 0 to 100 bytes, encode pseudo-random data using
+        //:   a mix of uppercase and lowercase digits.  Depending on
+        //:   pseudo-random choices, insert whitespace, replace a character by
+        //:   a character that is not a hex digit, or remove a digit.  Decode
+        //:   the result with 'decode' and with a streaming decoder, and
+        //:   compare the statuses and, on success, the outputs.  (C-1..4)
+        //
+        // Testing:
+        //   static int decode(char *, size_t *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK DECODING: 'decode'" << endl
+                          << "=======================" << endl;
+
+        static const char DIGITS[] = "0123456789abcdef0123456789ABCDEF";
+        static const char INVALID[] = "gG/:@`\x80\xff\0-";
+        static const char SPACES[] = " \t\n\v\f\r";
+
+        enum { k_MAX_LENGTH = 100 };
+
+        unsigned seed = 12345;
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (int mode = 0; mode < 8; ++mode) {
+                bsl::string input;
+                for (int i = 0; i < 2 * length; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    const unsigned r = seed >> 16;
+
+                    input.push_back(DIGITS[r % 32]);
+
+                    if ((mode & 1) && 0 == (r >> 8) % 16) {
+                        input.push_back(SPACES[(r >> 12) % 6]);
+                    }
+                }
+
+                seed = seed * 1103515245 + 12345;
+                const unsigned r = seed >> 16;
+
+                if ((mode & 2) && !input.empty()) {
+                    input[r % input.length()] = INVALID[(r >> 8) % 10];
+                }
+                if ((mode & 4) && !input.empty()) {
+                    input.erase(r % input.length(), 1);
+                }
+
+                bsl::vector<char> expected;
+                int               expectedRc;
+                {
+                    Obj decoder;
+                    expectedRc = decoder.convert(bsl::back_inserter(expected),
+                                                 input.begin(),
+                                                 input.end());
+                    if (0 == expectedRc) {
+                        expectedRc = decoder.endConvert();
+                    }
+                }
+
+                bsl::vector<char> output(input.length() / 2 + 1, '?');
+                bsl::size_t       numOut = 0;
+
+                const int rc = Obj::decode(output.data(),
+                                           &numOut,
+                                           input.data(),
+                                           input.length());
+
+                ASSERTV(length, mode, input, rc, expectedRc,
+                        (0 == rc) == (0 == expectedRc));
+
+                if (0 == rc && 0 == expectedRc) {
+                    ASSERTV(length, mode, numOut, expected.size(),
+                            expected.size() == numOut);
+                    ASSERTV(length, mode,
+                            0 == bsl::memcmp(expected.data(),
+                                             output.data(),
+                                             numOut));
+                    ASSERTV(length, mode, '?' == output[numOut]);
+                }
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING 'reset'
@@ -4,6 +4,23 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_hexencoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_HEXENCODER_SIMD_ENABLED
+# define BDLDE_HEXENCODER_TARGET(ISA) __attribute__((target(ISA)))
+    // The SSSE3 implementation of the bulk encoding loop is compiled for that
+    // instruction set by means of the 'target' attribute, and is selected at
+    // run time if the processor supports it.
+#endif
+
 namespace {
 namespace u {
                 // ======================
@@ -50,6 +67,102 @@ static const char uppercaseLettersTable[16] =
    'F' , //  15
 };
 
+                // ========================
+                // FILE-SCOPE BULK ENCODING
+                // ========================
+
+typedef void (*EncodeFunction)(char        *out,
+                               const char  *in,
+                               bsl::size_t  numIn,
+                               const char  *alphabet);
+    // Alias for a function that encodes, using the specified 16-character
+    // 'alphabet', the specified 'numIn' bytes at the specified 'in' address
+    // and writes the resulting '2 * numIn' characters to the specified 'out'
+    // buffer.
+
+void encodeScalar(char        *out,
+                  const char  *in,
+                  bsl::size_t  numIn,
+                  const char  *alphabet)
+    // Encode, using the specified 16-character 'alphabet', the specified
+    // 'numIn' bytes at the specified 'in' address and write the resulting
+    // '2 * numIn' characters to the specified 'out' buffer.
+{
+    const unsigned char *input = reinterpret_cast<const unsigned char *>(in);
+
+    for (bsl::size_t i = 0; i < numIn; ++i, out += 2) {
+        out[0] = alphabet[input[i] >> 4];
+        out[1] = alphabet[input[i] & 0x0f];
+    }
+}
+
+#if defined(BDLDE_HEXENCODER_SIMD_ENABLED)
+
+BDLDE_HEXENCODER_TARGET("ssse3")
+void encodeSsse3(char        *out,
+                 const char  *in,
+                 bsl::size_t  numIn,
+                 const char  *alphabet)
+    // Encode, using the specified 16-character 'alphabet', the specified
+    // 'numIn' bytes at the specified 'in' address and write the resulting
+    // '2 * numIn' characters to the specified 'out' buffer.
+{
+    const __m128i table = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(alphabet));
+    const __m128i mask  = _mm_set1_epi8(0x0f);
+    bsl::size_t   i     = 0;
+
+    for (; i + 16 <= numIn; i += 16, out += 32) {
+        const __m128i input = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(in + i));
+
+        // Look up the characters of the high and low nibbles of each byte,
+        // then interleave them.
+
+        const __m128i high = _mm_shuffle_epi8(
+                                table,
+                                _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+        const __m128i low  = _mm_shuffle_epi8(table,
+                                              _mm_and_si128(input, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                         _mm_unpackhi_epi8(high, low));
+    }
+
+    encodeScalar(out, in + i, numIn - i, alphabet);
+}
+
+#endif  // BDLDE_HEXENCODER_SIMD_ENABLED
+
+EncodeFunction selectEncodeFunction()
+    // Return the fastest implementation of the bulk encoding loop supported
+    // by the processor.
+{
+#if defined(BDLDE_HEXENCODER_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("ssse3")) {
+        return &encodeSsse3;                                          // RETURN
+    }
+#endif
+    return &encodeScalar;
+}
+
+EncodeFunction encodeFunction()
+    // Return the fastest implementation of the bulk encoding loop supported
+    // by the processor, selecting it on the first call.
+{
+    static EncodeFunction s_encode = 0;
+
+    BSLMT_ONCE_DO {
+        s_encode = selectEncodeFunction();
+    }
+
+    return s_encode;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -60,6 +173,24 @@ namespace bdlde {
                            // HexEncoder
                            // ----------
 
+// CLASS METHODS
+bsl::size_t HexEncoder::encode(char        *out,
+                               const char  *in,
+                               bsl::size_t  numIn,
+                               bool         upperCaseLetters)
+{
+    BSLS_ASSERT(out || 0 == numIn);
+    BSLS_ASSERT(in  || 0 == numIn);
+
+    u::encodeFunction()(out,
+                        in,
+                        numIn,
+                        upperCaseLetters ? u::uppercaseLettersTable
+                                         : u::lowercaseLettersTable);
+
+    return 2 * numIn;
+}
+
 // CREATORS
 HexEncoder::HexEncoder(bool upperCaseLetters)
 : d_state(e_INPUT_STATE)
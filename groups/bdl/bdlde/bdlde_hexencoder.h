@@ -146,6 +146,15 @@ BSLS_IDENT("$Id: $")
 //    Encoding: A?
 //..
 //
+///Bulk Encoding
+///-------------
+// When the entire input is available in a contiguous buffer, the class method
+// 'bdlde::HexEncoder::encode' produces the same output as a 'convert' followed
+// by an 'endConvert' on an encoder using the same letter case, but does so
+// without the per-character overhead of the streaming interface.  On x86-64
+// processors supporting SSSE3, the input is encoded 16 bytes at a time using
+// vector instructions; the instruction set is selected at run time.
+//
 ///Usage
 // This section illustrates intended use of this component.
 //
@@ -289,6 +298,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlde {
 
@@ -327,6 +338,23 @@ class HexEncoder {
     HexEncoder& operator=(const HexEncoder&);
 
   public:
+    // CLASS METHODS
+    static bsl::size_t encode(char        *out,
+                              const char  *in,
+                              bsl::size_t  numIn,
+                              bool         upperCaseLetters = true);
+        // Encode the specified 'numIn' bytes starting at the specified 'in'
+        // address, writing the resulting '2 * numIn' characters to the
+        // specified 'out' buffer, and return '2 * numIn'.  Optionally specify
+        // 'upperCaseLetters' to indicate if values from 10 to 15 are encoded
+        // as uppercase letters ('A'-'F') or as lowercase letters ('a'-'f').
+        // If 'upperCaseLetters' is not specified, uppercase letters are used.
+        // The behavior is undefined unless 'out' refers to a buffer of at
+        // least '2 * numIn' bytes that does not overlap '[in, in + numIn)'.
+        // Note that the output is identical to that of a 'convert' followed
+        // by an 'endConvert' on an encoder constructed with
+        // 'upperCaseLetters'.
+
     // CREATORS
     explicit HexEncoder(bool upperCaseLetters = true);
         // Create a Hex encoder in the initial state.  Optionally specify the
@@ -9,6 +9,7 @@
 #include <bsls_asserttest.h>
 
 #include <bsl_cstring.h>  // 'bsl::strncmp'
+#include <bsl_iterator.h>
 #include <bsl_list.h>
 #include <bsl_sstream.h>
 #include <bsl_vector.h>
@@ -29,6 +30,9 @@ using namespace bsl;
 // result of method calls.
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 6] static size_t encode(char *, const char *, size_t, bool);
+//
 // CREATORS
 // [ 2] HexEncoder();
 //
@@ -49,7 +53,7 @@ using namespace bsl;
 // [ 4] bool isAcceptable() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -446,7 +450,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -491,6 +495,86 @@ int main(int argc, char *argv[])
     ASSERT(0 == strcmp(BLOOMBERG_NEWS, backInStream.str().c_str()));
 //..
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BULK ENCODING: 'encode'
+        //
+        // Concerns:
+        //: 1 The 'encode' class method writes exactly '2 * numIn' characters,
+        //:   returns that number, and the characters are the same as those
+        //:   produced by 'convert' followed by 'endConvert'.
+        //:
+        //: 2 Both letter cases are supported, and uppercase is the default.
+        //:
+        //: 3 The input and the output need not be aligned, and the input may
+        //:   have any length, including lengths that are not a multiple of the
+        //:   vector width.
+        //
+        // Plan:
+        //: 1 For lengths from 0 to 100 bytes, at different offsets of the
+        //:   input and output buffers, encode pseudo-random data with both
+        //:   letter cases, and compare the result with the output of a
+        //:   streaming encoder.  Verify that the byte following the output is
+        //:   not modified.  (C-1..3)
+        //
+        // Testing:
+        //   static size_t encode(char *, const char *, size_t, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK ENCODING: 'encode'" << endl
+                          << "=======================" << endl;
+
+        enum { k_MAX_LENGTH = 100, k_MAX_OFFSET = 3 };
+
+        char     input[k_MAX_LENGTH + k_MAX_OFFSET];
+        unsigned seed = 12345;
+        for (int i = 0; i < k_MAX_LENGTH + k_MAX_OFFSET; ++i) {
+            seed     = seed * 1103515245 + 12345;
+            input[i] = static_cast<char>(seed >> 16);
+        }
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (int offset = 0; offset <= k_MAX_OFFSET; ++offset) {
+                for (int upper = 0; upper < 2; ++upper) {
+                    const char *IN = input + offset;
+
+                    bsl::vector<char> expected;
+                    {
+                        Obj encoder(upper);
+                        encoder.convert(bsl::back_inserter(expected),
+                                        IN,
+                                        IN + length);
+                        encoder.endConvert(bsl::back_inserter(expected));
+                    }
+
+                    char  output[2 * k_MAX_LENGTH + k_MAX_OFFSET + 1];
+                    char *OUT = output + (k_MAX_OFFSET - offset);
+                    memset(output, '?', sizeof output);
+
+                    const bsl::size_t numOut = Obj::encode(OUT,
+                                                           IN,
+                                                           length,
+                                                           upper);
+
+                    ASSERTV(length, offset, upper, numOut,
+                            2 * static_cast<bsl::size_t>(length) == numOut);
+                    ASSERTV(length, offset, upper,
+                            0 == bsl::memcmp(expected.data(), OUT, numOut));
+                    ASSERTV(length, offset, upper, '?' == OUT[numOut]);
+
+                    if (upper) {
+                        memset(output, '?', sizeof output);
+                        Obj::encode(OUT, IN, length);
+                        ASSERTV(length, offset,
+                                0 == bsl::memcmp(expected.data(),
+                                                 OUT,
+                                                 numOut));
+                    }
+                }
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING 'reset'
@@ -10,6 +10,21 @@ BSLS_IDENT_RCSID(bdlde_sha1_cpp,"$Id$ $CSID$")
 #include <bsl_ostream.h>
 #include <bsl_type_traits.h>
 #include <bslmf_assert.h>
+#include <bslmt_once.h>
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <immintrin.h>
+# define BDLDE_SHA1_SIMD_ENABLED
+# define BDLDE_SHA1_TARGET(ISA) __attribute__((target(ISA)))
+    // The SHA extensions (SHA-NI) implementation of the SHA-1 compression
+    // function is compiled for that instruction set by means of the 'target'
+    // attribute, and is selected at run time if the processor supports it.
+#endif
 
 namespace BloombergLP {
 namespace bdlde {
@@ -146,12 +161,12 @@ void toHex(char *output, const unsigned char (&input)[Sha1::k_DIGEST_SIZE])
     }
 }
 
-void transform(Sha1State           *state,
-               const unsigned char *message,
-               bsl::uint64_t        numMessageBlocks)
+void transformSoftware(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
     // Update the specified 'state' with the hashed contents of the specified
     // 'message' having a length equal to the specified 'numMessageBlocks'
-    // times 'k_SHA1_BLOCK_SIZE'.
+    // times 'k_SHA1_BLOCK_SIZE', using the portable implementation.
 {
     const unsigned char *messageEnd =
         message + k_SHA1_BLOCK_SIZE * numMessageBlocks;
@@ -191,6 +206,162 @@ void transform(Sha1State           *state,
     }
 }
 
+#if defined(BDLDE_SHA1_SIMD_ENABLED)
+
+template <int FUNCTION>
+inline BDLDE_SHA1_TARGET("sha,sse4.1")
+void sha1Rounds(__m128i *abcd, __m128i *e, __m128i words)
+    // Perform on the specified 'abcd' four rounds of SHA-1 using the mixing
+    // function having the specified 'FUNCTION' index (0 for rounds 0 to 19, 1
+    // for rounds 20 to 39, and so on) and the specified message schedule
+    // 'words', given the specified 'e' holding the value of 'abcd' before the
+    // previous four rounds, and load into 'e' the value of 'abcd' before
+    // these rounds.
+{
+    const __m128i previous = *abcd;
+    *abcd = _mm_sha1rnds4_epu32(*abcd,
+                                _mm_sha1nexte_epu32(*e, words),
+                                FUNCTION);
+    *e    = previous;
+}
+
+inline BDLDE_SHA1_TARGET("sha,sse4.1")
+__m128i sha1Schedule(__m128i w16, __m128i w12, __m128i w8, __m128i w4)
+    // Return the next four words of the SHA-1 message schedule, given the
+    // specified 'w16', 'w12', 'w8', and 'w4' holding the words 16, 12, 8, and
+    // 4 positions before them, respectively.
+{
+    return _mm_sha1msg2_epu32(
+                 _mm_xor_si128(_mm_sha1msg1_epu32(w16, w12), w8), w4);
+}
+
+BDLDE_SHA1_TARGET("sha,sse4.1")
+void transformShaNi(Sha1State           *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numMessageBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'numMessageBlocks'
+    // times 'k_SHA1_BLOCK_SIZE', using the SHA extensions.  The behavior is
+    // undefined unless the processor supports the SHA extensions and SSE4.1.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL,
+                                            0x08090a0b0c0d0e0fULL);
+
+    // The SHA-1 instructions operate on 'A', 'B', 'C', and 'D' in reverse
+    // order, and on 'E' in the most significant word of a separate register.
+
+    __m128i abcd = _mm_shuffle_epi32(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(*state)),
+                   0x1B);
+    __m128i e0   = _mm_set_epi32(static_cast<int>((*state)[4]), 0, 0, 0);
+
+    for (; numMessageBlocks; --numMessageBlocks, message += k_SHA1_BLOCK_SIZE)
+    {
+        const __m128i savedAbcd = abcd;
+        const __m128i savedE    = e0;
+
+        const __m128i *words = reinterpret_cast<const __m128i *>(message);
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(words + 0), byteSwap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(words + 1), byteSwap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(words + 2), byteSwap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(words + 3), byteSwap);
+
+        // Rounds 0 to 3 add 'E' to the first words directly; every later
+        // group of four rounds derives it from 'A' four rounds before.
+
+        __m128i e = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, _mm_add_epi32(e0, w0), 0);
+
+        sha1Rounds<0>(&abcd, &e, w1);
+        sha1Rounds<0>(&abcd, &e, w2);
+        sha1Rounds<0>(&abcd, &e, w3);
+        w0 = sha1Schedule(w0, w1, w2, w3);  sha1Rounds<0>(&abcd, &e, w0);
+
+        w1 = sha1Schedule(w1, w2, w3, w0);  sha1Rounds<1>(&abcd, &e, w1);
+        w2 = sha1Schedule(w2, w3, w0, w1);  sha1Rounds<1>(&abcd, &e, w2);
+        w3 = sha1Schedule(w3, w0, w1, w2);  sha1Rounds<1>(&abcd, &e, w3);
+        w0 = sha1Schedule(w0, w1, w2, w3);  sha1Rounds<1>(&abcd, &e, w0);
+        w1 = sha1Schedule(w1, w2, w3, w0);  sha1Rounds<1>(&abcd, &e, w1);
+
+        w2 = sha1Schedule(w2, w3, w0, w1);  sha1Rounds<2>(&abcd, &e, w2);
+        w3 = sha1Schedule(w3, w0, w1, w2);  sha1Rounds<2>(&abcd, &e, w3);
+        w0 = sha1Schedule(w0, w1, w2, w3);  sha1Rounds<2>(&abcd, &e, w0);
+        w1 = sha1Schedule(w1, w2, w3, w0);  sha1Rounds<2>(&abcd, &e, w1);
+        w2 = sha1Schedule(w2, w3, w0, w1);  sha1Rounds<2>(&abcd, &e, w2);
+
+        w3 = sha1Schedule(w3, w0, w1, w2);  sha1Rounds<3>(&abcd, &e, w3);
+        w0 = sha1Schedule(w0, w1, w2, w3);  sha1Rounds<3>(&abcd, &e, w0);
+        w1 = sha1Schedule(w1, w2, w3, w0);  sha1Rounds<3>(&abcd, &e, w1);
+        w2 = sha1Schedule(w2, w3, w0, w1);  sha1Rounds<3>(&abcd, &e, w2);
+        w3 = sha1Schedule(w3, w0, w1, w2);  sha1Rounds<3>(&abcd, &e, w3);
+
+        e0   = _mm_sha1nexte_epu32(e, savedE);
+        abcd = _mm_add_epi32(abcd, savedAbcd);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(*state),
+                     _mm_shuffle_epi32(abcd, 0x1B));
+    (*state)[4] = static_cast<Sha1Word>(_mm_extract_epi32(e0, 3));
+}
+
+bool cpuSupportsShaExtensions()
+    // Return 'true' if the processor supports both the SHA extensions and
+    // SSE4.1, and 'false' otherwise.  Note that the processor is queried with
+    // 'cpuid' directly, as '__builtin_cpu_supports' does not accept "sha"
+    // before GCC 11 and clang 16.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (0 == (ecx & (1u << 19))) {  // SSE4.1: leaf 1, ECX bit 19
+        return false;                                                 // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & (1u << 29));  // SHA: leaf 7, EBX bit 29
+}
+
+#endif  // BDLDE_SHA1_SIMD_ENABLED
+
+typedef void (*TransformFunction)(Sha1State           *state,
+                                  const unsigned char *message,
+                                  bsl::uint64_t        numMessageBlocks);
+    // Alias for an implementation of the SHA-1 compression function.
+
+TransformFunction selectTransformFunction()
+    // Return the fastest implementation of the SHA-1 compression function
+    // supported by the processor.
+{
+#if defined(BDLDE_SHA1_SIMD_ENABLED)
+    if (cpuSupportsShaExtensions()) {
+        return &transformShaNi;                                       // RETURN
+    }
+#endif
+    return &transformSoftware;
+}
+
+void transform(Sha1State           *state,
+               const unsigned char *message,
+               bsl::uint64_t        numMessageBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'numMessageBlocks'
+    // times 'k_SHA1_BLOCK_SIZE', using the fastest implementation supported
+    // by the processor.
+{
+    static TransformFunction s_transform = 0;
+
+    BSLMT_ONCE_DO {
+        s_transform = selectTransformFunction();
+    }
+
+    s_transform(state, message, numMessageBlocks);
+}
+
 void updateImpl(Sha1State           *state,
                 bsl::uint64_t       *totalSize,
                 bsl::uint64_t       *bufferSize,
@@ -41,6 +41,13 @@ BSLS_IDENT("$Id$ $CSID$")
 // considerations, and the availability of SHA-2 and SHA-3 as alternatives,
 // there is no justification for using SHA-1 unless you absolutely have to.
 //
+///Hardware Acceleration
+///---------------------
+// On x86-64 processors supporting the SHA extensions (SHA-NI), 'bdlde::Sha1'
+// uses those instructions to compute the SHA-1 compression function.  The
+// implementation is selected at run time, and yields the same digests as the
+// portable implementation used otherwise.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.  The
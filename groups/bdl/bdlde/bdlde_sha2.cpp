@@ -1,10 +1,30 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <immintrin.h>
+# define BDLDE_SHA2_SIMD_ENABLED
+# define BDLDE_SHA2_TARGET(ISA) __attribute__((target(ISA)))
+    // The SHA extensions (SHA-NI) and AVX2 implementations of the SHA-256
+    // compression function are compiled for their instruction set by means of
+    // the 'target' attribute, and are selected at run time according to the
+    // capabilities of the processor.
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -197,11 +217,11 @@ const bsl::uint64_t sha512Constants[80] =
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void transformSoftware(INTEGER             *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers,
+                       bsl::uint64_t        bufferSize,
+                       const INTEGER      (&constants)[ARRAY_SIZE])
     // Update the specified 'state' with the hashed contents of the specified
     // 'message' having a length equal to the specified 'bufferSize' times the
     // specified 'numberOfBuffers', mixing it with the values in the specified
@@ -247,6 +267,201 @@ void transform(INTEGER             *state,
     }
 }
 
+                        // ----------------------------
+                        // SHA-256 compression backends
+                        // ----------------------------
+
+typedef void (*Sha256TransformFunction)(bsl::uint32_t       *state,
+                                        const unsigned char *message,
+                                        bsl::uint64_t        numberOfBlocks);
+    // Alias for a function that updates the specified 'state' with the
+    // hashed contents of the specified 'message' having a length of the
+    // specified 'numberOfBlocks' times 64 bytes.
+
+const bsl::size_t k_SHA256_BLOCK_SIZE = 512 / 8;
+    // Size (in bytes) of the blocks into which messages are divided by
+    // SHA-224 and SHA-256.
+
+void transformSha256Software(bsl::uint32_t       *state,
+                             const unsigned char *message,
+                             bsl::uint64_t        numberOfBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length of the specified 'numberOfBlocks' times 64
+    // bytes, using the portable implementation.
+{
+    transformSoftware(state,
+                      message,
+                      numberOfBlocks,
+                      k_SHA256_BLOCK_SIZE,
+                      sha256Constants);
+}
+
+#if defined(BDLDE_SHA2_SIMD_ENABLED)
+
+inline BDLDE_SHA2_TARGET("sha,sse4.1")
+void sha256Rounds(__m128i       *state0,
+                  __m128i       *state1,
+                  __m128i        words,
+                  bsl::size_t    index)
+    // Perform on the specified 'state0' (holding the working variables 'A',
+    // 'B', 'E', and 'F') and 'state1' (holding 'C', 'D', 'G', and 'H') the
+    // four rounds of SHA-256 starting at the specified 'index', using the
+    // specified message schedule 'words'.
+{
+    __m128i message = _mm_add_epi32(
+               words,
+               _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                  sha256Constants + index)));
+    *state1 = _mm_sha256rnds2_epu32(*state1, *state0, message);
+    message = _mm_shuffle_epi32(message, 0x0E);
+    *state0 = _mm_sha256rnds2_epu32(*state0, *state1, message);
+}
+
+inline BDLDE_SHA2_TARGET("sha,sse4.1")
+__m128i sha256Schedule(__m128i w16, __m128i w12, __m128i w8, __m128i w4)
+    // Return the next four words of the SHA-256 message schedule, given the
+    // specified 'w16', 'w12', 'w8', and 'w4' holding the words 16, 12, 8, and
+    // 4 positions before them, respectively.
+{
+    const __m128i words = _mm_add_epi32(_mm_sha256msg1_epu32(w16, w12),
+                                        _mm_alignr_epi8(w4, w8, 4));
+    return _mm_sha256msg2_epu32(words, w4);
+}
+
+BDLDE_SHA2_TARGET("sha,sse4.1")
+void transformSha256Ni(bsl::uint32_t       *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length of the specified 'numberOfBlocks' times 64
+    // bytes, using the SHA extensions.  The behavior is undefined unless the
+    // processor supports the SHA extensions and SSE4.1.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    // The SHA-256 instructions operate on the working variables arranged as
+    // 'ABEF' and 'CDGH'.
+
+    __m128i abcd   = _mm_loadu_si128(reinterpret_cast<__m128i *>(state));
+    __m128i efgh   = _mm_loadu_si128(reinterpret_cast<__m128i *>(state + 4));
+
+    abcd = _mm_shuffle_epi32(abcd, 0xB1);                       // CDAB
+    efgh = _mm_shuffle_epi32(efgh, 0x1B);                       // EFGH
+
+    __m128i state0 = _mm_alignr_epi8(abcd, efgh, 8);            // ABEF
+    __m128i state1 = _mm_blend_epi16(efgh, abcd, 0xF0);         // CDGH
+
+    for (; numberOfBlocks; --numberOfBlocks, message += k_SHA256_BLOCK_SIZE) {
+        const __m128i saved0 = state0;
+        const __m128i saved1 = state1;
+
+        const __m128i *words = reinterpret_cast<const __m128i *>(message);
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(words + 0), byteSwap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(words + 1), byteSwap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(words + 2), byteSwap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(words + 3), byteSwap);
+
+        sha256Rounds(&state0, &state1, w0,  0);
+        sha256Rounds(&state0, &state1, w1,  4);
+        sha256Rounds(&state0, &state1, w2,  8);
+        sha256Rounds(&state0, &state1, w3, 12);
+
+        for (bsl::size_t index = 16; index < 64; index += 16) {
+            w0 = sha256Schedule(w0, w1, w2, w3);
+            sha256Rounds(&state0, &state1, w0, index);
+            w1 = sha256Schedule(w1, w2, w3, w0);
+            sha256Rounds(&state0, &state1, w1, index + 4);
+            w2 = sha256Schedule(w2, w3, w0, w1);
+            sha256Rounds(&state0, &state1, w2, index + 8);
+            w3 = sha256Schedule(w3, w0, w1, w2);
+            sha256Rounds(&state0, &state1, w3, index + 12);
+        }
+
+        state0 = _mm_add_epi32(state0, saved0);
+        state1 = _mm_add_epi32(state1, saved1);
+    }
+
+    abcd = _mm_shuffle_epi32(state0, 0x1B);                     // FEBA
+    efgh = _mm_shuffle_epi32(state1, 0xB1);                     // DCHG
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(abcd, efgh, 0xF0));        // DCBA
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(efgh, abcd, 8));           // HGFE
+}
+
+bool cpuSupportsShaExtensions()
+    // Return 'true' if the processor supports both the SHA extensions and
+    // SSE4.1, and 'false' otherwise.  Note that older compilers (GCC before
+    // 11, clang before 16) reject '__builtin_cpu_supports("sha")'.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (0 == (ecx & (1u << 19))) {  // SSE4.1: leaf 1, ECX bit 19
+        return false;                                                 // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & (1u << 29));  // SHA: leaf 7, EBX bit 29
+}
+
+#endif  // BDLDE_SHA2_SIMD_ENABLED
+
+Sha256TransformFunction selectSha256TransformFunction()
+    // Return the fastest implementation of the SHA-256 compression function
+    // supported by the processor.
+{
+#if defined(BDLDE_SHA2_SIMD_ENABLED)
+    if (cpuSupportsShaExtensions()) {
+        return &transformSha256Ni;                                    // RETURN
+    }
+#endif
+    return &transformSha256Software;
+}
+
+void transform(bsl::uint32_t       *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const bsl::uint32_t (&)[64])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', using the fastest implementation of the
+    // SHA-256 compression function supported by the processor.  The behavior
+    // is undefined unless 'bufferSize' is 64.
+{
+    BSLS_ASSERT_SAFE(k_SHA256_BLOCK_SIZE == bufferSize);
+    (void)bufferSize;
+
+    static Sha256TransformFunction s_transform = 0;
+
+    BSLMT_ONCE_DO {
+        s_transform = selectSha256TransformFunction();
+    }
+
+    s_transform(state, message, numberOfBuffers);
+}
+
+void transform(bsl::uint64_t       *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const bsl::uint64_t (&constants)[80])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants'.
+{
+    transformSoftware(state, message, numberOfBuffers, bufferSize, constants);
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -344,6 +559,345 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
     }
 }
 
+
+                        // ---------------------------
+                        // SHA-256 multi-buffer hashing
+                        // ---------------------------
+
+const bsl::uint32_t k_SHA256_INITIAL_STATE[8] = {
+    // First 32 bits of the fractional part of the square root of the first 8
+    // primes.
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+class Sha256Lane {
+    // This class provides the sequence of (padded) blocks of one message being
+    // hashed by 'Sha256::loadMultipleDigests'.
+
+    // DATA
+    const unsigned char *d_data_p;          // next block of the message
+    bsl::uint64_t        d_numFullBlocks;   // remaining blocks at 'd_data_p'
+    bsl::uint64_t        d_numTailBlocks;   // remaining blocks in 'd_tail'
+    bsl::uint64_t        d_tailIndex;       // next block in 'd_tail'
+    unsigned char        d_tail[2 * k_SHA256_BLOCK_SIZE];
+                                            // last bytes of the message,
+                                            // followed by the padding
+
+  public:
+    // MANIPULATORS
+    void reset(const unsigned char *data, bsl::size_t length)
+        // Prepare this object to provide the padded blocks of the specified
+        // 'data' having the specified 'length'.
+    {
+        const bsl::size_t numTailBytes = length % k_SHA256_BLOCK_SIZE;
+
+        d_data_p        = data;
+        d_numFullBlocks = length / k_SHA256_BLOCK_SIZE;
+        d_numTailBlocks = numTailBytes + 1 + sizeof(bsl::uint64_t)
+                                                       <= k_SHA256_BLOCK_SIZE
+                        ? 1
+                        : 2;
+        d_tailIndex     = 0;
+
+        bsl::memset(d_tail, 0, sizeof d_tail);
+        if (numTailBytes) {
+            bsl::memcpy(d_tail,
+                        data + d_numFullBlocks * k_SHA256_BLOCK_SIZE,
+                        numTailBytes);
+        }
+        d_tail[numTailBytes] = 1 << 7;
+        unpack(static_cast<bsl::uint64_t>(length) * 8,
+               d_tail + d_numTailBlocks * k_SHA256_BLOCK_SIZE
+                                                    - sizeof(bsl::uint64_t));
+    }
+
+    const unsigned char *nextBlock()
+        // Return the address of the next block of the message, or 0 if all
+        // of its blocks have been returned.
+    {
+        if (d_numFullBlocks) {
+            const unsigned char *block = d_data_p;
+            d_data_p += k_SHA256_BLOCK_SIZE;
+            --d_numFullBlocks;
+            return block;                                             // RETURN
+        }
+        if (d_tailIndex < d_numTailBlocks) {
+            return d_tail + k_SHA256_BLOCK_SIZE * d_tailIndex++;      // RETURN
+        }
+        return 0;
+    }
+
+    // ACCESSORS
+    bool isDone() const
+        // Return 'true' if all of the blocks of the message have been
+        // returned by 'nextBlock', and 'false' otherwise.
+    {
+        return 0 == d_numFullBlocks && d_tailIndex == d_numTailBlocks;
+    }
+};
+
+#if defined(BDLDE_SHA2_SIMD_ENABLED)
+
+const int k_SHA256_NUM_LANES = 8;
+    // Number of messages hashed concurrently by 'transformSha256Avx2'.
+
+inline BDLDE_SHA2_TARGET("avx2")
+__m256i rotateRight8x32(__m256i value, int shift)
+    // Return the specified 'value' with each of its 32-bit lanes rotated to
+    // the right by the specified 'shift' bits.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+inline BDLDE_SHA2_TARGET("avx2")
+void loadWords8x8(__m256i *words, const unsigned char *const *blocks, int at)
+    // Load into the specified 'words' the 8 big-endian words at the specified
+    // 'at' byte offset of each of the 8 specified 'blocks', such that lane 'l'
+    // of 'words[t]' is word 't' of 'blocks[l]'.
+{
+    const __m256i byteSwap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                               0x0405060700010203ULL,
+                                               0x0c0d0e0f08090a0bULL,
+                                               0x0405060700010203ULL);
+    __m256i r[8];
+    for (int lane = 0; lane < 8; ++lane) {
+        const __m256i *row = reinterpret_cast<const __m256i *>(blocks[lane]
+                                                               + at);
+        r[lane] = _mm256_shuffle_epi8(_mm256_loadu_si256(row), byteSwap);
+    }
+
+    // Transpose the 8x8 matrix of words.
+
+    const __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    words[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    words[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    words[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    words[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    words[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    words[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    words[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    words[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+BDLDE_SHA2_TARGET("avx2")
+void transformSha256Avx2(bsl::uint32_t              (*state)[8],
+                         const unsigned char *const  *blocks)
+    // Update each lane 'l' of the specified 'state', holding 8 SHA-256 states
+    // such that 'state[i][l]' is word 'i' of the state of lane 'l', with the
+    // hashed contents of the 64-byte block at the specified 'blocks[l]'.  The
+    // behavior is undefined unless the processor supports AVX2.
+{
+    __m256i w[16];
+    loadWords8x8(w,     blocks,  0);
+    loadWords8x8(w + 8, blocks, 32);
+
+    __m256i v[8];
+    for (int index = 0; index < 8; ++index) {
+        v[index] = _mm256_loadu_si256(
+                              reinterpret_cast<const __m256i *>(state[index]));
+    }
+
+    __m256i a = v[0], b = v[1], c = v[2], d = v[3];
+    __m256i e = v[4], f = v[5], g = v[6], h = v[7];
+
+    for (int index = 0; index < 64; ++index) {
+        if (16 <= index) {
+            const __m256i w2  = w[(index -  2) & 15];
+            const __m256i w15 = w[(index - 15) & 15];
+
+            const __m256i s0 = _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8x32(w15,  7),
+                                                  rotateRight8x32(w15, 18)),
+                                 _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8x32(w2, 17),
+                                                  rotateRight8x32(w2, 19)),
+                                 _mm256_srli_epi32(w2, 10));
+
+            w[index & 15] = _mm256_add_epi32(
+                               _mm256_add_epi32(w[index & 15], s0),
+                               _mm256_add_epi32(w[(index - 7) & 15], s1));
+        }
+
+        const __m256i sigma1 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRight8x32(e,  6),
+                                                    rotateRight8x32(e, 11)),
+                                   rotateRight8x32(e, 25));
+        const __m256i choice = _mm256_xor_si256(
+                            _mm256_and_si256(e, _mm256_xor_si256(f, g)), g);
+        const __m256i t1 = _mm256_add_epi32(
+                  _mm256_add_epi32(_mm256_add_epi32(h, sigma1),
+                                   _mm256_add_epi32(choice, w[index & 15])),
+                  _mm256_set1_epi32(static_cast<int>(sha256Constants[index])));
+
+        const __m256i sigma0 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRight8x32(a,  2),
+                                                    rotateRight8x32(a, 13)),
+                                   rotateRight8x32(a, 22));
+        const __m256i majority = _mm256_or_si256(
+                            _mm256_and_si256(a, b),
+                            _mm256_and_si256(_mm256_or_si256(a, b), c));
+        const __m256i t2 = _mm256_add_epi32(sigma0, majority);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    v[0] = _mm256_add_epi32(v[0], a);
+    v[1] = _mm256_add_epi32(v[1], b);
+    v[2] = _mm256_add_epi32(v[2], c);
+    v[3] = _mm256_add_epi32(v[3], d);
+    v[4] = _mm256_add_epi32(v[4], e);
+    v[5] = _mm256_add_epi32(v[5], f);
+    v[6] = _mm256_add_epi32(v[6], g);
+    v[7] = _mm256_add_epi32(v[7], h);
+
+    for (int index = 0; index < 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            v[index]);
+    }
+}
+
+void loadMultipleSha256DigestsAvx2(unsigned char      *results,
+                                   const void * const *data,
+                                   const bsl::size_t  *lengths,
+                                   bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' messages described by the specified 'data' and 'lengths',
+    // as specified by 'Sha256::loadMultipleDigests', hashing up to 8 messages
+    // concurrently.  The behavior is undefined unless the processor supports
+    // AVX2.
+{
+    static const unsigned char k_IDLE_BLOCK[k_SHA256_BLOCK_SIZE] = {};
+
+    bsl::uint32_t        state[8][k_SHA256_NUM_LANES];
+    Sha256Lane           lanes[k_SHA256_NUM_LANES];
+    bsl::size_t          messageIndex[k_SHA256_NUM_LANES];
+    const unsigned char *blocks[k_SHA256_NUM_LANES];
+
+    bsl::size_t nextMessage = 0;
+    int         numActive   = 0;
+
+    // Each lane hashes one message at a time; once the last block of a message
+    // has been processed its digest is stored and the lane is given the next
+    // message, so that messages of different lengths keep all lanes busy.
+
+    for (int lane = 0; lane < k_SHA256_NUM_LANES; ++lane) {
+        messageIndex[lane] = numMessages;
+        if (nextMessage < numMessages) {
+            messageIndex[lane] = nextMessage;
+            lanes[lane].reset(
+                 static_cast<const unsigned char *>(data[nextMessage]),
+                 lengths[nextMessage]);
+            ++nextMessage;
+            ++numActive;
+        }
+        for (int word = 0; word < 8; ++word) {
+            state[word][lane] = k_SHA256_INITIAL_STATE[word];
+        }
+    }
+
+    while (numActive) {
+        for (int lane = 0; lane < k_SHA256_NUM_LANES; ++lane) {
+            blocks[lane] = messageIndex[lane] < numMessages
+                         ? lanes[lane].nextBlock()
+                         : k_IDLE_BLOCK;
+        }
+
+        transformSha256Avx2(state, blocks);
+
+        for (int lane = 0; lane < k_SHA256_NUM_LANES; ++lane) {
+            if (messageIndex[lane] == numMessages || !lanes[lane].isDone()) {
+                continue;
+            }
+
+            unsigned char *result = results
+                                  + messageIndex[lane] * Sha256::k_DIGEST_SIZE;
+            for (int word = 0; word < 8; ++word) {
+                unpack(state[word][lane], result + word * 4);
+                state[word][lane] = k_SHA256_INITIAL_STATE[word];
+            }
+
+            if (nextMessage < numMessages) {
+                messageIndex[lane] = nextMessage;
+                lanes[lane].reset(
+                     static_cast<const unsigned char *>(data[nextMessage]),
+                     lengths[nextMessage]);
+                ++nextMessage;
+            }
+            else {
+                messageIndex[lane] = numMessages;
+                --numActive;
+            }
+        }
+    }
+}
+
+#endif  // BDLDE_SHA2_SIMD_ENABLED
+
+void loadMultipleSha256DigestsSerial(unsigned char      *results,
+                                     const void * const *data,
+                                     const bsl::size_t  *lengths,
+                                     bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' messages described by the specified 'data' and 'lengths',
+    // as specified by 'Sha256::loadMultipleDigests', hashing one message at a
+    // time.
+{
+    for (bsl::size_t index = 0; index < numMessages; ++index) {
+        const Sha256 digest(data[index], lengths[index]);
+        digest.loadDigest(results + index * Sha256::k_DIGEST_SIZE);
+    }
+}
+
+typedef void (*LoadMultipleDigestsFunction)(unsigned char      *results,
+                                            const void * const *data,
+                                            const bsl::size_t  *lengths,
+                                            bsl::size_t         numMessages);
+    // Alias for an implementation of 'Sha256::loadMultipleDigests'.
+
+LoadMultipleDigestsFunction selectLoadMultipleDigestsFunction()
+    // Return the fastest implementation of 'Sha256::loadMultipleDigests'
+    // supported by the processor.
+{
+#if defined(BDLDE_SHA2_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (cpuSupportsShaExtensions()) {
+        return &loadMultipleSha256DigestsSerial;                      // RETURN
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return &loadMultipleSha256DigestsAvx2;                        // RETURN
+    }
+#endif
+    return &loadMultipleSha256DigestsSerial;
+}
+
 } // close unnamed namespace
 
 Sha224::Sha224()
@@ -357,6 +911,26 @@ Sha224::Sha224(const void *data, bsl::size_t length)
     update(data, length);
 }
 
+// CLASS METHODS
+void Sha256::loadMultipleDigests(unsigned char      *results,
+                                 const void * const *data,
+                                 const bsl::size_t  *lengths,
+                                 bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results || 0 == numMessages);
+    BSLS_ASSERT(data    || 0 == numMessages);
+    BSLS_ASSERT(lengths || 0 == numMessages);
+
+    static LoadMultipleDigestsFunction s_loadMultipleDigests = 0;
+
+    BSLMT_ONCE_DO {
+        s_loadMultipleDigests = selectLoadMultipleDigestsFunction();
+    }
+
+    s_loadMultipleDigests(results, data, lengths, numMessages);
+}
+
+// CREATORS
 Sha256::Sha256()
 {
     reset();
@@ -25,6 +25,21 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Hardware Acceleration
+///---------------------
+// On x86-64 processors supporting the SHA extensions (SHA-NI), 'Sha224' and
+// 'Sha256' use those instructions to compute the SHA-256 compression
+// function, which is several times faster than the portable implementation
+// used otherwise.  The implementation is selected at run time, and yields the
+// same digests.
+//
+// 'Sha256::loadMultipleDigests' computes the digests of a sequence of
+// independent messages.  On processors supporting AVX2 but not the SHA
+// extensions, it hashes eight messages at a time, one in each 32-bit lane of
+// the vector registers, which improves the throughput of workloads hashing
+// many short messages.  On processors supporting the SHA extensions, hashing
+// the messages one at a time is faster, and is used instead.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -201,6 +216,23 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadMultipleDigests(unsigned char      *results,
+                                    const void * const *data,
+                                    const bsl::size_t  *lengths,
+                                    bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' independent messages, where message 'i'
+        // comprises the specified 'lengths[i]' bytes at the specified
+        // 'data[i]' and its digest is loaded into the 'k_DIGEST_SIZE' bytes at
+        // 'results + i * k_DIGEST_SIZE'.  The behavior is undefined unless
+        // 'results' has room for 'numMessages * k_DIGEST_SIZE' bytes, and
+        // '[data[i], data[i] + lengths[i])' is a valid range for each 'i' in
+        // '[0, numMessages)'.  Note that the digest of each message is the
+        // same as that loaded by 'Sha256(data[i], lengths[i]).loadDigest()';
+        // also note that several messages may be hashed concurrently (see
+        // {Hardware Acceleration}).
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
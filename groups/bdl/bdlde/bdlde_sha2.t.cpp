@@ -86,6 +86,9 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] Sha256::loadMultipleDigests(uchar*, const void**, size_t*, size_t)
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +138,7 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -509,7 +512,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +534,105 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha256::loadMultipleDigests'
+        //
+        // Concerns:
+        //: 1 The digest loaded for each message is the same as that computed
+        //:   by a 'Sha256' object for that message alone.
+        //:
+        //: 2 Messages of any length, including 0 and lengths at and around
+        //:   the block size and the padding boundary, are hashed correctly,
+        //:   in any number, including fewer and more than can be hashed
+        //:   concurrently.
+        //:
+        //: 3 Messages of different lengths may be passed together, and the
+        //:   same data may be passed for several messages.
+        //:
+        //: 4 No bytes outside of the digests of the messages are written.
+        //
+        // Plan:
+        //: 1 Compare the digest of a message having a known hash.  (C-1)
+        //:
+        //: 2 For every number of messages up to 20, hash messages of lengths
+        //:   drawn from a table of lengths, at offsets in a common buffer,
+        //:   into a buffer having a guard byte after the digests, and compare
+        //:   each digest to that loaded by a 'Sha256' object.  (C-1..4)
+        //
+        // Testing:
+        //   Sha256::loadMultipleDigests(uchar*, const void**, size_t*, size_t)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha256::loadMultipleDigests'" "\n"
+                          << "=====================================" "\n";
+
+        typedef bdlde::Sha256 Obj;
+
+        {
+            const unsigned char EXPECTED[Obj::k_DIGEST_SIZE] = {
+                0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41,
+                0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23, 0xB0, 0x03, 0x61, 0xA3,
+                0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00,
+                0x15, 0xAD
+            };
+
+            const void        *data   = "abc";
+            const bsl::size_t  length = 3;
+            unsigned char      digest[Obj::k_DIGEST_SIZE];
+
+            Obj::loadMultipleDigests(digest, &data, &length, 1);
+
+            ASSERT(bsl::equal(digest, digest + Obj::k_DIGEST_SIZE, EXPECTED));
+        }
+
+        const bsl::size_t LENGTHS[] = { 0, 1, 3, 55, 56, 57, 63, 64, 65,
+                                        119, 120, 128, 200, 1000, 4097 };
+        const bsl::size_t NUM_LENGTHS = arraySize(LENGTHS);
+
+        bsl::string buffer;
+        while (buffer.size() < 5000) {
+            buffer += allCharacters();
+        }
+
+        for (bsl::size_t numMessages = 0; numMessages <= 20; ++numMessages) {
+            if (verbose) { T_ P(numMessages) }
+
+            bsl::vector<const void *> data(numMessages);
+            bsl::vector<bsl::size_t>  lengths(numMessages);
+
+            for (bsl::size_t i = 0; i < numMessages; ++i) {
+                lengths[i] = LENGTHS[(i * 7 + numMessages) % NUM_LENGTHS];
+                data[i]    = buffer.data() + (i * 13) % 500;
+            }
+
+            const unsigned char k_GUARD = 0xA5;
+
+            bsl::vector<unsigned char> results(
+                                        numMessages * Obj::k_DIGEST_SIZE + 1,
+                                        k_GUARD);
+
+            Obj::loadMultipleDigests(results.data(),
+                                     data.data(),
+                                     lengths.data(),
+                                     numMessages);
+
+            for (bsl::size_t i = 0; i < numMessages; ++i) {
+                unsigned char expected[Obj::k_DIGEST_SIZE];
+                Obj(data[i], lengths[i]).loadDigest(expected);
+
+                const unsigned char *digest = results.data()
+                                            + i * Obj::k_DIGEST_SIZE;
+
+                ASSERTV(numMessages, i, lengths[i],
+                        bsl::equal(digest,
+                                   digest + Obj::k_DIGEST_SIZE,
+                                   expected));
+            }
+
+            ASSERTV(numMessages, k_GUARD == results.back());
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
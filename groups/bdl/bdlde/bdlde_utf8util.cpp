@@ -13,16 +13,31 @@
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
 #include <bsla_fallthrough.h>
+#include <bslmt_once.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900) || \
+     defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_UTF8UTIL_SIMD_ENABLED
+# define BDLDE_UTF8UTIL_TARGET(ISA) __attribute__((target(ISA)))
+    // The vectorized validators are compiled for their instruction set by
+    // means of the 'target' attribute, so that they are available regardless
+    // of the '-m' flags used to build this component, and are selected at run
+    // time according to the capabilities of the processor.
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -224,6 +239,450 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+// VECTORIZED PREFIX VALIDATION
+
+// The vectorized validators implement the "lookup" algorithm of Keiser and
+// Lemire ("Validating UTF-8 In Less Than One Instruction Per Byte", Software:
+// Practice and Experience, 2021).  Every byte of a block is classified, by
+// three 16-entry table lookups indexed by the high and low nibbles of the
+// preceding byte and by the high nibble of the byte itself, into a set of
+// error bits that is non-zero only if the two-byte sequence ending at that
+// byte can not occur in valid UTF-8.  The requirement that the second and
+// third bytes following a 3-byte or 4-byte lead be continuation bytes is
+// checked separately.  Errors are flagged at the position of the byte
+// completing the offending sequence, so a block found free of errors may end
+// with the first bytes of a sequence that is verified (or found invalid) only
+// when the next block is processed.
+//
+// The validators do not locate errors.  They establish the longest prefix of
+// the input, ending on a code point boundary, that consists of whole blocks
+// found free of errors, and the scalar validators then carry on from the end
+// of that prefix.  Since a valid prefix does not alter how the scalar code
+// treats the remainder of the input, the position and nature of any error
+// reported are exactly those the scalar code alone would have reported.
+
+namespace {
+
+enum {
+    // Error bits produced by the table lookups of the vectorized validators.
+
+    e_TOO_SHORT      = 1 << 0,  // 11______ 0_______
+                                // 11______ 11______
+    e_TOO_LONG       = 1 << 1,  // 0_______ 10______
+    e_OVERLONG_3     = 1 << 2,  // 11100000 100_____
+    e_TOO_LARGE      = 1 << 3,  // 11110100 1001____
+                                // 11110100 101_____
+                                // 11110101 1001____
+                                // 11110101 101_____
+                                // 1111011_ 1001____
+                                // 1111011_ 101_____
+                                // 11111___ 1001____
+                                // 11111___ 101_____
+    e_SURROGATE      = 1 << 4,  // 11101101 101_____
+    e_OVERLONG_2     = 1 << 5,  // 1100000_ 10______
+    e_TOO_LARGE_1000 = 1 << 6,  // 11110101 1000____
+                                // 1111011_ 1000____
+                                // 11111___ 1000____
+    e_OVERLONG_4     = 1 << 6,  // 11110000 1000____
+    e_TWO_CONTS      = 1 << 7,  // 10______ 10______
+
+    e_CARRY          = e_TOO_SHORT | e_TOO_LONG | e_TWO_CONTS
+                                // errors not depending on the low nibble of
+                                // the first byte
+};
+
+const unsigned char k_BYTE_1_HIGH[16] = {
+    // Error bits indexed by the high nibble of the first of two bytes.
+
+    // 0_______ ________ (ASCII)
+
+    e_TOO_LONG, e_TOO_LONG, e_TOO_LONG, e_TOO_LONG,
+    e_TOO_LONG, e_TOO_LONG, e_TOO_LONG, e_TOO_LONG,
+
+    // 10______ ________ (continuation)
+
+    e_TWO_CONTS, e_TWO_CONTS, e_TWO_CONTS, e_TWO_CONTS,
+
+    // 1100____ ________ (2-byte lead)
+
+    e_TOO_SHORT | e_OVERLONG_2,
+
+    // 1101____ ________ (2-byte lead)
+
+    e_TOO_SHORT,
+
+    // 1110____ ________ (3-byte lead)
+
+    e_TOO_SHORT | e_OVERLONG_3 | e_SURROGATE,
+
+    // 1111____ ________ (4-byte lead or invalid)
+
+    e_TOO_SHORT | e_TOO_LARGE | e_TOO_LARGE_1000 | e_OVERLONG_4
+};
+
+const unsigned char k_BYTE_1_LOW[16] = {
+    // Error bits indexed by the low nibble of the first of two bytes.
+
+    e_CARRY | e_OVERLONG_3 | e_OVERLONG_2 | e_OVERLONG_4,     // ____0000
+    e_CARRY | e_OVERLONG_2,                                   // ____0001
+    e_CARRY,                                                  // ____0010
+    e_CARRY,                                                  // ____0011
+    e_CARRY | e_TOO_LARGE,                                    // ____0100
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____0101
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____0110
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____0111
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____1000
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____1001
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____1010
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____1011
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____1100
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000 | e_SURROGATE,   // ____1101
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,                 // ____1110
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000                  // ____1111
+};
+
+const unsigned char k_BYTE_2_HIGH[16] = {
+    // Error bits indexed by the high nibble of the second of two bytes.
+
+    // ________ 0_______ (ASCII)
+
+    e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT,
+    e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT,
+
+    // ________ 1000____
+
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_OVERLONG_3 | e_TOO_LARGE_1000
+                                                              | e_OVERLONG_4,
+
+    // ________ 1001____
+
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_OVERLONG_3 | e_TOO_LARGE,
+
+    // ________ 101_____
+
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_SURROGATE  | e_TOO_LARGE,
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_SURROGATE  | e_TOO_LARGE,
+
+    // ________ 11______ (lead)
+
+    e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT
+};
+
+typedef bsls::Types::size_type (*ValidPrefixFunction)(
+                                   bsls::Types::IntPtr    *numCodePoints,
+                                   const char             *string,
+                                   bsls::Types::size_type  length,
+                                   bsls::Types::IntPtr     maxCodePoints);
+    // 'ValidPrefixFunction' is an alias for the type of a function that
+    // returns the length of a prefix of the specified 'string' having the
+    // specified 'length' that is verified to consist of at most the specified
+    // 'maxCodePoints' complete, valid UTF-8 sequences, and loads the number of
+    // code points in that prefix into the specified 'numCodePoints'.
+
+}  // close unnamed namespace
+
+static
+bsls::Types::size_type completePrefix(bsls::Types::IntPtr    *numCodePoints,
+                                      bsls::Types::IntPtr     count,
+                                      const char             *string,
+                                      bsls::Types::size_type  length)
+    // Return the length of the longest prefix of the specified 'string' having
+    // the specified 'length' that ends on a code point boundary, and load into
+    // the specified 'numCodePoints' the specified 'count', the number of
+    // non-continuation bytes in 'string', less one if a sequence is cut short
+    // at the end of 'string'.  The behavior is undefined unless 'string' is
+    // valid UTF-8 except, possibly, for a single sequence that is not complete
+    // at the end of 'string'.
+{
+    bsls::Types::size_type end = length;
+
+    for (int back = 1; back <= 3 && bsls::Types::size_type(back) <= length;
+                                                                     ++back) {
+        const char octet = string[length - back];
+        if (isNotContinuation(octet)) {
+            if (utf8Size(octet) > back) {
+                end = length - back;
+                --count;
+            }
+            break;
+        }
+    }
+
+    *numCodePoints = count;
+    return end;
+}
+
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+
+static inline
+__m128i loadTable(const unsigned char *table)
+    // Return a vector holding the 16 bytes of the specified 'table'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+}
+
+BDLDE_UTF8UTIL_TARGET("sse4.1")
+static inline
+__m128i findErrorsSse41(__m128i input, __m128i prevInput)
+    // Return a vector that is non-zero if and only if the specified 'input'
+    // block, preceded by the specified 'prevInput' block, contains the end of
+    // an invalid UTF-8 sequence.
+{
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, prevInput, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, prevInput, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prevInput, 13);
+
+    const __m128i byte1High = _mm_shuffle_epi8(
+                         loadTable(k_BYTE_1_HIGH),
+                         _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+    const __m128i byte1Low  = _mm_shuffle_epi8(
+                                        loadTable(k_BYTE_1_LOW),
+                                        _mm_and_si128(prev1, nibbleMask));
+    const __m128i byte2High = _mm_shuffle_epi8(
+                         loadTable(k_BYTE_2_HIGH),
+                         _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low),
+                                          byte2High);
+
+    // Only a byte following a 3-byte lead by 2, or a 4-byte lead by 2 or 3,
+    // has its high bit set in 'must23'.
+
+    const __m128i must23 = _mm_or_si128(
+                                _mm_subs_epu8(prev2, _mm_set1_epi8(0x60)),
+                                _mm_subs_epu8(prev3, _mm_set1_epi8(0x70)));
+
+    return _mm_xor_si128(
+              _mm_and_si128(must23, _mm_set1_epi8(static_cast<char>(0x80))),
+              special);
+}
+
+BDLDE_UTF8UTIL_TARGET("sse4.1")
+static
+bsls::Types::size_type validPrefixSse41(
+                                      bsls::Types::IntPtr    *numCodePoints,
+                                      const char             *string,
+                                      bsls::Types::size_type  length,
+                                      bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of the longest prefix of the specified 'string'
+    // having the specified 'length' that is found, 16 bytes at a time, to
+    // consist of at most the specified 'maxCodePoints' complete, valid UTF-8
+    // sequences, and load the number of code points in that prefix into the
+    // specified 'numCodePoints'.
+{
+    enum { k_WIDTH = 16 };
+
+    const __m128i maxComplete = _mm_setr_epi8(
+                      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                      static_cast<char>(0xf0 - 1),
+                      static_cast<char>(0xe0 - 1),
+                      static_cast<char>(0xc0 - 1));
+    const __m128i maxContinuation = _mm_set1_epi8(static_cast<char>(0xbf));
+
+    __m128i                prevInput      = _mm_setzero_si128();
+    __m128i                prevIncomplete = _mm_setzero_si128();
+    bsls::Types::size_type pos            = 0;
+    bsls::Types::IntPtr    count          = 0;
+
+    while (length - pos >= k_WIDTH && maxCodePoints - count >= k_WIDTH) {
+        const __m128i input = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(string + pos));
+
+        __m128i errors;
+        int     blockCount;
+
+        if (0 == _mm_movemask_epi8(input)) {
+            // An ASCII block is valid unless it interrupts a sequence begun
+            // at the end of the previous block.
+
+            errors         = prevIncomplete;
+            prevIncomplete = _mm_setzero_si128();
+            blockCount     = k_WIDTH;
+        }
+        else {
+            errors         = findErrorsSse41(input, prevInput);
+            prevIncomplete = _mm_subs_epu8(input, maxComplete);
+            blockCount     = __builtin_popcount(_mm_movemask_epi8(
+                                 _mm_cmpgt_epi8(input, maxContinuation)));
+        }
+
+        if (!_mm_testz_si128(errors, errors)) {
+            break;
+        }
+
+        prevInput  = input;
+        pos       += k_WIDTH;
+        count     += blockCount;
+    }
+
+    return completePrefix(numCodePoints, count, string, pos);
+}
+
+BDLDE_UTF8UTIL_TARGET("avx2")
+static inline
+__m256i findErrorsAvx2(__m256i input, __m256i prevInput)
+    // Return a vector that is non-zero if and only if the specified 'input'
+    // block, preceded by the specified 'prevInput' block, contains the end of
+    // an invalid UTF-8 sequence.
+{
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+
+    // 'shifted' holds the last 16 bytes of 'prevInput' followed by the first
+    // 16 bytes of 'input', so that byte-wise alignment within each lane
+    // shifts bytes across the lane boundary.
+
+    const __m256i shifted = _mm256_permute2x128_si256(prevInput, input, 0x21);
+    const __m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i byte1High = _mm256_shuffle_epi8(
+                   _mm256_broadcastsi128_si256(loadTable(k_BYTE_1_HIGH)),
+                   _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibbleMask));
+    const __m256i byte1Low  = _mm256_shuffle_epi8(
+                   _mm256_broadcastsi128_si256(loadTable(k_BYTE_1_LOW)),
+                   _mm256_and_si256(prev1, nibbleMask));
+    const __m256i byte2High = _mm256_shuffle_epi8(
+                   _mm256_broadcastsi128_si256(loadTable(k_BYTE_2_HIGH)),
+                   _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask));
+
+    const __m256i special = _mm256_and_si256(
+                                     _mm256_and_si256(byte1High, byte1Low),
+                                     byte2High);
+
+    const __m256i must23 = _mm256_or_si256(
+                          _mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60)),
+                          _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70)));
+
+    return _mm256_xor_si256(
+        _mm256_and_si256(must23, _mm256_set1_epi8(static_cast<char>(0x80))),
+        special);
+}
+
+BDLDE_UTF8UTIL_TARGET("avx2")
+static
+bsls::Types::size_type validPrefixAvx2(bsls::Types::IntPtr    *numCodePoints,
+                                       const char             *string,
+                                       bsls::Types::size_type  length,
+                                       bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of the longest prefix of the specified 'string'
+    // having the specified 'length' that is found, 32 bytes at a time, to
+    // consist of at most the specified 'maxCodePoints' complete, valid UTF-8
+    // sequences, and load the number of code points in that prefix into the
+    // specified 'numCodePoints'.
+{
+    enum { k_WIDTH = 32 };
+
+    const __m256i maxComplete = _mm256_setr_epi8(
+                      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                      -1,
+                      static_cast<char>(0xf0 - 1),
+                      static_cast<char>(0xe0 - 1),
+                      static_cast<char>(0xc0 - 1));
+    const __m256i maxContinuation = _mm256_set1_epi8(
+                                                   static_cast<char>(0xbf));
+
+    __m256i                prevInput      = _mm256_setzero_si256();
+    __m256i                prevIncomplete = _mm256_setzero_si256();
+    bsls::Types::size_type pos            = 0;
+    bsls::Types::IntPtr    count          = 0;
+
+    while (length - pos >= k_WIDTH && maxCodePoints - count >= k_WIDTH) {
+        const __m256i input = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i *>(string + pos));
+
+        __m256i errors;
+        int     blockCount;
+
+        if (0 == _mm256_movemask_epi8(input)) {
+            errors         = prevIncomplete;
+            prevIncomplete = _mm256_setzero_si256();
+            blockCount     = k_WIDTH;
+        }
+        else {
+            errors         = findErrorsAvx2(input, prevInput);
+            prevIncomplete = _mm256_subs_epu8(input, maxComplete);
+            blockCount     = __builtin_popcount(_mm256_movemask_epi8(
+                              _mm256_cmpgt_epi8(input, maxContinuation)));
+        }
+
+        if (!_mm256_testz_si256(errors, errors)) {
+            break;
+        }
+
+        prevInput  = input;
+        pos       += k_WIDTH;
+        count     += blockCount;
+    }
+
+    return completePrefix(numCodePoints, count, string, pos);
+}
+
+#endif  // BDLDE_UTF8UTIL_SIMD_ENABLED
+
+static
+bsls::Types::size_type validPrefixNone(bsls::Types::IntPtr    *numCodePoints,
+                                       const char             *,
+                                       bsls::Types::size_type  ,
+                                       bsls::Types::IntPtr     )
+    // Load 0 into the specified 'numCodePoints' and return 0.  This function
+    // is used when no vectorized validator is supported by the processor.
+{
+    *numCodePoints = 0;
+    return 0;
+}
+
+static
+ValidPrefixFunction selectValidPrefixFunction()
+    // Return the fastest vectorized validator supported by the processor, or
+    // 'validPrefixNone' if there is none.
+{
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return validPrefixAvx2;                                       // RETURN
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return validPrefixSse41;                                      // RETURN
+    }
+#endif
+
+    return validPrefixNone;
+}
+
+static inline
+bsls::Types::size_type validPrefix(bsls::Types::IntPtr    *numCodePoints,
+                                   const char             *string,
+                                   bsls::Types::size_type  length,
+                                   bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of a prefix of the specified 'string' having the
+    // specified 'length' that is verified, by the fastest vectorized validator
+    // supported by the processor, to consist of at most the specified
+    // 'maxCodePoints' complete, valid UTF-8 sequences, and load the number of
+    // code points in that prefix into the specified 'numCodePoints'.  Note
+    // that the prefix may be empty even if 'string' is valid UTF-8, in
+    // particular if 'length' is too short for vectorization to pay off.
+{
+    enum { k_MIN_LENGTH = 32 };
+
+    static ValidPrefixFunction s_validPrefixFunction = 0;
+
+    if (length < k_MIN_LENGTH) {
+        *numCodePoints = 0;
+        return 0;                                                     // RETURN
+    }
+
+    BSLMT_ONCE_DO {
+        s_validPrefixFunction = selectValidPrefixFunction();
+    }
+
+    return s_validPrefixFunction(numCodePoints, string, length, maxCodePoints);
+}
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -243,6 +702,17 @@ int validateAndCountCodePoints(const char **invalidString, const char *string)
 
     int count = 0;
 
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+    {
+        bsls::Types::IntPtr prefixCount;
+        string += validPrefix(&prefixCount,
+                              string,
+                              bsl::strlen(string),
+                              INT_MAX);
+        count   = static_cast<int>(prefixCount);
+    }
+#endif
+
     while (true) {
         switch (static_cast<unsigned char>(*string) >> 4) {
           case 0: {
@@ -383,15 +853,26 @@ static int validateAndCountCodePoints(const char             **invalidString,
     BSLS_ASSERT_SAFE(string || 0 == length);
     BSLS_ASSERT_SAFE(0 <= bsls::Types::IntPtr(length));
 
+    int count = 0;
+
+    {
+        bsls::Types::IntPtr          prefixCount;
+        const bsls::Types::size_type prefix = validPrefix(&prefixCount,
+                                                          string,
+                                                          length,
+                                                          INT_MAX);
+        string += prefix;
+        length -= prefix;
+        count   = static_cast<int>(prefixCount);
+    }
+
     if (0 == length) {
-        return 0;                                                     // RETURN
+        return count;                                                 // RETURN
     }
 
     const char       *pc     = string;
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
-
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
           case 0x0: BSLA_FALLTHROUGH;
@@ -751,6 +1232,28 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
                               // code point, and assigned to 'string' between
                               // iterations.
 
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+    {
+        // Bound the length of 'string' given to the vectorized validator by
+        // the number of bytes 'numCodePoints' code points can occupy, so that
+        // advancing over a few code points does not scan a long 'string'.
+
+        size_type length;
+        if (static_cast<size_type>(numCodePoints) <= INT_MAX / 4) {
+            const size_type  maxLength = static_cast<size_type>(numCodePoints)
+                                                                         * 4;
+            const void      *nul       = bsl::memchr(string, 0, maxLength);
+            length = nul ? static_cast<const char *>(nul) - string
+                         : maxLength;
+        }
+        else {
+            length = bsl::strlen(string);
+        }
+
+        string += validPrefix(&ret, string, length, numCodePoints);
+    }
+#endif
+
     // Note that we keep 'string' pointing to the beginning of the Unicode code
     // point being processed, and only advance it to the next code point
     // between iterations.
@@ -946,6 +1449,8 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
     IntPtr  ret = 0;      // return value -- number of code points advanced
     const char * const endOfInput = string + length;
 
+    string += validPrefix(&ret, string, length, numCodePoints);
+
     // Note that we keep 'string' pointing to the beginning of the Unicode code
     // point being processed, and only advance it to the next code point
     // between iterations.
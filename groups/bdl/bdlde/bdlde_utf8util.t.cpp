@@ -96,6 +96,10 @@ using bsl::size_t;
 //: o Test case 14 is negative testing.
 //:
 //: o Test cases 15, 16, and 17 are USAGE EXAMPLES.
+//:
+//: o Test case 21 verifies that validation of strings long enough to be
+//:   validated by the vectorized validators matches the validation of their
+//:   code points one at a time.
 //
 //-----------------------------------------------------------------------------
 // To fit functions on one line, 'typedef const char cchar'.
@@ -170,6 +174,7 @@ using bsl::size_t;
 // [18] USAGE EXAMPLE 1
 // [19] USAGE EXAMPLE 2
 // [20] USAGE EXAMPLE 3
+// [21] CONCERN: VECTORIZED VALIDATION MATCHES SCALAR VALIDATION
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
 // ============================================================================
@@ -2707,6 +2712,39 @@ bsl::string tmpFileName(int test)
     return ret;
 }
 
+static
+IntPtr walkCodePoints(int         *status,
+                      const char **end,
+                      const char  *string,
+                      size_t       length,
+                      IntPtr       numCodePoints)
+    // Advance over at most the specified 'numCodePoints' code points of the
+    // specified 'string' having the specified 'length', one code point at a
+    // time using 'isValidCodePoint', stopping at the first invalid sequence.
+    // Load into the specified 'status' 0 if no invalid sequence was
+    // encountered and the (negative) 'ErrorStatus' of the invalid sequence
+    // otherwise, load into the specified 'end' the position where the walk
+    // stopped, and return the number of code points advanced over.  This
+    // function serves as an oracle for the validation functions.
+{
+    IntPtr      ret = 0;
+    const char *pc  = string;
+
+    *status = 0;
+    while (ret < numCodePoints && pc < string + length) {
+        int sts;
+        if (!Obj::isValidCodePoint(&sts, pc, string + length - pc)) {
+            *status = sts;
+            break;
+        }
+        pc += sts;
+        ++ret;
+    }
+
+    *end = pc;
+    return ret;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -3567,6 +3605,197 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 21: {
+        // --------------------------------------------------------------------
+        // VECTORIZED VALIDATION
+        //
+        // Concerns:
+        //: 1 Strings long enough to be validated, in whole or in part, by the
+        //:   vectorized validators yield the same results as the validation
+        //:   of their code points one at a time, whichever validator is
+        //:   selected for the processor.
+        //:
+        //: 2 Invalid sequences are reported at the same position and with
+        //:   the same status wherever they fall relative to the 16 and 32-byte
+        //:   blocks examined by the vectorized validators, including
+        //:   sequences straddling two blocks or cut short at the end of
+        //:   input.
+        //:
+        //: 3 'advanceIfValid' does not advance over more than the requested
+        //:   number of code points when vectorized validation is used.
+        //
+        // Plan:
+        //: 1 Generate random valid UTF-8 strings of up to 40 code points,
+        //:   either mostly ASCII or with code points of random sizes.
+        //:
+        //: 2 Corrupt the strings by either inserting an invalid sequence from
+        //:   a table between two code points, overwriting a random byte with
+        //:   a random non-zero value, or truncating the string at a random
+        //:   byte.  Leave some strings unchanged.
+        //:
+        //: 3 Compute the expected results with 'isValidCodePoint', one code
+        //:   point at a time, and verify that the null-terminated and
+        //:   length-taking overloads of 'isValid', 'numCodePointsIfValid',
+        //:   and 'advanceIfValid' agree with them.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: VECTORIZED VALIDATION MATCHES SCALAR VALIDATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "VECTORIZED VALIDATION\n"
+                             "=====================\n";
+
+        static const char *const INVALID[] = {
+            "\x80",                        // unexpected continuation
+            "\xbf\x80",                    // unexpected continuation
+            "\xc0\x80",                    // overlong 2-byte
+            "\xc1\xbf",                    // overlong 2-byte
+            "\xc2",                        // truncated 2-byte
+            "\xc2\xc2\x80",                // non-continuation
+            "\xe0\x80\x80",                // overlong 3-byte
+            "\xe0\x9f\xbf",                // overlong 3-byte
+            "\xe2\x82",                    // truncated 3-byte
+            "\xe2\x41\x82",                // non-continuation
+            "\xed\xa0\x80",                // surrogate
+            "\xed\xbf\xbf",                // surrogate
+            "\xf0\x80\x80\x80",            // overlong 4-byte
+            "\xf0\x8f\xbf\xbf",            // overlong 4-byte
+            "\xf0\x9f\x98",                // truncated 4-byte
+            "\xf0\x9f\x41\x80",            // non-continuation
+            "\xf4\x90\x80\x80",            // larger than 0x10ffff
+            "\xf5\x80\x80\x80",            // larger than 0x10ffff
+            "\xf7\xbf\xbf\xbf",            // larger than 0x10ffff
+            "\xf8\x88\x80\x80\x80",        // invalid initial octet
+            "\xfe",                        // invalid initial octet
+            "\xff",                        // invalid initial octet
+        };
+        enum { k_NUM_INVALID = sizeof INVALID / sizeof *INVALID };
+
+        for (int ti = 0; ti < 40 * 1000; ++ti) {
+            const bool asciiOnly  = 0 == ti % 2;
+            const int  numCps     = u::randUnsigned() % 41;
+            const int  corruption = u::randUnsigned() % 4;
+
+            bsl::vector<bsl::string> codePoints;
+            for (int ii = 0; ii < numCps; ++ii) {
+                bsl::string cp;
+                u::appendRandCorrectCodePoint(&cp,
+                                              false,
+                                              asciiOnly && u::randUnsigned()
+                                                                        % 16
+                                              ? 1
+                                              : -1);
+                codePoints.push_back(cp);
+            }
+
+            bsl::string str;
+            switch (corruption) {
+              case 0: {
+                for (int ii = 0; ii < numCps; ++ii) {
+                    str += codePoints[ii];
+                }
+              } break;
+              case 1: {
+                const int at = u::randUnsigned() % (numCps + 1);
+                for (int ii = 0; ii <= numCps; ++ii) {
+                    if (ii == at) {
+                        str += INVALID[u::randUnsigned() % k_NUM_INVALID];
+                    }
+                    if (ii < numCps) {
+                        str += codePoints[ii];
+                    }
+                }
+              } break;
+              case 2:
+              case 3: {
+                for (int ii = 0; ii < numCps; ++ii) {
+                    str += codePoints[ii];
+                }
+                if (str.empty()) {
+                    break;
+                }
+                const size_t at = u::randUnsigned() % str.length();
+                if (2 == corruption) {
+                    str[at] = static_cast<char>(
+                                                u::randUnsigned() % 255 + 1);
+                }
+                else {
+                    str.resize(at);
+                }
+              } break;
+            }
+
+            const char   *STR = str.c_str();
+            const size_t  LEN = str.length();
+
+            int         expSts;
+            const char *expEnd;
+            const IntPtr expNum = u::walkCodePoints(&expSts,
+                                                    &expEnd,
+                                                    STR,
+                                                    LEN,
+                                                    INT_MAX);
+
+            if (veryVeryVerbose) {
+                P_(ti);    P_(LEN);    P_(expSts);    P(expNum);
+            }
+
+            const char *invalid = 0;
+            ASSERTV(ti, (0 == expSts) == Obj::isValid(&invalid, STR, LEN));
+            ASSERTV(ti, 0 == expSts || expEnd == invalid);
+
+            invalid = 0;
+            ASSERTV(ti, (0 == expSts) == Obj::isValid(&invalid, STR));
+            ASSERTV(ti, 0 == expSts || expEnd == invalid);
+
+            invalid = 0;
+            IntPtr num = Obj::numCodePointsIfValid(&invalid, STR, LEN);
+            ASSERTV(ti, num, expNum, expSts,
+                                       (0 == expSts ? expNum : expSts) == num);
+            ASSERTV(ti, 0 == expSts || expEnd == invalid);
+
+            invalid = 0;
+            num = Obj::numCodePointsIfValid(&invalid, STR);
+            ASSERTV(ti, num, expNum, expSts,
+                                       (0 == expSts ? expNum : expSts) == num);
+            ASSERTV(ti, 0 == expSts || expEnd == invalid);
+
+            const IntPtr LIMITS[] = { 0,
+                                      1,
+                                      expNum / 2,
+                                      expNum,
+                                      expNum + 1,
+                                      u::randUnsigned() % (numCps + 2),
+                                      INT_MAX };
+            enum { k_NUM_LIMITS = sizeof LIMITS / sizeof *LIMITS };
+
+            for (int tj = 0; tj < k_NUM_LIMITS; ++tj) {
+                const IntPtr LIMIT = LIMITS[tj];
+
+                int          expAdvSts;
+                const char  *expAdvEnd;
+                const IntPtr expAdvNum = u::walkCodePoints(&expAdvSts,
+                                                           &expAdvEnd,
+                                                           STR,
+                                                           LEN,
+                                                           LIMIT);
+
+                int         status = 1;
+                const char *result = 0;
+                num = Obj::advanceIfValid(&status, &result, STR, LEN, LIMIT);
+                ASSERTV(ti, LIMIT, num, expAdvNum, expAdvNum == num);
+                ASSERTV(ti, LIMIT, status, expAdvSts, expAdvSts == status);
+                ASSERTV(ti, LIMIT, expAdvEnd == result);
+
+                status = 1;
+                result = 0;
+                num = Obj::advanceIfValid(&status, &result, STR, LIMIT);
+                ASSERTV(ti, LIMIT, num, expAdvNum, expAdvNum == num);
+                ASSERTV(ti, LIMIT, status, expAdvSts, expAdvSts == status);
+                ASSERTV(ti, LIMIT, expAdvEnd == result);
+            }
+        }
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
@@ -0,0 +1,478 @@
+// bdljsn_ondemandreader.cpp                                          -*-C++-*-
+#include <bdljsn_ondemandreader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_ondemandreader_cpp,"$Id$ $CSID$")
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_readoptions.h>
+#include <bdljsn_stringutil.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+inline
+bool isValueStart(char character)
+    // Return 'true' if the specified structural 'character' may begin a
+    // value, and 'false' otherwise.
+{
+    return ',' != character && ':' != character
+        && ']' != character && '}' != character;
+}
+
+inline
+bool isWhitespace(char character)
+    // Return 'true' if the specified 'character' is JSON white space, and
+    // 'false' otherwise.
+{
+    return ' ' == character || '\n' == character
+        || '\t' == character || '\r' == character;
+}
+
+int stringContents(bsl::string_view *result, const bsl::string_view& text)
+    // Load into the specified 'result' the contents of the string having the
+    // specified 'text', excluding its quotes.  Return 0 on success, and a
+    // non-zero value if 'text' is not the text of a string.
+{
+    if (text.length() < 2 || '"' != text[0] || '"' != text.back()) {
+        return -1;                                                    // RETURN
+    }
+    *result = text.substr(1, text.length() - 2);
+    return 0;
+}
+
+inline
+bool hasEscape(const bsl::string_view& contents)
+    // Return 'true' if the specified string 'contents' contain an escape
+    // sequence, and 'false' otherwise.
+{
+    return 0 != bsl::memchr(contents.data(), '\\', contents.length());
+}
+
+int setError(Error                   *errorDescription,
+             bsl::size_t              offset,
+             const bsl::string_view&  message)
+    // Load, if the specified 'errorDescription' is not 0, the specified
+    // 'message' and the location having the specified 'offset' into
+    // 'errorDescription'.  Return a non-zero value.
+{
+    if (errorDescription) {
+        errorDescription->setLocation(Location(offset));
+        errorDescription->setMessage(message);
+    }
+    return -1;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class OnDemandValue
+                            // -------------------
+
+// ACCESSORS
+int OnDemandValue::asBool(bool *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if ("true" == value) {
+        *result = true;
+        return 0;                                                     // RETURN
+    }
+    if ("false" == value) {
+        *result = false;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+int OnDemandValue::asDecimal64(bdldfp::Decimal64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    *result = NumberUtil::asDecimal64(value);
+    return 0;
+}
+
+int OnDemandValue::asDouble(double *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    *result = NumberUtil::asDouble(value);
+    return 0;
+}
+
+int OnDemandValue::asInt(int *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    return NumberUtil::asInt(result, value);
+}
+
+int OnDemandValue::asInt64(bsls::Types::Int64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    return NumberUtil::asInt64(result, value);
+}
+
+int OnDemandValue::asUint64(bsls::Types::Uint64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    return NumberUtil::asUint64(result, value);
+}
+
+int OnDemandValue::asJson(Json *result) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(d_index_p);
+
+    // The nesting depth of the document was verified by 'read'.
+
+    ReadOptions options;
+    options.setMaxNestedDepth(d_index_p->maxDepth() + 1);
+
+    return JsonUtil::read(result, text(), options);
+}
+
+int OnDemandValue::asNumber(JsonNumber *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = text();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    *result = JsonNumber(value, result->allocator());
+    return 0;
+}
+
+int OnDemandValue::asString(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    bsl::string_view contents;
+    if (0 != u::stringContents(&contents, text())) {
+        return -1;                                                    // RETURN
+    }
+    if (!u::hasEscape(contents)) {
+        result->assign(contents.data(), contents.length());
+        return 0;                                                     // RETURN
+    }
+    return StringUtil::readUnquotedString(result, contents);
+}
+
+int OnDemandValue::asStringView(bsl::string_view *result) const
+{
+    BSLS_ASSERT(result);
+
+    bsl::string_view contents;
+    if (0 != u::stringContents(&contents, text()) || u::hasEscape(contents)) {
+        return -1;                                                    // RETURN
+    }
+    *result = contents;
+    return 0;
+}
+
+int OnDemandValue::at(OnDemandValue *result, bsl::size_t index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(d_index_p);
+
+    if ('[' != d_index_p->character(d_index)) {
+        return -1;                                                    // RETURN
+    }
+
+    OnDemandIterator it(*this);
+    for (; !it.atEnd(); it.advance()) {
+        if (0 == index) {
+            *result = it.value();
+            return 0;                                                 // RETURN
+        }
+        --index;
+    }
+    return -1;
+}
+
+int OnDemandValue::find(OnDemandValue           *result,
+                        const bsl::string_view&  name) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(d_index_p);
+
+    if ('{' != d_index_p->character(d_index)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string decoded(d_index_p->allocator());
+
+    OnDemandIterator it(*this);
+    for (; !it.atEnd(); it.advance()) {
+        bsl::string_view key;
+        if (0 != u::stringContents(&key, it.key().text())) {
+            return -1;                                                // RETURN
+        }
+        if (u::hasEscape(key)) {
+            if (0 != StringUtil::readUnquotedString(&decoded, key)) {
+                return -1;                                            // RETURN
+            }
+            key = decoded;
+        }
+        if (name == key) {
+            *result = it.value();
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+bool OnDemandValue::isNull() const
+{
+    return "null" == text();
+}
+
+bsl::string_view OnDemandValue::text() const
+{
+    BSLS_ASSERT(d_index_p);
+
+    const bsl::string_view& input = d_index_p->input();
+    const bsl::size_t       begin = d_index_p->position(d_index);
+    const char              first = input[begin];
+
+    bsl::size_t end;
+    if ('[' == first || '{' == first) {
+        end = d_index_p->position(d_index_p->matchingIndex(d_index)) + 1;
+    }
+    else {
+        // A scalar extends to the next structural character, or to the end of
+        // the document, excluding any white space in between.
+
+        end = d_index_p->position(d_index + 1);
+        while (end > begin + 1 && u::isWhitespace(input[end - 1])) {
+            --end;
+        }
+    }
+    return input.substr(begin, end - begin);
+}
+
+JsonType::Enum OnDemandValue::type() const
+{
+    BSLS_ASSERT(d_index_p);
+
+    switch (d_index_p->character(d_index)) {
+      case '{': return JsonType::e_OBJECT;                            // RETURN
+      case '[': return JsonType::e_ARRAY;                             // RETURN
+      case '"': return JsonType::e_STRING;                            // RETURN
+      case 't':
+      case 'f': return JsonType::e_BOOLEAN;                           // RETURN
+      case 'n': return JsonType::e_NULL;                              // RETURN
+      default:  return JsonType::e_NUMBER;                            // RETURN
+    }
+}
+
+                           // ----------------------
+                           // class OnDemandIterator
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+void OnDemandIterator::moveTo(bsl::size_t structural, bool allowEnd)
+{
+    if (structural == d_end) {
+        if (!allowEnd) {
+            d_status = -1;  // trailing comma
+        }
+        d_current = d_end;
+        return;                                                       // RETURN
+    }
+
+    // An element of an array is a value; a member of an object is a name, a
+    // name separator, and a value.
+
+    const bool valid =
+                 d_isObject
+                 ? structural + 2 < d_end
+                   && '"' == d_index_p->character(structural)
+                   && ':' == d_index_p->character(structural + 1)
+                   && u::isValueStart(d_index_p->character(structural + 2))
+                 : u::isValueStart(d_index_p->character(structural));
+
+    if (!valid) {
+        d_status  = -1;
+        d_current = d_end;
+        return;                                                       // RETURN
+    }
+    d_current = structural;
+}
+
+// CREATORS
+OnDemandIterator::OnDemandIterator(const OnDemandValue& container)
+: d_index_p(container.d_index_p)
+, d_current(0)
+, d_end(0)
+, d_isObject(false)
+, d_status(0)
+{
+    BSLS_ASSERT(d_index_p);
+
+    const char first = d_index_p->character(container.d_index);
+    if ('[' != first && '{' != first) {
+        d_status = -1;
+        return;                                                       // RETURN
+    }
+
+    d_isObject = '{' == first;
+    d_end      = d_index_p->matchingIndex(container.d_index);
+    moveTo(container.d_index + 1, true);
+}
+
+// MANIPULATORS
+void OnDemandIterator::advance()
+{
+    BSLS_ASSERT(!atEnd());
+
+    // Skip over the current value, however large, to the separator or
+    // closing bracket or brace following it.
+
+    const bsl::size_t value = d_isObject ? d_current + 2 : d_current;
+    const bsl::size_t next  = d_index_p->matchingIndex(value) + 1;
+
+    if (next == d_end) {
+        d_current = d_end;
+        return;                                                       // RETURN
+    }
+    if (',' != d_index_p->character(next)) {
+        d_status  = -1;
+        d_current = d_end;
+        return;                                                       // RETURN
+    }
+    moveTo(next + 1, false);
+}
+
+                            // --------------------
+                            // class OnDemandReader
+                            // --------------------
+
+// MANIPULATORS
+int OnDemandReader::read(const bsl::string_view& input)
+{
+    return read(0, input, ReadOptions());
+}
+
+int OnDemandReader::read(const bsl::string_view& input,
+                         const ReadOptions&      options)
+{
+    return read(0, input, options);
+}
+
+int OnDemandReader::read(Error                   *errorDescription,
+                         const bsl::string_view&  input)
+{
+    return read(errorDescription, input, ReadOptions());
+}
+
+int OnDemandReader::read(Error                   *errorDescription,
+                         const bsl::string_view&  input,
+                         const ReadOptions&       options)
+{
+    if (0 != d_index.build(errorDescription, input)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == d_index.numStructurals()) {
+        reset();
+        return u::setError(errorDescription,                          // RETURN
+                           input.length(),
+                           "Unexpected end of input");
+    }
+
+    if (!u::isValueStart(d_index.character(0))) {
+        const bsl::size_t offset = d_index.position(0);
+        reset();
+        return u::setError(errorDescription,                          // RETURN
+                           offset,
+                           "Unexpected initial character");
+    }
+
+    if (d_index.maxDepth() > options.maxNestedDepth()) {
+        // Find the first array or object exceeding the maximum depth.
+
+        bsl::size_t offset = 0;
+        int         depth  = 0;
+        for (bsl::size_t i = 0; i < d_index.numStructurals(); ++i) {
+            const char c = d_index.character(i);
+            if ('[' == c || '{' == c) {
+                if (++depth > options.maxNestedDepth()) {
+                    offset = d_index.position(i);
+                    break;
+                }
+            }
+            else if (']' == c || '}' == c) {
+                --depth;
+            }
+        }
+        reset();
+        return u::setError(errorDescription,                          // RETURN
+                           offset,
+                           "Maximum nesting depth exceeded");
+    }
+
+    const bsl::size_t rootEnd = d_index.matchingIndex(0) + 1;
+    if (!options.allowTrailingText() && rootEnd != d_index.numStructurals()) {
+        const bsl::size_t offset = d_index.position(rootEnd);
+        reset();
+        return u::setError(errorDescription,                          // RETURN
+                           offset,
+                           "Additional text found after document");
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,622 @@
+// bdljsn_ondemandreader.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLJSN_ONDEMANDREADER
+#define INCLUDED_BDLJSN_ONDEMANDREADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide lazy, zero-copy access to the values of a JSON document.
+//
+//@CLASSES:
+//  bdljsn::OnDemandReader: indexed JSON document providing its root value
+//  bdljsn::OnDemandValue: cursor referring to a value of a JSON document
+//  bdljsn::OnDemandIterator: iterator over the elements of an array or object
+//
+//@SEE_ALSO: bdljsn_jsonutil, bdljsn_structuralindex
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdljsn::OnDemandReader',
+// that provides access to the values of a JSON document held in a contiguous
+// buffer without building a 'bdljsn::Json' object: only the values that are
+// accessed are decoded, and only when they are accessed.  This suits
+// applications that need a few values of large documents, where
+// 'bdljsn::JsonUtil::read' would spend most of its time, and most of its
+// memory, decoding values that are never used.
+//
+// 'read' builds a 'bdljsn::StructuralIndex' of the document (see
+// 'bdljsn_structuralindex'), in a single pass over the text, and
+// 'bdljsn::OnDemandReader::root' returns a 'bdljsn::OnDemandValue' referring
+// to the top-level value of the document.  An 'OnDemandValue' is a cheap,
+// copyable cursor that refers to the text of a value, from which it can:
+//
+//: o find a member of an object by name ('find'), or an element of an array
+//:   by position ('at'), skipping over any array or object preceding it in
+//:   constant time,
+//:
+//: o return the contents of a string having no escape sequences as a
+//:   'bsl::string_view' referring into the document ('asStringView'), or
+//:   decode any string into a 'bsl::string' ('asString'),
+//:
+//: o convert a number, boolean, or null value ('asInt64', 'asDouble',
+//:   'asBool', 'isNull', etc.), and
+//:
+//: o materialize the value as a 'bdljsn::Json' object ('asJson').
+//:
+// A 'bdljsn::OnDemandIterator' iterates over the elements of an array, or the
+// members of an object, in document order.
+//
+// The document is neither copied nor modified, and must remain valid and
+// unmodified while the reader, or any value or iterator obtained from it, is
+// in use.  Values and iterators are invalidated by a subsequent call to
+// 'read' or 'reset' on the reader.
+//
+///Validation
+///----------
+// 'read' verifies that the document is valid UTF-8, that its strings are
+// terminated and contain no unescaped control characters, that its brackets
+// and braces are balanced and properly nested and do not exceed the maximum
+// nesting depth of the 'bdljsn::ReadOptions' supplied (64 by default), and
+// that the document consists of a single value (or, if the
+// 'allowTrailingText' option is 'true', begins with a value).  The rest of the
+// JSON grammar is verified as values are accessed: an operation reports an
+// error if the part of the document it examines is malformed (e.g., a missing
+// comma between the elements of an array it iterates over, or a malformed
+// number it converts), but the parts of the document that are never examined
+// are never verified.  Use 'bdljsn::JsonUtil::read' where a document must be
+// verified in its entirety.
+//
+///Duplicate Keys
+///--------------
+// 'find' returns the *first* member of an object having the name sought,
+// consistently with 'bdljsn::JsonUtil::read', which preserves the value of the
+// first member having a duplicated name.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Few Fields of a Large Message
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive market data messages, of which we only need the
+// symbol, the last trade price, and the size of each of the levels of the
+// book.
+//
+// First, we define a message (which, in practice, would have many more
+// fields):
+//..
+//  const char *MESSAGE = "{\n"
+//                        "  \"header\": {\"seq\": 1234, \"source\": \"X\"},\n"
+//                        "  \"symbol\": \"IBM\",\n"
+//                        "  \"book\": [\n"
+//                        "    {\"price\": 134.1, \"size\": 200},\n"
+//                        "    {\"price\": 134.2, \"size\": 500}\n"
+//                        "  ],\n"
+//                        "  \"last\": 134.15\n"
+//                        "}";
+//..
+// Then, we index the message:
+//..
+//  bdljsn::OnDemandReader reader;
+//  int rc = reader.read(MESSAGE);
+//  assert(0 == rc);
+//
+//  const bdljsn::OnDemandValue root = reader.root();
+//  assert(bdljsn::JsonType::e_OBJECT == root.type());
+//..
+// Next, we find the symbol and the last price, skipping over the header and
+// the book.  Note that the symbol is a 'bsl::string_view' referring into
+// 'MESSAGE':
+//..
+//  bdljsn::OnDemandValue symbol;
+//  bdljsn::OnDemandValue last;
+//  rc = root.find(&symbol, "symbol");
+//  assert(0 == rc);
+//  rc = root.find(&last, "last");
+//  assert(0 == rc);
+//
+//  bsl::string_view symbolText;
+//  double           lastPrice;
+//  rc = symbol.asStringView(&symbolText);
+//  assert(0 == rc);
+//  rc = last.asDouble(&lastPrice);
+//  assert(0 == rc);
+//
+//  assert("IBM"  == symbolText);
+//  assert(134.15 == lastPrice);
+//..
+// Then, we iterate over the levels of the book:
+//..
+//  bdljsn::OnDemandValue book;
+//  rc = root.find(&book, "book");
+//  assert(0 == rc);
+//
+//  bsls::Types::Int64       totalSize = 0;
+//  bdljsn::OnDemandIterator it(book);
+//  for (; !it.atEnd(); it.advance()) {
+//      bdljsn::OnDemandValue size;
+//      bsls::Types::Int64    value;
+//
+//      rc = it.value().find(&size, "size");
+//      assert(0 == rc);
+//      rc = size.asInt64(&value);
+//      assert(0 == rc);
+//
+//      totalSize += value;
+//  }
+//  assert(0   == it.status());
+//  assert(700 == totalSize);
+//..
+// Finally, we observe that a missing field is reported as such, and that the
+// header can be materialized as a 'bdljsn::Json' object if needed:
+//..
+//  bdljsn::OnDemandValue missing;
+//  rc = root.find(&missing, "bid");
+//  assert(0 != rc);
+//
+//  bdljsn::OnDemandValue header;
+//  rc = root.find(&header, "header");
+//  assert(0 == rc);
+//
+//  bdljsn::Json json;
+//  rc = header.asJson(&json);
+//  assert(0 == rc);
+//
+//  int seq;
+//  rc = json["seq"].asInt(&seq);
+//  assert(0    == rc);
+//  assert(1234 == seq);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_jsontype.h>
+#include <bdljsn_location.h>
+#include <bdljsn_structuralindex.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class Error;
+class Json;
+class JsonNumber;
+class ReadOptions;
+
+                            // ===================
+                            // class OnDemandValue
+                            // ===================
+
+class OnDemandValue {
+    // This class provides a cursor referring to a value of a JSON document
+    // indexed by an 'OnDemandReader'.  Objects of this class are cheap to
+    // copy, and remain valid while the reader from which they were obtained
+    // is neither destroyed, reset, nor used to read another document.
+
+    // DATA
+    const StructuralIndex *d_index_p;  // index of the document (held, not
+                                       // owned)
+
+    bsl::size_t            d_index;    // index of the first structural
+                                       // character of the value
+
+    // FRIENDS
+    friend class OnDemandIterator;
+
+  public:
+    // CREATORS
+    OnDemandValue();
+        // Create a value that refers to no document.  The behavior of every
+        // method of the created object, other than assignment and destruction,
+        // is undefined.
+
+    OnDemandValue(const StructuralIndex *index, bsl::size_t structural);
+        // Create a value referring to the value that begins at the structural
+        // character having the specified 'structural' index in the specified
+        // 'index'.  The behavior is undefined unless
+        // 'structural < index->numStructurals()'.  Note that this constructor
+        // is used by 'OnDemandReader' and 'OnDemandIterator', and is not
+        // intended for use by clients.
+
+    //! OnDemandValue(const OnDemandValue& original) = default;
+    //! ~OnDemandValue() = default;
+
+    // MANIPULATORS
+    //! OnDemandValue& operator=(const OnDemandValue& rhs) = default;
+
+    // ACCESSORS
+    int asBool(bool *result) const;
+        // Load into the specified 'result' the value of this boolean value.
+        // Return 0 on success, and a non-zero value, with no effect on
+        // 'result', if this value is not 'true' or 'false'.
+
+    int asDecimal64(bdldfp::Decimal64 *result) const;
+    int asDouble(double *result) const;
+        // Load into the specified 'result' the closest representation of this
+        // number.  Return 0 on success, and a non-zero value, with no effect
+        // on 'result', if this value is not a valid JSON number.
+
+    int asInt(int *result) const;
+    int asInt64(bsls::Types::Int64 *result) const;
+    int asUint64(bsls::Types::Uint64 *result) const;
+        // Load into the specified 'result' the closest representation of this
+        // number.  Return 0 if this number is an integer that is exactly
+        // representable by 'result', a non-zero value, with no effect on
+        // 'result', if this value is not a valid JSON number, and otherwise a
+        // non-zero value as returned by the corresponding
+        // 'bdljsn::NumberUtil' function (e.g.,
+        // 'bdljsn::NumberUtil::k_OVERFLOW'), having loaded the closest
+        // representation into 'result'.
+
+    int asJson(Json *result) const;
+        // Load into the specified 'result' the value of this value,
+        // verifying it in its entirety as 'bdljsn::JsonUtil::read' does.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    int asNumber(JsonNumber *result) const;
+        // Load into the specified 'result' the value of this number.  Return
+        // 0 on success, and a non-zero value, with no effect on 'result', if
+        // this value is not a valid JSON number.
+
+    int asString(bsl::string *result) const;
+        // Load into the specified 'result' the contents of this string,
+        // decoding its escape sequences, if any.  Return 0 on success, and a
+        // non-zero value if this value is not a string or contains an invalid
+        // escape sequence.
+
+    int asStringView(bsl::string_view *result) const;
+        // Load into the specified 'result' a view of the contents of this
+        // string, referring into the document, if it contains no escape
+        // sequence.  Return 0 on success, and a non-zero value, with no effect
+        // on 'result', if this value is not a string or contains an escape
+        // sequence (in which case 'asString' can be used to decode it).
+
+    int at(OnDemandValue *result, bsl::size_t index) const;
+        // Load into the specified 'result' the element of this array having
+        // the specified 'index'.  Return 0 on success, and a non-zero value,
+        // with no effect on 'result', if this value is not an array, if the
+        // array has 'index' or fewer elements, or if the part of the array
+        // preceding the element is malformed.  Note that the elements
+        // preceding the element sought are skipped, not decoded, in constant
+        // time each.
+
+    int find(OnDemandValue *result, const bsl::string_view& name) const;
+        // Load into the specified 'result' the value of the first member of
+        // this object having the specified 'name'.  Return 0 on success, and a
+        // non-zero value, with no effect on 'result', if this value is not an
+        // object, if it has no such member, or if the part of the object
+        // preceding the member is malformed.  Note that the members preceding
+        // the member sought are skipped, not decoded, in constant time each
+        // (beyond comparing their names with 'name').
+
+    bool isNull() const;
+        // Return 'true' if this value is 'null', and 'false' otherwise.
+
+    Location location() const;
+        // Return the location of the first character of this value in the
+        // document.
+
+    bsl::size_t structural() const;
+        // Return the index of the first structural character of this value in
+        // the index of the document.
+
+    bsl::string_view text() const;
+        // Return the text of this value, including the quotes of a string,
+        // and the brackets or braces of an array or object, but excluding any
+        // white space following it.
+
+    JsonType::Enum type() const;
+        // Return the type of this value, as indicated by its first character.
+        // Note that the rest of the value is not verified to conform to that
+        // type.
+};
+
+                           // ======================
+                           // class OnDemandIterator
+                           // ======================
+
+class OnDemandIterator {
+    // This class provides an iterator over the elements of an array, or the
+    // members of an object, of a JSON document indexed by an
+    // 'OnDemandReader'.  Iteration ends at the end of the array or object, or
+    // at the first malformed element encountered, in which case 'status'
+    // returns a non-zero value.
+
+    // DATA
+    const StructuralIndex *d_index_p;   // index of the document (held, not
+                                        // owned)
+
+    bsl::size_t            d_current;   // index of the first structural
+                                        // character of the current element
+                                        // or member
+
+    bsl::size_t            d_end;       // index of the closing bracket or
+                                        // brace
+
+    bool                   d_isObject;  // 'true' if iterating over an object
+
+    int                    d_status;    // 0 unless a malformed element was
+                                        // encountered
+
+    // PRIVATE MANIPULATORS
+    void moveTo(bsl::size_t structural, bool allowEnd);
+        // Make the element beginning at the specified 'structural' index the
+        // current element, or end the iteration if 'structural' indexes the
+        // closing bracket or brace and the specified 'allowEnd' is 'true',
+        // ending the iteration with a non-zero status if the element is
+        // malformed.
+
+  public:
+    // CREATORS
+    OnDemandIterator();
+        // Create an iterator that is at the end of an empty sequence.
+
+    explicit OnDemandIterator(const OnDemandValue& container);
+        // Create an iterator referring to the first element of the specified
+        // 'container' array, or to the first member of the 'container'
+        // object.  The created iterator is at the end if 'container' is empty,
+        // and is at the end with a non-zero status if 'container' is neither
+        // an array nor an object, or if its first element is malformed.
+
+    //! OnDemandIterator(const OnDemandIterator& original) = default;
+    //! ~OnDemandIterator() = default;
+
+    // MANIPULATORS
+    //! OnDemandIterator& operator=(const OnDemandIterator& rhs) = default;
+
+    void advance();
+        // Move this iterator to the next element or member.  The behavior is
+        // undefined if 'atEnd()'.
+
+    // ACCESSORS
+    bool atEnd() const;
+        // Return 'true' if this iterator has no current element or member,
+        // and 'false' otherwise.
+
+    OnDemandValue key() const;
+        // Return the name, a string, of the current member.  The behavior is
+        // undefined unless this iterator iterates over an object and
+        // '!atEnd()'.
+
+    int status() const;
+        // Return 0 if no malformed element or member was encountered by this
+        // iterator, and a non-zero value otherwise.
+
+    OnDemandValue value() const;
+        // Return the current element, or the value of the current member.  The
+        // behavior is undefined if 'atEnd()'.
+};
+
+                            // ====================
+                            // class OnDemandReader
+                            // ====================
+
+class OnDemandReader {
+    // This class provides a mechanism that indexes a JSON document held in a
+    // contiguous buffer and provides lazy access to its values.  See
+    // {Validation} for the verification performed by 'read'.
+
+    // DATA
+    StructuralIndex d_index;  // index of the document
+
+  private:
+    // NOT IMPLEMENTED
+    OnDemandReader(const OnDemandReader&);
+    OnDemandReader& operator=(const OnDemandReader&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(OnDemandReader, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit OnDemandReader(bslma::Allocator *basicAllocator = 0);
+        // Create a reader having no document.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~OnDemandReader() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int read(const bsl::string_view& input);
+    int read(const bsl::string_view& input, const ReadOptions& options);
+    int read(Error *errorDescription, const bsl::string_view& input);
+    int read(Error                   *errorDescription,
+             const bsl::string_view&  input,
+             const ReadOptions&       options);
+        // Index the JSON document in the specified 'input' for on-demand
+        // access to its values.  Optionally specify an 'errorDescription'
+        // that, if an error occurs, is loaded with a description of the
+        // error.  Optionally specify 'options' that specify the maximum
+        // nesting depth, and whether text may follow the document.  Return 0
+        // on success, and a non-zero value, leaving this reader having no
+        // document, if 'input' is found to be invalid (see {Validation}).
+        // Note that 'input' must remain valid and unmodified while this
+        // reader, or a value or iterator obtained from it, is in use.
+
+    void reset();
+        // Reset this reader to having no document.
+
+    // ACCESSORS
+    const StructuralIndex& index() const;
+        // Return a reference providing non-modifiable access to the index of
+        // the document of this reader.
+
+    const bsl::string_view& input() const;
+        // Return the document of this reader.
+
+    OnDemandValue root() const;
+        // Return the top-level value of the document of this reader.  The
+        // behavior is undefined unless the last call to 'read' succeeded, and
+        // 'reset' has not been called since.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class OnDemandValue
+                            // -------------------
+
+// CREATORS
+inline
+OnDemandValue::OnDemandValue()
+: d_index_p(0)
+, d_index(0)
+{
+}
+
+inline
+OnDemandValue::OnDemandValue(const StructuralIndex *index,
+                             bsl::size_t            structural)
+: d_index_p(index)
+, d_index(structural)
+{
+    BSLS_ASSERT(index);
+    BSLS_ASSERT(structural < index->numStructurals());
+}
+
+// ACCESSORS
+inline
+Location OnDemandValue::location() const
+{
+    BSLS_ASSERT(d_index_p);
+
+    return Location(d_index_p->position(d_index));
+}
+
+inline
+bsl::size_t OnDemandValue::structural() const
+{
+    return d_index;
+}
+
+                           // ----------------------
+                           // class OnDemandIterator
+                           // ----------------------
+
+// CREATORS
+inline
+OnDemandIterator::OnDemandIterator()
+: d_index_p(0)
+, d_current(0)
+, d_end(0)
+, d_isObject(false)
+, d_status(0)
+{
+}
+
+// ACCESSORS
+inline
+bool OnDemandIterator::atEnd() const
+{
+    return d_current == d_end;
+}
+
+inline
+OnDemandValue OnDemandIterator::key() const
+{
+    BSLS_ASSERT(d_isObject);
+    BSLS_ASSERT(!atEnd());
+
+    return OnDemandValue(d_index_p, d_current);
+}
+
+inline
+int OnDemandIterator::status() const
+{
+    return d_status;
+}
+
+inline
+OnDemandValue OnDemandIterator::value() const
+{
+    BSLS_ASSERT(!atEnd());
+
+    return OnDemandValue(d_index_p, d_isObject ? d_current + 2 : d_current);
+}
+
+                            // --------------------
+                            // class OnDemandReader
+                            // --------------------
+
+// CREATORS
+inline
+OnDemandReader::OnDemandReader(bslma::Allocator *basicAllocator)
+: d_index(basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+void OnDemandReader::reset()
+{
+    d_index.reset();
+}
+
+// ACCESSORS
+inline
+const StructuralIndex& OnDemandReader::index() const
+{
+    return d_index;
+}
+
+inline
+const bsl::string_view& OnDemandReader::input() const
+{
+    return d_index.input();
+}
+
+inline
+OnDemandValue OnDemandReader::root() const
+{
+    BSLS_ASSERT(0 < d_index.numStructurals());
+
+    return OnDemandValue(&d_index, 0);
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *OnDemandReader::allocator() const
+{
+    return d_index.allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1309 @@
+// bdljsn_ondemandreader.t.cpp                                        -*-C++-*-
+#include <bdljsn_ondemandreader.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_readoptions.h>
+#include <bdljsn_writeoptions.h>
+#include <bdljsn_writestyle.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>   // 'bsl::size_t'
+#include <bsl_cstdlib.h>   // 'bsl::atoi'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a mechanism, 'bdljsn::OnDemandReader',
+// that indexes a JSON document, and two attribute-less cursors,
+// 'bdljsn::OnDemandValue' and 'bdljsn::OnDemandIterator', that navigate it.
+// We first test the validation performed by 'read', then the accessors of
+// 'OnDemandValue' on scalar values, then the navigation of arrays and objects
+// by 'at', 'find', and 'OnDemandIterator', including on malformed documents.
+// Finally, we verify that the values found by navigating pseudo-random
+// documents are those found by 'bdljsn::JsonUtil::read'.
+//
+// ----------------------------------------------------------------------------
+// OnDemandValue
+// [ 3] OnDemandValue();
+// [ 3] OnDemandValue(const StructuralIndex *index, bsl::size_t structural);
+// [ 3] int asBool(bool *result) const;
+// [ 3] int asDecimal64(bdldfp::Decimal64 *result) const;
+// [ 3] int asDouble(double *result) const;
+// [ 3] int asInt(int *result) const;
+// [ 3] int asInt64(bsls::Types::Int64 *result) const;
+// [ 3] int asUint64(bsls::Types::Uint64 *result) const;
+// [ 6] int asJson(Json *result) const;
+// [ 3] int asNumber(JsonNumber *result) const;
+// [ 3] int asString(bsl::string *result) const;
+// [ 3] int asStringView(bsl::string_view *result) const;
+// [ 4] int at(OnDemandValue *result, bsl::size_t index) const;
+// [ 4] int find(OnDemandValue *result, const bsl::string_view& name) const;
+// [ 3] bool isNull() const;
+// [ 3] Location location() const;
+// [ 3] bsl::size_t structural() const;
+// [ 3] bsl::string_view text() const;
+// [ 3] JsonType::Enum type() const;
+//
+// OnDemandIterator
+// [ 5] OnDemandIterator();
+// [ 5] explicit OnDemandIterator(const OnDemandValue& container);
+// [ 5] void advance();
+// [ 5] bool atEnd() const;
+// [ 5] OnDemandValue key() const;
+// [ 5] int status() const;
+// [ 5] OnDemandValue value() const;
+//
+// OnDemandReader
+// [ 2] explicit OnDemandReader(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~OnDemandReader();
+// [ 2] int read(const bsl::string_view& input);
+// [ 2] int read(const bsl::string_view& input, const ReadOptions& options);
+// [ 2] int read(Error *errorDescription, const bsl::string_view& input);
+// [ 2] int read(Error *, const bsl::string_view& input, const ReadOptions&);
+// [ 2] void reset();
+// [ 2] const StructuralIndex& index() const;
+// [ 2] const bsl::string_view& input() const;
+// [ 2] OnDemandValue root() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: Navigated values are those read by 'JsonUtil::read'.
+// [ 7] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                    NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS AND CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::OnDemandReader   Obj;
+typedef bdljsn::OnDemandValue    Value;
+typedef bdljsn::OnDemandIterator Iterator;
+typedef bdljsn::JsonType         JsonType;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::Uint64      Uint64;
+
+BSLA_MAYBE_UNUSED bool             verbose;
+BSLA_MAYBE_UNUSED bool         veryVerbose;
+BSLA_MAYBE_UNUSED bool     veryVeryVerbose;
+BSLA_MAYBE_UNUSED bool veryVeryVeryVerbose;
+
+namespace {
+
+unsigned nextRandom(unsigned *seed)
+    // Return a pseudo-random value, updating the specified 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 16;
+}
+
+void generateJson(bdljsn::Json *result, int depth, unsigned *seed)
+    // Load into the specified 'result' a pseudo-random JSON value nested at
+    // most the specified 'depth' levels, with the specified 'seed' as the
+    // state of the generator.
+{
+    static const char *const STRINGS[] = {
+        "", "a", "key", "a\"b", "back\\slash", "tab\there",
+        "\xc3\xa9t\xc3\xa9", "[{,:}]", "\x01",
+        "long string with spaces and punctuation, etc."
+    };
+    const int NUM_STRINGS = sizeof STRINGS / sizeof *STRINGS;
+
+    static const char *const NUMBERS[] = {
+        "0", "-1", "42", "1.5", "-2.5e-3", "1E10", "12345678901234567890"
+    };
+    const int NUM_NUMBERS = sizeof NUMBERS / sizeof *NUMBERS;
+
+    const unsigned kind = nextRandom(seed) % (0 < depth ? 7 : 5);
+
+    switch (kind) {
+      case 0: {
+        result->makeNull();
+      } break;
+      case 1: {
+        result->makeBoolean(nextRandom(seed) % 2);
+      } break;
+      case 2: {
+        result->makeNumber(bdljsn::JsonNumber(
+                                   NUMBERS[nextRandom(seed) % NUM_NUMBERS]));
+      } break;
+      case 3:
+      case 4: {
+        result->makeString(STRINGS[nextRandom(seed) % NUM_STRINGS]);
+      } break;
+      case 5: {
+        bdljsn::JsonArray& array = result->makeArray();
+        const unsigned     size  = nextRandom(seed) % 6;
+        for (unsigned i = 0; i < size; ++i) {
+            array.pushBack(bdljsn::Json());
+            generateJson(&array.back(), depth - 1, seed);
+        }
+      } break;
+      default: {
+        bdljsn::JsonObject& object = result->makeObject();
+        const unsigned      size   = nextRandom(seed) % 6;
+        for (unsigned i = 0; i < size; ++i) {
+            generateJson(&object[STRINGS[nextRandom(seed) % NUM_STRINGS]],
+                         depth - 1,
+                         seed);
+        }
+      } break;
+    }
+}
+
+bool isEqual(const Value& value, const bdljsn::Json& json)
+    // Return 'true' if the specified 'value', navigated on demand, has the
+    // same value as the specified 'json', and 'false' otherwise.
+{
+    if (value.type() != json.type()) {
+        return false;                                                 // RETURN
+    }
+
+    switch (json.type()) {
+      case JsonType::e_NULL: {
+        return value.isNull();                                        // RETURN
+      } break;
+      case JsonType::e_BOOLEAN: {
+        bool result;
+        return 0 == value.asBool(&result)                             // RETURN
+            && result == json.theBoolean();
+      } break;
+      case JsonType::e_NUMBER: {
+        bdljsn::JsonNumber result;
+        return 0 == value.asNumber(&result)                           // RETURN
+            && result == json.theNumber();
+      } break;
+      case JsonType::e_STRING: {
+        bsl::string result;
+        return 0 == value.asString(&result)                           // RETURN
+            && result == json.theString();
+      } break;
+      case JsonType::e_ARRAY: {
+        const bdljsn::JsonArray& array = json.theArray();
+
+        bsl::size_t i = 0;
+        Iterator    it(value);
+        for (; !it.atEnd(); it.advance(), ++i) {
+            Value element;
+            if (i >= array.size()
+             || !isEqual(it.value(), array[i])
+             || 0 != value.at(&element, i)
+             || element.structural() != it.value().structural()) {
+                return false;                                         // RETURN
+            }
+        }
+        Value element;
+        return 0 == it.status() && array.size() == i                  // RETURN
+            && 0 != value.at(&element, i);
+      } break;
+      case JsonType::e_OBJECT: {
+        const bdljsn::JsonObject& object = json.theObject();
+
+        bsl::size_t i = 0;
+        Iterator    it(value);
+        for (; !it.atEnd(); it.advance(), ++i) {
+            bsl::string name;
+            Value       member;
+            if (0 != it.key().asString(&name)
+             || !object.contains(name)
+             || !isEqual(it.value(), object[name])
+             || 0 != value.find(&member, name)
+             || member.structural() != it.value().structural()) {
+                return false;                                         // RETURN
+            }
+        }
+        return 0 == it.status() && object.size() == i;                // RETURN
+      } break;
+    }
+    return false;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Few Fields of a Large Message
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive market data messages, of which we only need the
+// symbol, the last trade price, and the size of each of the levels of the
+// book.
+//
+// First, we define a message (which, in practice, would have many more
+// fields):
+//..
+    const char *MESSAGE = "{\n"
+                          "  \"header\": {\"seq\": 1234, \"source\": \"X\"},\n"
+                          "  \"symbol\": \"IBM\",\n"
+                          "  \"book\": [\n"
+                          "    {\"price\": 134.1, \"size\": 200},\n"
+                          "    {\"price\": 134.2, \"size\": 500}\n"
+                          "  ],\n"
+                          "  \"last\": 134.15\n"
+                          "}";
+//..
+// Then, we index the message:
+//..
+    bdljsn::OnDemandReader reader;
+    int rc = reader.read(MESSAGE);
+    ASSERT(0 == rc);
+
+    const bdljsn::OnDemandValue root = reader.root();
+    ASSERT(bdljsn::JsonType::e_OBJECT == root.type());
+//..
+// Next, we find the symbol and the last price, skipping over the header and
+// the book.  Note that the symbol is a 'bsl::string_view' referring into
+// 'MESSAGE':
+//..
+    bdljsn::OnDemandValue symbol;
+    bdljsn::OnDemandValue last;
+    rc = root.find(&symbol, "symbol");
+    ASSERT(0 == rc);
+    rc = root.find(&last, "last");
+    ASSERT(0 == rc);
+
+    bsl::string_view symbolText;
+    double           lastPrice;
+    rc = symbol.asStringView(&symbolText);
+    ASSERT(0 == rc);
+    rc = last.asDouble(&lastPrice);
+    ASSERT(0 == rc);
+
+    ASSERT("IBM"  == symbolText);
+    ASSERT(134.15 == lastPrice);
+//..
+// Then, we iterate over the levels of the book:
+//..
+    bdljsn::OnDemandValue book;
+    rc = root.find(&book, "book");
+    ASSERT(0 == rc);
+
+    bsls::Types::Int64       totalSize = 0;
+    bdljsn::OnDemandIterator it(book);
+    for (; !it.atEnd(); it.advance()) {
+        bdljsn::OnDemandValue size;
+        bsls::Types::Int64    value;
+
+        rc = it.value().find(&size, "size");
+        ASSERT(0 == rc);
+        rc = size.asInt64(&value);
+        ASSERT(0 == rc);
+
+        totalSize += value;
+    }
+    ASSERT(0   == it.status());
+    ASSERT(700 == totalSize);
+//..
+// Finally, we observe that a missing field is reported as such, and that the
+// header can be materialized as a 'bdljsn::Json' object if needed:
+//..
+    bdljsn::OnDemandValue missing;
+    rc = root.find(&missing, "bid");
+    ASSERT(0 != rc);
+
+    bdljsn::OnDemandValue header;
+    rc = root.find(&header, "header");
+    ASSERT(0 == rc);
+
+    bdljsn::Json json;
+    rc = header.asJson(&json);
+    ASSERT(0 == rc);
+
+    int seq;
+    rc = json["seq"].asInt(&seq);
+    ASSERT(0    == rc);
+    ASSERT(1234 == seq);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONSISTENCY WITH 'JsonUtil::read'
+        //
+        // Concerns:
+        //: 1 The values found by navigating a document on demand, and their
+        //:   decoded values, are those found by 'bdljsn::JsonUtil::read'.
+        //:
+        //: 2 'asJson' materializes a value, including a nested array or
+        //:   object, as 'bdljsn::JsonUtil::read' does.
+        //:
+        //: 3 The document format (i.e., white space) does not matter.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random 'bdljsn::Json' documents having strings
+        //:   that require escaping, write them in each 'WriteStyle', read
+        //:   them on demand, and compare, recursively, the values found by
+        //:   iteration, 'at', and 'find' with the generated document.  Also
+        //:   compare the result of 'asJson' on the root.  (C-1..3)
+        //
+        // Testing:
+        //   int asJson(Json *result) const;
+        //   CONCERN: Navigated values are those read by 'JsonUtil::read'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSISTENCY WITH 'JsonUtil::read'" << endl
+                          << "=================================" << endl;
+
+        static const bdljsn::WriteStyle::Enum STYLES[] = {
+            bdljsn::WriteStyle::e_COMPACT,
+            bdljsn::WriteStyle::e_ONELINE,
+            bdljsn::WriteStyle::e_PRETTY
+        };
+        const int NUM_STYLES = sizeof STYLES / sizeof *STYLES;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        unsigned seed = 1;
+
+        for (int ti = 0; ti < 500; ++ti) {
+            bdljsn::Json document;
+            generateJson(&document, ti % 6, &seed);
+
+            for (int tj = 0; tj < NUM_STYLES; ++tj) {
+                bdljsn::WriteOptions options;
+                options.setStyle(STYLES[tj]);
+
+                bsl::string text;
+                ASSERTV(ti, 0 == bdljsn::JsonUtil::write(&text,
+                                                         document,
+                                                         options));
+
+                if (veryVeryVerbose) { T_ P(text) }
+
+                ASSERTV(ti, tj, text, 0 == mX.read(text));
+                ASSERTV(ti, tj, text, isEqual(X.root(), document));
+
+                bdljsn::Json json;
+                ASSERTV(ti, tj, 0 == X.root().asJson(&json));
+                ASSERTV(ti, tj, text, document == json);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'OnDemandIterator'
+        //
+        // Concerns:
+        //: 1 An iterator over an array visits each element in order; an
+        //:   iterator over an object visits each member, providing its name
+        //:   and value, in order.
+        //:
+        //: 2 An iterator over an empty array or object, or a default
+        //:   constructed iterator, is at the end with a zero status.
+        //:
+        //: 3 An iterator over a value that is neither an array nor an object
+        //:   is at the end with a non-zero status.
+        //:
+        //: 4 Iteration ends with a non-zero status at the first malformed
+        //:   element (e.g., a missing or extra comma, or a member lacking a
+        //:   name or value), having visited the elements preceding it.
+        //:
+        //: 5 Precondition violations are detected in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, iterate over arrays and
+        //:   objects, well-formed and malformed, and compare the text of the
+        //:   elements visited, and the final status, with the expected
+        //:   ones.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid calls.  (C-5)
+        //
+        // Testing:
+        //   OnDemandIterator();
+        //   explicit OnDemandIterator(const OnDemandValue& container);
+        //   void advance();
+        //   bool atEnd() const;
+        //   OnDemandValue key() const;
+        //   int status() const;
+        //   OnDemandValue value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'OnDemandIterator'" << endl
+                          << "==================" << endl;
+
+        {
+            const Iterator X;
+
+            ASSERT(X.atEnd());
+            ASSERT(0 == X.status());
+        }
+
+        // 'EXPECTED' lists the text of each element visited, or the name and
+        // text of the value of each member visited, separated by '|'.
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            const char *d_expected_p;
+            bool        d_isValid;
+        } DATA[] = {
+            //LINE TEXT                          EXPECTED              VALID
+            //---- ---------------------------   --------------------  -----
+            { L_,  "[]",                         "",                   true  },
+            { L_,  "[ ]",                        "",                   true  },
+            { L_,  "{}",                         "",                   true  },
+            { L_,  "[1]",                        "1|",                 true  },
+            { L_,  "[1, \"a\", [2, 3], {}]",     "1|\"a\"|[2, 3]|{}|", true  },
+            { L_,  "[[[]],[]]",                  "[[]]|[]|",           true  },
+            { L_,  "{\"a\": 1}",                 "\"a\"1|",            true  },
+            { L_,  "{\"a\":[1],\"b\":{\"c\":2}}",
+                                      "\"a\"[1]|\"b\"{\"c\":2}|",      true  },
+            { L_,  "1",                          "",                   false },
+            { L_,  "\"a\"",                      "",                   false },
+            { L_,  "[,]",                        "",                   false },
+            { L_,  "[,1]",                       "",                   false },
+            { L_,  "[1,]",                       "1|",                 false },
+            { L_,  "[1,,2]",                     "1|",                 false },
+            { L_,  "[1 2]",                      "1|",                 false },
+            { L_,  "[1, 2 3, 4]",                "1|2|",               false },
+            { L_,  "[[1] [2]]",                  "[1]|",               false },
+            { L_,  "[1 :2]",                     "1|",                 false },
+            { L_,  "{1: 2}",                     "",                   false },
+            { L_,  "{\"a\"}",                    "",                   false },
+            { L_,  "{\"a\":}",                   "",                   false },
+            { L_,  "{\"a\" 1}",                  "",                   false },
+            { L_,  "{\"a\":1,}",                 "\"a\"1|",            false },
+            { L_,  "{\"a\":1 \"b\":2}",          "\"a\"1|",            false },
+            { L_,  "{\"a\":1, 2}",               "\"a\"1|",            false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mR(&oa);  const Obj& R = mR;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const TEXT     = DATA[ti].d_text_p;
+            const char *const EXPECTED = DATA[ti].d_expected_p;
+            const bool        IS_VALID = DATA[ti].d_isValid;
+
+            if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+            ASSERTV(LINE, 0 == mR.read(TEXT));
+
+            const Value ROOT = R.root();
+
+            bsl::string visited;
+            Iterator    mX(ROOT);  const Iterator& X = mX;
+            for (; !X.atEnd(); mX.advance()) {
+                if (JsonType::e_OBJECT == ROOT.type()) {
+                    visited.append(X.key().text());
+                }
+                visited.append(X.value().text());
+                visited.push_back('|');
+            }
+
+            ASSERTV(LINE, EXPECTED, visited, EXPECTED == visited);
+            ASSERTV(LINE, X.status(), IS_VALID == (0 == X.status()));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT(0 == mR.read("[1, {\"a\": 2}]"));
+
+            Iterator mX(R.root());
+
+            ASSERT_PASS(mX.value());
+            ASSERT_FAIL(mX.key());
+            mX.advance();
+
+            Iterator mY(mX.value());
+
+            ASSERT_PASS(mY.key());
+            ASSERT_PASS(mY.value());
+            mY.advance();
+
+            ASSERT_FAIL(mY.key());
+            ASSERT_FAIL(mY.value());
+            ASSERT_FAIL(mY.advance());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'at' AND 'find'
+        //
+        // Concerns:
+        //: 1 'at' loads the element of an array having the specified index,
+        //:   and fails for a value that is not an array, and for an index
+        //:   that is out of range.
+        //:
+        //: 2 'find' loads the value of the first member of an object having
+        //:   the specified name, comparing it with the decoded name of each
+        //:   member, and fails for a value that is not an object, and for a
+        //:   missing name.
+        //:
+        //: 3 Both fail if the part of the array or object preceding the
+        //:   value sought is malformed, and succeed if only the part
+        //:   following it is.
+        //:
+        //: 4 'result' is not modified on failure.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, call 'at' and 'find' on
+        //:   tabulated documents and compare the text of the value found
+        //:   with the expected one, or, on failure, verify that 'result' is
+        //:   unchanged.  (C-1..4)
+        //
+        // Testing:
+        //   int at(OnDemandValue *result, bsl::size_t index) const;
+        //   int find(OnDemandValue *result, const bsl::string_view& nm) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'at' AND 'find'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tTesting 'at'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_text_p;
+                bsl::size_t d_index;
+                const char *d_expected_p;  // 0 if 'at' fails
+            } DATA[] = {
+                //LINE TEXT                          INDEX  EXPECTED
+                //---- ----------------------------  -----  ---------
+                { L_,  "[1, 2, 3]",                      0, "1"       },
+                { L_,  "[1, 2, 3]",                      2, "3"       },
+                { L_,  "[1, 2, 3]",                      3, 0         },
+                { L_,  "[]",                             0, 0         },
+                { L_,  "[[1, [2]], {\"a\": [3]}, 4]",    1, "{\"a\": [3]}" },
+                { L_,  "[[1, [2]], {\"a\": [3]}, 4]",    2, "4"       },
+                { L_,  "[\"]\", \"[\", 5]",              2, "5"       },
+                { L_,  "{\"a\": 1}",                     0, 0         },
+                { L_,  "1",                              0, 0         },
+                { L_,  "[1 2, 3]",                       1, 0         },
+                { L_,  "[1, 2 3]",                       0, "1"       },
+                { L_,  "[1, 2 3]",                       1, "2"       },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const TEXT     = DATA[ti].d_text_p;
+                const bsl::size_t INDEX    = DATA[ti].d_index;
+                const char *const EXPECTED = DATA[ti].d_expected_p;
+
+                if (veryVerbose) { T_ P_(LINE) P_(TEXT) P(INDEX) }
+
+                ASSERTV(LINE, 0 == mX.read(TEXT));
+
+                Value     result = X.root();
+                const int rc     = X.root().at(&result, INDEX);
+
+                if (EXPECTED) {
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, EXPECTED, result.text(),
+                            EXPECTED == result.text());
+                }
+                else {
+                    ASSERTV(LINE, rc, 0 != rc);
+                    ASSERTV(LINE,
+                            X.root().structural() == result.structural());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'find'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_text_p;
+                const char *d_name_p;
+                const char *d_expected_p;  // 0 if 'find' fails
+            } DATA[] = {
+                //LINE TEXT                              NAME     EXPECTED
+                //---- --------------------------------  -------  ---------
+                { L_,  "{\"a\": 1, \"b\": 2}",           "a",     "1"     },
+                { L_,  "{\"a\": 1, \"b\": 2}",           "b",     "2"     },
+                { L_,  "{\"a\": 1, \"b\": 2}",           "c",     0       },
+                { L_,  "{\"a\": 1, \"b\": 2}",           "",      0       },
+                { L_,  "{\"\": 1}",                      "",      "1"     },
+                { L_,  "{}",                             "a",     0       },
+                { L_,  "{\"a\": 1, \"a\": 2}",           "a",     "1"     },
+                { L_,  "{\"a\": {\"b\": 1}, \"b\": 2}",  "b",     "2"     },
+                { L_,  "{\"x\": [\"b\"], \"b\": true}",  "b",     "true"  },
+                { L_,  "{\"a\\\"b\": 1}",                "a\"b",  "1"     },
+                { L_,  "{\"\\u0041\": null}",            "A",     "null"  },
+                { L_,  "{\"\\u0041\": null}",            "\\u0041", 0     },
+                { L_,  "{\"\\q\": 1, \"a\": 2}",         "a",     0       },
+                { L_,  "[\"a\", 1]",                     "a",     0       },
+                { L_,  "\"a\"",                          "a",     0       },
+                { L_,  "{\"a\" 1, \"b\": 2}",            "b",     0       },
+                { L_,  "{\"a\": 1, \"b\": 2 \"c\": 3}",  "b",     "2"     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const TEXT     = DATA[ti].d_text_p;
+                const char *const NAME     = DATA[ti].d_name_p;
+                const char *const EXPECTED = DATA[ti].d_expected_p;
+
+                if (veryVerbose) { T_ P_(LINE) P_(TEXT) P(NAME) }
+
+                ASSERTV(LINE, 0 == mX.read(TEXT));
+
+                Value     result = X.root();
+                const int rc     = X.root().find(&result, NAME);
+
+                if (EXPECTED) {
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, EXPECTED, result.text(),
+                            EXPECTED == result.text());
+                }
+                else {
+                    ASSERTV(LINE, rc, 0 != rc);
+                    ASSERTV(LINE,
+                            X.root().structural() == result.structural());
+                }
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'OnDemandValue' SCALAR ACCESSORS
+        //
+        // Concerns:
+        //: 1 'type' reflects the first character of a value, and 'text'
+        //:   returns the text of the value, excluding surrounding white
+        //:   space, for scalars, arrays, and objects.
+        //:
+        //: 2 'location' and 'structural' return the offset of the value in
+        //:   the document and its index in the structural index.
+        //:
+        //: 3 Each conversion succeeds exactly for the values of the
+        //:   corresponding type, loading the expected result, and leaves
+        //:   'result' unchanged on failure.
+        //:
+        //: 4 'asStringView' refers into the document, and fails for strings
+        //:   having escape sequences, which 'asString' decodes.
+        //:
+        //: 5 A malformed scalar (e.g., '1"a"' or '01') is reported by the
+        //:   conversions as an error.
+        //
+        // Plan:
+        //: 1 Read a document consisting of an array of tabulated scalar
+        //:   texts, and verify the accessors of each element.  (C-1..5)
+        //
+        // Testing:
+        //   OnDemandValue();
+        //   OnDemandValue(const StructuralIndex *index, bsl::size_t s);
+        //   int asBool(bool *result) const;
+        //   int asDecimal64(bdldfp::Decimal64 *result) const;
+        //   int asDouble(double *result) const;
+        //   int asInt(int *result) const;
+        //   int asInt64(bsls::Types::Int64 *result) const;
+        //   int asUint64(bsls::Types::Uint64 *result) const;
+        //   int asNumber(JsonNumber *result) const;
+        //   int asString(bsl::string *result) const;
+        //   int asStringView(bsl::string_view *result) const;
+        //   bool isNull() const;
+        //   Location location() const;
+        //   bsl::size_t structural() const;
+        //   bsl::string_view text() const;
+        //   JsonType::Enum type() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'OnDemandValue' SCALAR ACCESSORS" << endl
+                          << "================================" << endl;
+
+        const JsonType::Enum NUL = JsonType::e_NULL;
+        const JsonType::Enum BOO = JsonType::e_BOOLEAN;
+        const JsonType::Enum NUM = JsonType::e_NUMBER;
+        const JsonType::Enum STR = JsonType::e_STRING;
+        const JsonType::Enum ARR = JsonType::e_ARRAY;
+        const JsonType::Enum OBJ = JsonType::e_OBJECT;
+
+        const int OK  = 0;
+        const int NOP = 99;  // not a number, i.e., any non-zero value
+        const int OVR = bdljsn::NumberUtil::k_OVERFLOW;
+        const int UND = bdljsn::NumberUtil::k_UNDERFLOW;
+        const int NIN = bdljsn::NumberUtil::k_NOT_INTEGRAL;
+
+        static const struct {
+            int             d_line;
+            const char     *d_text_p;
+            JsonType::Enum  d_type;
+            int             d_intRc;     // 'asInt' and 'asInt64'
+            Int64           d_int;
+            int             d_uintRc;    // 'asUint64'
+            const char     *d_string_p;  // decoded, 0 if not a string
+            bool            d_hasView;   // 'asStringView' succeeds
+        } DATA[] = {
+            //LINE TEXT                TYPE INTRC INT  UINTRC STRING   VIEW
+            //---- ------------------  ---- ----- ---- ------ -------  -----
+            { L_,  "null",             NUL, NOP,  0,   NOP,   0,       false },
+            { L_,  "true",             BOO, NOP,  0,   NOP,   0,       false },
+            { L_,  "false",            BOO, NOP,  0,   NOP,   0,       false },
+            { L_,  "0",                NUM, OK,   0,   OK,    0,       false },
+            { L_,  "-17",              NUM, OK,   -17, UND,   0,       false },
+            { L_,  "1e2",              NUM, OK,   100, OK,    0,       false },
+            { L_,  "1.5",              NUM, NIN,  1,   NIN,   0,       false },
+            { L_,  "99999999999999999999",
+                                       NUM, OVR,  0,   OVR,   0,       false },
+            { L_,  "01",               NUM, NOP,  0,   NOP,   0,       false },
+            { L_,  "1\"a\"",           NUM, NOP,  0,   NOP,   0,       false },
+            { L_,  "nul",              NUL, NOP,  0,   NOP,   0,       false },
+            { L_,  "truex",            BOO, NOP,  0,   NOP,   0,       false },
+            { L_,  "\"\"",             STR, NOP,  0,   NOP,   "",      true  },
+            { L_,  "\"abc\"",          STR, NOP,  0,   NOP,   "abc",   true  },
+            { L_,  "\"1\"",            STR, NOP,  0,   NOP,   "1",     true  },
+            { L_,  "\"[{,:}]\"",       STR, NOP,  0,   NOP,   "[{,:}]", true },
+            { L_,  "\"a\\\"b\"",       STR, NOP,  0,   NOP,   "a\"b",  false },
+            { L_,  "\"\\u00e9\"",      STR, NOP,  0,   NOP,   "\xc3\xa9",
+                                                                       false },
+            { L_,  "\"\xc3\xa9\"",     STR, NOP,  0,   NOP,   "\xc3\xa9",
+                                                                       true  },
+            { L_,  "\"\\x\"",          STR, NOP,  0,   NOP,   0,       false },
+            { L_,  "[1, 2]",           ARR, NOP,  0,   NOP,   0,       false },
+            { L_,  "{\"a\": [1]}",     OBJ, NOP,  0,   NOP,   0,       false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        {
+            const Value X;  (void)X;
+        }
+
+        bsl::string document = "[";
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            document += 0 == ti ? " " : " ,\n  ";
+            document += DATA[ti].d_text_p;
+        }
+        document += " ]";
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mR(&oa);  const Obj& R = mR;
+
+        ASSERT(0 == mR.read(document));
+
+        bsl::size_t offset = 2;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int              LINE     = DATA[ti].d_line;
+            const bsl::string_view TEXT     = DATA[ti].d_text_p;
+            const JsonType::Enum   TYPE     = DATA[ti].d_type;
+            const int              INT_RC   = DATA[ti].d_intRc;
+            const Int64            INT      = DATA[ti].d_int;
+            const int              UINT_RC  = DATA[ti].d_uintRc;
+            const char *const      STRING   = DATA[ti].d_string_p;
+            const bool             HAS_VIEW = DATA[ti].d_hasView;
+
+            if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+            Value mX;  const Value& X = mX;
+            ASSERTV(LINE, 0 == R.root().at(&mX, ti));
+
+            ASSERTV(LINE, TYPE, X.type(), TYPE == X.type());
+            ASSERTV(LINE, TEXT, X.text(), TEXT == X.text());
+            ASSERTV(LINE, offset, X.location().offset(),
+                    offset == X.location().offset());
+            ASSERTV(LINE, offset == R.index().position(X.structural()));
+            ASSERTV(LINE, X.structural() ==
+                          Value(&R.index(), X.structural()).structural());
+
+            offset += TEXT.length() + 5;
+
+            ASSERTV(LINE, ("null" == TEXT) == X.isNull());
+
+            bool boolean = false;
+            ASSERTV(LINE, ("true" == TEXT || "false" == TEXT) ==
+                                                   (0 == X.asBool(&boolean)));
+            ASSERTV(LINE, ("true" == TEXT) == boolean);
+
+            const bool IS_NUMBER = bdljsn::NumberUtil::isValidNumber(TEXT);
+
+            int    i   = -1;
+            Int64  i64 = -1;
+            Uint64 u64 = 99;
+
+            int rc = X.asInt(&i);
+            ASSERTV(LINE, IS_NUMBER == (NOP != INT_RC));
+            ASSERTV(LINE, INT_RC, rc, NOP == INT_RC ? 0 != rc
+                                                  : INT_RC == rc);
+            if (OK == rc || NIN == rc) {
+                ASSERTV(LINE, i, INT == i);
+            }
+            else if (!IS_NUMBER) {
+                ASSERTV(LINE, i, -1 == i);
+            }
+
+            rc = X.asInt64(&i64);
+            ASSERTV(LINE, IS_NUMBER == (NOP != INT_RC));
+            ASSERTV(LINE, INT_RC, rc, NOP == INT_RC ? 0 != rc
+                                                  : INT_RC == rc);
+            if (OK == rc || NIN == rc) {
+                ASSERTV(LINE, i64, INT == i64);
+            }
+            else if (!IS_NUMBER) {
+                ASSERTV(LINE, i64, -1 == i64);
+            }
+
+            rc = X.asUint64(&u64);
+            ASSERTV(LINE, IS_NUMBER == (NOP != UINT_RC));
+            ASSERTV(LINE, UINT_RC, rc, NOP == UINT_RC ? 0 != rc
+                                                    : UINT_RC == rc);
+            if (OK == rc) {
+                ASSERTV(LINE, u64, static_cast<Uint64>(INT) == u64);
+            }
+            else if (!IS_NUMBER) {
+                ASSERTV(LINE, u64, 99 == u64);
+            }
+
+            double             d = -1;
+            bdldfp::Decimal64  d64(-1);
+            bdljsn::JsonNumber number("-1");
+
+            ASSERTV(LINE, IS_NUMBER == (0 == X.asDouble(&d)));
+            ASSERTV(LINE, IS_NUMBER == (0 == X.asDecimal64(&d64)));
+            ASSERTV(LINE, IS_NUMBER == (0 == X.asNumber(&number)));
+            if (IS_NUMBER) {
+                ASSERTV(LINE, bdljsn::NumberUtil::asDouble(TEXT) == d);
+                ASSERTV(LINE, bdljsn::NumberUtil::asDecimal64(TEXT) == d64);
+                ASSERTV(LINE, TEXT == number.value());
+            }
+            else {
+                ASSERTV(LINE, -1 == d);
+                ASSERTV(LINE, bdldfp::Decimal64(-1) == d64);
+                ASSERTV(LINE, "-1" == number.value());
+            }
+
+            bsl::string      string("unchanged");
+            bsl::string_view view("unchanged");
+
+            rc = X.asString(&string);
+            ASSERTV(LINE, rc, (0 != STRING) == (0 == rc));
+            if (STRING) {
+                ASSERTV(LINE, STRING, string, STRING == string);
+            }
+            else if (STR != TYPE) {
+                ASSERTV(LINE, string, "unchanged" == string);
+            }
+
+            rc = X.asStringView(&view);
+            ASSERTV(LINE, rc, HAS_VIEW == (0 == rc));
+            if (HAS_VIEW) {
+                ASSERTV(LINE, STRING == view);
+                ASSERTV(LINE, X.text().data() + 1 == view.data());
+            }
+            else {
+                ASSERTV(LINE, "unchanged" == view);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'OnDemandReader'
+        //
+        // Concerns:
+        //: 1 'read' succeeds for a document consisting of a single value,
+        //:   surrounded by optional white space, and 'root' refers to that
+        //:   value.
+        //:
+        //: 2 'read' fails for a document that is empty, that does not begin
+        //:   with a value, that exceeds the maximum nesting depth, that has
+        //:   text after the value (unless allowed by the options), or for
+        //:   which the structural index cannot be built, loading the
+        //:   expected error description.
+        //:
+        //: 3 A reader having failed to read a document, or having been reset,
+        //:   has no document, and can read another document.
+        //:
+        //: 4 'read' does not verify the parts of the document that are not
+        //:   examined (e.g., malformed scalars, or missing separators).
+        //:
+        //: 5 Memory is supplied by the object allocator only.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, read tabulated documents with
+        //:   tabulated options, through each overload of 'read', and verify
+        //:   the result, the error description, and the state of the
+        //:   reader.  (C-1..4)
+        //:
+        //: 2 Install a test allocator as the default allocator and verify
+        //:   that it is not used.  (C-5)
+        //
+        // Testing:
+        //   explicit OnDemandReader(bslma::Allocator *basicAllocator = 0);
+        //   ~OnDemandReader();
+        //   int read(const bsl::string_view& input);
+        //   int read(const bsl::string_view& input, const ReadOptions& o);
+        //   int read(Error *errorDescription, const bsl::string_view& input);
+        //   int read(Error *, const bsl::string_view&, const ReadOptions&);
+        //   void reset();
+        //   const StructuralIndex& index() const;
+        //   const bsl::string_view& input() const;
+        //   OnDemandValue root() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'OnDemandReader'" << endl
+                          << "================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            int         d_maxDepth;       // 0 for the default
+            bool        d_allowTrailing;
+            const char *d_root_p;         // 0 if 'read' fails
+            bsl::size_t d_offset;         // of the error
+            const char *d_message_p;      // of the error
+        } DATA[] = {
+            //LINE TEXT            DEPTH TRAIL  ROOT       OFF MESSAGE
+            //---- --------------  ----- -----  ---------  --- -------
+            { L_,  "1",             0,   false, "1",         0, ""       },
+            { L_,  "  true \n",     0,   false, "true",      0, ""       },
+            { L_,  "\"a b\"",       0,   false, "\"a b\"",   0, ""       },
+            { L_,  " [1, 2] ",      0,   false, "[1, 2]",    0, ""       },
+            { L_,  "{\"a\":{}}",    0,   false, "{\"a\":{}}",0, ""       },
+            { L_,  "01",            0,   false, "01",        0, ""       },
+            { L_,  "[1 2]",         0,   false, "[1 2]",     0, ""       },
+            { L_,  "[[[]]]",        3,   false, "[[[]]]",    0, ""       },
+            { L_,  "1 2",           0,   true,  "1",         0, ""       },
+            { L_,  "[] []",         0,   true,  "[]",        0, ""       },
+            { L_,  "",              0,   false, 0,           0,
+                                               "Unexpected end of input" },
+            { L_,  "   ",           0,   false, 0,           3,
+                                               "Unexpected end of input" },
+            { L_,  ",1",            0,   false, 0,           0,
+                                          "Unexpected initial character" },
+            { L_,  " :",            0,   false, 0,           1,
+                                          "Unexpected initial character" },
+            { L_,  "]",             0,   false, 0,           0,
+                                                  "Unexpected character" },
+            { L_,  "[[[]]]",        2,   false, 0,           2,
+                                        "Maximum nesting depth exceeded" },
+            { L_,  "[[], [{}]]",    2,   false, 0,           6,
+                                        "Maximum nesting depth exceeded" },
+            { L_,  "1 2",           0,   false, 0,           2,
+                                  "Additional text found after document" },
+            { L_,  "[] ,",          0,   false, 0,           3,
+                                  "Additional text found after document" },
+            { L_,  "\"abc",         0,   false, 0,           4,
+                                                   "Unterminated string" },
+            { L_,  "\"\xff\"",      0,   false, 0,           1,
+                                                  "Invalid UTF-8 string" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(&oa == X.allocator());
+        ASSERT(&oa == X.index().allocator());
+        ASSERT(X.input().empty());
+        ASSERT(0 == X.index().numStructurals());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = DATA[ti].d_line;
+            const char *const TEXT      = DATA[ti].d_text_p;
+            const int         MAX_DEPTH = DATA[ti].d_maxDepth;
+            const bool        TRAILING  = DATA[ti].d_allowTrailing;
+            const char *const ROOT      = DATA[ti].d_root_p;
+            const bsl::size_t OFFSET    = DATA[ti].d_offset;
+            const char *const MESSAGE   = DATA[ti].d_message_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+            bdljsn::ReadOptions options;
+            options.setAllowTrailingText(TRAILING);
+            if (MAX_DEPTH) {
+                options.setMaxNestedDepth(MAX_DEPTH);
+            }
+            const bool DEFAULT_OPTIONS = 0 == MAX_DEPTH && !TRAILING;
+
+            for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+                const char CONFIG = cfg;
+
+                if (!DEFAULT_OPTIONS && ('a' == CONFIG || 'c' == CONFIG)) {
+                    continue;
+                }
+
+                bdljsn::Error error(&oa);
+
+                int rc;
+                switch (CONFIG) {
+                  case 'a': rc = mX.read(TEXT);                    break;
+                  case 'b': rc = mX.read(TEXT, options);           break;
+                  case 'c': rc = mX.read(&error, TEXT);            break;
+                  default:  rc = mX.read(&error, TEXT, options);   break;
+                }
+
+                if (ROOT) {
+                    ASSERTV(LINE, CONFIG, rc, 0 == rc);
+                    ASSERTV(LINE, CONFIG, TEXT == X.input().data());
+                    ASSERTV(LINE, CONFIG, ROOT, X.root().text(),
+                            ROOT == X.root().text());
+                    ASSERTV(LINE, CONFIG, 0 == X.root().structural());
+                    ASSERTV(LINE, CONFIG, bdljsn::Error() == error);
+                }
+                else {
+                    ASSERTV(LINE, CONFIG, rc, 0 != rc);
+                    ASSERTV(LINE, CONFIG, X.input().empty());
+                    ASSERTV(LINE, CONFIG, 0 == X.index().numStructurals());
+
+                    if ('c' <= CONFIG) {
+                        ASSERTV(LINE, CONFIG, error.message(),
+                                MESSAGE == error.message());
+                        ASSERTV(LINE, CONFIG, error.location().offset(),
+                                OFFSET == error.location().offset());
+                    }
+                }
+            }
+        }
+
+        ASSERT(0 == mX.read("[1]"));
+        ASSERT(3 == X.index().numStructurals());
+
+        mX.reset();
+
+        ASSERT(X.input().empty());
+        ASSERT(0 == X.index().numStructurals());
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Read a small document, and access its values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char TEXT[] = "{\"id\": 7, \"tags\": [\"x\", \"y\\n\"], "
+                            "\"ok\": true, \"none\": null}";
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.read(TEXT));
+
+        const Value ROOT = X.root();
+        ASSERT(JsonType::e_OBJECT == ROOT.type());
+        ASSERT(TEXT               == ROOT.text());
+
+        Value value;
+        int   id;
+        ASSERT(0 == ROOT.find(&value, "id"));
+        ASSERT(0 == value.asInt(&id));
+        ASSERT(7 == id);
+
+        Value            tags;
+        bsl::string_view x;
+        bsl::string      y;
+        ASSERT(0   == ROOT.find(&tags, "tags"));
+        ASSERT(0   == tags.at(&value, 0));
+        ASSERT(0   == value.asStringView(&x));
+        ASSERT("x" == x);
+        ASSERT(0   == tags.at(&value, 1));
+        ASSERT(0   != value.asStringView(&x));
+        ASSERT(0   == value.asString(&y));
+        ASSERT("y\n" == y);
+        ASSERT(0   != tags.at(&value, 2));
+
+        bool ok = false;
+        ASSERT(0 == ROOT.find(&value, "ok"));
+        ASSERT(0 == value.asBool(&ok));
+        ASSERT(ok);
+
+        ASSERT(0 == ROOT.find(&value, "none"));
+        ASSERT(value.isNull());
+
+        int      count = 0;
+        Iterator it(ROOT);
+        for (; !it.atEnd(); it.advance()) {
+            ++count;
+        }
+        ASSERT(0 == it.status());
+        ASSERT(4 == count);
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
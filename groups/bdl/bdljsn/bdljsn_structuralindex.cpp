@@ -0,0 +1,397 @@
+// bdljsn_structuralindex.cpp                                         -*-C++-*-
+#include <bdljsn_structuralindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_structuralindex_cpp,"$Id$ $CSID$")
+
+#include <bdljsn_error.h>
+#include <bdljsn_location.h>
+
+#include <bdlb_bitutil.h>
+#include <bdlde_utf8util.h>
+
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The text is processed in blocks of 64 characters, each character of a block
+// corresponding to a bit of a 64-bit mask.  A block is first classified into
+// masks of backslashes, quotes, white space, operators ('[', ']', '{', '}',
+// ':', and ','), and control characters.  Then, for each block:
+//
+//: 1 The characters escaped by a backslash are those following an odd-length
+//:   sequence of backslashes, which are found with a carry-propagating
+//:   subtraction (the last backslash of a block may escape the first
+//:   character of the next one).
+//:
+//: 2 The unescaped quotes delimit strings: the prefix XOR of their mask
+//:   (i.e., bit 'i' of the result is the parity of the quotes at or before
+//:   'i') has a bit set for each character of a string from its opening quote
+//:   up to, but excluding, its closing quote.
+//:
+//: 3 A scalar value starts at a character that is neither white space nor an
+//:   operator, and that does not follow such a character (other than a
+//:   quote).
+//:
+//: 4 The structural characters are the operators and the scalar starts that
+//:   are not within a string.
+//
+// The positions of the set bits of the resulting mask are appended to the
+// index, and a second, scalar pass over the index (which is much smaller than
+// the text) matches brackets and braces.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+enum { k_BLOCK_SIZE = 64 };
+
+const bsl::uint64_t k_ODD_BITS = 0xAAAAAAAAAAAAAAAAULL;
+
+struct BlockMasks {
+    // This 'struct' holds the classification of the characters of a block of
+    // 64 characters, bit 'i' of each mask corresponding to character 'i'.
+
+    // PUBLIC DATA
+    bsl::uint64_t d_backslash;   // '\'
+    bsl::uint64_t d_quote;       // '"'
+    bsl::uint64_t d_whitespace;  // ' ', '\t', '\n', and '\r'
+    bsl::uint64_t d_operator;    // '[', ']', '{', '}', ':', and ','
+    bsl::uint64_t d_control;     // characters less than 0x20
+};
+
+inline
+void classify(BlockMasks *result, const char *block)
+    // Load into the specified 'result' the classification of the 64
+    // characters at the specified 'block'.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i backslash  = _mm_set1_epi8('\\');
+    const __m128i quote      = _mm_set1_epi8('"');
+    const __m128i space      = _mm_set1_epi8(' ');
+    const __m128i tab        = _mm_set1_epi8('\t');
+    const __m128i newline    = _mm_set1_epi8('\n');
+    const __m128i cr         = _mm_set1_epi8('\r');
+    const __m128i bit5       = _mm_set1_epi8(0x20);
+    const __m128i openBrace  = _mm_set1_epi8('{');
+    const __m128i closeBrace = _mm_set1_epi8('}');
+    const __m128i colon      = _mm_set1_epi8(':');
+    const __m128i comma      = _mm_set1_epi8(',');
+    const __m128i maxControl = _mm_set1_epi8(0x1f);
+
+    bsl::memset(result, 0, sizeof *result);
+
+    for (int i = 0; i < k_BLOCK_SIZE; i += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(block + i));
+
+        // Setting bit 5 maps '[' to '{' and ']' to '}', leaving '{' and '}'
+        // unchanged.
+
+        const __m128i folded = _mm_or_si128(input, bit5);
+
+        const __m128i ws = _mm_or_si128(
+                                _mm_or_si128(_mm_cmpeq_epi8(input, space),
+                                             _mm_cmpeq_epi8(input, tab)),
+                                _mm_or_si128(_mm_cmpeq_epi8(input, newline),
+                                             _mm_cmpeq_epi8(input, cr)));
+        const __m128i op = _mm_or_si128(
+                            _mm_or_si128(_mm_cmpeq_epi8(folded, openBrace),
+                                         _mm_cmpeq_epi8(folded, closeBrace)),
+                            _mm_or_si128(_mm_cmpeq_epi8(input, colon),
+                                         _mm_cmpeq_epi8(input, comma)));
+        const __m128i ctl = _mm_cmpeq_epi8(_mm_min_epu8(input, maxControl),
+                                           input);
+
+        result->d_backslash  |= static_cast<bsl::uint64_t>(_mm_movemask_epi8(
+                                  _mm_cmpeq_epi8(input, backslash))) << i;
+        result->d_quote      |= static_cast<bsl::uint64_t>(_mm_movemask_epi8(
+                                      _mm_cmpeq_epi8(input, quote))) << i;
+        result->d_whitespace |= static_cast<bsl::uint64_t>(
+                                                  _mm_movemask_epi8(ws)) << i;
+        result->d_operator   |= static_cast<bsl::uint64_t>(
+                                                  _mm_movemask_epi8(op)) << i;
+        result->d_control    |= static_cast<bsl::uint64_t>(
+                                                 _mm_movemask_epi8(ctl)) << i;
+    }
+#else
+    bsl::memset(result, 0, sizeof *result);
+
+    for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+        const unsigned char c   = static_cast<unsigned char>(block[i]);
+        const bsl::uint64_t bit = static_cast<bsl::uint64_t>(1) << i;
+
+        switch (c) {
+          case '\\': {
+            result->d_backslash |= bit;
+          } break;
+          case '"': {
+            result->d_quote |= bit;
+          } break;
+          case ' ':
+          case '\t':
+          case '\n':
+          case '\r': {
+            result->d_whitespace |= bit;
+          } break;
+          case '[':
+          case ']':
+          case '{':
+          case '}':
+          case ':':
+          case ',': {
+            result->d_operator |= bit;
+          } break;
+        }
+        if (c < 0x20) {
+            result->d_control |= bit;
+        }
+    }
+#endif
+}
+
+inline
+bsl::uint64_t prefixXor(bsl::uint64_t value)
+    // Return a mask in which bit 'i' is the XOR of bits '0' to 'i' of the
+    // specified 'value'.
+{
+    value ^= value << 1;
+    value ^= value << 2;
+    value ^= value << 4;
+    value ^= value << 8;
+    value ^= value << 16;
+    value ^= value << 32;
+    return value;
+}
+
+inline
+bsl::uint64_t findEscaped(bsl::uint64_t *nextIsEscaped,
+                          bsl::uint64_t  backslash)
+    // Return the mask of the characters escaped by a backslash in a block
+    // having the specified 'backslash' mask, where the first character of the
+    // block is escaped if the specified '*nextIsEscaped' is 1, and load into
+    // '*nextIsEscaped' whether the first character of the next block is
+    // escaped.
+{
+    if (0 == backslash) {
+        const bsl::uint64_t escaped = *nextIsEscaped;
+        *nextIsEscaped = 0;
+        return escaped;                                               // RETURN
+    }
+
+    // A backslash not itself escaped begins a sequence of backslashes.
+    // Adding such a sequence (shifted left by one) to the odd bits, and
+    // subtracting the sequence starts, clears or sets the bit after the end of
+    // each sequence according to the parity of the sequence's length and
+    // start.
+
+    const bsl::uint64_t potentialEscape = backslash & ~*nextIsEscaped;
+    const bsl::uint64_t maybeEscaped    = potentialEscape << 1;
+    const bsl::uint64_t escapeAndTerminalCode =
+                 ((maybeEscaped | k_ODD_BITS) - potentialEscape) ^ k_ODD_BITS;
+    const bsl::uint64_t escaped = escapeAndTerminalCode
+                                ^ (backslash | *nextIsEscaped);
+
+    *nextIsEscaped = (escapeAndTerminalCode & backslash) >> 63;
+    return escaped;
+}
+
+int setError(Error                   *errorDescription,
+             bsl::size_t              offset,
+             const bsl::string_view&  message)
+    // Load, if the specified 'errorDescription' is not 0, the specified
+    // 'message' and the location having the specified 'offset' into
+    // 'errorDescription'.  Return a non-zero value.
+{
+    if (errorDescription) {
+        errorDescription->setLocation(Location(offset));
+        errorDescription->setMessage(message);
+    }
+    return -1;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class StructuralIndex
+                           // ---------------------
+
+// MANIPULATORS
+int StructuralIndex::build(const bsl::string_view& input)
+{
+    return build(0, input);
+}
+
+int StructuralIndex::build(Error                   *errorDescription,
+                           const bsl::string_view&  input)
+{
+    reset();
+
+    const char        *data   = input.data();
+    const bsl::size_t  length = input.length();
+
+    if (length >= 0xffffffffu) {
+        return u::setError(errorDescription, 0, "Input too large");   // RETURN
+    }
+
+    const char *invalid = 0;
+    if (!bdlde::Utf8Util::isValid(&invalid, data, length)) {
+        return u::setError(errorDescription,                          // RETURN
+                           invalid - data,
+                           "Invalid UTF-8 string");
+    }
+
+    // Pass 1: find the structural characters.
+
+    d_positions.clear();
+    d_positions.reserve(length / 8 + 2);
+
+    bsl::uint64_t nextIsEscaped = 0;
+    bsl::uint64_t prevInString  = 0;
+    bsl::uint64_t prevScalar    = 0;
+
+    char          tail[u::k_BLOCK_SIZE];
+    u::BlockMasks masks;
+
+    for (bsl::size_t offset = 0; offset < length;
+                                               offset += u::k_BLOCK_SIZE) {
+        const char *block = data + offset;
+        if (length - offset < u::k_BLOCK_SIZE) {
+            // Pad the last, partial block with white space.
+
+            bsl::memset(tail, ' ', sizeof tail);
+            bsl::memcpy(tail, block, length - offset);
+            block = tail;
+        }
+
+        u::classify(&masks, block);
+
+        const bsl::uint64_t escaped  = u::findEscaped(&nextIsEscaped,
+                                                      masks.d_backslash);
+        const bsl::uint64_t quote    = masks.d_quote & ~escaped;
+        const bsl::uint64_t inString = u::prefixXor(quote) ^ prevInString;
+
+        prevInString = static_cast<bsl::uint64_t>(
+                            static_cast<bsls::Types::Int64>(inString) >> 63);
+
+        if (masks.d_control & inString) {
+            reset();
+            return u::setError(                                       // RETURN
+                   errorDescription,
+                   offset + bdlb::BitUtil::numTrailingUnsetBits(
+                                                   masks.d_control & inString),
+                   "Unescaped control character in string");
+        }
+
+        // 'stringTail' excludes the opening quote of each string, and
+        // includes its closing quote.
+
+        const bsl::uint64_t stringTail = inString ^ quote;
+        const bsl::uint64_t scalar     = ~(masks.d_operator |
+                                           masks.d_whitespace);
+        const bsl::uint64_t nonQuoteScalar = scalar & ~quote;
+        const bsl::uint64_t followsNonQuoteScalar =
+                                           (nonQuoteScalar << 1) | prevScalar;
+
+        prevScalar = nonQuoteScalar >> 63;
+
+        bsl::uint64_t structurals = (masks.d_operator |
+                                           (scalar & ~followsNonQuoteScalar))
+                                  & ~stringTail;
+
+        if (structurals) {
+            bsl::size_t n = d_positions.size();
+            d_positions.resize(n + bdlb::BitUtil::numBitsSet(structurals));
+
+            bsl::uint32_t *out = d_positions.data() + n;
+            do {
+                *out++ = static_cast<bsl::uint32_t>(
+                    offset + bdlb::BitUtil::numTrailingUnsetBits(structurals));
+                structurals &= structurals - 1;
+            } while (structurals);
+        }
+    }
+
+    if (prevInString) {
+        reset();
+        return u::setError(errorDescription,                          // RETURN
+                           length,
+                           "Unterminated string");
+    }
+
+    const bsl::size_t numStructurals = d_positions.size();
+    d_positions.push_back(static_cast<bsl::uint32_t>(length));
+
+    // Pass 2: match the brackets and braces.
+
+    d_matches.resize(numStructurals);
+
+    bsl::vector<bsl::uint32_t> open(allocator());
+    int                        maxDepth = 0;
+
+    for (bsl::size_t i = 0; i < numStructurals; ++i) {
+        const char c = data[d_positions[i]];
+
+        d_matches[i] = static_cast<bsl::uint32_t>(i);
+
+        if ('[' == c || '{' == c) {
+            open.push_back(static_cast<bsl::uint32_t>(i));
+            if (static_cast<int>(open.size()) > maxDepth) {
+                maxDepth = static_cast<int>(open.size());
+            }
+        }
+        else if (']' == c || '}' == c) {
+            if (open.empty()
+             || data[d_positions[open.back()]] != (']' == c ? '[' : '{')) {
+                const bsl::size_t offset = d_positions[i];
+                reset();
+                return u::setError(errorDescription,                  // RETURN
+                                   offset,
+                                   "Unexpected character");
+            }
+            d_matches[open.back()] = static_cast<bsl::uint32_t>(i);
+            open.pop_back();
+        }
+    }
+
+    if (!open.empty()) {
+        const bsl::size_t offset = d_positions[open.back()];
+        reset();
+        return u::setError(errorDescription,                          // RETURN
+                           offset,
+                           '[' == data[offset] ? "Unterminated array"
+                                               : "Unterminated object");
+    }
+
+    d_input    = input;
+    d_maxDepth = maxDepth;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,303 @@
+// bdljsn_structuralindex.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLJSN_STRUCTURALINDEX
+#define INCLUDED_BDLJSN_STRUCTURALINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an index of the structural characters of a JSON text.
+//
+//@CLASSES:
+//  bdljsn::StructuralIndex: positions of the structural characters of a JSON
+//
+//@SEE_ALSO: bdljsn_ondemandreader, bdljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdljsn::StructuralIndex',
+// that records, in a single pass over a contiguous JSON text, the offset of
+// every *structural* character of the text: the brackets and braces ('[', ']',
+// '{', and '}'), the name separators (':'), the value separators (','), and
+// the first character of every scalar value (the opening quote of a string,
+// and the first character of a number, 'true', 'false', or 'null').
+// Characters within strings, including escaped quotes, are never structural,
+// and the closing quote of a string is not recorded.  The index also records,
+// for each opening bracket or brace, the index of its matching closing
+// bracket or brace, so that a client can skip over an array or object,
+// however large, in constant time.
+//
+// Once built, the index allows a client to navigate a JSON text without
+// tokenizing it: each value begins at a structural character, a scalar value
+// occupies exactly one entry of the index, and an array or object occupies the
+// entries from its opening bracket or brace to the matching closing one.
+// The 'bdljsn_ondemandreader' component uses this index to provide lazy
+// access to the values of a JSON document.
+//
+// The index is built 64 characters at a time: on platforms supporting SSE2,
+// each block of 64 characters is classified with vector comparisons into bit
+// masks of quotes, backslashes, white space, and operators, from which the
+// structural characters are computed with bitwise arithmetic; on other
+// platforms the same masks are computed one character at a time.  The
+// technique is described in "Parsing Gigabytes of JSON per Second" by
+// Langdale and Lemire (VLDB Journal 28, 2019).
+//
+// 'build' verifies that the text is valid UTF-8, that every string is
+// terminated and contains no unescaped control character, and that brackets
+// and braces are balanced and properly nested.  It does *not* verify the rest
+// of the JSON grammar (e.g., that values are separated by commas, or that
+// scalar values are well formed), which is left to the client navigating the
+// index.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Skipping Over a Nested Value
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the text of the value following a large array
+// at the top level of a JSON document.
+//
+// First, we build the index of the document:
+//..
+//  const char *TEXT = "[[1, 2, [3, 4]], {\"a\": true}]";
+//
+//  bdljsn::StructuralIndex index;
+//  int rc = index.build(TEXT);
+//  assert(0 == rc);
+//..
+// Then, we observe that the first structural character is the opening bracket
+// of the top-level array, which is followed by that of the nested array:
+//..
+//  assert('[' == index.character(0));
+//  assert('[' == index.character(1));
+//..
+// Next, we skip over the nested array in constant time, arriving at the comma
+// that separates it from the next value:
+//..
+//  bsl::size_t next = index.matchingIndex(1) + 1;
+//  assert(',' == index.character(next));
+//..
+// Finally, we find the object following the comma, and its extent in the
+// text:
+//..
+//  ++next;
+//  assert('{' == index.character(next));
+//
+//  const bsl::size_t begin = index.position(next);
+//  const bsl::size_t end   = index.position(index.matchingIndex(next)) + 1;
+//  assert("{\"a\": true}" == bsl::string_view(TEXT + begin, end - begin));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class Error;
+
+                           // =====================
+                           // class StructuralIndex
+                           // =====================
+
+class StructuralIndex {
+    // This class provides a mechanism that records the offsets of the
+    // structural characters of a contiguous JSON text, and the matching
+    // closing bracket or brace of every opening bracket or brace.  The text
+    // is not copied, and must remain valid and unmodified while the index is
+    // in use.
+
+    // DATA
+    bsl::vector<bsl::uint32_t> d_positions;  // offset of each structural
+                                             // character, followed by the
+                                             // length of the text, or empty if
+                                             // no text is indexed
+
+    bsl::vector<bsl::uint32_t> d_matches;    // for each structural character,
+                                             // the index of its match if it is
+                                             // an opening bracket or brace,
+                                             // and its own index otherwise
+
+    bsl::string_view           d_input;      // indexed text
+
+    int                        d_maxDepth;   // greatest nesting depth of
+                                             // arrays and objects
+
+  private:
+    // NOT IMPLEMENTED
+    StructuralIndex(const StructuralIndex&);
+    StructuralIndex& operator=(const StructuralIndex&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StructuralIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StructuralIndex(bslma::Allocator *basicAllocator = 0);
+        // Create an empty index.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~StructuralIndex() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int build(const bsl::string_view& input);
+    int build(Error *errorDescription, const bsl::string_view& input);
+        // Index the structural characters of the specified JSON 'input'.
+        // Optionally specify an 'errorDescription' that, if an error occurs,
+        // is loaded with a description of the error and its location in
+        // 'input'.  Return 0 on success, and a non-zero value, leaving this
+        // index empty, if 'input' is not valid UTF-8, contains an
+        // unterminated string or a string containing an unescaped control
+        // character, contains unbalanced or improperly nested brackets or
+        // braces, or is 4GB or more in length.  Note that 'input' must remain
+        // valid and unmodified while this index is in use.
+
+    void reset();
+        // Reset this object to the empty index of an empty text.
+
+    // ACCESSORS
+    char character(bsl::size_t index) const;
+        // Return the structural character having the specified 'index'.  The
+        // behavior is undefined unless 'index < numStructurals()'.
+
+    const bsl::string_view& input() const;
+        // Return the text indexed by this object.
+
+    bsl::size_t matchingIndex(bsl::size_t index) const;
+        // Return the index of the closing bracket or brace matching the
+        // opening bracket or brace having the specified 'index', and 'index'
+        // if the structural character having 'index' is neither an opening
+        // bracket nor an opening brace.  The behavior is undefined unless
+        // 'index < numStructurals()'.
+
+    int maxDepth() const;
+        // Return the greatest nesting depth of the arrays and objects of the
+        // indexed text, i.e., 0 if it contains no array or object, and 1 if
+        // it contains arrays and objects none of which contain another.
+
+    bsl::size_t numStructurals() const;
+        // Return the number of structural characters of the indexed text.
+
+    bsl::size_t position(bsl::size_t index) const;
+        // Return the offset in the indexed text of the structural character
+        // having the specified 'index', or the length of the text if
+        // 'index == numStructurals()'.  The behavior is undefined unless
+        // 'index <= numStructurals()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class StructuralIndex
+                           // ---------------------
+
+// CREATORS
+inline
+StructuralIndex::StructuralIndex(bslma::Allocator *basicAllocator)
+: d_positions(basicAllocator)
+, d_matches(basicAllocator)
+, d_input()
+, d_maxDepth(0)
+{
+}
+
+// MANIPULATORS
+inline
+void StructuralIndex::reset()
+{
+    d_positions.clear();
+    d_matches.clear();
+    d_input    = bsl::string_view();
+    d_maxDepth = 0;
+}
+
+// ACCESSORS
+inline
+char StructuralIndex::character(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < numStructurals());
+
+    return d_input[d_positions[index]];
+}
+
+inline
+const bsl::string_view& StructuralIndex::input() const
+{
+    return d_input;
+}
+
+inline
+bsl::size_t StructuralIndex::matchingIndex(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < numStructurals());
+
+    return d_matches[index];
+}
+
+inline
+int StructuralIndex::maxDepth() const
+{
+    return d_maxDepth;
+}
+
+inline
+bsl::size_t StructuralIndex::numStructurals() const
+{
+    return d_positions.empty() ? 0 : d_positions.size() - 1;
+}
+
+inline
+bsl::size_t StructuralIndex::position(bsl::size_t index) const
+{
+    BSLS_ASSERT(index <= numStructurals());
+
+    return d_positions.empty() ? 0 : d_positions[index];
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StructuralIndex::allocator() const
+{
+    return d_positions.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
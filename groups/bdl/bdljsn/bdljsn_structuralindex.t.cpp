@@ -0,0 +1,754 @@
+// bdljsn_structuralindex.t.cpp                                       -*-C++-*-
+#include <bdljsn_structuralindex.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_location.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>   // 'bsl::size_t'
+#include <bsl_cstdlib.h>   // 'bsl::atoi'
+#include <bsl_cstring.h>   // 'bsl::strlen'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a mechanism that indexes the structural
+// characters of a JSON text.  The index is computed 64 characters at a time
+// with bitwise arithmetic, so the primary concern is that it agrees with a
+// straightforward character-at-a-time scan of the text, in particular for
+// escape sequences and strings spanning the boundaries of 64-character
+// blocks.  We test that agreement on tabulated texts and on a large number of
+// pseudo-random texts, then test the detection of malformed texts.
+//
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StructuralIndex(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~StructuralIndex();
+//
+// MANIPULATORS
+// [ 2] int build(const bsl::string_view& input);
+// [ 4] int build(Error *errorDescription, const bsl::string_view& input);
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 2] char character(bsl::size_t index) const;
+// [ 2] const bsl::string_view& input() const;
+// [ 2] bsl::size_t matchingIndex(bsl::size_t index) const;
+// [ 2] int maxDepth() const;
+// [ 2] bsl::size_t numStructurals() const;
+// [ 2] bsl::size_t position(bsl::size_t index) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: The index agrees with a character-at-a-time scan.
+// [ 5] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                    NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS AND CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::StructuralIndex Obj;
+
+BSLA_MAYBE_UNUSED bool             verbose;
+BSLA_MAYBE_UNUSED bool         veryVerbose;
+BSLA_MAYBE_UNUSED bool     veryVeryVerbose;
+BSLA_MAYBE_UNUSED bool veryVeryVeryVerbose;
+
+namespace {
+
+bool isWhitespace(char c)
+    // Return 'true' if the specified 'c' is JSON white space.
+{
+    return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+}
+
+bool isOperator(char c)
+    // Return 'true' if the specified 'c' is a bracket, a brace, a name
+    // separator, or a value separator.
+{
+    return '[' == c || ']' == c || '{' == c || '}' == c || ':' == c
+        || ',' == c;
+}
+
+int referenceIndex(bsl::vector<bsl::size_t> *positions,
+                   bsl::vector<bsl::size_t> *matches,
+                   int                      *maxDepth,
+                   const bsl::string_view&   text)
+    // Load into the specified 'positions' the offsets of the structural
+    // characters of the specified 'text', into the specified 'matches' the
+    // index of the match of each of them, and into the specified 'maxDepth'
+    // the nesting depth of 'text', scanning 'text' one character at a time.
+    // Return 0 on success, and a non-zero value if 'text' contains an
+    // unterminated string, a string containing a control character, or
+    // unbalanced brackets or braces.  The behavior is undefined unless 'text'
+    // is valid UTF-8.
+{
+    positions->clear();
+    matches->clear();
+    *maxDepth = 0;
+
+    bool inString           = false;
+    bool escape             = false;
+    bool followsPlainScalar = false;
+
+    for (bsl::size_t i = 0; i < text.length(); ++i) {
+        const char c       = text[i];
+        const bool escaped = escape;
+        const bool quote   = '"' == c && !escaped;
+
+        escape = !escaped && '\\' == c;
+
+        if (inString) {
+            if (quote) {
+                inString = false;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (isOperator(c)) {
+            positions->push_back(i);
+        }
+        else if (!isWhitespace(c)) {
+            if (!followsPlainScalar) {
+                positions->push_back(i);
+            }
+            inString = quote;
+        }
+        followsPlainScalar = !isWhitespace(c) && !isOperator(c) && !quote;
+    }
+    if (inString) {
+        return -2;                                                    // RETURN
+    }
+
+    bsl::vector<bsl::size_t> open;
+    for (bsl::size_t i = 0; i < positions->size(); ++i) {
+        const char c = text[(*positions)[i]];
+
+        matches->push_back(i);
+        if ('[' == c || '{' == c) {
+            open.push_back(i);
+            if (static_cast<int>(open.size()) > *maxDepth) {
+                *maxDepth = static_cast<int>(open.size());
+            }
+        }
+        else if (']' == c || '}' == c) {
+            if (open.empty() || text[(*positions)[open.back()]] + 2 != c) {
+                return -3;                                            // RETURN
+            }
+            (*matches)[open.back()] = i;
+            open.pop_back();
+        }
+    }
+    return open.empty() ? 0 : -4;
+}
+
+void generateText(bsl::string *result, bsl::size_t length, unsigned *seed)
+    // Load into the specified 'result' a pseudo-random text of approximately
+    // the specified 'length', made mostly of strings having runs of
+    // backslashes, with the specified 'seed' as the state of the generator.
+{
+    static const char *const FRAGMENTS[] = {
+        "\"",      "\\",       "\\\\",     "\\\"",     "\\\\\\",
+        "a",       "12",       "-1.5e3",   "true",     "null",
+        " ",       "\n",       ",",        ":",        "[]",
+        "{}",      "\"x\"",    "\"\\\\\"", "\xc3\xa9",
+        "[\"a\",{\"b\":[1]}]",
+        "{\"a\":[\"]\\\\\",null]}"
+    };
+    const int NUM_FRAGMENTS = sizeof FRAGMENTS / sizeof *FRAGMENTS;
+
+    result->clear();
+    while (result->length() < length) {
+        *seed = *seed * 1103515245u + 12345u;
+        result->append(FRAGMENTS[(*seed >> 16) % NUM_FRAGMENTS]);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Skipping Over a Nested Value
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the text of the value following a large array
+// at the top level of a JSON document.
+//
+// First, we build the index of the document:
+//..
+    const char *TEXT = "[[1, 2, [3, 4]], {\"a\": true}]";
+
+    bdljsn::StructuralIndex index;
+    int rc = index.build(TEXT);
+    ASSERT(0 == rc);
+//..
+// Then, we observe that the first structural character is the opening bracket
+// of the top-level array, which is followed by that of the nested array:
+//..
+    ASSERT('[' == index.character(0));
+    ASSERT('[' == index.character(1));
+//..
+// Next, we skip over the nested array in constant time, arriving at the comma
+// that separates it from the next value:
+//..
+    bsl::size_t next = index.matchingIndex(1) + 1;
+    ASSERT(',' == index.character(next));
+//..
+// Finally, we find the object following the comma, and its extent in the
+// text:
+//..
+    ++next;
+    ASSERT('{' == index.character(next));
+
+    const bsl::size_t begin = index.position(next);
+    const bsl::size_t end   = index.position(index.matchingIndex(next)) + 1;
+    ASSERT("{\"a\": true}" == bsl::string_view(TEXT + begin, end - begin));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MALFORMED TEXT
+        //
+        // Concerns:
+        //: 1 'build' fails, leaving the index empty, for a text that is not
+        //:   valid UTF-8, that contains an unterminated string or a string
+        //:   containing an unescaped control character, or that contains
+        //:   unbalanced or improperly nested brackets or braces.
+        //:
+        //: 2 The error description identifies the error and its location.
+        //:
+        //: 3 The same object can be used to index another text after a
+        //:   failure.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, build the index of malformed
+        //:   texts, verify the status, the state of the index, and the error
+        //:   description, then build the index of a valid text.  (C-1..3)
+        //
+        // Testing:
+        //   int build(Error *errorDescription, const bsl::string_view& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MALFORMED TEXT" << endl
+                          << "==============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            bsl::size_t d_offset;
+            const char *d_message_p;
+        } DATA[] = {
+            //LINE TEXT               OFF MESSAGE
+            //---- ----------------   --- --------------------
+            { L_,  "\"abc",            4, "Unterminated string" },
+            { L_,  "[\"a\\\"]",        6, "Unterminated string" },
+            { L_,  "\"a\tb\"",         2, "Unescaped control character in "
+                                          "string" },
+            { L_,  "\"\x01\"",         1, "Unescaped control character in "
+                                          "string" },
+            { L_,  "[1, 2",            0, "Unterminated array" },
+            { L_,  "{\"a\": [",        6, "Unterminated array" },
+            { L_,  "[{\"a\": 1}",      0, "Unterminated array" },
+            { L_,  "{\"a\": 1",        0, "Unterminated object" },
+            { L_,  "[1}",              2, "Unexpected character" },
+            { L_,  "]",                0, "Unexpected character" },
+            { L_,  "[1]]",             3, "Unexpected character" },
+            { L_,  "{\"a\": [1}]",     8, "Unexpected character" },
+            { L_,  "\"\xc3\"",         1, "Invalid UTF-8 string" },
+            { L_,  "[\"\xff\"]",       2, "Invalid UTF-8 string" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const TEXT    = DATA[ti].d_text_p;
+            const bsl::size_t OFFSET  = DATA[ti].d_offset;
+            const char *const MESSAGE = DATA[ti].d_message_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+            bdljsn::Error error;
+
+            ASSERTV(LINE, 0 != mX.build(&error, TEXT));
+            ASSERTV(LINE, 0 == X.numStructurals());
+            ASSERTV(LINE, 0 == X.maxDepth());
+            ASSERTV(LINE, X.input().empty());
+
+            ASSERTV(LINE, error.message(), MESSAGE == error.message());
+            ASSERTV(LINE, error.location().offset(),
+                    OFFSET == error.location().offset());
+
+            ASSERTV(LINE, 0 != mX.build(TEXT));
+
+            ASSERTV(LINE, 0 == mX.build("[1, {\"a\": 2}]"));
+            ASSERTV(LINE, X.numStructurals(), 9 == X.numStructurals());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSISTENCY WITH A CHARACTER-AT-A-TIME SCAN
+        //
+        // Concerns:
+        //: 1 The structural characters, their matches, and the nesting depth
+        //:   of a text agree with those found by scanning the text one
+        //:   character at a time, in particular when strings, escape
+        //:   sequences, and runs of backslashes span the boundaries of
+        //:   64-character blocks.
+        //:
+        //: 2 'build' fails exactly when the scan finds an unterminated
+        //:   string, a control character in a string, or unbalanced
+        //:   brackets or braces.
+        //
+        // Plan:
+        //: 1 Generate a large number of pseudo-random texts of lengths up to
+        //:   a few blocks, made of fragments rich in quotes and backslashes,
+        //:   and compare the result of 'build' with that of a reference
+        //:   scan.  Also compare the index of each text wrapped in brackets
+        //:   and offset by one character, to vary the alignment.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The index agrees with a character-at-a-time scan.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "CONSISTENCY WITH A CHARACTER-AT-A-TIME SCAN" << endl
+                      << "===========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        bsl::vector<bsl::size_t> positions;
+        bsl::vector<bsl::size_t> matches;
+        bsl::string              text;
+        unsigned                 seed       = 12345;
+        int                      numSuccess = 0;
+
+        const int NUM_ITERATIONS = 20000;
+
+        for (int ti = 0; ti < NUM_ITERATIONS; ++ti) {
+            generateText(&text, ti % 300, &seed);
+
+            for (int tj = 0; tj < 2; ++tj) {
+                if (1 == tj) {
+                    text = " [" + text + "]";
+                }
+
+                int       maxDepth;
+                const int EXP_RC = referenceIndex(&positions,
+                                                  &matches,
+                                                  &maxDepth,
+                                                  text);
+                const int rc     = mX.build(text);
+
+                ASSERTV(ti, tj, text, EXP_RC, rc, (0 == EXP_RC) == (0 == rc));
+                if (0 != EXP_RC || 0 != rc) {
+                    continue;
+                }
+                ++numSuccess;
+
+                ASSERTV(ti, text, maxDepth == X.maxDepth());
+                ASSERTV(ti, text, X.input().data() == text.data());
+                ASSERTV(ti, text, positions.size(), X.numStructurals(),
+                        positions.size() == X.numStructurals());
+                ASSERTV(text.length() == X.position(X.numStructurals()));
+
+                if (positions.size() != X.numStructurals()) {
+                    continue;
+                }
+                for (bsl::size_t i = 0; i < positions.size(); ++i) {
+                    ASSERTV(ti, text, i, positions[i] == X.position(i));
+                    ASSERTV(ti, text, i, matches[i] == X.matchingIndex(i));
+                    ASSERTV(ti, text, i, text[positions[i]] == X.character(i));
+                }
+            }
+        }
+
+        if (verbose) { P_(NUM_ITERATIONS) P(numSuccess) }
+
+        ASSERTV(numSuccess, numSuccess > NUM_ITERATIONS / 10);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUILD AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'build' records the offset of every bracket, brace, separator,
+        //:   and scalar start outside of strings, and no other offset.
+        //:
+        //: 2 'matchingIndex' returns the index of the matching closing
+        //:   bracket or brace of an opening one, and the index itself
+        //:   otherwise.
+        //:
+        //: 3 'maxDepth' returns the nesting depth of the text.
+        //:
+        //: 4 'position(numStructurals())' is the length of the text.
+        //:
+        //: 5 'reset' returns the index to its default-constructed state.
+        //:
+        //: 6 Memory is supplied by the object allocator only.
+        //:
+        //: 7 Precondition violations are detected in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, build the index of texts, and
+        //:   verify the structural characters against the expected ones
+        //:   (given as a string with one character per structural
+        //:   character), and the depth.  (C-1, 3..4)
+        //:
+        //: 2 For each opening bracket or brace, verify that the character at
+        //:   the matching index closes it, and that the characters between
+        //:   them are balanced.  (C-2)
+        //:
+        //: 3 Call 'reset' and verify the accessors.  (C-5)
+        //:
+        //: 4 Install a test allocator as the default allocator and verify
+        //:   that it is not used.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid indexes.  (C-7)
+        //
+        // Testing:
+        //   explicit StructuralIndex(bslma::Allocator *basicAllocator = 0);
+        //   ~StructuralIndex();
+        //   int build(const bsl::string_view& input);
+        //   void reset();
+        //   char character(bsl::size_t index) const;
+        //   const bsl::string_view& input() const;
+        //   bsl::size_t matchingIndex(bsl::size_t index) const;
+        //   int maxDepth() const;
+        //   bsl::size_t numStructurals() const;
+        //   bsl::size_t position(bsl::size_t index) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUILD AND ACCESSORS" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            const char *d_structurals_p;
+            int         d_maxDepth;
+        } DATA[] = {
+            //LINE TEXT                             STRUCTURALS     DEPTH
+            //---- -------------------------------  --------------  -----
+            { L_,  "",                              "",                 0 },
+            { L_,  "   ",                           "",                 0 },
+            { L_,  "1",                             "1",                0 },
+            { L_,  " -12.5e+3 ",                    "-",                0 },
+            { L_,  "true",                          "t",                0 },
+            { L_,  "\"abc\"",                       "\"",               0 },
+            { L_,  "\"[{,:}]\"",                    "\"",               0 },
+            { L_,  "\"a\\\"b\"",                    "\"",               0 },
+            { L_,  "\"a\\\\\"",                     "\"",               0 },
+            { L_,  "\"a\\\\\\\"\"",                 "\"",               0 },
+            { L_,  "[]",                            "[]",               1 },
+            { L_,  "{}",                            "{}",               1 },
+            { L_,  "[1,2]",                         "[1,2]",            1 },
+            { L_,  "[ 1 , 2 ]",                     "[1,2]",            1 },
+            { L_,  "[1 2]",                         "[12]",             1 },
+            { L_,  "[\"a\"\"b\"]",                  "[\"\"]",           1 },
+            { L_,  "[1\"a\"]",                      "[1]",              1 },
+            { L_,  "[\"a\"1]",                      "[\"1]",            1 },
+            { L_,  "{\"a\":1}",                     "{\":1}",           1 },
+            { L_,  "{\"a\" : [true, null]}",        "{\":[t,n]}",       2 },
+            { L_,  "[[[]],[{}]]",                   "[[[]],[{}]]",      3 },
+            { L_,  "[\"]\", \"\\\\\", \"\\\"]\"]",  "[\",\",\"]",       1 },
+            { L_,  "\"\xc3\xa9\" \"\xe2\x82\xac\"", "\"\"",             0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         oa("object",   veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(&oa == X.allocator());
+        ASSERT(0   == X.numStructurals());
+        ASSERT(0   == X.maxDepth());
+        ASSERT(0   == X.position(0));
+        ASSERT(X.input().empty());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int              LINE        = DATA[ti].d_line;
+            const bsl::string_view TEXT        = DATA[ti].d_text_p;
+            const bsl::string_view STRUCTURALS = DATA[ti].d_structurals_p;
+            const int              MAX_DEPTH   = DATA[ti].d_maxDepth;
+
+            if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+            ASSERTV(LINE, 0 == mX.build(TEXT));
+
+            ASSERTV(LINE, TEXT.data()   == X.input().data());
+            ASSERTV(LINE, TEXT.length() == X.input().length());
+            ASSERTV(LINE, MAX_DEPTH, X.maxDepth(), MAX_DEPTH == X.maxDepth());
+            ASSERTV(LINE, X.numStructurals(),
+                    STRUCTURALS.length() == X.numStructurals());
+            ASSERTV(LINE, TEXT.length() == X.position(X.numStructurals()));
+
+            bsl::string structurals;
+            for (bsl::size_t i = 0; i < X.numStructurals(); ++i) {
+                structurals.push_back(X.character(i));
+                ASSERTV(LINE, i, TEXT[X.position(i)] == X.character(i));
+                if (0 < i) {
+                    ASSERTV(LINE, i, X.position(i - 1) < X.position(i));
+                }
+
+                const char        C     = X.character(i);
+                const bsl::size_t MATCH = X.matchingIndex(i);
+
+                if ('[' == C || '{' == C) {
+                    ASSERTV(LINE, i, MATCH, i < MATCH);
+                    ASSERTV(LINE, i, C + 2 == X.character(MATCH));
+
+                    int depth = 0;
+                    for (bsl::size_t j = i; j <= MATCH; ++j) {
+                        const char D = X.character(j);
+                        depth += '[' == D || '{' == D;
+                        depth -= ']' == D || '}' == D;
+                        ASSERTV(LINE, i, j, (j == MATCH) == (0 == depth));
+                    }
+                }
+                else {
+                    ASSERTV(LINE, i, MATCH, i == MATCH);
+                }
+            }
+            ASSERTV(LINE, STRUCTURALS, structurals,
+                    STRUCTURALS == structurals);
+        }
+
+        mX.reset();
+
+        ASSERT(0 == X.numStructurals());
+        ASSERT(0 == X.maxDepth());
+        ASSERT(0 == X.position(0));
+        ASSERT(X.input().empty());
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(mX.build("[1]"));
+
+            ASSERT_PASS(X.character(2));
+            ASSERT_FAIL(X.character(3));
+
+            ASSERT_PASS(X.matchingIndex(2));
+            ASSERT_FAIL(X.matchingIndex(3));
+
+            ASSERT_PASS(X.position(3));
+            ASSERT_FAIL(X.position(4));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Index a small document and inspect the index.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char TEXT[] = "{\"a\": [1, \"b\"], \"c\": null}";
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.build(TEXT));
+
+        ASSERTV(X.numStructurals(), 13 == X.numStructurals());
+        ASSERTV(X.maxDepth(),       2  == X.maxDepth());
+
+        ASSERT('{' == X.character(0));  ASSERT(0  == X.position(0));
+        ASSERT('"' == X.character(1));  ASSERT(1  == X.position(1));
+        ASSERT(':' == X.character(2));  ASSERT(4  == X.position(2));
+        ASSERT('[' == X.character(3));  ASSERT(6  == X.position(3));
+        ASSERT('1' == X.character(4));  ASSERT(7  == X.position(4));
+        ASSERT(',' == X.character(5));  ASSERT(8  == X.position(5));
+        ASSERT('"' == X.character(6));  ASSERT(10 == X.position(6));
+        ASSERT(']' == X.character(7));  ASSERT(13 == X.position(7));
+        ASSERT(',' == X.character(8));  ASSERT(14 == X.position(8));
+        ASSERT('"' == X.character(9));  ASSERT(16 == X.position(9));
+        ASSERT(':' == X.character(10)); ASSERT(19 == X.position(10));
+        ASSERT('n' == X.character(11)); ASSERT(21 == X.position(11));
+        ASSERT('}' == X.character(12)); ASSERT(25 == X.position(12));
+
+        ASSERT(12 == X.matchingIndex(0));
+        ASSERT(7  == X.matchingIndex(3));
+        ASSERT(4  == X.matchingIndex(4));
+
+        ASSERT(sizeof TEXT - 1 == X.position(X.numStructurals()));
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
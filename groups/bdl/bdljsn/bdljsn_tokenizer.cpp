@@ -56,6 +56,32 @@ BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 // tokenization has begun.  And in no case should a situation arise in which
 // the same state of tokenizer is legal with one combination of options and
 // illegal with others.
+//
+// When tokenizing contiguous input, the tokenizer moves from token to token
+// using a 'StructuralIndex' of the input rather than scanning for whitespace
+// and quotes one character at a time.  The index is built with a stricter
+// notion of JSON than this class implements, so the tokenizer uses it only
+// where both agree:
+//
+//: o If 'StructuralIndex::build' fails (invalid UTF-8, unterminated strings,
+//:   control characters in strings, unbalanced brackets), the input is read
+//:   through a 'bdlsb::FixedMemInStreamBuf' from the start.
+//:
+//: o Otherwise, the token following the cursor starts at the next structural
+//:   character provided that only whitespace lies in between and that this
+//:   character is not '\v' or '\f' (which the index treats as the start of a
+//:   scalar, and this class as whitespace).  If not (e.g., for '1"a"' or
+//:   '1\v2', where this class splits a token that the index does not), the
+//:   rest of the input is read through the 'bdlsb::FixedMemInStreamBuf' from
+//:   the cursor, preserving the state of the tokenizer.
+//:
+//: o The closing quote of a string is the last character that is not JSON
+//:   whitespace preceding the structural character following the string, as
+//:   strings in the index honor escapes exactly as 'extractStringValue' does.
+//
+// Consequently, the tokens, values, error positions, and read status produced
+// for contiguous input are those that would be produced by reading the same
+// data from a 'streambuf'.
 
 namespace BloombergLP {
 namespace {
@@ -63,6 +89,51 @@ namespace {
 static const char *g_WHITESPACE = " \n\t\v\f\r";
 static const char *g_TOKENS     = "{}[]:,\"";
 
+inline
+bool isJsonWhitespace(char character)
+    // Return 'true' if the specified 'character' is whitespace according to
+    // the JSON grammar, and 'false' otherwise.
+{
+    return ' '  == character || '\n' == character
+        || '\t' == character || '\r' == character;
+}
+
+inline
+bool isWhitespace(char character)
+    // Return 'true' if the specified 'character' is one of 'g_WHITESPACE',
+    // and 'false' otherwise.
+{
+    return isJsonWhitespace(character)
+        || '\v' == character || '\f' == character;
+}
+
+inline
+bool isScalarEnd(char character)
+    // Return 'true' if the specified 'character' ends a scalar value in
+    // 'Tokenizer::skipNonWhitespaceOrTillToken', i.e., if it is whitespace, a
+    // token character, or the null character, and 'false' otherwise.
+{
+    switch (character) {
+      case ' ':
+      case '\n':
+      case '\t':
+      case '\v':
+      case '\f':
+      case '\r':
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '"':
+      case '\0': {
+        return true;                                                  // RETURN
+      }
+    }
+    return false;
+}
+
 }  // close unnamed namespace
 
 namespace bdljsn {
@@ -170,6 +241,50 @@ int Tokenizer::extractStringValue()
     return 0;
 }
 
+int Tokenizer::findScalarEndInInput()
+{
+    BSLS_ASSERT(d_useIndex);
+
+    const char        *data   = d_input.data();
+    const bsl::size_t  length = d_input.length();
+
+    while (d_valueIter < length && !isScalarEnd(data[d_valueIter])) {
+        ++d_valueIter;
+    }
+
+    if (d_valueIter == length && 0 == d_readStatus) {
+        // Reading a scalar that ends with the data sets the read status, as
+        // in 'skipNonWhitespaceOrTillToken'.
+
+        d_readStatus = k_EOF;
+    }
+
+    d_valueEnd = d_valueIter;
+    return 0;
+}
+
+int Tokenizer::findStringEndInInput()
+{
+    BSLS_ASSERT(d_useIndex);
+
+    // Only JSON whitespace may separate the closing quote from the next
+    // structural character, or from the end of the input.
+
+    const char  *data = d_input.data();
+    bsl::size_t  end  = d_index.position(d_structural);
+
+    do {
+        --end;
+    } while (isJsonWhitespace(data[end]));
+
+    BSLS_ASSERT('"' == data[end]);
+    BSLS_ASSERT(d_valueIter <= end);
+
+    d_valueIter = end;
+    d_valueEnd  = end;
+    return 0;
+}
+
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
     d_stringBuffer.erase(d_stringBuffer.begin(),
@@ -301,6 +416,15 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 
 int Tokenizer::skipWhitespace()
 {
+    if (d_useIndex) {
+        const int rc = skipWhitespaceInInput();
+        if (rc <= 0) {
+            return rc;                                                // RETURN
+        }
+
+        switchToStreamBuf();
+    }
+
     while (true) {
         bsl::size_t pos = d_stringBuffer.find_first_not_of(g_WHITESPACE,
                                                            d_cursor);
@@ -317,6 +441,52 @@ int Tokenizer::skipWhitespace()
     return 0;
 }
 
+int Tokenizer::skipWhitespaceInInput()
+{
+    BSLS_ASSERT(d_useIndex);
+
+    const char        *data = d_input.data();
+    const bsl::size_t  next = d_index.position(d_structural);
+
+    while (d_cursor < next && isWhitespace(data[d_cursor])) {
+        ++d_cursor;
+    }
+
+    if (d_cursor < next) {
+        return 1;                                                     // RETURN
+    }
+
+    if (next == d_input.length()) {
+        if (0 == d_readStatus) {
+            d_readStatus = k_EOF;
+        }
+        return -1;                                                    // RETURN
+    }
+
+    if ('\v' == data[next] || '\f' == data[next]) {
+        return 1;                                                     // RETURN
+    }
+
+    ++d_structural;
+    return 0;
+}
+
+void Tokenizer::switchToStreamBuf()
+{
+    BSLS_ASSERT(d_useIndex);
+
+    d_inputStreamBuf.pubsetbuf(
+                    d_input.data() + d_cursor,
+                    static_cast<bsl::streamsize>(d_input.length() - d_cursor));
+
+    d_streambuf_p = &d_inputStreamBuf;
+    d_readOffset  = d_cursor;
+    d_cursor      = 0;
+    d_useIndex    = false;
+
+    d_stringBuffer.clear();
+}
+
 // MANIPULATORS
 int Tokenizer::advanceToNextToken()
 {
@@ -324,7 +494,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (!d_useIndex && d_cursor >= d_stringBuffer.size()) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -343,7 +513,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_useIndex ? d_input[d_cursor] : d_stringBuffer[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -584,7 +754,8 @@ int Tokenizer::advanceToNextToken()
             }
 
             d_valueEnd = 0;
-            int rc     = extractStringValue();
+            int rc     = d_useIndex ? findStringEndInInput()
+                                    : extractStringValue();
             if (rc) {
                 d_tokenType = e_ERROR;
                 return -1;                                            // RETURN
@@ -647,7 +818,8 @@ int Tokenizer::advanceToNextToken()
                 d_valueEnd   = 0;
                 d_valueIter  = d_valueBegin + 1;
 
-                const int rc = skipNonWhitespaceOrTillToken();
+                const int rc = d_useIndex ? findScalarEndInInput()
+                                          : skipNonWhitespaceOrTillToken();
                 if (rc) {
                     d_tokenType = e_ERROR;
                     return -1;                                        // RETURN
@@ -666,8 +838,29 @@ int Tokenizer::advanceToNextToken()
     return 0;
 }
 
+void Tokenizer::reset(const bsl::string_view& input)
+{
+    reset(static_cast<bsl::streambuf *>(0));
+
+    d_input    = input;
+    d_useIndex = true;
+
+    if (0 != d_index.build(input)) {
+        // The index does not describe 'input' as this class tokenizes it, so
+        // the whole input is read as if supplied by a 'streambuf'.
+
+        switchToStreamBuf();
+    }
+}
+
 int Tokenizer::resetStreamBufGetPointer()
 {
+    if (d_useIndex || &d_inputStreamBuf == d_streambuf_p) {
+        // There is no client-supplied 'streambuf' to reposition.
+
+        return 0;                                                     // RETURN
+    }
+
     if (d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
@@ -691,9 +884,11 @@ int Tokenizer::value(bsl::string_view *data) const
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
 
-        *data = bsl::string_view(d_stringBuffer).substr(
-                                                    d_valueBegin,
-                                                    d_valueEnd - d_valueBegin);
+        const bsl::string_view buffer = d_useIndex
+                                      ? d_input
+                                      : bsl::string_view(d_stringBuffer);
+
+        *data = buffer.substr(d_valueBegin, d_valueEnd - d_valueBegin);
 
         return 0;                                                     // RETURN
     }
@@ -10,7 +10,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdljsn::Tokenizer: tokenizer for parsing JSON data from a 'streambuf'
 //
-//@SEE_ALSO: baljsn_decoder
+//@SEE_ALSO: baljsn_decoder, bdljsn_structuralindex
 //
 //@DESCRIPTION: This component provides a class, 'bdljsn::Tokenizer', that
 // traverses data stored in a 'bsl::streambuf' one node at a time and provides
@@ -28,6 +28,24 @@ BSLS_IDENT("$Id: $")
 // but not all such errors are detected.  In particular, callers should check
 // that closing brackets and braces match opening ones.
 //
+///Tokenizing Contiguous Input
+///---------------------------
+// When the JSON data is available in a contiguous buffer, clients can call the
+// 'reset' overload taking a 'bsl::string_view' instead of wrapping the buffer
+// in a 'streambuf'.  The tokenizer then does not copy the data: it builds a
+// 'bdljsn::StructuralIndex' of the buffer, which locates the start of every
+// token with vector instructions, moves from token to token using the index,
+// and returns values that refer directly into the buffer.
+//
+// Tokenizing a contiguous buffer produces the same sequence of tokens, values,
+// and errors as tokenizing a 'streambuf' supplying the same data, with the
+// same options.  Whenever the index cannot describe the input as this class
+// would tokenize it (e.g., if the buffer contains invalid UTF-8, unterminated
+// strings, unbalanced brackets, or characters that this class treats as
+// separators but JSON does not), the tokenizer transparently falls back to
+// reading the remainder of the buffer one chunk at a time, exactly as it reads
+// a 'streambuf'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -137,8 +155,12 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdljsn_structuralindex.h>
+
 #include <bdlma_bufferedsequentialallocator.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
+
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -271,6 +293,26 @@ class Tokenizer {
     bool                d_allowTrailingTopLevelComma;
                                             // if 'true', allows '{},'
 
+    bsl::string_view    d_input;            // contiguous data supplied to
+                                            // 'reset', if any (held, not
+                                            // owned)
+
+    StructuralIndex     d_index;            // structural characters of
+                                            // 'd_input'
+
+    bsl::size_t         d_structural;       // index, in 'd_index', of the
+                                            // next structural character
+
+    bool                d_useIndex;         // 'true' if tokens are located
+                                            // in 'd_input' using 'd_index',
+                                            // and 'false' if data is read from
+                                            // '*d_streambuf_p'
+
+    bdlsb::FixedMemInStreamBuf
+                        d_inputStreamBuf;   // streambuf reading the part of
+                                            // 'd_input' that is not tokenized
+                                            // using 'd_index'
+
     // PRIVATE MANIPULATORS
     int expandBufferForLargeValue();
         // Increase the size of the string buffer, 'd_stringBuffer', and then
@@ -295,6 +337,18 @@ class Tokenizer {
         // UTF-8 was encountered, so it may be necessary to call
         // 'utf8ErrorIsSet()' to tell the difference.
 
+    int findScalarEndInInput();
+        // Load into 'd_valueIter' and 'd_valueEnd' the offset in 'd_input' of
+        // the first whitespace or token character following the current data
+        // cursor.  Return 0.  The behavior is undefined unless 'd_useIndex' is
+        // 'true'.
+
+    int findStringEndInInput();
+        // Load into 'd_valueIter' and 'd_valueEnd' the offset in 'd_input' of
+        // the quote closing the string value starting at the current data
+        // cursor, using 'd_index'.  Return 0.  The behavior is undefined
+        // unless 'd_useIndex' is 'true'.
+
     ContextType popContext();
         // If the 'd_contextStack' is empty, return 'e_NO_CONTEXT', otherwise
         // pop the top context from the 'd_contextStack' stack, and return it.
@@ -318,6 +372,22 @@ class Tokenizer {
         // first non-whitespace character.  Return 0 on success and a non-zero
         // value otherwise.
 
+    int skipWhitespaceInInput();
+        // Skip all whitespace characters preceding the next structural
+        // character of 'd_input' and position the cursor onto that character.
+        // Return 0 on success, a negative value if the end of the input is
+        // reached, and a positive value, leaving the cursor onto the first
+        // character that is not whitespace, if any character other than
+        // whitespace precedes the next structural character, or if that
+        // character is treated as whitespace by this class.  The behavior is
+        // undefined unless 'd_useIndex' is 'true'.
+
+    void switchToStreamBuf();
+        // Continue tokenizing 'd_input' from the current data cursor by
+        // reading it through 'd_inputStreamBuf', in the same way as data
+        // supplied by a 'streambuf'.  The behavior is undefined unless
+        // 'd_useIndex' is 'true'.
+
     // PRIVATE ACCESSOR
     ContextType context() const;
         // If the 'd_contextStack' is empty, return 'e_NO_CONTEXT', otherwise
@@ -355,6 +425,18 @@ class Tokenizer {
         // change the value of the 'allowStandAloneValues',
         // 'allowHeterogenousArrays', or 'allowNonUtf8StringLiterals' options.
 
+    void reset(const bsl::string_view& input);
+        // Reset this tokenizer to read data from the specified contiguous
+        // 'input', which must remain valid and unmodified until this
+        // tokenizer is reset again or destroyed.  Note that the reader will
+        // not be on a valid node until 'advanceToNextToken' is called.  Note
+        // that this function does not change the value of the
+        // 'allowStandAloneValues', 'allowHeterogenousArrays', or
+        // 'allowNonUtf8StringLiterals' options.  Also note that 'input' is
+        // tokenized exactly as would be a 'streambuf' supplying the same
+        // data, but that values returned by the 'value' accessor may refer
+        // directly into 'input'.
+
     int resetStreamBufGetPointer();
         // Reset the get pointer of the 'streambuf' held by this object to
         // refer to the byte following the last processed byte, if the held
@@ -365,7 +447,9 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  Further note that this function has
+        // no effect, and returns 0, if this tokenizer was reset to read
+        // contiguous input.
 
     void setAllowHeterogenousArrays(bool value);
         // Set the 'allowHeterogenousArrays' option to the specified 'value'.
@@ -433,6 +517,8 @@ class Tokenizer {
         // Note that 'readOffset() >= currentPosition()' -- the 'readOffset' is
         // the offset of the last octet read from the stream supplied to
         // 'reset', and is at or beyond the current position being tokenized.
+        // Also note that, when tokenizing contiguous input, the whole input
+        // may be considered read as soon as 'reset' is called.
 
     int readStatus() const;
         // Return the status of the last call to 'reloadStringBuffer()':
@@ -514,6 +600,11 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_allowHeterogenousArrays(true)
 , d_allowNonUtf8StringLiterals(true)
 , d_allowTrailingTopLevelComma(true)
+, d_input()
+, d_index(basicAllocator)
+, d_structural(0)
+, d_useIndex(false)
+, d_inputStreamBuf(0, 0)
 {
     d_stringBuffer.reserve(k_MAX_STRING_SIZE);
     d_contextStack.clear();
@@ -539,7 +630,11 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
     d_tokenType    = e_BEGIN;
     d_readStatus   = 0;
     d_bufEndStatus = 0;
+    d_input        = bsl::string_view();
+    d_structural   = 0;
+    d_useIndex     = false;
 
+    d_index.reset();
     d_contextStack.clear();
     pushContext(e_NO_CONTEXT);
 }
@@ -602,7 +697,7 @@ bsls::Types::Uint64 Tokenizer::currentPosition() const
 inline
 bsls::Types::Uint64 Tokenizer::readOffset() const
 {
-    return d_readOffset;
+    return d_useIndex ? d_input.length() : d_readOffset;
 }
 
 
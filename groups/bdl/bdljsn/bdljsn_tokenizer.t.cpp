@@ -27,6 +27,7 @@
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
 #include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -61,6 +62,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [10] void reset(bsl::streambuf &streamBuf);
+// [20] void reset(const bsl::string_view& input);
 // [13] void resetStreamBufGetPointer();
 // [14] void setAllowStandAloneValues(bool value);
 // [15] void setAllowHeterogenousArrays(bool value);
@@ -80,7 +82,8 @@ using bsl::endl;
 // [19] Uint64 currentPosition() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [20] USAGE EXAMPLE
+// [20] CONCERN: CONTIGUOUS INPUT IS TOKENIZED AS A 'streambuf'
+// [21] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -489,6 +492,94 @@ static const struct Utf8Data {
 };
 enum { k_NUM_UTF8_DATA = sizeof UTF8_DATA / sizeof *UTF8_DATA };
 
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random value in the range '[0 .. 32767]'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+void generateJson(bsl::string *result, unsigned int *seed, int depth)
+    // Append to the specified 'result' a pseudo-random sequence of JSON
+    // fragments, mostly forming nested arrays and objects, generated using
+    // the specified 'seed' at the specified nesting 'depth'.  Occasionally
+    // append a fragment that is not well-formed JSON or that this tokenizer
+    // treats differently from the JSON grammar.
+{
+    static const char *const GOOD[] = {
+        "\"a\"", "\"bc\"", "\"\"", "\"\\\"\"", "\"\\\\\"", "\"\xc3\xa9\"",
+        "1", "-2.5", "true", "null", "{}", "[]", "[1,2]", "{\"k\":1}",
+        ",", ",", ",", ":", " ", "\n", "\"k\":",
+    };
+    static const char *const JUNK[] = {
+        "\v", "\f", "\"", "\\", "x", "\x01", "\xff", "{", "}", "[", "]",
+    };
+    const int NUM_GOOD = static_cast<int>(sizeof GOOD / sizeof *GOOD);
+    const int NUM_JUNK = static_cast<int>(sizeof JUNK / sizeof *JUNK);
+
+    const bool isObject = nextRandom(seed) % 2;
+    result->push_back(isObject ? '{' : '[');
+
+    const int numFragments = static_cast<int>(nextRandom(seed) % 12);
+    for (int i = 0; i < numFragments; ++i) {
+        const unsigned int pick = nextRandom(seed) % 64;
+        if (pick < 2) {
+            result->append(JUNK[nextRandom(seed) % NUM_JUNK]);
+        }
+        else if (pick < 10 && depth < 4) {
+            generateJson(result, seed, depth + 1);
+        }
+        else {
+            result->append(GOOD[nextRandom(seed) % NUM_GOOD]);
+        }
+    }
+
+    result->push_back(isObject ? '}' : ']');
+}
+
+void traceTokens(bsl::string *trace, Obj *tokenizer)
+    // Load into the specified 'trace' a description of the result of each
+    // call to 'advanceToNextToken' on the specified 'tokenizer' until that
+    // call fails, including the resulting token type, value, read status, and
+    // current position.
+{
+    trace->clear();
+
+    int rc = 0;
+    while (0 == rc) {
+        rc = tokenizer->advanceToNextToken();
+
+        char buffer[64];
+        bsl::sprintf(buffer,
+                     "%d %d %d %llu",
+                     rc,
+                     static_cast<int>(tokenizer->tokenType()),
+                     tokenizer->readStatus(),
+                     static_cast<unsigned long long>(
+                                               tokenizer->currentPosition()));
+        trace->append(buffer);
+
+        bsl::string_view value;
+        if (0 == tokenizer->value(&value)) {
+            trace->append(" <");
+            trace->append(value.data(), value.length());
+            trace->push_back('>');
+        }
+        trace->push_back('\n');
+    }
+}
+
+void setOptions(Obj *tokenizer, int options)
+    // Set the options of the specified 'tokenizer' from the 4 low-order bits
+    // of the specified 'options'.
+{
+    tokenizer->setAllowStandAloneValues(     options & 1);
+    tokenizer->setAllowHeterogenousArrays(   options & 2);
+    tokenizer->setAllowNonUtf8StringLiterals(options & 4);
+    tokenizer->setAllowTrailingTopLevelComma(options & 8);
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -507,7 +598,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -639,6 +730,270 @@ int main(int argc, char *argv[])
     ASSERT(55              == address.d_floorCount);
 //..
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONTIGUOUS INPUT IS TOKENIZED AS A 'streambuf'
+        //
+        // Concerns:
+        //: 1 A tokenizer reset to a contiguous input produces the same
+        //:   sequence of token types, values, read statuses, and positions,
+        //:   and fails at the same token, as a tokenizer reading the same
+        //:   data from a 'streambuf', for every combination of options.
+        //:
+        //: 2 This holds for input that the structural index rejects (invalid
+        //:   UTF-8, unbalanced brackets, unterminated strings, control
+        //:   characters), and for input where the tokenizer splits tokens
+        //:   differently from the index ('\v', '\f', '1"a"').
+        //:
+        //: 3 This holds for values longer than the internal buffer.
+        //:
+        //: 4 Values of well-formed contiguous input refer into the input.
+        //:
+        //: 5 'resetStreamBufGetPointer' has no effect on contiguous input, and
+        //:   'readOffset() >= currentPosition()' for well-formed input.
+        //:
+        //: 6 'reset' with a 'streambuf' after contiguous input resumes
+        //:   reading the 'streambuf'.
+        //:
+        //: 7 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, for a set of inputs covering
+        //:   well-formed, malformed, and unusual JSON, and for each of the 16
+        //:   combinations of options, tokenize the input from a
+        //:   'bdlsb::FixedMemInStreamBuf' and as contiguous input, and verify
+        //:   that the traces of both are identical.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for documents containing 'LARGE_STRING_C_STR'.  (C-3)
+        //:
+        //: 3 Repeat P-1 for pseudo-random nested arrays and objects of
+        //:   fragments of JSON, some of which are malformed.  (C-1..2)
+        //:
+        //: 4 For well-formed input, verify that each value is a sub-range of
+        //:   the input.  (C-4)
+        //:
+        //: 5 Call 'resetStreamBufGetPointer' and 'readOffset' after
+        //:   tokenizing contiguous input.  (C-5)
+        //:
+        //: 6 Reset a tokenizer to a 'streambuf' after contiguous input and
+        //:   verify the tokens.  (C-6)
+        //:
+        //: 7 Install a test allocator as the default allocator and verify
+        //:   that no memory is allocated from it by the tokenizers.  (C-7)
+        //
+        // Testing:
+        //   void reset(const bsl::string_view& input);
+        //   CONCERN: CONTIGUOUS INPUT IS TOKENIZED AS A 'streambuf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "CONCERN: CONTIGUOUS INPUT IS TOKENIZED AS A 'streambuf'"
+              << endl
+              << "======================================================="
+              << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::TestAllocator         oa("object",  veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj streamTokenizer(&oa);
+        Obj inputTokenizer(&oa);
+
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+        bsl::string          streamTrace(&sa);
+        bsl::string          inputTrace(&sa);
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+        } DATA[] = {
+            // LINE  INPUT
+            // ----  -----------------------------------------------------
+            { L_,    ""                                                    },
+            { L_,    "   \n\t "                                            },
+            { L_,    "{}"                                                  },
+            { L_,    "[]"                                                  },
+            { L_,    " { \"a\" : 1 , \"b\" : [ true , null , \"x\" ] } "   },
+            { L_,    "{\"a\":{\"b\":{\"c\":[[],[{}],[1,2]]}}}"             },
+            { L_,    "[\"\",\"a\\\"b\",\"c\\\\\",\"\\\\\\\"\",\"\\u0041\"]"},
+            { L_,    "{\"\":1}"                                            },
+            { L_,    "{\"a\":\"\"}"                                        },
+            { L_,    "[1,\"a\",{},[]]"                                     },
+            { L_,    "[{},[],1]"                                           },
+            { L_,    "1"                                                   },
+            { L_,    "\"abc\""                                             },
+            { L_,    "  -1.5e10  "                                         },
+            { L_,    "{},"                                                 },
+            { L_,    "[],[]"                                               },
+            { L_,    "{}}"                                                 },
+            { L_,    "[1,]"                                                },
+            { L_,    "[,1]"                                                },
+            { L_,    "{\"a\"}"                                             },
+            { L_,    "{\"a\":}"                                            },
+            { L_,    "{\"a\" 1}"                                           },
+            { L_,    "{1:2}"                                               },
+            { L_,    "[1 2]"                                               },
+            { L_,    "[1\"a\"]"                                            },
+            { L_,    "[\"a\"1]"                                            },
+            { L_,    "[\"a\"\"b\"]"                                        },
+            { L_,    "[1\v2]"                                              },
+            { L_,    "[1\v]"                                               },
+            { L_,    "[\v1]"                                               },
+            { L_,    "\f[1,\f2]\f"                                         },
+            { L_,    "{\v\"a\":1}"                                         },
+            { L_,    "[tr\x01ue]"                                          },
+            { L_,    "[1,\"a\tb\"]"                                        },
+            { L_,    "[\"a\nb\",2]"                                        },
+            { L_,    "[\"abc"                                              },
+            { L_,    "[\"abc\\\"]"                                         },
+            { L_,    "[[1]"                                                },
+            { L_,    "[1]]"                                                },
+            { L_,    "[1}"                                                 },
+            { L_,    "{\"a\":[}]"                                          },
+            { L_,    "[\"\xc3\xa9\",\"\xe2\x82\xac\"]"                     },
+            { L_,    "[\"\xc3\"]"                                          },
+            { L_,    "[\"a\",\"\xed\xa0\x80\"]"                            },
+            { L_,    "[1,2]\xff"                                           },
+            { L_,    "[\xe2\x82\xac]"                                      },
+            { L_,    "[1,2] x"                                             },
+            { L_,    "[1,2] \"x"                                           },
+            { L_,    "{\"a\":1}garbage]"                                   },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (veryVerbose) cout << "\tTable-driven inputs." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int               LINE  = DATA[ti].d_line;
+            const bsl::string_view  INPUT = DATA[ti].d_input_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            for (int options = 0; options < 16; ++options) {
+                bdlsb::FixedMemInStreamBuf isb(INPUT.data(), INPUT.length());
+
+                streamTokenizer.reset(&isb);
+                setOptions(&streamTokenizer, options);
+                traceTokens(&streamTrace, &streamTokenizer);
+
+                inputTokenizer.reset(INPUT);
+                setOptions(&inputTokenizer, options);
+                traceTokens(&inputTrace, &inputTokenizer);
+
+                ASSERTV(LINE, options, streamTrace, inputTrace,
+                        streamTrace == inputTrace);
+
+                ASSERTV(LINE, options,
+                        0 == inputTokenizer.resetStreamBufGetPointer());
+            }
+        }
+
+        if (veryVerbose) cout << "\tValues longer than the buffer." << endl;
+        {
+            const bsl::string_view LARGE = LARGE_STRING_C_STR;
+
+            bsl::string input(&sa);
+            input.append("[{\"a\":");
+            input.append(LARGE.data(), LARGE.length());
+            input.append("},");
+            input.append(LARGE.data(), LARGE.length());
+            input.append(",");
+            input.append(LARGE.data() + 1, LARGE.length() - 1);
+            input.append(",");
+            input.append(LARGE.data() + 1, LARGE.length() - 2);
+            input.append("]");
+
+            for (int options = 0; options < 16; ++options) {
+                bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+                streamTokenizer.reset(&isb);
+                setOptions(&streamTokenizer, options);
+                traceTokens(&streamTrace, &streamTokenizer);
+
+                inputTokenizer.reset(input);
+                setOptions(&inputTokenizer, options);
+                traceTokens(&inputTrace, &inputTokenizer);
+
+                ASSERTV(options, streamTrace == inputTrace);
+            }
+        }
+
+        if (veryVerbose) cout << "\tPseudo-random inputs." << endl;
+        {
+            bsl::string  input(&sa);
+            unsigned int seed = 12345;
+
+            for (int ti = 0; ti < 5000; ++ti) {
+                input.clear();
+                generateJson(&input, &seed, 0);
+
+                for (int options = 0; options < 16; ++options) {
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+
+                    streamTokenizer.reset(&isb);
+                    setOptions(&streamTokenizer, options);
+                    traceTokens(&streamTrace, &streamTokenizer);
+
+                    inputTokenizer.reset(input);
+                    setOptions(&inputTokenizer, options);
+                    traceTokens(&inputTrace, &inputTokenizer);
+
+                    ASSERTV(ti, options, input, streamTrace, inputTrace,
+                            streamTrace == inputTrace);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tValues refer into the input." << endl;
+        {
+            const bsl::string_view INPUT =
+                             "{\"name\": \"value\", \"list\": [1, \"two\"]}";
+
+            Obj mX(&oa);
+            mX.reset(INPUT);
+
+            int numValues = 0;
+            while (0 == mX.advanceToNextToken()) {
+                bsl::string_view value;
+                if (0 == mX.value(&value)) {
+                    ASSERTV(value, INPUT.data() <= value.data());
+                    ASSERTV(value, value.data() + value.length() <=
+                                                INPUT.data() + INPUT.length());
+                    ++numValues;
+                }
+                ASSERT(mX.currentPosition() <= mX.readOffset());
+            }
+            ASSERTV(numValues, 5 == numValues);
+            ASSERT(0 == mX.resetStreamBufGetPointer());
+        }
+
+        if (veryVerbose) cout << "\tReset to a 'streambuf'." << endl;
+        {
+            const bsl::string_view INPUT = "[\"a\"1]";
+            const char             DOC[] = "[\"a\",1]";
+
+            Obj mX(&oa);
+            mX.reset(INPUT);
+            while (0 == mX.advanceToNextToken()) {
+            }
+
+            bdlsb::FixedMemInStreamBuf isb(DOC, sizeof DOC - 1);
+            mX.reset(&isb);
+
+            ASSERT(0                  == mX.advanceToNextToken());
+            ASSERT(Obj::e_START_ARRAY == mX.tokenType());
+            ASSERT(0                  == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == mX.tokenType());
+            ASSERT(0                  == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == mX.tokenType());
+            ASSERT(0                  == mX.advanceToNextToken());
+            ASSERT(Obj::e_END_ARRAY   == mX.tokenType());
+            ASSERT(0                  == mX.resetStreamBufGetPointer());
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING 'currentPosition'
@@ -713,6 +713,13 @@ class ConcurrentMultipool {
         // where 'numPools' is either specified at construction, or an
         // implementation-defined value.
 
+    int poolIndex(const void *address) const;
+        // Return the index of the memory pool that dispensed the memory block
+        // at the specified 'address', or -1 if that block was too large to be
+        // pooled.  The behavior is undefined unless 'address' was allocated
+        // by this multipool and has not since been deallocated.  Note that
+        // the memory pool having index 'i' dispenses blocks of
+        // 'maxPooledBlockSize() >> (numPools() - 1 - i)' bytes.
 
                                   // Aspects
 
@@ -758,6 +765,12 @@ bsls::Types::size_type ConcurrentMultipool::maxPooledBlockSize() const
     return d_maxBlockSize;
 }
 
+inline
+int ConcurrentMultipool::poolIndex(const void *address) const
+{
+    return (static_cast<const Header *>(address) - 1)->d_header.d_poolIdx;
+}
+
 // Aspects
 
 inline
@@ -66,11 +66,12 @@ using namespace bsl;  // automatically added by script
 // [ 9] void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+// [12] int poolIndex(const void *address) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] CONCURRENCY TEST
 // [11] OLD USAGE EXAMPLE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -662,7 +663,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -731,6 +732,61 @@ int main(int argc, char *argv[])
             // Now 'pM' and 'pBuf' are also invalid addresses.
         }
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'poolIndex'
+        //
+        // Concerns:
+        //: 1 'poolIndex' returns the index of the pool that dispensed a block,
+        //:   i.e., of the pool having the smallest block size not less than
+        //:   the requested size.
+        //:
+        //: 2 'poolIndex' returns -1 for a block too large to be pooled.
+        //:
+        //: 3 The block size of the pool having index 'i' is
+        //:   'maxPooledBlockSize() >> (numPools() - 1 - i)'.
+        //
+        // Plan:
+        //: 1 For multipools having a range of numbers of pools, allocate
+        //:   blocks of every size up to and somewhat beyond the maximum
+        //:   pooled block size, and verify that 'poolIndex' returns the
+        //:   expected index, computed with 'calcPool', and that the block
+        //:   size of that pool is the smallest one not less than the requested
+        //:   size.  (C-1..3)
+        //
+        // Testing:
+        //   int poolIndex(const void *address) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'poolIndex'" << endl
+                                  << "===================" << endl;
+
+        for (int numPools = 1; numPools <= 8; ++numPools) {
+            Obj mX(numPools, Z);  const Obj& X = mX;
+
+            const int MAX = static_cast<int>(X.maxPooledBlockSize());
+
+            for (int size = 1; size <= MAX + 16; ++size) {
+                void *p = mX.allocate(size);
+
+                const int EXP = calcPool(numPools, size);
+                const int IDX = X.poolIndex(p);
+
+                LOOP3_ASSERT(numPools, size, IDX, EXP == IDX);
+
+                if (0 <= IDX) {
+                    const int BLOCK_SIZE = MAX >> (numPools - 1 - IDX);
+
+                    LOOP3_ASSERT(numPools, size, BLOCK_SIZE,
+                                 size <= BLOCK_SIZE);
+                    LOOP3_ASSERT(numPools, size, BLOCK_SIZE,
+                                 0 == IDX || BLOCK_SIZE / 2 < size);
+                }
+
+                mX.deallocate(p);
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
@@ -0,0 +1,431 @@
+// bdlma_threadcachingmultipoolallocator.cpp                          -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+
+#include <new>           // placement 'new'
+
+namespace BloombergLP {
+namespace bdlma {
+namespace {
+
+enum {
+    k_DEFAULT_MAX_CACHED_BLOCKS = 64,  // capacity of each magazine if none is
+                                       // specified at construction
+
+    k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE
+};
+
+struct FreeBlock {
+    // This 'struct' overlays the first bytes of a free block held in a
+    // magazine.
+
+    FreeBlock *d_next_p;  // next free block in the magazine
+};
+
+struct Magazine {
+    // This 'struct' provides a list of free blocks of a single size, owned by
+    // a single thread.
+
+    FreeBlock *d_head_p;  // first free block, or 0 if empty
+    int        d_length;  // number of free blocks
+};
+
+inline
+void releaseBlocks(ConcurrentMultipool *multipool,
+                   Magazine            *magazine,
+                   int                  numBlocks)
+    // Return up to the specified 'numBlocks' free blocks from the front of
+    // the specified 'magazine' to the specified 'multipool'.
+{
+    FreeBlock *block = magazine->d_head_p;
+
+    for (int i = 0; i < numBlocks && block; ++i) {
+        FreeBlock *next = block->d_next_p;
+        multipool->deallocate(block);
+        block = next;
+        --magazine->d_length;
+    }
+    magazine->d_head_p = block;
+}
+
+}  // close unnamed namespace
+
+               // --------------------------------------------------
+               // struct ThreadCachingMultipoolAllocator::ThreadCache
+               // --------------------------------------------------
+
+struct ThreadCachingMultipoolAllocator::ThreadCache {
+    // This 'struct' holds the magazines of a single thread, one per pool.
+    // Each thread cache occupies cache lines of its own, so that the threads
+    // using an allocator do not write to shared cache lines.
+
+    // DATA
+    ThreadCachingMultipoolAllocator *d_owner_p;       // allocator owning this
+                                                      // cache
+
+    void                            *d_allocation_p;  // memory holding this
+                                                      // cache
+
+    ThreadCache                     *d_next_p;        // next cache of
+                                                      // 'd_owner_p'
+
+    ThreadCache                     *d_prev_p;        // previous cache of
+                                                      // 'd_owner_p'
+
+    bsls::AtomicUint64               d_numHits;       // allocations satisfied
+                                                      // from this cache
+
+    bsls::AtomicUint64               d_numMisses;     // allocations requiring
+                                                      // a refill
+
+    Magazine                        *d_magazines_p;   // one magazine per pool
+};
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingMultipoolAllocator::removeThreadCache(void *threadCache)
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(threadCache);
+
+    if (cache) {
+        cache->d_owner_p->destroyThreadCache(cache);
+    }
+}
+
+// PRIVATE MANIPULATORS
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::createThreadCache()
+{
+    const int              numPools = d_multipool.numPools();
+    bsls::Types::size_type size     = sizeof(ThreadCache)
+                                                + numPools * sizeof(Magazine);
+    size = (size + k_CACHE_LINE_SIZE - 1) & ~(k_CACHE_LINE_SIZE - 1);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    void *allocation = d_allocator_p->allocate(size + k_CACHE_LINE_SIZE - 1);
+
+    bsls::Types::UintPtr address =
+                            reinterpret_cast<bsls::Types::UintPtr>(allocation);
+    address = (address + k_CACHE_LINE_SIZE - 1) & ~(k_CACHE_LINE_SIZE - 1);
+
+    ThreadCache *cache = new (reinterpret_cast<void *>(address)) ThreadCache();
+
+    cache->d_owner_p      = this;
+    cache->d_allocation_p = allocation;
+    cache->d_prev_p       = 0;
+    cache->d_magazines_p  = reinterpret_cast<Magazine *>(cache + 1);
+
+    for (int i = 0; i < numPools; ++i) {
+        cache->d_magazines_p[i].d_head_p = 0;
+        cache->d_magazines_p[i].d_length = 0;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+        cache->~ThreadCache();
+        d_allocator_p->deallocate(allocation);
+        return 0;                                                     // RETURN
+    }
+
+    cache->d_next_p = d_threadCaches_p;
+    if (d_threadCaches_p) {
+        d_threadCaches_p->d_prev_p = cache;
+    }
+    d_threadCaches_p = cache;
+    ++d_numThreadCaches;
+
+    return cache;
+}
+
+void ThreadCachingMultipoolAllocator::destroyThreadCache(
+                                                      ThreadCache *threadCache)
+{
+    const int numPools = d_multipool.numPools();
+
+    for (int i = 0; i < numPools; ++i) {
+        Magazine *magazine = &threadCache->d_magazines_p[i];
+        releaseBlocks(&d_multipool, magazine, magazine->d_length);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_numRetiredHits   += threadCache->d_numHits.loadRelaxed();
+    d_numRetiredMisses += threadCache->d_numMisses.loadRelaxed();
+
+    if (threadCache->d_prev_p) {
+        threadCache->d_prev_p->d_next_p = threadCache->d_next_p;
+    }
+    else {
+        d_threadCaches_p = threadCache->d_next_p;
+    }
+    if (threadCache->d_next_p) {
+        threadCache->d_next_p->d_prev_p = threadCache->d_prev_p;
+    }
+    --d_numThreadCaches;
+
+    void *allocation = threadCache->d_allocation_p;
+    threadCache->~ThreadCache();
+    d_allocator_p->deallocate(allocation);
+}
+
+inline
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::lookupThreadCache()
+{
+    if (0 == d_maxCachedBlocks) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCache *cache =
+             static_cast<ThreadCache *>(bslmt::ThreadUtil::getSpecific(d_key));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        cache = createThreadCache();
+    }
+    return cache;
+}
+
+void ThreadCachingMultipoolAllocator::initialize(int maxCachedBlocks)
+{
+    BSLS_ASSERT(0 <= maxCachedBlocks);
+
+    d_minBlockSizeLog2 = bdlb::BitUtil::log2(
+                 static_cast<bsl::uint64_t>(d_multipool.maxPooledBlockSize()))
+                       - (d_multipool.numPools() - 1);
+
+    if (0 < maxCachedBlocks
+     && 0 != bslmt::ThreadUtil::createKey(
+                   &d_key,
+                   (bslmt::ThreadUtil::Destructor)
+                   &ThreadCachingMultipoolAllocator::removeThreadCache)) {
+        maxCachedBlocks = 0;
+    }
+
+    d_maxCachedBlocks = maxCachedBlocks;
+    d_batchSize       = 1 < maxCachedBlocks ? maxCachedBlocks / 2 : 1;
+}
+
+// CREATORS
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(basicAllocator)
+, d_maxCachedBlocks(0)
+, d_batchSize(1)
+, d_minBlockSizeLog2(0)
+, d_key()
+, d_threadCaches_p(0)
+, d_numThreadCaches(0)
+, d_numRetiredHits(0)
+, d_numRetiredMisses(0)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(k_DEFAULT_MAX_CACHED_BLOCKS);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                             int               numPools,
+                                             int               maxCachedBlocks,
+                                             bslma::Allocator *basicAllocator)
+: d_multipool(numPools, basicAllocator)
+, d_maxCachedBlocks(0)
+, d_batchSize(1)
+, d_minBlockSizeLog2(0)
+, d_key()
+, d_threadCaches_p(0)
+, d_numThreadCaches(0)
+, d_numRetiredHits(0)
+, d_numRetiredMisses(0)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(maxCachedBlocks);
+}
+
+ThreadCachingMultipoolAllocator::~ThreadCachingMultipoolAllocator()
+{
+    if (0 < d_maxCachedBlocks) {
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    // The blocks held by the remaining thread caches are released with the
+    // multipool.
+
+    while (d_threadCaches_p) {
+        ThreadCache *cache = d_threadCaches_p;
+        d_threadCaches_p = cache->d_next_p;
+
+        void *allocation = cache->d_allocation_p;
+        cache->~ThreadCache();
+        d_allocator_p->deallocate(allocation);
+    }
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCache *cache;
+
+    if (size > d_multipool.maxPooledBlockSize()
+     || 0 == (cache = lookupThreadCache())) {
+        return d_multipool.allocate(size);                            // RETURN
+    }
+
+    int pool = bdlb::BitUtil::log2(static_cast<bsl::uint64_t>(size))
+                                                          - d_minBlockSizeLog2;
+    if (pool < 0) {
+        pool = 0;
+    }
+
+    Magazine&  magazine = cache->d_magazines_p[pool];
+    FreeBlock *block    = magazine.d_head_p;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != block)) {
+        magazine.d_head_p = block->d_next_p;
+        --magazine.d_length;
+
+        cache->d_numHits.storeRelaxed(cache->d_numHits.loadRelaxed() + 1);
+        return block;                                                 // RETURN
+    }
+
+    cache->d_numMisses.storeRelaxed(cache->d_numMisses.loadRelaxed() + 1);
+
+    // Refill the magazine with all but one block of a batch, then return the
+    // last one, so that the magazine is consistent if an allocation throws.
+
+    const bsls::Types::size_type blockSize =
+       static_cast<bsls::Types::size_type>(1) << (pool + d_minBlockSizeLog2);
+
+    for (int i = 1; i < d_batchSize; ++i) {
+        block = static_cast<FreeBlock *>(d_multipool.allocate(blockSize));
+        block->d_next_p   = magazine.d_head_p;
+        magazine.d_head_p = block;
+        ++magazine.d_length;
+    }
+
+    return d_multipool.allocate(blockSize);
+}
+
+void ThreadCachingMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    const int    pool = d_multipool.poolIndex(address);
+    ThreadCache *cache;
+
+    if (pool < 0 || 0 == (cache = lookupThreadCache())) {
+        d_multipool.deallocate(address);
+        return;                                                       // RETURN
+    }
+
+    Magazine&  magazine = cache->d_magazines_p[pool];
+    FreeBlock *block    = static_cast<FreeBlock *>(address);
+
+    block->d_next_p   = magazine.d_head_p;
+    magazine.d_head_p = block;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                  ++magazine.d_length > d_maxCachedBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        releaseBlocks(&d_multipool, &magazine, d_batchSize);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::flushThreadCache()
+{
+    if (0 == d_maxCachedBlocks) {
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache =
+             static_cast<ThreadCache *>(bslmt::ThreadUtil::getSpecific(d_key));
+
+    if (cache) {
+        const int numPools = d_multipool.numPools();
+
+        for (int i = 0; i < numPools; ++i) {
+            Magazine *magazine = &cache->d_magazines_p[i];
+            releaseBlocks(&d_multipool, magazine, magazine->d_length);
+        }
+    }
+}
+
+// ACCESSORS
+bsls::Types::Uint64 ThreadCachingMultipoolAllocator::numCacheHits() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bsls::Types::Uint64 result = d_numRetiredHits;
+    for (const ThreadCache *cache = d_threadCaches_p;
+         cache;
+         cache = cache->d_next_p) {
+        result += cache->d_numHits.loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Uint64 ThreadCachingMultipoolAllocator::numCacheMisses() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bsls::Types::Uint64 result = d_numRetiredMisses;
+    for (const ThreadCache *cache = d_threadCaches_p;
+         cache;
+         cache = cache->d_next_p) {
+        result += cache->d_numMisses.loadRelaxed();
+    }
+    return result;
+}
+
+int ThreadCachingMultipoolAllocator::numThreadCaches() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numThreadCaches;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,353 @@
+// bdlma_threadcachingmultipoolallocator.h                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingMultipoolAllocator: thread-caching multipool allocator
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentmultipool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingMultipoolAllocator', that implements the
+// 'bslma::Allocator' protocol by placing a per-thread cache of free memory
+// blocks in front of a 'bdlma::ConcurrentMultipool'.  Like
+// 'bdlma::ConcurrentMultipoolAllocator', the allocator dispenses memory from
+// a configurable number of pools, each managing blocks of a single size that
+// is twice that of the previous pool, and allocates blocks too large to be
+// pooled directly from the underlying multipool.  Unlike
+// 'bdlma::ConcurrentMultipoolAllocator', the allocator returns pooled blocks
+// to the calling thread's cache when they are deallocated, so that they can
+// be reused without accessing the shared free lists of the pools.
+//
+///Thread Caches
+///-------------
+// Each thread that allocates or deallocates a pooled block through the
+// allocator is given a *thread* *cache*: for each pool, a list (or
+// "magazine") of up to 'maxCachedBlocks()' free blocks of that pool's block
+// size.  An allocation is satisfied from the calling thread's magazine for
+// the corresponding pool (a cache *hit*) when that magazine is not empty;
+// otherwise (a cache *miss*), the magazine is refilled with a batch of
+// 'max(1, maxCachedBlocks() / 2)' blocks from the underlying multipool, one
+// of which is returned.  A deallocated block is added to the magazine of the
+// deallocating thread (which need not be the thread that allocated the block)
+// and, when that magazine becomes full, a batch of the same size is returned
+// from it to the underlying multipool.  Neither operation on a thread cache
+// requires synchronization, and the batched refills and releases touch the
+// free list of a pool in bursts, so that threads allocating small objects
+// concurrently rarely contend for the cache lines holding the free lists of
+// the pools.  The technique is that of the thread caches of "TCMalloc:
+// Thread-Caching Malloc" (Ghemawat and Menage), and of the "magazines" of
+// "Magazines and Vmem" (Bonwick and Adams, USENIX 2001).
+//
+// A thread cache is created on the first pooled allocation or deallocation
+// made by a thread, and is destroyed when that thread exits, at which time the
+// blocks it holds are returned to the underlying multipool (see
+// 'bslmt::ThreadUtil::createKey').  'flushThreadCache' returns the blocks
+// held by the calling thread's cache to the underlying multipool without
+// waiting for the thread to exit.  Memory is relinquished to the allocator
+// supplied at construction only when the allocator is destroyed.
+//
+// Each thread cache holds at most 'numPools() * maxCachedBlocks()' blocks,
+// whose total size can be as large as 'maxCachedBlocks()' times twice the
+// maximum pooled block size.  Caching can be disabled by specifying 0 for
+// 'maxCachedBlocks' at construction, in which case the allocator behaves as a
+// 'bdlma::ConcurrentMultipool' (whose blocks are reused on deallocation).
+//
+// Each allocator consumes one thread-specific storage key (see
+// 'bslmt::ThreadUtil::createKey') for its lifetime.  Since the number of such
+// keys is limited on most platforms, this allocator is intended for
+// long-lived, process-wide use rather than as a short-lived local allocator.
+// If no key can be obtained at construction, caching is disabled.
+//
+///Statistics
+///----------
+// The allocator counts, over all threads, the pooled allocations satisfied
+// from a thread cache ('numCacheHits') and those that required a refill
+// ('numCacheMisses'); allocations too large to be pooled are counted in
+// neither.  The counts maintained by each thread are updated without
+// read-modify-write operations, so that they impose no synchronization on
+// the allocating thread; the totals reported while other threads are
+// allocating are therefore approximate.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingMultipoolAllocator' is *fully thread-safe*, meaning
+// any operation on the same object can be safely invoked from any thread.
+// The behavior is undefined if a thread that has used an allocator exits
+// while that allocator is being destroyed, or if an allocator is used from a
+// thread-specific storage cleanup function.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Small Objects From Many Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads frequently create and destroy small objects,
+// such as the nodes of a container, and that we want to minimize the
+// contention among them for the free lists of a shared multipool.
+//
+// First, we create a thread-caching multipool allocator managing 6 pools
+// (i.e., pooling blocks of up to 256 bytes), each thread cache holding at
+// most 32 blocks of each pool:
+//..
+//  bdlma::ThreadCachingMultipoolAllocator allocator(6, 32);
+//  assert(256 == allocator.maxPooledBlockSize());
+//..
+// Then, we allocate a few blocks.  The first allocation of a given size
+// refills the calling thread's cache, while the following ones are satisfied
+// from it:
+//..
+//  void *p1 = allocator.allocate(24);
+//  void *p2 = allocator.allocate(24);
+//  void *p3 = allocator.allocate(20);
+//  assert(1 == allocator.numCacheMisses());
+//  assert(2 == allocator.numCacheHits());
+//..
+// Next, we deallocate the blocks, which returns them to the thread cache, and
+// allocate again, which reuses one of them:
+//..
+//  allocator.deallocate(p1);
+//  allocator.deallocate(p2);
+//  allocator.deallocate(p3);
+//
+//  void *p4 = allocator.allocate(32);
+//  assert(3 == allocator.numCacheHits());
+//  allocator.deallocate(p4);
+//..
+// Finally, we return the blocks held by this thread's cache to the underlying
+// multipool, e.g., before the thread enters a long period of inactivity:
+//..
+//  allocator.flushThreadCache();
+//
+//  void *p5 = allocator.allocate(32);
+//  assert(2 == allocator.numCacheMisses());
+//  allocator.deallocate(p5);
+//..
+// Note that threads created with 'bslmt::ThreadUtil' need take no action to
+// release their caches, which are reclaimed when they exit.
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentmultipool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                   // =====================================
+                   // class ThreadCachingMultipoolAllocator
+                   // =====================================
+
+class ThreadCachingMultipoolAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide a
+    // thread-safe allocator that dispenses pooled memory blocks from a
+    // per-thread cache refilled from, and drained to, an owned
+    // 'bdlma::ConcurrentMultipool'.
+
+    // PRIVATE TYPES
+    struct ThreadCache;  // per-thread magazines of free blocks (defined in the
+                         // implementation)
+
+    // DATA
+    ConcurrentMultipool     d_multipool;         // source of all memory
+
+    int                     d_maxCachedBlocks;   // capacity of each magazine,
+                                                 // or 0 if caching is disabled
+
+    int                     d_batchSize;         // number of blocks moved
+                                                 // between a magazine and the
+                                                 // multipool at once
+
+    int                     d_minBlockSizeLog2;  // base-2 logarithm of the
+                                                 // block size of pool 0
+
+    bslmt::ThreadUtil::Key  d_key;               // key of the calling thread's
+                                                 // cache (valid only if
+                                                 // 'd_maxCachedBlocks')
+
+    ThreadCache            *d_threadCaches_p;    // list of live thread caches
+
+    int                     d_numThreadCaches;   // length of
+                                                 // 'd_threadCaches_p'
+
+    bsls::Types::Uint64     d_numRetiredHits;    // cache hits counted by
+                                                 // destroyed thread caches
+
+    bsls::Types::Uint64     d_numRetiredMisses;  // cache misses counted by
+                                                 // destroyed thread caches
+
+    mutable bslmt::Mutex    d_mutex;             // guard the list of thread
+                                                 // caches and retired counts
+
+    bslma::Allocator       *d_allocator_p;       // allocator of thread caches
+                                                 // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipoolAllocator(const ThreadCachingMultipoolAllocator&);
+    ThreadCachingMultipoolAllocator& operator=(
+                                       const ThreadCachingMultipoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void removeThreadCache(void *threadCache);
+        // Return the blocks held by the specified 'threadCache' to the
+        // multipool of the allocator owning it, and destroy 'threadCache'.
+        // This function is the thread-specific storage cleanup function of
+        // the key of every allocator.
+
+    // PRIVATE MANIPULATORS
+    ThreadCache *createThreadCache();
+        // Create a thread cache for the calling thread, register it with this
+        // allocator, and return its address, or return 0 if it could not be
+        // associated with the calling thread.
+
+    void destroyThreadCache(ThreadCache *threadCache);
+        // Return the blocks held by the specified 'threadCache' to the
+        // multipool, unregister 'threadCache' from this allocator, and
+        // destroy it.
+
+    ThreadCache *lookupThreadCache();
+        // Return the address of the thread cache of the calling thread,
+        // creating it if necessary, or 0 if caching is disabled or the cache
+        // could not be created.
+
+    void initialize(int maxCachedBlocks);
+        // Initialize the thread caching of this allocator to hold at most the
+        // specified 'maxCachedBlocks' in each magazine.
+
+  public:
+    // CREATORS
+    explicit ThreadCachingMultipoolAllocator(
+                                         bslma::Allocator *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(int               numPools,
+                                    int               maxCachedBlocks,
+                                    bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching multipool allocator.  Optionally specify
+        // the 'numPools' of the underlying multipool, each pool dispensing
+        // blocks of twice the size of the previous one, beginning with 8
+        // bytes; if 'numPools' is not specified, an implementation-defined
+        // value is used.  Optionally specify 'maxCachedBlocks', the maximum
+        // number of blocks of each pool held in the cache of each thread; if
+        // 'maxCachedBlocks' is not specified, an implementation-defined value
+        // is used, and if it is 0, no blocks are cached.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numPools' and '0 <= maxCachedBlocks'.
+
+    ~ThreadCachingMultipoolAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator, and release all memory allocated through
+        // it, including the memory cached for any thread.  The behavior is
+        // undefined if this allocator is used concurrently with its
+        // destruction, or if a thread that has used it exits concurrently with
+        // its destruction.
+
+    // MANIPULATORS
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes).  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  If 'size <= maxPooledBlockSize()',
+        // the block is taken from the calling thread's cache if possible.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' to this
+        // allocator.  If 'address' is 0, this function has no effect.  A
+        // pooled block is added to the calling thread's cache, from which
+        // blocks are returned to the underlying multipool when it is full.
+        // The behavior is undefined unless 'address' was allocated by this
+        // allocator, in any thread, and has not already been deallocated.
+
+    void flushThreadCache();
+        // Return all blocks held by the cache of the calling thread to the
+        // underlying multipool.  Note that the cache of a thread is flushed
+        // automatically when the thread exits.
+
+    // ACCESSORS
+    int maxCachedBlocks() const;
+        // Return the maximum number of blocks of each pool held in the cache
+        // of each thread, or 0 if caching is disabled.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the size of the largest block pooled by this allocator.
+
+    bsls::Types::Uint64 numCacheHits() const;
+        // Return the number of pooled allocations, over all threads,
+        // satisfied from a thread cache without accessing the underlying
+        // multipool.  Note that this value is approximate while other threads
+        // are allocating.
+
+    bsls::Types::Uint64 numCacheMisses() const;
+        // Return the number of pooled allocations, over all threads, that
+        // required refilling a thread cache from the underlying multipool.
+        // Note that this value is approximate while other threads are
+        // allocating, and that pooled allocations made while caching is
+        // disabled are counted as neither hits nor misses.
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    int numThreadCaches() const;
+        // Return the number of threads currently holding a cache of this
+        // allocator.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::maxCachedBlocks() const
+{
+    return d_maxCachedBlocks;
+}
+
+inline
+bsls::Types::size_type
+ThreadCachingMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_multipool.maxPooledBlockSize();
+}
+
+inline
+int ThreadCachingMultipoolAllocator::numPools() const
+{
+    return d_multipool.numPools();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,969 @@
+// bdlma_threadcachingmultipoolallocator.t.cpp                        -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe allocator that places a cache of
+// free blocks per thread in front of a 'bdlma::ConcurrentMultipool'.  We are
+// concerned that pooled allocations are satisfied from the calling thread's
+// cache when possible, that the caches are bounded, refilled, and drained in
+// batches, that their blocks are returned to the multipool when they are
+// flushed or when their threads exit, that all memory is released at
+// destruction, and that the statistics account for every pooled allocation.
+// A 'bslma::TestAllocator' supplied at construction observes the memory held
+// by the allocator, and a concurrency test exercises allocations and
+// deallocations made in different threads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipoolAllocator(bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int, int, bslma::Allocator *ba = 0);
+// [ 2] ~ThreadCachingMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void flushThreadCache();
+//
+// ACCESSORS
+// [ 2] int maxCachedBlocks() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 3] bsls::Types::Uint64 numCacheHits() const;
+// [ 3] bsls::Types::Uint64 numCacheMisses() const;
+// [ 2] int numPools() const;
+// [ 4] int numThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                     STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipoolAllocator Obj;
+typedef bsls::Types::Uint64                    Uint64;
+
+const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                     HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct AllocatingThread {
+    // This 'struct' provides a functor that allocates and deallocates blocks
+    // of various sizes from an allocator, and optionally flushes its thread
+    // cache, in the thread in which it is invoked.
+
+    // DATA
+    Obj *d_allocator_p;
+    int  d_numBlocks;
+    bool d_flush;
+
+    // MANIPULATORS
+    void operator()()
+        // Allocate 'd_numBlocks' blocks of various sizes from
+        // 'd_allocator_p', write to them, and deallocate them.  Then, if
+        // 'd_flush' is 'true', flush the calling thread's cache.
+    {
+        bsl::vector<char *> blocks;
+        blocks.reserve(d_numBlocks);
+
+        for (int i = 0; i < d_numBlocks; ++i) {
+            const int size = 1 + i % 100;
+
+            char *p = static_cast<char *>(d_allocator_p->allocate(size));
+            bsl::memset(p, i & 0xff, size);
+            blocks.push_back(p);
+        }
+        for (int i = 0; i < d_numBlocks; ++i) {
+            d_allocator_p->deallocate(blocks[i]);
+        }
+        if (d_flush) {
+            d_allocator_p->flushThreadCache();
+        }
+    }
+};
+
+struct ExchangingThread {
+    // This 'struct' provides a functor that allocates blocks, verifies and
+    // deallocates the blocks allocated by its peer thread, and repeats, so
+    // that blocks are regularly deallocated by a thread other than the one
+    // that allocated them.
+
+    // DATA
+    Obj             *d_allocator_p;
+    bslmt::Barrier  *d_barrier_p;
+    char           **d_mine_p;      // blocks allocated by this thread
+    char           **d_theirs_p;    // blocks allocated by the peer thread
+    int              d_numBlocks;
+    int              d_numRounds;
+    int              d_id;
+
+    // MANIPULATORS
+    void operator()()
+        // Perform 'd_numRounds' rounds, each allocating 'd_numBlocks' blocks
+        // into 'd_mine_p' and then verifying and deallocating the blocks in
+        // 'd_theirs_p' allocated by the peer thread.
+    {
+        for (int round = 0; round < d_numRounds; ++round) {
+            for (int i = 0; i < d_numBlocks; ++i) {
+                const int size = 1 + (i * 7 + round) % 300;
+
+                char *p = static_cast<char *>(d_allocator_p->allocate(size));
+                bsl::memset(p, d_id, size);
+                d_mine_p[i] = p;
+            }
+
+            d_barrier_p->wait();
+
+            for (int i = 0; i < d_numBlocks; ++i) {
+                const int size = 1 + (i * 7 + round) % 300;
+
+                char *p = d_theirs_p[i];
+                for (int j = 0; j < size; ++j) {
+                    ASSERTV(d_id, round, i, j, 1 - d_id == p[j]);
+                }
+                d_allocator_p->deallocate(p);
+            }
+
+            d_barrier_p->wait();
+        }
+    }
+};
+
+template <class ALLOCATOR>
+struct BenchmarkThread {
+    // This 'struct' provides a functor that repeatedly allocates and
+    // deallocates a window of small blocks.
+
+    // DATA
+    ALLOCATOR *d_allocator_p;
+    int        d_numIterations;
+
+    // MANIPULATORS
+    void operator()()
+        // Allocate and deallocate blocks of small sizes 'd_numIterations'
+        // times, holding up to 16 blocks at once.
+    {
+        enum { k_WINDOW = 16 };
+
+        void *blocks[k_WINDOW] = { 0 };
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            const int slot = i % k_WINDOW;
+
+            if (blocks[slot]) {
+                d_allocator_p->deallocate(blocks[slot]);
+            }
+            blocks[slot] = d_allocator_p->allocate(8 + (i & 0x3f));
+        }
+        for (int i = 0; i < k_WINDOW; ++i) {
+            d_allocator_p->deallocate(blocks[i]);
+        }
+    }
+};
+
+template <class ALLOCATOR>
+double runBenchmark(ALLOCATOR *allocator, int numThreads, int numIterations)
+    // Return the wall-clock time, in seconds, taken by the specified
+    // 'numThreads' threads, each performing the specified 'numIterations'
+    // allocations and deallocations from the specified 'allocator'.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    BenchmarkThread<ALLOCATOR> functor = { allocator, numIterations };
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], functor));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+    }
+
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Small Objects From Many Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads frequently create and destroy small objects,
+// such as the nodes of a container, and that we want to minimize the
+// contention among them for the free lists of a shared multipool.
+//
+// First, we create a thread-caching multipool allocator managing 6 pools
+// (i.e., pooling blocks of up to 256 bytes), each thread cache holding at
+// most 32 blocks of each pool:
+//..
+    bdlma::ThreadCachingMultipoolAllocator allocator(6, 32);
+    ASSERT(256 == allocator.maxPooledBlockSize());
+//..
+// Then, we allocate a few blocks.  The first allocation of a given size
+// refills the calling thread's cache, while the following ones are satisfied
+// from it:
+//..
+    void *p1 = allocator.allocate(24);
+    void *p2 = allocator.allocate(24);
+    void *p3 = allocator.allocate(20);
+    ASSERT(1 == allocator.numCacheMisses());
+    ASSERT(2 == allocator.numCacheHits());
+//..
+// Next, we deallocate the blocks, which returns them to the thread cache, and
+// allocate again, which reuses one of them:
+//..
+    allocator.deallocate(p1);
+    allocator.deallocate(p2);
+    allocator.deallocate(p3);
+
+    void *p4 = allocator.allocate(32);
+    ASSERT(3 == allocator.numCacheHits());
+    allocator.deallocate(p4);
+//..
+// Finally, we return the blocks held by this thread's cache to the underlying
+// multipool, e.g., before the thread enters a long period of inactivity:
+//..
+    allocator.flushThreadCache();
+
+    void *p5 = allocator.allocate(32);
+    ASSERT(2 == allocator.numCacheMisses());
+    allocator.deallocate(p5);
+//..
+// Note that threads created with 'bslmt::ThreadUtil' need take no action to
+// release their caches, which are reclaimed when they exit.
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Blocks may be allocated and deallocated concurrently from any
+        //:   number of threads, and a block may be deallocated by a thread
+        //:   other than the one that allocated it.
+        //:
+        //: 2 No block is dispensed to two threads at once.
+        //:
+        //: 3 The statistics account for every pooled allocation.
+        //:
+        //: 4 The caches of exited threads are reclaimed.
+        //
+        // Plan:
+        //: 1 In pairs of threads, repeatedly allocate blocks filled with a
+        //:   thread-specific value, exchange them with the peer thread, which
+        //:   verifies their content and deallocates them.  (C-1..2)
+        //:
+        //: 2 After joining the threads, verify that the sum of the hits and
+        //:   misses equals the number of pooled allocations, and that no
+        //:   thread cache remains.  (C-3..4)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST" << endl
+                                  << "================" << endl;
+
+        enum {
+            k_NUM_PAIRS  = 4,
+            k_NUM_BLOCKS = 200,
+            k_NUM_ROUNDS = 200
+        };
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(6, 16, &ta);  const Obj& X = mX;
+
+            ASSERT(256 == X.maxPooledBlockSize());
+
+            bsl::vector<char *> blocks(2 * k_NUM_PAIRS * k_NUM_BLOCKS);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(2 * k_NUM_PAIRS);
+            bsl::vector<bslmt::Barrier *>          barriers;
+
+            for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                barriers.push_back(new bslmt::Barrier(2));
+            }
+
+            for (int i = 0; i < 2 * k_NUM_PAIRS; ++i) {
+                const int pair = i / 2;
+                const int id   = i % 2;
+
+                ExchangingThread functor = {
+                    &mX,
+                    barriers[pair],
+                    &blocks[(2 * pair + id) * k_NUM_BLOCKS],
+                    &blocks[(2 * pair + 1 - id) * k_NUM_BLOCKS],
+                    k_NUM_BLOCKS,
+                    k_NUM_ROUNDS,
+                    id
+                };
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], functor));
+            }
+            for (int i = 0; i < 2 * k_NUM_PAIRS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                delete barriers[i];
+            }
+
+            // Sizes range over [1 .. 300]; those above 256 are not pooled.
+
+            Uint64 numPooled = 0;
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    if (1 + (i * 7 + round) % 300 <= 256) {
+                        ++numPooled;
+                    }
+                }
+            }
+            numPooled *= 2 * k_NUM_PAIRS;
+
+            if (veryVerbose) {
+                P_(X.numCacheHits()) P(X.numCacheMisses())
+            }
+
+            ASSERTV(numPooled, X.numCacheHits(), X.numCacheMisses(),
+                    numPooled == X.numCacheHits() + X.numCacheMisses());
+            ASSERTV(X.numCacheHits(), X.numCacheMisses() < X.numCacheHits());
+            ASSERTV(X.numThreadCaches(), 0 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CACHE RECLAMATION
+        //
+        // Concerns:
+        //: 1 'flushThreadCache' returns the blocks held by the calling
+        //:   thread's cache to the multipool, so that subsequent allocations
+        //:   miss, and does not affect the caches of other threads.
+        //:
+        //: 2 'flushThreadCache' has no effect in a thread having no cache, or
+        //:   if caching is disabled.
+        //:
+        //: 3 A thread cache is created on the first pooled allocation or
+        //:   deallocation of a thread, and destroyed when the thread exits,
+        //:   returning its blocks to the multipool.
+        //:
+        //: 4 The statistics of exited threads are retained.
+        //:
+        //: 5 The caches of threads that have not exited are released at
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks, flush the calling thread's cache,
+        //:   and verify that the next allocation misses.  (C-1)
+        //:
+        //: 2 Flush in a thread that has not used the allocator, and with an
+        //:   allocator not caching.  (C-2)
+        //:
+        //: 3 Run threads that allocate and deallocate blocks, with and without
+        //:   flushing their caches, and verify after joining them that no
+        //:   thread cache remains, that the statistics were retained, and that
+        //:   repeating the runs does not grow the memory held by the
+        //:   allocator, i.e., that the blocks cached by the exited threads
+        //:   were reused.  (C-3..4)
+        //:
+        //: 4 Destroy an allocator having a thread cache in the main thread and
+        //:   verify that all memory was released.  (C-5)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        //   int numThreadCaches() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING THREAD CACHE RECLAMATION"
+                          << endl << "================================"
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'flushThreadCache'." << endl;
+        {
+            Obj mX(4, 8, &ta);  const Obj& X = mX;
+
+            mX.flushThreadCache();
+            ASSERT(0 == X.numThreadCaches());
+
+            void *p = mX.allocate(16);
+            ASSERT(1 == X.numThreadCaches());
+            ASSERT(0 == X.numCacheHits());
+            ASSERT(1 == X.numCacheMisses());
+
+            mX.deallocate(p);
+            p = mX.allocate(16);
+            ASSERT(1 == X.numCacheHits());
+
+            mX.deallocate(p);
+            mX.flushThreadCache();
+            ASSERT(1 == X.numThreadCaches());
+
+            p = mX.allocate(16);
+            ASSERT(1 == X.numCacheHits());
+            ASSERT(2 == X.numCacheMisses());
+            mX.deallocate(p);
+
+            Obj mY(4, 0, &ta);
+            mY.flushThreadCache();
+            ASSERT(0 == mY.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting reclamation at thread exit." << endl;
+        {
+            Obj mX(7, 32, &ta);  const Obj& X = mX;
+
+            enum { k_NUM_THREADS = 4, k_NUM_BLOCKS = 1000 };
+
+            bsls::Types::Int64 numBytesAfterFirstRun = 0;
+
+            for (int run = 0; run < 4; ++run) {
+                // The threads run one at a time, so that the peak number of
+                // blocks in use is the same in every run.
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::Handle handle;
+
+                    AllocatingThread functor = {
+                        &mX, k_NUM_BLOCKS, 0 == i % 2
+                    };
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle, functor));
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                }
+
+                ASSERTV(run, X.numThreadCaches(), 0 == X.numThreadCaches());
+
+                const Uint64 EXP = (run + 1) * k_NUM_THREADS * k_NUM_BLOCKS;
+                ASSERTV(run, X.numCacheHits(), X.numCacheMisses(),
+                        EXP == X.numCacheHits() + X.numCacheMisses());
+
+                if (0 == run) {
+                    numBytesAfterFirstRun = ta.numBytesInUse();
+                }
+                else {
+                    ASSERTV(run,
+                            numBytesAfterFirstRun,
+                            ta.numBytesInUse(),
+                            numBytesAfterFirstRun == ta.numBytesInUse());
+                }
+            }
+
+            // Leave a cache in this thread, to be released at destruction.
+
+            void *p = mX.allocate(64);
+            mX.deallocate(p);
+            ASSERT(1 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of at least the
+        //:   requested size, and 0 for a size of 0.
+        //:
+        //: 2 A pooled allocation is a hit if the calling thread's magazine for
+        //:   the corresponding pool is not empty, and a miss otherwise, and
+        //:   only pooled allocations are counted.
+        //:
+        //: 3 A miss refills the magazine with a batch of
+        //:   'max(1, maxCachedBlocks() / 2)' blocks, one of which is returned.
+        //:
+        //: 4 A deallocated pooled block is reused by the next allocation from
+        //:   the same pool in the same thread.
+        //:
+        //: 5 A magazine never holds more than 'maxCachedBlocks()' blocks.
+        //:
+        //: 6 Blocks too large to be pooled are allocated from, and returned
+        //:   to, the multipool directly.
+        //:
+        //: 7 If caching is disabled, no allocation is counted, and no memory
+        //:   is held for the calling thread.
+        //:
+        //: 8 'deallocate' of 0 has no effect.
+        //
+        // Plan:
+        //: 1 For each size up to and beyond the maximum pooled block size,
+        //:   allocate and deallocate, and check the alignment and the reuse
+        //:   of blocks.  (C-1, 4, 6)
+        //:
+        //: 2 For a range of capacities, allocate from an empty magazine and
+        //:   verify the statistics through a complete batch.  (C-2..3)
+        //:
+        //: 3 Allocate many blocks and deallocate them; verify through the
+        //:   number of blocks that can then be allocated without a miss that
+        //:   the magazine is bounded.  (C-5)
+        //:
+        //: 4 Repeat with a capacity of 0.  (C-7)
+        //:
+        //: 5 Deallocate 0.  (C-8)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Uint64 numCacheHits() const;
+        //   bsls::Types::Uint64 numCacheMisses() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'allocate' AND 'deallocate'"
+                          << endl << "==================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tTesting alignment and reuse." << endl;
+        {
+            Obj mX(5, 4, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numCacheHits() + X.numCacheMisses());
+
+            mX.deallocate(0);
+
+            for (int size = 1; size <= 300; ++size) {
+                void *p = mX.allocate(size);
+                ASSERTV(size, p);
+                ASSERTV(size, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                            % MAX_ALIGN);
+                bsl::memset(p, 0xab, size);
+                mX.deallocate(p);
+
+                void *q = mX.allocate(size);
+                if (size <= 128) {
+                    ASSERTV(size, p == q);
+                }
+                mX.deallocate(q);
+            }
+
+            // 2 allocations of each pooled size, in 5 pools of 8 to 128 bytes
+
+            ASSERTV(X.numCacheHits(), X.numCacheMisses(),
+                    256 == X.numCacheHits() + X.numCacheMisses());
+            ASSERTV(X.numCacheMisses(), 5 == X.numCacheMisses());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting batch refills." << endl;
+
+        for (int capacity = 1; capacity <= 20; ++capacity) {
+            Obj mX(3, capacity, &ta);  const Obj& X = mX;
+
+            ASSERTV(capacity, capacity == X.maxCachedBlocks());
+
+            const int BATCH = 1 < capacity ? capacity / 2 : 1;
+
+            bsl::vector<void *> blocks;
+
+            for (int i = 0; i < 3 * BATCH; ++i) {
+                blocks.push_back(mX.allocate(8));
+
+                const Uint64 EXP_MISSES = i / BATCH + 1;
+
+                ASSERTV(capacity, i, X.numCacheMisses(),
+                        EXP_MISSES == X.numCacheMisses());
+                ASSERTV(capacity, i, X.numCacheHits(),
+                        i + 1 - EXP_MISSES == X.numCacheHits());
+            }
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting the bound of a magazine." << endl;
+
+        for (int capacity = 1; capacity <= 20; ++capacity) {
+            Obj mX(3, capacity, &ta);  const Obj& X = mX;
+
+            bsl::vector<void *> blocks;
+
+            for (int i = 0; i < 100; ++i) {
+                blocks.push_back(mX.allocate(32));
+            }
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            const Uint64 MISSES = X.numCacheMisses();
+
+            int numHits = 0;
+            while (MISSES == X.numCacheMisses()) {
+                blocks[numHits] = mX.allocate(32);
+                ++numHits;
+            }
+            --numHits;  // the last allocation missed
+
+            ASSERTV(capacity, numHits, 0 < numHits);
+            ASSERTV(capacity, numHits, numHits <= capacity);
+
+            for (int i = 0; i <= numHits; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting unpooled blocks." << endl;
+        {
+            Obj mX(3, 8, &ta);  const Obj& X = mX;
+
+            ASSERT(32 == X.maxPooledBlockSize());
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            void *p = mX.allocate(33);
+            ASSERT(NUM_BLOCKS < ta.numBlocksInUse());
+            ASSERT(0 == X.numCacheHits() + X.numCacheMisses());
+
+            mX.deallocate(p);
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+            ASSERT(0 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting disabled caching." << endl;
+        {
+            Obj mX(3, 0, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.maxCachedBlocks());
+
+            for (int size = 1; size <= 64; ++size) {
+                void *p = mX.allocate(size);
+                mX.deallocate(p);
+            }
+            ASSERT(0 == X.numCacheHits());
+            ASSERT(0 == X.numCacheMisses());
+            ASSERT(0 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor configures implementation-defined
+        //:   numbers of pools and of cached blocks, and uses the default
+        //:   allocator.
+        //:
+        //: 2 The value constructor configures the specified numbers of pools
+        //:   and of cached blocks, and the maximum pooled block size is
+        //:   '8 << (numPools - 1)'.
+        //:
+        //: 3 All memory is supplied by the allocator specified at
+        //:   construction, or by the default allocator if none is specified.
+        //:
+        //: 4 The destructor releases all memory, including blocks that were
+        //:   not deallocated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor, verify the accessors,
+        //:   allocate blocks without deallocating them, and verify the memory
+        //:   used before and after destroying the object.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   ThreadCachingMultipoolAllocator(bslma::Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int, int, bslma::Allocator *ba);
+        //   ~ThreadCachingMultipoolAllocator();
+        //   int maxCachedBlocks() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING CREATORS AND BASIC ACCESSORS"
+                          << endl << "===================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 < X.numPools());
+            ASSERT(0 < X.maxCachedBlocks());
+            ASSERT((8u << (X.numPools() - 1)) == X.maxPooledBlockSize());
+            ASSERT(0 == X.numThreadCaches());
+
+            const bsls::Types::Int64 NUM_BLOCKS = da.numBlocksInUse();
+
+            mX.allocate(1);                             // leaked deliberately
+            mX.allocate(X.maxPooledBlockSize() + 1);    // leaked deliberately
+            ASSERT(NUM_BLOCKS < da.numBlocksInUse());
+        }
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            for (int maxCachedBlocks = 0; maxCachedBlocks <= 3;
+                                                           ++maxCachedBlocks) {
+                Obj mX(numPools, maxCachedBlocks, &ta);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools == X.numPools());
+                ASSERTV(maxCachedBlocks,
+                        maxCachedBlocks == X.maxCachedBlocks());
+                ASSERTV(numPools, X.maxPooledBlockSize(),
+                        (8u << (numPools - 1)) == X.maxPooledBlockSize());
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                for (bsls::Types::size_type size = 1;
+                     size <= X.maxPooledBlockSize() + 1;
+                     size *= 2) {
+                    mX.allocate(size);  // leaked deliberately
+                }
+                ASSERTV(numPools, NUM_BLOCKS < ta.numBlocksInUse());
+            }
+            ASSERTV(numPools, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1, 0, &ta));
+            ASSERT_FAIL(Obj(1, -1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of various sizes, and verify that
+        //:   the blocks are distinct and writable.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            char *blocks[100];
+            for (int i = 0; i < 100; ++i) {
+                blocks[i] = static_cast<char *>(mX.allocate(i + 1));
+                bsl::memset(blocks[i], i, i + 1);
+            }
+            for (int i = 0; i < 100; ++i) {
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, i == blocks[i][j]);
+                }
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 < mX.numCacheHits());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the throughput of small allocations from several threads
+        //   with and without thread caching.
+        //
+        // Concerns:
+        //: 1 Thread caching reduces the cost of small allocations made
+        //:   concurrently from several threads.
+        //
+        // Plan:
+        //: 1 Time a number of threads, optionally specified on the command
+        //:   line, allocating and deallocating small blocks from a
+        //:   'bdlma::ConcurrentMultipoolAllocator' and from a
+        //:   'bdlma::ThreadCachingMultipoolAllocator', and report the times
+        //:   and the cache hit rate.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE TEST" << endl
+                                  << "================" << endl;
+
+        const int NUM_THREADS = argc > 2 ? bsl::atoi(argv[2]) : 8;
+        const int NUM_ITERS   = 2000000;
+
+        bdlma::ConcurrentMultipoolAllocator multipoolAllocator;
+        Obj                                 cachingAllocator;
+
+        const double T1 = runBenchmark(&multipoolAllocator,
+                                       NUM_THREADS,
+                                       NUM_ITERS);
+        const double T2 = runBenchmark(&cachingAllocator,
+                                       NUM_THREADS,
+                                       NUM_ITERS);
+
+        const double HITS   = static_cast<double>(
+                                             cachingAllocator.numCacheHits());
+        const double MISSES = static_cast<double>(
+                                           cachingAllocator.numCacheMisses());
+
+        cout << "threads: " << NUM_THREADS
+             << ", iterations per thread: " << NUM_ITERS << endl
+             << "ConcurrentMultipoolAllocator:    " << T1 << "s" << endl
+             << "ThreadCachingMultipoolAllocator: " << T2 << "s" << endl
+             << "cache hit rate: " << HITS / (HITS + MISSES) << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
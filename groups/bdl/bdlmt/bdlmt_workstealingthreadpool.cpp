@@ -0,0 +1,1044 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+#include <bsl_climits.h>  // 'INT_MAX'
+#include <bsl_cstdlib.h>
+#include <bsl_new.h>
+
+///Implementation Notes
+///--------------------
+// Each processing thread is associated with a 'WorkStealingThreadPool_Worker'
+// that holds a bounded Chase-Lev deque of 'Job' addresses.  The owner pushes
+// and pops at the "bottom" end of the deque, and other threads steal at the
+// "top" end.  All the operations on 'd_top' and 'd_bottom' that take part in
+// the owner/thief race are sequentially consistent, which is the memory model
+// under which the algorithm was originally proven correct.  Because the deque
+// is bounded and never reallocated, a thief may read a slot that is being
+// overwritten by the owner only if its view of 'd_top' is stale, in which case
+// its compare-and-swap on 'd_top' fails and the value read is discarded.
+//
+// 'd_numPendingJobs' counts the jobs on the injection queue and on all the
+// local deques.  It is incremented *before* a job is pushed and decremented
+// only after the thread that removed the job is counted in
+// 'd_numActiveThreads', so that 'drain' never observes both counters at zero
+// while a job is in flight.  A thread about to block links itself at the head
+// of the wait list and then re-reads 'd_numPendingJobs', while a thread pushing
+// onto its local deque increments 'd_numPendingJobs' and then reads
+// 'd_waitHead'; both sequences are sequentially consistent, so at least one of
+// the two threads observes the other and no job is left on a local deque while
+// a thread that could steal it sleeps.
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                   // =====================================
+                   // class WorkStealingThreadPool_Worker
+                   // =====================================
+
+class WorkStealingThreadPool_Worker {
+    // This component-private class holds the state associated with a
+    // processing thread: its local deque of jobs, and its share of the busy
+    // time metric.  The 'push' and 'pop' methods may be called only by the
+    // owning thread, while 'steal' may be called by any thread.
+
+  public:
+    // TYPES
+    typedef WorkStealingThreadPool::Job Job;
+
+    enum {
+        k_CAPACITY = 256,                   // capacity of the local deque
+        k_MASK     = k_CAPACITY - 1
+    };
+
+    // PUBLIC DATA
+    bsls::AtomicInt64       d_top;          // index of the next job to steal
+
+    const char              d_topPad[bslmt::Platform::e_CACHE_LINE_SIZE
+                                     - sizeof(bsls::AtomicInt64)];
+                                            // padding separating the thieves'
+                                            // end of the deque from the
+                                            // owner's
+
+    bsls::AtomicInt64       d_bottom;       // index one past the last job
+                                            // pushed by the owner
+
+    bsls::AtomicInt64       d_callbackTime; // total time spent running jobs
+                                            // by the owner, in nanoseconds
+
+    WorkStealingThreadPool *d_pool_p;       // pool of this worker (held, not
+                                            // owned)
+
+    int                     d_index;        // index of this worker within
+                                            // the pool
+
+    unsigned int            d_seed;         // state used to select the
+                                            // victims of steal attempts
+
+    bsls::AtomicPointer<Job>
+                            d_jobs[k_CAPACITY];
+                                            // circular buffer of job
+                                            // addresses
+
+    // CREATORS
+    WorkStealingThreadPool_Worker(WorkStealingThreadPool *pool, int index);
+        // Create an empty worker for the specified 'pool' having the specified
+        // 'index'.
+
+    // MANIPULATORS
+    unsigned int nextRandom();
+        // Return a pseudo-random value.  This method may be called only by
+        // the owning thread.
+
+    Job *pop();
+        // Remove the most recently pushed job from the deque and return its
+        // address, or return 0 if the deque is empty.  This method may be
+        // called only by the owning thread.
+
+    bool push(Job *job);
+        // Push the specified 'job' onto the deque.  Return 'true' on success,
+        // and 'false' if the deque is full.  This method may be called only by
+        // the owning thread.
+
+    Job *steal();
+        // Remove the least recently pushed job from the deque and return its
+        // address, or return 0 if the deque is empty or if the job was
+        // concurrently removed by another thread.
+
+    // ACCESSORS
+    bool isEmpty() const;
+        // Return 'true' if the deque holds no job, and 'false' otherwise.
+};
+
+                  // ======================================
+                  // struct WorkStealingThreadPool_WaitNode
+                  // ======================================
+
+struct WorkStealingThreadPool_WaitNode {
+    // This component-private structure implements an element of the LIFO
+    // list of threads waiting for work, as in 'bdlmt_threadpool'.  Each
+    // processing thread has its own instance (a local variable of
+    // 'WorkStealingThreadPool::workerThread').  Except for the address of the
+    // head of the list, which is read without the lock to decide whether a
+    // thread must be awakened, all the members are protected by the mutex of
+    // the pool.
+
+    bslmt::Condition                 d_wakeCond;  // signaled when
+                                                  // 'd_awakened' is set
+
+    WorkStealingThreadPool_WaitNode *d_next_p;    // next waiting thread
+
+    WorkStealingThreadPool_WaitNode *d_prev_p;    // previous waiting thread
+
+    bool                             d_awakened;  // 'true' if this thread
+                                                  // was removed from the wait
+                                                  // list to look for work
+
+    // CREATORS
+    WorkStealingThreadPool_WaitNode();
+        // Create a wait node that is not part of any list.
+};
+
+}  // close package namespace
+
+namespace {
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(bdlmt::WorkStealingThreadPool_Worker *,
+                            g_currentWorker,
+                            0);
+#else
+const bslmt::ThreadUtil::Key& currentWorkerKey()
+    // Return the key of the thread-specific storage holding the address of
+    // the worker of the current thread if the current thread is a processing
+    // thread of a 'bdlmt::WorkStealingThreadPool'.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_key, 0);
+    }
+    return s_key;
+}
+#endif
+
+bdlmt::WorkStealingThreadPool_Worker *currentWorker()
+    // Return the address of the worker of the current thread, or 0 if the
+    // current thread is not a processing thread of a
+    // 'bdlmt::WorkStealingThreadPool'.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    return g_currentWorker;
+#else
+    return static_cast<bdlmt::WorkStealingThreadPool_Worker *>(
+                           bslmt::ThreadUtil::getSpecific(currentWorkerKey()));
+#endif
+}
+
+void setCurrentWorker(bdlmt::WorkStealingThreadPool_Worker *worker)
+    // Set the worker of the current thread to the specified 'worker'.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_currentWorker = worker;
+#else
+    int rc = bslmt::ThreadUtil::setSpecific(currentWorkerKey(), worker);
+    (void)rc;
+    BSLS_ASSERT(0 == rc);
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                      // ===========================
+                      // WorkStealingThreadPoolEntry
+                      // ===========================
+
+extern "C" void *WorkStealingThreadPoolEntry(void *worker)
+    // Entry point for processing threads.
+{
+    WorkStealingThreadPool_Worker *w =
+                        static_cast<WorkStealingThreadPool_Worker *>(worker);
+    w->d_pool_p->workerThread(w);
+    return 0;
+}
+
+                   // -------------------------------------
+                   // class WorkStealingThreadPool_Worker
+                   // -------------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                          WorkStealingThreadPool *pool,
+                                          int                     index)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_callbackTime(0)
+, d_pool_p(pool)
+, d_index(index)
+, d_seed(static_cast<unsigned int>(index) * 2654435761u + 1)
+{
+}
+
+// MANIPULATORS
+unsigned int WorkStealingThreadPool_Worker::nextRandom()
+{
+    // xorshift32
+
+    d_seed ^= d_seed << 13;
+    d_seed ^= d_seed >> 17;
+    d_seed ^= d_seed << 5;
+    return d_seed;
+}
+
+WorkStealingThreadPool_Worker::Job *WorkStealingThreadPool_Worker::pop()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+    d_bottom = bottom;
+
+    const bsls::Types::Int64 top = d_top;
+
+    if (top > bottom) {
+        // The deque was empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_jobs[bottom & k_MASK].loadRelaxed();
+
+    if (top == bottom) {
+        // This is the last job: race against the thieves for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+    return job;
+}
+
+bool WorkStealingThreadPool_Worker::push(Job *job)
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top >= k_CAPACITY) {
+        return false;                                                 // RETURN
+    }
+
+    d_jobs[bottom & k_MASK].storeRelaxed(job);
+    d_bottom.storeRelease(bottom + 1);
+    return true;
+}
+
+WorkStealingThreadPool_Worker::Job *WorkStealingThreadPool_Worker::steal()
+{
+    const bsls::Types::Int64 top    = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_jobs[top & k_MASK].load();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        // Lost the race against the owner or another thief.
+
+        return 0;                                                     // RETURN
+    }
+    return job;
+}
+
+// ACCESSORS
+bool WorkStealingThreadPool_Worker::isEmpty() const
+{
+    return d_top >= d_bottom;
+}
+
+                  // --------------------------------------
+                  // struct WorkStealingThreadPool_WaitNode
+                  // --------------------------------------
+
+// CREATORS
+WorkStealingThreadPool_WaitNode::WorkStealingThreadPool_WaitNode()
+: d_wakeCond(bsls::SystemClockType::e_MONOTONIC)
+, d_next_p(0)
+, d_prev_p(0)
+, d_awakened(false)
+{
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// CLASS DATA
+const char WorkStealingThreadPool::s_defaultThreadName[16] = {
+                                                            "bdl.WSThrdPool" };
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                            const Job& functor)
+{
+    return new (*d_allocator_p) Job(bsl::allocator_arg,
+                                    d_allocator_p,
+                                    functor);
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                bslmf::MovableRef<Job> functor)
+{
+    return new (*d_allocator_p) Job(bsl::allocator_arg,
+                                    d_allocator_p,
+                                    bslmf::MovableRefUtil::move(functor));
+}
+
+void WorkStealingThreadPool::destroyJob(Job *job)
+{
+    d_allocator_p->deleteObject(job);
+}
+
+int WorkStealingThreadPool::discardPendingJobs()
+{
+    int numDiscarded = 0;
+
+    while (!d_queue.empty()) {
+        destroyJob(d_queue.front());
+        d_queue.pop_front();
+        ++numDiscarded;
+    }
+
+    for (int i = 0; i < d_maxThreads; ++i) {
+        Worker& worker = d_workers_p[i];
+        while (!worker.isEmpty()) {
+            Job *job = worker.steal();
+            if (job) {
+                destroyJob(job);
+                ++numDiscarded;
+            }
+        }
+    }
+
+    d_numPendingJobs.add(-numDiscarded);
+
+    return numDiscarded;
+}
+
+int WorkStealingThreadPool::enqueueGlobalJob(Job *job)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        if (d_enabled) {
+            d_queue.push_back(job);
+            ++d_numPendingJobs;
+
+            wakeThreadIfNeeded();
+
+            return startThreadIfNeeded();                             // RETURN
+        }
+    }
+
+    // The job is destroyed without holding the lock because it might have
+    // some objects bound with non-trivial destructors.
+
+    destroyJob(job);
+    return -1;
+}
+
+int WorkStealingThreadPool::enqueueLocalJob(Worker *worker, Job *job)
+{
+    ++d_numPendingJobs;
+
+    if (!worker->push(job)) {
+        --d_numPendingJobs;
+        return enqueueGlobalJob(job);                                 // RETURN
+    }
+
+    // Let another thread steal the job if one is waiting for work, or start a
+    // new thread if all threads are busy and the pool can grow.
+
+    if (d_waitHead) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        wakeThreadIfNeeded();
+    }
+    else if (d_threadCount < d_maxThreads
+          && d_numPendingJobs + d_numActiveThreads > d_threadCount) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        startThreadIfNeeded();
+    }
+
+    return 0;
+}
+
+int WorkStealingThreadPool::enqueueJobImp(Job *job)
+{
+    Worker *worker = currentWorker();
+
+    if (worker && this == worker->d_pool_p) {
+        if (!d_enabled) {
+            destroyJob(job);
+            return -1;                                                // RETURN
+        }
+        return enqueueLocalJob(worker, job);                          // RETURN
+    }
+
+    return enqueueGlobalJob(job);
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void WorkStealingThreadPool::initBlockSet()
+{
+    sigfillset(&d_blockSet);
+
+    static const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+    static const int SIZE =
+                        sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(&d_blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+void WorkStealingThreadPool::initialize()
+{
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(s_defaultThreadName);
+    }
+
+    // Force all threads to be detached.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_DETACHED);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet();
+#endif
+
+    // Reserve the free list first, so that the workers cannot leak if the
+    // reservation throws.
+
+    d_freeWorkers.reserve(d_maxThreads);
+
+    if (d_maxThreads) {
+        d_workers_p = static_cast<Worker *>(
+                         d_allocator_p->allocate(sizeof(Worker) * d_maxThreads));
+    }
+
+    // Hand out the workers in increasing index order.
+
+    for (int i = d_maxThreads - 1; 0 <= i; --i) {
+        new (d_workers_p + i) Worker(this, i);
+        d_freeWorkers.push_back(i);
+    }
+}
+
+int WorkStealingThreadPool::startNewThread()
+{
+    BSLS_ASSERT(!d_freeWorkers.empty());
+
+    Worker *worker = d_workers_p + d_freeWorkers.back();
+
+    bslmt::ThreadUtil::Handle handle;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // block all synchronous signals
+
+    sigset_t oldset;
+
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = bslmt::ThreadUtil::createWithAllocator(
+                                                  &handle,
+                                                  d_threadAttributes,
+                                                  WorkStealingThreadPoolEntry,
+                                                  worker,
+                                                  d_allocator_p);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    if (0 == rc) {
+        d_freeWorkers.pop_back();
+        ++d_threadCount;
+    }
+    else {
+        ++d_createFailures;
+    }
+    return rc;
+}
+
+int WorkStealingThreadPool::startThreadIfNeeded()
+{
+    if (d_numPendingJobs + d_numActiveThreads > d_threadCount
+       && d_threadCount < d_maxThreads) {
+        int rc = startNewThread();
+        (void)rc;  // Suppress unused variable warning.
+
+        if (0 == d_threadCount) {
+            // We are unable to spawn the first thread.  The enqueued job will
+            // never be processed.  Return error.
+
+            return -1;                                                // RETURN
+        }
+
+        // As in 'bdlmt::ThreadPool', work if 'startNewThread' failed as long
+        // as '0 != d_threadCount', but alert clients in development to the
+        // problem.
+
+        BSLS_ASSERT_SAFE(0 == rc && "Client is not getting as many threads as"
+            "requested, check thread stack size.");
+    }
+    return 0;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::stealJob(Worker *thief)
+{
+    if (0 == d_maxThreads) {
+        return 0;                                                     // RETURN
+    }
+
+    const int start = static_cast<int>(thief->nextRandom()
+                                     % static_cast<unsigned int>(d_maxThreads));
+
+    for (int i = 0; i < d_maxThreads; ++i) {
+        int index = start + i;
+        if (index >= d_maxThreads) {
+            index -= d_maxThreads;
+        }
+
+        Worker *victim = d_workers_p + index;
+        if (victim == thief) {
+            continue;                                               // CONTINUE
+        }
+
+        Job *job = victim->steal();
+        if (job) {
+            return job;                                               // RETURN
+        }
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    d_stopFlag = true;
+
+    while (d_waitHead) {
+        wakeThreadIfNeeded();
+    }
+    while (d_threadCount) {
+        d_drainCond.wait(&d_mutex);
+    }
+
+    d_stopFlag = false;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::waitForJob(
+                                                            Worker   *worker,
+                                                            WaitNode *waitNode)
+{
+    while (1) {
+        if (d_stopFlag) {
+            return 0;                                                 // RETURN
+        }
+
+        if (!d_queue.empty()) {
+            Job *job = d_queue.front();
+            d_queue.pop_front();
+            return job;                                               // RETURN
+        }
+
+        if (0 < d_numPendingJobs) {
+            // The pending jobs are on the local deques of other threads.  Try
+            // to steal one without holding the lock.  Note that a failure is
+            // transient: either the jobs are being taken by other threads, or
+            // a job is about to be pushed.
+
+            Job *job;
+            {
+                bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);
+
+                job = stealJob(worker);
+                if (!job) {
+                    bslmt::ThreadUtil::yield();
+                }
+            }
+            if (job) {
+                return job;                                           // RETURN
+            }
+            continue;                                               // CONTINUE
+        }
+
+        if (0 == d_numActiveThreads) {
+            d_drainCond.broadcast();
+        }
+
+        // Attach the 'waitNode' of this thread to the head of the wait list.
+
+        waitNode->d_awakened = false;
+        waitNode->d_prev_p   = 0;
+        waitNode->d_next_p   = d_waitHead.loadRelaxed();
+        if (waitNode->d_next_p) {
+            waitNode->d_next_p->d_prev_p = waitNode;
+        }
+        d_waitHead = waitNode;
+
+        // Re-check for jobs pushed onto a local deque by a thread that did not
+        // yet observe this thread in the wait list (see the implementation
+        // notes).
+
+        if (0 == d_numPendingJobs) {
+            // Let this thread wait until either it is awakened or
+            // 'd_maxIdleTime' elapses.
+
+            if (d_minThreads <= d_numActiveThreads) {
+                // This thread should be removed if it times out.
+
+                bsls::TimeInterval endTime =
+                        bsls::SystemTime::nowMonotonicClock() + d_maxIdleTime;
+                do {
+                    if (waitNode->d_wakeCond.timedWait(&d_mutex, endTime)) {
+                        // This thread timed out its max idle time.
+
+                        break;
+                    }
+
+                    // Else we may either have been signaled or awakened
+                    // spuriously.  In the latter case, loop.
+
+                } while (!waitNode->d_awakened &&
+                         bsls::SystemTime::nowMonotonicClock() < endTime);
+            }
+            else {
+                // This thread should not be subject to a timeout, in order to
+                // maintain the minimum number of threads.
+
+                while (!waitNode->d_awakened) {
+                    waitNode->d_wakeCond.wait(&d_mutex);
+                }
+            }
+        }
+
+        if (!waitNode->d_awakened) {
+            // This thread either timed out or found pending jobs: remove it
+            // from the wait list.
+
+            if (waitNode->d_next_p) {
+                waitNode->d_next_p->d_prev_p = waitNode->d_prev_p;
+            }
+            if (waitNode->d_prev_p) {
+                waitNode->d_prev_p->d_next_p = waitNode->d_next_p;
+            }
+            else {
+                d_waitHead = waitNode->d_next_p;
+            }
+
+            // If the thread timed out, we may simply shut it down.
+
+            if (0 == d_numPendingJobs
+             && d_queue.empty()
+             && d_threadCount > d_minThreads) {
+                return 0;                                             // RETURN
+            }
+        }
+    }
+}
+
+void WorkStealingThreadPool::wakeThreadIfNeeded()
+{
+    WaitNode *head = d_waitHead.loadRelaxed();
+
+    if (head) {
+        // Signal this thread, and pop it from the wait list.
+
+        head->d_awakened = true;
+        head->d_wakeCond.signal();
+
+        d_waitHead = head->d_next_p;
+        if (head->d_next_p) {
+            head->d_next_p->d_prev_p = 0;
+        }
+    }
+}
+
+void WorkStealingThreadPool::workerThread(Worker *worker)
+{
+    setCurrentWorker(worker);
+
+    WaitNode waitNode;
+    bool     isActive = false;  // 'true' if counted in 'd_numActiveThreads'
+
+    while (1) {
+        Job *job = 0;
+
+        if (isActive) {
+            job = worker->pop();
+            if (!job && 0 < d_numPendingJobs) {
+                job = stealJob(worker);
+            }
+        }
+
+        if (!job) {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            if (isActive) {
+                --d_numActiveThreads;
+                isActive = false;
+            }
+
+            job = waitForJob(worker, &waitNode);
+
+            if (!job) {
+                d_freeWorkers.push_back(worker->d_index);
+                --d_threadCount;
+                if (0 == d_threadCount) {
+                    d_drainCond.broadcast();
+                }
+                setCurrentWorker(0);
+                return;                                               // RETURN
+            }
+
+            ++d_numActiveThreads;
+            isActive = true;
+        }
+
+        // This thread is counted as active, so the job is no longer pending.
+
+        --d_numPendingJobs;
+
+        // Run the callback and keep measurements.
+
+        bsls::Types::Int64 start  = bsls::TimeUtil::getTimer();
+        (*job)();
+        bsls::Types::Int64 finish = bsls::TimeUtil::getTimer();
+
+        bsls::Types::Int64 lastResetTime = d_lastResetTime;
+        if (start < lastResetTime) {
+            worker->d_callbackTime.add(finish - lastResetTime);
+        }
+        else {
+            worker->d_callbackTime.add(finish - start);
+        }
+
+        // The job has to be destroyed when we are *not* holding the lock
+        // because it might have some objects bound with non-trivial
+        // destructors.
+
+        destroyJob(job);
+    }
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                         const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         int                             maxIdleTime,
+                         bslma::Allocator               *basicAllocator)
+: d_queue(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_maxThreads(maxThreads)
+, d_minThreads(minThreads)
+, d_threadCount(0)
+, d_createFailures(0)
+, d_numActiveThreads(0)
+, d_numPendingJobs(0)
+, d_enabled(0)
+, d_stopFlag(false)
+, d_waitHead(0)
+, d_workers_p(0)
+, d_freeWorkers(basicAllocator)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0          <= minThreads);
+    BSLS_ASSERT(minThreads <= maxThreads);
+    BSLS_ASSERT(0          <= maxIdleTime);
+
+    d_maxIdleTime.setTotalMilliseconds(maxIdleTime);
+
+    initialize();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                         const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         bsls::TimeInterval              maxIdleTime,
+                         bslma::Allocator               *basicAllocator)
+: d_queue(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_maxThreads(maxThreads)
+, d_minThreads(minThreads)
+, d_threadCount(0)
+, d_createFailures(0)
+, d_maxIdleTime(maxIdleTime)
+, d_numActiveThreads(0)
+, d_numPendingJobs(0)
+, d_enabled(0)
+, d_stopFlag(false)
+, d_waitHead(0)
+, d_workers_p(0)
+, d_freeWorkers(basicAllocator)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0                        <= minThreads);
+    BSLS_ASSERT(minThreads               <= maxThreads);
+    BSLS_ASSERT(bsls::TimeInterval(0, 0) <= maxIdleTime);
+    BSLS_ASSERT(INT_MAX                  >= maxIdleTime.totalMilliseconds());
+
+    initialize();
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_maxThreads; ++i) {
+        d_workers_p[i].~Worker();
+    }
+    d_allocator_p->deallocate(d_workers_p);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled = 0;
+
+    while ((d_threadCount && d_numPendingJobs) || d_numActiveThreads) {
+        d_drainCond.wait(&d_mutex);
+    }
+}
+
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    if (!d_enabled) {
+        return -1;                                                    // RETURN
+    }
+
+    return enqueueJobImp(createJob(functor));
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    if (!bslmf::MovableRefUtil::access(functor)) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    if (!d_enabled) {
+        return -1;                                                    // RETURN
+    }
+
+    return enqueueJobImp(createJob(bslmf::MovableRefUtil::move(functor)));
+}
+
+double WorkStealingThreadPool::resetPercentBusy()
+{
+    bsls::Types::Int64 now           = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64 lastResetTime = d_lastResetTime.swap(now);
+
+    bsls::Types::Int64 totalCallbackTime = 0;
+    for (int i = 0; i < d_maxThreads; ++i) {
+        totalCallbackTime += d_workers_p[i].d_callbackTime.swap(0);
+    }
+    const double callbackTime = static_cast<double>(totalCallbackTime);
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    double interval = static_cast<double>(now - lastResetTime);
+    interval = 0 != interval ? interval : 1;
+
+    double percentBusy = 100.0 / d_maxThreads * callbackTime / interval;
+    return percentBusy;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled = 0;
+
+    discardPendingJobs();
+
+    stopThreads();
+
+    // Discard the jobs that were pushed onto local deques by threads that
+    // were running a job during the first pass, and that are now stopped.
+
+    discardPendingJobs();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled = 1;
+
+    while (d_threadCount < d_minThreads) {
+        if (0 != startNewThread()) {
+            lock.release()->unlock();
+            shutdown(); // terminate running threads.
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled = 0;
+
+    while ((d_threadCount && d_numPendingJobs) || d_numActiveThreads) {
+        d_drainCond.wait(&d_mutex);
+    }
+
+    stopThreads();
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numActiveThreads;
+}
+
+int WorkStealingThreadPool::numWaitingThreads() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_threadCount - d_numActiveThreads;
+}
+
+double WorkStealingThreadPool::percentBusy() const
+{
+    bsls::Types::Int64 last = d_lastResetTime;
+    double interval = static_cast<double>(bsls::TimeUtil::getTimer() - last);
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    interval = 0 != interval ? interval : 1;
+
+    bsls::Types::Int64 totalCallbackTime = 0;
+    for (int i = 0; i < d_maxThreads; ++i) {
+        totalCallbackTime += d_workers_p[i].d_callbackTime;
+    }
+
+    double ratio = static_cast<double>(totalCallbackTime) / interval;
+    double percentBusy = 100.0 / d_maxThreads * ratio;
+
+    return percentBusy;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
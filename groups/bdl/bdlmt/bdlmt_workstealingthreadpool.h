@@ -0,0 +1,623 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a dynamic pool of threads that schedules by work stealing.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: dynamic thread pool with work stealing
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that provides the same interface and the
+// same thread management policy (a minimum and a maximum number of threads,
+// and an idle time after which threads in excess of the minimum are shut down)
+// as 'bdlmt::ThreadPool', but that distributes jobs among its threads using a
+// work-stealing scheduler rather than a single mutex-protected queue.
+//
+///Scheduling
+///----------
+// Each processing thread of a 'bdlmt::WorkStealingThreadPool' owns a bounded,
+// lock-free, double-ended queue of jobs (a "Chase-Lev" deque).  A job that is
+// enqueued *from* *a* *processing* *thread* of the pool (e.g., a job that
+// enqueues further jobs, as is typical of recursive "fan-out" algorithms) is
+// pushed onto the local deque of that thread without acquiring any lock shared
+// with other threads.  The owning thread pops jobs from the back of its deque
+// (LIFO, which favors cache locality), and idle threads steal jobs from the
+// front of the deques of other threads (FIFO).
+//
+// A job that is enqueued from a thread that is not a processing thread of the
+// pool, or that cannot be pushed because the local deque of the enqueuing
+// thread is full, is placed on a global "injection" queue that is protected by
+// a mutex, exactly as in 'bdlmt::ThreadPool'.  Jobs on the injection queue are
+// processed in FIFO order by the next available thread.
+//
+// Note that, as a consequence, no ordering guarantee is provided between jobs
+// enqueued from within processing threads: a job enqueued by a processing
+// thread may execute before jobs that were enqueued earlier by the same
+// thread.
+//
+///Comparison to 'bdlmt::ThreadPool'
+///---------------------------------
+// 'bdlmt::ThreadPool' serializes every 'enqueueJob' and every job dequeue on a
+// single mutex.  When jobs are short, and especially when jobs are themselves
+// producers of jobs, this mutex becomes the main point of contention among the
+// threads of the pool.  'bdlmt::WorkStealingThreadPool' removes the shared
+// lock from the path of jobs that are enqueued by processing threads, at the
+// cost of an allocation per job (jobs are held by address in the lock-free
+// deques) and of some scanning by idle threads in search of work to steal.
+// Clients whose jobs are all enqueued from outside the pool will see little
+// difference between the two thread pools.
+//
+// The metrics reported by 'percentBusy' and 'resetPercentBusy' are computed
+// as for 'bdlmt::ThreadPool'.  'numActiveThreads' reports the number of
+// processing threads that are running jobs or are looking for jobs to steal;
+// a thread is counted as waiting only once it has failed to find any work.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::ThreadPool', on unix platforms all the threads in the pool
+// block all asynchronous signals, i.e., all signals except SIGBUS, SIGFPE,
+// SIGILL, SIGSEGV, SIGSYS, SIGABRT, SIGTRAP, and SIGIOT.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Fan-Out
+/// - - - - - - - - - - - - - -
+// In this example we compute the sum of the elements of a large array by
+// recursively splitting the array into halves, each half being processed by a
+// separate job, until the ranges are small enough to be summed directly.
+// Since every job but the first is enqueued from a processing thread, these
+// jobs are placed on the local deques of the processing threads, and idle
+// threads steal them as needed.
+//
+// First, we define the job that sums a range, or splits it into two jobs.  The
+// job counts down the specified 'done' latch by the number of elements it
+// sums, so that the caller can wait for the whole computation to complete;
+// note that 'drain' cannot be used for that purpose, as it disables the
+// enqueuing of jobs, including the jobs enqueued by 'sumRange' itself:
+//..
+//  void sumRange(bdlmt::WorkStealingThreadPool *pool,
+//                bsls::AtomicInt64             *result,
+//                bslmt::Latch                  *done,
+//                const int                     *begin,
+//                const int                     *end)
+//  {
+//      enum { k_GRAIN_SIZE = 1024 };
+//
+//      if (end - begin <= k_GRAIN_SIZE) {
+//          bsls::Types::Int64 sum = 0;
+//          for (const int *it = begin; it != end; ++it) {
+//              sum += *it;
+//          }
+//          result->add(sum);
+//          done->countDown(static_cast<int>(end - begin));
+//          return;                                                   // RETURN
+//      }
+//
+//      const int *middle = begin + (end - begin) / 2;
+//
+//      pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            pool,
+//                                            result,
+//                                            done,
+//                                            begin,
+//                                            middle));
+//      sumRange(pool, result, done, middle, end);
+//  }
+//..
+// Then, we create the array to be summed:
+//..
+//  bsl::vector<int> values(1 << 20);
+//  for (bsl::size_t i = 0; i < values.size(); ++i) {
+//      values[i] = static_cast<int>(i % 100);
+//  }
+//..
+// Next, we create and start a thread pool having at least 4 and at most 8
+// processing threads, and an idle time of 100 milliseconds:
+//..
+//  bslmt::ThreadAttributes       attributes;
+//  bdlmt::WorkStealingThreadPool pool(attributes,
+//                                     4,
+//                                     8,
+//                                     bsls::TimeInterval(0.1));
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Then, we enqueue the job processing the whole array:
+//..
+//  bsls::AtomicInt64 result(0);
+//  bslmt::Latch      done(static_cast<int>(values.size()));
+//
+//  const int *begin = values.data();
+//
+//  rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            &pool,
+//                                            &result,
+//                                            &done,
+//                                            begin,
+//                                            begin + values.size()));
+//  assert(0 == rc);
+//..
+// Finally, we wait for all the elements to be summed, drain the pool, and
+// verify the result:
+//..
+//  done.wait();
+//  pool.drain();
+//
+//  bsls::Types::Int64 expected = 0;
+//  for (bsl::size_t i = 0; i < values.size(); ++i) {
+//      expected += values[i];
+//  }
+//  assert(expected == result);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    #include <bsl_csignal.h>              // sigfillset
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+class WorkStealingThreadPool_Worker;
+struct WorkStealingThreadPool_WaitNode;
+
+extern "C" void *WorkStealingThreadPoolEntry(void *);
+    // Entry point for processing threads.
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a dynamic thread pool used for concurrently
+    // executing multiple user-defined functions ("jobs"), in which each
+    // processing thread has a local queue of jobs and idle threads steal jobs
+    // from busy ones.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker   Worker;
+    typedef WorkStealingThreadPool_WaitNode WaitNode;
+
+    // DATA
+    bsl::deque<Job *>       d_queue;          // global injection queue of
+                                              // pending jobs, protected by
+                                              // 'd_mutex'
+
+    mutable bslmt::Mutex    d_mutex;          // mutex used to control access
+                                              // to the injection queue and to
+                                              // the thread management state
+
+    bslmt::Condition        d_drainCond;      // condition variable used to
+                                              // signal that all jobs have
+                                              // completed, or that all threads
+                                              // have stopped
+
+    bslmt::ThreadAttributes d_threadAttributes;
+                                              // thread attributes to be used
+                                              // when constructing processing
+                                              // threads
+
+    const int               d_maxThreads;     // maximum number of processing
+                                              // threads that can be started at
+                                              // any given time by this pool
+
+    const int               d_minThreads;     // minimum number of processing
+                                              // threads that must be running
+                                              // at any given time
+
+    bsls::AtomicInt         d_threadCount;    // current number of processing
+                                              // threads (modified only with
+                                              // 'd_mutex' locked)
+
+    bsls::AtomicInt         d_createFailures; // number of thread create
+                                              // failures
+
+    bsls::TimeInterval      d_maxIdleTime;    // time that threads (in excess
+                                              // of the minimum number of
+                                              // threads) remain idle before
+                                              // being shut down
+
+    bsls::AtomicInt         d_numActiveThreads;
+                                              // current number of threads that
+                                              // are processing or looking for
+                                              // jobs (modified only with
+                                              // 'd_mutex' locked)
+
+    bsls::AtomicInt         d_numPendingJobs; // number of jobs on the
+                                              // injection queue and on the
+                                              // local deques of the workers
+
+    bsls::AtomicInt         d_enabled;        // indicates the enabled state of
+                                              // queuing; queuing is disabled
+                                              // when 0, enabled otherwise
+
+    bool                    d_stopFlag;       // 'true' if processing threads
+                                              // must exit (protected by
+                                              // 'd_mutex')
+
+    bsls::AtomicPointer<WaitNode>
+                            d_waitHead;       // first thread of the list of
+                                              // threads waiting for work (LIFO)
+
+    Worker                 *d_workers_p;      // array of 'd_maxThreads'
+                                              // per-thread worker states
+                                              // (owned)
+
+    bsl::vector<int>        d_freeWorkers;    // indices of the elements of
+                                              // 'd_workers_p' not currently
+                                              // used by a thread (protected by
+                                              // 'd_mutex')
+
+    bsls::AtomicInt64       d_lastResetTime;  // last reset time of
+                                              // percent-busy metric in
+                                              // nanoseconds from some
+                                              // arbitrary but fixed point in
+                                              // time
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;       // set of signals to be blocked
+                                              // in managed threads
+#endif
+
+    bslma::Allocator       *d_allocator_p;    // memory allocator (held, not
+                                              // owned)
+
+    // CLASS DATA
+    static const char       s_defaultThreadName[16];
+                                              // default name of threads if
+                                              // supported and attributes
+                                              // doesn't specify another name
+
+    // FRIENDS
+    friend void *WorkStealingThreadPoolEntry(void *);
+
+    // PRIVATE MANIPULATORS
+    Job *createJob(const Job& functor);
+    Job *createJob(bslmf::MovableRef<Job> functor);
+        // Return the address of a newly created copy of the specified
+        // 'functor', allocated using the allocator supplied at construction.
+
+    void destroyJob(Job *job);
+        // Destroy the specified 'job' and deallocate its footprint.
+
+    int discardPendingJobs();
+        // Remove all the jobs from the injection queue and from the local
+        // deques of the workers, destroy them, and return the number of jobs
+        // removed.  This method must be called with 'd_mutex' locked.
+
+    int enqueueGlobalJob(Job *job);
+        // Push the specified 'job' onto the injection queue, wake up a waiting
+        // thread if any, and start a new thread if needed.  Return 0 on
+        // success, and a non-zero value (after destroying 'job') if queuing is
+        // disabled or no thread could be started.
+
+    int enqueueLocalJob(Worker *worker, Job *job);
+        // Push the specified 'job' onto the local deque of the specified
+        // 'worker', or onto the injection queue if the local deque is full.
+        // Return 0 on success, and a non-zero value (after destroying 'job')
+        // otherwise.  The behavior is undefined unless 'worker' is the worker
+        // of the calling thread.
+
+    int enqueueJobImp(Job *job);
+        // Enqueue the specified 'job' on the local deque of the calling thread
+        // if it is a processing thread of this pool, and on the injection
+        // queue otherwise.  Return 0 on success, and a non-zero value (after
+        // destroying 'job') otherwise.
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    void initBlockSet();
+        // Initialize the set of signals to be blocked in the managed threads.
+#endif
+
+    void initialize();
+        // Complete the construction of this object.  This method is called by
+        // the constructors.
+
+    int startNewThread();
+        // Spawn a new processing thread and increment the current count.
+        // Return 0 on success, and a non-zero value otherwise.  This method
+        // must be called with 'd_mutex' locked.
+
+    int startThreadIfNeeded();
+        // Start a new thread if the number of pending jobs exceeds the number
+        // of threads available to process them and the maximum number of
+        // threads are not yet running.  Return 0 if at least one thread is
+        // running, and a non-zero value otherwise.  This method must be called
+        // with 'd_mutex' locked.
+
+    Job *stealJob(Worker *thief);
+        // Attempt to steal a job from the local deque of a worker other than
+        // the specified 'thief' (which may be 0).  Return the address of the
+        // stolen job, or 0 if none could be stolen.
+
+    void stopThreads();
+        // Signal all processing threads to exit, and wait until they have.
+        // This method must be called with 'd_mutex' locked.
+
+    Job *waitForJob(Worker *worker, WaitNode *waitNode);
+        // Return the address of the next job to be run by the processing
+        // thread having the specified 'worker' and 'waitNode', blocking until
+        // one is available, or 0 if the thread must exit.  This method must be
+        // called with 'd_mutex' locked.
+
+    void wakeThreadIfNeeded();
+        // Signal the thread at the head of the wait list, if any, and pop it
+        // from the wait list.  This method must be called with 'd_mutex'
+        // locked.
+
+    void workerThread(Worker *worker);
+        // Processing thread function.
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    WorkStealingThreadPool(
+                         const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         int                             maxIdleTime,
+                         bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes', the
+        // specified 'minThreads' minimum number of threads, the specified
+        // 'maxThreads' maximum number of threads, and the specified
+        // 'maxIdleTime' idle time (in milliseconds) after which a thread may
+        // be considered for destruction.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= minThreads', 'minThreads <= maxThreads', and
+        // '0 <= maxIdleTime'.
+
+    WorkStealingThreadPool(
+                         const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         bsls::TimeInterval              maxIdleTime,
+                         bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes', the
+        // specified 'minThreads' minimum number of threads, the specified
+        // 'maxThreads' maximum number of threads, and the specified
+        // 'maxIdleTime' idle time after which a thread may be considered for
+        // destruction.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 <= minThreads', 'minThreads <= maxThreads', '0 <= maxIdleTime',
+        // and the 'maxIdleTime' has a value less than or equal to 'INT_MAX'
+        // milliseconds.
+
+    ~WorkStealingThreadPool();
+        // Call 'shutdown()' and destroy this thread pool.
+
+    // MANIPULATORS
+    void drain();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete.  Use 'start' to re-enable queuing.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a thread of this
+        // pool.  If the calling thread is a processing thread of this pool,
+        // 'functor' is pushed onto the local deque of the calling thread (if
+        // that deque is not full), and onto the injection queue otherwise.
+        // Return 0 if enqueued successfully, and a non-zero value if queuing
+        // is currently disabled.  The behavior is undefined unless 'functor'
+        // is not "unset".  See 'bsl::function' for more information on
+        // functors.
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a thread of this
+        // pool.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    double resetPercentBusy();
+        // Atomically report the percentage of wall time spent by each thread
+        // of this thread pool executing jobs since the last reset time, and
+        // set the reset time to now.  The creation of the thread pool is
+        // considered a first reset time.  This value is calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      maxThreads
+        //..
+        // Note that this percentage reflects the wall time spent per thread,
+        // and not CPU time per thread, or not even CPU time per processor.
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all pending jobs, and
+        // shut down all processing threads (after all active jobs complete).
+        // Note that a job enqueued by a processing thread concurrently with a
+        // call to this method may still be executed.
+
+    int start();
+        // Enable queuing on this thread pool and spawn 'minThreads()'
+        // processing threads.  Return 0 on success, and a non-zero value
+        // otherwise.  If 'minThreads()' threads were not successfully started,
+        // all threads are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    int enabled() const;
+        // Return the state (enabled or not) of the thread pool.
+
+    int maxThreads() const;
+        // Return the maximum number of threads that are allowed to be running
+        // at given time.
+
+    int maxIdleTime() const;
+        // Return the amount of time (in milliseconds) a thread remains idle
+        // before being shut down when there are more than min threads started.
+
+    bsls::TimeInterval maxIdleTimeInterval() const;
+        // Return the amount of time a thread remains idle before being shut
+        // down when there are more than min threads started.
+
+    int minThreads() const;
+        // Return the minimum number of threads that must be started at any
+        // given time.
+
+    int numActiveThreads() const;
+        // Return the number of threads that are currently processing a job or
+        // looking for a job to steal.
+
+    int numPendingJobs() const;
+        // Return the number of jobs that are currently queued, either on the
+        // injection queue or on the local deque of a thread, but not yet
+        // being processed.
+
+    int numWaitingThreads() const;
+        // Return the number of threads that are currently waiting for a job.
+
+    double percentBusy() const;
+        // Return the percentage of wall time spent by each thread of this
+        // thread pool executing jobs since the last reset time.  The creation
+        // of the thread pool is considered a first reset time.  This value is
+        // calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      maxThreads
+        //..
+        // Note that this percentage reflects the wall time spent per thread,
+        // and not CPU time per thread, or not even CPU time per processor.
+
+    int threadFailures() const;
+        // Return the number of times that thread creation failed.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool::enabled() const
+{
+    return d_enabled;
+}
+
+inline
+int WorkStealingThreadPool::maxThreads() const
+{
+    return d_maxThreads;
+}
+
+inline
+int WorkStealingThreadPool::maxIdleTime() const
+{
+    return static_cast<int>(d_maxIdleTime.totalMilliseconds());
+}
+
+inline
+bsls::TimeInterval WorkStealingThreadPool::maxIdleTimeInterval() const
+{
+    return d_maxIdleTime;
+}
+
+inline
+int WorkStealingThreadPool::minThreads() const
+{
+    return d_minThreads;
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs;
+}
+
+inline
+int WorkStealingThreadPool::threadFailures() const
+{
+    return d_createFailures;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,958 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_configuration.h>
+#include <bslmt_latch.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread pool whose interface and thread
+// management policy mirror those of 'bdlmt::ThreadPool', but that schedules
+// jobs enqueued from its own processing threads on per-thread deques from
+// which idle threads steal.  We first verify the basic life cycle (start,
+// enqueue, drain, stop, shutdown) and the accessors, then focus on jobs
+// enqueued by processing threads: fan-out, overflow of the local deques,
+// stealing by idle threads, and thread elasticity.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(const Attr&, int, int, int, Allocator *);
+// [ 2] WorkStealingThreadPool(const Attr&, int, int, TimeInterval, Alloc *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 3] void drain();
+// [ 3] int enqueueJob(const Job& functor);
+// [ 3] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 3] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 7] double resetPercentBusy();
+// [ 6] void shutdown();
+// [ 3] int start();
+// [ 3] void stop();
+//
+// ACCESSORS
+// [ 3] int enabled() const;
+// [ 2] int maxThreads() const;
+// [ 2] int maxIdleTime() const;
+// [ 2] bsls::TimeInterval maxIdleTimeInterval() const;
+// [ 2] int minThreads() const;
+// [ 5] int numActiveThreads() const;
+// [ 3] int numPendingJobs() const;
+// [ 5] int numWaitingThreads() const;
+// [ 7] double percentBusy() const;
+// [ 2] int threadFailures() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] JOBS ENQUEUING JOBS
+// [ 5] MIN/MAX THREADS AND IDLE TIME
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+
+// ============================================================================
+//                          GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void incrementCounter(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCounterCallback(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOnLatch(bslmt::Latch *started, bslmt::Latch *release)
+    // Arrive at the specified 'started' latch, then wait on the specified
+    // 'release' latch.
+{
+    started->arrive();
+    release->wait();
+}
+
+void fanOut(Obj             *pool,
+            bsls::AtomicInt *counter,
+            bslmt::Latch    *done,
+            int              depth)
+    // Increment the specified 'counter' and, if the specified 'depth' is
+    // positive, enqueue on the specified 'pool' two jobs that call this
+    // function recursively with 'depth - 1', then arrive at the specified
+    // 'done' latch.  Note that 'drain' cannot be used to wait for the whole
+    // tree of jobs, as it disables the enqueuing of jobs.
+{
+    ++*counter;
+
+    if (0 < depth) {
+        int rc = pool->enqueueJob(
+             bdlf::BindUtil::bind(&fanOut, pool, counter, done, depth - 1));
+        ASSERT(0 == rc);
+
+        rc = pool->enqueueJob(
+             bdlf::BindUtil::bind(&fanOut, pool, counter, done, depth - 1));
+        ASSERT(0 == rc);
+    }
+    done->arrive();
+}
+
+void incrementAndArrive(bsls::AtomicInt *counter, bslmt::Latch *done)
+    // Increment the specified 'counter', then arrive at the specified 'done'
+    // latch.
+{
+    ++*counter;
+    done->arrive();
+}
+
+void enqueueMany(Obj             *pool,
+                 bsls::AtomicInt *counter,
+                 bslmt::Latch    *done,
+                 int              numJobs)
+    // Enqueue on the specified 'pool' the specified 'numJobs' jobs, each
+    // incrementing the specified 'counter' and arriving at the specified
+    // 'done' latch.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        int rc = pool->enqueueJob(
+                     bdlf::BindUtil::bind(&incrementAndArrive, counter, done));
+        ASSERT(0 == rc);
+    }
+}
+
+void blockOnBarrier(bslmt::Barrier *barrier, bsls::AtomicInt *counter)
+    // Wait on the specified 'barrier', then increment the specified 'counter'.
+{
+    barrier->wait();
+    ++*counter;
+}
+
+void enqueueBlocking(Obj             *pool,
+                     bslmt::Barrier  *barrier,
+                     bsls::AtomicInt *counter,
+                     int              numJobs)
+    // Enqueue on the specified 'pool' the specified 'numJobs' jobs, each
+    // waiting on the specified 'barrier' before incrementing the specified
+    // 'counter', then wait on 'barrier' and increment 'counter'.  Note that
+    // the jobs can complete only if they are stolen by other threads.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        int rc = pool->enqueueJob(
+                bdlf::BindUtil::bind(&blockOnBarrier, barrier, counter));
+        ASSERT(0 == rc);
+    }
+    blockOnBarrier(barrier, counter);
+}
+
+void sleepFor(int microseconds)
+    // Sleep for the specified 'microseconds'.
+{
+    bslmt::ThreadUtil::microSleep(microseconds);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Fan-Out
+/// - - - - - - - - - - - - - -
+// In this example we compute the sum of the elements of a large array by
+// recursively splitting the array into halves, each half being processed by a
+// separate job, until the ranges are small enough to be summed directly.
+// Since every job but the first is enqueued from a processing thread, these
+// jobs are placed on the local deques of the processing threads, and idle
+// threads steal them as needed.
+//
+// First, we define the job that sums a range, or splits it into two jobs.  The
+// job counts down the specified 'done' latch by the number of elements it
+// sums, so that the caller can wait for the whole computation to complete;
+// note that 'drain' cannot be used for that purpose, as it disables the
+// enqueuing of jobs, including the jobs enqueued by 'sumRange' itself:
+//..
+    void sumRange(bdlmt::WorkStealingThreadPool *pool,
+                  bsls::AtomicInt64             *result,
+                  bslmt::Latch                  *done,
+                  const int                     *begin,
+                  const int                     *end)
+    {
+        enum { k_GRAIN_SIZE = 1024 };
+
+        if (end - begin <= k_GRAIN_SIZE) {
+            bsls::Types::Int64 sum = 0;
+            for (const int *it = begin; it != end; ++it) {
+                sum += *it;
+            }
+            result->add(sum);
+            done->countDown(static_cast<int>(end - begin));
+            return;                                                   // RETURN
+        }
+
+        const int *middle = begin + (end - begin) / 2;
+
+        pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              pool,
+                                              result,
+                                              done,
+                                              begin,
+                                              middle));
+        sumRange(pool, result, done, middle, end);
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslmt::Configuration::setDefaultThreadStackSize(
+                    bslmt::Configuration::recommendedDefaultThreadStackSize());
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the array to be summed:
+//..
+    bsl::vector<int> values(1 << 20);
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i % 100);
+    }
+//..
+// Next, we create and start a thread pool having at least 4 and at most 8
+// processing threads, and an idle time of 100 milliseconds:
+//..
+    bslmt::ThreadAttributes       attributes;
+    bdlmt::WorkStealingThreadPool pool(attributes,
+                                       4,
+                                       8,
+                                       bsls::TimeInterval(0.1));
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Then, we enqueue the job processing the whole array:
+//..
+    bsls::AtomicInt64 result(0);
+    bslmt::Latch      done(static_cast<int>(values.size()));
+
+    const int *begin = values.data();
+
+    rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              &pool,
+                                              &result,
+                                              &done,
+                                              begin,
+                                              begin + values.size()));
+    ASSERT(0 == rc);
+//..
+// Finally, we wait for all the elements to be summed, drain the pool, and
+// verify the result:
+//..
+    done.wait();
+    pool.drain();
+
+    bsls::Types::Int64 expected = 0;
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        expected += values[i];
+    }
+    ASSERT(expected == result);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentBusy' AND 'resetPercentBusy'
+        //
+        // Concerns:
+        //: 1 The busy metric is close to 0 for an idle pool.
+        //:
+        //: 2 The busy metric reflects the time spent running jobs by all the
+        //:   processing threads.
+        //:
+        //: 3 'resetPercentBusy' resets the metric.
+        //
+        // Plan:
+        //: 1 Start a pool with 2 threads and verify the metric is small.
+        //:   (C-1)
+        //:
+        //: 2 Keep both threads busy sleeping for a known period and verify
+        //:   the value of the metric.  (C-2)
+        //:
+        //: 3 Reset the metric and verify it is small again.  (C-3)
+        //
+        // Testing:
+        //   double percentBusy() const;
+        //   double resetPercentBusy();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'percentBusy' AND 'resetPercentBusy'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        const int k_SLEEP = 200 * 1000;  // microseconds
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, 2, 2, 1000, &ta);
+
+        ASSERT(0 == mX.start());
+
+        bslmt::ThreadUtil::microSleep(k_SLEEP);
+
+        double busy = mX.resetPercentBusy();
+        ASSERTV(busy, busy < 10.0);
+
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&sleepFor, k_SLEEP)));
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&sleepFor, k_SLEEP)));
+
+        mX.drain();
+
+        busy = mX.percentBusy();
+        ASSERTV(busy, 40.0 < busy && busy <= 100.0);
+
+        busy = mX.resetPercentBusy();
+        ASSERTV(busy, 40.0 < busy && busy <= 100.0);
+
+        busy = mX.percentBusy();
+        ASSERTV(busy, busy < 10.0);
+
+        mX.stop();
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'shutdown'
+        //
+        // Concerns:
+        //: 1 'shutdown' discards the pending jobs, both on the injection queue
+        //:   and on the local deques, and lets the active jobs complete.
+        //:
+        //: 2 'shutdown' disables queuing and stops all the threads.
+        //:
+        //: 3 No memory is leaked by discarded jobs.
+        //
+        // Plan:
+        //: 1 Start a pool with a single thread, block it in a job that has
+        //:   enqueued jobs onto its local deque, and enqueue more jobs from
+        //:   the main thread.  Call 'shutdown' from another thread, then
+        //:   release the blocked job.  Verify that none of the other jobs ran,
+        //:   and that the pool is stopped.  (C-1..2)
+        //:
+        //: 2 Verify that the test allocator has no outstanding allocations
+        //:   after the pool is destroyed.  (C-3)
+        //
+        // Testing:
+        //   void shutdown();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'shutdown'" << endl
+                          << "==================" << endl;
+
+        {
+            bslmt::ThreadAttributes attr;
+            Obj                     mX(attr, 1, 1, 1000, &ta);
+            const Obj&              X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            bslmt::Latch    done(20);
+            bslmt::Latch    started(1);
+            bslmt::Latch    release(1);
+
+            struct Local {
+                static void job(Obj             *pool,
+                                bsls::AtomicInt *counter,
+                                bslmt::Latch    *done,
+                                bslmt::Latch    *started,
+                                bslmt::Latch    *release)
+                {
+                    enqueueMany(pool, counter, done, 10);
+                    waitOnLatch(started, release);
+                }
+            };
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&Local::job,
+                                                           &mX,
+                                                           &counter,
+                                                           &done,
+                                                           &started,
+                                                           &release)));
+            started.wait();
+
+            enqueueMany(&mX, &counter, &done, 10);
+
+            ASSERTV(X.numPendingJobs(), 20 == X.numPendingJobs());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                 &handle,
+                                 bdlf::BindUtil::bind(&Obj::shutdown, &mX),
+                                 &ta));
+
+            while (0 != X.numPendingJobs()) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            release.arrive();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(counter, 0 == counter);
+            ASSERT(0 == X.enabled());
+            ASSERT(0 == X.numActiveThreads());
+            ASSERT(0 == X.numWaitingThreads());
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING MIN/MAX THREADS AND IDLE TIME
+        //
+        // Concerns:
+        //: 1 The pool starts 'minThreads' threads.
+        //:
+        //: 2 The pool grows up to 'maxThreads' threads when jobs enqueued
+        //:   from a processing thread are blocked, i.e., the local deques do
+        //:   not prevent the pool from growing.
+        //:
+        //: 3 Jobs on the local deque of a blocked thread are stolen by other
+        //:   threads.
+        //:
+        //: 4 Threads in excess of 'minThreads' exit after being idle for
+        //:   'maxIdleTime'.
+        //
+        // Plan:
+        //: 1 Start a pool with 'k_MIN' and 'k_MAX' threads and verify the
+        //:   number of waiting threads.  (C-1)
+        //:
+        //: 2 Enqueue from the main thread a job that enqueues 'k_MAX - 1'
+        //:   jobs onto its local deque, all of the jobs waiting on a barrier
+        //:   sized for 'k_MAX' threads plus the main thread.  Verify that the
+        //:   barrier is passed and all the jobs complete.  (C-2..3)
+        //:
+        //: 3 Wait for longer than the idle time and verify that the number of
+        //:   threads returned to 'k_MIN'.  (C-4)
+        //
+        // Testing:
+        //   int numActiveThreads() const;
+        //   int numWaitingThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MIN/MAX THREADS AND IDLE TIME" << endl
+                          << "=====================================" << endl;
+
+        enum { k_MIN = 2, k_MAX = 6, k_IDLE = 100 };
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, k_MIN, k_MAX, k_IDLE, &ta);
+        const Obj&              X = mX;
+
+        ASSERT(0 == mX.start());
+
+        while (k_MIN != X.numWaitingThreads()) {
+            bslmt::ThreadUtil::microSleep(1000);
+        }
+        ASSERTV(X.numActiveThreads(), 0 == X.numActiveThreads());
+
+        bsls::AtomicInt counter(0);
+        bslmt::Barrier  barrier(k_MAX + 1);
+
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&enqueueBlocking,
+                                                       &mX,
+                                                       &barrier,
+                                                       &counter,
+                                                       k_MAX - 1)));
+
+        barrier.wait();
+
+        mX.drain();
+
+        ASSERTV(counter, k_MAX == counter);
+        ASSERTV(X.numPendingJobs(), 0 == X.numPendingJobs());
+        ASSERTV(X.threadFailures(), 0 == X.threadFailures());
+
+        bslmt::ThreadUtil::microSleep(10 * k_IDLE * 1000);
+
+        ASSERTV(X.numWaitingThreads(), k_MIN == X.numWaitingThreads());
+        ASSERTV(X.numActiveThreads(),  0     == X.numActiveThreads());
+
+        mX.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING JOBS ENQUEUING JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued from processing threads are all executed exactly
+        //:   once.
+        //:
+        //: 2 Jobs that do not fit in the local deque of a processing thread
+        //:   are enqueued on the injection queue and executed.
+        //:
+        //: 3 The pool can be drained and restarted repeatedly.
+        //
+        // Plan:
+        //: 1 For several pool sizes, enqueue a job that recursively fans out
+        //:   into a binary tree of jobs, wait for all of them to complete,
+        //:   drain the pool, and verify the number of jobs that ran.  (C-1, 3)
+        //:
+        //: 2 Enqueue a job that enqueues many more jobs than the capacity of
+        //:   a local deque, drain the pool, and verify the number of jobs that
+        //:   ran.  (C-2)
+        //
+        // Testing:
+        //   JOBS ENQUEUING JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING JOBS ENQUEUING JOBS" << endl
+                          << "===========================" << endl;
+
+        if (verbose) cout << "\tRecursive fan-out." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_minThreads;
+                int d_maxThreads;
+            } DATA[] = {
+                { L_,  1,  1 },
+                { L_,  0,  4 },
+                { L_,  4,  4 },
+                { L_,  2,  8 },
+                { L_,  8, 16 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            enum { k_DEPTH = 12, k_NUM_JOBS = (2 << k_DEPTH) - 1 };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+                const int MIN  = DATA[ti].d_minThreads;
+                const int MAX  = DATA[ti].d_maxThreads;
+
+                if (veryVerbose) { T_; P_(LINE); P_(MIN); P(MAX); }
+
+                bslmt::ThreadAttributes attr;
+                Obj                     mX(attr, MIN, MAX, 1000, &ta);
+                const Obj&              X = mX;
+
+                for (int iteration = 0; iteration < 3; ++iteration) {
+                    ASSERTV(LINE, 0 == mX.start());
+
+                    bsls::AtomicInt counter(0);
+                    bslmt::Latch    done(k_NUM_JOBS);
+
+                    ASSERTV(LINE, 0 == mX.enqueueJob(
+                             bdlf::BindUtil::bind(&fanOut,
+                                                  &mX,
+                                                  &counter,
+                                                  &done,
+                                                  static_cast<int>(k_DEPTH))));
+
+                    done.wait();
+                    mX.drain();
+
+                    ASSERTV(LINE, counter, k_NUM_JOBS == counter);
+                    ASSERTV(LINE, X.numPendingJobs(),
+                            0 == X.numPendingJobs());
+                    ASSERTV(LINE, X.numActiveThreads(),
+                            0 == X.numActiveThreads());
+                }
+                mX.stop();
+            }
+        }
+
+        if (verbose) cout << "\tOverflow of the local deque." << endl;
+        {
+            enum { k_NUM_JOBS = 5000 };
+
+            bslmt::ThreadAttributes attr;
+            Obj                     mX(attr, 1, 2, 1000, &ta);
+
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            bslmt::Latch    done(k_NUM_JOBS);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                 &enqueueMany,
+                                                 &mX,
+                                                 &counter,
+                                                 &done,
+                                                 static_cast<int>(k_NUM_JOBS))));
+
+            done.wait();
+            mX.drain();
+
+            ASSERTV(counter, k_NUM_JOBS == counter);
+
+            mX.stop();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING BASIC MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'enqueueJob' fails unless the pool is enabled.
+        //:
+        //: 2 Jobs enqueued through all three 'enqueueJob' overloads are run.
+        //:
+        //: 3 'numPendingJobs' reports the jobs not yet running.
+        //:
+        //: 4 'drain' and 'stop' wait for the pending jobs, and disable the
+        //:   pool.
+        //
+        // Plan:
+        //: 1 Verify that 'enqueueJob' fails before 'start' and after 'drain'
+        //:   and 'stop'.  (C-1, 4)
+        //:
+        //: 2 Block the single thread of a pool, enqueue jobs through all three
+        //:   overloads, verify 'numPendingJobs', release the thread, and
+        //:   verify that all the jobs ran after 'drain' and 'stop'.  (C-2..4)
+        //
+        // Testing:
+        //   void drain();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   int start();
+        //   void stop();
+        //   int enabled() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BASIC MANIPULATORS" << endl
+                          << "==========================" << endl;
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, 1, 1, 1000, &ta);
+        const Obj&              X = mX;
+
+        bsls::AtomicInt counter(0);
+        Obj::Job        job = bdlf::BindUtil::bind(&incrementCounter,
+                                                   &counter);
+
+        ASSERT(0 == X.enabled());
+        ASSERT(0 != mX.enqueueJob(job));
+
+        ASSERT(0 == mX.start());
+        ASSERT(1 == X.enabled());
+
+        for (int iteration = 0; iteration < 2; ++iteration) {
+            counter = 0;
+
+            bslmt::Latch started(1);
+            bslmt::Latch release(1);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnLatch,
+                                                           &started,
+                                                           &release)));
+            started.wait();
+
+            ASSERT(0 == mX.enqueueJob(job));
+
+            Obj::Job job2(job);
+            ASSERT(0 == mX.enqueueJob(bslmf::MovableRefUtil::move(job2)));
+
+            ASSERT(0 == mX.enqueueJob(&incrementCounterCallback, &counter));
+
+            ASSERTV(X.numPendingJobs(), 3 == X.numPendingJobs());
+            ASSERTV(counter, 0 == counter);
+
+            release.arrive();
+
+            if (0 == iteration) {
+                mX.drain();
+                ASSERT(0 == X.enabled());
+                ASSERT(0 != mX.enqueueJob(job));
+                ASSERTV(counter, 3 == counter);
+                ASSERT(0 == mX.start());
+            }
+            else {
+                mX.stop();
+                ASSERT(0 == X.enabled());
+                ASSERT(0 != mX.enqueueJob(job));
+                ASSERTV(counter, 3 == counter);
+                ASSERT(0 == X.numWaitingThreads());
+            }
+            ASSERTV(X.numPendingJobs(), 0 == X.numPendingJobs());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors set the configuration reported by the basic
+        //:   accessors.
+        //:
+        //: 2 The supplied allocator is used, and the default allocator is not.
+        //:
+        //: 3 A pool that was never started can be destroyed.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create pools with both constructors and verify the accessors.
+        //:   (C-1, 3)
+        //:
+        //: 2 Verify the test allocator usage.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(const Attr&, int, int, int, Allocator *);
+        //   WorkStealingThreadPool(const Attr&, int, int, TimeInterval, A *);
+        //   ~WorkStealingThreadPool();
+        //   int maxThreads() const;
+        //   int maxIdleTime() const;
+        //   bsls::TimeInterval maxIdleTimeInterval() const;
+        //   int minThreads() const;
+        //   int threadFailures() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND BASIC ACCESSORS" << endl
+                          << "====================================" << endl;
+
+        bslmt::ThreadAttributes attr;
+
+        {
+            Obj        mX(attr, 2, 5, 1500, &ta);
+            const Obj& X = mX;
+
+            ASSERT(2    == X.minThreads());
+            ASSERT(5    == X.maxThreads());
+            ASSERT(1500 == X.maxIdleTime());
+            ASSERT(bsls::TimeInterval(1.5) == X.maxIdleTimeInterval());
+            ASSERT(0    == X.threadFailures());
+            ASSERT(0    == X.enabled());
+            ASSERT(0    == X.numPendingJobs());
+            ASSERT(0    <  ta.numBlocksInUse());
+        }
+        {
+            Obj        mX(attr, 0, 3, bsls::TimeInterval(0, 250000000), &ta);
+            const Obj& X = mX;
+
+            ASSERT(0   == X.minThreads());
+            ASSERT(3   == X.maxThreads());
+            ASSERT(250 == X.maxIdleTime());
+            ASSERT(bsls::TimeInterval(0.25) == X.maxIdleTimeInterval());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(attr,  0, 0,  0, &ta));
+            ASSERT_FAIL(Obj(attr, -1, 0,  0, &ta));
+            ASSERT_FAIL(Obj(attr,  2, 1,  0, &ta));
+            ASSERT_FAIL(Obj(attr,  0, 1, -1, &ta));
+            ASSERT_FAIL(Obj(attr,  0, 1, bsls::TimeInterval(-1.0), &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue jobs from the main thread and from
+        //:   processing threads, drain, and stop the pool.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, 2, 4, 100, &ta);
+
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt counter(0);
+        bslmt::Latch    done(100);
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+        }
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&enqueueMany,
+                                                       &mX,
+                                                       &counter,
+                                                       &done,
+                                                       100)));
+
+        // Jobs cannot be enqueued once 'drain' is called, so wait for the
+        // jobs enqueued by 'enqueueMany' first.
+
+        done.wait();
+        mX.drain();
+        ASSERTV(counter, 200 == counter);
+
+        mX.stop();
+        ASSERT(0 == mX.numWaitingThreads());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,45 @@
+// bsl_flat_unordered_set.h                                           -*-C++-*-
+#ifndef INCLUDED_BSL_FLAT_UNORDERED_SET
+#define INCLUDED_BSL_FLAT_UNORDERED_SET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the 'bsl::flat_unordered_set' container.
+//
+//@DESCRIPTION: Provide the open-addressed container
+// 'bsl::flat_unordered_set', which has no counterpart in the C++ standard
+// library, by including Bloomberg's implementation of it.  See
+// 'bslstl_flatunorderedset' for the differences between this container and
+// 'bsl::unordered_set'.
+
+// Include Bloomberg's implementation.
+#include <bslstl_flatunorderedset.h>
+
+// According to C++11 Standard (24.6.5 range access) some functions ('begin',
+// 'cbegin', etc.) must be available not only via inclusion of the <iterator>
+// header, but also when a container header is included.  The following
+// inclusion provides them for this container, as for 'bsl::unordered_set'.
+#include <bslstl_iterator.h>
+
+#ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
+#include <bsls_nativestd.h>
+#endif // BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
+
+#endif  // INCLUDED_BSL_FLAT_UNORDERED_SET
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
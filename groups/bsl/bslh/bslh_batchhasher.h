@@ -0,0 +1,442 @@
+// bslh_batchhasher.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLH_BATCHHASHER
+#define INCLUDED_BSLH_BATCHHASHER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a functor computing the hashes of a sequence of keys.
+//
+//@CLASSES:
+//  bslh::BatchHasher: functor hashing a sequence of keys into an array
+//
+//@SEE_ALSO: bslh_hash, bslh_wyhashincrementalalgorithm
+//
+//@DESCRIPTION: This component provides a templated functor,
+// 'bslh::BatchHasher', that computes the hash values of a sequence of keys,
+// using a hash functor supplied as the 'HASHER' template parameter, and stores
+// them into an array.  'bslh::BatchHasher' also provides an 'operator()'
+// hashing a single key, so it can be used wherever 'HASHER' can.
+//
+// Hashing a batch of keys up front is the first step of lookups that hide
+// memory latency across several keys: once all hash values are known, a hash
+// table can issue prefetches for the buckets of every key before it compares
+// the first one.  The hash value stored for each key is always the value that
+// 'HASHER' returns for that key.
+//
+///Short Keys
+///----------
+// When 'HASHER' is 'bslh::Hash<>' (i.e.,
+// 'bslh::Hash<bslh::DefaultHashAlgorithm>') or
+// 'bslh::Hash<bslh::WyHashIncrementalAlgorithm>', the keys of a batch are
+// processed in groups.  The bytes that 'hashAppend' supplies for each key of a
+// group are first gathered into a small local buffer, and the hash values of
+// the keys having at most 16 bytes of hash input (e.g., integers, enumerators,
+// pointers, and 'bsl::string_view's of at most 8 characters) are then computed
+// directly, without constructing the incremental hash algorithm, using its
+// 'computeShortHash' class method.  Keys having longer hash input are hashed
+// by 'HASHER'.  The result is identical to hashing each key with 'HASHER',
+// but substantially faster for short keys.
+//
+// For any other 'HASHER' (e.g., 'bsl::hash<int>'), each key of the batch is
+// hashed by calling 'HASHER'.
+//
+///Requirements on 'HASHER'
+///------------------------
+// 'HASHER' must be default constructible, copy constructible, and provide a
+// 'const'-qualified 'operator()' that can be invoked with the key types of
+// the sequences being hashed, and whose result is convertible to
+// 'size_t'.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Hashing a Batch of Keys
+/// - - - - - - - - - - - - - - - - -
+// Suppose we need the hash values of a number of identifiers, for example to
+// look them all up in a hash table.
+//
+// First, we create the identifiers:
+//..
+//  const int         NUM_IDS = 6;
+//  const long long   ids[NUM_IDS] = { 17, 42, 1024, -1, 0, 17 };
+//..
+// Then, we create a 'bslh::BatchHasher' using the default hash functor, and
+// compute the hash values of all identifiers at once:
+//..
+//  bslh::BatchHasher<> hasher;
+//
+//  size_t hashes[NUM_IDS];
+//  hasher(hashes, ids, ids + NUM_IDS);
+//..
+// Finally, we verify that each hash value is the one 'bslh::Hash<>' computes
+// for the corresponding identifier:
+//..
+//  bslh::Hash<> hash;
+//  for (int i = 0; i < NUM_IDS; ++i) {
+//      assert(hash(ids[i]) == hashes[i]);
+//      assert(hasher(ids[i]) == hashes[i]);
+//  }
+//  assert(hashes[0] == hashes[5]);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+#include <bslh_wyhashincrementalalgorithm.h>
+
+#include <bsls_performancehint.h>
+
+#include <stddef.h>  // 'size_t'
+#include <string.h>  // 'memcpy'
+
+namespace BloombergLP {
+namespace bslh {
+
+template <class HASH_ALGORITHM>
+struct BatchHasher_Imp;
+
+                            // =================
+                            // class BatchHasher
+                            // =================
+
+template <class HASHER = bslh::Hash<> >
+class BatchHasher {
+    // This class provides a functor that computes the hash values of a
+    // sequence of keys using the (template parameter) 'HASHER'.
+
+    // DATA
+    HASHER d_hasher;  // hash functor applied to each key
+
+  public:
+    // TYPES
+    typedef size_t result_type;
+        // Type of the hash values computed by this functor.
+
+    // CREATORS
+    BatchHasher();
+        // Create a 'BatchHasher' having a default constructed 'HASHER'.
+
+    explicit BatchHasher(const HASHER& hasher);
+        // Create a 'BatchHasher' having the specified 'hasher'.
+
+    //! BatchHasher(const BatchHasher& original) = default;
+        // Create a 'BatchHasher' object having the value of the specified
+        // 'original' object.
+
+    //! ~BatchHasher() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! BatchHasher& operator=(const BatchHasher& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    // ACCESSORS
+    template <class KEY>
+    size_t operator()(const KEY& key) const;
+        // Return the hash value of the specified 'key' computed by the
+        // 'HASHER' of this object.
+
+    template <class INPUT_ITERATOR>
+    void operator()(size_t         *results,
+                    INPUT_ITERATOR  first,
+                    INPUT_ITERATOR  last) const;
+        // Load, into consecutive elements of the array starting at the
+        // specified 'results', the hash values computed by the 'HASHER' of
+        // this object for the keys in the range starting at the specified
+        // 'first' and ending immediately before the specified 'last'.  The
+        // behavior is undefined unless 'results' refers to an array having
+        // at least as many elements as there are keys in the range.
+
+    const HASHER& hasher() const;
+        // Return a 'const' reference to the 'HASHER' of this object.
+};
+
+                      // ================================
+                      // class BatchHasher_ShortKeyBuffer
+                      // ================================
+
+class BatchHasher_ShortKeyBuffer {
+    // This component-private class provides a function object, usable as the
+    // hash algorithm argument of 'hashAppend', that records the first bytes
+    // supplied to it, so that the hash value of keys whose hash input is
+    // short can be computed without constructing an incremental hash
+    // algorithm.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_CAPACITY = 16 };  // maximum length of recorded input
+
+  private:
+    // DATA
+    unsigned char d_buffer[k_CAPACITY];  // recorded input
+    size_t        d_length;              // total length of supplied input
+
+    // NOT IMPLEMENTED
+    BatchHasher_ShortKeyBuffer(const BatchHasher_ShortKeyBuffer&);
+    BatchHasher_ShortKeyBuffer& operator=(const BatchHasher_ShortKeyBuffer&);
+
+  public:
+    // CREATORS
+    BatchHasher_ShortKeyBuffer();
+        // Create a 'BatchHasher_ShortKeyBuffer' having recorded no input.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Add the specified 'numBytes' to the length of the input supplied to
+        // this object, and, if the total does not exceed 'k_CAPACITY',
+        // append the specified 'data' to the recorded input.
+
+    void reset();
+        // Discard the input supplied to this object.
+
+    // ACCESSORS
+    const unsigned char *data() const;
+        // Return the address of the recorded input.
+
+    bool isShort() const;
+        // Return 'true' if all of the input supplied to this object has been
+        // recorded, and 'false' otherwise.
+
+    size_t length() const;
+        // Return the total length of the input supplied to this object.
+};
+
+                           // =====================
+                           // class BatchHasher_Imp
+                           // =====================
+
+template <class HASH_ALGORITHM>
+struct BatchHasher_Imp {
+    // This component-private class provides the implementation of
+    // 'BatchHasher' for 'HASHER' types that do not support direct hashing of
+    // short keys.
+
+    // CLASS METHODS
+    template <class HASHER, class INPUT_ITERATOR>
+    static void hash(size_t         *results,
+                     const HASHER&   hasher,
+                     INPUT_ITERATOR  first,
+                     INPUT_ITERATOR  last);
+        // Load into the array at the specified 'results' the hash values that
+        // the specified 'hasher' computes for the keys in the range
+        // '[first, last)'.
+};
+
+template <class HASH_ALGORITHM>
+struct BatchHasher_ShortKeyImp {
+    // This component-private class provides the implementation of
+    // 'BatchHasher' for 'bslh::Hash<HASH_ALGORITHM>', where the (template
+    // parameter) 'HASH_ALGORITHM' provides a 'computeShortHash' class method
+    // accepting up to 'BatchHasher_ShortKeyBuffer::k_CAPACITY' bytes.
+
+    // CLASS METHODS
+    template <class HASHER, class INPUT_ITERATOR>
+    static void hash(size_t         *results,
+                     const HASHER&   hasher,
+                     INPUT_ITERATOR  first,
+                     INPUT_ITERATOR  last);
+        // Load into the array at the specified 'results' the hash values that
+        // the specified 'hasher' computes for the keys in the range
+        // '[first, last)'.
+};
+
+template <>
+struct BatchHasher_Imp<bslh::Hash<bslh::DefaultHashAlgorithm> >
+: BatchHasher_ShortKeyImp<bslh::DefaultHashAlgorithm> {
+};
+
+template <>
+struct BatchHasher_Imp<bslh::Hash<bslh::WyHashIncrementalAlgorithm> >
+: BatchHasher_ShortKeyImp<bslh::WyHashIncrementalAlgorithm> {
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class BatchHasher_ShortKeyBuffer
+                      // --------------------------------
+
+// CREATORS
+inline
+BatchHasher_ShortKeyBuffer::BatchHasher_ShortKeyBuffer()
+: d_length(0)
+{
+}
+
+// MANIPULATORS
+inline
+void BatchHasher_ShortKeyBuffer::operator()(const void *data, size_t numBytes)
+{
+    if (d_length + numBytes <= k_CAPACITY) {
+        memcpy(d_buffer + d_length, data, numBytes);
+    }
+    d_length += numBytes;
+}
+
+inline
+void BatchHasher_ShortKeyBuffer::reset()
+{
+    d_length = 0;
+}
+
+// ACCESSORS
+inline
+const unsigned char *BatchHasher_ShortKeyBuffer::data() const
+{
+    return d_buffer;
+}
+
+inline
+bool BatchHasher_ShortKeyBuffer::isShort() const
+{
+    return d_length <= k_CAPACITY;
+}
+
+inline
+size_t BatchHasher_ShortKeyBuffer::length() const
+{
+    return d_length;
+}
+
+                           // ---------------------
+                           // class BatchHasher_Imp
+                           // ---------------------
+
+// CLASS METHODS
+template <class HASH_ALGORITHM>
+template <class HASHER, class INPUT_ITERATOR>
+inline
+void BatchHasher_Imp<HASH_ALGORITHM>::hash(size_t         *results,
+                                           const HASHER&   hasher,
+                                           INPUT_ITERATOR  first,
+                                           INPUT_ITERATOR  last)
+{
+    for (; first != last; ++first, ++results) {
+        *results = static_cast<size_t>(hasher(*first));
+    }
+}
+
+                       // -----------------------------
+                       // class BatchHasher_ShortKeyImp
+                       // -----------------------------
+
+// CLASS METHODS
+template <class HASH_ALGORITHM>
+template <class HASHER, class INPUT_ITERATOR>
+void BatchHasher_ShortKeyImp<HASH_ALGORITHM>::hash(size_t         *results,
+                                                   const HASHER&   hasher,
+                                                   INPUT_ITERATOR  first,
+                                                   INPUT_ITERATOR  last)
+{
+    using bslh::hashAppend;
+
+    enum { k_GROUP_SIZE = 8 };
+
+    // The input of a group of keys is gathered before any of them is hashed,
+    // so that the independent computations of the group can overlap.  Keys
+    // having long input are hashed as they are encountered, because an input
+    // iterator cannot revisit them.
+
+    BatchHasher_ShortKeyBuffer buffers[k_GROUP_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            BatchHasher_ShortKeyBuffer& buffer = buffers[numKeys];
+
+            buffer.reset();
+            hashAppend(buffer, *first);
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!buffer.isShort())) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                results[numKeys] = static_cast<size_t>(hasher(*first));
+            }
+            ++first;
+            ++numKeys;
+        } while (numKeys < k_GROUP_SIZE && first != last);
+
+        for (int i = 0; i < numKeys; ++i) {
+            const BatchHasher_ShortKeyBuffer& buffer = buffers[i];
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(buffer.isShort())) {
+                results[i] = static_cast<size_t>(
+                               HASH_ALGORITHM::computeShortHash(
+                                                             buffer.data(),
+                                                             buffer.length()));
+            }
+        }
+        results += numKeys;
+    }
+}
+
+                            // -----------------
+                            // class BatchHasher
+                            // -----------------
+
+// CREATORS
+template <class HASHER>
+inline
+BatchHasher<HASHER>::BatchHasher()
+: d_hasher()
+{
+}
+
+template <class HASHER>
+inline
+BatchHasher<HASHER>::BatchHasher(const HASHER& hasher)
+: d_hasher(hasher)
+{
+}
+
+// ACCESSORS
+template <class HASHER>
+template <class KEY>
+inline
+size_t BatchHasher<HASHER>::operator()(const KEY& key) const
+{
+    return static_cast<size_t>(d_hasher(key));
+}
+
+template <class HASHER>
+template <class INPUT_ITERATOR>
+inline
+void BatchHasher<HASHER>::operator()(size_t         *results,
+                                     INPUT_ITERATOR  first,
+                                     INPUT_ITERATOR  last) const
+{
+    BatchHasher_Imp<HASHER>::hash(results, d_hasher, first, last);
+}
+
+template <class HASHER>
+inline
+const HASHER& BatchHasher<HASHER>::hasher() const
+{
+    return d_hasher;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,749 @@
+// bslh_batchhasher.t.cpp                                             -*-C++-*-
+#include <bslh_batchhasher.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashincrementalalgorithm.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//
+//                              Overview
+//                              --------
+// The component under test is a functor computing the hash values of a
+// sequence of keys.  Its defining property is that every hash value it stores
+// is the value the wrapped 'HASHER' returns for the corresponding key, both on
+// the path computing short keys directly ('bslh::Hash<>' and
+// 'bslh::Hash<bslh::WyHashIncrementalAlgorithm>') and on the generic path.
+// Both paths are tested by comparing their output with that of 'HASHER' for
+// keys of many types and lengths, and for sequences of many lengths.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BatchHasher();
+// [ 2] BatchHasher(const HASHER& hasher);
+// [ 2] BatchHasher(const BatchHasher& original);
+// [ 2] ~BatchHasher();
+//
+// ACCESSORS
+// [ 3] size_t operator()(const KEY& key) const;
+// [ 4] void operator()(size_t *results, INPUT_ITER first, last) const;
+// [ 2] const HASHER& hasher() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS AND CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslh::Hash<bslh::WyHashIncrementalAlgorithm> WyHash;
+typedef bslh::Hash<bslh::SpookyHashAlgorithm>        SpookyHash;
+
+enum Color { e_RED, e_GREEN, e_BLUE = 0x7fffffff };
+
+// ============================================================================
+//                  GLOBAL CLASSES/STRUCTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                            // ====================
+                            // class IntValueIsHash
+                            // ====================
+
+class IntValueIsHash {
+    // This class provides a hash algorithm that provides the "identity"
+    // mapping from key to hash.
+
+  public:
+    size_t operator()(const int key) const
+        // Return the specified 'key'.
+    {
+        return static_cast<size_t>(key);
+    }
+};
+
+                              // ================
+                              // class SeedIsHash
+                              // ================
+
+class SeedIsHash {
+    // This class provides a hash algorithm that returns the specified seed
+    // value for all hash requests.
+
+    size_t d_seed;  // value to return for all hash requests
+
+  public:
+    // CREATORS
+    SeedIsHash()
+        // Create a 'SeedIsHash' object having 0 as the seed value.
+    : d_seed(0)
+    {
+    }
+
+    explicit SeedIsHash(size_t seed)
+        // Create a 'SeedIsHash' object having the specified 'seed'.
+    : d_seed(seed)
+    {
+    }
+
+    // ACCESSORS
+    size_t operator()(const int&) const
+        // Return the provided-at-constuction seed value.
+    {
+        return d_seed;
+    }
+
+    size_t seed() const
+        // Return the provided-at-constuction seed value.
+    {
+        return d_seed;
+    }
+};
+
+                              // ===============
+                              // class StringRef
+                              // ===============
+
+class StringRef {
+    // This class provides a reference to a sequence of characters that is
+    // hashed the way 'bsl::string_view' is: its characters followed by its
+    // length.
+
+    // DATA
+    const char *d_data;    // characters (held, not owned)
+    size_t      d_length;  // number of characters
+
+  public:
+    // CREATORS
+    StringRef()
+        // Create an empty 'StringRef'.
+    : d_data("")
+    , d_length(0)
+    {
+    }
+
+    StringRef(const char *data, size_t length)
+        // Create a 'StringRef' referring to the specified 'length' characters
+        // starting at the specified 'data'.
+    : d_data(data)
+    , d_length(length)
+    {
+    }
+
+    // ACCESSORS
+    const char *data() const
+        // Return the address of the referenced characters.
+    {
+        return d_data;
+    }
+
+    size_t length() const
+        // Return the number of referenced characters.
+    {
+        return d_length;
+    }
+};
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const StringRef& input)
+    // Pass the characters and then the length of the specified 'input' to the
+    // specified 'hashAlg'.
+{
+    using bslh::hashAppend;
+    hashAlg(input.data(), input.length());
+    hashAppend(hashAlg, input.length());
+}
+
+                            // ===================
+                            // class InputIterator
+                            // ===================
+
+template <class TYPE>
+class InputIterator {
+    // This class provides a minimal input iterator over an array of 'TYPE'.
+
+    // DATA
+    const TYPE *d_ptr;  // current element
+
+  public:
+    // CREATORS
+    explicit InputIterator(const TYPE *ptr)
+        // Create an iterator referring to the specified 'ptr'.
+    : d_ptr(ptr)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Move this iterator to the next element, and return a reference
+        // providing modifiable access to this iterator.
+    {
+        ++d_ptr;
+        return *this;
+    }
+
+    // ACCESSORS
+    const TYPE& operator*() const
+        // Return a reference to the current element.
+    {
+        return *d_ptr;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' do not refer
+        // to the same element, and 'false' otherwise.
+    {
+        return d_ptr != rhs.d_ptr;
+    }
+};
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class HASHER, class KEY>
+void testBatch(int line, const KEY *keys, size_t numKeys)
+    // Verify that a 'bslh::BatchHasher<HASHER>' stores, for every prefix of
+    // the specified 'keys' having up to the specified 'numKeys' elements, the
+    // hash values computed by 'HASHER', whether the keys are supplied as a
+    // pointer range or through an input iterator.  Use the specified 'line'
+    // to report errors.
+{
+    enum { k_MAX_KEYS = 64, k_GUARD = 0x5a };
+
+    BSLS_ASSERT(numKeys <= k_MAX_KEYS);
+
+    const HASHER                    HASHER_OBJ;
+    const bslh::BatchHasher<HASHER> X;
+
+    for (size_t n = 0; n <= numKeys; ++n) {
+        size_t results[k_MAX_KEYS + 1];
+        memset(results, k_GUARD, sizeof results);
+
+        X(results, keys, keys + n);
+
+        for (size_t i = 0; i < n; ++i) {
+            ASSERTV(line, n, i, HASHER_OBJ(keys[i]) == results[i]);
+        }
+
+        size_t guard;
+        memset(&guard, k_GUARD, sizeof guard);
+        ASSERTV(line, n, guard == results[n]);
+
+        memset(results, k_GUARD, sizeof results);
+
+        X(results, InputIterator<KEY>(keys), InputIterator<KEY>(keys + n));
+
+        for (size_t i = 0; i < n; ++i) {
+            ASSERTV(line, n, i, HASHER_OBJ(keys[i]) == results[i]);
+        }
+        ASSERTV(line, n, guard == results[n]);
+    }
+}
+
+template <class KEY>
+void testAllHashers(int line, const KEY *keys, size_t numKeys)
+    // Verify the output of 'bslh::BatchHasher' for the specified 'keys' having
+    // the specified 'numKeys' elements for each 'bslh::Hash' instantiation
+    // supported by the short-key path, and for one that is not.  Use the
+    // specified 'line' to report errors.
+{
+    testBatch<bslh::Hash<> >(line, keys, numKeys);
+    testBatch<WyHash>(line, keys, numKeys);
+    testBatch<SpookyHash>(line, keys, numKeys);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Hashing a Batch of Keys
+/// - - - - - - - - - - - - - - - - -
+// Suppose we need the hash values of a number of identifiers, for example to
+// look them all up in a hash table.
+//
+// First, we create the identifiers:
+//..
+        const int         NUM_IDS = 6;
+        const long long   ids[NUM_IDS] = { 17, 42, 1024, -1, 0, 17 };
+//..
+// Then, we create a 'bslh::BatchHasher' using the default hash functor, and
+// compute the hash values of all identifiers at once:
+//..
+        bslh::BatchHasher<> hasher;
+
+        size_t hashes[NUM_IDS];
+        hasher(hashes, ids, ids + NUM_IDS);
+//..
+// Finally, we verify that each hash value is the one 'bslh::Hash<>' computes
+// for the corresponding identifier:
+//..
+        bslh::Hash<> hash;
+        for (int i = 0; i < NUM_IDS; ++i) {
+            ASSERT(hash(ids[i]) == hashes[i]);
+            ASSERT(hasher(ids[i]) == hashes[i]);
+        }
+        ASSERT(hashes[0] == hashes[5]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BATCH 'operator()'
+        //
+        // Concerns:
+        //: 1 Each stored hash value is the value that 'HASHER' computes for
+        //:   the corresponding key.
+        //:
+        //: 2 Exactly one hash value is stored per key, for sequences shorter
+        //:   than, equal to, and longer than a multiple of the group size.
+        //:
+        //: 3 Keys of every fundamental width, enumerators, and pointers are
+        //:   supported.
+        //:
+        //: 4 Keys having hash input of at most 16 bytes, of more than 16
+        //:   bytes, and of both kinds within the same sequence are supported.
+        //:
+        //: 5 Keys supplied through an input iterator are each dereferenced
+        //:   only before the iterator moves past them.
+        //:
+        //: 6 'HASHER' types not supported by the short-key path produce the
+        //:   values of 'HASHER'.
+        //
+        // Plan:
+        //: 1 For arrays of 'char', 'short', 'int', 'long long', enumerators,
+        //:   and pointers, and for each of 'bslh::Hash<>',
+        //:   'bslh::Hash<bslh::WyHashIncrementalAlgorithm>', and
+        //:   'bslh::Hash<bslh::SpookyHashAlgorithm>', hash every prefix of the
+        //:   array both through a pointer range and through an input
+        //:   iterator, and compare each result with that of the hasher.
+        //:   Verify that the element following the last result is not
+        //:   modified.  (C-1..3, 5..6)
+        //:
+        //: 2 Repeat P-1 with 'StringRef' keys, hashed as 'bsl::string_view'
+        //:   is, having lengths from 0 to 40 characters, both in increasing
+        //:   order and interleaved.  (C-4)
+        //:
+        //: 3 Repeat P-1 with a 'bslh::BatchHasher<IntValueIsHash>'.  (C-6)
+        //
+        // Testing:
+        //   void operator()(size_t *results, INPUT_ITER first, last) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("BATCH 'operator()'\n"
+                            "==================\n");
+
+        enum { k_NUM_KEYS = 40 };
+
+        if (verbose) printf("Testing fundamental keys.\n");
+        {
+            char      charKeys[k_NUM_KEYS];
+            short     shortKeys[k_NUM_KEYS];
+            int       intKeys[k_NUM_KEYS];
+            long long longLongKeys[k_NUM_KEYS];
+            Color     colorKeys[k_NUM_KEYS];
+            const int *ptrKeys[k_NUM_KEYS];
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                charKeys[i]     = static_cast<char>(i * 7);
+                shortKeys[i]    = static_cast<short>(i * 1031 - 2000);
+                intKeys[i]      = i * 104729 - 1000000;
+                longLongKeys[i] = static_cast<long long>(i) * 0x100000001LL
+                                                                          - 17;
+                colorKeys[i]    = 0 == i % 3 ? e_RED
+                                : 1 == i % 3 ? e_GREEN
+                                :              e_BLUE;
+                ptrKeys[i]      = intKeys + i;
+            }
+
+            testAllHashers(L_, charKeys,     k_NUM_KEYS);
+            testAllHashers(L_, shortKeys,    k_NUM_KEYS);
+            testAllHashers(L_, intKeys,      k_NUM_KEYS);
+            testAllHashers(L_, longLongKeys, k_NUM_KEYS);
+            testAllHashers(L_, colorKeys,    k_NUM_KEYS);
+            testAllHashers(L_, ptrKeys,      k_NUM_KEYS);
+        }
+
+        if (verbose) printf("Testing string keys.\n");
+        {
+            const char TEXT[] = "The quick brown fox jumps over the lazy dog";
+
+            StringRef increasing[k_NUM_KEYS + 1];
+            StringRef interleaved[k_NUM_KEYS + 1];
+
+            for (int i = 0; i <= k_NUM_KEYS; ++i) {
+                increasing[i] = StringRef(TEXT + i % 3, i);
+
+                const int len = i % 2 ? k_NUM_KEYS - i : i;
+                interleaved[i] = StringRef(TEXT + 1, len);
+            }
+
+            testAllHashers(L_, increasing,  k_NUM_KEYS + 1);
+            testAllHashers(L_, interleaved, k_NUM_KEYS + 1);
+        }
+
+        if (verbose) printf("Testing a different hasher.\n");
+        {
+            int keys[k_NUM_KEYS];
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                keys[i] = i * 3 - 20;
+            }
+
+            testBatch<IntValueIsHash>(L_, keys, k_NUM_KEYS);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SINGLE-KEY 'operator()'
+        //
+        // Concerns:
+        //: 1 The hash value of a single key is the value that 'HASHER'
+        //:   computes for that key.
+        //:
+        //: 2 The function can be invoked on a 'const' object.
+        //
+        // Plan:
+        //: 1 For a number of keys, compare the result of 'operator()' on a
+        //:   'const' 'BatchHasher' with that of the hasher it wraps, for a
+        //:   number of hashers.  (C-1..2)
+        //
+        // Testing:
+        //   size_t operator()(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("SINGLE-KEY 'operator()'\n"
+                            "=======================\n");
+
+        const bslh::BatchHasher<>               X;
+        const bslh::BatchHasher<SpookyHash>     Y;
+        const bslh::BatchHasher<IntValueIsHash> Z;
+
+        const bslh::Hash<> HASH;
+        const SpookyHash   SPOOKY_HASH;
+
+        for (int i = -100; i <= 100; ++i) {
+            ASSERTV(i, HASH(i)        == X(i));
+            ASSERTV(i, SPOOKY_HASH(i) == Y(i));
+            ASSERTV(i, static_cast<size_t>(i) == Z(i));
+
+            const StringRef KEY("abcdefghijklmnopqrstuvwxyz", (i + 100) % 16);
+            ASSERTV(i, HASH(KEY) == X(KEY));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'hasher'
+        //
+        // Concerns:
+        //: 1 A default constructed 'BatchHasher' has a default constructed
+        //:   hasher.
+        //:
+        //: 2 The value constructor stores the supplied hasher, which is used
+        //:   by both overloads of 'operator()'.
+        //:
+        //: 3 The copy constructor copies the hasher.
+        //:
+        //: 4 'hasher' returns a reference to the stored hasher.
+        //
+        // Plan:
+        //: 1 Create 'BatchHasher<SeedIsHash>' objects using each constructor
+        //:   and verify the results of 'operator()' and 'hasher'.  (C-1..4)
+        //
+        // Testing:
+        //   BatchHasher();
+        //   BatchHasher(const HASHER& hasher);
+        //   BatchHasher(const BatchHasher& original);
+        //   ~BatchHasher();
+        //   const HASHER& hasher() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("CREATORS AND 'hasher'\n"
+                            "=====================\n");
+
+        typedef bslh::BatchHasher<SeedIsHash> Obj;
+
+        const int KEYS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        enum { k_NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+        if (verbose) printf("Testing default constructor.\n");
+        {
+            const Obj X;
+
+            ASSERT(0 == X.hasher().seed());
+            ASSERT(0 == X(5));
+        }
+
+        if (verbose) printf("Testing value constructor.\n");
+        {
+            const SeedIsHash HASHER(17);
+            const Obj        X(HASHER);
+
+            ASSERT(17 == X.hasher().seed());
+            ASSERT(17 == X(5));
+
+            size_t results[k_NUM_KEYS];
+            X(results, KEYS, KEYS + k_NUM_KEYS);
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ASSERTV(i, 17 == results[i]);
+            }
+        }
+
+        if (verbose) printf("Testing copy constructor.\n");
+        {
+            const Obj X(SeedIsHash(42));
+            const Obj Y(X);
+
+            ASSERT(42 == Y.hasher().seed());
+            ASSERT(42 == Y(5));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Hash a few integers with a 'BatchHasher<>' and compare the
+        //:   results with those of 'bslh::Hash<>'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("BREATHING TEST\n"
+                            "==============\n");
+
+        const int KEYS[] = { 1, 2, 3 };
+        enum { k_NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+        bslh::BatchHasher<> mX;  const bslh::BatchHasher<>& X = mX;
+        bslh::Hash<>        hash;
+
+        size_t results[k_NUM_KEYS];
+        X(results, KEYS, KEYS + k_NUM_KEYS);
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            ASSERTV(i, hash(KEYS[i]) == results[i]);
+            ASSERTV(i, hash(KEYS[i]) == X(KEYS[i]));
+        }
+        ASSERT(results[0] != results[1]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Hashing a batch of short keys is faster than hashing each key
+        //:   with 'bslh::Hash<>'.
+        //
+        // Plan:
+        //: 1 Hash arrays of 'long long' and of short 'StringRef' keys, one
+        //:   key at a time with 'bslh::Hash<>' and as a batch with
+        //:   'bslh::BatchHasher<>', and report the time taken by each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("PERFORMANCE TEST\n"
+                            "================\n");
+
+        const size_t NUM_KEYS = argc > 2 ? atoi(argv[2]) : 1 << 20;
+        const int    NUM_REPS = 20;
+
+        long long *intKeys = static_cast<long long *>(
+                                         malloc(NUM_KEYS * sizeof *intKeys));
+        StringRef *strKeys = static_cast<StringRef *>(
+                                         malloc(NUM_KEYS * sizeof *strKeys));
+        char      *text    = static_cast<char *>(malloc(NUM_KEYS + 16));
+        size_t    *results = static_cast<size_t *>(
+                                         malloc(NUM_KEYS * sizeof *results));
+
+        for (size_t i = 0; i < NUM_KEYS + 16; ++i) {
+            text[i] = static_cast<char>('a' + i * 7 % 26);
+        }
+        for (size_t i = 0; i < NUM_KEYS; ++i) {
+            intKeys[i] = static_cast<long long>(i * 2654435761u);
+            strKeys[i] = StringRef(text + i, 1 + i % 8);
+        }
+
+        const bslh::Hash<>        hash;
+        const bslh::BatchHasher<> batchHasher;
+
+        bsls::Stopwatch timer;
+        size_t          checksum = 0;
+
+        timer.start(true);
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            for (size_t i = 0; i < NUM_KEYS; ++i) {
+                results[i] = hash(intKeys[i]);
+            }
+            checksum += results[rep];
+        }
+        timer.stop();
+        printf("'long long'   one at a time: %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start(true);
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            batchHasher(results, intKeys, intKeys + NUM_KEYS);
+            checksum -= results[rep];
+        }
+        timer.stop();
+        printf("'long long'   batch:         %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start(true);
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            for (size_t i = 0; i < NUM_KEYS; ++i) {
+                results[i] = hash(strKeys[i]);
+            }
+            checksum += results[rep];
+        }
+        timer.stop();
+        printf("'StringRef'   one at a time: %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start(true);
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            batchHasher(results, strKeys, strKeys + NUM_KEYS);
+            checksum -= results[rep];
+        }
+        timer.stop();
+        printf("'StringRef'   batch:         %8.4fs\n", timer.elapsedTime());
+
+        ASSERT(0 == checksum);
+        if (veryVerbose) {
+            P(checksum);
+        }
+
+        free(results);
+        free(text);
+        free(strKeys);
+        free(intKeys);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -314,6 +314,14 @@ class DefaultHashAlgorithm {
     typedef InternalHashAlgorithm::result_type result_type;
         // Typedef indicating the value type returned by this algorithm.
 
+    // CLASS METHODS
+    static result_type computeShortHash(const void *data, size_t numBytes);
+        // Return the hash that 'computeHash' would return from a
+        // default-constructed 'DefaultHashAlgorithm' after incorporating only
+        // the specified 'numBytes' of the specified 'data'.  The behavior is
+        // undefined unless '16 >= numBytes' and 'data' points to at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
     // CREATORS
     DefaultHashAlgorithm();
         // Create a 'bslh::DefaultHashAlgorithm', default constructing the
@@ -349,6 +357,17 @@ class DefaultHashAlgorithm {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+// CLASS METHODS
+inline
+DefaultHashAlgorithm::result_type
+DefaultHashAlgorithm::computeShortHash(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+    BSLS_ASSERT(16 >= numBytes);
+
+    return InternalHashAlgorithm::computeShortHash(data, numBytes);
+}
+
 // CREATORS
 inline
 DefaultHashAlgorithm::DefaultHashAlgorithm()
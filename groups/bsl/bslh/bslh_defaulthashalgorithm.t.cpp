@@ -33,6 +33,9 @@ using namespace bslh;
 // [ 4] typedef InternalHashAlgorithm::result_type result_type;
 //
 // CREATORS
+// CLASS METHODS
+// [ 6] result_type computeShortHash(const void *data, size_t numBytes);
+//
 // [ 2] DefaultHashAlgorithm();
 // [ 2] ~DefaultHashAlgorithm();
 //
@@ -42,7 +45,7 @@ using namespace bslh;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 5] HASHING AS SEPARATE SEGMENTS
-// [ 6] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -453,7 +456,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The hashing algorithm can be used to create more powerful
@@ -503,6 +506,45 @@ int main(int argc, char *argv[])
         ASSERT(!hashTable.contains(Future("US Dollar", 'F', 2014)));
 
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'computeShortHash'
+        //
+        // Concerns:
+        //: 1 'computeShortHash' returns the same value as 'computeHash' on a
+        //:   default-constructed object to which the same bytes were passed.
+        //
+        // Plan:
+        //: 1 For every length in the range '[0 .. 16]', fill a buffer with
+        //:   random data, and compare the result of 'computeShortHash' with
+        //:   that of the incremental interface.  (C-1)
+        //
+        // Testing:
+        //   result_type computeShortHash(const void *data, size_t numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING 'computeShortHash'\n"
+                            "==========================\n");
+
+        enum { k_MAX_LEN = 16 };
+
+        u::RandGen rand;
+
+        for (int tj = 0; tj < 100; ++tj) {
+            for (unsigned ti = 0; ti <= k_MAX_LEN; ++ti) {
+                const size_t LEN = ti;
+
+                char buffer[k_MAX_LEN];
+                rand.randMemory(buffer, LEN);
+
+                Obj mX;
+                mX(buffer, LEN);
+                const Obj::result_type EXP = mX.computeHash();
+
+                ASSERTV(LEN, EXP == Obj::computeShortHash(buffer, LEN));
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING HASHING AS SEPARATE SEGMENTS
@@ -435,6 +435,9 @@ class WyHashIncrementalAlgorithm {
     static const uint64_t s_secret2 = 0x8ebc6af09c88c6e3ull;
     static const uint64_t s_secret3 = 0x589965cc75374cc3ull;
 
+    static const uint64_t s_defaultSeed = 0x50defacedfacade5ULL;
+        // seed used by a default-constructed object
+
   private:
     // NOT IMPLEMENTED
     WyHashIncrementalAlgorithm(const WyHashIncrementalAlgorithm&)
@@ -489,6 +492,21 @@ class WyHashIncrementalAlgorithm {
         // Return a pointer past the end of the buffer.
 
   public:
+    // CLASS METHODS
+    static result_type computeShortHash(const void *data, size_t numBytes);
+    static result_type computeShortHash(uint64_t    seed,
+                                        const void *data,
+                                        size_t      numBytes);
+        // Return the hash that 'computeHash' would return from a
+        // 'WyHashIncrementalAlgorithm' seeded with the optionally specified
+        // 'seed', or default-constructed if 'seed' is not specified, after
+        // incorporating only the specified 'numBytes' of the specified
+        // 'data'.  The behavior is undefined unless '16 >= numBytes' and
+        // 'data' points to at least 'numBytes' bytes of initialized memory or
+        // 'numBytes' is zero.  Note that this function computes the same
+        // value as the incremental interface without maintaining any object
+        // state, which makes it substantially faster for short keys.
+
     // CREATORS
     WyHashIncrementalAlgorithm();
         // Create a 'WyHashIncrementalAlgorithm' using a default initial seed.
@@ -688,10 +706,56 @@ uint8_t *WyHashIncrementalAlgorithm::repeatBufferEnd()
     return d_buffer + sizeof(d_buffer);
 }
 
+// CLASS METHODS
+inline
+WyHashIncrementalAlgorithm::result_type
+WyHashIncrementalAlgorithm::computeShortHash(const void *data,
+                                             size_t      numBytes)
+{
+    return computeShortHash(s_defaultSeed, data, numBytes);
+}
+
+inline
+WyHashIncrementalAlgorithm::result_type
+WyHashIncrementalAlgorithm::computeShortHash(uint64_t    seed,
+                                             const void *data,
+                                             size_t      numBytes)
+{
+    BSLS_ASSERT_SAFE(0 != data || 0 == numBytes);
+    BSLS_ASSERT_SAFE(16 >= numBytes);
+
+    // This is the 'len <= 16' branch of 'computeHash', where the state seed
+    // is still 'seed ^ s_secret0' because no 48-byte section has been
+    // processed.
+
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    uint64_t       a, b;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numBytes >= 4)) {
+        const size_t subLen = (numBytes >> 3) << 2;
+
+        a = (_wyr4(p) << 32) | _wyr4(p + subLen);
+        b = (_wyr4(p + numBytes - 4) << 32) |
+                                              _wyr4(p + numBytes - 4 - subLen);
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numBytes > 0)) {
+        a = _wyr3(p, numBytes);
+        b = 0;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        a = b = 0;
+    }
+
+    return seed ^ _wymix(s_secret1 ^ numBytes,
+                         _wymix(a ^ s_secret1, b ^ seed ^ s_secret0));
+}
+
 // CREATORS
 inline
 WyHashIncrementalAlgorithm::WyHashIncrementalAlgorithm()
-: d_initialSeed(0x50defacedfacade5ULL)
+: d_initialSeed(s_defaultSeed)
 , d_last16AtEnd(false)
 , d_totalLen(0)
 {
@@ -50,6 +50,10 @@ using namespace BloombergLP;
 // CONSTANTS
 // [ 5] enum { k_SEED_LENGTH = 16 };
 //
+// CLASS METHODS
+// [ 9] result_type computeShortHash(const void *data, size_t numBytes);
+// [ 9] result_type computeShortHash(Uint64 seed, const void *, size_t);
+//
 // CREATORS
 // [ 2] Obj();
 // [ 2] Obj(const char *seed);
@@ -60,10 +64,10 @@ using namespace BloombergLP;
 // [ 3] result_type computeHash();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] Trait IsBitwiseMoveable
-// [ 7] MATCH TEST
-// [ 8] ALIGNMENT INDEPENDENCE
-// [ 9] PLATFORM INDEPENDENCE
+// [ 5] Trait IsBitwiseMoveable
+// [ 6] MATCH TEST
+// [ 7] ALIGNMENT INDEPENDENCE
+// [ 8] PLATFORM INDEPENDENCE
 // [10] USAGE EXAMPLE
 // [-1] DISPERSION TEST
 //-----------------------------------------------------------------------------
@@ -1126,7 +1130,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The hashing algorithm can be used to create more powerful
@@ -1177,6 +1181,61 @@ int main(int argc, char *argv[])
         ASSERT(!hashTable.contains(Future("US Dollar", 'F', 2014)));
 //..
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'computeShortHash'
+        //
+        // Concerns:
+        //: 1 'computeShortHash' returns the same value as 'computeHash' on an
+        //:   object, having the same seed, to which the same bytes were
+        //:   passed.
+        //:
+        //: 2 The overload taking no seed uses the seed of a
+        //:   default-constructed object.
+        //
+        // Plan:
+        //: 1 For every length in the range '[0 .. 16]' and a number of random
+        //:   seeds, fill a buffer with random data, and compare the result of
+        //:   'computeShortHash' with that of the incremental interface.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   result_type computeShortHash(const void *data, size_t numBytes);
+        //   result_type computeShortHash(Uint64 seed, const void *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING 'computeShortHash'\n"
+                            "==========================\n");
+
+        enum { k_MAX_LEN = 16 };
+
+        u::RandGen rand;
+
+        for (int tj = 0; tj < 100; ++tj) {
+            Uint64 seed;
+            rand.randVal(&seed);
+
+            for (unsigned ti = 0; ti <= k_MAX_LEN; ++ti) {
+                const size_t LEN = ti;
+
+                char buffer[k_MAX_LEN];
+                rand.randMemory(buffer, LEN);
+
+                Obj mX;
+                mX(buffer, LEN);
+                const Obj::result_type EXP = mX.computeHash();
+
+                ASSERTV(LEN, EXP == Obj::computeShortHash(buffer, LEN));
+
+                Obj mY(seed);
+                mY(buffer, LEN);
+                const Obj::result_type SEEDED_EXP = mY.computeHash();
+
+                ASSERTV(LEN, SEEDED_EXP ==
+                                     Obj::computeShortHash(seed, buffer, LEN));
+            }
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // PLATFORM INDEPENDENCE TEST
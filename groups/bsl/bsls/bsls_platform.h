@@ -828,6 +828,14 @@ struct bsls_Platform_Assert;
     #endif
 #endif
 
+// The Advanced SIMD (NEON) extension is detected through the macros defined
+// by the ARM C Language Extensions, and is always available on 64-bit ARM
+// platforms.
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define BSLS_PLATFORM_CPU_NEON                                            1
+#endif
+
 // ----------------------------------------------------------------------------
 
                            // Self Validation
@@ -0,0 +1,2359 @@
+// bslstl_flathashtable.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#define INCLUDED_BSLSTL_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table for the flat containers.
+//
+//@CLASSES:
+//  bslstl::FlatHashTable: open-addressed hash table using group controls
+//  bslstl::FlatHashTable_GroupControl: inquiries on a group of control values
+//
+//@SEE_ALSO: bslstl_flatunorderedmap, bslstl_flatunorderedset,
+//           bslstl_hashtable, bdlc_flathashtable,
+//           bdlc_flathashtable_groupcontrol
+//
+//@DESCRIPTION: This component provides the class template
+// 'bslstl::FlatHashTable', which forms the underlying implementation of
+// 'bsl::flat_unordered_map' and 'bsl::flat_unordered_set'.  The data structure
+// is an open-addressed hash table: entries are kept in a single array, the
+// hash value of an entry's key (multiplied by a large odd constant, so that
+// its high-order bits depend on all the bits of the value returned by 'HASH')
+// selects the group of positions at which the search for the entry starts,
+// and the search proceeds to the following groups until the entry, or a group
+// that was never full, is found.  This
+// differs from 'bslstl::HashTable', which keeps each element in a separately
+// allocated node, chained into a list threading the buckets.
+//
+// An array of bytes parallel to the array of entries holds, for each entry in
+// use, a "hashlet" (the seven lowest-order bits of the hash value of its key),
+// and a marker for each unused (empty or erased) entry.  The class
+// 'bslstl::FlatHashTable_GroupControl' inspects a group of these bytes at once
+// (16 bytes using SSE2 instructions where they are available, and 8 bytes
+// using portable 64-bit arithmetic otherwise), so that only the entries whose
+// hashlet matches are compared with a key.  The control bytes are the same as
+// those of 'bdlc::FlatHashTable', which cannot be used from this level.
+//
+// Note that 'bslstl::FlatHashTable_GroupControl' duplicates the SSE2 and
+// portable implementations of 'bdlc::FlatHashTable_GroupControl', and that
+// the probing, insertion, and erasure logic of 'bslstl::FlatHashTable'
+// follows that of 'bdlc::FlatHashTable'.  A change to the representation of
+// the control values, to the group inquiries, or to the probe sequence of
+// either component must be made to both.
+//
+// The entries and the control bytes are held in a single block of memory
+// obtained from the allocator of the table, so that a table of 'N' entries
+// makes one allocation, rather than the 'N + 1' allocations of a
+// 'bslstl::HashTable'.
+//
+///Load Factor and Resizing
+///------------------------
+// An invariant of 'bslstl::FlatHashTable' is that
+// '0 <= load_factor() <= max_load_factor() <= 1.0'.  Any operation that would
+// result in 'load_factor() > max_load_factor()' causes the capacity to
+// increase.  This resizing allocates new memory, moves all elements to the new
+// memory, and reclaims the original memory.  The transfer of elements involves
+// rehashing each element to determine its new location.  The maximum load
+// factor is implementation defined and fixed.
+//
+///Allocators
+///----------
+// The (template parameter) type 'ALLOCATOR' must meet the requirements of a
+// standard allocator; it is rebound to 'ENTRY' to supply memory, and to
+// construct and destroy entries.  The allocator of a table is propagated on
+// copy assignment, move assignment, and swap as indicated by the
+// 'propagate_on_container_copy_assignment',
+// 'propagate_on_container_move_assignment', and 'propagate_on_container_swap'
+// traits of 'bsl::allocator_traits<ALLOCATOR>', and the allocator of a copy is
+// obtained from 'select_on_container_copy_construction', exactly as for
+// 'bslstl::HashTable'.  When 'ALLOCATOR' is 'bsl::allocator', the entries are
+// constructed using the same 'bslma::Allocator' as the table.
+//
+///Requirements on 'KEY', 'ENTRY', 'ENTRY_UTIL', 'HASH', and 'EQUAL'
+///-----------------------------------------------------------------
+// The template parameter type 'ENTRY' must be move-insertable.  The template
+// parameter types 'HASH' and 'EQUAL' must be copy-constructible function
+// objects, where 'HASH' returns a 'std::size_t' for a 'KEY', and 'EQUAL'
+// defines an equivalence relation on 'KEY' values consistent with 'HASH'.
+//
+// 'ENTRY_UTIL' must support static methods 'construct' and 'key' compatible
+// with the following statements for objects 'entry' of type 'ENTRY', 'key' of
+// type 'KEY', and 'allocator' of type 'ALLOCATOR' rebound to 'ENTRY':
+//..
+//  ENTRY_UTIL::construct(&entry, allocator, key);
+//  const KEY& keyOfEntry = ENTRY_UTIL::key(entry);
+//..
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any change in capacity of a 'bslstl::FlatHashTable' invalidates all
+// pointers, references, and iterators.  A manipulator that erases an entry
+// invalidates all pointers, references, and iterators to the erased entry.
+//
+///Exception Safety
+///----------------
+// A 'bslstl::FlatHashTable' is exception neutral, and all of its methods
+// provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bslscm_version.h>
+
+#include <bslstl_forwarditerator.h>
+#include <bslstl_pair.h>
+
+#include <bslalg_arrayprimitives.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorproctor.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <algorithm>  // for 'std::swap'
+#include <cstddef>    // for 'std::size_t'
+#include <cstring>    // for 'std::memcpy', 'std::memset'
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#include <intrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+// FORWARD DECLARATIONS
+template <class ENTRY>
+class FlatHashTable_IteratorImp;
+
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>&,
+                const FlatHashTable_IteratorImp<ENTRY>&);
+
+                      // ================================
+                      // class FlatHashTable_GroupControl
+                      // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides methods for making inquiries to the data of a group
+    // of control values loaded during construction.
+
+  public:
+    // TYPES
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    typedef __m128i              Storage;
+#else
+    typedef bsls::Types::Uint64  Storage;
+#endif
+
+    typedef unsigned int BitMask;
+        // Type of the bit masks returned by the inquiries of this class.
+
+  private:
+    // CLASS DATA
+    static const bsls::Types::Uint64 k_MULT          = 0x0101010101010101ull;
+    static const bsls::Types::Uint64 k_DEFLATE       = 0x0002040810204081ull;
+    static const int                 k_DEFLATE_SHIFT = 56;
+    static const bsls::Types::Uint64 k_MSB_MASK      = 0x8080808080808080ull;
+
+    // DATA
+    Storage d_value;  // efficiently cached value for inquiries
+
+    // PRIVATE ACCESSORS
+    BitMask matchRaw(unsigned char value) const;
+        // Return a bit mask of the 'k_SIZE' entries that have the specified
+        // 'value'.  The bit at index 'i' corresponds to the result for
+        // 'data[i]'.
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // PUBLIC CLASS DATA
+    static const unsigned char k_EMPTY  = 0x80;  // = 0b10000000
+    static const unsigned char k_ERASED = 0xC0;  // = 0b11000000
+    static const std::size_t   k_SIZE   = sizeof(Storage);
+
+    // CLASS METHODS
+    static int numTrailingUnsetBits(BitMask mask);
+        // Return the index of the lowest-order set bit of the specified
+        // 'mask'.  The behavior is undefined unless '0 != mask'.
+
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const unsigned char *data);
+        // Create a group control query object using the specified 'data'.  The
+        // bytes of 'data' have no alignment requirement.  The behavior is
+        // undefined unless 'data' has at least 'k_SIZE' bytes available.
+
+    //! ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the 'k_SIZE' entries that are empty or erased.
+        // The bit at index 'i' corresponds to the result for 'data[i]'.
+
+    BitMask inUse() const;
+        // Return a bit mask of the 'k_SIZE' entries that are in use (i.e., not
+        // empty or erased).  The bit at index 'i' corresponds to the result
+        // for 'data[i]'.
+
+    BitMask match(unsigned char value) const;
+        // Return a bit mask of the 'k_SIZE' entries that have the specified
+        // 'value'.  The bit at index 'i' corresponds to the result for
+        // 'data[i]'.  The behavior is undefined unless '0 == (0x80 & value)'.
+
+    bool neverFull() const;
+        // Return 'true' if this group control was never full (i.e., has a
+        // value that is empty, but not erased).
+};
+
+                      // ===============================
+                      // class FlatHashTable_IteratorImp
+                      // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class implements the methods required by 'bslstl::ForwardIterator'
+    // to provide forward iterators.  As such, an instance of this class
+    // represents a position within a flat hash table.  This class uses no
+    // features of the 'ENTRY' type except for addresses of 'ENTRY' objects.
+
+    // DATA
+    ENTRY               *d_entries_p;
+    const unsigned char *d_controls_p;
+    std::size_t          d_additionalLength;
+
+    // FRIENDS
+    friend bool operator==<>(const FlatHashTable_IteratorImp&,
+                             const FlatHashTable_IteratorImp&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create a 'FlatHashTable_IteratorImp' having the default,
+        // non-dereferenceable value.
+
+    FlatHashTable_IteratorImp(ENTRY               *entries,
+                              const unsigned char *controls,
+                              std::size_t          additionalLength);
+        // Create a 'FlatHashTable_IteratorImp' referencing the first element
+        // of the specified 'entries' and 'controls', which have the specified
+        // 'additionalLength' values.  The behavior is undefined unless
+        // 'entries' and 'controls' point to at least '1 + additionalLength'
+        // values.
+
+    //! FlatHashTable_IteratorImp(
+    //!                const FlatHashTable_IteratorImp& original) = default;
+        // Create a 'FlatHashTable_IteratorImp' having the same value as the
+        // specified 'original'.
+
+    //! ~FlatHashTable_IteratorImp() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                        const FlatHashTable_IteratorImp& rhs) = default;
+        // Assign to this 'FlatHashTable_IteratorImp' the value of the
+        // specified 'rhs'.
+
+    void operator++();
+        // Advance this 'FlatHashTable_IteratorImp' to the next present element
+        // in the underlying flat hash table.  If there is no such element,
+        // assign this object to 'FlatHashTable_IteratorImp()'.  The behavior
+        // is undefined unless this 'FlatHashTable_IteratorImp' refers to a
+        // valid element of the underlying sequence.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the element referred to by this
+        // 'FlatHashTable_IteratorImp'.  The behavior is undefined unless this
+        // 'FlatHashTable_IteratorImp() != *this'.
+
+    const unsigned char *controls() const;
+        // Return the address of the control value of the element referred to
+        // by this 'FlatHashTable_IteratorImp', or 0 if this object has the
+        // default value.
+
+    ENTRY *entries() const;
+        // Return the address of the element referred to by this
+        // 'FlatHashTable_IteratorImp', or 0 if this object has the default
+        // value.
+
+    std::size_t additionalLength() const;
+        // Return the number of entries of the underlying flat hash table
+        // following the element referred to by this
+        // 'FlatHashTable_IteratorImp'.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& a,
+                const FlatHashTable_IteratorImp<ENTRY>& b);
+    // Return 'true' if the specified 'a' and 'b' are equal.  Two
+    // 'FlatHashTable_IteratorImp' objects are equal if they both refer to the
+    // same element of the underlying flat hash table, or are both not
+    // dereferenceable.  The behavior is undefined unless 'a' and 'b' refer to
+    // the same 'FlatHashTable'.
+
+                          // ===================
+                          // class FlatHashTable
+                          // ===================
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+class FlatHashTable {
+    // This class template provides an open-addressed hash table, holding
+    // 'ENTRY' objects identified by unique 'KEY' values, useful for
+    // implementing the flat unordered containers.
+
+  public:
+    // TYPES
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                     rebind_traits<ENTRY>     AllocatorTraits;
+    typedef typename AllocatorTraits::allocator_type          AllocatorType;
+
+    typedef FlatHashTable_GroupControl                        GroupControl;
+
+    typedef FlatHashTable_IteratorImp<ENTRY>                  IteratorImp;
+
+    typedef ForwardIterator<ENTRY, IteratorImp>               iterator;
+    typedef ForwardIterator<const ENTRY, IteratorImp>         const_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef bslmf::MovableRefUtil                             MoveUtil;
+
+    // DATA
+    ENTRY         *d_entries_p;          // entries of this table, followed by
+                                         // the control values
+
+    unsigned char *d_controls_p;         // control values of this table
+
+    std::size_t    d_size;               // number of entries in use
+
+    std::size_t    d_capacity;           // number of entries
+
+    int            d_groupControlShift;  // number of bits to shift the hash
+                                         // value to obtain the first group
+
+    HASH           d_hasher;             // hashing functor
+
+    EQUAL          d_equal;              // key-equality functor
+
+    AllocatorType  d_allocator;          // allocator of the entries
+
+    // PRIVATE CLASS METHODS
+    static std::size_t findAvailable(const unsigned char *controls,
+                                     std::size_t          index,
+                                     std::size_t          capacity);
+        // Return the index of the first available entry indicated by the
+        // specified 'controls' at or after the specified 'index', assuming
+        // 'controls' has the specified 'capacity'.  The behavior is undefined
+        // unless 'index < capacity', 'index' is a multiple of
+        // 'GroupControl::k_SIZE', and 'controls' has at least one available
+        // entry.
+
+    static std::size_t numAllocatedEntries(std::size_t capacity);
+        // Return the number of 'ENTRY' objects to allocate to hold the
+        // specified 'capacity' entries followed by 'capacity' control values.
+
+    // PRIVATE MANIPULATORS
+    void allocateArrays(std::size_t capacity);
+        // Allocate the entries and control values of this table for the
+        // specified 'capacity', and mark every entry empty.  The behavior is
+        // undefined unless this table is in the zero-capacity state, and
+        // 'capacity' is either 0 or a power of two that is at least
+        // 'k_MIN_CAPACITY'.
+
+    std::size_t indexOfKey(bool        *notFound,
+                           const KEY&   key,
+                           std::size_t  hashValue);
+        // Return the index of the entry within 'd_entries_p' containing the
+        // specified 'key', which has the specified 'hashValue', if the 'key'
+        // is present, and the index of an available entry at which an entry
+        // having 'key' can be inserted otherwise, and load into the specified
+        // 'notFound' whether the 'key' was absent.  This method rehashes the
+        // table if the 'key' was not present and the addition of an entry
+        // would cause the load factor to exceed 'max_load_factor()'.  The
+        // behavior is undefined unless 'hashValue == hashKey(key)'.
+
+    void quickSwap(FlatHashTable *other);
+        // Exchange the entries, hasher, and key-equality functor of this
+        // table with those of the specified 'other' table, without exchanging
+        // the allocators.  This method does not throw.
+
+    void rehashRaw(std::size_t newCapacity);
+        // Change the capacity of this table to the specified 'newCapacity',
+        // and move all the contained entries into the new sequence of entries,
+        // according to their hash values.  The behavior is undefined unless
+        // '0 < newCapacity' and 'newCapacity' satisfies all class invariants.
+
+    void copyEntries(const FlatHashTable& original);
+        // Copy-construct, at the same indices in this table, each entry of the
+        // specified 'original' table.  The behavior is undefined unless this
+        // table is empty and has the same capacity as 'original'.
+
+    void moveEntries(FlatHashTable *original);
+        // Move-construct, at the same indices in this table, each entry of the
+        // specified 'original' table, leaving the entries of 'original' in a
+        // valid but unspecified state.  The behavior is undefined unless this
+        // table is empty and has the same capacity as 'original'.
+
+    // PRIVATE ACCESSORS
+    template <class LOOKUP_KEY>
+    std::size_t hashKey(const LOOKUP_KEY& key) const;
+        // Return the hash value of the specified 'key' used to place it in
+        // this table: the value returned by 'd_hasher' for 'key', multiplied
+        // by a large odd constant so that the high-order bits (selecting the
+        // first group probed) depend on all the bits of the value returned by
+        // 'd_hasher'.  Note that this makes the table robust to hash functors,
+        // such as the identity hash 'bsl::hash' provides for integral types,
+        // whose high-order bits are mostly zero.
+
+    template <class LOOKUP_KEY>
+    std::size_t findKey(const LOOKUP_KEY& key, std::size_t hashValue) const;
+        // Return the index of the entry within 'd_entries_p' containing the
+        // specified 'key', which has the specified 'hashValue', or
+        // 'd_capacity' if the 'key' is not present.  The behavior is undefined
+        // unless 'hashValue == hashKey(key)'.  Note that 'LOOKUP_KEY' is
+        // 'KEY' unless the hasher and key-equality functor are transparent.
+
+    std::size_t minimumCompliantCapacity(std::size_t minimumCapacity) const;
+        // Return the minimum capacity that satisfies all class invariants, and
+        // is at least the specified 'minimumCapacity'.
+
+  public:
+    // PUBLIC CLASS DATA
+    static const std::size_t   k_MIN_CAPACITY = 2 * GroupControl::k_SIZE;
+                                                      // min. non-zero capacity
+
+    static const unsigned char k_HASHLET_MASK = 0x7f; // hashlet = hash & MASK
+
+    static const std::size_t   k_MAX_LOAD_FACTOR_NUMERATOR = 7;
+                                                      // numerator of fraction
+                                                      // that specifies the
+                                                      // maximum load factor
+
+    static const std::size_t   k_MAX_LOAD_FACTOR_DENOMINATOR = 8;
+                                                      // denominator of
+                                                      // fraction that
+                                                      // specifies the maximum
+                                                      // load factor
+
+    // CREATORS
+    FlatHashTable(std::size_t      capacity,
+                  const HASH&      hash,
+                  const EQUAL&     equal,
+                  const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create an empty table having at least the specified 'capacity', that
+        // will use the specified 'hash' to generate hash values for the keys
+        // of the entries contained in this table, and the specified 'equal' to
+        // verify that the keys of the two entries are the same.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  If
+        // '0 == capacity', no memory is allocated and the object is defined to
+        // be in the "zero-capacity" state.
+
+    FlatHashTable(const FlatHashTable& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original', using the specified
+        // 'basicAllocator' to supply memory.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);       // IMPLICIT
+        // Create a table having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new table.  The allocator associated with 'original' is
+        // propagated for use in the newly-created table.  'original' is left
+        // in a valid but unspecified state.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original,
+                  const ALLOCATOR&                 basicAllocator);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' compares
+        // equal to the allocator of 'original', the contents of 'original'
+        // are moved (in constant time) to the new table and 'original' is left
+        // in a valid but unspecified state; otherwise, each entry of
+        // 'original' is moved into the new table, and 'original' is left in a
+        // valid but unspecified state.
+
+    ~FlatHashTable();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'propagate_on_container_copy_assignment' trait of
+        // 'AllocatorTraits' is 'true', and return a reference providing
+        // modifiable access to this object.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'propagate_on_container_move_assignment' trait of
+        // 'AllocatorTraits' is 'true', and return a reference providing
+        // modifiable access to this object.  The entries of 'rhs' are moved
+        // (in constant time) to this object if the allocator of this object,
+        // after propagation, compares equal to that of 'rhs'; otherwise, each
+        // entry of 'rhs' is moved into this table.  In either case, 'rhs' is
+        // left in a valid but unspecified state.
+
+    template <class KEY_TYPE>
+    ENTRY& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // If an entry with the specified 'key' is not already present in this
+        // table, insert an entry having the value defined by
+        // 'ENTRY_UTIL::construct'; otherwise, this method has no effect.
+        // Return a reference to the (possibly newly inserted) entry in this
+        // table having the 'key'.
+
+    void clear();
+        // Remove all entries from this table.  Note that this table will be
+        // empty after calling this method, but allocated memory may be
+        // retained for future use.  See the 'capacity' method.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of entries in this table having the specified 'key', where
+        // the first iterator is positioned at the start of the sequence, and
+        // the second is positioned one past the end of the sequence.  If this
+        // table contains no entry having 'key', then the two returned
+        // iterators will have the same value, 'end()'.
+
+    std::size_t erase(const KEY& key);
+        // Remove from this table the entry having the specified 'key', if it
+        // exists, and return 1; otherwise (there is no entry having 'key' in
+        // this table), return 0 with no other effect.  This method invalidates
+        // all iterators and references to the removed entry.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this table the entry at the specified 'position', and
+        // return an iterator referring to the entry immediately following the
+        // removed entry, or to the past-the-end position if the removed entry
+        // was the last in the sequence.  The behavior is undefined unless
+        // 'position' refers to an entry in this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this table the entries starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to entries in this table or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the iteration sequence provided by this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator providing modifiable access to the entry in this
+        // table having the specified 'key', if such an entry exists, and
+        // 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the entry in this
+        // table having a key equivalent to the specified 'key', if such an
+        // entry exists, and 'end()' otherwise.  The key is neither converted
+        // to 'KEY' nor copied.  Note that this overload participates in
+        // overload resolution only if both the hasher and key-equality functor
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        std::size_t index = findKey(key, hashKey(key));
+        if (index < d_capacity) {
+            return iterator(IteratorImp(d_entries_p  + index,
+                                        d_controls_p + index,
+                                        d_capacity   - index - 1));   // RETURN
+        }
+        return end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      bsl::pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of entries in this table having a key equivalent to the
+        // specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this table contains no such entry, then
+        // the two returned iterators will have the same value, 'end()'.  Note
+        // that this overload participates in overload resolution only if both
+        // the hasher and key-equality functor are transparent.  Also note:
+        // implemented inline due to Sun CC compilation error.
+    {
+        iterator first = find(key);
+        if (first == end()) {
+            return bsl::pair<iterator, iterator>(first, first);       // RETURN
+        }
+        iterator last = first;
+        ++last;
+        return bsl::pair<iterator, iterator>(first, last);
+    }
+
+    template <class ENTRY_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<ENTRY_TYPE, ENTRY>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+        // Insert the specified 'entry' into this table if the key of the
+        // 'entry' does not already exist in this table; otherwise, this method
+        // has no effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) entry in this table whose
+        // key is equal to that of the entry to be inserted, and whose 'second'
+        // member is 'true' if a new entry was inserted, and 'false' if an
+        // entry having an equal key was already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        bool        notFound;
+        std::size_t hashValue = hashKey(ENTRY_UTIL::key(entry));
+        std::size_t index     = indexOfKey(&notFound,
+                                           ENTRY_UTIL::key(entry),
+                                           hashValue);
+
+        if (notFound) {
+            AllocatorTraits::construct(
+                             d_allocator,
+                             d_entries_p + index,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+
+            d_controls_p[index] = static_cast<unsigned char>(
+                                                   hashValue & k_HASHLET_MASK);
+            ++d_size;
+        }
+
+        return bsl::pair<iterator, bool>(
+                                     iterator(IteratorImp(
+                                                   d_entries_p  + index,
+                                                   d_controls_p + index,
+                                                   d_capacity   - index - 1)),
+                                     notFound);
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create an entry for each iterator in the range starting at the
+        // specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, by converting from the object referred to
+        // by each iterator, and insert into this table each such entry whose
+        // key is not already contained.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last'.
+
+    void rehash(std::size_t minimumCapacity);
+        // Change the capacity of this table to at least the specified
+        // 'minimumCapacity', and redistribute all the contained entries into a
+        // new sequence of entries, according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the table is returned to
+        // the zero-capacity state.  On return, 'load_factor()' is less than or
+        // equal to 'max_load_factor()' and all iterators, pointers, and
+        // references to entries of this table are invalidated.
+
+    void reserve(std::size_t numEntries);
+        // Change the capacity of this table to at least a capacity that can
+        // accommodate the specified 'numEntries' (accounting for the load
+        // factor invariant), and redistribute all the contained entries into
+        // a new sequence of entries, according to their hash values.
+
+    void reset();
+        // Remove all entries from this table and release all memory from this
+        // table, returning the table to the zero-capacity state.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator representing the beginning of the sequence of
+        // entries held by this table.
+
+    iterator end();
+        // Return an iterator representing one past the end of the sequence of
+        // entries held by this table.
+
+                           // Aspects
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, and key-equality functor of this table
+        // with those of the specified 'other' table, and exchange the
+        // allocators if 'AllocatorTraits::propagate_on_container_swap' is
+        // 'true'.  This method provides the no-throw exception-safety
+        // guarantee.  The behavior is undefined unless the allocators are
+        // propagated on swap, or this table was created with an allocator
+        // that compares equal to that of 'other'.
+
+    // ACCESSORS
+    const AllocatorType& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // used by this table to supply memory.
+
+    std::size_t capacity() const;
+        // Return the number of entries this table could hold if the load
+        // factor were 1.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table contains an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this table contains an entry having a key
+        // equivalent to the specified 'key', and 'false' otherwise.  Note that
+        // this overload participates in overload resolution only if both the
+        // hasher and key-equality functor are transparent.  Also note:
+        // implemented inline due to Sun CC compilation error.
+    {
+        return d_capacity != findKey(key, hashKey(key));
+    }
+
+    const unsigned char *controls() const;
+        // Return the address of the first element of the underlying array of
+        // control values in this table, or 0 if this table is in the
+        // zero-capacity state.
+
+    std::size_t count(const KEY& key) const;
+        // Return the number of entries in this table having the specified
+        // 'key'.  Note that since a table maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      std::size_t>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of entries in this table having a key equivalent
+        // to the specified 'key'.  Note that this overload participates in
+        // overload resolution only if both the hasher and key-equality functor
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    bool empty() const;
+        // Return 'true' if this table contains no entries, and 'false'
+        // otherwise.
+
+    const ENTRY *entries() const;
+        // Return the address of the first element of the underlying array of
+        // entries in this table, or 0 if this table is in the zero-capacity
+        // state.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of entries in this table having the specified 'key', where
+        // the first iterator is positioned at the start of the sequence, and
+        // the second is positioned one past the end of the sequence.  If this
+        // table contains no entry having 'key', then the two returned
+        // iterators will have the same value, 'end()'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of entries in this table having a key equivalent to the
+        // specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this table contains no such entry, then
+        // the two returned iterators will have the same value, 'end()'.  Note
+        // that this overload participates in overload resolution only if both
+        // the hasher and key-equality functor are transparent.  Also note:
+        // implemented inline due to Sun CC compilation error.
+    {
+        const_iterator first = find(key);
+        if (first == end()) {
+            return bsl::pair<const_iterator, const_iterator>(
+                                                        first,
+                                                        first);       // RETURN
+        }
+        const_iterator last = first;
+        ++last;
+        return bsl::pair<const_iterator, const_iterator>(first, last);
+    }
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator providing non-modifiable access to the entry in
+        // this table having the specified 'key', if such an entry exists, and
+        // 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the entry in
+        // this table having a key equivalent to the specified 'key', if such
+        // an entry exists, and 'end()' otherwise.  The key is neither
+        // converted to 'KEY' nor copied.  Note that this overload participates
+        // in overload resolution only if both the hasher and key-equality
+        // functor are transparent.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        std::size_t index = findKey(key, hashKey(key));
+        if (index < d_capacity) {
+            return const_iterator(IteratorImp(
+                                         d_entries_p  + index,
+                                         d_controls_p + index,
+                                         d_capacity   - index - 1));  // RETURN
+        }
+        return end();
+    }
+
+    const HASH& hash_function() const;
+        // Return a reference providing non-modifiable access to the hashing
+        // functor used by this table.
+
+    const EQUAL& key_eq() const;
+        // Return a reference providing non-modifiable access to the
+        // key-equality functor used by this table.
+
+    float load_factor() const;
+        // Return the current ratio between the number of entries in this
+        // table and its capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this table.  Note that if
+        // an insert operation would cause the load factor to exceed
+        // 'max_load_factor()', that same insert operation will increase the
+        // capacity and rehash the entries of the table (see {Load Factor and
+        // Resizing}).
+
+    std::size_t max_size() const;
+        // Return a theoretical upper bound on the largest number of entries
+        // that this table could possibly hold.
+
+    std::size_t size() const;
+        // Return the number of entries in this table.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' representing the beginning of the sequence
+        // of entries held by this table.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' representing one past the end of the
+        // sequence of entries held by this table.
+};
+
+// FREE OPERATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+bool operator==(
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& lhs,
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashTable' objects have the same
+    // value if they have the same number of entries, and for each entry that
+    // is contained in 'lhs' there is an entry contained in 'rhs' having the
+    // same value.  Note that this method requires the (template parameter)
+    // type 'ENTRY' to be equality-comparable.
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+bool operator!=(
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& lhs,
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashTable' objects do not
+    // have the same value if they do not have the same number of entries, or
+    // for some entry contained in 'lhs' there is no entry in 'rhs' having the
+    // same value.  Note that this method requires the (template parameter)
+    // type 'ENTRY' to be equality-comparable.
+
+// FREE FUNCTIONS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This function
+    // provides the no-throw exception-safety guarantee if the allocators are
+    // propagated on swap or the two objects were created with allocators that
+    // compare equal, and the basic guarantee otherwise.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class FlatHashTable_GroupControl
+                      // --------------------------------
+
+// PRIVATE ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::matchRaw(unsigned char value) const
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    return static_cast<BitMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                                       _mm_set1_epi8(static_cast<char>(value)),
+                                       d_value)));
+#else
+    Storage t = d_value ^ (k_MULT * value);
+
+    t = t | (t << 4);
+    t = t | (t << 2);
+    t = t | (t << 1);
+
+    return static_cast<BitMask>(
+                         (((~t) & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
+#endif
+}
+
+// CLASS METHODS
+inline
+int FlatHashTable_GroupControl::numTrailingUnsetBits(BitMask mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    int index = 0;
+    while (0 == (mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                     const unsigned char *data)
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    d_value = _mm_loadu_si128(static_cast<const Storage *>(
+                                             static_cast<const void *>(data)));
+#else
+    std::memcpy(&d_value, data, k_SIZE);
+    d_value = BSLS_BYTEORDER_HOST_U64_TO_LE(d_value);
+#endif
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::available() const
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    return static_cast<BitMask>(_mm_movemask_epi8(d_value));
+#else
+    return static_cast<BitMask>(
+                      ((d_value & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
+#endif
+}
+
+inline
+FlatHashTable_GroupControl::BitMask FlatHashTable_GroupControl::inUse() const
+{
+    return (~available()) & ((1u << k_SIZE) - 1);
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::match(unsigned char value) const
+{
+    BSLS_ASSERT_SAFE(0 == (value & 0x80));
+
+    return matchRaw(value);
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    return 0 != matchRaw(k_EMPTY);
+}
+
+                      // -------------------------------
+                      // class FlatHashTable_IteratorImp
+                      // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entries_p(0)
+, d_controls_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                         ENTRY               *entries,
+                                         const unsigned char *controls,
+                                         std::size_t          additionalLength)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_additionalLength(additionalLength)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+    BSLS_ASSERT_SAFE(d_controls_p);
+
+    while (d_additionalLength) {
+        ++d_entries_p;
+        ++d_controls_p;
+        --d_additionalLength;
+        if (0 == (*d_controls_p & FlatHashTable_GroupControl::k_EMPTY)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+    BSLS_ASSERT_SAFE(d_controls_p);
+
+    return *d_entries_p;
+}
+
+template <class ENTRY>
+inline
+const unsigned char *FlatHashTable_IteratorImp<ENTRY>::controls() const
+{
+    return d_controls_p;
+}
+
+template <class ENTRY>
+inline
+ENTRY *FlatHashTable_IteratorImp<ENTRY>::entries() const
+{
+    return d_entries_p;
+}
+
+template <class ENTRY>
+inline
+std::size_t FlatHashTable_IteratorImp<ENTRY>::additionalLength() const
+{
+    return d_additionalLength;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bslstl::operator==(const FlatHashTable_IteratorImp<ENTRY>& a,
+                        const FlatHashTable_IteratorImp<ENTRY>& b)
+{
+    return a.d_entries_p        == b.d_entries_p
+        && a.d_controls_p       == b.d_controls_p
+        && a.d_additionalLength == b.d_additionalLength;
+}
+
+namespace bslstl {
+
+                          // -------------------
+                          // class FlatHashTable
+                          // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::findAvailable(
+                                                const unsigned char *controls,
+                                                std::size_t          index,
+                                                std::size_t          capacity)
+{
+    BSLS_ASSERT_SAFE(index < capacity);
+
+    for (std::size_t i = 0; i < capacity; i += GroupControl::k_SIZE) {
+        GroupControl          groupControl(controls + index);
+        GroupControl::BitMask candidates = groupControl.available();
+
+        if (candidates) {
+            return index + GroupControl::numTrailingUnsetBits(
+                                                          candidates);// RETURN
+        }
+
+        index = (index + GroupControl::k_SIZE) & (capacity - 1);
+    }
+
+    BSLS_ASSERT_OPT(false && "execution should never reach this location");
+    return capacity;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                   numAllocatedEntries(std::size_t capacity)
+{
+    return capacity + (capacity + sizeof(ENTRY) - 1) / sizeof(ENTRY);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::allocateArrays(
+                                                          std::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_entries_p);
+    BSLS_ASSERT_SAFE(0 == capacity || k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+
+    if (0 == capacity) {
+        return;                                                       // RETURN
+    }
+
+    ENTRY *entries = AllocatorTraits::allocate(d_allocator,
+                                               numAllocatedEntries(capacity));
+
+    d_entries_p  = entries;
+    d_controls_p = reinterpret_cast<unsigned char *>(entries + capacity);
+    d_capacity   = capacity;
+
+    std::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+
+    int log2 = 0;
+    for (std::size_t numGroups = capacity / GroupControl::k_SIZE;
+         numGroups > 1;
+         numGroups >>= 1) {
+        ++log2;
+    }
+    d_groupControlShift = static_cast<int>(sizeof(std::size_t) * 8) - log2;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::indexOfKey(
+                                                     bool        *notFound,
+                                                     const KEY&   key,
+                                                     std::size_t  hashValue)
+{
+    std::size_t index = findKey(key, hashValue);
+
+    if (index == d_capacity) {
+        *notFound = true;
+
+        if (d_size >= k_MAX_LOAD_FACTOR_NUMERATOR
+                    * (d_capacity / k_MAX_LOAD_FACTOR_DENOMINATOR)) {
+            rehashRaw(d_capacity > 0 ? 2 * d_capacity : k_MIN_CAPACITY);
+        }
+
+        index = (hashValue >> d_groupControlShift) * GroupControl::k_SIZE;
+        index = findAvailable(d_controls_p, index, d_capacity);
+    }
+    else {
+        *notFound = false;
+    }
+
+    return index;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::quickSwap(
+                                                          FlatHashTable *other)
+{
+    using std::swap;
+
+    swap(d_entries_p,         other->d_entries_p);
+    swap(d_controls_p,        other->d_controls_p);
+    swap(d_size,              other->d_size);
+    swap(d_capacity,          other->d_capacity);
+    swap(d_groupControlShift, other->d_groupControlShift);
+    swap(d_hasher,            other->d_hasher);
+    swap(d_equal,             other->d_equal);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::rehashRaw(
+                                                       std::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(          0 <  newCapacity);
+    BSLS_ASSERT_SAFE(newCapacity == minimumCompliantCapacity(newCapacity));
+
+    FlatHashTable tmp(0, d_hasher, d_equal, d_allocator);
+    tmp.allocateArrays(newCapacity);
+
+    for (std::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+        unsigned char *controlStart = d_controls_p + i;
+        ENTRY         *entryStart   = d_entries_p  + i;
+
+        GroupControl          groupControl(controlStart);
+        GroupControl::BitMask candidates = groupControl.inUse();
+        while (candidates) {
+            int    offset = GroupControl::numTrailingUnsetBits(candidates);
+            ENTRY *entry  = entryStart + offset;
+
+            // Destroy the entry if moving it throws.
+
+            bslma::DestructorProctor<ENTRY> proctor(entry);
+
+            controlStart[offset] = GroupControl::k_ERASED;
+            --d_size;
+
+            std::size_t hashValue = tmp.hashKey(ENTRY_UTIL::key(*entry));
+            std::size_t index     = (hashValue >> tmp.d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+
+            index = findAvailable(tmp.d_controls_p, index, tmp.d_capacity);
+
+            bslalg::ArrayPrimitives::destructiveMove(tmp.d_entries_p + index,
+                                                     entry,
+                                                     entry + 1,
+                                                     d_allocator);
+            proctor.release();
+
+            tmp.d_controls_p[index] = static_cast<unsigned char>(
+                                                   hashValue & k_HASHLET_MASK);
+            ++tmp.d_size;
+
+            candidates &= candidates - 1;
+        }
+    }
+
+    quickSwap(&tmp);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::copyEntries(
+                                                 const FlatHashTable& original)
+{
+    BSLS_ASSERT_SAFE(0          == d_size);
+    BSLS_ASSERT_SAFE(d_capacity == original.d_capacity);
+
+    // Each entry is marked in use only once constructed, so that the
+    // destructor of this table destroys exactly the constructed entries if a
+    // constructor throws.
+
+    for (std::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (original.d_controls_p[i] & GroupControl::k_EMPTY)) {
+            AllocatorTraits::construct(
+                                   d_allocator,
+                                   d_entries_p + i,
+                                   static_cast<const ENTRY&>(
+                                                    original.d_entries_p[i]));
+            ++d_size;
+        }
+        d_controls_p[i] = original.d_controls_p[i];
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::moveEntries(
+                                                       FlatHashTable *original)
+{
+    BSLS_ASSERT_SAFE(0          == d_size);
+    BSLS_ASSERT_SAFE(d_capacity == original->d_capacity);
+
+    for (std::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (original->d_controls_p[i] & GroupControl::k_EMPTY)) {
+            AllocatorTraits::construct(
+                                  d_allocator,
+                                  d_entries_p + i,
+                                  MoveUtil::move(original->d_entries_p[i]));
+            ++d_size;
+        }
+        d_controls_p[i] = original->d_controls_p[i];
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::hashKey(
+                                                   const LOOKUP_KEY& key) const
+{
+    static const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    return static_cast<std::size_t>(d_hasher(key))
+         * static_cast<std::size_t>(k_MULTIPLIER);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+template <class LOOKUP_KEY>
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::findKey(
+                                          const LOOKUP_KEY& key,
+                                          std::size_t       hashValue) const
+{
+    std::size_t   index   = (hashValue >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+    unsigned char hashlet = static_cast<unsigned char>(
+                                                   hashValue & k_HASHLET_MASK);
+
+    for (std::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+        const unsigned char *controlStart = d_controls_p + index;
+        const ENTRY         *entryStart   = d_entries_p  + index;
+
+        GroupControl          groupControl(controlStart);
+        GroupControl::BitMask candidates = groupControl.match(hashlet);
+        while (candidates) {
+            int offset = GroupControl::numTrailingUnsetBits(candidates);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                      d_equal(ENTRY_UTIL::key(entryStart[offset]), key))) {
+                return index + offset;                                // RETURN
+            }
+            candidates &= candidates - 1;
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
+            break;
+        }
+
+        index = (index + GroupControl::k_SIZE) & (d_capacity - 1);
+    }
+
+    return d_capacity;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                  minimumCompliantCapacity(std::size_t minimumCapacity) const
+{
+    std::size_t minForEntries = ((d_size + k_MAX_LOAD_FACTOR_NUMERATOR - 1)
+                                                 / k_MAX_LOAD_FACTOR_NUMERATOR)
+                              * k_MAX_LOAD_FACTOR_DENOMINATOR;
+
+    std::size_t capacity = minimumCapacity >= minForEntries
+                         ? minimumCapacity
+                         : minForEntries;
+
+    if (0 < capacity) {
+        std::size_t result = k_MIN_CAPACITY;
+        while (result < capacity) {
+            result <<= 1;
+        }
+        capacity = result;
+    }
+
+    return capacity;
+}
+
+// CREATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::FlatHashTable(
+                                               std::size_t      capacity,
+                                               const HASH&      hash,
+                                               const EQUAL&     equal,
+                                               const ALLOCATOR& basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator(basicAllocator)
+{
+    allocateArrays(minimumCompliantCapacity(capacity));
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::FlatHashTable(
+                                           const FlatHashTable& original,
+                                           const ALLOCATOR&     basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator(basicAllocator)
+{
+    if (original.d_capacity) {
+        FlatHashTable tmp(0, d_hasher, d_equal, d_allocator);
+        tmp.allocateArrays(original.d_capacity);
+        tmp.copyEntries(original);
+        quickSwap(&tmp);
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(MoveUtil::access(original).d_entries_p)
+, d_controls_p(MoveUtil::access(original).d_controls_p)
+, d_size(MoveUtil::access(original).d_size)
+, d_capacity(MoveUtil::access(original).d_capacity)
+, d_groupControlShift(MoveUtil::access(original).d_groupControlShift)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator(MoveUtil::access(original).d_allocator)
+{
+    FlatHashTable& reference = original;
+
+    reference.d_entries_p         = 0;
+    reference.d_controls_p        = 0;
+    reference.d_size              = 0;
+    reference.d_capacity          = 0;
+    reference.d_groupControlShift = 0;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::FlatHashTable(
+                               bslmf::MovableRef<FlatHashTable> original,
+                               const ALLOCATOR&                 basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator(basicAllocator)
+{
+    FlatHashTable& reference = original;
+
+    if (d_allocator == reference.d_allocator) {
+        quickSwap(&reference);
+    }
+    else if (reference.d_capacity) {
+        FlatHashTable tmp(0, d_hasher, d_equal, d_allocator);
+        tmp.allocateArrays(reference.d_capacity);
+        tmp.moveEntries(&reference);
+        quickSwap(&tmp);
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::~FlatHashTable()
+{
+    if (d_entries_p) {
+        clear();
+        AllocatorTraits::deallocate(d_allocator,
+                                    d_entries_p,
+                                    numAllocatedEntries(d_capacity));
+    }
+}
+
+// MANIPULATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            using std::swap;
+
+            FlatHashTable other(rhs, rhs.d_allocator);
+            quickSwap(&other);
+            swap(d_allocator, other.d_allocator);
+        }
+        else {
+            FlatHashTable other(rhs, d_allocator);
+            quickSwap(&other);
+        }
+    }
+    return *this;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& reference = rhs;
+    if (this != &reference) {
+        if (d_allocator == reference.d_allocator) {
+            FlatHashTable other(MoveUtil::move(reference));
+            quickSwap(&other);
+        }
+        else if (
+              AllocatorTraits::propagate_on_container_move_assignment::value) {
+            using std::swap;
+
+            FlatHashTable other(MoveUtil::move(reference));
+            quickSwap(&other);
+            swap(d_allocator, other.d_allocator);
+        }
+        else {
+            FlatHashTable other(MoveUtil::move(reference), d_allocator);
+            quickSwap(&other);
+        }
+    }
+    return *this;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+template <class KEY_TYPE>
+ENTRY& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+              operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    const KEY&  keyRef    = key;
+    bool        notFound;
+    std::size_t hashValue = hashKey(keyRef);
+    std::size_t index     = indexOfKey(&notFound, keyRef, hashValue);
+
+    if (notFound) {
+        ENTRY_UTIL::construct(d_entries_p + index,
+                              d_allocator,
+                              BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+
+        d_controls_p[index] = static_cast<unsigned char>(
+                                                   hashValue & k_HASHLET_MASK);
+        ++d_size;
+    }
+
+    return d_entries_p[index];
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::clear()
+{
+    for (std::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+            AllocatorTraits::destroy(d_allocator, d_entries_p + i);
+            --d_size;
+        }
+    }
+
+    std::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    d_size = 0;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+bsl::pair<typename FlatHashTable<KEY,
+                                 ENTRY,
+                                 ENTRY_UTIL,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::iterator,
+          typename FlatHashTable<KEY,
+                                 ENTRY,
+                                 ENTRY_UTIL,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                                const KEY& key)
+{
+    iterator first = find(key);
+    if (first == end()) {
+        return bsl::pair<iterator, iterator>(first, first);           // RETURN
+    }
+    iterator last = first;
+    ++last;
+    return bsl::pair<iterator, iterator>(first, last);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                         erase(const KEY& key)
+{
+    std::size_t index = findKey(key, hashKey(key));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    AllocatorTraits::destroy(d_allocator, d_entries_p + index);
+    d_controls_p[index] = GroupControl::k_ERASED;
+    --d_size;
+
+    return 1;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                      iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    std::size_t index = &*position - d_entries_p;
+
+    AllocatorTraits::destroy(d_allocator, d_entries_p + index);
+    d_controls_p[index] = GroupControl::k_ERASED;
+    --d_size;
+
+    if (d_size) {
+        for (std::size_t i = index + 1; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                return iterator(IteratorImp(d_entries_p  + i,
+                                            d_controls_p + i,
+                                            d_capacity   - i - 1));   // RETURN
+            }
+        }
+    }
+    return end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                      iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::erase(
+                                                             iterator position)
+{
+    // Note that this overload is necessary to avoid ambiguity when the key is
+    // a table iterator.
+
+    return erase(const_iterator(position));
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                      iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    iterator rv = end();
+    if (last != end()) {
+        std::size_t index = &*last - d_entries_p;
+        rv = iterator(IteratorImp(d_entries_p  + index,
+                                  d_controls_p + index,
+                                  d_capacity   - index - 1));
+    }
+
+    while (first != last) {
+        // Note that the control value of an erased entry remains marked as
+        // erased, so incrementing an iterator referring to it is valid.
+
+        const_iterator position = first;
+        ++first;
+        erase(position);
+    }
+
+    return rv;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                      iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::find(
+                                                                const KEY& key)
+{
+    std::size_t index = findKey(key, hashKey(key));
+    if (index < d_capacity) {
+        return iterator(IteratorImp(d_entries_p  + index,
+                                    d_controls_p + index,
+                                    d_capacity   - index - 1));       // RETURN
+    }
+    return end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::rehash(
+                                                   std::size_t minimumCapacity)
+{
+    minimumCapacity = minimumCompliantCapacity(minimumCapacity);
+    if (0 < minimumCapacity) {
+        if (minimumCapacity != d_capacity) {
+            rehashRaw(minimumCapacity);
+        }
+    }
+    else if (d_entries_p) {
+        reset();
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::reserve(
+                                                        std::size_t numEntries)
+{
+    if (0 == d_capacity && 0 == numEntries) {
+        return;                                                       // RETURN
+    }
+
+    std::size_t minimumCapacity = numEntries * k_MAX_LOAD_FACTOR_DENOMINATOR
+                                             / k_MAX_LOAD_FACTOR_NUMERATOR;
+
+    if (minimumCapacity * k_MAX_LOAD_FACTOR_NUMERATOR
+                              < numEntries * k_MAX_LOAD_FACTOR_DENOMINATOR) {
+        ++minimumCapacity;
+    }
+
+    if (minimumCapacity > d_capacity) {
+        rehash(minimumCapacity);
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::reset()
+{
+    if (d_entries_p) {
+        clear();
+        AllocatorTraits::deallocate(d_allocator,
+                                    d_entries_p,
+                                    numAllocatedEntries(d_capacity));
+
+        d_entries_p         = 0;
+        d_controls_p        = 0;
+        d_capacity          = 0;
+        d_groupControlShift = 0;
+    }
+}
+
+                          // Iterators
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                      iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::begin()
+{
+    if (d_size) {
+        for (std::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                return iterator(IteratorImp(d_entries_p  + i,
+                                            d_controls_p + i,
+                                            d_capacity   - i - 1));   // RETURN
+            }
+        }
+    }
+    return end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                      iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::end()
+{
+    return iterator();
+}
+
+                           // Aspects
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::swap(
+                                                          FlatHashTable& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        using std::swap;
+
+        quickSwap(&other);
+        swap(d_allocator, other.d_allocator);
+    }
+    else {
+        // C++11 behavior: undefined for unequal allocators
+
+        BSLS_ASSERT(d_allocator == other.d_allocator);
+
+        quickSwap(&other);
+    }
+}
+
+// ACCESSORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+const typename FlatHashTable<KEY,
+                             ENTRY,
+                             ENTRY_UTIL,
+                             HASH,
+                             EQUAL,
+                             ALLOCATOR>::AllocatorType&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::allocator()
+                                                                          const
+{
+    return d_allocator;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::contains(
+                                                          const KEY& key) const
+{
+    return d_capacity != findKey(key, hashKey(key));
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+const unsigned char *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::controls() const
+{
+    return d_controls_p;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                   count(const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::empty()
+                                                                          const
+{
+    return 0 == d_size;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+const ENTRY *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::entries() const
+{
+    return d_entries_p;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+bsl::pair<typename FlatHashTable<KEY,
+                                 ENTRY,
+                                 ENTRY_UTIL,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::const_iterator,
+          typename FlatHashTable<KEY,
+                                 ENTRY,
+                                 ENTRY_UTIL,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                          const KEY& key) const
+{
+    const_iterator first = find(key);
+    if (first == end()) {
+        return bsl::pair<const_iterator, const_iterator>(first,
+                                                         first);      // RETURN
+    }
+    const_iterator last = first;
+    ++last;
+    return bsl::pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::find(
+                                                          const KEY& key) const
+{
+    std::size_t index = findKey(key, hashKey(key));
+    if (index < d_capacity) {
+        return const_iterator(IteratorImp(
+                                         d_entries_p  + index,
+                                         d_controls_p + index,
+                                         d_capacity   - index - 1));  // RETURN
+    }
+    return end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+const HASH& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                          hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+const EQUAL&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                            load_factor() const
+{
+    return d_capacity > 0
+         ? static_cast<float>(d_size) / static_cast<float>(d_capacity)
+         : 0.0f;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                        max_load_factor() const
+{
+    return static_cast<float>(k_MAX_LOAD_FACTOR_NUMERATOR)
+         / static_cast<float>(k_MAX_LOAD_FACTOR_DENOMINATOR);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                               max_size() const
+{
+    return AllocatorTraits::max_size(d_allocator) / 2
+                                        * k_MAX_LOAD_FACTOR_NUMERATOR
+                                        / k_MAX_LOAD_FACTOR_DENOMINATOR;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+                          // Iterators
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::begin() const
+{
+    if (d_size) {
+        for (std::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                return const_iterator(IteratorImp(
+                                             d_entries_p  + i,
+                                             d_controls_p + i,
+                                             d_capacity   - i - 1));  // RETURN
+            }
+        }
+    }
+    return end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::
+                                                                const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>::end() const
+{
+    return const_iterator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+bool bslstl::operator==(
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& lhs,
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    typedef typename FlatHashTable<KEY,
+                                   ENTRY,
+                                   ENTRY_UTIL,
+                                   HASH,
+                                   EQUAL,
+                                   ALLOCATOR>::const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator rhsIt = rhs.find(ENTRY_UTIL::key(*it));
+        if (rhsIt == rhs.end() || !(*rhsIt == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+inline
+bool bslstl::operator!=(
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& lhs,
+    const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR>
+void bslstl::swap(
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>& b)
+{
+    typedef FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, ALLOCATOR>
+                                                                     TableType;
+
+    if (TableType::AllocatorTraits::propagate_on_container_swap::value
+     || a.allocator() == b.allocator()) {
+        a.swap(b);
+    }
+    else {
+        TableType aCopy(a, b.allocator());
+        TableType bCopy(b, a.allocator());
+
+        b.swap(aCopy);
+        a.swap(bCopy);
+    }
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
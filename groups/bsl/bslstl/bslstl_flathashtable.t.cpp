@@ -0,0 +1,1027 @@
+// bslstl_flathashtable.t.cpp                                         -*-C++-*-
+#include <bslstl_flathashtable.h>
+
+#include <bslstl_equalto.h>
+#include <bslstl_hash.h>
+#include <bslstl_string.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_stdstatefulallocator.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides an open-addressed hash table,
+// 'bslstl::FlatHashTable', and the class 'bslstl::FlatHashTable_GroupControl'
+// used by the table to inspect a group of control bytes at once.  The group
+// control is tested directly against a brute-force computation of each of its
+// bit masks.  The table is tested through its manipulators and accessors
+// using 'bslma::TestAllocator' to verify that memory is obtained from the
+// table's allocator in a single block, that entries are constructed using
+// that allocator, and that no memory is leaked, including when exceptions are
+// thrown.  Allocator propagation on copy construction, assignment, and swap is
+// verified using 'bsltf::StdStatefulAllocator' instantiated with each
+// combination of the propagation traits.
+// ----------------------------------------------------------------------------
+// FlatHashTable_GroupControl
+// [ 2] FlatHashTable_GroupControl(const unsigned char *data);
+// [ 2] BitMask available() const;
+// [ 2] BitMask inUse() const;
+// [ 2] BitMask match(unsigned char value) const;
+// [ 2] bool neverFull() const;
+// [ 2] static int numTrailingUnsetBits(BitMask mask);
+//
+// FlatHashTable
+// [ 3] FlatHashTable(capacity, hash, equal, basicAllocator);
+// [ 4] FlatHashTable(const FlatHashTable&, basicAllocator);
+// [ 4] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 4] FlatHashTable(MovableRef<FlatHashTable>, basicAllocator);
+// [ 3] ~FlatHashTable();
+// [ 5] FlatHashTable& operator=(const FlatHashTable&);
+// [ 5] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 3] ENTRY& operator[](FORWARD_REF(KEY_TYPE) key);
+// [ 3] void clear();
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry);
+// [ 3] void rehash(bsl::size_t minimumCapacity);
+// [ 3] void reserve(bsl::size_t numEntries);
+// [ 3] void reset();
+// [ 5] void swap(FlatHashTable& other);
+// [ 3] bsl::size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] bsl::size_t size() const;
+// [ 4] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 5] void swap(FlatHashTable&, FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] EXCEPTION SAFETY
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::FlatHashTable_GroupControl GroupControl;
+
+const std::size_t k_SIZE = GroupControl::k_SIZE;
+
+template <class KEY>
+struct TestEntryUtil {
+    // This 'struct' provides the 'construct' and 'key' methods required of
+    // the 'ENTRY_UTIL' parameter of 'bslstl::FlatHashTable' for tables whose
+    // entries are their own keys.
+
+    // CLASS METHODS
+    template <class ALLOCATOR, class KEY_TYPE>
+    static void construct(
+                        KEY                                         *entry,
+                        ALLOCATOR&                                   allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+        // Construct at the specified 'entry' a copy of the specified 'key'
+        // using the specified 'allocator'.
+    {
+        bsl::allocator_traits<ALLOCATOR>::construct(
+                                 allocator,
+                                 entry,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+    }
+
+    static const KEY& key(const KEY& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+template <class KEY, class ALLOCATOR = bsl::allocator<KEY> >
+struct TestTable {
+    // This 'struct' provides a namespace for the instantiation of
+    // 'bslstl::FlatHashTable' used by this test driver for the (template
+    // parameter) types 'KEY' and 'ALLOCATOR'.
+
+    typedef bslstl::FlatHashTable<KEY,
+                                  KEY,
+                                  TestEntryUtil<KEY>,
+                                  bsl::hash<KEY>,
+                                  bsl::equal_to<KEY>,
+                                  ALLOCATOR> Type;
+};
+
+typedef TestTable<int>::Type         IntTable;
+typedef TestTable<bsl::string>::Type StringTable;
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique for the specified 'value'.
+{
+    char buffer[64];
+    sprintf(buffer, "a string that does not fit in the SSO buffer %d", value);
+    return bsl::string(buffer);
+}
+
+template <class TABLE>
+bool verifyIteration(const TABLE& table)
+    // Return 'true' if iterating over the specified 'table' visits exactly
+    // 'table.size()' entries, each of which is found by 'table.find', and
+    // 'false' otherwise.
+{
+    std::size_t count = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (table.find(*it) != it) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    return count == table.size();
+}
+
+template <bool PROPAGATE_ON_CONTAINER_COPY_CONSTRUCTION,
+          bool PROPAGATE_ON_CONTAINER_COPY_ASSIGNMENT,
+          bool PROPAGATE_ON_CONTAINER_SWAP,
+          bool PROPAGATE_ON_CONTAINER_MOVE_ASSIGNMENT>
+void testAllocatorPropagation()
+    // Verify that a 'bslstl::FlatHashTable' using a
+    // 'bsltf::StdStatefulAllocator' having the specified propagation traits
+    // propagates its allocator as indicated by those traits.
+{
+    typedef bsltf::StdStatefulAllocator<
+                                      bsl::string,
+                                      PROPAGATE_ON_CONTAINER_COPY_CONSTRUCTION,
+                                      PROPAGATE_ON_CONTAINER_COPY_ASSIGNMENT,
+                                      PROPAGATE_ON_CONTAINER_SWAP,
+                                      PROPAGATE_ON_CONTAINER_MOVE_ASSIGNMENT>
+                                                             StatefulAllocator;
+
+    typedef typename TestTable<bsl::string, StatefulAllocator>::Type Obj;
+
+    if (veryVerbose) {
+        printf("\tPOCCC = %d, POCCA = %d, POCS = %d, POCMA = %d\n",
+               PROPAGATE_ON_CONTAINER_COPY_CONSTRUCTION,
+               PROPAGATE_ON_CONTAINER_COPY_ASSIGNMENT,
+               PROPAGATE_ON_CONTAINER_SWAP,
+               PROPAGATE_ON_CONTAINER_MOVE_ASSIGNMENT);
+    }
+
+    bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("source",   veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const StatefulAllocator OA(&oa);
+    const StatefulAllocator SA(&sa);
+
+    {
+        Obj mX(0, bsl::hash<bsl::string>(), bsl::equal_to<bsl::string>(), SA);
+        for (int i = 0; i < 50; ++i) {
+            mX.insert(makeString(i));
+        }
+
+        // copy construction
+
+        const Obj Y(mX,
+                    bsl::allocator_traits<StatefulAllocator>::
+                         select_on_container_copy_construction(SA));
+        ASSERT(Y == mX);
+        ASSERT((PROPAGATE_ON_CONTAINER_COPY_CONSTRUCTION ? &sa : &da)
+                                                 == Y.allocator().allocator());
+
+        // copy assignment
+
+        Obj mZ(0, bsl::hash<bsl::string>(), bsl::equal_to<bsl::string>(), OA);
+        mZ.insert(makeString(-1));
+
+        mZ = mX;
+        ASSERT(mZ == mX);
+        ASSERT((PROPAGATE_ON_CONTAINER_COPY_ASSIGNMENT ? &sa : &oa)
+                                                == mZ.allocator().allocator());
+
+        // move assignment
+
+        Obj mW(0, bsl::hash<bsl::string>(), bsl::equal_to<bsl::string>(), OA);
+        mW.insert(makeString(-1));
+
+        Obj mS(mX, SA);
+
+        mW = bslmf::MovableRefUtil::move(mS);
+        ASSERT(mW == mX);
+        ASSERT((PROPAGATE_ON_CONTAINER_MOVE_ASSIGNMENT ? &sa : &oa)
+                                                == mW.allocator().allocator());
+
+        // swap
+
+        Obj mU(0, bsl::hash<bsl::string>(), bsl::equal_to<bsl::string>(), OA);
+        mU.insert(makeString(-1));
+
+        Obj mV(mX, SA);
+
+        bslstl::swap(mU, mV);
+        ASSERT(mU == mX);
+        ASSERT(1 == mV.size());
+        ASSERT((PROPAGATE_ON_CONTAINER_SWAP ? &sa : &oa)
+                                                == mU.allocator().allocator());
+        ASSERT((PROPAGATE_ON_CONTAINER_SWAP ? &oa : &sa)
+                                                == mV.allocator().allocator());
+    }
+
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If the allocation of the entries, or the construction of an
+        //:   entry, throws during 'insert' (including a rehash), 'operator[]',
+        //:   copy construction, or move construction with a different
+        //:   allocator, no memory is leaked and the table remains valid.
+        //
+        // Plan:
+        //: 1 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', perform each of
+        //:   the operations on a table of 'bsl::string' entries, and verify
+        //:   the table is valid and no memory is in use afterwards.  (C-1)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\t'insert' and 'operator[]'\n");
+        {
+            StringTable mX(0,
+                           bsl::hash<bsl::string>(),
+                           bsl::equal_to<bsl::string>(),
+                           &oa);
+
+            for (int i = 0; i < 40; ++i) {
+                const bsl::string S = makeString(i);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    if (i % 2) {
+                        mX.insert(S);
+                    }
+                    else {
+                        mX[S];
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, static_cast<std::size_t>(i + 1) == mX.size());
+                ASSERTV(i, verifyIteration(mX));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tcopy and move construction\n");
+        {
+            StringTable mX(0,
+                           bsl::hash<bsl::string>(),
+                           bsl::equal_to<bsl::string>(),
+                           &sa);
+
+            for (int i = 0; i < 20; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const StringTable Y(mX, &oa);
+                ASSERT(Y == mX);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringTable       mS(mX, &sa);
+                const StringTable Y(bslmf::MovableRefUtil::move(mS), &oa);
+                ASSERT(Y == mX);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        //: 1 Copy construction (through the
+        //:   'select_on_container_copy_construction' method of the allocator
+        //:   traits), copy assignment, move assignment, and swap propagate
+        //:   the allocator if and only if the corresponding trait of the
+        //:   allocator is 'true'.
+        //:
+        //: 2 When the allocator is not propagated, the value is nonetheless
+        //:   copied, moved, or swapped, and the memory of each table is
+        //:   supplied by its own allocator.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For each combination of the four propagation traits of
+        //:   'bsltf::StdStatefulAllocator', perform each operation with
+        //:   tables having different allocators, and verify the value and the
+        //:   allocator of the result, and that no memory is in use once the
+        //:   tables are destroyed.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   void swap(FlatHashTable& other);
+        //   void swap(FlatHashTable&, FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATOR PROPAGATION"
+                            "\n=====================\n");
+
+        testAllocatorPropagation<false, false, false, false>();
+        testAllocatorPropagation<false, false, false, true >();
+        testAllocatorPropagation<false, false, true,  false>();
+        testAllocatorPropagation<false, false, true,  true >();
+        testAllocatorPropagation<false, true,  false, false>();
+        testAllocatorPropagation<false, true,  false, true >();
+        testAllocatorPropagation<false, true,  true,  false>();
+        testAllocatorPropagation<false, true,  true,  true >();
+        testAllocatorPropagation<true,  false, false, false>();
+        testAllocatorPropagation<true,  false, false, true >();
+        testAllocatorPropagation<true,  false, true,  false>();
+        testAllocatorPropagation<true,  false, true,  true >();
+        testAllocatorPropagation<true,  true,  false, false>();
+        testAllocatorPropagation<true,  true,  false, true >();
+        testAllocatorPropagation<true,  true,  true,  false>();
+        testAllocatorPropagation<true,  true,  true,  true >();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY AND MOVE CONSTRUCTION
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, with its memory, and
+        //:   the memory of its entries, supplied by the specified allocator.
+        //:
+        //: 2 A copy of an empty table in the zero-capacity state allocates
+        //:   no memory.
+        //:
+        //: 3 Move construction without an allocator, or with an allocator
+        //:   equal to that of the original, allocates no memory and leaves
+        //:   the original in the zero-capacity state.
+        //:
+        //: 4 Move construction with a different allocator moves each entry
+        //:   into memory supplied by that allocator.
+        //
+        // Plan:
+        //: 1 Create tables of 'bsl::string' entries of varying sizes using
+        //:   one 'bslma::TestAllocator', then copy and move them using the
+        //:   same and a different allocator, and verify the value of the
+        //:   results and the use of each allocator.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, basicAllocator);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, basicAllocator);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY AND MOVE CONSTRUCTION"
+                            "\n==========================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int SIZES[]   = { 0, 1, 7, 14, 15, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            StringTable mX(0,
+                           bsl::hash<bsl::string>(),
+                           bsl::equal_to<bsl::string>(),
+                           &sa);
+            const StringTable& X = mX;
+
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const StringTable Y(X, &oa);
+
+                ASSERTV(SIZE, Y == X);
+                ASSERTV(SIZE, verifyIteration(Y));
+                ASSERTV(SIZE, X.capacity() == Y.capacity());
+                ASSERTV(SIZE, SIZE == 0 ? oam.isTotalSame()
+                                        : oam.isTotalUp());
+                ASSERTV(SIZE, SIZE == 0 || &oa ==
+                                Y.begin()->get_allocator().mechanism());
+            }
+
+            {
+                StringTable mS(X, &sa);
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                const StringTable Y(bslmf::MovableRefUtil::move(mS));
+
+                ASSERTV(SIZE, Y == X);
+                ASSERTV(SIZE, sam.isTotalSame());
+                ASSERTV(SIZE, 0 == mS.size());
+                ASSERTV(SIZE, 0 == mS.capacity());
+                ASSERTV(SIZE, &sa == Y.allocator().mechanism());
+            }
+
+            {
+                StringTable mS(X, &sa);
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                const StringTable Y(bslmf::MovableRefUtil::move(mS), &sa);
+
+                ASSERTV(SIZE, Y == X);
+                ASSERTV(SIZE, sam.isTotalSame());
+                ASSERTV(SIZE, 0 == mS.capacity());
+            }
+
+            {
+                StringTable mS(X, &sa);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const StringTable Y(bslmf::MovableRefUtil::move(mS), &oa);
+
+                ASSERTV(SIZE, Y == X);
+                ASSERTV(SIZE, SIZE == 0 ? oam.isTotalSame()
+                                        : oam.isTotalUp());
+                ASSERTV(SIZE, &oa == Y.allocator().mechanism());
+                ASSERTV(SIZE, SIZE == 0 || &oa ==
+                                Y.begin()->get_allocator().mechanism());
+            }
+
+            ASSERTV(SIZE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'insert' and 'operator[]' add an entry if and only if its key is
+        //:   absent, and the entry is subsequently found.
+        //:
+        //: 2 The capacity is 0 or a power of two that is at least
+        //:   'k_MIN_CAPACITY', and the load factor never exceeds
+        //:   'max_load_factor()'.
+        //:
+        //: 3 The entries and control values of a table are held in a single
+        //:   block of memory obtained from the table's allocator, and the
+        //:   entries are constructed using that allocator.
+        //:
+        //: 4 Every form of 'erase' removes the expected entries, and
+        //:   'erase(position)' returns an iterator to the next entry.
+        //:
+        //: 5 'rehash', 'reserve', 'clear', and 'reset' change the capacity as
+        //:   documented, and preserve the entries (where applicable).
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Insert a sequence of integer keys, verifying the size, capacity,
+        //:   load factor, and the number of blocks allocated after each
+        //:   insertion.  (C-1..3)
+        //:
+        //: 2 Insert 'bsl::string' entries using 'operator[]' and verify the
+        //:   allocator of the entries.  (C-3)
+        //:
+        //: 3 Erase entries by key, by position, and by range, and verify the
+        //:   remaining entries using 'find' and iteration.  (C-4)
+        //:
+        //: 4 Exercise 'rehash', 'reserve', 'clear', and 'reset', verifying the
+        //:   capacity and the entries.  (C-5)
+        //:
+        //: 5 Verify all memory is released.  (C-6)
+        //
+        // Testing:
+        //   FlatHashTable(capacity, hash, equal, basicAllocator);
+        //   ~FlatHashTable();
+        //   ENTRY& operator[](FORWARD_REF(KEY_TYPE) key);
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry);
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numEntries);
+        //   void reset();
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND ACCESSORS"
+                            "\n==========================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tInsertion, capacity, and load factor.\n");
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const IntTable& X = mX;
+
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == X.size());
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.find(0) == X.end());
+
+            ASSERT(0.875f == X.max_load_factor());
+
+            for (int i = 0; i < 2000; ++i) {
+                bsl::pair<IntTable::iterator, bool> rv = mX.insert(i);
+
+                ASSERTV(i, rv.second);
+                ASSERTV(i, i == *rv.first);
+
+                rv = mX.insert(i);
+
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, i == *rv.first);
+
+                const std::size_t CAPACITY = X.capacity();
+
+                ASSERTV(i, static_cast<std::size_t>(i + 1) == X.size());
+                ASSERTV(i, IntTable::k_MIN_CAPACITY <= CAPACITY);
+                ASSERTV(i, 0 == (CAPACITY & (CAPACITY - 1)));
+                ASSERTV(i, X.load_factor() <= X.max_load_factor());
+                ASSERTV(i, 1 == oa.numBlocksInUse());
+                ASSERTV(i, X.contains(i));
+                ASSERTV(i, !X.contains(i + 1));
+                ASSERTV(i, 1 == X.count(i));
+            }
+
+            ASSERT(verifyIteration(X));
+
+            // The control values follow the entries in the same block.
+
+            ASSERT(static_cast<const void *>(X.controls()) ==
+                   static_cast<const void *>(X.entries() + X.capacity()));
+
+            for (int i = 0; i < 2000; ++i) {
+                ASSERTV(i, i == *X.find(i));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'operator[]' and allocator of entries.\n");
+        {
+            StringTable mX(0,
+                           bsl::hash<bsl::string>(),
+                           bsl::equal_to<bsl::string>(),
+                           &oa);
+            const StringTable& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string S = makeString(i);
+
+                const bsl::string& R = mX[S];
+
+                ASSERTV(i, S == R);
+                ASSERTV(i, &oa == R.get_allocator().mechanism());
+                ASSERTV(i, &R == &mX[S]);
+            }
+
+            ASSERT(100 == X.size());
+            ASSERT(verifyIteration(X));
+            ASSERT(0 == da.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tErasure.\n");
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const IntTable& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+
+            // erase by key
+
+            for (int i = 0; i < 100; i += 3) {
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 0 == mX.erase(i));
+            }
+            ASSERT(66 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, (0 != i % 3) == X.contains(i));
+            }
+            ASSERT(verifyIteration(X));
+
+            // erase by position
+
+            std::size_t count = 0;
+            for (IntTable::iterator it = mX.begin(); it != mX.end(); ) {
+                if (*it % 2) {
+                    IntTable::iterator next = it;
+                    ++next;
+                    it = mX.erase(it);
+                    ASSERT(next == it);
+                }
+                else {
+                    ++it;
+                }
+                ++count;
+            }
+            ASSERT(66 == count);
+            ASSERT(33 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, (0 != i % 3 && 0 == i % 2) == X.contains(i));
+            }
+            ASSERT(verifyIteration(X));
+
+            // erase by range
+
+            IntTable::const_iterator first = X.begin();
+            ++first;
+            ++first;
+
+            IntTable::iterator rv = mX.erase(first, X.end());
+            ASSERT(X.end() == rv);
+            ASSERT(2 == X.size());
+            ASSERT(verifyIteration(X));
+
+            rv = mX.erase(X.begin(), X.end());
+            ASSERT(X.end() == rv);
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+
+            // Erased entries can be reinserted.
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            ASSERT(verifyIteration(X));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'rehash', 'reserve', 'clear', and 'reset'.\n");
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const IntTable& X = mX;
+
+            mX.reserve(0);
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(1);
+            ASSERT(IntTable::k_MIN_CAPACITY == X.capacity());
+
+            mX.reserve(1000);
+            ASSERT(1000 <= X.capacity() * 7 / 8);
+
+            const std::size_t CAPACITY = X.capacity();
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(CAPACITY == X.capacity());
+
+            mX.rehash(4 * CAPACITY);
+            ASSERT(4 * CAPACITY == X.capacity());
+            ASSERT(1000 == X.size());
+            ASSERT(verifyIteration(X));
+
+            mX.rehash(0);
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(1000 == X.size());
+            ASSERT(verifyIteration(X));
+
+            mX.clear();
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.insert(1);
+            ASSERT(IntTable::k_MIN_CAPACITY == X.capacity());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == X.size());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            const IntTable Y(100, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            ASSERT(128 == Y.capacity());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //
+        // Concerns:
+        //: 1 'match', 'available', and 'inUse' return a bit mask having the
+        //:   bit at index 'i' set if and only if the control byte at index 'i'
+        //:   satisfies the respective condition.
+        //:
+        //: 2 'neverFull' returns 'true' if and only if the group has an empty
+        //:   (not erased) control byte.
+        //:
+        //: 3 The control bytes have no alignment requirement.
+        //:
+        //: 4 'numTrailingUnsetBits' returns the index of the lowest set bit.
+        //
+        // Plan:
+        //: 1 For a variety of groups of control bytes, loaded from an
+        //:   unaligned address, compare the result of each method with a
+        //:   brute-force computation.  (C-1..3)
+        //:
+        //: 2 Verify 'numTrailingUnsetBits' for each single-bit mask, and for
+        //:   masks having additional higher-order bits set.  (C-4)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const unsigned char *data);
+        //   BitMask available() const;
+        //   BitMask inUse() const;
+        //   BitMask match(unsigned char value) const;
+        //   bool neverFull() const;
+        //   static int numTrailingUnsetBits(BitMask mask);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nGROUP CONTROL"
+                            "\n=============\n");
+
+        const unsigned char EMPTY  = GroupControl::k_EMPTY;
+        const unsigned char ERASED = GroupControl::k_ERASED;
+
+        unsigned char buffer[2 * k_SIZE + 1];
+
+        for (int seed = 0; seed < 1000; ++seed) {
+            unsigned char *data = buffer + 1 + seed % k_SIZE;
+
+            // Choose each control byte from a hashlet, 'EMPTY', or 'ERASED'.
+
+            unsigned int state = seed * 2654435761u + 1;
+            for (std::size_t i = 0; i < k_SIZE; ++i) {
+                state = state * 1103515245u + 12345u;
+
+                const unsigned int choice = (state >> 16) % 8;
+
+                data[i] = choice == 0 ? EMPTY
+                        : choice == 1 ? ERASED
+                        : static_cast<unsigned char>((state >> 8) & 0x7f);
+            }
+            if (seed % 5 == 0) {
+                for (std::size_t i = 0; i < k_SIZE; ++i) {
+                    if (EMPTY == data[i]) {
+                        data[i] = ERASED;
+                    }
+                }
+            }
+
+            const GroupControl X(data);
+
+            GroupControl::BitMask expAvailable = 0;
+            bool                  expNeverFull = false;
+            for (std::size_t i = 0; i < k_SIZE; ++i) {
+                if (data[i] & 0x80) {
+                    expAvailable |= 1u << i;
+                }
+                if (EMPTY == data[i]) {
+                    expNeverFull = true;
+                }
+            }
+
+            ASSERTV(seed, expAvailable == X.available());
+            ASSERTV(seed, (~expAvailable & ((1u << k_SIZE) - 1))
+                                                                == X.inUse());
+            ASSERTV(seed, expNeverFull == X.neverFull());
+
+            for (int value = 0; value < 0x80; ++value) {
+                GroupControl::BitMask expMatch = 0;
+                for (std::size_t i = 0; i < k_SIZE; ++i) {
+                    if (value == data[i]) {
+                        expMatch |= 1u << i;
+                    }
+                }
+                ASSERTV(seed, value,
+                    expMatch == X.match(static_cast<unsigned char>(value)));
+            }
+        }
+
+        for (int i = 0; i < 32; ++i) {
+            const GroupControl::BitMask MASK = 1u << i;
+
+            ASSERTV(i, i == GroupControl::numTrailingUnsetBits(MASK));
+            ASSERTV(i, i == GroupControl::numTrailingUnsetBits(
+                                          MASK | (MASK << 1) | 0x80000000u));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table, insert, find, erase, and iterate over entries.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const IntTable& X = mX;
+
+            ASSERT(0 == X.size());
+
+            ASSERT( mX.insert(1).second);
+            ASSERT( mX.insert(2).second);
+            ASSERT(!mX.insert(1).second);
+            ASSERT(2 == X.size());
+
+            ASSERT(X.find(1) != X.end());
+            ASSERT(X.find(3) == X.end());
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(0 == mX.erase(1));
+            ASSERT(1 == X.size());
+            ASSERT(2 == *X.begin());
+
+            IntTable mY(X, &oa);
+            ASSERT(X == mY);
+            mY.insert(5);
+            ASSERT(X != mY);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,29 @@
+// bslstl_flatunorderedmap.cpp                                        -*-C++-*-
+#include <bslstl_flatunorderedmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslstl_flatunorderedmap_cpp,"$Id$ $CSID$")
+
+#include <bslstl_string.h>              // for testing only
+
+namespace BloombergLP {
+namespace bslstl {
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1446 @@
+// bslstl_flatunorderedmap.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATUNORDEREDMAP
+#define INCLUDED_BSLSTL_FLATUNORDEREDMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed 'unordered_map' container.
+//
+//@CLASSES:
+//  bsl::flat_unordered_map: open-addressed 'unordered_map' container
+//
+//@CANONICAL_HEADER: bsl_flat_unordered_map.h
+//
+//@SEE_ALSO: bslstl_unorderedmap, bslstl_flathashtable, bdlc_flathashmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_unordered_map', implementing a container holding a collection of
+// unique keys, each mapped to an associated value with no guarantees on
+// ordering, that stores its elements in a single open-addressed array rather
+// than in separately allocated nodes.
+//
+// 'bsl::flat_unordered_map' provides an interface similar to that of
+// 'bsl::unordered_map' for looking up, inserting, and erasing elements, and
+// for iterating over them, with the same allocator model: the (template
+// parameter) type 'ALLOCATOR' supplies all memory, is used to construct the
+// elements, and is propagated on copy construction, copy assignment, move
+// assignment, and swap as indicated by 'bsl::allocator_traits<ALLOCATOR>'.
+// It is not, however, a complete replacement for an 'unordered_map': it lacks
+// some members of the standard interface, and gives weaker guarantees, as
+// described below.
+//
+// The elements are held in a 'bslstl::FlatHashTable', in which a lookup
+// inspects a group of one-byte "hashlets" (see 'bslstl_flathashtable') with a
+// single comparison, and compares the keys only of the matching elements.  As
+// a result, a 'flat_unordered_map' makes a single allocation for all of its
+// elements, touches fewer cache lines per lookup, and is typically
+// significantly faster than an 'unordered_map' for small keys and values.
+//
+///Differences from 'bsl::unordered_map'
+///-------------------------------------
+//: o Iterator, pointer, and reference stability: any change in capacity (a
+//:   rehash, 'reserve', or an insertion that exceeds the maximum load factor)
+//:   invalidates *all* iterators, pointers, and references to elements, and
+//:   the elements themselves are moved (or copied) to the new array.  In an
+//:   'unordered_map', only iterators are invalidated by a rehash.  Erasing an
+//:   element invalidates only the iterators, pointers, and references to the
+//:   erased element, as in an 'unordered_map'.
+//:
+//: o The 'value_type' must be move-insertable (or copy-insertable), since
+//:   elements are relocated when the capacity changes.
+//:
+//: o There is no bucket interface ('bucket', 'bucket_count', 'begin(n)',
+//:   etc.); 'capacity' reports the number of elements the map could hold at a
+//:   load factor of 1.  The maximum load factor is fixed (see
+//:   'max_load_factor').
+//:
+//: o There is no 'emplace' or 'emplace_hint'; elements are inserted with
+//:   'insert' or 'operator[]'.
+//
+///Requirements on 'KEY', 'VALUE', 'HASH', and 'EQUAL'
+///----------------------------------------------------
+// The 'value_type' of a 'flat_unordered_map' is 'bsl::pair<const KEY, VALUE>'.
+// 'KEY' and 'VALUE' must be copy-constructible (or move-constructible, for
+// the methods that do not copy elements), and 'VALUE' must be
+// default-constructible to use 'operator[]'.  'HASH' and 'EQUAL' must be
+// copy-constructible function objects, where 'HASH' returns a 'std::size_t'
+// for a 'KEY', and 'EQUAL' defines an equivalence relation on 'KEY' values
+// consistent with 'HASH'.  Note that the underlying table multiplies each
+// hash value by a large odd constant before use, so that hash functors whose
+// high-order bits are poorly distributed, such as the identity hash provided
+// by 'bsl::hash' for integral types, are suitable.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a small corpus.
+// Since we only need lookups and insertions, and never hold references to the
+// counts across insertions, a 'flat_unordered_map' is a good choice.
+//
+// First, we define the corpus:
+//..
+//  const char *const WORDS[] = { "the", "quick", "brown", "fox", "jumps",
+//                                "over", "the", "lazy", "dog", "the", "end" };
+//  const int NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//..
+// Then, we create a map from each word to its count, and count the words:
+//..
+//  bsl::flat_unordered_map<bsl::string, int> wordCounts;
+//
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      ++wordCounts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert( 9 == wordCounts.size());
+//  assert( 3 == wordCounts["the"]);
+//  assert( 1 == wordCounts["fox"]);
+//  assert(wordCounts.contains("dog"));
+//  assert(!wordCounts.contains("cat"));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_algorithm.h>
+#include <bslstl_equalto.h>
+#include <bslstl_flathashtable.h>
+#include <bslstl_hash.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <cstddef>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                      // ================================
+                      // struct FlatUnorderedMap_EntryUtil
+                      // ================================
+
+template <class KEY, class VALUE>
+struct FlatUnorderedMap_EntryUtil {
+    // This templated utility provides a method to construct a
+    // 'bsl::pair<const KEY, VALUE>' entry from a key, and a method to extract
+    // the key from such an entry, as required by 'FlatHashTable'.
+
+    // TYPES
+    typedef bsl::pair<const KEY, VALUE> EntryType;
+
+    // CLASS METHODS
+    template <class ALLOCATOR, class KEY_TYPE>
+    static void construct(
+                EntryType                                   *entry,
+                ALLOCATOR&                                   allocator,
+                BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the 'EntryType' value comprised of
+        // the specified 'key' and a default constructed 'VALUE', using the
+        // specified 'allocator' to construct the entry.
+
+    static const KEY& key(const EntryType& entry);
+        // Return the key of the specified 'entry'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // ========================
+                          // class flat_unordered_map
+                          // ========================
+
+template <class KEY,
+          class VALUE,
+          class HASH      = bsl::hash<KEY>,
+          class EQUAL     = bsl::equal_to<KEY>,
+          class ALLOCATOR = bsl::allocator<bsl::pair<const KEY, VALUE> > >
+class flat_unordered_map {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of 'KEY-VALUE' pairs having unique keys that provide a
+    // mapping from keys (of template parameter type 'KEY') to their associated
+    // mapped values (of template parameter type 'VALUE'), stored in an
+    // open-addressed array.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral* (agnostic except for the 'at' method)
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::FlatUnorderedMap_EntryUtil<KEY, VALUE>
+                                                                     EntryUtil;
+        // This 'typedef' is an alias for the utility used by the underlying
+        // table to construct entries and extract their keys.
+
+    typedef BloombergLP::bslstl::FlatHashTable<KEY,
+                                               pair<const KEY, VALUE>,
+                                               EntryUtil,
+                                               HASH,
+                                               EQUAL,
+                                               ALLOCATOR> ImplType;
+        // This 'typedef' is an alias for the underlying implementation class.
+
+    typedef BloombergLP::bslmf::MovableRefUtil MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated with
+        // movable references.
+
+    // FRIENDS
+    template <class KEY2,
+              class VALUE2,
+              class HASH2,
+              class EQUAL2,
+              class ALLOCATOR2>
+    friend bool operator==(
+           const flat_unordered_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&,
+           const flat_unordered_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+    template <class KEY2,
+              class VALUE2,
+              class HASH2,
+              class EQUAL2,
+              class ALLOCATOR2>
+    friend void swap(
+                 flat_unordered_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&,
+                 flat_unordered_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                value_type;
+    typedef HASH                                       hasher;
+    typedef EQUAL                                      key_equal;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename ImplType::iterator                iterator;
+    typedef typename ImplType::const_iterator          const_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying flat hash table used by this map
+
+  public:
+    // CREATORS
+    flat_unordered_map();
+    explicit
+    flat_unordered_map(size_type        initialCapacity,
+                       const HASH&      hashFunction   = HASH(),
+                       const EQUAL&     keyEqual       = EQUAL(),
+                       const ALLOCATOR& basicAllocator = ALLOCATOR());
+    flat_unordered_map(size_type        initialCapacity,
+                       const HASH&      hashFunction,
+                       const ALLOCATOR& basicAllocator);
+    flat_unordered_map(size_type        initialCapacity,
+                       const ALLOCATOR& basicAllocator);
+    explicit
+    flat_unordered_map(const ALLOCATOR& basicAllocator);
+        // Create an empty flat unordered map.  Optionally specify an
+        // 'initialCapacity' indicating the minimum number of elements the map
+        // can hold without allocating.  If 'initialCapacity' is not supplied
+        // or is 0, no memory is allocated.  Optionally specify a
+        // 'hashFunction' used to generate the hash values for the keys
+        // contained in this map.  If 'hashFunction' is not supplied, a
+        // default-constructed object of (template parameter) type 'HASH' is
+        // used.  Optionally specify a key-equality functor 'keyEqual' used to
+        // verify that two key values are the same.  If 'keyEqual' is not
+        // supplied, a default-constructed object of (template parameter) type
+        // 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // (the default), then 'basicAllocator', if supplied, shall be
+        // convertible to 'bslma::Allocator *'.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    flat_unordered_map(INPUT_ITERATOR   first,
+                       INPUT_ITERATOR   last,
+                       size_type        initialCapacity = 0,
+                       const HASH&      hashFunction    = HASH(),
+                       const EQUAL&     keyEqual        = EQUAL(),
+                       const ALLOCATOR& basicAllocator  = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_unordered_map(INPUT_ITERATOR   first,
+                       INPUT_ITERATOR   last,
+                       const ALLOCATOR& basicAllocator);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_unordered_map(std::initializer_list<value_type> values,
+                       size_type                         initialCapacity = 0,
+                       const HASH&                       hashFunction = HASH(),
+                       const EQUAL&                      keyEqual = EQUAL(),
+                       const ALLOCATOR& basicAllocator = ALLOCATOR());
+    flat_unordered_map(std::initializer_list<value_type> values,
+                       const ALLOCATOR&                  basicAllocator);
+#endif
+        // Create a flat unordered map, and insert each 'value_type' object in
+        // the sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element (or in the specified
+        // 'values' list), ignoring those objects having a key equivalent to
+        // that of an object already in this map.  Optionally specify an
+        // 'initialCapacity', 'hashFunction', 'keyEqual', and 'basicAllocator'
+        // having the meanings given for the constructors above.  The behavior
+        // is undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.
+
+    flat_unordered_map(const flat_unordered_map& original);
+        // Create a flat unordered map having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object.  Use a
+        // copy of 'original.get_allocator()' to allocate memory, if
+        // 'allocator_traits<ALLOCATOR>::select_on_container_copy_construction'
+        // returns it (as it does for 'bsl::allocator', which instead uses the
+        // default allocator, and for allocators that propagate on copy).
+
+    flat_unordered_map(const flat_unordered_map& original,
+                       const ALLOCATOR&          basicAllocator);
+        // Create a flat unordered map having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object, using
+        // the specified 'basicAllocator' to supply memory.
+
+    flat_unordered_map(
+                  BloombergLP::bslmf::MovableRef<flat_unordered_map> original);
+                                                                    // IMPLICIT
+        // Create a flat unordered map having the same value as the specified
+        // 'original' object by moving (in constant time) the contents of
+        // 'original' to the new map.  The allocator associated with 'original'
+        // is propagated for use in the newly-created map.  'original' is left
+        // in a valid but unspecified state.
+
+    flat_unordered_map(
+                   BloombergLP::bslmf::MovableRef<flat_unordered_map> original,
+                   const ALLOCATOR&                            basicAllocator);
+        // Create a flat unordered map having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object, using
+        // the specified 'basicAllocator' to supply memory.  The contents of
+        // 'original' are moved (in constant time) to the new map if
+        // 'basicAllocator == original.get_allocator()', and are move-inserted
+        // (in linear time) using 'basicAllocator' otherwise.  'original' is
+        // left in a valid but unspecified state.
+
+    ~flat_unordered_map();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    flat_unordered_map& operator=(const flat_unordered_map& rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_unordered_map& operator=(
+                       BloombergLP::bslmf::MovableRef<flat_unordered_map> rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_move_assignment', and return a reference
+        // providing modifiable access to this object.  The contents of 'rhs'
+        // are moved (in constant time) to this map if 'get_allocator() ==
+        // rhs.get_allocator()' (after accounting for the aforementioned
+        // trait); otherwise, all elements in this map are either destroyed or
+        // move-assigned to and each additional element in 'rhs' is
+        // move-inserted into this map.  'rhs' is left in a valid but
+        // unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_unordered_map& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those objects having a key
+        // equivalent to that of an object already in this map, and return a
+        // reference providing modifiable access to this object.
+#endif
+
+    VALUE& operator[](const key_type& key);
+    VALUE& operator[](BloombergLP::bslmf::MovableRef<key_type> key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert one having 'key'
+        // (copied or moved from the specified 'key') and a default-constructed
+        // mapped value, and return a reference to the newly-inserted mapped
+        // value.  Note that this operation may invalidate all iterators,
+        // pointers, and references to elements of this map.
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise, throw a 'std::out_of_range' exception.
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the sequence of objects maintained by this
+        // map, or the 'end' iterator if this map is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the past-the-end
+        // position in the sequence of 'value_type' objects maintained by this
+        // map.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this map.  Note that this map will be empty
+        // after calling this method, but allocated memory may be retained for
+        // future use.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' object having 'key',
+        // then the two returned iterators will have the same value.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this map contains no such object, then the
+        // two returned iterators will have the same value.  Note that this
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object having the specified
+        // 'key', if it exists, and return 1; otherwise (there is no object
+        // with a key equivalent to 'key' in this map) return 0 with no other
+        // effect.  This method invalidates only iterators, pointers, and
+        // references to the removed element.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  The
+        // behavior is undefined unless 'position' refers to a 'value_type'
+        // object in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this map or
+        // are the 'end' iterator, and the 'first' position is at or before the
+        // 'last' position in the iteration sequence provided by this map.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having the specified 'key', if such an entry
+        // exists, and the past-the-end ('end') iterator otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having a key equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.  No 'key_type' object is created.  Note that this
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // this method has no effect.  Return a 'pair' whose 'first' member is
+        // an iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is equivalent to that of the object to
+        // be inserted, and whose 'second' member is 'true' if a new value was
+        // inserted, and 'false' if the key was already present.
+
+    template <class ALT_VALUE_TYPE>
+    typename enable_if<is_convertible<ALT_VALUE_TYPE, value_type>::value,
+                       pair<iterator, bool> >::type
+    insert(BSLS_COMPILERFEATURES_FORWARD_REF(ALT_VALUE_TYPE) value)
+        // Insert into this map a 'value_type' object created from the
+        // specified 'value' if a key equivalent to that of such an object
+        // does not already exist in this map; otherwise, this method has no
+        // effect (other than possibly creating a temporary 'value_type'
+        // object).  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this map whose key is equivalent to that of the object to be
+        // inserted, and whose 'second' member is 'true' if a new value was
+        // inserted, and 'false' if the key was already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(ALT_VALUE_TYPE,
+                                                           value));
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this map the value of each 'value_type' object in the
+        // specified 'values' initializer list whose key is not already
+        // contained in this map.
+#endif
+
+    void rehash(size_type minimumCapacity);
+        // Change the capacity of this map to at least the specified
+        // 'minimumCapacity', and redistribute all the contained elements into
+        // a new array of elements, according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the map is returned to the
+        // default-constructed state, releasing all memory.  Note that this
+        // operation invalidates all iterators, pointers, and references to
+        // elements of this map.
+
+    void reserve(size_type numElements);
+        // Increase the capacity of this map, if necessary, so that it can
+        // hold at least the specified 'numElements' without exceeding the
+        // maximum load factor.  Note that this operation invalidates all
+        // iterators, pointers, and references to elements of this map if the
+        // capacity changes.
+
+    void swap(flat_unordered_map& other);
+        // Exchange the value, hasher, and key-equality functor of this object
+        // with those of the specified 'other' object; also exchange the
+        // allocator of this object with that of 'other' if the (template
+        // parameter) type 'ALLOCATOR' has the
+        // 'propagate_on_container_swap' trait, and do not modify either
+        // allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee.  This operation has 'O[1]' complexity.
+        // The behavior is undefined unless either this object was created
+        // with the same allocator as 'other' or 'ALLOCATOR' has the
+        // 'propagate_on_container_swap' trait.
+
+    // ACCESSORS
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the mapped
+        // value associated with the specified 'key', if such an entry exists;
+        // otherwise, throw a 'std::out_of_range' exception.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the sequence of objects maintained by this
+        // map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end position in the sequence of 'value_type' objects
+        // maintained by this map.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this map could hold if the load
+        // factor were 1.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this map contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.  Note that
+        // this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        return d_impl.contains(key);
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this map having the
+        // specified 'key'.  Note that since a flat unordered map maintains
+        // unique keys, the returned value will be either 0 or 1.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this map having a
+        // key equivalent to the specified 'key'.  Note that this overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return d_impl.count(key);
+    }
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' object having 'key',
+        // then the two returned iterators will have the same value.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this map contains no such object, then the
+        // two returned iterators will have the same value.  Note that this
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent.  Also note: implemented inline due to Sun
+        // CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having the specified 'key', if such
+        // an entry exists, and the past-the-end ('end') iterator otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having a key equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.  No 'key_type' object is created.  Note
+        // that this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.  Also note: implemented inline
+        // due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    ALLOCATOR get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash unary functor used by this map to
+        // generate a hash value (of type 'std::size_t') for a 'key_type'
+        // object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality binary functor that returns
+        // 'true' if the value of two 'key_type' objects are equivalent, and
+        // 'false' otherwise.
+
+    float load_factor() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the current ratio between the 'size' of this map and its
+        // 'capacity'.
+
+    float max_load_factor() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the maximum load factor allowed for this map.  Note that if
+        // an insert operation would cause the load factor to exceed the
+        // 'max_load_factor', that same insert operation will increase the
+        // capacity and rehash the entries of the container.  Note that the
+        // maximum load factor of a flat unordered map is fixed.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this map.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bool operator==(
+            const flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+            const flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_unordered_map' objects have the
+    // same value if they have the same number of key-value pairs, and each
+    // key-value pair that is contained in one of the objects is also contained
+    // in the other object.  This method requires that the (template parameter)
+    // types 'KEY' and 'VALUE' both be 'equality-comparable'.
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bool operator!=(
+            const flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+            const flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_unordered_map' objects do
+    // not have the same value if they do not have the same number of key-value
+    // pairs, or some key-value pair that is contained in one of the objects is
+    // not also contained in the other object.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // 'equality-comparable'.
+#endif
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR,
+          class PREDICATE>
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+erase_if(flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& m,
+         PREDICATE                                               predicate);
+    // Erase all the elements in the specified flat unordered map 'm' that
+    // satisfy the specified predicate 'predicate'.  Return the number of
+    // elements erased.
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+void swap(flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& a,
+          flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& b);
+    // Exchange the value, hasher, key-equality functor, and allocator of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the
+    // same allocator or the 'ALLOCATOR' type has the
+    // 'propagate_on_container_swap' trait, and the basic guarantee otherwise;
+    // in the latter case, each object keeps its allocator and receives a copy
+    // of the value of the other.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                      // --------------------------------
+                      // struct FlatUnorderedMap_EntryUtil
+                      // --------------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+template <class ALLOCATOR, class KEY_TYPE>
+inline
+void FlatUnorderedMap_EntryUtil<KEY, VALUE>::construct(
+                EntryType                                   *entry,
+                ALLOCATOR&                                   allocator,
+                BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+
+    bsls::ObjectBuffer<VALUE> defaultMapped;
+    AllocatorTraits::construct(allocator, defaultMapped.address());
+    bslma::DestructorGuard<VALUE> mappedGuard(defaultMapped.address());
+
+    AllocatorTraits::construct(
+                       allocator,
+                       entry,
+                       BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                       bslmf::MovableRefUtil::move(defaultMapped.object()));
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY&
+FlatUnorderedMap_EntryUtil<KEY, VALUE>::key(const EntryType& entry)
+{
+    return entry.first;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // ------------------------
+                          // class flat_unordered_map
+                          // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map()
+: d_impl(0, HASH(), EQUAL(), ALLOCATOR())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                            size_type        initialCapacity,
+                                            const HASH&      hashFunction,
+                                            const EQUAL&     keyEqual,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, hashFunction, keyEqual, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                            size_type        initialCapacity,
+                                            const HASH&      hashFunction,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, hashFunction, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                            size_type        initialCapacity,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                               const ALLOCATOR& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                            INPUT_ITERATOR   first,
+                                            INPUT_ITERATOR   last,
+                                            size_type        initialCapacity,
+                                            const HASH&      hashFunction,
+                                            const EQUAL&     keyEqual,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, hashFunction, keyEqual, basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                            INPUT_ITERATOR   first,
+                                            INPUT_ITERATOR   last,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                             std::initializer_list<value_type> values,
+                             size_type                         initialCapacity,
+                             const HASH&                       hashFunction,
+                             const EQUAL&                      keyEqual,
+                             const ALLOCATOR&                  basicAllocator)
+: d_impl(initialCapacity, hashFunction, keyEqual, basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                              std::initializer_list<value_type> values,
+                              const ALLOCATOR&                  basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                            const flat_unordered_map& original)
+: d_impl(original.d_impl,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                                     const flat_unordered_map& original,
+                                     const ALLOCATOR&          basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                   BloombergLP::bslmf::MovableRef<flat_unordered_map> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_unordered_map(
+                   BloombergLP::bslmf::MovableRef<flat_unordered_map> original,
+                   const ALLOCATOR&                            basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::~flat_unordered_map()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>&
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator=(
+                                                 const flat_unordered_map& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>&
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator=(
+                        BloombergLP::bslmf::MovableRef<flat_unordered_map> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>&
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+VALUE& flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator[](
+                                                           const key_type& key)
+{
+    return d_impl[key].second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+VALUE& flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator[](
+                              BloombergLP::bslmf::MovableRef<key_type> key)
+{
+    return d_impl[MoveUtil::move(MoveUtil::access(key))].second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+VALUE&
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::at(const key_type& key)
+{
+    iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                      "flat_unordered_map<...>::at(key_type): "
+                                      "invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::begin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::end()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+     typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator>
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                           const key_type& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(
+                                                           const key_type& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(
+                                                             iterator position)
+{
+    // Note that this overload is necessary to avoid ambiguity when the key is
+    // a map iterator.
+
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                           const key_type& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+     bool>
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::rehash(
+                                                     size_type minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::swap(
+                                                     flat_unordered_map& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+const VALUE& flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::at(
+                                                     const key_type& key) const
+{
+    const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                      "flat_unordered_map<...>::at(key_type): "
+                                      "invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_unordered_map<KEY,
+                                 VALUE,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::const_iterator,
+     typename flat_unordered_map<KEY,
+                                 VALUE,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::const_iterator>
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+ALLOCATOR
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return ALLOCATOR(d_impl.allocator());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+HASH
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+EQUAL flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::load_factor() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.max_size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.size();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator==(
+        const bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+        const bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+        const bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+        const bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+#endif
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class HASH,
+          class EQUAL,
+          class ALLOCATOR,
+          class PREDICATE>
+inline
+typename bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+bsl::erase_if(
+             flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& m,
+             PREDICATE                                               predicate)
+{
+    return BloombergLP::bslstl::AlgorithmUtil::containerEraseIf(m, predicate);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+bsl::swap(bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& a,
+          bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& b)
+{
+    BloombergLP::bslstl::swap(a.d_impl, b.d_impl);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat unordered associative containers:
+//: o A flat unordered associative container defines STL iterators.
+//: o A flat unordered associative container uses 'bslma' allocators if the
+//:   (template parameter) type 'ALLOCATOR' is convertible from
+//:   'bslma::Allocator *'.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+struct HasStlIterators<
+                bsl::flat_unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_unordered_map<KEY,
+                                                  VALUE,
+                                                  HASH,
+                                                  EQUAL,
+                                                  ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1120 @@
+// bslstl_flatunorderedmap.t.cpp                                      -*-C++-*-
+#include <bslstl_flatunorderedmap.h>
+
+#include <bslstl_hash.h>
+#include <bslstl_string.h>
+#include <bslstl_stringview.h>
+#include <bslstl_unorderedmap.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_stdstatefulallocator.h>
+
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines 'bsl::flat_unordered_map', a thin wrapper
+// around 'bslstl::FlatHashTable' (tested in 'bslstl_flathashtable') that
+// provides the interface of 'bsl::unordered_map'.  We therefore test that each
+// method forwards to the table correctly, that the elements and the mapped
+// values are constructed using the container's allocator, that the allocator
+// is propagated as indicated by 'bsl::allocator_traits', and that the methods
+// specific to the map ('operator[]' and 'at') behave as they do for
+// 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_unordered_map();
+// [ 2] flat_unordered_map(size_type, const HASH&, const EQUAL&, alloc);
+// [ 2] flat_unordered_map(const ALLOCATOR& basicAllocator);
+// [ 2] flat_unordered_map(INPUT_ITERATOR, INPUT_ITERATOR, ..., alloc);
+// [ 2] flat_unordered_map(initializer_list<value_type>, ..., alloc);
+// [ 2] flat_unordered_map(const flat_unordered_map& original);
+// [ 2] flat_unordered_map(const flat_unordered_map&, const ALLOCATOR&);
+// [ 2] flat_unordered_map(MovableRef<flat_unordered_map> original);
+// [ 2] flat_unordered_map(MovableRef<flat_unordered_map>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 4] flat_unordered_map& operator=(const flat_unordered_map& rhs);
+// [ 4] flat_unordered_map& operator=(MovableRef<flat_unordered_map> rhs);
+// [ 4] flat_unordered_map& operator=(initializer_list<value_type>);
+// [ 3] VALUE& operator[](const key_type& key);
+// [ 3] VALUE& operator[](MovableRef<key_type> key);
+// [ 3] VALUE& at(const key_type& key);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<iterator, bool> insert(const value_type& value);
+// [ 3] pair<iterator, bool> insert(ALT_VALUE_TYPE&& value);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void insert(initializer_list<value_type> values);
+// [ 4] void swap(flat_unordered_map& other);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const key_type& key) const;
+// [ 3] bool contains(const key_type& key) const;
+// [ 3] size_type count(const key_type& key) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 3] const_iterator find(const key_type& key) const;
+// [ 6] bool contains(const LOOKUP_KEY& key) const;
+// [ 6] size_type count(const LOOKUP_KEY& key) const;
+// [ 6] pair<citer, citer> equal_range(const LOOKUP_KEY& key) const;
+// [ 6] const_iterator find(const LOOKUP_KEY& key) const;
+// [ 2] ALLOCATOR get_allocator() const;
+//
+// FREE FUNCTIONS
+// [ 2] bool operator==(const flat_unordered_map&, const flat_unordered_map&);
+// [ 2] bool operator!=(const flat_unordered_map&, const flat_unordered_map&);
+// [ 5] size_type erase_if(flat_unordered_map& m, PREDICATE predicate);
+// [ 4] void swap(flat_unordered_map& a, flat_unordered_map& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'unordered_map' VS. 'flat_unordered_map'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64 Int64;
+
+typedef bsl::flat_unordered_map<bsl::string, bsl::string> Obj;
+typedef Obj::value_type                                   ValueType;
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique for the specified 'value'.
+{
+    char buffer[64];
+    sprintf(buffer, "a string that does not fit in the SSO buffer %d", value);
+    return bsl::string(buffer);
+}
+
+bool usesAllocator(const Obj& map, bslma::Allocator *allocator)
+    // Return 'true' if the specified 'map', and each key and mapped value in
+    // 'map', uses the specified 'allocator', and 'false' otherwise.
+{
+    if (map.get_allocator().mechanism() != allocator) {
+        return false;                                                 // RETURN
+    }
+    for (Obj::const_iterator it = map.begin(); it != map.end(); ++it) {
+        if (it->first.get_allocator().mechanism()  != allocator ||
+            it->second.get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                        // ==============================
+                        // struct TransparentStringHasher
+                        // ==============================
+
+struct TransparentStringHasher {
+    // This 'struct' hashes any type convertible to 'bsl::string_view' as
+    // 'bsl::hash<bsl::string>' hashes the equivalent string.  It has a nested
+    // type 'is_transparent', so lookups using it create no 'bsl::string'.
+
+    typedef void is_transparent;
+
+    size_t operator()(const bsl::string_view& value) const
+        // Return the hash of the specified 'value'.
+    {
+        return bsl::hash<bsl::string_view>()(value);
+    }
+};
+
+                        // =============================
+                        // struct TransparentStringEqual
+                        // =============================
+
+struct TransparentStringEqual {
+    // This 'struct' compares any types convertible to 'bsl::string_view' for
+    // equality.  It has a nested type 'is_transparent'.
+
+    typedef void is_transparent;
+
+    bool operator()(const bsl::string_view& lhs,
+                    const bsl::string_view& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+};
+
+bool isOdd(const ValueType& value)
+    // Return 'true' if the last character of the key of the specified 'value'
+    // is an odd digit, and 'false' otherwise.
+{
+    return (value.first[value.first.size() - 1] - '0') % 2;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a small corpus.
+// Since we only need lookups and insertions, and never hold references to the
+// counts across insertions, a 'flat_unordered_map' is a good choice.
+//
+// First, we define the corpus:
+//..
+    const char *const WORDS[] = { "the", "quick", "brown", "fox", "jumps",
+                                  "over", "the", "lazy", "dog", "the", "end" };
+    const int NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//..
+// Then, we create a map from each word to its count, and count the words:
+//..
+    bsl::flat_unordered_map<bsl::string, int> wordCounts;
+
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++wordCounts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT( 9 == wordCounts.size());
+    ASSERT( 3 == wordCounts["the"]);
+    ASSERT( 1 == wordCounts["fox"]);
+    ASSERT(wordCounts.contains("dog"));
+    ASSERT(!wordCounts.contains("cat"));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If 'HASH' and 'EQUAL' are transparent, 'find', 'contains',
+        //:   'count', and 'equal_range' accept a key of another type, and
+        //:   find the element having an equivalent key.
+        //:
+        //: 2 Such lookups allocate no memory, whether or not the key is found.
+        //:
+        //: 3 The non-transparent overloads are used when the argument is a
+        //:   'key_type'.
+        //
+        // Plan:
+        //: 1 Populate a map having a transparent hasher and comparator, then
+        //:   look up each key, and a key not in the map, using
+        //:   'bsl::string_view', string literals, and 'bsl::string'.  Verify
+        //:   the results, and, using test allocators installed as the object
+        //:   and default allocators, that no memory is allocated.  (C-1..3)
+        //
+        // Testing:
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   pair<citer, citer> equal_range(const LOOKUP_KEY& key) const;
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTRANSPARENT LOOKUP"
+                            "\n==================\n");
+
+        typedef bsl::flat_unordered_map<bsl::string,
+                                        int,
+                                        TransparentStringHasher,
+                                        TransparentStringEqual> TObj;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_KEYS = 100;
+
+        bsl::vector<bsl::string> keys(&oa);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys.push_back(makeString(i));
+        }
+
+        TObj mX(&oa);  const TObj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(TObj::value_type(keys[i], i));
+        }
+
+        const char *const MISSING =
+                              "a string that is not a key in the map at all";
+
+        bslma::TestAllocatorMonitor dam(&da);
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const bsl::string_view KEY(keys[i]);
+
+            TObj::iterator mIt = mX.find(KEY);
+            ASSERTV(i, mX.end() != mIt);
+            ASSERTV(i, i        == mIt->second);
+
+            TObj::const_iterator it = X.find(KEY);
+            ASSERTV(i, mIt      == it);
+            ASSERTV(i, X.contains(KEY));
+            ASSERTV(i, 1        == X.count(KEY));
+            ASSERTV(i, it       == X.find(keys[i].c_str()));
+            ASSERTV(i, it       == X.find(keys[i]));
+
+            bsl::pair<TObj::const_iterator, TObj::const_iterator> R =
+                                                            X.equal_range(KEY);
+            ASSERTV(i, it == R.first);
+            ASSERTV(i, 1  == bsl::distance(R.first, R.second));
+
+            bsl::pair<TObj::iterator, TObj::iterator> mR =
+                                                           mX.equal_range(KEY);
+            ASSERTV(i, mIt == mR.first);
+        }
+
+        ASSERT(X.end() == X.find(MISSING));
+        ASSERT(X.end() == X.find(bsl::string_view(MISSING)));
+        ASSERT(!X.contains(MISSING));
+        ASSERT(0       == X.count(MISSING));
+        ASSERT(X.equal_range(MISSING).first == X.equal_range(MISSING).second);
+        ASSERT(mX.end() == mX.find(MISSING));
+
+        ASSERT(dam.isTotalSame());
+        ASSERT(oam.isTotalSame());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE
+        //
+        // Concerns:
+        //: 1 'erase(key)' removes the element having 'key', if any, and
+        //:   returns the number of elements removed.
+        //:
+        //: 2 'erase(position)' removes the element at 'position' and returns
+        //:   an iterator to the next element, so that elements can be erased
+        //:   while iterating over the map.
+        //:
+        //: 3 'erase(first, last)' removes the elements in the range.
+        //:
+        //: 4 'erase_if' removes exactly the elements satisfying the predicate
+        //:   and returns their number.
+        //:
+        //: 5 Erasing elements does not allocate or release memory.
+        //
+        // Plan:
+        //: 1 Erase elements using each method from maps of 100 elements, and
+        //:   verify the remaining elements and the allocated memory.  (C-1..5)
+        //
+        // Testing:
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   size_type erase_if(flat_unordered_map& m, PREDICATE predicate);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE"
+                            "\n=====\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 100; ++i) {
+                mX[makeString(i)] = makeString(-i);
+            }
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < 100; i += 2) {
+                ASSERTV(i, 1 == mX.erase(makeString(i)));
+                ASSERTV(i, 0 == mX.erase(makeString(i)));
+            }
+            ASSERT(50 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, (i % 2 == 1) == X.contains(makeString(i)));
+            }
+
+            int count = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ) {
+                if (count++ % 2) {
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(50 == count);
+            ASSERT(25 == X.size());
+
+            Obj::const_iterator first = X.begin();
+            ++first;
+            ASSERT(X.end() == mX.erase(first, X.end()));
+            ASSERT(1 == X.size());
+
+            ASSERT(oam.isInUseDown());
+            ASSERT(oam.isTotalSame());
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 100; ++i) {
+                mX[makeString(i)] = makeString(-i);
+            }
+
+            ASSERT(50 == bsl::erase_if(mX, isOdd));
+            ASSERT(50 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, (i % 2 == 0) == X.contains(makeString(i)));
+            }
+
+            ASSERT(0 == bsl::erase_if(mX, isOdd));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT AND SWAP
+        //
+        // Concerns:
+        //: 1 Copy assignment, move assignment, and assignment from an
+        //:   initializer list give the target the value of the source.
+        //:
+        //: 2 The allocator of the target is propagated as indicated by the
+        //:   allocator traits.  A 'bsl::allocator' is never propagated, and
+        //:   a move assignment between maps having equal allocators does not
+        //:   allocate.
+        //:
+        //: 3 'swap' exchanges the values (and, if the allocator propagates on
+        //:   swap, the allocators) of the two maps.
+        //
+        // Plan:
+        //: 1 Assign and swap maps using 'bsl::allocator' with the same and
+        //:   different 'bslma::TestAllocator' objects, and verify the values
+        //:   and the allocators used.  (C-1..3)
+        //:
+        //: 2 Repeat assignment and swap using a 'bsltf::StdStatefulAllocator'
+        //:   that propagates on each operation.  (C-2..3)
+        //
+        // Testing:
+        //   flat_unordered_map& operator=(const flat_unordered_map& rhs);
+        //   flat_unordered_map& operator=(MovableRef<flat_unordered_map> rhs);
+        //   flat_unordered_map& operator=(initializer_list<value_type>);
+        //   void swap(flat_unordered_map& other);
+        //   void swap(flat_unordered_map& a, flat_unordered_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT AND SWAP"
+                            "\n===================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tUsing 'bsl::allocator'.\n");
+        {
+            Obj mW(&sa);  const Obj& W = mW;
+            for (int i = 0; i < 20; ++i) {
+                mW[makeString(i)] = makeString(-i);
+            }
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX[makeString(-1)];
+
+            mX = W;
+            ASSERT(W == X);
+            ASSERT(usesAllocator(X, &oa));
+
+            Obj mY(W, &oa);  const Obj& Y = mY;
+            mX[makeString(-1)];
+
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX = bslmf::MovableRefUtil::move(mY);
+                ASSERT(W == X);
+                ASSERT(0 == Y.size());
+                ASSERT(oam.isTotalSame());
+            }
+
+            Obj mZ(W, &sa);
+            mX[makeString(-1)];
+
+            mX = bslmf::MovableRefUtil::move(mZ);
+            ASSERT(W == X);
+            ASSERT(usesAllocator(X, &oa));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { ValueType("a", "1"), ValueType("b", "2") };
+            ASSERT(2 == X.size());
+            ASSERT("2" == X.at("b"));
+#endif
+
+            mX = W;
+            mX[makeString(-1)];
+
+            Obj mV(W, &oa);  const Obj& V = mV;
+
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.swap(mV);
+                ASSERT(W == X);
+                ASSERT(W.size() + 1 == V.size());
+                ASSERT(oam.isTotalSame());
+
+                swap(mX, mV);
+                ASSERT(W == V);
+                ASSERT(W.size() + 1 == X.size());
+                ASSERT(oam.isTotalSame());
+            }
+
+            bsl::swap(mX, mW);
+            ASSERT(usesAllocator(X, &oa));
+            ASSERT(usesAllocator(W, &sa));
+            ASSERT(V != W);
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tUsing a propagating allocator.\n");
+        {
+            typedef bsltf::StdStatefulAllocator<bsl::pair<const int, int>,
+                                                true,
+                                                true,
+                                                true,
+                                                true> StatefulAllocator;
+
+            typedef bsl::flat_unordered_map<int,
+                                            int,
+                                            bsl::hash<int>,
+                                            bsl::equal_to<int>,
+                                            StatefulAllocator> PObj;
+
+            const StatefulAllocator OA(&oa);
+            const StatefulAllocator SA(&sa);
+
+            PObj mW(SA);  const PObj& W = mW;
+            for (int i = 0; i < 20; ++i) {
+                mW[i] = -i;
+            }
+
+            PObj mX(OA);  const PObj& X = mX;
+            mX[-1];
+
+            mX = W;
+            ASSERT(W == X);
+            ASSERT(&sa == X.get_allocator().allocator());
+
+            PObj mY(W, OA);
+            mY = bslmf::MovableRefUtil::move(mX);
+            ASSERT(W == mY);
+            ASSERT(&sa == mY.get_allocator().allocator());
+
+            PObj mZ(OA);
+            mZ[-1];
+            swap(mZ, mY);
+            ASSERT(W == mZ);
+            ASSERT(&sa == mZ.get_allocator().allocator());
+            ASSERT(&oa == mY.get_allocator().allocator());
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS, INSERTION, AND LOOKUP
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed mapped value, using
+        //:   the map's allocator, if and only if the key is absent, and
+        //:   returns a reference to the mapped value.
+        //:
+        //: 2 'operator[]' given a movable key moves it into the map.
+        //:
+        //: 3 'at' returns the mapped value, or throws 'std::out_of_range' if
+        //:   the key is absent (without modifying the map).
+        //:
+        //: 4 Each 'insert' inserts elements whose keys are absent and reports
+        //:   whether an insertion occurred.
+        //:
+        //: 5 'find', 'contains', 'count', and 'equal_range' agree.
+        //
+        // Plan:
+        //: 1 Populate maps using each of 'operator[]' and 'insert', verify
+        //:   the return values, the lookups, and the allocators of the
+        //:   elements.  (C-1..2, 4..5)
+        //:
+        //: 2 Call 'at' with present and absent keys.  (C-3)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type& key);
+        //   VALUE& operator[](MovableRef<key_type> key);
+        //   VALUE& at(const key_type& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   pair<iterator, bool> insert(ALT_VALUE_TYPE&& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insert(initializer_list<value_type> values);
+        //   const VALUE& at(const key_type& key) const;
+        //   bool contains(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nELEMENT ACCESS, INSERTION, AND LOOKUP"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\t'operator[]' and 'at'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string K = makeString(i);
+
+                bsl::string& value = mX[K];
+                ASSERTV(i, value.empty());
+                ASSERTV(i, &oa == value.get_allocator().mechanism());
+
+                value = makeString(-i);
+
+                ASSERTV(i, makeString(-i) == mX[K]);
+                ASSERTV(i, makeString(-i) == mX.at(K));
+                ASSERTV(i, makeString(-i) ==  X.at(K));
+                ASSERTV(i, static_cast<std::size_t>(i + 1) == X.size());
+            }
+            ASSERT(usesAllocator(X, &oa));
+
+            bsl::string key(makeString(1000), &oa);
+            mX[bslmf::MovableRefUtil::move(key)] = "moved";
+            ASSERT("moved" == X.at(makeString(1000)));
+            ASSERT(101 == X.size());
+
+            bool caught = false;
+            try {
+                X.at(makeString(-1));
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.at(makeString(-1));
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(101 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'insert' and lookup.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                const ValueType V(makeString(i), makeString(-i));
+
+                bsl::pair<Obj::iterator, bool> rv = mX.insert(V);
+                ASSERTV(i, rv.second);
+                ASSERTV(i, V == *rv.first);
+
+                rv = mX.insert(ValueType(makeString(i), "other"));
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, V == *rv.first);
+            }
+
+            bsl::vector<ValueType> values;
+            for (int i = 25; i < 75; ++i) {
+                values.push_back(ValueType(makeString(i), makeString(-i)));
+            }
+            mX.insert(values.begin(), values.end());
+            ASSERT(75 == X.size());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ ValueType("a", "1"), ValueType(makeString(0), "2") });
+            ASSERT(76 == X.size());
+            ASSERT(makeString(0) == X.at(makeString(0)));
+#endif
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string K = makeString(i);
+
+                Obj::const_iterator it = X.find(K);
+
+                const bool PRESENT = i < 75;
+
+                ASSERTV(i, PRESENT == (X.end() != it));
+                ASSERTV(i, PRESENT == X.contains(K));
+                ASSERTV(i, static_cast<std::size_t>(PRESENT) == X.count(K));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> range =
+                                                             X.equal_range(K);
+                ASSERTV(i, it == range.first);
+                if (PRESENT) {
+                    ASSERTV(i, makeString(-i) == it->second);
+                    ASSERTV(i, ++it == range.second);
+                }
+                else {
+                    ASSERTV(i, X.end() == range.second);
+                }
+            }
+            ASSERT(usesAllocator(X, &oa));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the expected value and
+        //:   allocator, using the default allocator if none is supplied.
+        //:
+        //: 2 A default-constructed map allocates no memory.
+        //:
+        //: 3 The copy constructor uses the allocator returned by
+        //:   'select_on_container_copy_construction', which for
+        //:   'bsl::allocator' is the default allocator.
+        //:
+        //: 4 The move constructor without an allocator, or with an equal
+        //:   allocator, takes ownership of the elements without allocating.
+        //:
+        //: 5 'operator==' and 'operator!=' compare the elements irrespective
+        //:   of their order.
+        //
+        // Plan:
+        //: 1 Construct maps using each constructor, and verify their value,
+        //:   their allocator, and the allocators of their elements.
+        //:   (C-1..4)
+        //:
+        //: 2 Compare maps holding the same elements inserted in different
+        //:   orders, and maps differing in one element.  (C-5)
+        //
+        // Testing:
+        //   flat_unordered_map();
+        //   flat_unordered_map(size_type, const HASH&, const EQUAL&, alloc);
+        //   flat_unordered_map(const ALLOCATOR& basicAllocator);
+        //   flat_unordered_map(INPUT_ITERATOR, INPUT_ITERATOR, ..., alloc);
+        //   flat_unordered_map(initializer_list<value_type>, ..., alloc);
+        //   flat_unordered_map(const flat_unordered_map& original);
+        //   flat_unordered_map(const flat_unordered_map&, const ALLOCATOR&);
+        //   flat_unordered_map(MovableRef<flat_unordered_map> original);
+        //   flat_unordered_map(MovableRef<flat_unordered_map>, const ALLOC&);
+        //   ALLOCATOR get_allocator() const;
+        //   bool operator==(const flat_unordered_map&, const flat_uo_map&);
+        //   bool operator!=(const flat_unordered_map&, const flat_uo_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::TestAllocator va("values",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::vector<ValueType> values(&va);
+        for (int i = 0; i < 30; ++i) {
+            values.push_back(ValueType(makeString(i), makeString(-i)));
+        }
+
+        {
+            bslma::TestAllocatorMonitor dam(&da);
+
+            const Obj W;
+            ASSERT(0 == W.size());
+            ASSERT(0 == W.capacity());
+            ASSERT(&da == W.get_allocator().mechanism());
+
+            const Obj X(&oa);
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(dam.isTotalSame());
+
+            const Obj Y(100, bsl::hash<bsl::string>(),
+                        bsl::equal_to<bsl::string>(), &oa);
+            ASSERT(0 == Y.size());
+            ASSERT(100 <= Y.capacity() * Y.max_load_factor());
+            ASSERT(dam.isTotalSame());
+        }
+
+        {
+            const Obj X(values.begin(), values.end(), 0,
+                        bsl::hash<bsl::string>(),
+                        bsl::equal_to<bsl::string>(), &oa);
+            ASSERT(30 == X.size());
+            ASSERT(usesAllocator(X, &oa));
+
+            for (int i = 0; i < 30; ++i) {
+                ASSERTV(i, makeString(-i) == X.at(makeString(i)));
+            }
+
+            bslma::TestAllocatorMonitor dam(&da);
+
+            const Obj Y(X);
+            ASSERT(X == Y);
+            ASSERT(usesAllocator(Y, &da));
+            ASSERT(dam.isTotalUp());
+
+            const Obj Z(X, &oa);
+            ASSERT(X == Z);
+            ASSERT(usesAllocator(Z, &oa));
+
+            Obj mS(X, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj M(bslmf::MovableRefUtil::move(mS));
+            ASSERT(X == M);
+            ASSERT(usesAllocator(M, &oa));
+            ASSERT(0 == mS.size());
+            ASSERT(oam.isTotalSame());
+
+            Obj mT(X, &oa);
+            oam.reset(&oa);
+
+            const Obj N(bslmf::MovableRefUtil::move(mT), &oa);
+            ASSERT(X == N);
+            ASSERT(oam.isTotalSame());
+
+            Obj mU(X, &oa);
+            const Obj R(bslmf::MovableRefUtil::move(mU), &da);
+            ASSERT(X == R);
+            ASSERT(usesAllocator(R, &da));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            const Obj I({ ValueType("a", "1"),
+                          ValueType("b", "2"),
+                          ValueType("a", "3") }, &oa);
+            ASSERT(2 == I.size());
+            ASSERT("1" == I.at("a"));
+            ASSERT(usesAllocator(I, &oa));
+#endif
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            ASSERT(  X == Y );
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 30; ++i) {
+                mX.insert(values[i]);
+                mY.insert(values[29 - i]);
+
+                ASSERTV(i, (i == 29) == (X == Y));
+                ASSERTV(i, (i != 29) == (X != Y));
+            }
+
+            mY[makeString(0)] = "different";
+            ASSERT(  X != Y );
+            ASSERT(!(X == Y));
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, look up, erase, copy, and iterate over
+        //:   elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            bsl::flat_unordered_map<int, int> mX(&oa);
+            const bsl::flat_unordered_map<int, int>& X = mX;
+
+            ASSERT(X.empty());
+
+            mX[1] = 10;
+            mX[2] = 20;
+            ASSERT(mX.insert(bsl::pair<const int, int>(3, 30)).second);
+            ASSERT(!mX.insert(bsl::pair<const int, int>(3, 0)).second);
+
+            ASSERT(3  == X.size());
+            ASSERT(20 == X.at(2));
+            ASSERT(X.end() == X.find(4));
+
+            int sum = 0;
+            for (bsl::flat_unordered_map<int, int>::const_iterator it =
+                                                                    X.begin();
+                 it != X.end();
+                 ++it) {
+                sum += it->second;
+            }
+            ASSERT(60 == sum);
+
+            ASSERT(1 == mX.erase(2));
+            ASSERT(2 == X.size());
+
+            bsl::flat_unordered_map<int, int> mY(X, &oa);
+            ASSERT(X == mY);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'unordered_map' VS. 'flat_unordered_map'
+        //
+        // Concerns:
+        //: 1 Inserting and looking up 'int' keys in a 'flat_unordered_map' is
+        //:   faster than in an 'unordered_map'.
+        //
+        // Plan:
+        //: 1 Insert 1 million 'int' keys (or the number of keys given as the
+        //:   second argument) into an 'unordered_map' and into a
+        //:   'flat_unordered_map', then look up the same sequence of
+        //:   pseudo-random keys, half of which are present, in each.  Report
+        //:   the time taken by each, and verify both find the same elements.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'unordered_map' VS. 'flat_unordered_map'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+             "\nPERFORMANCE TEST: 'unordered_map' VS. 'flat_unordered_map'"
+             "\n==========================================================\n");
+
+        typedef bsl::unordered_map<int, int>      Map;
+        typedef bsl::flat_unordered_map<int, int> FlatMap;
+
+        const int NUM_ELEMENTS = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 1000 * 1000;
+        const int NUM_LOOKUPS  = 10 * NUM_ELEMENTS;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        const unsigned int KEY_RANGE = 2u * NUM_ELEMENTS;
+
+        bsl::vector<int> keys(allocator);
+        keys.reserve(NUM_LOOKUPS);
+        unsigned int seed = 12345;
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            keys.push_back(static_cast<int>((seed >> 1) % KEY_RANGE));
+        }
+
+        bsls::Stopwatch timer;
+
+        Map mX(allocator);  const Map& X = mX;
+
+        timer.start(true);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX[2 * i] = i;
+        }
+        timer.stop();
+        const double mapInsertTime = timer.elapsedTime();
+
+        Int64 mapSum = 0;
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            Map::const_iterator it = X.find(keys[i]);
+            if (X.end() != it) {
+                mapSum += it->second;
+            }
+        }
+        timer.stop();
+        const double mapFindTime = timer.elapsedTime();
+
+        FlatMap mY(allocator);  const FlatMap& Y = mY;
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mY[2 * i] = i;
+        }
+        timer.stop();
+        const double flatInsertTime = timer.elapsedTime();
+
+        Int64 flatSum = 0;
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            FlatMap::const_iterator it = Y.find(keys[i]);
+            if (Y.end() != it) {
+                flatSum += it->second;
+            }
+        }
+        timer.stop();
+        const double flatFindTime = timer.elapsedTime();
+
+        ASSERTV(mapSum, flatSum, mapSum == flatSum);
+
+        printf("%d elements, %d lookups\n", NUM_ELEMENTS, NUM_LOOKUPS);
+        printf("                        insert       find\n");
+        printf("    'unordered_map':      %8.3fs  %8.3fs\n",
+               mapInsertTime,
+               mapFindTime);
+        printf("    'flat_unordered_map': %8.3fs  %8.3fs\n",
+               flatInsertTime,
+               flatFindTime);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
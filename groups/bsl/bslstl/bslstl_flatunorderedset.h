@@ -0,0 +1,1169 @@
+// bslstl_flatunorderedset.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATUNORDEREDSET
+#define INCLUDED_BSLSTL_FLATUNORDEREDSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed 'unordered_set' container.
+//
+//@CLASSES:
+//  bsl::flat_unordered_set: open-addressed 'unordered_set' container
+//
+//@CANONICAL_HEADER: bsl_flat_unordered_set.h
+//
+//@SEE_ALSO: bslstl_unorderedset, bslstl_flathashtable, bdlc_flathashset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_unordered_set', implementing a container holding a collection of
+// unique keys with no guarantees on ordering, that stores its elements in a
+// single open-addressed array rather than in separately allocated nodes.
+//
+// 'bsl::flat_unordered_set' provides an interface similar to that of
+// 'bsl::unordered_set' for looking up, inserting, and erasing elements, and
+// for iterating over them, with the same allocator model: the (template
+// parameter) type 'ALLOCATOR' supplies all memory, is used to construct the
+// elements, and is propagated on copy construction, copy assignment, move
+// assignment, and swap as indicated by 'bsl::allocator_traits<ALLOCATOR>'.
+// It is not, however, a complete replacement for an 'unordered_set' (see the
+// differences described below).  The elements are held in a
+// 'bslstl::FlatHashTable' (see 'bslstl_flathashtable').
+//
+///Differences from 'bsl::unordered_set'
+///-------------------------------------
+// The differences are those described for 'bsl::flat_unordered_map' (see
+// 'bslstl_flatunorderedmap'): any change in capacity invalidates all
+// iterators, pointers, and references to elements, and relocates the
+// elements; erasing an element invalidates only the iterators, pointers, and
+// references to the erased element; the 'KEY' type must be move-insertable;
+// there is no bucket interface, 'emplace', or 'emplace_hint'; and the maximum
+// load factor is fixed.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we want to determine the distinct values in a sequence of integers.
+//
+// First, we define the sequence:
+//..
+//  const int DATA[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+//  const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+//..
+// Then, we insert the values into a 'flat_unordered_set', reserving enough
+// capacity up front so that no rehash occurs during the insertions:
+//..
+//  bsl::flat_unordered_set<int> distinct;
+//  distinct.reserve(NUM_DATA);
+//
+//  for (int i = 0; i < NUM_DATA; ++i) {
+//      distinct.insert(DATA[i]);
+//  }
+//..
+// Finally, we verify the distinct values:
+//..
+//  assert(7 == distinct.size());
+//  assert(distinct.contains(9));
+//  assert(!distinct.contains(7));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_algorithm.h>
+#include <bslstl_equalto.h>
+#include <bslstl_flathashtable.h>
+#include <bslstl_hash.h>
+#include <bslstl_pair.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <cstddef>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                      // ================================
+                      // struct FlatUnorderedSet_EntryUtil
+                      // ================================
+
+template <class KEY>
+struct FlatUnorderedSet_EntryUtil {
+    // This templated utility provides a method to construct a 'KEY' entry, and
+    // a method to extract the key from such an entry, as required by
+    // 'FlatHashTable'.
+
+    // CLASS METHODS
+    template <class ALLOCATOR, class KEY_TYPE>
+    static void construct(
+                KEY                                         *entry,
+                ALLOCATOR&                                   allocator,
+                BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the specified 'key', using the
+        // specified 'allocator' to construct the entry.
+
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // ========================
+                          // class flat_unordered_set
+                          // ========================
+
+template <class KEY,
+          class HASH      = bsl::hash<KEY>,
+          class EQUAL     = bsl::equal_to<KEY>,
+          class ALLOCATOR = bsl::allocator<KEY> >
+class flat_unordered_set {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique values (of template parameter type 'KEY'),
+    // stored in an open-addressed array.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::FlatUnorderedSet_EntryUtil<KEY> EntryUtil;
+        // This 'typedef' is an alias for the utility used by the underlying
+        // table to construct entries and extract their keys.
+
+    typedef BloombergLP::bslstl::FlatHashTable<KEY,
+                                               KEY,
+                                               EntryUtil,
+                                               HASH,
+                                               EQUAL,
+                                               ALLOCATOR> ImplType;
+        // This 'typedef' is an alias for the underlying implementation class.
+
+    typedef BloombergLP::bslmf::MovableRefUtil MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated with
+        // movable references.
+
+    // FRIENDS
+    template <class KEY2, class HASH2, class EQUAL2, class ALLOCATOR2>
+    friend bool operator==(
+                   const flat_unordered_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
+                   const flat_unordered_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+    template <class KEY2, class HASH2, class EQUAL2, class ALLOCATOR2>
+    friend void swap(flat_unordered_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
+                     flat_unordered_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef HASH                                       hasher;
+    typedef EQUAL                                      key_equal;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename ImplType::const_iterator          iterator;
+    typedef iterator                                   const_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying flat hash table used by this set
+
+  public:
+    // CREATORS
+    flat_unordered_set();
+    explicit
+    flat_unordered_set(size_type        initialCapacity,
+                       const HASH&      hashFunction   = HASH(),
+                       const EQUAL&     keyEqual       = EQUAL(),
+                       const ALLOCATOR& basicAllocator = ALLOCATOR());
+    flat_unordered_set(size_type        initialCapacity,
+                       const HASH&      hashFunction,
+                       const ALLOCATOR& basicAllocator);
+    flat_unordered_set(size_type        initialCapacity,
+                       const ALLOCATOR& basicAllocator);
+    explicit
+    flat_unordered_set(const ALLOCATOR& basicAllocator);
+        // Create an empty flat unordered set.  Optionally specify an
+        // 'initialCapacity' indicating the minimum number of elements the set
+        // can hold without allocating.  If 'initialCapacity' is not supplied
+        // or is 0, no memory is allocated.  Optionally specify a
+        // 'hashFunction' used to generate the hash values for the keys
+        // contained in this set.  If 'hashFunction' is not supplied, a
+        // default-constructed object of (template parameter) type 'HASH' is
+        // used.  Optionally specify a key-equality functor 'keyEqual' used to
+        // verify that two key values are the same.  If 'keyEqual' is not
+        // supplied, a default-constructed object of (template parameter) type
+        // 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // (the default), then 'basicAllocator', if supplied, shall be
+        // convertible to 'bslma::Allocator *'.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    flat_unordered_set(INPUT_ITERATOR   first,
+                       INPUT_ITERATOR   last,
+                       size_type        initialCapacity = 0,
+                       const HASH&      hashFunction    = HASH(),
+                       const EQUAL&     keyEqual        = EQUAL(),
+                       const ALLOCATOR& basicAllocator  = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_unordered_set(INPUT_ITERATOR   first,
+                       INPUT_ITERATOR   last,
+                       const ALLOCATOR& basicAllocator);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_unordered_set(std::initializer_list<KEY> values,
+                       size_type                  initialCapacity = 0,
+                       const HASH&                hashFunction    = HASH(),
+                       const EQUAL&               keyEqual        = EQUAL(),
+                       const ALLOCATOR&           basicAllocator =
+                                                                  ALLOCATOR());
+    flat_unordered_set(std::initializer_list<KEY> values,
+                       const ALLOCATOR&           basicAllocator);
+#endif
+        // Create a flat unordered set, and insert each 'value_type' object in
+        // the sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element (or in the specified
+        // 'values' list), ignoring those objects having a value equivalent to
+        // that of an object already in this set.  Optionally specify an
+        // 'initialCapacity', 'hashFunction', 'keyEqual', and 'basicAllocator'
+        // having the meanings given for the constructors above.  The behavior
+        // is undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.
+
+    flat_unordered_set(const flat_unordered_set& original);
+        // Create a flat unordered set having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object.  Use the
+        // allocator returned by
+        // 'allocator_traits<ALLOCATOR>::select_on_container_copy_construction'
+        // applied to 'original.get_allocator()' to supply memory.
+
+    flat_unordered_set(const flat_unordered_set& original,
+                       const ALLOCATOR&          basicAllocator);
+        // Create a flat unordered set having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object, using
+        // the specified 'basicAllocator' to supply memory.
+
+    flat_unordered_set(
+                  BloombergLP::bslmf::MovableRef<flat_unordered_set> original);
+                                                                    // IMPLICIT
+        // Create a flat unordered set having the same value as the specified
+        // 'original' object by moving (in constant time) the contents of
+        // 'original' to the new set.  The allocator associated with 'original'
+        // is propagated for use in the newly-created set.  'original' is left
+        // in a valid but unspecified state.
+
+    flat_unordered_set(
+                   BloombergLP::bslmf::MovableRef<flat_unordered_set> original,
+                   const ALLOCATOR&                            basicAllocator);
+        // Create a flat unordered set having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object, using
+        // the specified 'basicAllocator' to supply memory.  The contents of
+        // 'original' are moved (in constant time) to the new set if
+        // 'basicAllocator == original.get_allocator()', and are move-inserted
+        // (in linear time) using 'basicAllocator' otherwise.  'original' is
+        // left in a valid but unspecified state.
+
+    ~flat_unordered_set();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    flat_unordered_set& operator=(const flat_unordered_set& rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_unordered_set& operator=(
+                       BloombergLP::bslmf::MovableRef<flat_unordered_set> rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_move_assignment', and return a reference
+        // providing modifiable access to this object.  The contents of 'rhs'
+        // are moved (in constant time) to this set if 'get_allocator() ==
+        // rhs.get_allocator()' (after accounting for the aforementioned
+        // trait); otherwise, each element in 'rhs' is move-inserted into this
+        // set.  'rhs' is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_unordered_set& operator=(std::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those objects having a value
+        // equivalent to that of an object already in this set, and return a
+        // reference providing modifiable access to this object.
+#endif
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this set.  Note that this set will be empty
+        // after calling this method, but allocated memory may be retained for
+        // future use.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the object having the specified 'key', if it
+        // exists, and return 1; otherwise (there is no object with a key
+        // equivalent to 'key' in this set) return 0 with no other effect.
+        // This method invalidates only iterators, pointers, and references to
+        // the removed element.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the object at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last in the sequence.  The behavior is undefined
+        // unless 'position' refers to an object in this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the objects starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this set or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the iteration sequence provided by this set.
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, if a key
+        // equivalent to 'value' already exists in this set, this method has no
+        // effect.  Return a pair whose 'first' member is an iterator referring
+        // to the (possibly newly inserted) object in this set that is
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // value was inserted, and 'false' if the key was already present.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each object in the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, whose key is not already contained in
+        // this set.  The behavior is undefined unless 'first' and 'last' refer
+        // to a sequence of valid values where 'first' is at a position at or
+        // before 'last'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this set the value of each object in the specified
+        // 'values' initializer list whose key is not already contained in this
+        // set.
+#endif
+
+    void rehash(size_type minimumCapacity);
+        // Change the capacity of this set to at least the specified
+        // 'minimumCapacity', and redistribute all the contained elements into
+        // a new array of elements, according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the set is returned to the
+        // default-constructed state, releasing all memory.  Note that this
+        // operation invalidates all iterators, pointers, and references to
+        // elements of this set.
+
+    void reserve(size_type numElements);
+        // Increase the capacity of this set, if necessary, so that it can
+        // hold at least the specified 'numElements' without exceeding the
+        // maximum load factor.  Note that this operation invalidates all
+        // iterators, pointers, and references to elements of this set if the
+        // capacity changes.
+
+    void swap(flat_unordered_set& other);
+        // Exchange the value, hasher, and key-equality functor of this object
+        // with those of the specified 'other' object; also exchange the
+        // allocator of this object with that of 'other' if the (template
+        // parameter) type 'ALLOCATOR' has the
+        // 'propagate_on_container_swap' trait, and do not modify either
+        // allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee.  This operation has 'O[1]' complexity.
+        // The behavior is undefined unless either this object was created
+        // with the same allocator as 'other' or 'ALLOCATOR' has the
+        // 'propagate_on_container_swap' trait.
+
+    // ACCESSORS
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the sequence of objects maintained by this
+        // set, or the 'end' iterator if this set is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end position in the sequence of 'value_type' objects
+        // maintained by this set.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this set could hold if the load
+        // factor were 1.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this set contains an element equivalent to the
+        // specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this set contains an element equivalent to the
+        // specified 'key', and 'false' otherwise.  Note that this overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent.  Also note: implemented inline due to Sun CC
+        // compilation error.
+    {
+        return d_impl.contains(key);
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of objects within this set that are equivalent to
+        // the specified 'key'.  Note that since a flat unordered set maintains
+        // unique keys, the returned value will be either 0 or 1.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of objects within this set that are equivalent to
+        // the specified 'key'.  Note that this overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are transparent.
+        // Also note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.count(key);
+    }
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of objects in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence,
+        // and the second is positioned one past the end of the sequence.  If
+        // this set contains no object equivalent to 'key', then the two
+        // returned iterators will have the same value.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of objects in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence,
+        // and the second is positioned one past the end of the sequence.  If
+        // this set contains no such object, then the two returned iterators
+        // will have the same value.  Note that this overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are transparent.
+        // Also note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the object in
+        // this set equivalent to the specified 'key', if such an entry exists,
+        // and the past-the-end ('end') iterator otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the object in
+        // this set equivalent to the specified 'key', if such an entry exists,
+        // and the past-the-end ('end') iterator otherwise.  No 'key_type'
+        // object is created.  Note that this overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent.  Also
+        // note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    ALLOCATOR get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash unary functor used by this set to
+        // generate a hash value (of type 'std::size_t') for a 'key_type'
+        // object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality binary functor that returns
+        // 'true' if the value of two 'key_type' objects are equivalent, and
+        // 'false' otherwise.
+
+    float load_factor() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the current ratio between the 'size' of this set and its
+        // 'capacity'.
+
+    float max_load_factor() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the maximum load factor allowed for this set.  Note that if
+        // an insert operation would cause the load factor to exceed the
+        // 'max_load_factor', that same insert operation will increase the
+        // capacity and rehash the entries of the container.  Note that the
+        // maximum load factor of a flat unordered set is fixed.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this set.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator==(const flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_unordered_set' objects have the
+    // same value if they have the same number of value elements, and for each
+    // value element that is contained in 'lhs' there is a value element
+    // contained in 'rhs' having the same value, and vice versa.  Note that
+    // this method requires that the (template parameter) type 'KEY' be
+    // 'equality-comparable'.
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator!=(const flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_unordered_set' objects do
+    // not have the same value if they do not have the same number of value
+    // elements, or that for some value element contained in 'lhs' there is
+    // not a value element in 'rhs' having the same value, and vice-versa.
+    // Note that this method requires that the (template parameter) type 'KEY'
+    // be 'equality-comparable'.
+#endif
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR, class PREDICATE>
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+erase_if(flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& s,
+         PREDICATE                                        predicate);
+    // Erase all the elements in the specified flat unordered set 's' that
+    // satisfy the specified predicate 'predicate'.  Return the number of
+    // elements erased.
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+void swap(flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& a,
+          flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& b);
+    // Exchange the value, hasher, key-equality functor, and allocator of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the
+    // same allocator or the 'ALLOCATOR' type has the
+    // 'propagate_on_container_swap' trait, and the basic guarantee otherwise;
+    // in the latter case, each object keeps its allocator and receives a copy
+    // of the value of the other.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                      // --------------------------------
+                      // struct FlatUnorderedSet_EntryUtil
+                      // --------------------------------
+
+// CLASS METHODS
+template <class KEY>
+template <class ALLOCATOR, class KEY_TYPE>
+inline
+void FlatUnorderedSet_EntryUtil<KEY>::construct(
+                KEY                                         *entry,
+                ALLOCATOR&                                   allocator,
+                BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsl::allocator_traits<ALLOCATOR>::construct(
+                                allocator,
+                                entry,
+                                BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+}
+
+template <class KEY>
+inline
+const KEY& FlatUnorderedSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // ------------------------
+                          // class flat_unordered_set
+                          // ------------------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set()
+: d_impl(0, HASH(), EQUAL(), ALLOCATOR())
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                            size_type        initialCapacity,
+                                            const HASH&      hashFunction,
+                                            const EQUAL&     keyEqual,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, hashFunction, keyEqual, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                            size_type        initialCapacity,
+                                            const HASH&      hashFunction,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, hashFunction, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                            size_type        initialCapacity,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                               const ALLOCATOR& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                            INPUT_ITERATOR   first,
+                                            INPUT_ITERATOR   last,
+                                            size_type        initialCapacity,
+                                            const HASH&      hashFunction,
+                                            const EQUAL&     keyEqual,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(initialCapacity, hashFunction, keyEqual, basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                            INPUT_ITERATOR   first,
+                                            INPUT_ITERATOR   last,
+                                            const ALLOCATOR& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                    std::initializer_list<KEY> values,
+                                    size_type                  initialCapacity,
+                                    const HASH&                hashFunction,
+                                    const EQUAL&               keyEqual,
+                                    const ALLOCATOR&           basicAllocator)
+: d_impl(initialCapacity, hashFunction, keyEqual, basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                     std::initializer_list<KEY> values,
+                                     const ALLOCATOR&           basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                            const flat_unordered_set& original)
+: d_impl(original.d_impl,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                                     const flat_unordered_set& original,
+                                     const ALLOCATOR&          basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                   BloombergLP::bslmf::MovableRef<flat_unordered_set> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_unordered_set(
+                   BloombergLP::bslmf::MovableRef<flat_unordered_set> original,
+                   const ALLOCATOR&                            basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::~flat_unordered_set()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>&
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::operator=(
+                                                 const flat_unordered_set& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>&
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::operator=(
+                        BloombergLP::bslmf::MovableRef<flat_unordered_set> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>&
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator first,
+                                                       const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    typedef pair<typename ImplType::iterator, bool> ResultType;
+
+    ResultType result = d_impl.insert(value);
+    return pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    typedef pair<typename ImplType::iterator, bool> ResultType;
+
+    ResultType result = d_impl.insert(MoveUtil::move(value));
+    return pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::rehash(
+                                                     size_type minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::swap(
+                                                     flat_unordered_set& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
+     typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator>
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+ALLOCATOR
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return ALLOCATOR(d_impl.allocator());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+HASH flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+EQUAL flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::load_factor() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.max_size();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_impl.size();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator==(
+               const bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+               const bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+               const bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+               const bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+#endif
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR, class PREDICATE>
+inline
+typename bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+bsl::erase_if(flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& s,
+              PREDICATE                                        predicate)
+{
+    return BloombergLP::bslstl::AlgorithmUtil::containerEraseIf(s, predicate);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& a,
+               bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& b)
+{
+    BloombergLP::bslstl::swap(a.d_impl, b.d_impl);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat unordered associative containers:
+//: o A flat unordered associative container defines STL iterators.
+//: o A flat unordered associative container uses 'bslma' allocators if the
+//:   (template parameter) type 'ALLOCATOR' is convertible from
+//:   'bslma::Allocator *'.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_unordered_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_unordered_set<KEY,
+                                                  HASH,
+                                                  EQUAL,
+                                                  ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,552 @@
+// bslstl_flatunorderedset.t.cpp                                      -*-C++-*-
+#include <bslstl_flatunorderedset.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines 'bsl::flat_unordered_set', a thin wrapper
+// around 'bslstl::FlatHashTable' (tested in 'bslstl_flathashtable') that
+// provides the interface of 'bsl::unordered_set'.  We therefore test that each
+// method forwards to the table correctly, and that the elements are
+// constructed using the container's allocator.  Allocator propagation is
+// implemented (and tested) by 'bslstl::FlatHashTable'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_unordered_set();
+// [ 2] flat_unordered_set(const ALLOCATOR& basicAllocator);
+// [ 2] flat_unordered_set(INPUT_ITERATOR, INPUT_ITERATOR, ..., alloc);
+// [ 2] flat_unordered_set(initializer_list<KEY>, ..., alloc);
+// [ 2] flat_unordered_set(const flat_unordered_set& original);
+// [ 2] flat_unordered_set(const flat_unordered_set&, const ALLOCATOR&);
+// [ 2] flat_unordered_set(MovableRef<flat_unordered_set> original);
+// [ 2] flat_unordered_set(MovableRef<flat_unordered_set>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 3] flat_unordered_set& operator=(const flat_unordered_set& rhs);
+// [ 3] flat_unordered_set& operator=(MovableRef<flat_unordered_set> rhs);
+// [ 3] size_type erase(const key_type& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<iterator, bool> insert(const value_type& value);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type> value);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void swap(flat_unordered_set& other);
+//
+// ACCESSORS
+// [ 3] bool contains(const key_type& key) const;
+// [ 3] size_type count(const key_type& key) const;
+// [ 3] const_iterator find(const key_type& key) const;
+// [ 2] ALLOCATOR get_allocator() const;
+//
+// FREE FUNCTIONS
+// [ 2] bool operator==(const flat_unordered_set&, const flat_unordered_set&);
+// [ 2] bool operator!=(const flat_unordered_set&, const flat_unordered_set&);
+// [ 3] size_type erase_if(flat_unordered_set& s, PREDICATE predicate);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_unordered_set<bsl::string> Obj;
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique for the specified 'value'.
+{
+    char buffer[64];
+    sprintf(buffer, "a string that does not fit in the SSO buffer %d", value);
+    return bsl::string(buffer);
+}
+
+bool usesAllocator(const Obj& set, bslma::Allocator *allocator)
+    // Return 'true' if the specified 'set', and each element in 'set', uses
+    // the specified 'allocator', and 'false' otherwise.
+{
+    if (set.get_allocator().mechanism() != allocator) {
+        return false;                                                 // RETURN
+    }
+    for (Obj::const_iterator it = set.begin(); it != set.end(); ++it) {
+        if (it->get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool isOdd(const bsl::string& value)
+    // Return 'true' if the last character of the specified 'value' is an odd
+    // digit, and 'false' otherwise.
+{
+    return (value[value.size() - 1] - '0') % 2;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we want to determine the distinct values in a sequence of integers.
+//
+// First, we define the sequence:
+//..
+    const int DATA[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+//..
+// Then, we insert the values into a 'flat_unordered_set', reserving enough
+// capacity up front so that no rehash occurs during the insertions:
+//..
+    bsl::flat_unordered_set<int> distinct;
+    distinct.reserve(NUM_DATA);
+
+    for (int i = 0; i < NUM_DATA; ++i) {
+        distinct.insert(DATA[i]);
+    }
+//..
+// Finally, we verify the distinct values:
+//..
+    ASSERT(7 == distinct.size());
+    ASSERT(distinct.contains(9));
+    ASSERT(!distinct.contains(7));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each 'insert' inserts the elements that are absent, using the
+        //:   set's allocator, and reports whether an insertion occurred.
+        //:
+        //: 2 'find', 'contains', and 'count' agree.
+        //:
+        //: 3 Every form of 'erase', and 'erase_if', remove the expected
+        //:   elements.
+        //:
+        //: 4 Copy and move assignment, and 'swap', give the expected values,
+        //:   and a move assignment or swap between sets having the same
+        //:   allocator does not allocate.
+        //
+        // Plan:
+        //: 1 Populate sets using each 'insert', then look up, erase, assign,
+        //:   and swap them, verifying the values and the use of memory.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   flat_unordered_set& operator=(const flat_unordered_set& rhs);
+        //   flat_unordered_set& operator=(MovableRef<flat_unordered_set> rhs);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   pair<iterator, bool> insert(MovableRef<value_type> value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void swap(flat_unordered_set& other);
+        //   bool contains(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type erase_if(flat_unordered_set& s, PREDICATE predicate);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND ACCESSORS"
+                            "\n==========================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                const bsl::string K = makeString(i);
+
+                bsl::pair<Obj::iterator, bool> rv = mX.insert(K);
+                ASSERTV(i, rv.second);
+                ASSERTV(i, K == *rv.first);
+
+                bsl::string key(K, &oa);
+                rv = mX.insert(bslmf::MovableRefUtil::move(key));
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, K == *rv.first);
+            }
+
+            bsl::vector<bsl::string> values;
+            for (int i = 25; i < 75; ++i) {
+                values.push_back(makeString(i));
+            }
+            mX.insert(values.begin(), values.end());
+            ASSERT(75 == X.size());
+            ASSERT(usesAllocator(X, &oa));
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string K = makeString(i);
+
+                const bool PRESENT = i < 75;
+
+                ASSERTV(i, PRESENT == (X.end() != X.find(K)));
+                ASSERTV(i, PRESENT == X.contains(K));
+                ASSERTV(i, static_cast<std::size_t>(PRESENT) == X.count(K));
+            }
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY = X;
+            ASSERT(X == Y);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < 75; i += 3) {
+                ASSERTV(i, 1 == mX.erase(makeString(i)));
+                ASSERTV(i, 0 == mX.erase(makeString(i)));
+            }
+            ASSERT(50 == X.size());
+
+            Obj::const_iterator it = X.begin();
+            it = mX.erase(it);
+            ASSERT(49 == X.size());
+            ASSERT(X.end() == mX.erase(it, X.end()));
+            ASSERT(0 == X.size());
+
+            mX.swap(mY);
+            ASSERT(75 == X.size());
+            ASSERT(0  == Y.size());
+
+            mY = bslmf::MovableRefUtil::move(mX);
+            ASSERT(75 == Y.size());
+            ASSERT(oam.isTotalSame());
+
+            ASSERT(37 == bsl::erase_if(mY, isOdd));
+            ASSERT(38 == Y.size());
+            for (int i = 0; i < 75; ++i) {
+                ASSERTV(i, (i % 2 == 0) == Y.contains(makeString(i)));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set having the expected value and
+        //:   allocator, using the default allocator if none is supplied.
+        //:
+        //: 2 A default-constructed set allocates no memory.
+        //:
+        //: 3 The move constructor without an allocator, or with an equal
+        //:   allocator, takes ownership of the elements without allocating.
+        //:
+        //: 4 'operator==' and 'operator!=' compare the elements irrespective
+        //:   of their order.
+        //
+        // Plan:
+        //: 1 Construct sets using each constructor, and verify their value,
+        //:   their allocator, and the allocators of their elements.
+        //:   (C-1..3)
+        //:
+        //: 2 Compare sets holding the same elements inserted in different
+        //:   orders, and sets differing in one element.  (C-4)
+        //
+        // Testing:
+        //   flat_unordered_set();
+        //   flat_unordered_set(const ALLOCATOR& basicAllocator);
+        //   flat_unordered_set(INPUT_ITERATOR, INPUT_ITERATOR, ..., alloc);
+        //   flat_unordered_set(initializer_list<KEY>, ..., alloc);
+        //   flat_unordered_set(const flat_unordered_set& original);
+        //   flat_unordered_set(const flat_unordered_set&, const ALLOCATOR&);
+        //   flat_unordered_set(MovableRef<flat_unordered_set> original);
+        //   flat_unordered_set(MovableRef<flat_unordered_set>, const ALLOC&);
+        //   ALLOCATOR get_allocator() const;
+        //   bool operator==(const flat_unordered_set&, const flat_uo_set&);
+        //   bool operator!=(const flat_unordered_set&, const flat_uo_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator va("values",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::vector<bsl::string> values(&va);
+        for (int i = 0; i < 30; ++i) {
+            values.push_back(makeString(i));
+        }
+
+        {
+            bslma::TestAllocatorMonitor dam(&da);
+
+            const Obj W;
+            ASSERT(0 == W.size());
+            ASSERT(&da == W.get_allocator().mechanism());
+
+            const Obj X(&oa);
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(dam.isTotalSame());
+        }
+
+        {
+            const Obj X(values.begin(), values.end(), 0,
+                        bsl::hash<bsl::string>(),
+                        bsl::equal_to<bsl::string>(), &oa);
+            ASSERT(30 == X.size());
+            ASSERT(usesAllocator(X, &oa));
+
+            const Obj Y(X);
+            ASSERT(X == Y);
+            ASSERT(usesAllocator(Y, &da));
+
+            const Obj Z(X, &oa);
+            ASSERT(X == Z);
+            ASSERT(usesAllocator(Z, &oa));
+
+            Obj mS(X, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj M(bslmf::MovableRefUtil::move(mS));
+            ASSERT(X == M);
+            ASSERT(0 == mS.size());
+            ASSERT(oam.isTotalSame());
+
+            Obj mT(X, &oa);
+            oam.reset(&oa);
+
+            const Obj N(bslmf::MovableRefUtil::move(mT), &oa);
+            ASSERT(X == N);
+            ASSERT(oam.isTotalSame());
+
+            Obj mU(X, &oa);
+            const Obj R(bslmf::MovableRefUtil::move(mU), &da);
+            ASSERT(X == R);
+            ASSERT(usesAllocator(R, &da));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            const Obj I({ "a", "b", "a" }, &oa);
+            ASSERT(2 == I.size());
+            ASSERT(I.contains("b"));
+            ASSERT(usesAllocator(I, &oa));
+#endif
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            ASSERT(  X == Y );
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 30; ++i) {
+                mX.insert(values[i]);
+                mY.insert(values[29 - i]);
+
+                ASSERTV(i, (i == 29) == (X == Y));
+                ASSERTV(i, (i != 29) == (X != Y));
+            }
+
+            mY.erase(values[0]);
+            mY.insert(makeString(-1));
+            ASSERT(  X != Y );
+            ASSERT(!(X == Y));
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, look up, erase, copy, and iterate over
+        //:   elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            bsl::flat_unordered_set<int> mX(&oa);
+            const bsl::flat_unordered_set<int>& X = mX;
+
+            ASSERT(X.empty());
+
+            ASSERT( mX.insert(1).second);
+            ASSERT( mX.insert(2).second);
+            ASSERT(!mX.insert(2).second);
+            ASSERT(2 == X.size());
+
+            int sum = 0;
+            for (bsl::flat_unordered_set<int>::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                sum += *it;
+            }
+            ASSERT(3 == sum);
+
+            ASSERT(1 == mX.erase(2));
+            ASSERT(1 == X.size());
+
+            bsl::flat_unordered_set<int> mY(X, &oa);
+            ASSERT(X == mY);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2023 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -2533,6 +2533,22 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class FORWARD_ITERATOR>
+    void findBatch(bslalg::BidirectionalLink **results,
+                   FORWARD_ITERATOR            first,
+                   FORWARD_ITERATOR            last) const;
+        // Load, into consecutive elements of the array starting at the
+        // specified 'results', the value that 'find' returns for each key in
+        // the range starting at the specified 'first' and ending immediately
+        // before the specified 'last'.  The keys are looked up in groups: the
+        // hash codes of all keys of a group are computed, and the buckets and
+        // first nodes they refer to are prefetched, before any key of the
+        // group is compared, so that the memory latency of the lookups
+        // overlaps.  The behavior is undefined unless 'results' refers to an
+        // array having at least as many elements as there are keys in the
+        // range, and 'FORWARD_ITERATOR' is a forward iterator whose
+        // 'value_type' is convertible to 'KeyType'.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -4603,7 +4619,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     if (!hint
         || !d_parameters.comparator()(lvalue,
                                       ImpUtil::extractKey<KEY_CONFIG>(hint))) {
-        hint = this->find(lvalue, hashCode);
+        // 'KEY_ARG' may be a transparent lookup type, so search without
+        // converting it to 'KeyType'.
+        hint = ImpUtil::findTransparent<KEY_CONFIG>(
+                                                    d_anchor,
+                                                    lvalue,
+                                                    d_parameters.comparator(),
+                                                    hashCode);
     }
 
     // If the key exists, we're done
@@ -4723,6 +4745,55 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class FORWARD_ITERATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                    bslalg::BidirectionalLink **results,
+                                    FORWARD_ITERATOR            first,
+                                    FORWARD_ITERATOR            last) const
+{
+    BSLS_ASSERT_SAFE(results || first == last);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    enum { k_GROUP_SIZE = 16 };  // number of lookups in flight
+
+    FORWARD_ITERATOR               keys[k_GROUP_SIZE];
+    std::size_t                    hashCodes[k_GROUP_SIZE];
+    const bslalg::HashTableBucket *buckets[k_GROUP_SIZE];
+
+    const bslalg::HashTableBucket *bucketArray =
+                                                 d_anchor.bucketArrayAddress();
+    const std::size_t              numBuckets  = d_anchor.bucketArraySize();
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys]      = first;
+            hashCodes[numKeys] = d_parameters.hashCodeForKey(*first);
+            buckets[numKeys]   = bucketArray + ImpUtil::computeBucketIndex(
+                                                            hashCodes[numKeys],
+                                                            numBuckets);
+            bsls::PerformanceHint::prefetchForReading(buckets[numKeys]);
+
+            ++first;
+            ++numKeys;
+        } while (numKeys < k_GROUP_SIZE && first != last);
+
+        for (int i = 0; i < numKeys; ++i) {
+            if (const bslalg::BidirectionalLink *node = buckets[i]->first()) {
+                bsls::PerformanceHint::prefetchForReading(node);
+            }
+        }
+
+        for (int i = 0; i < numKeys; ++i) {
+            results[i] = this->find(*keys[i], hashCodes[i]);
+        }
+        results += numKeys;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
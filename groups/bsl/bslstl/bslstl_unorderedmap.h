@@ -1500,6 +1500,24 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result);
+        // Write, to consecutive positions of the specified 'result', the
+        // iterator that 'find' returns for each key in the range starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', and return the position following the last one written.
+        // The hash codes of a group of keys are computed, and their buckets
+        // and first nodes prefetched, before any key of the group is
+        // compared, so that the memory latency of the lookups overlaps; this
+        // is substantially faster than calling 'find' for each key when the
+        // table does not fit in the cache of the processor.  The behavior is
+        // undefined unless 'FORWARD_ITERATOR' is a forward iterator whose
+        // 'value_type' is convertible to 'key_type', and 'OUTPUT_ITERATOR' is
+        // an output iterator to which 'iterator' can be written.  Note that
+        // this function is an extension to the C++ standard.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1848,6 +1866,75 @@ class unordered_map {
         // (template parameter) types 'KEY' and 'VALUE' are
         // 'emplace-constructible' from 'key' and 'args' respectively.  For
         // C++03, 'VALUE' must also be 'copy-constructible'.
+
+    template <class LOOKUP_KEY, class... Args>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                Args&&...                                     args)
+        // If a key equivalent to the specified 'key' already exists in this
+        // unordered_map, return a pair containing an iterator referring to the
+        // existing item, and 'false'.  Otherwise, insert into this map a
+        // newly-created 'value_type' object, constructed from
+        // 'std::forward<LOOKUP_KEY>(key)' and the specified 'args', and return
+        // a pair containing an iterator referring to the newly-created entry
+        // and 'true'.  No 'KEY' object is created unless an element is
+        // inserted.  This method requires that the (template parameter) type
+        // 'KEY' is 'emplace-constructible' from 'key', and 'VALUE' from
+        // 'args'.  For C++03, 'VALUE' must also be 'copy-constructible'.  The
+        // behavior is undefined unless the hash and equality functors produce
+        // the same results for 'key' as for a 'KEY' constructed from 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                               BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+
+    template <class LOOKUP_KEY, class... Args>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                Args&&...                                     args)
+        // If a key equivalent to the specified 'key' already exists in this
+        // unordered_map, return an iterator referring to the existing item.
+        // Otherwise, insert into this map a newly-created 'value_type' object,
+        // constructed from 'std::forward<LOOKUP_KEY>(key)' and the specified
+        // 'args', and return an iterator referring to the newly-created entry.
+        // Use the specified 'hint' as a starting point for checking to see if
+        // the key already in the unordered_map.  No 'KEY' object is created
+        // unless an element is inserted.  This method requires that the
+        // (template parameter) type 'KEY' is 'emplace-constructible' from
+        // 'key', and 'VALUE' from 'args'.  For C++03, 'VALUE' must also be
+        // 'copy-constructible'.  The behavior is undefined unless the hash and
+        // equality functors produce the same results for 'key' as for a 'KEY'
+        // constructed from 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                               BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+            return iterator(result);
+        }
 #endif
 
     // ACCESSORS
@@ -2017,6 +2104,23 @@ class unordered_map {
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result) const;
+        // Write, to consecutive positions of the specified 'result', the
+        // iterator that 'find' returns for each key in the range starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', and return the position following the last one written.
+        // The hash codes of a group of keys are computed, and their buckets
+        // and first nodes prefetched, before any key of the group is
+        // compared, so that the memory latency of the lookups overlaps.  The
+        // behavior is undefined unless 'FORWARD_ITERATOR' is a forward
+        // iterator whose 'value_type' is convertible to 'key_type', and
+        // 'OUTPUT_ITERATOR' is an output iterator to which 'const_iterator'
+        // can be written.  Note that this function is an extension to the C++
+        // standard.
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -2937,6 +3041,37 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find_batch(
+                                                       FORWARD_ITERATOR first,
+                                                       FORWARD_ITERATOR last,
+                                                       OUTPUT_ITERATOR  result)
+{
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (first != last) {
+        FORWARD_ITERATOR chunkLast = first;
+        int              numKeys   = 0;
+        do {
+            ++chunkLast;
+            ++numKeys;
+        } while (numKeys < k_CHUNK_SIZE && chunkLast != last);
+
+        d_impl.findBatch(links, first, chunkLast);
+
+        for (int i = 0; i < numKeys; ++i) {
+            *result = iterator(links[i]);
+            ++result;
+        }
+        first = chunkLast;
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -3389,6 +3524,37 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find_batch(
+                                                 FORWARD_ITERATOR first,
+                                                 FORWARD_ITERATOR last,
+                                                 OUTPUT_ITERATOR  result) const
+{
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (first != last) {
+        FORWARD_ITERATOR chunkLast = first;
+        int              numKeys   = 0;
+        do {
+            ++chunkLast;
+            ++numKeys;
+        } while (numKeys < k_CHUNK_SIZE && chunkLast != last);
+
+        d_impl.findBatch(links, first, chunkLast);
+
+        for (int i = 0; i < numKeys; ++i) {
+            *result = const_iterator(links[i]);
+            ++result;
+        }
+        first = chunkLast;
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
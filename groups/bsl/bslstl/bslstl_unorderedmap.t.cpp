@@ -12,6 +12,7 @@
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_destructorguard.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
@@ -33,6 +34,7 @@
 #include <bsls_nameof.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 #include <bsls_util.h>
 
@@ -182,6 +184,8 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [45] OUTPUT_ITER find_batch(FWD_ITER first, FWD_ITER last, OUTPUT_ITER);
+// [45] OUTPUT_ITER find_batch(FWD_ITER, FWD_ITER, OUTPUT_ITER) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -230,7 +234,8 @@ using bsl::pair;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [41] CLASS TEMPLATE ARGUMENT DEDUCTION
-// [45] USAGE EXAMPLE
+// [46] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'find' VS. 'find_batch'
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -10568,7 +10573,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 45: {
+      case 46: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -10588,6 +10593,7 @@ int main(int argc, char *argv[])
                             "\n=============\n");
         usage();
       } break;
+      case 45: // falls through
       case 44: // falls through
       case 43: // falls through
       case 42: // falls through
@@ -11309,6 +11315,107 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'find' VS. 'find_batch'
+        //
+        // Concerns:
+        //: 1 Looking up keys with 'find_batch' in a table much larger than
+        //:   the cache of the processor is faster than calling 'find' for
+        //:   each key.
+        //
+        // Plan:
+        //: 1 Create a map of 10 million 'int' keys (or the number of keys
+        //:   given as the second argument), and look up the same sequence of
+        //:   pseudo-random keys, half of which are present in the map, once
+        //:   calling 'find' for each key and once calling 'find_batch' for
+        //:   chunks of keys.  Report the time taken by each and verify that
+        //:   both find the same elements.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'find' VS. 'find_batch'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: 'find' VS. 'find_batch'"
+                            "\n=========================================\n");
+
+        typedef bsl::unordered_map<int, int> Map;
+        typedef Map::const_iterator          CIter;
+
+        const int NUM_ELEMENTS = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 10 * 1000 * 1000;
+        const int NUM_LOOKUPS  = NUM_ELEMENTS;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        Map mX(allocator);  const Map& X = mX;
+        mX.reserve(NUM_ELEMENTS);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX[2 * i] = i;
+        }
+
+        const unsigned int KEY_RANGE = 2u * NUM_ELEMENTS;
+
+        bsl::vector<int> keys(allocator);
+        keys.reserve(NUM_LOOKUPS);
+        unsigned int seed = 12345;
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            keys.push_back(static_cast<int>((seed >> 1) % KEY_RANGE));
+        }
+
+        bsls::Stopwatch timer;
+
+        Int64 findSum   = 0;
+        int   findCount = 0;
+        timer.start(true);
+        for (int i = 0; i < NUM_LOOKUPS; ++i) {
+            CIter it = X.find(keys[i]);
+            if (X.end() != it) {
+                findSum += it->second;
+                ++findCount;
+            }
+        }
+        timer.stop();
+        const double findTime = timer.elapsedTime();
+
+        enum { k_CHUNK_SIZE = 1024 };
+
+        CIter  results[k_CHUNK_SIZE];
+        Int64  batchSum   = 0;
+        int    batchCount = 0;
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < NUM_LOOKUPS; i += k_CHUNK_SIZE) {
+            const int numKeys = NUM_LOOKUPS - i < k_CHUNK_SIZE
+                              ? NUM_LOOKUPS - i
+                              : k_CHUNK_SIZE;
+
+            X.find_batch(keys.data() + i, keys.data() + i + numKeys, results);
+
+            for (int j = 0; j < numKeys; ++j) {
+                if (X.end() != results[j]) {
+                    batchSum += results[j]->second;
+                    ++batchCount;
+                }
+            }
+        }
+        timer.stop();
+        const double batchTime = timer.elapsedTime();
+
+        ASSERTV(findSum,   batchSum,   findSum   == batchSum);
+        ASSERTV(findCount, batchCount, findCount == batchCount);
+
+        printf("%d elements, %d lookups (%d found)\n",
+               NUM_ELEMENTS,
+               NUM_LOOKUPS,
+               findCount);
+        printf("    'find':       %8.3fs\n", findTime);
+        printf("    'find_batch': %8.3fs (%.2fx)\n",
+               batchTime,
+               batchTime > 0 ? findTime / batchTime : 0.0);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -21,7 +21,7 @@
 // regions of C++11 code, then this header contains no code and is not
 // '#include'd in the original header.
 //
-// Generated on Mon Apr 10 03:55:22 2023
+// Generated on Sun Oct 18 09:56:21 2026
 // Command line: sim_cpp11_features.pl bslstl_unorderedmap.h
 
 #ifdef COMPILING_BSLSTL_UNORDEREDMAP_H
@@ -822,6 +822,24 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result);
+        // Write, to consecutive positions of the specified 'result', the
+        // iterator that 'find' returns for each key in the range starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', and return the position following the last one written.
+        // The hash codes of a group of keys are computed, and their buckets
+        // and first nodes prefetched, before any key of the group is
+        // compared, so that the memory latency of the lookups overlaps; this
+        // is substantially faster than calling 'find' for each key when the
+        // table does not fit in the cache of the processor.  The behavior is
+        // undefined unless 'FORWARD_ITERATOR' is a forward iterator whose
+        // 'value_type' is convertible to 'key_type', and 'OUTPUT_ITERATOR' is
+        // an output iterator to which 'iterator' can be written.  Note that
+        // this function is an extension to the C++ standard.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1771,6 +1789,758 @@ class unordered_map {
                          BSLS_COMPILERFEATURES_FORWARD_REF(Args_10) args_10);
 #endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 10
 
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 0
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 0
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 1
+    template <class LOOKUP_KEY, class Args_01>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 1
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 2
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 2
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 3
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 3
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 4
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 4
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 5
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 5
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 6
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 6
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 7
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 7
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 8
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07,
+                                class Args_08>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_08) args_08)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_08, args_08));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 8
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 9
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07,
+                                class Args_08,
+                                class Args_09>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_08) args_08,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_09) args_09)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_08, args_08),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_09, args_09));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 9
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 10
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07,
+                                class Args_08,
+                                class Args_09,
+                                class Args_10>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_08) args_08,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_09) args_09,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_10) args_10)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_08, args_08),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_09, args_09),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_10, args_10));
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 10
+
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 0
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 0
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 1
+    template <class LOOKUP_KEY, class Args_01>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 1
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 2
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 2
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 3
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 3
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 4
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 4
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 5
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 5
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 6
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 6
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 7
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 7
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 8
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07,
+                                class Args_08>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_08) args_08)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_08, args_08));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 8
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 9
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07,
+                                class Args_08,
+                                class Args_09>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_08) args_08,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_09) args_09)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_08, args_08),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_09, args_09));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 9
+
+#if BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 10
+    template <class LOOKUP_KEY, class Args_01,
+                                class Args_02,
+                                class Args_03,
+                                class Args_04,
+                                class Args_05,
+                                class Args_06,
+                                class Args_07,
+                                class Args_08,
+                                class Args_09,
+                                class Args_10>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_01) args_01,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_02) args_02,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_03) args_03,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_04) args_04,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_05) args_05,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_06) args_06,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_07) args_07,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_08) args_08,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_09) args_09,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args_10) args_10)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_08, args_08),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_09, args_09),
+                              BSLS_COMPILERFEATURES_FORWARD(Args_10, args_10));
+
+            return iterator(result);
+        }
+#endif  // BSLSTL_UNORDEREDMAP_VARIADIC_LIMIT_C >= 10
+
 #else
 // The generated code below is a workaround for the absence of perfect
 // forwarding in some compilers.
@@ -1792,6 +2562,46 @@ class unordered_map {
     iterator try_emplace(const_iterator                      hint,
                          BloombergLP::bslmf::MovableRef<KEY> key,
                          BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args);
+
+    template <class LOOKUP_KEY, class... Args>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+        && !is_convertible<LOOKUP_KEY, const_iterator>::value
+        && !is_convertible<LOOKUP_KEY, iterator>::value,
+                      pair<iterator, bool> >::type
+    try_emplace(BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args)
+        {
+            typedef bsl::pair<iterator, bool> ResultType;
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               NULL,
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                               BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+            return ResultType(iterator(result), isInsertedFlag);
+        }
+
+    template <class LOOKUP_KEY, class... Args>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value,
+                      iterator>::type
+    try_emplace(const_iterator                                hint,
+                BSLS_COMPILERFEATURES_FORWARD_REF(LOOKUP_KEY) key,
+                BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args)
+        {
+            bool isInsertedFlag = false;
+            HashTableLink *result = d_impl.tryEmplace(
+                               &isInsertedFlag,
+                               hint.node(),
+                               BSLS_COMPILERFEATURES_FORWARD(LOOKUP_KEY, key),
+                               BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+            return iterator(result);
+        }
 // }}} END GENERATED CODE
 #endif
 
@@ -1962,6 +2772,23 @@ class unordered_map {
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_batch(FORWARD_ITERATOR first,
+                               FORWARD_ITERATOR last,
+                               OUTPUT_ITERATOR  result) const;
+        // Write, to consecutive positions of the specified 'result', the
+        // iterator that 'find' returns for each key in the range starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', and return the position following the last one written.
+        // The hash codes of a group of keys are computed, and their buckets
+        // and first nodes prefetched, before any key of the group is
+        // compared, so that the memory latency of the lookups overlaps.  The
+        // behavior is undefined unless 'FORWARD_ITERATOR' is a forward
+        // iterator whose 'value_type' is convertible to 'key_type', and
+        // 'OUTPUT_ITERATOR' is an output iterator to which 'const_iterator'
+        // can be written.  Note that this function is an extension to the C++
+        // standard.
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -3595,6 +4422,37 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find_batch(
+                                                       FORWARD_ITERATOR first,
+                                                       FORWARD_ITERATOR last,
+                                                       OUTPUT_ITERATOR  result)
+{
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (first != last) {
+        FORWARD_ITERATOR chunkLast = first;
+        int              numKeys   = 0;
+        do {
+            ++chunkLast;
+            ++numKeys;
+        } while (numKeys < k_CHUNK_SIZE && chunkLast != last);
+
+        d_impl.findBatch(links, first, chunkLast);
+
+        for (int i = 0; i < numKeys; ++i) {
+            *result = iterator(links[i]);
+            ++result;
+        }
+        first = chunkLast;
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -5560,6 +6418,37 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find_batch(
+                                                 FORWARD_ITERATOR first,
+                                                 FORWARD_ITERATOR last,
+                                                 OUTPUT_ITERATOR  result) const
+{
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (first != last) {
+        FORWARD_ITERATOR chunkLast = first;
+        int              numKeys   = 0;
+        do {
+            ++chunkLast;
+            ++numKeys;
+        } while (numKeys < k_CHUNK_SIZE && chunkLast != last);
+
+        d_impl.findBatch(links, first, chunkLast);
+
+        for (int i = 0; i < numKeys; ++i) {
+            *result = const_iterator(links[i]);
+            ++result;
+        }
+        first = chunkLast;
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
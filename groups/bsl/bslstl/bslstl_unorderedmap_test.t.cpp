@@ -187,6 +187,8 @@ using bsl::pair;
 // [24] const VALUE& at(const KEY&) const;
 //
 // search:
+// [45] OUTPUT_ITER find_batch(FWD_ITER first, FWD_ITER last, OUTPUT_ITER);
+// [45] OUTPUT_ITER find_batch(FWD_ITER, FWD_ITER, OUTPUT_ITER) const;
 // [13] size_type count(const KEY& key) const;
 // [13] pair<iterator, iterator> equal_range(const KEY& key);
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
@@ -239,7 +241,7 @@ using bsl::pair;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [41] CLASS TEMPLATE DEDUCTION GUIDES
-// [45] USAGE EXAMPLE
+// [46] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -258,6 +260,7 @@ using bsl::pair;
 // [40] CONCERN: 'find'        properly handles transparent comparators.
 // [40] CONCERN: 'count'       properly handles transparent comparators.
 // [40] CONCERN: 'equal_range' properly handles transparent comparators.
+// [40] CONCERN: 'try_emplace' properly handles transparent comparators.
 // [44] CONCERN: 'unordered_map' IS A C++20 RANGE
 
 // ============================================================================
@@ -1340,6 +1343,71 @@ bool verifySpec(const OBJECT&     object,
     return !strcmp(buf, deducedSpec);
 }
 
+                            // =================
+                            // class KeyIterator
+                            // =================
+
+template <class PAIR>
+class KeyIterator {
+    // This class provides a forward iterator over the 'first' members of an
+    // array of 'PAIR' objects.
+
+    // DATA
+    const PAIR *d_pair_p;  // current element
+
+  public:
+    // TYPES
+    typedef bsl::forward_iterator_tag                  iterator_category;
+    typedef typename bsl::remove_const<
+                          typename PAIR::first_type>::type value_type;
+    typedef std::ptrdiff_t                             difference_type;
+    typedef const typename PAIR::first_type           *pointer;
+    typedef const typename PAIR::first_type&           reference;
+
+    // CREATORS
+    KeyIterator()
+        // Create a singular iterator.
+    : d_pair_p(0)
+    {
+    }
+
+    explicit KeyIterator(const PAIR *pair)
+        // Create an iterator referring to the specified 'pair'.
+    : d_pair_p(pair)
+    {
+    }
+
+    // MANIPULATORS
+    KeyIterator& operator++()
+        // Move this iterator to the next element, and return a reference
+        // providing modifiable access to this iterator.
+    {
+        ++d_pair_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    reference operator*() const
+        // Return a reference to the key of the current element.
+    {
+        return d_pair_p->first;
+    }
+
+    bool operator==(const KeyIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to the
+        // same element, and 'false' otherwise.
+    {
+        return d_pair_p == rhs.d_pair_p;
+    }
+
+    bool operator!=(const KeyIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' do not refer
+        // to the same element, and 'false' otherwise.
+    {
+        return d_pair_p != rhs.d_pair_p;
+    }
+};
+
 }  // close namespace u
 
 }  // close unnamed namespace
@@ -1591,6 +1659,68 @@ void testTransparentComparator(Container& container,
     ASSERT(expectedConversionCount == nonExistingKey.conversionCount());
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class Container>
+void testTransparentTryEmplace(Container *container,
+                               bool       isTransparent,
+                               int        initKeyValue)
+    // Call 'try_emplace', with and without a hint, on the specified
+    // 'container' with a key equal to the specified 'initKeyValue', and count
+    // the number of conversions expected based on the specified
+    // 'isTransparent'.  Then call 'try_emplace' with a key not present in
+    // 'container', and verify that the key is converted exactly once to
+    // construct the new element.  The behavior is undefined unless
+    // 'initKeyValue' is in 'container' and '-initKeyValue - 100' is not.
+{
+    typedef typename Container::iterator Iterator;
+
+    int expectedConversionCount = 0;
+
+    TransparentlyComparable existingKey(initKeyValue);
+    TransparentlyComparable nonExistingKey(-initKeyValue - 100);
+
+    const typename Container::size_type SIZE = container->size();
+
+    // Testing 'try_emplace' for an existing key.
+
+    const bsl::pair<Iterator, bool> EXISTING_R =
+                                     container->try_emplace(existingKey, 42);
+    if (!isTransparent) {
+        ++expectedConversionCount;
+    }
+
+    ASSERT(false                         == EXISTING_R.second);
+    ASSERT(initKeyValue                  == EXISTING_R.first->first);
+    ASSERT(initKeyValue                  == EXISTING_R.first->second);
+    ASSERT(existingKey.conversionCount() == expectedConversionCount);
+    ASSERT(SIZE                          == container->size());
+
+    const Iterator EXISTING_H = container->try_emplace(container->cbegin(),
+                                                       existingKey,
+                                                       42);
+    if (!isTransparent) {
+        ++expectedConversionCount;
+    }
+
+    ASSERT(EXISTING_R.first              == EXISTING_H);
+    ASSERT(existingKey.conversionCount() == expectedConversionCount);
+    ASSERT(SIZE                          == container->size());
+
+    // Testing 'try_emplace' for a new key; the key is converted once.
+
+    const bsl::pair<Iterator, bool> NEW_R =
+                                  container->try_emplace(nonExistingKey, 42);
+
+    ASSERT(true                == NEW_R.second);
+    ASSERT(-initKeyValue - 100 == NEW_R.first->first);
+    ASSERT(42                  == NEW_R.first->second);
+    ASSERT(1                   == nonExistingKey.conversionCount());
+    ASSERT(SIZE + 1            == container->size());
+
+    container->erase(NEW_R.first);
+}
+#endif
+
                          // ================
                          // class IntValue
                          // ================
@@ -1955,6 +2085,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase45();
+        // Test 'find_batch'.
+
     static void testCase44_isRange();
         // Test whether 'unordered_map' is a C++20 range.
 
@@ -2142,6 +2275,103 @@ void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::matchFirstValues(
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase45()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'find_batch'
+    //
+    // Concerns:
+    //: 1 'find_batch' writes, for each key of the range, the iterator that
+    //:   'find' returns for that key: an iterator referring to the element
+    //:   having the key if it exists, and 'end()' otherwise.
+    //:
+    //: 2 Exactly one iterator is written per key, and the returned position
+    //:   follows the last iterator written.
+    //:
+    //: 3 Ranges shorter than, equal to, and longer than the number of keys
+    //:   that are looked up together are supported.
+    //:
+    //: 4 Both the 'const' and non-'const' versions return the same values.
+    //:
+    //: 5 No memory is allocated.
+    //
+    // Plan:
+    //: 1 Use a loop-based approach for different lengths:
+    //:
+    //:   1 Create an object for each length, containing every other one of
+    //:     the test values.
+    //:
+    //:   2 Call 'find_batch' on every prefix of the keys of the test values,
+    //:     both on the object and on a 'const' reference to it, and compare
+    //:     each output iterator with the result of 'find'.  (C-1..4)
+    //:
+    //:   3 Verify no memory is allocated from any allocators.  (C-5)
+    //
+    // Testing:
+    //   OUTPUT_ITER find_batch(FWD_ITER first, FWD_ITER last, OUTPUT_ITER);
+    //   OUTPUT_ITER find_batch(FWD_ITER, FWD_ITER, OUTPUT_ITER) const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("TESTING 'find_batch': %s\n"
+                        "--------------------\n", NameOf<KEY>().name());
+
+    typedef u::KeyIterator<TValueType> KeyIter;
+
+    const TestValues VALUES;  // contains 52 distinct increasing values
+
+    const size_t NUM_VALUES = VALUES.size();
+    const size_t MAX_LENGTH = NUM_VALUES / 2;
+
+    for (size_t ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const size_t LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (size_t i = 0; i < LENGTH; ++i) {
+            pair<Iter, bool> RESULT = primaryManipulator(
+                                                &mX, u::idOf(VALUES[2 * i]));
+            ASSERTV(ti, i, true == RESULT.second);
+        }
+        ASSERTV(ti, LENGTH == X.size());
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (size_t tj = 0; tj <= NUM_VALUES; ++tj) {
+            const size_t NUM_KEYS = tj;
+
+            const KeyIter FIRST(VALUES.data());
+            const KeyIter LAST(VALUES.data() + NUM_KEYS);
+
+            Iter  results[52 + 1];
+            CIter cResults[52 + 1];
+            ASSERT(NUM_VALUES <= 52);
+
+            Iter  *end  = mX.find_batch(FIRST, LAST, results);
+            CIter *cEnd =  X.find_batch(FIRST, LAST, cResults);
+
+            ASSERTV(ti, tj, results  + NUM_KEYS == end);
+            ASSERTV(ti, tj, cResults + NUM_KEYS == cEnd);
+
+            for (size_t i = 0; i < NUM_KEYS; ++i) {
+                const Key& K = VALUES[i].first;
+
+                ASSERTV(ti, tj, i, mX.find(K) == results[i]);
+                ASSERTV(ti, tj, i,  X.find(K) == cResults[i]);
+                ASSERTV(ti, tj, i, (i % 2 || i >= 2 * LENGTH) ==
+                                                   (X.end() == cResults[i]));
+            }
+        }
+        ASSERTV(ti, oam.isTotalSame());
+        ASSERTV(ti, da.numAllocations(), 0 == da.numAllocations());
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase44_isRange()
 {
@@ -9403,6 +9633,34 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 46: {
+        if (verbose)
+            printf("\nTEST CASE %d IS HANDLED BY PRIMARY TEST DRIVER"
+                   "\n==============================================\n",
+                   test);
+      } break;
+      case 45: {
+        // --------------------------------------------------------------------
+        // TESTING 'find_batch'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'find_batch'"
+                            "\n====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase45,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR,
+                      bsltf::NonOptionalAllocTestType);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        RUN_EACH_TYPE(TestDriver,
+                      testCase45,
+                      bsltf::MoveOnlyAllocTestType,
+                      bsltf::WellBehavedMoveOnlyAllocTestType);
+#endif
+
+        TestDriver<TestKeyType, TestValueType>::testCase45();
+      } break;
       case 44: {
         // --------------------------------------------------------------------
         // CONCERN: 'unordered_map' IS A C++20 RANGE
@@ -9559,6 +9817,10 @@ int main(int argc, char *argv[])
         //:
         //: 2 'unordered_map' has a transparent set of lookup functions if the
         //:   comparator is transparent.
+        //:
+        //: 3 'try_emplace' does not convert a key that is already present if
+        //:   the hasher and comparator are transparent, and converts a new
+        //:   key exactly once.
         //
         // Plan:
         //: 1 Construct a non-transparent map and call the lookup functions
@@ -9569,11 +9831,15 @@ int main(int argc, char *argv[])
         //: 2 Construct a transparent map and call the lookup functions with a
         //:   type that is convertible to the 'value_type'.  There should be no
         //:   conversions.  (C-2)
+        //:
+        //: 3 Call 'try_emplace' on both maps, with and without a hint, for
+        //:   existing and new keys, and count the conversions.  (C-3)
         //
         // Testing:
         //   CONCERN: 'find'        properly handles transparent comparators.
         //   CONCERN: 'count'       properly handles transparent comparators.
         //   CONCERN: 'equal_range' properly handles transparent comparators.
+        //   CONCERN: 'try_emplace' properly handles transparent comparators.
         // --------------------------------------------------------------------
 
         if (verbose) printf("\n" "TESTING TRANSPARENT COMPARATOR" "\n"
@@ -9631,6 +9897,14 @@ int main(int argc, char *argv[])
                 printf("\tTesting mutable transparent map.\n");
             }
             testTransparentComparator(mXT,  true,  KEY);
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+            if (veryVerbose) {
+                printf("\tTesting 'try_emplace' on both maps.\n");
+            }
+            testTransparentTryEmplace(&mXNT, false, KEY);
+            testTransparentTryEmplace(&mXT,  true,  KEY);
+#endif
         }
       } break;
       case 39: {